@@ -228,6 +228,13 @@ shown below:
 // Add some useful methods to the ACEFileHandler class
 %extend Data::ACEFileHandler
 {
+  // Share the tables loaded by the processes on each node
+  static void shareTablesWithinNodes()
+  {
+    Data::ACEFileHandler::setNodeCommunicator(
+                         Utility::Communicator::getDefault()->splitByNode() );
+  }
+
   // Return the table's ZAIDs
   std::vector<Data::ZAID> Data::ACEFileHandler::getTableZAIDs() const
   {
@@ -262,6 +269,12 @@ shown below:
 // Ignore the original getTableZAIDs but keep the extened version
 %ignore Data::ACEFileHandler::getTableZAIDs() const;
 
+// Ignore the table memory owner (the XSS array can be used instead)
+%ignore Data::ACEFileHandler::getTableXSSArrayOwner() const;
+
+// Ignore the node communicator setter (use shareTablesWithinNodes instead)
+%ignore Data::ACEFileHandler::setNodeCommunicator;
+
 // Include ACEFileHandler
 %include "Data_ACEFileHandler.hpp"
 
@@ -287,6 +300,9 @@ shown below:
 "
 
 // Include XSSNeutronDataExtractor
+// Ignore the memory mapped xss array constructor
+%ignore Data::XSSNeutronDataExtractor::XSSNeutronDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const Utility::ArrayView<const double>&, const std::shared_ptr<const void>& );
+
 %include "Data_XSSNeutronDataExtractor.hpp"
 
 // ---------------------------------------------------------------------------//
@@ -317,6 +333,9 @@ shown below:
 %shared_ptr( Data::XSSEPRDataExtractor )
 
 // Include XSSEPRDataExtractor
+// Ignore the memory mapped xss array constructor
+%ignore Data::XSSEPRDataExtractor::XSSEPRDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const Utility::ArrayView<const double>&, const std::shared_ptr<const void>& );
+
 %include "Data_XSSEPRDataExtractor.hpp"
 
 // ---------------------------------------------------------------------------//
@@ -324,6 +343,9 @@ shown below:
 // ---------------------------------------------------------------------------//
 
 // Include XSSElectronDataExtractor
+// Ignore the memory mapped xss array constructor
+%ignore Data::XSSElectronDataExtractor::XSSElectronDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const Utility::ArrayView<const double>&, const std::shared_ptr<const void>& );
+
 %include "Data_XSSElectronDataExtractor.hpp"
 
 // ---------------------------------------------------------------------------//
@@ -331,6 +353,9 @@ shown below:
 // ---------------------------------------------------------------------------//
 
 // Include XSSPhotonuclearDataExtractor
+// Ignore the memory mapped xss array constructor
+%ignore Data::XSSPhotonuclearDataExtractor::XSSPhotonuclearDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const Utility::ArrayView<const double>&, const std::shared_ptr<const void>& );
+
 %include "Data_XSSPhotonuclearDataExtractor.hpp"
 
 // ---------------------------------------------------------------------------//
@@ -338,6 +363,9 @@ shown below:
 // ---------------------------------------------------------------------------//
 
 // Include XSSPhotoatomicDataExtractor
+// Ignore the memory mapped xss array constructor
+%ignore Data::XSSPhotoatomicDataExtractor::XSSPhotoatomicDataExtractor( const Utility::ArrayView<const int>&, const Utility::ArrayView<const int>&, const Utility::ArrayView<const double>&, const std::shared_ptr<const void>& );
+
 %include "Data_XSSPhotoatomicDataExtractor.hpp"
 
 
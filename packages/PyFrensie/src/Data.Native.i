@@ -95,6 +95,16 @@ using namespace Data;
 %template(DoubleVectorMap) std::map<double,std::vector<double> >;
 %template(DoubleVectorVector) std::vector<std::vector<double> >;
 
+// The energy grids and cross sections are returned as array views - the view
+// data will be deep-copied into a NumPy array
+%typemap(out) Utility::ArrayView<const double>
+{
+  $result = PyFrensie::Details::convertArrayToPython( $1 );
+
+  if( !$result )
+    SWIG_fail;
+}
+
 //---------------------------------------------------------------------------//
 // Add support for the NativeEPRPhotoatomicDataProperties
 //---------------------------------------------------------------------------//
@@ -23,6 +23,9 @@ monte_carlo/collision subpackage.
 #include "MonteCarlo_SimulationProperties.hpp"
 #include "MonteCarlo_ScatteringCenterDefinition.hpp"
 #include "MonteCarlo_ScatteringCenterDefinitionDatabase.hpp"
+#include "MonteCarlo_NodeSharedReactionData.hpp"
+
+#include "Utility_Communicator.hpp"
 
 #include "Utility_SerializationHelpers.hpp"
 #include "Utility_ToStringTraitsDecl.hpp"
@@ -88,6 +91,34 @@ using namespace MonteCarlo;
 
 %include "MonteCarlo_ScatteringCenterDefinition.i"
 
+//---------------------------------------------------------------------------//
+// NodeSharedReactionData support
+//---------------------------------------------------------------------------//
+
+// Add some useful methods to the NodeSharedReactionData class
+%extend MonteCarlo::NodeSharedReactionData
+{
+  // Share the reaction data created by the processes on each node
+  static void shareReactionDataWithinNodes()
+  {
+    MonteCarlo::NodeSharedReactionData::setNodeCommunicator(
+                         Utility::Communicator::getDefault()->splitByNode() );
+  }
+};
+
+// Ignore the node communicator setter (use shareReactionDataWithinNodes
+// instead)
+%ignore MonteCarlo::NodeSharedReactionData::setNodeCommunicator;
+
+// Ignore the methods that are only used by the reactions and the filled
+// geometry models
+%ignore MonteCarlo::NodeSharedReactionData::CrossSectionArena;
+%ignore MonteCarlo::NodeSharedReactionData::shareCrossSection;
+%ignore MonteCarlo::NodeSharedReactionData::cancelCrossSectionSharing;
+
+// Include NodeSharedReactionData
+%include "MonteCarlo_NodeSharedReactionData.hpp"
+
 //---------------------------------------------------------------------------//
 // Material support
 //---------------------------------------------------------------------------//
@@ -11,6 +11,9 @@
 #include "PyFrensie_PythonTypeTraits.hpp"
 #include "MonteCarlo_ParticleType.hpp"
 #include "MonteCarlo_ParticleModeType.hpp"
+#include "MonteCarlo_TrackingMethodType.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "MonteCarlo_IncoherentModelType.hpp"
 #include "MonteCarlo_IncoherentAdjointModelType.hpp"
 #include "MonteCarlo_AdjointKleinNishinaSamplingType.hpp"
@@ -89,6 +92,15 @@ using namespace MonteCarlo;
 // Import the ParticleModeType
 %include "MonteCarlo_ParticleModeType.hpp"
 
+// Import the TrackingMethodType
+%include "MonteCarlo_TrackingMethodType.hpp"
+
+// Import the HistoryScheduleType
+%include "MonteCarlo_HistoryScheduleType.hpp"
+
+// Import the RandomNumberGeneratorType
+%include "Utility_RandomNumberGeneratorType.hpp"
+
 // Import the IncoherentModelType
 %include "MonteCarlo_IncoherentModelType.hpp"
 
@@ -59,6 +59,67 @@ MonteCarlo::PROPERTIES::setNumberOfBatchesPerProcessor;
 %feature("autodoc", "getNumberOfBatchesPerProcessor(PROPERTIES self) -> unsigned")
 MonteCarlo::PROPERTIES::getNumberOfBatchesPerProcessor;
 
+// Set/get the tracking method
+%feature("autodoc", "setTrackingMethod(PROPERTIES self, const TrackingMethodType tracking_method) -> void")
+MonteCarlo::PROPERTIES::setTrackingMethod;
+
+%feature("autodoc", "getTrackingMethod(PROPERTIES self) -> TrackingMethodType")
+MonteCarlo::PROPERTIES::getTrackingMethod;
+
+// Set/get the delta tracking majorant ratio threshold
+%feature("autodoc", "setDeltaTrackingMajorantRatioThreshold(PROPERTIES self, const double threshold) -> void")
+MonteCarlo::PROPERTIES::setDeltaTrackingMajorantRatioThreshold;
+
+%feature("autodoc", "getDeltaTrackingMajorantRatioThreshold(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getDeltaTrackingMajorantRatioThreshold;
+
+%feature("autodoc", "setMaterialUnionizedGridMemoryBudget(PROPERTIES self, const unsigned long long budget) -> void")
+MonteCarlo::PROPERTIES::setMaterialUnionizedGridMemoryBudget;
+
+%feature("autodoc", "getMaterialUnionizedGridMemoryBudget(PROPERTIES self) -> unsigned long long")
+MonteCarlo::PROPERTIES::getMaterialUnionizedGridMemoryBudget;
+
+// Set/get the history schedule
+%feature("autodoc", "setHistorySchedule(PROPERTIES self, const HistoryScheduleType schedule) -> void")
+MonteCarlo::PROPERTIES::setHistorySchedule;
+
+%feature("autodoc", "getHistorySchedule(PROPERTIES self) -> HistoryScheduleType")
+MonteCarlo::PROPERTIES::getHistorySchedule;
+
+// Set/get the history schedule chunk size
+%feature("autodoc", "setHistoryScheduleChunkSize(PROPERTIES self, const unsigned long long chunk_size) -> void")
+MonteCarlo::PROPERTIES::setHistoryScheduleChunkSize;
+
+%feature("autodoc", "getHistoryScheduleChunkSize(PROPERTIES self) -> unsigned long long")
+MonteCarlo::PROPERTIES::getHistoryScheduleChunkSize;
+
+// Set/get the rendezvous mode
+%feature("autodoc", "setAsynchronousRendezvousModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setAsynchronousRendezvousModeOn;
+
+%feature("autodoc", "setSynchronousRendezvousModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setSynchronousRendezvousModeOn;
+
+%feature("autodoc", "isAsynchronousRendezvousModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isAsynchronousRendezvousModeOn;
+
+// Set/get the random number generator type
+%feature("autodoc", "setRandomNumberGeneratorType(PROPERTIES self, const RandomNumberGeneratorType type) -> void")
+MonteCarlo::PROPERTIES::setRandomNumberGeneratorType;
+
+%feature("autodoc", "getRandomNumberGeneratorType(PROPERTIES self) -> RandomNumberGeneratorType")
+MonteCarlo::PROPERTIES::getRandomNumberGeneratorType;
+
+// Set/get the estimator merge mode
+%feature("autodoc", "setHistoryOrderedEstimatorMergeModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setHistoryOrderedEstimatorMergeModeOn;
+
+%feature("autodoc", "setThreadOrderedEstimatorMergeModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setThreadOrderedEstimatorMergeModeOn;
+
+%feature("autodoc", "isHistoryOrderedEstimatorMergeModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isHistoryOrderedEstimatorMergeModeOn;
+
 
 %enddef
 
@@ -136,6 +197,38 @@ MonteCarlo::PROPERTIES::setUnresolvedResonanceProbabilityTableModeOff;
 %feature("autodoc", "isUnresolvedResonanceProbabilityTableModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isUnresolvedResonanceProbabilityTableModeOn;
 
+// Set/get the number of inactive k-eigenvalue cycles
+%feature("autodoc", "setNumberOfInactiveCycles(PROPERTIES self, const unsigned cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfInactiveCycles;
+
+%feature("autodoc", "getNumberOfInactiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfInactiveCycles;
+
+// Set/get the number of active k-eigenvalue cycles
+%feature("autodoc", "setNumberOfActiveCycles(PROPERTIES self, const unsigned cycles) -> void")
+MonteCarlo::PROPERTIES::setNumberOfActiveCycles;
+
+%feature("autodoc", "getNumberOfActiveCycles(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getNumberOfActiveCycles;
+
+// Set/get the number of histories per k-eigenvalue cycle
+%feature("autodoc", "setNumberOfHistoriesPerCycle(PROPERTIES self, const uint64_t histories) -> void")
+MonteCarlo::PROPERTIES::setNumberOfHistoriesPerCycle;
+
+%feature("autodoc", "getNumberOfHistoriesPerCycle(PROPERTIES self) -> uint64_t")
+MonteCarlo::PROPERTIES::getNumberOfHistoriesPerCycle;
+
+// Check if k-eigenvalue mode is on
+%feature("autodoc", "isKEigenvalueModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isKEigenvalueModeOn;
+
+// Set/get the number of Shannon entropy mesh bins per dimension
+%feature("autodoc", "setShannonEntropyMeshBinsPerDimension(PROPERTIES self, const unsigned bins) -> void")
+MonteCarlo::PROPERTIES::setShannonEntropyMeshBinsPerDimension;
+
+%feature("autodoc", "getShannonEntropyMeshBinsPerDimension(PROPERTIES self) -> unsigned")
+MonteCarlo::PROPERTIES::getShannonEntropyMeshBinsPerDimension;
+
 %enddef
 
 //---------------------------------------------------------------------------//
@@ -289,6 +382,35 @@ MonteCarlo::PROPERTIES::setAtomicExcitationModeOff;
 %feature("autodoc", "isAtomicExcitationModeOn(PROPERTIES self) -> bool")
 MonteCarlo::PROPERTIES::isAtomicExcitationModeOn;
 
+// Set condensed history mode On/Off
+%feature("autodoc", "setCondensedHistoryModeOn(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryModeOn;
+
+%feature("autodoc", "setCondensedHistoryModeOff(PROPERTIES self) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryModeOff;
+
+%feature("autodoc", "isCondensedHistoryModeOn(PROPERTIES self) -> bool")
+MonteCarlo::PROPERTIES::isCondensedHistoryModeOn;
+
+// Set/get the condensed history step and production thresholds
+%feature("autodoc", "setCondensedHistoryMaxEnergyLossFraction(PROPERTIES self, const double fraction) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryMaxEnergyLossFraction;
+
+%feature("autodoc", "getCondensedHistoryMaxEnergyLossFraction(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getCondensedHistoryMaxEnergyLossFraction;
+
+%feature("autodoc", "setCondensedHistoryKnockOnThreshold(PROPERTIES self, const double threshold) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryKnockOnThreshold;
+
+%feature("autodoc", "getCondensedHistoryKnockOnThreshold(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getCondensedHistoryKnockOnThreshold;
+
+%feature("autodoc", "setCondensedHistoryBremsstrahlungThreshold(PROPERTIES self, const double threshold) -> void")
+MonteCarlo::PROPERTIES::setCondensedHistoryBremsstrahlungThreshold;
+
+%feature("autodoc", "getCondensedHistoryBremsstrahlungThreshold(PROPERTIES self) -> double")
+MonteCarlo::PROPERTIES::getCondensedHistoryBremsstrahlungThreshold;
+
 // Set/get the critical line energies
 %feature("autodoc", "setCriticalAdjointElectronLineEnergies(PROPERTIES self, const std::vector<double>& critical_line_energies) -> void")
 MonteCarlo::PROPERTIES::setCriticalAdjointElectronLineEnergies;
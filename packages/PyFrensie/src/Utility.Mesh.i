@@ -100,6 +100,10 @@ typedef unsigned long int uint64_t;
 %ignore *::getEndElementHandleIterator();
 %ignore *::exportData();
 
+// Ignore functions that operate on raw arrays or templated visitors
+%ignore *::accumulateTrackLengths;
+%ignore *::traverseElements;
+
 
 
 // Add a typemap for ElementHandleVolumeMap& element_volumes
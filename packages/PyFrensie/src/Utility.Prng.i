@@ -34,6 +34,8 @@ Prng.RandomNumberGenerator proxy class.
 
 // Frensie Includes
 #include "PyFrensie_PythonTypeTraits.hpp"
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 %}
 
@@ -123,6 +125,37 @@ this class is shown below:
 // Include LinearCongruentialGenerator
 %include "Utility_LinearCongruentialGenerator.hpp"
 
+//---------------------------------------------------------------------------//
+// Add support for the Philox generator
+//---------------------------------------------------------------------------//
+// Add more detailed docstrings for the Philox generator
+%feature("docstring")
+Utility::PhiloxGenerator
+"
+The PhiloxGenerator is a counter-based generator (Philox4x32-10) that can be
+used to generate a uniform deviate in [0,1). Every (history, particle) pair
+has its own stream, which will never overlap the stream of another pair. A
+brief usage tutorial for this class is shown below:
+
+  import PyFrensie.Utility.Prng
+
+  generator = PyFrensie.Utility.Prng.PhiloxGenerator()
+  generator.getRandomNumber()
+  generator.getDrawCounter()
+
+  generator.changeHistory( 10 )
+  generator.changeParticle( 2 )
+  generator.getRandomNumber()
+"
+
+// The raw array methods are not supported
+%ignore Utility::PhiloxGenerator::getRandomNumbers;
+%ignore Utility::PhiloxGenerator::generateBlock;
+
+// Include PhiloxGenerator
+%include <stdint.i>
+%include "Utility_PhiloxGenerator.hpp"
+
 //---------------------------------------------------------------------------//
 // Add support for the RandomNumberGenerator interface
 //---------------------------------------------------------------------------//
@@ -207,6 +240,19 @@ that the original random number stream state will be reset as well.
   $1 = (PyArray_Check($input) || PySequence_Check($input)) ? 1 : 0;
 }
 
+%feature("docstring")
+Utility::RandomNumberGenerator::setGeneratorType
+"
+This method sets the underlying random number generator type
+(LINEAR_CONGRUENTIAL_GENERATOR or PHILOX_GENERATOR).
+"
+
+// The raw array methods are not supported
+%ignore Utility::RandomNumberGenerator::getRandomNumbers;
+
+// Include the RandomNumberGeneratorType
+%include "Utility_RandomNumberGeneratorType.hpp"
+
 // Include the RandomNumberGenerator
 %include "Utility_RandomNumberGenerator.hpp"
 
@@ -8,26 +8,240 @@
 
 // Std Lib Includes
 #include <stdexcept>
+#include <fstream>
+#include <cstring>
+#include <cmath>
+#include <functional>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
 #include "Data_ACEHelperWrappers.hpp"
+#include "Utility_NodeSharedMemory.hpp"
+#include "Utility_LoggingMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 
 namespace Data{
 
+namespace Details{
+
+//! The ACE table header (stored in the table cache files)
+struct ACETableHeader
+{
+  // The cache file identifier
+  char identifier[16];
+
+  // The cache file version
+  uint64_t version;
+
+  // The offset of the xss array from the start of the file (bytes)
+  uint64_t xss_offset;
+
+  // The size of the xss array
+  uint64_t xss_size;
+
+  // The size of the ace library when the cache was created (bytes)
+  uint64_t library_size;
+
+  // The last write time of the ace library when the cache was created
+  int64_t library_write_time;
+
+  // The table start line (or record)
+  uint64_t table_start;
+
+  // The table name
+  char table_name[16];
+
+  // The table processing date
+  char processing_date[16];
+
+  // The table comment
+  char comment[80];
+
+  // The table material id
+  char material_id[16];
+
+  // The table atomic weight ratio
+  double atomic_weight_ratio;
+
+  // The table temperature (MeV)
+  double temperature;
+
+  // The table zaids
+  int32_t zaids[16];
+
+  // The table atomic weight ratios
+  double atomic_weight_ratios[16];
+
+  // The table nxs array
+  int32_t nxs[16];
+
+  // The table jxs array
+  int32_t jxs[32];
+};
+
+//! The ACE table cache file identifier
+const char ace_table_cache_identifier[16] = "FRENSIE_ACE_TBL";
+
+//! The ACE table cache file version
+const uint64_t ace_table_cache_version = 1;
+
+//! The ACE table cache xss array offset (the xss array is page-aligned)
+const uint64_t ace_table_cache_xss_offset = 4096;
+
+// Copy a string into a fixed size char array
+inline void copyToCharArray( const std::string& string,
+                             char* char_array,
+                             const size_t char_array_size )
+{
+  std::memset( char_array, 0, char_array_size );
+  std::strncpy( char_array, string.c_str(), char_array_size-1 );
+}
+
+// Read a value from a binary stream
+template<typename T>
+inline void readBinaryValue( std::istream& is, T& value )
+{
+  is.read( reinterpret_cast<char*>( &value ), sizeof(T) );
+}
+
+// Reverse the byte order of a value
+template<typename T>
+inline T reverseByteOrder( const T value )
+{
+  T reversed_value;
+
+  const char* bytes = reinterpret_cast<const char*>( &value );
+  char* reversed_bytes = reinterpret_cast<char*>( &reversed_value );
+
+  for( size_t i = 0; i < sizeof(T); ++i )
+    reversed_bytes[i] = bytes[sizeof(T)-1-i];
+
+  return reversed_value;
+}
+  
+} // end Details namespace
+
+// Initialize static member data
+const size_t ACEFileHandler::s_default_binary_record_length = 4096;
+
+const size_t ACEFileHandler::s_default_binary_entries_per_record = 512;
+
+const size_t ACEFileHandler::s_binary_header_size =
+  10 + 2*sizeof(double) + 10 + 70 + 10 +
+  16*(sizeof(int32_t) + sizeof(double)) + 16*sizeof(int32_t) +
+  32*sizeof(int32_t);
+
+boost::filesystem::path ACEFileHandler::s_table_cache_directory;
+
+std::shared_ptr<const Utility::Communicator> ACEFileHandler::s_node_comm;
+
+// Set the table cache directory
+/*! \details The directory will be created if it does not exist.
+ */
+void ACEFileHandler::setTableCacheDirectory(
+                              const boost::filesystem::path& cache_directory )
+{
+  if( !boost::filesystem::exists( cache_directory ) )
+    boost::filesystem::create_directories( cache_directory );
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::is_directory( cache_directory ),
+                      std::runtime_error,
+                      "The ACE table cache directory ("
+                      << cache_directory.string() << ") is not a "
+                      "directory!" );
+
+  s_table_cache_directory = cache_directory;
+  s_table_cache_directory.make_preferred();
+}
+
+// Unset the table cache directory
+void ACEFileHandler::unsetTableCacheDirectory()
+{
+  s_table_cache_directory.clear();
+}
+
+// Get the table cache directory (empty if not set)
+const boost::filesystem::path& ACEFileHandler::getTableCacheDirectory()
+{
+  return s_table_cache_directory;
+}
+
+// Set the node communicator used to share tables
+/*! \details Once a node communicator has been set (see
+ * Utility::Communicator::splitByNode) each table will only be loaded by the
+ * root process of the node and the XSS array will be stored in memory that
+ * is shared by every process of the node. The construction of an
+ * ACEFileHandler then becomes a collective operation on the node
+ * communicator (every process of the node must load the same tables in the
+ * same order).
+ */
+void ACEFileHandler::setNodeCommunicator(
+                 const std::shared_ptr<const Utility::Communicator>& node_comm )
+{
+  // Make sure the communicator is valid
+  testPrecondition( node_comm.get() );
+
+  s_node_comm = node_comm;
+}
+
+// Unset the node communicator used to share tables
+void ACEFileHandler::unsetNodeCommunicator()
+{
+  s_node_comm.reset();
+}
+
 // Constructor
+/*! \details Binary tables are assumed to use the default record layout
+ * (4096 byte records with 512 XSS entries per record).
+ */
 ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 				const std::string& table_name,
 				const size_t table_start_line,
 				const bool is_ascii )
+  : ACEFileHandler( file_name_with_path,
+                    table_name,
+                    table_start_line,
+                    is_ascii,
+                    s_default_binary_record_length,
+                    s_default_binary_entries_per_record )
+{ /* ... */ }
+
+// Constructor (binary table with the record layout from the xsdir)
+/*! \details The record length (in bytes) and the number of entries per
+ * record are stored in the xsdir entry of the table.
+ */
+ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+                                const std::string& table_name,
+                                const size_t table_start_record,
+                                const size_t record_length,
+                                const size_t entries_per_record )
+  : ACEFileHandler( file_name_with_path,
+                    table_name,
+                    table_start_record,
+                    false,
+                    record_length,
+                    entries_per_record )
+{ /* ... */ }
+
+// Constructor
+ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+                                const std::string& table_name,
+                                const size_t table_start_line,
+                                const bool is_ascii,
+                                const size_t record_length,
+                                const size_t entries_per_record )
   : d_ace_file_id( 1 ),
     d_ace_library_name( file_name_with_path ),
+    d_binary_record_length( record_length ),
+    d_binary_entries_per_record( entries_per_record ),
     d_ace_table_name( 10, ' ' ),
     d_ace_table_processing_date( 10, ' ' ),
     d_ace_table_comment( 70, ' ' ),
@@ -38,7 +252,9 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
     d_atomic_weight_ratios(),
     d_nxs(),
     d_jxs(),
-    d_xss( new std::vector<double> )
+    d_xss( new std::vector<double> ),
+    d_mapped_table(),
+    d_xss_view()
 {
   // Convert to the preferred path format
   d_ace_library_name.make_preferred();
@@ -47,15 +263,124 @@ ACEFileHandler::ACEFileHandler( const boost::filesystem::path& file_name_with_pa
                       std::runtime_error,
                       "ACE file " << d_ace_library_name.string() <<
                       " does not exist!" );
-  
-  this->openACEFile( d_ace_library_name.string(), is_ascii );
-  this->readACETable( table_name, table_start_line );
+
+  TEST_FOR_EXCEPTION( !is_ascii &&
+                      (entries_per_record == 0 ||
+                       record_length < entries_per_record*sizeof(double) ||
+                       record_length < s_binary_header_size),
+                      std::runtime_error,
+                      "The binary ACE file record layout ("
+                      << record_length << " byte records with "
+                      << entries_per_record << " entries per record) is "
+                      "not valid!" );
+
+  if( s_node_comm && s_node_comm->size() > 1 )
+    this->loadNodeSharedTable( table_name, table_start_line, is_ascii );
+  else
+    this->loadTable( table_name, table_start_line, is_ascii );
 }
 
 // Destructor
 ACEFileHandler::~ACEFileHandler()
 {}
 
+// Load the table
+void ACEFileHandler::loadTable( const std::string& table_name,
+                                const size_t table_start_line,
+                                const bool is_ascii )
+{
+  // Try to use the cached table
+  boost::filesystem::path cache_path;
+
+  if( !s_table_cache_directory.empty() )
+  {
+    cache_path = this->getTableCachePath( table_name, table_start_line );
+
+    if( this->mapTableCache( cache_path, table_name, table_start_line ) )
+      return;
+  }
+
+  if( is_ascii )
+  {
+    this->openACEFile( d_ace_library_name.string(), is_ascii );
+    this->readACETable( table_name, table_start_line );
+  }
+  else
+    this->readBinaryACETable( table_name, table_start_line );
+
+  d_xss_view = Utility::arrayViewOfConst( *d_xss );
+
+  // Cache the table and switch to the mapped copy
+  if( !cache_path.empty() )
+  {
+    this->writeTableCache( cache_path, table_start_line );
+    this->mapTableCache( cache_path, table_name, table_start_line );
+  }
+}
+
+// Load the table once per node and share it with the other node processes
+/*! \details The root process of the node communicator loads the table
+ * (using the table cache if one has been set) and the XSS array is then
+ * copied to memory that is shared by every process of the node. Only the
+ * XSS array is shared - the objects that are constructed from it are not.
+ */
+void ACEFileHandler::loadNodeSharedTable( const std::string& table_name,
+                                          const size_t table_start_line,
+                                          const bool is_ascii )
+{
+  Details::ACETableHeader header;
+  std::memset( &header, 0, sizeof(header) );
+
+  std::string error_message;
+
+  if( s_node_comm->rank() == 0 )
+  {
+    try{
+      this->loadTable( table_name, table_start_line, is_ascii );
+      this->fillTableHeader( header, table_start_line );
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+    }
+  }
+
+  Utility::broadcast( *s_node_comm, error_message, 0 );
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      std::runtime_error,
+                      "ACE table " << table_name << " could not be loaded "
+                      "by the node root process: " << error_message );
+
+  Utility::broadcast( *s_node_comm,
+                      Utility::ArrayView<char>(
+                                      reinterpret_cast<char*>( &header ),
+                                      sizeof(header) ),
+                      0 );
+
+  if( s_node_comm->rank() != 0 )
+    this->setTableHeaderData( header );
+
+  std::shared_ptr<const Utility::NodeSharedMemory> shared_table(
+    new Utility::NodeSharedMemory(
+                 *s_node_comm,
+                 header.xss_size*sizeof(double),
+                 [this]( void* address ){
+                   std::copy( d_xss_view.begin(),
+                              d_xss_view.end(),
+                              static_cast<double*>( address ) );
+                 } ) );
+
+  d_xss_view = Utility::ArrayView<const double>(
+                  static_cast<const double*>( shared_table->getAddress() ),
+                  header.xss_size );
+
+  d_mapped_table = shared_table;
+
+  // The xss array will only be created if it is requested
+  d_xss.reset();
+}
+
 // Open an ACE library file
 void ACEFileHandler::openACEFile( const std::string& file_name,
 				  const bool is_ascii )
@@ -109,26 +434,11 @@ void ACEFileHandler::readACETable( const std::string& table_name,
 			   Utility::reinterpretAsRaw(&d_temperature),
 			   &d_ace_table_processing_date[0] );
 
-  // Clear white space from the ace table name and processing date
-  boost::algorithm::trim( d_ace_table_name );
-  boost::algorithm::trim( d_ace_table_processing_date );
-
-  // Test that the table name is the same as the desired table name
-  TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
-                      std::runtime_error,
-                      "Expected table " << table_name << " at line "
-                      << table_start_line << " of ACE library "
-                      << d_ace_library_name << " but found table "
-                      << d_ace_table_name << "!" );
-
   // Read the second line of the ACE table header
   readAceTableHeaderLine2( d_ace_file_id,
 			   &d_ace_table_comment[0],
 			   &d_ace_table_material_id[0] );
 
-  boost::algorithm::trim( d_ace_table_comment );
-  boost::algorithm::trim( d_ace_table_material_id );
-
   // Read the zaids and awrs
   std::array<int,16> raw_zaids;
   std::array<double,16> raw_atomic_weight_ratios;
@@ -137,14 +447,10 @@ void ACEFileHandler::readACETable( const std::string& table_name,
 			    raw_zaids.data(),
 			    raw_atomic_weight_ratios.data() );
 
-  for( size_t i = 0; i < 16; ++i )
-  {
-    if( raw_zaids[i] != 0 )
-    {
-      d_zaids.push_back( raw_zaids[i] );
-      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratios[i] );
-    }
-  }
+  this->setHeaderData( table_name,
+                       table_start_line,
+                       raw_zaids.data(),
+                       raw_atomic_weight_ratios.data() );
 
   // Read the nxs array
   readAceTableNXSArray( d_ace_file_id, d_nxs.data() );
@@ -162,6 +468,402 @@ void ACEFileHandler::readACETable( const std::string& table_name,
   closeFileUsingFortran( d_ace_file_id );
 }
 
+// Read the binary ACE table
+/*! \details Binary tables are stored in direct access records. The first
+ * record contains the header and each following record contains the
+ * next block of XSS entries.
+ */
+void ACEFileHandler::readBinaryACETable( const std::string& table_name,
+                                         const size_t table_start_record )
+{
+  // Make sure the start record is valid
+  testPrecondition( table_start_record > 0 );
+
+  std::ifstream ace_file( d_ace_library_name.string(),
+                          std::ios::in | std::ios::binary );
+
+  TEST_FOR_EXCEPTION( !ace_file.good(),
+                      std::runtime_error,
+                      "ACE file " << d_ace_library_name.string() <<
+                      " exists but is not readable." );
+
+  // Move to the start of the ACE table in the ACE file
+  ace_file.seekg( (table_start_record-1)*d_binary_record_length );
+
+  // Read the header
+  ace_file.read( &d_ace_table_name[0], 10 );
+  Details::readBinaryValue( ace_file, d_atomic_weight_ratio );
+  Details::readBinaryValue( ace_file,
+                            *Utility::reinterpretAsRaw(&d_temperature) );
+  ace_file.read( &d_ace_table_processing_date[0], 10 );
+  ace_file.read( &d_ace_table_comment[0], 70 );
+  ace_file.read( &d_ace_table_material_id[0], 10 );
+
+  int32_t raw_zaids[16];
+  double raw_atomic_weight_ratios[16];
+
+  for( size_t i = 0; i < 16; ++i )
+  {
+    Details::readBinaryValue( ace_file, raw_zaids[i] );
+    Details::readBinaryValue( ace_file, raw_atomic_weight_ratios[i] );
+  }
+
+  for( size_t i = 0; i < d_nxs.size(); ++i )
+  {
+    int32_t value;
+    Details::readBinaryValue( ace_file, value );
+
+    d_nxs[i] = value;
+  }
+
+  for( size_t i = 0; i < d_jxs.size(); ++i )
+  {
+    int32_t value;
+    Details::readBinaryValue( ace_file, value );
+
+    d_jxs[i] = value;
+  }
+
+  TEST_FOR_EXCEPTION( !ace_file.good(),
+                      std::runtime_error,
+                      "The header of binary ACE table " << table_name <<
+                      " could not be read from ACE library "
+                      << d_ace_library_name << "!" );
+
+  this->checkBinaryACETableHeader( table_name, table_start_record );
+
+  this->setHeaderData( table_name,
+                       table_start_record,
+                       raw_zaids,
+                       raw_atomic_weight_ratios );
+
+  // Read the xss array (it starts in the record after the header)
+  d_xss->resize( d_nxs[0] );
+
+  size_t record = table_start_record;
+  size_t entries_read = 0;
+
+  while( entries_read < d_xss->size() )
+  {
+    const size_t record_entries =
+      std::min( d_binary_entries_per_record, d_xss->size() - entries_read );
+
+    ace_file.seekg( record*d_binary_record_length );
+    ace_file.read( reinterpret_cast<char*>( d_xss->data() + entries_read ),
+                   record_entries*sizeof(double) );
+
+    entries_read += record_entries;
+    ++record;
+  }
+
+  TEST_FOR_EXCEPTION( !ace_file.good(),
+                      std::runtime_error,
+                      "The XSS array of binary ACE table " << table_name <<
+                      " could not be read from ACE library "
+                      << d_ace_library_name << "!" );
+}
+
+// Check that the binary ACE table header is valid
+/*! \details The XSS array size must fit in the records that follow the
+ * header and the atomic weight ratio must be positive. If the header is
+ * only valid after reversing the byte order, the table was written on a
+ * machine with a different byte order and an exception will be thrown.
+ */
+void ACEFileHandler::checkBinaryACETableHeader(
+                                      const std::string& table_name,
+                                      const size_t table_start_record ) const
+{
+  const uintmax_t library_size =
+    boost::filesystem::file_size( d_ace_library_name );
+
+  const size_t number_of_records = library_size/d_binary_record_length +
+    (library_size % d_binary_record_length == 0 ? 0 : 1);
+
+  const size_t max_xss_size = number_of_records > table_start_record ?
+    (number_of_records - table_start_record)*d_binary_entries_per_record : 0;
+
+  const bool header_valid = d_nxs[0] > 0 &&
+    (size_t)d_nxs[0] <= max_xss_size &&
+    std::isfinite( d_atomic_weight_ratio ) && d_atomic_weight_ratio > 0.0;
+
+  if( !header_valid )
+  {
+    const int32_t reversed_xss_size =
+      Details::reverseByteOrder<int32_t>( d_nxs[0] );
+
+    const double reversed_atomic_weight_ratio =
+      Details::reverseByteOrder( d_atomic_weight_ratio );
+
+    const bool reversed_header_valid = reversed_xss_size > 0 &&
+      (size_t)reversed_xss_size <= max_xss_size &&
+      std::isfinite( reversed_atomic_weight_ratio ) &&
+      reversed_atomic_weight_ratio > 0.0;
+
+    TEST_FOR_EXCEPTION( reversed_header_valid,
+                        std::runtime_error,
+                        "Binary ACE table " << table_name << " in ACE "
+                        "library " << d_ace_library_name.string() <<
+                        " was written with a different byte order than the "
+                        "byte order of this machine!" );
+
+    THROW_EXCEPTION( std::runtime_error,
+                     "Binary ACE table " << table_name << " in ACE library "
+                     << d_ace_library_name.string() << " has an invalid "
+                     "header (XSS array size = " << d_nxs[0] << ", atomic "
+                     "weight ratio = " << d_atomic_weight_ratio << ") - "
+                     "check the start record (" << table_start_record <<
+                     "), the record length (" << d_binary_record_length <<
+                     ") and the entries per record ("
+                     << d_binary_entries_per_record << ")!" );
+  }
+}
+
+// Set the header data that has been read
+void ACEFileHandler::setHeaderData( const std::string& table_name,
+                                    const size_t table_start,
+                                    const int* raw_zaids,
+                                    const double* raw_atomic_weight_ratios )
+{
+  // Clear white space from the ace table name and processing date
+  boost::algorithm::trim( d_ace_table_name );
+  boost::algorithm::trim( d_ace_table_processing_date );
+
+  // Test that the table name is the same as the desired table name
+  TEST_FOR_EXCEPTION( table_name != d_ace_table_name,
+                      std::runtime_error,
+                      "Expected table " << table_name << " at line "
+                      << table_start << " of ACE library "
+                      << d_ace_library_name << " but found table "
+                      << d_ace_table_name << "!" );
+
+  boost::algorithm::trim( d_ace_table_comment );
+  boost::algorithm::trim( d_ace_table_material_id );
+
+  for( size_t i = 0; i < 16; ++i )
+  {
+    if( raw_zaids[i] != 0 )
+    {
+      d_zaids.push_back( raw_zaids[i] );
+      d_atomic_weight_ratios.push_back( raw_atomic_weight_ratios[i] );
+    }
+  }
+}
+
+// Get the table cache file path
+/*! \details The cache file name contains a hash of the full path, the size
+ * and the last write time of the ACE library (and of the binary record
+ * layout). Libraries that share a file name will therefore never share a
+ * cache file and a modified library will always get a new cache file.
+ */
+boost::filesystem::path ACEFileHandler::getTableCachePath(
+                                           const std::string& table_name,
+                                           const size_t table_start ) const
+{
+  size_t library_key = std::hash<std::string>()(
+            boost::filesystem::absolute( d_ace_library_name ).string() );
+
+  boost::hash_combine( library_key,
+                       boost::filesystem::file_size( d_ace_library_name ) );
+  boost::hash_combine( library_key,
+                       boost::filesystem::last_write_time( d_ace_library_name ) );
+  boost::hash_combine( library_key, d_binary_record_length );
+  boost::hash_combine( library_key, d_binary_entries_per_record );
+
+  std::ostringstream oss;
+  oss << d_ace_library_name.filename().string() << "_"
+      << std::hex << library_key << std::dec << "_" << table_name << "_"
+      << table_start << ".acecache";
+
+  return s_table_cache_directory / oss.str();
+}
+
+// Map the table cache file (returns false if it is not valid)
+bool ACEFileHandler::mapTableCache( const boost::filesystem::path& cache_path,
+                                    const std::string& table_name,
+                                    const size_t table_start )
+{
+  if( !boost::filesystem::exists( cache_path ) )
+    return false;
+
+  std::shared_ptr<boost::interprocess::mapped_region> mapped_table;
+
+  try{
+    boost::interprocess::file_mapping
+      cache_file( cache_path.string().c_str(), boost::interprocess::read_only );
+
+    mapped_table.reset( new boost::interprocess::mapped_region(
+                                          cache_file,
+                                          boost::interprocess::read_only ) );
+  }
+  catch( const std::exception& exception )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "ACEFileHandler",
+                                "ACE table cache " << cache_path.string() <<
+                                " could not be mapped (" << exception.what()
+                                << ")!" );
+
+    return false;
+  }
+
+  if( mapped_table->get_size() < Details::ace_table_cache_xss_offset )
+    return false;
+
+  const Details::ACETableHeader& header =
+    *reinterpret_cast<const Details::ACETableHeader*>(
+                                              mapped_table->get_address() );
+
+  // Make sure the cache is still valid
+  if( std::strncmp( header.identifier,
+                    Details::ace_table_cache_identifier,
+                    sizeof(header.identifier) ) != 0 ||
+      header.version != Details::ace_table_cache_version ||
+      header.table_start != table_start ||
+      table_name != std::string( header.table_name ) ||
+      header.library_size !=
+      boost::filesystem::file_size( d_ace_library_name ) ||
+      header.library_write_time !=
+      boost::filesystem::last_write_time( d_ace_library_name ) ||
+      mapped_table->get_size() <
+      header.xss_offset + header.xss_size*sizeof(double) )
+    return false;
+
+  this->setTableHeaderData( header );
+
+  d_xss_view = Utility::ArrayView<const double>(
+       reinterpret_cast<const double*>(
+          static_cast<const char*>( mapped_table->get_address() ) +
+          header.xss_offset ),
+       header.xss_size );
+
+  d_mapped_table = mapped_table;
+
+  // The xss array will only be created if it is requested
+  d_xss.reset();
+
+  return true;
+}
+
+// Fill the table header
+void ACEFileHandler::fillTableHeader( Details::ACETableHeader& header,
+                                      const size_t table_start ) const
+{
+  std::memset( &header, 0, sizeof(header) );
+
+  std::memcpy( header.identifier,
+               Details::ace_table_cache_identifier,
+               sizeof(header.identifier) );
+  header.version = Details::ace_table_cache_version;
+  header.xss_offset = Details::ace_table_cache_xss_offset;
+  header.xss_size = d_xss_view.size();
+  header.library_size = boost::filesystem::file_size( d_ace_library_name );
+  header.library_write_time =
+    boost::filesystem::last_write_time( d_ace_library_name );
+  header.table_start = table_start;
+
+  Details::copyToCharArray( d_ace_table_name,
+                            header.table_name,
+                            sizeof(header.table_name) );
+  Details::copyToCharArray( d_ace_table_processing_date,
+                            header.processing_date,
+                            sizeof(header.processing_date) );
+  Details::copyToCharArray( d_ace_table_comment,
+                            header.comment,
+                            sizeof(header.comment) );
+  Details::copyToCharArray( d_ace_table_material_id,
+                            header.material_id,
+                            sizeof(header.material_id) );
+
+  header.atomic_weight_ratio = d_atomic_weight_ratio;
+  header.temperature = d_temperature.value();
+
+  for( size_t i = 0; i < d_zaids.size(); ++i )
+  {
+    header.zaids[i] = d_zaids[i].toRaw();
+    header.atomic_weight_ratios[i] = d_atomic_weight_ratios[i];
+  }
+
+  std::copy( d_nxs.begin(), d_nxs.end(), header.nxs );
+  std::copy( d_jxs.begin(), d_jxs.end(), header.jxs );
+}
+
+// Set the table header data
+void ACEFileHandler::setTableHeaderData(
+                               const Details::ACETableHeader& header )
+{
+  d_ace_table_name = header.table_name;
+  d_ace_table_processing_date = header.processing_date;
+  d_ace_table_comment = header.comment;
+  d_ace_table_material_id = header.material_id;
+  d_atomic_weight_ratio = header.atomic_weight_ratio;
+  d_temperature = header.temperature*Utility::Units::MeV;
+
+  d_zaids.clear();
+  d_atomic_weight_ratios.clear();
+
+  for( size_t i = 0; i < 16; ++i )
+  {
+    if( header.zaids[i] != 0 )
+    {
+      d_zaids.push_back( header.zaids[i] );
+      d_atomic_weight_ratios.push_back( header.atomic_weight_ratios[i] );
+    }
+  }
+
+  std::copy( header.nxs, header.nxs+16, d_nxs.begin() );
+  std::copy( header.jxs, header.jxs+32, d_jxs.begin() );
+}
+
+// Write the table cache file
+/*! \details The cache file is written to a temporary file first, which is
+ * then renamed. This prevents other processes from mapping a partially
+ * written cache file. Failing to write the cache file is not an error.
+ */
+void ACEFileHandler::writeTableCache(
+                                  const boost::filesystem::path& cache_path,
+                                  const size_t table_start ) const
+{
+  Details::ACETableHeader header;
+
+  this->fillTableHeader( header, table_start );
+
+  boost::filesystem::path tmp_cache_path = cache_path.parent_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-%%%%-%%%%.acecache.tmp" );
+
+  {
+    std::ofstream cache_file( tmp_cache_path.string(),
+                              std::ios::out | std::ios::binary );
+
+    const std::vector<char> padding(
+                     Details::ace_table_cache_xss_offset - sizeof(header), 0 );
+
+    cache_file.write( reinterpret_cast<const char*>( &header ),
+                      sizeof(header) );
+    cache_file.write( padding.data(), padding.size() );
+    cache_file.write( reinterpret_cast<const char*>( d_xss_view.data() ),
+                      d_xss_view.size()*sizeof(double) );
+
+    if( !cache_file.good() )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "ACEFileHandler",
+                                  "ACE table cache " << cache_path.string() <<
+                                  " could not be written!" );
+
+      cache_file.close();
+
+      boost::system::error_code error;
+      boost::filesystem::remove( tmp_cache_path, error );
+
+      return;
+    }
+  }
+
+  boost::system::error_code error;
+  boost::filesystem::rename( tmp_cache_path, cache_path, error );
+
+  if( error )
+    boost::filesystem::remove( tmp_cache_path, error );
+}
+
 // Get the library name
 const boost::filesystem::path& ACEFileHandler::getLibraryName() const
 {
@@ -230,11 +932,44 @@ Utility::ArrayView<const int> ACEFileHandler::getTableJXSArray() const
 }
 
 // Get the table XSS array
+/*! \details If the table is memory mapped a copy of the XSS array will be
+ * created. Use the XSS array view to avoid the copy.
+ */
 std::shared_ptr<const std::vector<double> > ACEFileHandler::getTableXSSArray() const
 {
+  if( !d_xss )
+  {
+    d_xss.reset( new std::vector<double>( d_xss_view.begin(),
+                                          d_xss_view.end() ) );
+  }
+  
   return d_xss;
 }
 
+// Get a view of the table XSS array
+/*! \details The view will only remain valid while the handler or the
+ * XSS array owner exists.
+ */
+Utility::ArrayView<const double> ACEFileHandler::getTableXSSArrayView() const
+{
+  return d_xss_view;
+}
+
+// Get the object that owns the memory of the table XSS array view
+std::shared_ptr<const void> ACEFileHandler::getTableXSSArrayOwner() const
+{
+  if( d_mapped_table )
+    return d_mapped_table;
+  else
+    return d_xss;
+}
+
+// Check if the table is memory mapped
+bool ACEFileHandler::isTableMemoryMapped() const
+{
+  return d_mapped_table.get() != NULL;
+}
+
 } // end Data namespace
 
 //---------------------------------------------------------------------------//
@@ -22,9 +22,17 @@
 #include "Utility_Vector.hpp"
 #include "Utility_Array.hpp"
 #include "Utility_ArrayView.hpp"
+#include "Utility_Communicator.hpp"
 
 namespace Data{
 
+namespace Details{
+
+// The ACE table header
+struct ACETableHeader;
+  
+} // end Details namespace
+
 /*! \defgroup ace_table A Compact ENDF (ACE) Table
  *
  * The first line of every ACE table contains the table name, the atomic
@@ -40,9 +48,38 @@ namespace Data{
  * on the type of table (i.e. continuous energy neutron, continuous energy
  * photon, etc.). The task of reading in this data is handled by the
  * Data::ACEFileHandler.
+ *
+ * Binary (type 2) ACE tables store the same data in direct access records.
+ * The first record contains the header and the NXS and JXS arrays. The XSS
+ * array is stored in the following records.
  */
 
-//! The ACE (A Compact ENDF) file handler class
+/*! The ACE (A Compact ENDF) file handler class
+ * \details Both text (type 1) and binary (type 2) tables can be read. For
+ * binary tables the table start line is the record number of the first
+ * record of the table and the record length and number of entries per
+ * record should be taken from the xsdir entry of the table (see
+ * Data::Xsdir::extractRecordLengthFromEntryTokens and
+ * Data::Xsdir::extractEntriesPerRecordFromEntryTokens). Binary tables must
+ * have been written with the byte order of the machine that reads them.
+ * When a table cache directory has been set, each
+ * table that is read will also be stored in a page-aligned binary cache
+ * file in that directory. The next time the table is requested the cache
+ * file will be memory mapped instead of parsing the table. The cache file
+ * name is derived from the full path, size and last write time of the ACE
+ * library, so a modified library (or a different library with the same file
+ * name) will never use a stale cache file. When a node communicator has
+ * been set, each table will only be loaded once per node and the processes
+ * of the node will share the XSS array.
+ *
+ * Note that the mapped (or node shared) XSS array is only referenced while
+ * the handler, a data extractor or the XSS array owner is alive. The
+ * collision handler factories copy the data that they extract into the
+ * arrays of the objects that they construct, so the table cache and the node
+ * communicator only remove the cost of parsing the table (and of holding a
+ * private copy of the XSS array while it is being processed) - the memory
+ * used by the constructed objects is not shared.
+ */
 class ACEFileHandler
 {
 
@@ -54,12 +91,36 @@ public:
   //! The energy quantity
   typedef boost::units::quantity<EnergyUnit> Energy;
 
+  //! Set the table cache directory
+  static void setTableCacheDirectory(
+                           const boost::filesystem::path& cache_directory );
+
+  //! Unset the table cache directory
+  static void unsetTableCacheDirectory();
+
+  //! Get the table cache directory (empty if not set)
+  static const boost::filesystem::path& getTableCacheDirectory();
+
+  //! Set the node communicator used to share tables
+  static void setNodeCommunicator(
+                const std::shared_ptr<const Utility::Communicator>& node_comm );
+
+  //! Unset the node communicator used to share tables
+  static void unsetNodeCommunicator();
+
   //! Constructor
   ACEFileHandler( const boost::filesystem::path& file_name_with_path,
 		  const std::string& table_name,
 		  const size_t table_start_line,
 		  const bool is_ascii = true );
 
+  //! Constructor (binary table with the record layout from the xsdir)
+  ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+                  const std::string& table_name,
+                  const size_t table_start_record,
+                  const size_t record_length,
+                  const size_t entries_per_record );
+
   //! Destructor
   ~ACEFileHandler();
 
@@ -99,8 +160,35 @@ public:
   //! Get the table XSS array
   std::shared_ptr<const std::vector<double> > getTableXSSArray() const;
 
+  //! Get a view of the table XSS array
+  Utility::ArrayView<const double> getTableXSSArrayView() const;
+
+  //! Get the object that owns the memory of the table XSS array view
+  std::shared_ptr<const void> getTableXSSArrayOwner() const;
+
+  //! Check if the table is memory mapped
+  bool isTableMemoryMapped() const;
+
 private:
 
+  // Constructor
+  ACEFileHandler( const boost::filesystem::path& file_name_with_path,
+                  const std::string& table_name,
+                  const size_t table_start_line,
+                  const bool is_ascii,
+                  const size_t record_length,
+                  const size_t entries_per_record );
+
+  // Load the table
+  void loadTable( const std::string& table_name,
+                  const size_t table_start_line,
+                  const bool is_ascii );
+
+  // Load the table once per node and share it with the other node processes
+  void loadNodeSharedTable( const std::string& table_name,
+                            const size_t table_start_line,
+                            const bool is_ascii );
+
   // Open the ACE file
   void openACEFile( const std::string& file_name,
 		    const bool is_ascii );
@@ -109,12 +197,68 @@ private:
   void readACETable( const std::string& table_name,
 		     const size_t table_start_line );
 
+  // Read the binary ACE table
+  void readBinaryACETable( const std::string& table_name,
+                           const size_t table_start_record );
+
+  // Check that the binary ACE table header is valid
+  void checkBinaryACETableHeader( const std::string& table_name,
+                                  const size_t table_start_record ) const;
+
+  // Set the header data that has been read
+  void setHeaderData( const std::string& table_name,
+                      const size_t table_start,
+                      const int* raw_zaids,
+                      const double* raw_atomic_weight_ratios );
+
+  // Get the table cache file path
+  boost::filesystem::path getTableCachePath(
+                                          const std::string& table_name,
+                                          const size_t table_start ) const;
+
+  // Map the table cache file (returns false if it is not valid)
+  bool mapTableCache( const boost::filesystem::path& cache_path,
+                      const std::string& table_name,
+                      const size_t table_start );
+
+  // Fill the table header
+  void fillTableHeader( Details::ACETableHeader& header,
+                        const size_t table_start ) const;
+
+  // Set the table header data
+  void setTableHeaderData( const Details::ACETableHeader& header );
+
+  // Write the table cache file
+  void writeTableCache( const boost::filesystem::path& cache_path,
+                        const size_t table_start ) const;
+
+  // The default record length of binary ACE files (bytes)
+  static const size_t s_default_binary_record_length;
+
+  // The default number of XSS entries per record of binary ACE files
+  static const size_t s_default_binary_entries_per_record;
+
+  // The size of the header of a binary ACE table (bytes)
+  static const size_t s_binary_header_size;
+
+  // The table cache directory
+  static boost::filesystem::path s_table_cache_directory;
+
+  // The node communicator used to share tables
+  static std::shared_ptr<const Utility::Communicator> s_node_comm;
+
   // The ace file id used by the ace_helpers fortran module (always set to 1)
   int d_ace_file_id;
 
   // The name of the ace library that is currently open
   boost::filesystem::path d_ace_library_name;
 
+  // The record length of the binary ace library (bytes)
+  size_t d_binary_record_length;
+
+  // The number of XSS entries per record of the binary ace library
+  size_t d_binary_entries_per_record;
+
   // The name of the ace table read from the ace library
   std::string d_ace_table_name;
 
@@ -145,8 +289,14 @@ private:
   // The ace table JXS array
   std::array<int,32> d_jxs;
 
-  // The ace table XSS array
-  std::shared_ptr<std::vector<double> > d_xss;
+  // The ace table XSS array (created on request if the table is mapped)
+  mutable std::shared_ptr<std::vector<double> > d_xss;
+
+  // The memory mapped table (table cache or node shared memory)
+  std::shared_ptr<const void> d_mapped_table;
+
+  // The ace table XSS array view
+  Utility::ArrayView<const double> d_xss_view;
 };
 
 } // end Data namespace
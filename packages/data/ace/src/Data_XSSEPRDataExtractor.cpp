@@ -14,6 +14,14 @@
 namespace Data{
 
 // Constructor
+XSSEPRDataExtractor::XSSEPRDataExtractor(
+                       const Utility::ArrayView<const int>& nxs,
+                       const Utility::ArrayView<const int>& jxs,
+		       const std::shared_ptr<const std::vector<double> >& xss )
+  : XSSEPRDataExtractor( nxs, jxs, Utility::arrayViewOfConst( *xss ), xss )
+{ /* ... */ }
+
+// Constructor (the xss array may be memory mapped)
 /*! \details A copy of the jxs array will be made so that it can be modified.
  * All indices in the jxs array correspond to a starting index of 1 (1 is
  * subtracted from all indices so that the correct array location is accessed).
@@ -21,17 +29,18 @@ namespace Data{
 XSSEPRDataExtractor::XSSEPRDataExtractor(
                        const Utility::ArrayView<const int>& nxs,
                        const Utility::ArrayView<const int>& jxs,
-		       const std::shared_ptr<const std::vector<double> >& xss )
+		       const Utility::ArrayView<const double>& xss,
+                       const std::shared_ptr<const void>& xss_owner )
   : d_nxs( nxs.begin(), nxs.end() ),
     d_jxs( jxs.begin(), jxs.end() ),
-    d_xss( xss ),
-    d_xss_view(),
+    d_xss( xss_owner ),
+    d_xss_view( xss ),
     d_eszg_block(),
     d_subsh_block(),
     d_esze_block()
 {
   // Make sure that the xss array exists
-  testPrecondition( xss.get() );
+  testPrecondition( xss.size() > 0 );
 
   // Make sure the arrays have the correct size
   TEST_FOR_EXCEPTION( nxs.size() != 16,
@@ -46,19 +55,16 @@ XSSEPRDataExtractor::XSSEPRDataExtractor(
                       std::runtime_error,
                       "The data table format is not supported!" );
 
-  TEST_FOR_EXCEPTION( xss->size() != nxs[0],
+  TEST_FOR_EXCEPTION( xss.size() != nxs[0],
                       std::runtime_error,
                       "The nxs array expected the xss array to have size "
                       << nxs[0] << " but it was found to have size "
-                      << xss->size() << "!" );
+                      << xss.size() << "!" );
 
   // Adjust the indices in the JXS array so that they correspond to a C-array
   for( size_t i = 0; i < d_jxs.size(); ++i )
     d_jxs[i] -= 1;
 
-  // Create the XSS view
-  d_xss_view = Utility::arrayViewOfConst( *d_xss );
-
   // Extract and cache the ESZG block
   d_eszg_block = d_xss_view( d_jxs[0], d_nxs[2]*5 );
 
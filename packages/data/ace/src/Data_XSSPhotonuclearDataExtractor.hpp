@@ -60,6 +60,12 @@ public:
                                 const Utility::ArrayView<const int>& jxs,
                                 const std::shared_ptr<const std::vector<double> >& xss );
 
+  //! Constructor (the xss array may be memory mapped)
+  XSSPhotonuclearDataExtractor( const Utility::ArrayView<const int>& nxs,
+                                const Utility::ArrayView<const int>& jxs,
+                                const Utility::ArrayView<const double>& xss,
+                                const std::shared_ptr<const void>& xss_owner );
+
   //! Destructor
   ~XSSPhotonuclearDataExtractor()
   { /* ... */ }
@@ -144,8 +150,8 @@ private:
   // The jxs array (a copy will be stored so that modifications can be made)
   std::vector<int> d_jxs;
 
-  // The xss array (data in this array should never be directly modified)
-  std::shared_ptr<const std::vector<double> > d_xss;
+  // The owner of the xss array memory
+  std::shared_ptr<const void> d_xss;
 
   // The xss array view (stored for quicker slicing)
   Utility::ArrayView<const double> d_xss_view;
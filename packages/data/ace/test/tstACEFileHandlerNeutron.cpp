@@ -10,6 +10,12 @@
 #include <string>
 #include <memory>
 #include <iostream>
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
 
 // FRENSIE Includes
 #include "Data_ACEFileHandler.hpp"
@@ -22,6 +28,102 @@
 std::string test_neutron_ace_file_name;
 unsigned test_neutron_ace_file_start_line;
 
+//---------------------------------------------------------------------------//
+// Testing Functions.
+//---------------------------------------------------------------------------//
+// Write a value to a binary buffer (optionally reversing the byte order)
+template<typename T>
+char* writeBinaryValue( char* buffer_pos,
+                        const T value,
+                        const bool reverse_byte_order )
+{
+  const char* bytes = reinterpret_cast<const char*>( &value );
+
+  for( size_t i = 0; i < sizeof(T); ++i )
+    buffer_pos[i] = bytes[reverse_byte_order ? sizeof(T)-1-i : i];
+
+  return buffer_pos + sizeof(T);
+}
+
+// Write a string to a binary buffer (padded with spaces)
+char* writeBinaryString( char* buffer_pos,
+                         std::string string,
+                         const size_t size )
+{
+  string.resize( size, ' ' );
+
+  return std::copy( string.begin(), string.end(), buffer_pos );
+}
+
+// Write a binary (type 2) version of a table
+void writeBinaryTable( const boost::filesystem::path& binary_ace_file_name,
+                       const Data::ACEFileHandler& ace_file_handler,
+                       const size_t record_length,
+                       const size_t entries_per_record,
+                       const bool reverse_byte_order = false )
+{
+  std::ofstream binary_ace_file( binary_ace_file_name.string(),
+                                 std::ios::out | std::ios::binary );
+
+  std::vector<char> record( record_length, 0 );
+  char* record_pos = record.data();
+
+  record_pos = writeBinaryString( record_pos,
+                                  ace_file_handler.getTableName(),
+                                  10 );
+  record_pos = writeBinaryValue( record_pos,
+                                 ace_file_handler.getTableAtomicWeightRatio(),
+                                 reverse_byte_order );
+  record_pos = writeBinaryValue( record_pos,
+                                 ace_file_handler.getTableTemperature().value(),
+                                 reverse_byte_order );
+  record_pos = writeBinaryString( record_pos,
+                                  ace_file_handler.getTableProcessingDate(),
+                                  10 );
+  record_pos = writeBinaryString( record_pos,
+                                  ace_file_handler.getTableComment(),
+                                  70 );
+  record_pos = writeBinaryString( record_pos,
+                                  ace_file_handler.getTableMatId(),
+                                  10 );
+  record_pos += 16*(sizeof(int32_t)+sizeof(double));
+
+  Utility::ArrayView<const int> nxs = ace_file_handler.getTableNXSArray();
+
+  for( size_t i = 0; i < nxs.size(); ++i )
+  {
+    record_pos = writeBinaryValue( record_pos,
+                                   (int32_t)nxs[i],
+                                   reverse_byte_order );
+  }
+
+  Utility::ArrayView<const int> jxs = ace_file_handler.getTableJXSArray();
+
+  for( size_t i = 0; i < jxs.size(); ++i )
+  {
+    record_pos = writeBinaryValue( record_pos,
+                                   (int32_t)jxs[i],
+                                   reverse_byte_order );
+  }
+
+  binary_ace_file.write( record.data(), record.size() );
+
+  // Write the xss array records
+  Utility::ArrayView<const double> xss =
+    ace_file_handler.getTableXSSArrayView();
+
+  for( size_t i = 0; i < xss.size(); i += entries_per_record )
+  {
+    std::fill( record.begin(), record.end(), 0 );
+    record_pos = record.data();
+
+    for( size_t j = i; j < std::min( i+entries_per_record, xss.size() ); ++j )
+      record_pos = writeBinaryValue( record_pos, xss[j], reverse_byte_order );
+
+    binary_ace_file.write( record.data(), record.size() );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -91,6 +193,215 @@ FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron )
   FRENSIE_CHECK_EQUAL( xss->back(), 102 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can read a binary ace file
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron_binary )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ascii_ace_file_handler( test_neutron_ace_file_name,
+                                               table_name,
+                                               1u );
+
+  Utility::ArrayView<const int> nxs = ascii_ace_file_handler.getTableNXSArray();
+  Utility::ArrayView<const int> jxs = ascii_ace_file_handler.getTableJXSArray();
+  Utility::ArrayView<const double> xss =
+    ascii_ace_file_handler.getTableXSSArrayView();
+
+  // Create a binary (type 2) version of the table
+  boost::filesystem::path binary_ace_file_name =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-binary.ace" );
+
+  writeBinaryTable( binary_ace_file_name, ascii_ace_file_handler, 4096, 512 );
+
+  Data::ACEFileHandler binary_ace_file_handler( binary_ace_file_name,
+                                                table_name,
+                                                1u,
+                                                false );
+
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableName(), table_name );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableAtomicWeightRatio(),
+                       0.999167 );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableTemperature(),
+                       2.53010e-08*Utility::Units::MeV );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableProcessingDate(),
+                       "03/27/08" );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableMatId(), "mat 125" );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableNXSArray(), nxs );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableJXSArray(), jxs );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableXSSArrayView(), xss );
+  FRENSIE_CHECK( !binary_ace_file_handler.isTableMemoryMapped() );
+
+  boost::filesystem::remove( binary_ace_file_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can read a binary ace file with the record
+// layout from the xsdir
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron_binary_layout )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ascii_ace_file_handler( test_neutron_ace_file_name,
+                                               table_name,
+                                               1u );
+
+  boost::filesystem::path binary_ace_file_name =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-binary.ace" );
+
+  writeBinaryTable( binary_ace_file_name, ascii_ace_file_handler, 8192, 1000 );
+
+  Data::ACEFileHandler binary_ace_file_handler( binary_ace_file_name,
+                                                table_name,
+                                                1u,
+                                                8192u,
+                                                1000u );
+
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableNXSArray(),
+                       ascii_ace_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableJXSArray(),
+                       ascii_ace_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( binary_ace_file_handler.getTableXSSArrayView(),
+                       ascii_ace_file_handler.getTableXSSArrayView() );
+
+  // The record layout is not valid
+  FRENSIE_CHECK_THROW( Data::ACEFileHandler( binary_ace_file_name,
+                                             table_name,
+                                             1u,
+                                             4096u,
+                                             1024u ),
+                       std::runtime_error );
+
+  boost::filesystem::remove( binary_ace_file_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler rejects a binary ace file with a different
+// byte order
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron_binary_byte_order )
+{
+  std::string table_name( "1001.70c" );
+
+  Data::ACEFileHandler ascii_ace_file_handler( test_neutron_ace_file_name,
+                                               table_name,
+                                               1u );
+
+  boost::filesystem::path binary_ace_file_name =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-binary.ace" );
+
+  writeBinaryTable( binary_ace_file_name,
+                    ascii_ace_file_handler,
+                    4096,
+                    512,
+                    true );
+
+  FRENSIE_CHECK_THROW( Data::ACEFileHandler( binary_ace_file_name,
+                                             table_name,
+                                             1u,
+                                             4096u,
+                                             512u ),
+                       std::runtime_error );
+
+  boost::filesystem::remove( binary_ace_file_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the ACEFileHandler can cache and map a table
+FRENSIE_UNIT_TEST( ACEFileHandler, constructor_get_neutron_cached )
+{
+  std::string table_name( "1001.70c" );
+
+  boost::filesystem::path cache_directory =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-ace-cache" );
+
+  Data::ACEFileHandler::setTableCacheDirectory( cache_directory );
+
+  FRENSIE_CHECK_EQUAL( Data::ACEFileHandler::getTableCacheDirectory().string(),
+                       cache_directory.string() );
+
+  // The first handler will create the cache
+  Data::ACEFileHandler first_ace_file_handler( test_neutron_ace_file_name,
+                                               table_name,
+                                               1u );
+
+  FRENSIE_CHECK( first_ace_file_handler.isTableMemoryMapped() );
+
+  // The second handler will only map the cache
+  Data::ACEFileHandler second_ace_file_handler( test_neutron_ace_file_name,
+                                                table_name,
+                                                1u );
+
+  FRENSIE_CHECK( second_ace_file_handler.isTableMemoryMapped() );
+
+  Data::ACEFileHandler::unsetTableCacheDirectory();
+
+  Data::ACEFileHandler ace_file_handler( test_neutron_ace_file_name,
+                                         table_name,
+                                         1u );
+
+  FRENSIE_CHECK( !ace_file_handler.isTableMemoryMapped() );
+
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableName(), table_name );
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableTemperature(),
+                       ace_file_handler.getTableTemperature() );
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableComment(),
+                       ace_file_handler.getTableComment() );
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableNXSArray(),
+                       ace_file_handler.getTableNXSArray() );
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableJXSArray(),
+                       ace_file_handler.getTableJXSArray() );
+  FRENSIE_CHECK_EQUAL( second_ace_file_handler.getTableXSSArrayView(),
+                       ace_file_handler.getTableXSSArrayView() );
+  FRENSIE_CHECK_EQUAL( *second_ace_file_handler.getTableXSSArray(),
+                       *ace_file_handler.getTableXSSArray() );
+
+  // The mapped memory must outlive the handler when the owner is kept
+  std::shared_ptr<const void> xss_owner =
+    second_ace_file_handler.getTableXSSArrayOwner();
+
+  FRENSIE_CHECK( xss_owner.get() != NULL );
+
+  // A library with the same file name in a different directory must not
+  // share the cache file
+  boost::filesystem::path library_copy_directory =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path( "%%%%-%%%%-ace-copy" );
+
+  boost::filesystem::create_directories( library_copy_directory );
+
+  boost::filesystem::path library_copy = library_copy_directory /
+    boost::filesystem::path( test_neutron_ace_file_name ).filename();
+
+  boost::filesystem::copy_file( test_neutron_ace_file_name, library_copy );
+
+  Data::ACEFileHandler::setTableCacheDirectory( cache_directory );
+
+  Data::ACEFileHandler copy_ace_file_handler( library_copy, table_name, 1u );
+
+  Data::ACEFileHandler::unsetTableCacheDirectory();
+
+  FRENSIE_CHECK( copy_ace_file_handler.isTableMemoryMapped() );
+  FRENSIE_CHECK_EQUAL( copy_ace_file_handler.getTableXSSArrayView(),
+                       ace_file_handler.getTableXSSArrayView() );
+
+  size_t number_of_cache_files = 0;
+
+  for( boost::filesystem::directory_iterator
+         cache_file_it( cache_directory );
+       cache_file_it != boost::filesystem::directory_iterator();
+       ++cache_file_it )
+    ++number_of_cache_files;
+
+  FRENSIE_CHECK_EQUAL( number_of_cache_files, 2 );
+
+  boost::filesystem::remove_all( library_copy_directory );
+  boost::filesystem::remove_all( cache_directory );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
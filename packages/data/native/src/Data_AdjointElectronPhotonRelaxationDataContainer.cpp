@@ -430,52 +430,52 @@ AdjointElectronPhotonRelaxationDataContainer::getOccupationNumber(
 }
 
 // Return the Waller-Hartree scattering function momentum grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const
 {
-  return d_waller_hartree_scattering_function_momentum_grid;
+  return d_waller_hartree_scattering_function_momentum_grid.view();
 }
 
 // Return the Waller-Hartree scattering function
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const
 {
-  return d_waller_hartree_scattering_function;
+  return d_waller_hartree_scattering_function.view();
 }
 
 // Return the Waller-Hartree atomic form factor momentum grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const
 {
-  return d_waller_hartree_atomic_form_factor_momentum_grid;
+  return d_waller_hartree_atomic_form_factor_momentum_grid.view();
 }
 
 // Return the Waller-Hartree atomic form factor
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
 {
-  return d_waller_hartree_atomic_form_factor;
+  return d_waller_hartree_atomic_form_factor.view();
 }
 
 // Return the Waller-Hartree squared atomic form factor squared mom. grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const
 {
-  return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
+  return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid.view();
 }
 
 // Return the Waller-Hartree squared atomic form factor
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const
 {
-  return d_waller_hartree_squared_atomic_form_factor;
+  return d_waller_hartree_squared_atomic_form_factor.view();
 }
 
 // Return the adjoint photon energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonEnergyGrid() const
 {
-  return d_adjoint_photon_energy_grid;
+  return d_adjoint_photon_energy_grid.view();
 }
 
 // Return the adjoint Waller-Hartree (WH) incoherent photon max energy grid
@@ -603,10 +603,10 @@ unsigned AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadene
 }
 
 // Return the adjoint Waller-Hartree coherent cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointWallerHartreeCoherentCrossSection() const
 {
-  return d_waller_hartree_coherent_cross_section;
+  return d_waller_hartree_coherent_cross_section.view();
 }
 
 // Return the adjoint Waller-Hartree total max energy grid
@@ -652,80 +652,80 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointDopplerBroadenedImpulseA
 }
 
 // Return the (forward) Waller-Hartree total cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
 {
-  return d_waller_hartree_total_cross_section;
+  return d_waller_hartree_total_cross_section.view();
 }
 
 // Return the (forward) impulse approx. total cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
 {
-  return d_impulse_approx_total_cross_section;
+  return d_impulse_approx_total_cross_section.view();
 }
 
 // Return the adjoint pair production energy distribution grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionGrid() const
 {
-  return d_adjoint_pair_production_energy_distribution_grid;
+  return d_adjoint_pair_production_energy_distribution_grid.view();
 }
 
 // Return the adjoint pair production energy distribution
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistribution() const
 {
-  return d_adjoint_pair_production_energy_distribution;
+  return d_adjoint_pair_production_energy_distribution.view();
 }
 
 // Return the adjoint pair production energy dist. norm grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionNormConstantGrid() const
 {
-  return d_adjoint_pair_production_norm_constant_grid;
+  return d_adjoint_pair_production_norm_constant_grid.view();
 }
 
 // Return the adjoint pair production energy dist. normalization constant
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPairProductionEnergyDistributionNormConstant() const
 {
-  return d_adjoint_pair_production_norm_constant;
+  return d_adjoint_pair_production_norm_constant.view();
 }
 
 // Return the adjoint triplet production energy distribution grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionGrid() const
 {
-  return d_adjoint_triplet_production_energy_distribution_grid;
+  return d_adjoint_triplet_production_energy_distribution_grid.view();
 }
 
 // Return the adjoint triplet production energy distribution
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistribution() const
 {
-  return d_adjoint_triplet_production_energy_distribution;
+  return d_adjoint_triplet_production_energy_distribution.view();
 }
 
 // Return the adjoint triplet production energy dist. norm grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionNormConstantGrid() const
 {
-  return d_adjoint_triplet_production_norm_constant_grid;
+  return d_adjoint_triplet_production_norm_constant_grid.view();
 }
 
 // Return the adjoint triplet production energy dist. normalization constant
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTripletProductionEnergyDistributionNormConstant() const
 {
-  return d_adjoint_triplet_production_norm_constant;
+  return d_adjoint_triplet_production_norm_constant.view();
 }
 
 // Return the bremsstrahlung incoming photon energy grid for the scattering spectrum
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungEnergyGrid() const
 {
-  return d_adjoint_photon_bremsstrahlung_energy_grid;
+  return d_adjoint_photon_bremsstrahlung_energy_grid.view();
 }
 
 // Return the bremsstrahlung electron energy for an incoming photon energy
@@ -753,10 +753,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointPhotonBremsstrahlungPDF(
 }
 
 // Return the bremsstrahlung photon cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungPhotonCrossSection() const
 {
-  return d_adjoint_bremsstrahlung_photon_cross_section;
+  return d_adjoint_bremsstrahlung_photon_cross_section.view();
 }
 
 // Return the bremsstrahlung photon cross section threshold energy bin index
@@ -791,10 +791,10 @@ AdjointElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
 }
 
 // Return the elastic angular energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElasticAngularEnergyGrid() const
 {
-  return d_adjoint_angular_energy_grid;
+  return d_adjoint_angular_energy_grid.view();
 }
 
 // Return the elastic angles map
@@ -844,10 +844,10 @@ bool AdjointElectronPhotonRelaxationDataContainer::hasAdjointMomentPreservingDat
 // Return the moment preserving cross section reductions
 /*! \details The cross sections reductions are on the elastic angular energy grid.
  */
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointMomentPreservingCrossSectionReduction() const
 {
-  return d_adjoint_moment_preserving_cross_section_reductions;
+  return d_adjoint_moment_preserving_cross_section_reductions.view();
 }
 
 // Return the moment preserving elastic discrete angles
@@ -896,7 +896,7 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationSamplin
 }
 
 // Return the electroionization energy grid for a subshell
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationEnergyGrid(
                             const unsigned subshell ) const
 {
@@ -904,7 +904,7 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationEnergyG
   testPrecondition( d_subshells.find( subshell ) != d_subshells.end() );
 
   if ( this->separateAdjointElectroionizationEnergyGrid() )
-    return d_adjoint_electroionization_energy_grid.find( subshell )->second;
+    return Utility::arrayViewOfConst( d_adjoint_electroionization_energy_grid.find( subshell )->second );
   else
     return this->getAdjointElectronEnergyGrid();
 }
@@ -965,11 +965,11 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationRecoilP
 }
 
 // Return the bremsstrahlung incoming electron energy grid for the scattering spectrum
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungEnergyGrid() const
 {
     if ( this->separateAdjointBremsstrahlungEnergyGrid() )
-      return d_adjoint_electron_bremsstrahlung_energy_grid;
+      return Utility::arrayViewOfConst( d_adjoint_electron_bremsstrahlung_energy_grid );
     else
       return this->getAdjointElectronEnergyGrid();
 }
@@ -1024,30 +1024,30 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronBremsstrahlungPD
 }
 
 // Return the atomic excitation energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGrid() const
 {
-  return d_adjoint_atomic_excitation_energy_grid;
+  return d_adjoint_atomic_excitation_energy_grid.view();
 }
 
 // Return the atomic excitation energy gain
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationEnergyGain() const
 {
-  return d_adjoint_atomic_excitation_energy_gain;
+  return d_adjoint_atomic_excitation_energy_gain.view();
 }
 
 // Return the electron energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointElectronEnergyGrid() const
 {
-  return d_adjoint_electron_energy_grid;
+  return d_adjoint_electron_energy_grid.view();
 }
 // Return the cutoff elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticCrossSection() const
 {
-  return d_adjoint_cutoff_elastic_cross_section;
+  return d_adjoint_cutoff_elastic_cross_section.view();
 }
 
 // Return the cutoff elastic cross section threshold energy bin index
@@ -1057,10 +1057,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointCutoffElasticCrossSectio
   return d_adjoint_cutoff_elastic_cross_section_threshold_index;
 }
 // Return the screened Rutherford elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointScreenedRutherfordElasticCrossSection() const
 {
-  return d_adjoint_screened_rutherford_elastic_cross_section;
+  return d_adjoint_screened_rutherford_elastic_cross_section.view();
 }
 
 // Return the screened Rutherford elastic cross section threshold energy bin index
@@ -1070,10 +1070,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointScreenedRutherfordElasti
   return d_adjoint_screened_rutherford_elastic_cross_section_threshold_index;
 }
 // Return the total elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointTotalElasticCrossSection() const
 {
-  return d_adjoint_total_elastic_cross_section;
+  return d_adjoint_total_elastic_cross_section.view();
 }
 
 // Return the total elastic cross section threshold energy bin index
@@ -1100,10 +1100,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointElectroionizationCrossSe
 }
 
 // Return the bremsstrahlung electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCrossSection() const
 {
-  return d_adjoint_bremsstrahlung_electron_cross_section;
+  return d_adjoint_bremsstrahlung_electron_cross_section.view();
 }
 
 // Return the bremsstrahlung electron cross section threshold energy bin index
@@ -1114,10 +1114,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointBremsstrahlungElectronCr
 }
 
 // Return the atomic excitation electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSection() const
 {
-  return d_adjoint_atomic_excitation_cross_section;
+  return d_adjoint_atomic_excitation_cross_section.view();
 }
 
 // Return the atomic excitation cross section threshold energy bin index
@@ -1128,10 +1128,10 @@ AdjointElectronPhotonRelaxationDataContainer::getAdjointAtomicExcitationCrossSec
 }
 
 // Return the forward bremsstrahlung electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getForwardBremsstrahlungElectronCrossSection() const
 {
-  return d_forward_bremsstrahlung_electron_cross_section;
+  return d_forward_bremsstrahlung_electron_cross_section.view();
 }
 // Return the forward bremsstrahlung electron cross section threshold energy bin index
 unsigned
@@ -1141,10 +1141,10 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardBremsstrahlungElectronCr
 }
 
 // Return the forward electroionization electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectronCrossSection() const
 {
-  return d_forward_electroionization_electron_cross_section;
+  return d_forward_electroionization_electron_cross_section.view();
 }
 
 // Return the forward electroionization electron cross section threshold energy bin index
@@ -1155,10 +1155,10 @@ AdjointElectronPhotonRelaxationDataContainer::getForwardElectroionizationElectro
 }
 
 // Return the forward atomic excitation electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 AdjointElectronPhotonRelaxationDataContainer::getForwardAtomicExcitationElectronCrossSection() const
 {
-  return d_forward_atomic_excitation_electron_cross_section;
+  return d_forward_atomic_excitation_electron_cross_section.view();
 }
 
 // Return the forward atomic excitation electron cross section threshold energy bin index
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_ArchivableObject.hpp"
+#include "Utility_MappableArray.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
@@ -28,7 +29,10 @@
 namespace Data{
 
 /*! The electron-photon-relaxation data container
- * \details Linear-linear interpolation should be used for all data.
+ * \details Linear-linear interpolation should be used for all data. The
+ * energy grids and cross sections are returned as array views. When the
+ * container is loaded from a flat (.flat) archive these views point into the
+ * mapped file, which the container keeps alive (no data is copied).
  */
 class AdjointElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<AdjointElectronPhotonRelaxationDataContainer>
 {
@@ -220,28 +224,28 @@ public:
                    const unsigned subshell ) const;
 
   //! Return the Waller-Hartree scattering function momentum grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeScatteringFunctionMomentumGrid() const;
 
   //! Return the Waller-Hartree scattering function
-  const std::vector<double>& getWallerHartreeScatteringFunction() const;
+  Utility::ArrayView<const double> getWallerHartreeScatteringFunction() const;
 
   //! Return the Waller-Hartree atomic form factor momentum grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeAtomicFormFactorMomentumGrid() const;
 
   //! Return the Waller-Hartree atomic form factor
-  const std::vector<double>& getWallerHartreeAtomicFormFactor() const;
+  Utility::ArrayView<const double> getWallerHartreeAtomicFormFactor() const;
 
   //! Return the Waller-Hartree squared atomic form factor squared mom. grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const;
 
   //! Return the Waller-Hartree squared atomic form factor
-  const std::vector<double>& getWallerHartreeSquaredAtomicFormFactor() const;
+  Utility::ArrayView<const double> getWallerHartreeSquaredAtomicFormFactor() const;
 
   //! Return the adjoint photon energy grid
-  const std::vector<double>& getAdjointPhotonEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointPhotonEnergyGrid() const;
 
   //! Return the adjoint Waller-Hartree (WH) incoherent photon max energy grid
   const std::vector<std::vector<double> >&
@@ -300,7 +304,7 @@ public:
   unsigned getAdjointDopplerBroadenedImpulseApproxSubshellIncoherentCrossSectionThresholdEnergyIndex( const unsigned subshell ) const;
 
   //! Return the adjoint Waller-Hartree coherent cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointWallerHartreeCoherentCrossSection() const;
 
   //! Return the adjoint Waller-Hartree total max energy grid
@@ -328,45 +332,45 @@ public:
   getAdjointDopplerBroadenedImpulseApproxTotalCrossSection() const;
 
   //! Return the (forward) Waller-Hartree total cross section
-  const std::vector<double>& getWallerHartreeTotalCrossSection() const;
+  Utility::ArrayView<const double> getWallerHartreeTotalCrossSection() const;
 
   //! Return the (forward) impulse approx. total cross section
-  const std::vector<double>& getImpulseApproxTotalCrossSection() const;
+  Utility::ArrayView<const double> getImpulseApproxTotalCrossSection() const;
 
   //! Return the adjoint pair production energy distribution grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointPairProductionEnergyDistributionGrid() const;
 
   //! Return the adjoint pair production energy distribution
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointPairProductionEnergyDistribution() const;
 
   //! Return the adjoint pair production energy dist. norm grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointPairProductionEnergyDistributionNormConstantGrid() const;
 
   //! Return the adjoint pair production energy dist. normalization constant
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointPairProductionEnergyDistributionNormConstant() const;
 
   //! Return the adjoint triplet production energy distribution grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointTripletProductionEnergyDistributionGrid() const;
 
   //! Return the adjoint triplet production energy distribution
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointTripletProductionEnergyDistribution() const;
 
   //! Return the adjoint triplet production energy dist. norm grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointTripletProductionEnergyDistributionNormConstantGrid() const;
 
   //! Return the adjoint triplet production energy dist. normalization constant
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getAdjointTripletProductionEnergyDistributionNormConstant() const;
 
   //! Return the bremsstrahlung incoming photon energy grid for the scattering spectrum
-  const std::vector<double>& getAdjointPhotonBremsstrahlungEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointPhotonBremsstrahlungEnergyGrid() const;
 
   //! Return the bremsstrahlung electron energy for an incoming photon energy
   const std::vector<double>& getAdjointPhotonBremsstrahlungEnergy(
@@ -377,7 +381,7 @@ public:
                                const double incoming_adjoint_energy ) const;
 
   //! Return the bremsstrahlung photon cross section
-  const std::vector<double>& getAdjointBremsstrahlungPhotonCrossSection() const;
+  Utility::ArrayView<const double> getAdjointBremsstrahlungPhotonCrossSection() const;
 
   //! Return the bremsstrahlung photon cross section threshold energy bin index
   unsigned getAdjointBremsstrahlungPhotonCrossSectionThresholdEnergyIndex() const;
@@ -393,7 +397,7 @@ public:
   const std::string& getElectronTwoDGridPolicy() const;
 
   //! Return the elastic angular energy grid
-  const std::vector<double>& getAdjointElasticAngularEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointElasticAngularEnergyGrid() const;
 
   //! Return the map of the cutoff elastic scattering angles
   const std::map<double,std::vector<double> >& getAdjointCutoffElasticAngles() const;
@@ -413,7 +417,7 @@ public:
   bool hasAdjointMomentPreservingData() const;
 
   //! Return the moment preserving cross section reductions
-  const std::vector<double>& getAdjointMomentPreservingCrossSectionReduction() const;
+  Utility::ArrayView<const double> getAdjointMomentPreservingCrossSectionReduction() const;
 
   //! Return the moment preserving elastic discrete angles
   const std::map<double,std::vector<double> >
@@ -436,7 +440,7 @@ public:
   getForwardElectroionizationSamplingMode() const;
 
   //! Return the electroionization energy grid for the recoil electron spectrum for a subshell
-  const std::vector<double>& getAdjointElectroionizationEnergyGrid(
+  Utility::ArrayView<const double> getAdjointElectroionizationEnergyGrid(
                            const unsigned subshell ) const;
 
   //! Return if there is a separate electroionization incoming electron energy grid for the scattering spectrum
@@ -453,7 +457,7 @@ public:
                            const double incoming_adjoint_energy ) const;
 
   //! Return the bremsstrahlung incoming electron energy grid for the scattering spectrum
-  const std::vector<double>& getAdjointElectronBremsstrahlungEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointElectronBremsstrahlungEnergyGrid() const;
 
   //! Return if there is a separate bremsstrahlung incoming electron energy grid for the scattering spectrum
   bool separateAdjointBremsstrahlungEnergyGrid() const;
@@ -467,28 +471,28 @@ public:
                            const double incoming_adjoint_energy ) const;
 
   //! Return the atomic excitation average energy gain energy grid
-  const std::vector<double>& getAdjointAtomicExcitationEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointAtomicExcitationEnergyGrid() const;
 
   //! Return the atomic excitation average energy gain
-  const std::vector<double>& getAdjointAtomicExcitationEnergyGain() const;
+  Utility::ArrayView<const double> getAdjointAtomicExcitationEnergyGain() const;
 
   //! Return the electron energy grid
-  const std::vector<double>& getAdjointElectronEnergyGrid() const;
+  Utility::ArrayView<const double> getAdjointElectronEnergyGrid() const;
 
   //! Return the elastic electron cross section below mu = 0.999999
-  const std::vector<double>& getAdjointCutoffElasticCrossSection() const;
+  Utility::ArrayView<const double> getAdjointCutoffElasticCrossSection() const;
 
   //! Return the cutoff elastic cross section threshold energy bin index
   unsigned getAdjointCutoffElasticCrossSectionThresholdEnergyIndex() const;
 
   //! Return the screened Rutherford elastic electron cross section
-  const std::vector<double>& getAdjointScreenedRutherfordElasticCrossSection() const;
+  Utility::ArrayView<const double> getAdjointScreenedRutherfordElasticCrossSection() const;
 
   //! Return the screened Rutherford elastic cross section threshold energy bin index
   unsigned getAdjointScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const;
 
   //! Return the total elastic electron cross section
-  const std::vector<double>& getAdjointTotalElasticCrossSection() const;
+  Utility::ArrayView<const double> getAdjointTotalElasticCrossSection() const;
 
   //! Return the total elastic cross section threshold energy bin index
   unsigned getAdjointTotalElasticCrossSectionThresholdEnergyIndex() const;
@@ -502,31 +506,31 @@ public:
     const unsigned subshell ) const;
 
   //! Return the bremsstrahlung electron cross section
-  const std::vector<double>& getAdjointBremsstrahlungElectronCrossSection() const;
+  Utility::ArrayView<const double> getAdjointBremsstrahlungElectronCrossSection() const;
 
   //! Return the bremsstrahlung electron cross section threshold energy bin index
   unsigned getAdjointBremsstrahlungElectronCrossSectionThresholdEnergyIndex() const;
 
   //! Return the atomic excitation electron cross section
-  const std::vector<double>& getAdjointAtomicExcitationCrossSection() const;
+  Utility::ArrayView<const double> getAdjointAtomicExcitationCrossSection() const;
 
   //! Return the atomic excitation cross section threshold energy bin index
   unsigned getAdjointAtomicExcitationCrossSectionThresholdEnergyIndex() const;
 
   //! Return the forward bremsstrahlung electron cross section
-  const std::vector<double>& getForwardBremsstrahlungElectronCrossSection() const;
+  Utility::ArrayView<const double> getForwardBremsstrahlungElectronCrossSection() const;
 
   //! Return the forward bremsstrahlung electron cross section threshold energy bin index
   unsigned getForwardBremsstrahlungElectronCrossSectionThresholdEnergyIndex() const;
 
   //! Return the forward electroionization electron cross section
-  const std::vector<double>& getForwardElectroionizationElectronCrossSection() const;
+  Utility::ArrayView<const double> getForwardElectroionizationElectronCrossSection() const;
 
   //! Return the forward electroionization electron cross section threshold energy bin index
   unsigned getForwardElectroionizationElectronCrossSectionThresholdEnergyIndex() const;
 
   //! Return the forward atomic excitation electron cross section
-  const std::vector<double>& getForwardAtomicExcitationElectronCrossSection() const;
+  Utility::ArrayView<const double> getForwardAtomicExcitationElectronCrossSection() const;
 
   //! Return the forward atomic excitation electron cross section threshold energy bin index
   unsigned getForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex() const;
@@ -1328,26 +1332,26 @@ private:
   std::map<unsigned,std::vector<double> > d_occupation_numbers;
 
   // The Waller-Hartree scattering function momentum grid (1/cm)
-  std::vector<double> d_waller_hartree_scattering_function_momentum_grid;
+  Utility::MappableArray<double> d_waller_hartree_scattering_function_momentum_grid;
 
   // The Waller-Hartree scattering function
-  std::vector<double> d_waller_hartree_scattering_function;
+  Utility::MappableArray<double> d_waller_hartree_scattering_function;
 
   // The Waller-Hartree atomic form factor momentum grid (1/cm)
-  std::vector<double> d_waller_hartree_atomic_form_factor_momentum_grid;
+  Utility::MappableArray<double> d_waller_hartree_atomic_form_factor_momentum_grid;
 
   // The Waller-Hartree atomic form factor
-  std::vector<double> d_waller_hartree_atomic_form_factor;
+  Utility::MappableArray<double> d_waller_hartree_atomic_form_factor;
 
   // The Waller-Hartree squared atomic form factor squared mom. grid (1/cm^2)
-  std::vector<double>
+  Utility::MappableArray<double>
   d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
 
   // The Waller-Hartree squared atomic form factor
-  std::vector<double> d_waller_hartree_squared_atomic_form_factor;
+  Utility::MappableArray<double> d_waller_hartree_squared_atomic_form_factor;
 
   // The adjoint photon energy grid (MeV)
-  std::vector<double> d_adjoint_photon_energy_grid;
+  Utility::MappableArray<double> d_adjoint_photon_energy_grid;
 
   // The Waller-Hartree incoherent adjoint photon max energy grid (MeV)
   std::vector<std::vector<double> >
@@ -1402,7 +1406,7 @@ private:
   std::map<unsigned,unsigned> d_adjoint_doppler_broadened_impulse_approx_subshell_incoherent_cross_section_threshold_indices;
 
   // The Waller-Hartree coherent cross section (b)
-  std::vector<double> d_waller_hartree_coherent_cross_section;
+  Utility::MappableArray<double> d_waller_hartree_coherent_cross_section;
 
   // The adjoint Waller-Hartree total max energy grid (MeV)
   std::vector<std::vector<double> >
@@ -1429,37 +1433,37 @@ private:
   d_adjoint_doppler_broadened_impulse_approx_total_cross_section;
 
   // The forward Waller-Hartree total cross section (b)
-  std::vector<double> d_waller_hartree_total_cross_section;
+  Utility::MappableArray<double> d_waller_hartree_total_cross_section;
 
   // The forward impulse approx. total cross section (b)
-  std::vector<double> d_impulse_approx_total_cross_section;
+  Utility::MappableArray<double> d_impulse_approx_total_cross_section;
 
   // The adjoint pair production energy distribution grid (MeV)
-  std::vector<double> d_adjoint_pair_production_energy_distribution_grid;
+  Utility::MappableArray<double> d_adjoint_pair_production_energy_distribution_grid;
 
   // The adjoint pair production energy distribution (b)
-  std::vector<double> d_adjoint_pair_production_energy_distribution;
+  Utility::MappableArray<double> d_adjoint_pair_production_energy_distribution;
 
   // The adjoint pair production energy distribution norm constant grid (MeV)
-  std::vector<double> d_adjoint_pair_production_norm_constant_grid;
+  Utility::MappableArray<double> d_adjoint_pair_production_norm_constant_grid;
 
   // The adjoint pair production energy distribution norm constant (b)
-  std::vector<double> d_adjoint_pair_production_norm_constant;
+  Utility::MappableArray<double> d_adjoint_pair_production_norm_constant;
 
   // The adjoint triplet production energy distribution grid (MeV)
-  std::vector<double> d_adjoint_triplet_production_energy_distribution_grid;
+  Utility::MappableArray<double> d_adjoint_triplet_production_energy_distribution_grid;
 
   // The adjoint triplet production energy distribution (b)
-  std::vector<double> d_adjoint_triplet_production_energy_distribution;
+  Utility::MappableArray<double> d_adjoint_triplet_production_energy_distribution;
 
   // The adjoint triplet production energy distribution norm constant grid (MeV)
-  std::vector<double> d_adjoint_triplet_production_norm_constant_grid;
+  Utility::MappableArray<double> d_adjoint_triplet_production_norm_constant_grid;
 
   // The adjoint triplet production energy distribution norm constant (b)
-  std::vector<double> d_adjoint_triplet_production_norm_constant;
+  Utility::MappableArray<double> d_adjoint_triplet_production_norm_constant;
 
   // The photon bremsstrahlung energy grid (MeV)
-  std::vector<double> d_adjoint_photon_bremsstrahlung_energy_grid;
+  Utility::MappableArray<double> d_adjoint_photon_bremsstrahlung_energy_grid;
 
   // The photon bremsstrahlung energy
   std::map<double,std::vector<double> > d_adjoint_photon_bremsstrahlung_energy;
@@ -1468,7 +1472,7 @@ private:
   std::map<double,std::vector<double> > d_adjoint_photon_bremsstrahlung_pdf;
 
   // The bremsstrahlung photon cross section (b)
-  std::vector<double> d_adjoint_bremsstrahlung_photon_cross_section;
+  Utility::MappableArray<double> d_adjoint_bremsstrahlung_photon_cross_section;
 
   // The bremsstrahlung photon cross section threshold energy index
   unsigned d_adjoint_bremsstrahlung_photon_cross_section_threshold_index;
@@ -1484,7 +1488,7 @@ private:
   std::string d_electron_two_d_grid;
 
   // The elastic angular energy grid (MeV)
-  std::vector<double> d_adjoint_angular_energy_grid;
+  Utility::MappableArray<double> d_adjoint_angular_energy_grid;
 
   // The cutoff elastic scattering angles
   std::map<double,std::vector<double> > d_adjoint_cutoff_elastic_angles;
@@ -1493,7 +1497,7 @@ private:
   std::map<double,std::vector<double> > d_adjoint_cutoff_elastic_pdf;
 
   // The moment preserving cross section reductions
-  std::vector<double> d_adjoint_moment_preserving_cross_section_reductions;
+  Utility::MappableArray<double> d_adjoint_moment_preserving_cross_section_reductions;
 
   // The moment preserving elastic discrete angles
   std::map<double,std::vector<double> > d_adjoint_moment_preserving_elastic_discrete_angles;
@@ -1525,28 +1529,28 @@ private:
   std::map<double,std::vector<double> > d_adjoint_electron_bremsstrahlung_pdf;
 
   // The atomic excitation energy grid (MeV)
-  std::vector<double> d_adjoint_atomic_excitation_energy_grid;
+  Utility::MappableArray<double> d_adjoint_atomic_excitation_energy_grid;
 
   // The atomic excitation energy gain
-  std::vector<double> d_adjoint_atomic_excitation_energy_gain;
+  Utility::MappableArray<double> d_adjoint_atomic_excitation_energy_gain;
 
   // The electron energy grid (MeV)
-  std::vector<double> d_adjoint_electron_energy_grid;
+  Utility::MappableArray<double> d_adjoint_electron_energy_grid;
 
   // The cutoff elastic electron cross section (b)
-  std::vector<double> d_adjoint_cutoff_elastic_cross_section;
+  Utility::MappableArray<double> d_adjoint_cutoff_elastic_cross_section;
 
   // The cutoff elastic electron cross section threshold energy index
   unsigned d_adjoint_cutoff_elastic_cross_section_threshold_index;
 
   // The screened rutherford elastic electron cross section (b)
-  std::vector<double> d_adjoint_screened_rutherford_elastic_cross_section;
+  Utility::MappableArray<double> d_adjoint_screened_rutherford_elastic_cross_section;
 
   // The screened rutherford elastic electron cross section threshold energy index
   unsigned d_adjoint_screened_rutherford_elastic_cross_section_threshold_index;
 
   // The total elastic electron cross section (b)
-  std::vector<double> d_adjoint_total_elastic_cross_section;
+  Utility::MappableArray<double> d_adjoint_total_elastic_cross_section;
 
   // The total elastic electron cross section threshold energy index
   unsigned d_adjoint_total_elastic_cross_section_threshold_index;
@@ -1560,31 +1564,31 @@ private:
     d_adjoint_electroionization_subshell_cross_section_threshold_index;
 
   // The bremsstrahlung electron cross section (b)
-  std::vector<double> d_adjoint_bremsstrahlung_electron_cross_section;
+  Utility::MappableArray<double> d_adjoint_bremsstrahlung_electron_cross_section;
 
   // The bremsstrahlung electron cross section threshold energy index
   unsigned d_adjoint_bremsstrahlung_electron_cross_section_threshold_index;
 
   // The atomic excitation electron cross section (b)
-  std::vector<double> d_adjoint_atomic_excitation_cross_section;
+  Utility::MappableArray<double> d_adjoint_atomic_excitation_cross_section;
 
   // The atomic excitation electron cross section threshold energy index
   unsigned d_adjoint_atomic_excitation_cross_section_threshold_index;
 
   // The forward bremsstrahlung electron cross section (b)
-  std::vector<double> d_forward_bremsstrahlung_electron_cross_section;
+  Utility::MappableArray<double> d_forward_bremsstrahlung_electron_cross_section;
 
   // The forward bremsstrahlung electron cross section threshold energy index
   unsigned d_forward_bremsstrahlung_electron_cross_section_threshold_index;
 
   // The forward electroionization electron cross section (b)
-  std::vector<double> d_forward_electroionization_electron_cross_section;
+  Utility::MappableArray<double> d_forward_electroionization_electron_cross_section;
 
   // The forward electroionization electron cross section threshold energy index
   unsigned d_forward_electroionization_electron_cross_section_threshold_index;
 
   // The forward atomic excitation electron cross section (b)
-  std::vector<double> d_forward_atomic_excitation_electron_cross_section;
+  Utility::MappableArray<double> d_forward_atomic_excitation_electron_cross_section;
 
   // The forward atomic excitation electron cross section threshold energy index
   unsigned d_forward_atomic_excitation_electron_cross_section_threshold_index;
@@ -401,51 +401,51 @@ ElectronPhotonRelaxationDataContainer::getOccupationNumber(
 }
 
 // Return the Waller-Hartree scattering function momentum grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunctionMomentumGrid() const
 {
-  return d_waller_hartree_scattering_function_momentum_grid;
+  return d_waller_hartree_scattering_function_momentum_grid.view();
 }
 
 // Return the Waller-Hartree scattering function
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeScatteringFunction() const
 {
-  return d_waller_hartree_scattering_function;
+  return d_waller_hartree_scattering_function.view();
 }
 
 // Return the Waller-Hartree atomic form factor momentum grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactorMomentumGrid() const
 {
-  return d_waller_hartree_atomic_form_factor_momentum_grid;
+  return d_waller_hartree_atomic_form_factor_momentum_grid.view();
 }
 
 // Return the Waller-Hartree atomic form factor
-const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
+Utility::ArrayView<const double> ElectronPhotonRelaxationDataContainer::getWallerHartreeAtomicFormFactor() const
 {
-  return d_waller_hartree_atomic_form_factor;
+  return d_waller_hartree_atomic_form_factor.view();
 }
 
 // Return the Waller-Hartree squared atomic form factor squared mom. grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const
 {
-  return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
+  return d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid.view();
 }
 
 // Return the Waller-Hartree squared atomic form factor
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeSquaredAtomicFormFactor() const
 {
-  return d_waller_hartree_squared_atomic_form_factor;
+  return d_waller_hartree_squared_atomic_form_factor.view();
 }
 
 // Return the photon energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getPhotonEnergyGrid() const
 {
-  return d_photon_energy_grid;
+  return d_photon_energy_grid.view();
 }
 
 // Check if there are average heating numbers
@@ -455,17 +455,17 @@ bool ElectronPhotonRelaxationDataContainer::hasAveragePhotonHeatingNumbers() con
 }
 
 // Return the average heating numbers
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getAveragePhotonHeatingNumbers() const
 {
-  return d_average_photon_heating_numbers;
+  return d_average_photon_heating_numbers.view();
 }
 
 // Return the Waller-Hartree (WH) incoherent photon cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSection() const
 {
-  return d_waller_hartree_incoherent_cross_section;
+  return d_waller_hartree_incoherent_cross_section.view();
 }
 
 // Return the WH incoherent photon cross section threshold energy bin index
@@ -476,10 +476,10 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeIncoherentCrossSectionThr
 }
 
 // Return the impluse approx. (IA) incoherent photon cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getImpulseApproxIncoherentCrossSection() const
 {
-  return d_impulse_approx_incoherent_cross_section;
+  return d_impulse_approx_incoherent_cross_section.view();
 }
 
 // Return the IA incoherent photon cross section threshold energy bin index
@@ -514,10 +514,10 @@ ElectronPhotonRelaxationDataContainer::getImpulseApproxSubshellIncoherentCrossSe
 }
 
 // Return the Waller-Hartree coherent cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSection() const
 {
-  return d_waller_hartree_coherent_cross_section;
+  return d_waller_hartree_coherent_cross_section.view();
 }
 
 // Return the Waller-Hartree coherent cs threshold energy bin index
@@ -528,10 +528,10 @@ ElectronPhotonRelaxationDataContainer::getWallerHartreeCoherentCrossSectionThres
 }
 
 // Return the pair production cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getPairProductionCrossSection() const
 {
-  return d_pair_production_cross_section;
+  return d_pair_production_cross_section.view();
 }
 
 // Return the pair production cross section threshold energy bin index
@@ -541,10 +541,10 @@ unsigned ElectronPhotonRelaxationDataContainer::getPairProductionCrossSectionThr
 }
 
 // Return the triplet production cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSection() const
 {
-  return d_triplet_production_cross_section;
+  return d_triplet_production_cross_section.view();
 }
 
 // Return the triplet production cross section threshold energy bin index
@@ -554,9 +554,9 @@ unsigned ElectronPhotonRelaxationDataContainer::getTripletProductionCrossSection
 }
 
 // Return the Photoelectric effect cross section
-const std::vector<double>& ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSection() const
+Utility::ArrayView<const double> ElectronPhotonRelaxationDataContainer::getPhotoelectricCrossSection() const
 {
-  return d_photoelectric_cross_section;
+  return d_photoelectric_cross_section.view();
 }
 
 // Return the Photoelectric effect cross section threshold energy bin index
@@ -590,15 +590,15 @@ ElectronPhotonRelaxationDataContainer::getSubshellPhotoelectricCrossSectionThres
 }
 
 // Return the Waller-Hartree total cross section
-const std::vector<double>& ElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
+Utility::ArrayView<const double> ElectronPhotonRelaxationDataContainer::getWallerHartreeTotalCrossSection() const
 {
-  return d_waller_hartree_total_cross_section;
+  return d_waller_hartree_total_cross_section.view();
 }
 
 // Return the impulse approx. total cross section
-const std::vector<double>& ElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
+Utility::ArrayView<const double> ElectronPhotonRelaxationDataContainer::getImpulseApproxTotalCrossSection() const
 {
-  return d_impulse_approx_total_cross_section;
+  return d_impulse_approx_total_cross_section.view();
 }
 
 
@@ -621,10 +621,10 @@ ElectronPhotonRelaxationDataContainer::getElectronTwoDGridPolicy() const
 }
 
 // Return the elastic angular energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getElasticAngularEnergyGrid() const
 {
-  return d_angular_energy_grid;
+  return d_angular_energy_grid.view();
 }
 
 // Return the cutoff elastic scattering interpolation policy
@@ -739,10 +739,10 @@ ElectronPhotonRelaxationDataContainer::getMomentPreservingElasticWeights(
 // Return the moment preserving cross section reductions
 /*! \details The cross sections reductions are on the elastic angular energy grid.
  */
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getMomentPreservingCrossSectionReduction() const
 {
-  return d_moment_preserving_cross_section_reductions;
+  return d_moment_preserving_cross_section_reductions.view();
 }
 
 // Return the electroionization energy grid for a subshell
@@ -896,10 +896,10 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationOutgoingPDF(
 }
 
 // Return the bremsstrahlung energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungEnergyGrid() const
 {
-  return d_bremsstrahlung_energy_grid;
+  return d_bremsstrahlung_energy_grid.view();
 }
 
 // Return the bremsstrahlung photon interpolation policy
@@ -948,10 +948,10 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungPhotonPDF(
 }
 
 // Return the atomic excitation energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyGrid() const
 {
-  return d_atomic_excitation_energy_grid;
+  return d_atomic_excitation_energy_grid.view();
 }
 
 // Return the atomic excitation energy loss interpolation policy
@@ -962,17 +962,17 @@ ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLossInterpPolicy
 }
 
 // Return the atomic excitation energy loss
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationEnergyLoss() const
 {
-  return d_atomic_excitation_energy_loss;
+  return d_atomic_excitation_energy_loss.view();
 }
 
 // Return the electron energy grid
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getElectronEnergyGrid() const
 {
-  return d_electron_energy_grid;
+  return d_electron_energy_grid.view();
 }
 
 // Return the electron cross section interpolation policy
@@ -983,17 +983,17 @@ ElectronPhotonRelaxationDataContainer::getElectronCrossSectionInterpPolicy() con
 }
 
 // Return the total electron electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getTotalElectronCrossSection() const
 {
-  return d_total_electron_cross_section;
+  return d_total_electron_cross_section.view();
 }
 
 // Return the cutoff elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSection() const
 {
-  return d_cutoff_elastic_cross_section;
+  return d_cutoff_elastic_cross_section.view();
 }
 
 // Return the cutoff elastic cross section threshold energy bin index
@@ -1003,10 +1003,10 @@ ElectronPhotonRelaxationDataContainer::getCutoffElasticCrossSectionThresholdEner
   return d_cutoff_elastic_cross_section_threshold_index;
 }
 // Return the screened Rutherford elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSection() const
 {
-  return d_screened_rutherford_elastic_cross_section;
+  return d_screened_rutherford_elastic_cross_section.view();
 }
 
 // Return the screened Rutherford elastic cross section threshold energy bin index
@@ -1017,10 +1017,10 @@ ElectronPhotonRelaxationDataContainer::getScreenedRutherfordElasticCrossSectionT
 }
 
 // Return the total elastic electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getTotalElasticCrossSection() const
 {
-  return d_total_elastic_cross_section;
+  return d_total_elastic_cross_section.view();
 }
 
 // Return the total elastic cross section threshold energy bin index
@@ -1047,10 +1047,10 @@ ElectronPhotonRelaxationDataContainer::getElectroionizationCrossSectionThreshold
 }
 
 // Return the bremsstrahlung electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSection() const
 {
-  return d_bremsstrahlung_cross_section;
+  return d_bremsstrahlung_cross_section.view();
 }
 
 // Return the bremsstrahlung cross section threshold energy bin index
@@ -1061,10 +1061,10 @@ ElectronPhotonRelaxationDataContainer::getBremsstrahlungCrossSectionThresholdEne
 }
 
 // Return the atomic excitation electron cross section
-const std::vector<double>&
+Utility::ArrayView<const double>
 ElectronPhotonRelaxationDataContainer::getAtomicExcitationCrossSection() const
 {
-  return d_atomic_excitation_cross_section;
+  return d_atomic_excitation_cross_section.view();
 }
 
 // Return the atomic excitation cross section threshold energy bin index
@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "Utility_ArchivableObject.hpp"
+#include "Utility_MappableArray.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
 #include "Utility_Set.hpp"
@@ -28,7 +29,10 @@
 namespace Data{
 
 /*! The electron-photon-relaxation data container
- * \details Linear-linear interpolation should be used for all data.
+ * \details Linear-linear interpolation should be used for all data. The
+ * energy grids and cross sections are returned as array views. When the
+ * container is loaded from a flat (.flat) archive these views point into the
+ * mapped file, which the container keeps alive (no data is copied).
  */
 class ElectronPhotonRelaxationDataContainer : public Utility::ArchivableObject<ElectronPhotonRelaxationDataContainer>
 {
@@ -191,37 +195,37 @@ public:
                                                const unsigned subshell ) const;
 
   //! Return the Waller-Hartree scattering function momentum grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeScatteringFunctionMomentumGrid() const;
 
   //! Return the Waller-Hartree scattering function
-  const std::vector<double>& getWallerHartreeScatteringFunction() const;
+  Utility::ArrayView<const double> getWallerHartreeScatteringFunction() const;
 
   //! Return the Waller-Hartree atomic form factor momentum grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeAtomicFormFactorMomentumGrid() const;
 
   //! Return the Waller-Hartree atomic form factor
-  const std::vector<double>& getWallerHartreeAtomicFormFactor() const;
+  Utility::ArrayView<const double> getWallerHartreeAtomicFormFactor() const;
 
   //! Return the Waller-Hartree squared atomic form factor squared mom. grid
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeSquaredAtomicFormFactorSquaredMomentumGrid() const;
 
   //! Return the Waller-Hartree squared atomic form factor
-  const std::vector<double>& getWallerHartreeSquaredAtomicFormFactor() const;
+  Utility::ArrayView<const double> getWallerHartreeSquaredAtomicFormFactor() const;
 
   //! Return the photon energy grid
-  const std::vector<double>& getPhotonEnergyGrid() const;
+  Utility::ArrayView<const double> getPhotonEnergyGrid() const;
 
   //! Check if there are average heating numbers
   bool hasAveragePhotonHeatingNumbers() const;
 
   //! Return the average heating numbers
-  const std::vector<double>& getAveragePhotonHeatingNumbers() const;
+  Utility::ArrayView<const double> getAveragePhotonHeatingNumbers() const;
 
   //! Return the Waller-Hartree (WH) incoherent photon cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeIncoherentCrossSection() const;
 
   //! Return the WH incoherent photon cross section threshold energy bin index
@@ -229,7 +233,7 @@ public:
   getWallerHartreeIncoherentCrossSectionThresholdEnergyIndex() const;
 
   //! Return the impluse approx. (IA) incoherent photon cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getImpulseApproxIncoherentCrossSection() const;
 
   //! Return the IA incoherent photon cross section threshold energy bin index
@@ -247,7 +251,7 @@ public:
                                                const unsigned subshell ) const;
 
   //! Return the Waller-Hartree coherent cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getWallerHartreeCoherentCrossSection() const;
 
   //! Return the Waller-Hartree coherent cs threshold energy bin index
@@ -255,21 +259,21 @@ public:
   getWallerHartreeCoherentCrossSectionThresholdEnergyIndex() const;
 
   //! Return the pair production cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getPairProductionCrossSection() const;
 
   //! Return the pair production cross section threshold energy bin index
   unsigned getPairProductionCrossSectionThresholdEnergyIndex() const;
 
   //! Return the triplet production cross section
-  const std::vector<double>&
+  Utility::ArrayView<const double>
   getTripletProductionCrossSection() const;
 
   //! Return the triple production cross section threshold energy bin index
   unsigned getTripletProductionCrossSectionThresholdEnergyIndex() const;
 
   //! Return the Photoelectric effect cross section
-  const std::vector<double>& getPhotoelectricCrossSection() const;
+  Utility::ArrayView<const double> getPhotoelectricCrossSection() const;
 
   //! Return the Photoelectric effect cross section threshold energy bin index
   unsigned getPhotoelectricCrossSectionThresholdEnergyIndex() const;
@@ -284,10 +288,10 @@ public:
                                                const unsigned subshell ) const;
 
   //! Return the Waller-Hartree total cross section
-  const std::vector<double>& getWallerHartreeTotalCrossSection() const;
+  Utility::ArrayView<const double> getWallerHartreeTotalCrossSection() const;
 
   //! Return the impulse approx. total cross section
-  const std::vector<double>& getImpulseApproxTotalCrossSection() const;
+  Utility::ArrayView<const double> getImpulseApproxTotalCrossSection() const;
 
 
 //---------------------------------------------------------------------------//
@@ -301,7 +305,7 @@ public:
   const std::string& getElectronTwoDGridPolicy() const;
 
   //! Return the elastic angular energy grid
-  const std::vector<double>& getElasticAngularEnergyGrid() const;
+  Utility::ArrayView<const double> getElasticAngularEnergyGrid() const;
 
   //! Return the cutoff elastic scattering interpolation policy
   const std::string& getCutoffElasticInterpPolicy() const;
@@ -324,7 +328,7 @@ public:
   bool hasMomentPreservingData() const;
 
   //! Return the moment preserving cross section reductions
-  const std::vector<double>& getMomentPreservingCrossSectionReduction() const;
+  Utility::ArrayView<const double> getMomentPreservingCrossSectionReduction() const;
 
   //! Return the moment preserving elastic discrete angles
   const std::map<double,std::vector<double> >&
@@ -389,7 +393,7 @@ public:
                                 const double incoming_energy ) const;
 
   //! Return the bremsstrahlung energy grid for the secondary photon spectrum
-  const std::vector<double>& getBremsstrahlungEnergyGrid() const;
+  Utility::ArrayView<const double> getBremsstrahlungEnergyGrid() const;
 
   //! Return the bremsstrahlung photon interpolation policy
   const std::string& getBremsstrahlungPhotonInterpPolicy() const;
@@ -409,37 +413,37 @@ public:
                                 const double incoming_energy ) const;
 
   //! Return the atomic excitation average energy loss energy grid
-  const std::vector<double>& getAtomicExcitationEnergyGrid() const;
+  Utility::ArrayView<const double> getAtomicExcitationEnergyGrid() const;
 
   //! Return the atomic excitation average energy loss interpolation policy
   const std::string& getAtomicExcitationEnergyLossInterpPolicy() const;
 
   //! Return the atomic excitation average energy loss
-  const std::vector<double>& getAtomicExcitationEnergyLoss() const;
+  Utility::ArrayView<const double> getAtomicExcitationEnergyLoss() const;
 
   //! Return the electron energy grid
-  const std::vector<double>& getElectronEnergyGrid() const;
+  Utility::ArrayView<const double> getElectronEnergyGrid() const;
 
   //! Return the electron cross section interpolation policy
   const std::string& getElectronCrossSectionInterpPolicy() const;
 
   //! Return the total electron cross section
-  const std::vector<double>& getTotalElectronCrossSection() const;
+  Utility::ArrayView<const double> getTotalElectronCrossSection() const;
 
   //! Return the elastic electron cross section below mu = 0.999999
-  const std::vector<double>& getCutoffElasticCrossSection() const;
+  Utility::ArrayView<const double> getCutoffElasticCrossSection() const;
 
   //! Return the cutoff elastic cross section threshold energy bin index
   unsigned getCutoffElasticCrossSectionThresholdEnergyIndex() const;
 
   //! Return the screened Rutherford elastic electron cross section
-  const std::vector<double>& getScreenedRutherfordElasticCrossSection() const;
+  Utility::ArrayView<const double> getScreenedRutherfordElasticCrossSection() const;
 
   //! Return the screened Rutherford elastic cross section threshold energy bin index
   unsigned getScreenedRutherfordElasticCrossSectionThresholdEnergyIndex() const;
 
   //! Return the total elastic electron cross section
-  const std::vector<double>& getTotalElasticCrossSection() const;
+  Utility::ArrayView<const double> getTotalElasticCrossSection() const;
 
   //! Return the total elastic cross section threshold energy bin index
   unsigned getTotalElasticCrossSectionThresholdEnergyIndex() const;
@@ -453,13 +457,13 @@ public:
     const unsigned subshell ) const;
 
   //! Return the bremsstrahlung electron cross section
-  const std::vector<double>& getBremsstrahlungCrossSection() const;
+  Utility::ArrayView<const double> getBremsstrahlungCrossSection() const;
 
   //! Return the bremsstrahlung cross section threshold energy bin index
   unsigned getBremsstrahlungCrossSectionThresholdEnergyIndex() const;
 
   //! Return the atomic excitation electron cross section
-  const std::vector<double>& getAtomicExcitationCrossSection() const;
+  Utility::ArrayView<const double> getAtomicExcitationCrossSection() const;
 
   //! Return the atomic excitation cross section threshold energy bin index
   unsigned getAtomicExcitationCrossSectionThresholdEnergyIndex() const;
@@ -1107,41 +1111,41 @@ private:
   std::map<unsigned,std::vector<double> > d_occupation_numbers;
 
   // The Waller-Hartree scattering function momentum grid (1/cm)
-  std::vector<double> d_waller_hartree_scattering_function_momentum_grid;
+  Utility::MappableArray<double> d_waller_hartree_scattering_function_momentum_grid;
 
   // The Waller-Hartree scattering function
-  std::vector<double> d_waller_hartree_scattering_function;
+  Utility::MappableArray<double> d_waller_hartree_scattering_function;
 
   // The Waller-Hartree atomic form factor momentum grid (1/cm)
-  std::vector<double> d_waller_hartree_atomic_form_factor_momentum_grid;
+  Utility::MappableArray<double> d_waller_hartree_atomic_form_factor_momentum_grid;
 
   // The Waller-Hartree atomic form factor
-  std::vector<double> d_waller_hartree_atomic_form_factor;
+  Utility::MappableArray<double> d_waller_hartree_atomic_form_factor;
 
   // The Waller-Hartree squared atomic form factor squared mom. grid (1/cm^2)
-  std::vector<double>
+  Utility::MappableArray<double>
   d_waller_hartree_squared_atomic_form_factor_squared_momentum_grid;
 
   // The Waller-Hartree squared atomic form factor
-  std::vector<double> d_waller_hartree_squared_atomic_form_factor;
+  Utility::MappableArray<double> d_waller_hartree_squared_atomic_form_factor;
 
   // The photon energy grid (MeV)
-  std::vector<double> d_photon_energy_grid;
+  Utility::MappableArray<double> d_photon_energy_grid;
 
   // There are average heating numbers
   bool d_has_average_photon_heating_numbers;
 
   // The average heating numbers
-  std::vector<double> d_average_photon_heating_numbers;
+  Utility::MappableArray<double> d_average_photon_heating_numbers;
 
   // The Waller-Hartree incoherent photon cross section (b)
-  std::vector<double> d_waller_hartree_incoherent_cross_section;
+  Utility::MappableArray<double> d_waller_hartree_incoherent_cross_section;
 
   // The Waller-Hartree incoherent photon cross section threshold energy index
   unsigned d_waller_hartree_incoherent_cross_section_threshold_index;
 
   // The impulse approx. incoherent photon cross section (b)
-  std::vector<double> d_impulse_approx_incoherent_cross_section;
+  Utility::MappableArray<double> d_impulse_approx_incoherent_cross_section;
 
   // The impulse approx. incoherent photon cross section threshold energy index
   unsigned d_impulse_approx_incoherent_cross_section_threshold_index;
@@ -1155,25 +1159,25 @@ private:
   d_impulse_approx_subshell_incoherent_cross_section_threshold_indices;
 
   // The Waller-Hartree coherent cross section (b)
-  std::vector<double> d_waller_hartree_coherent_cross_section;
+  Utility::MappableArray<double> d_waller_hartree_coherent_cross_section;
 
   // The Waller-Hartree coherent cross section threshold energy index
   unsigned d_waller_hartree_coherent_cross_section_threshold_index;
 
   // The pair production cross section (b)
-  std::vector<double> d_pair_production_cross_section;
+  Utility::MappableArray<double> d_pair_production_cross_section;
 
   // The pair production cross section threshold energy index
   unsigned d_pair_production_cross_section_threshold_index;
 
   // The triplet production cross section (b)
-  std::vector<double> d_triplet_production_cross_section;
+  Utility::MappableArray<double> d_triplet_production_cross_section;
 
   // The triplet production cross section threshold energy index
   unsigned d_triplet_production_cross_section_threshold_index;
 
   // The photoelectric effect cross section (b)
-  std::vector<double> d_photoelectric_cross_section;
+  Utility::MappableArray<double> d_photoelectric_cross_section;
 
   // The photoelectric effect cross section energy index
   unsigned d_photoelectric_cross_section_threshold_index;
@@ -1187,10 +1191,10 @@ private:
   d_subshell_photoelectric_cross_section_threshold_indices;
 
   // The Waller-Hartree total cross section (b)
-  std::vector<double> d_waller_hartree_total_cross_section;
+  Utility::MappableArray<double> d_waller_hartree_total_cross_section;
 
   // The impulse approx. total cross section (b)
-  std::vector<double> d_impulse_approx_total_cross_section;
+  Utility::MappableArray<double> d_impulse_approx_total_cross_section;
 
 
 //---------------------------------------------------------------------------//
@@ -1204,7 +1208,7 @@ private:
   std::string d_electron_two_d_grid;
 
   // The elastic angular energy grid (MeV)
-  std::vector<double> d_angular_energy_grid;
+  Utility::MappableArray<double> d_angular_energy_grid;
 
   // The cutoff elastic scattering InterpPolicy
   std::string d_cutoff_elastic_interp;
@@ -1222,7 +1226,7 @@ private:
   std::map<double,std::vector<double> > d_moment_preserving_elastic_weights;
 
   // The moment preserving cross section reductions
-  std::vector<double> d_moment_preserving_cross_section_reductions;
+  Utility::MappableArray<double> d_moment_preserving_cross_section_reductions;
 
   // The electroionization energy grid (MeV) for a subshell
   std::map<unsigned,std::vector<double> > d_electroionization_energy_grid;
@@ -1247,7 +1251,7 @@ private:
     d_electroionization_outgoing_pdf;
 
   // The bremsstrahlung energy grid (MeV)
-  std::vector<double> d_bremsstrahlung_energy_grid;
+  Utility::MappableArray<double> d_bremsstrahlung_energy_grid;
 
   // The bremsstrahlung photon InterpPolicy
   std::string d_bremsstrahlung_photon_interp;
@@ -1259,37 +1263,37 @@ private:
   std::map<double,std::vector<double> > d_bremsstrahlung_photon_pdf;
 
   // The atomic excitation energy grid (MeV)
-  std::vector<double> d_atomic_excitation_energy_grid;
+  Utility::MappableArray<double> d_atomic_excitation_energy_grid;
 
   // The atomic excitation energy loss InterpPolicy
   std::string d_atomic_excitation_energy_loss_interp;
 
   // The atomic excitation energy loss
-  std::vector<double> d_atomic_excitation_energy_loss;
+  Utility::MappableArray<double> d_atomic_excitation_energy_loss;
 
   // The electron energy grid (MeV)
-  std::vector<double> d_electron_energy_grid;
+  Utility::MappableArray<double> d_electron_energy_grid;
 
   // The electron cross section InterpPolicy
   std::string d_electron_cross_section_interp;
 
   // The total electron electron cross section (b)
-  std::vector<double> d_total_electron_cross_section;
+  Utility::MappableArray<double> d_total_electron_cross_section;
 
   // The cutoff elastic electron cross section (b)
-  std::vector<double> d_cutoff_elastic_cross_section;
+  Utility::MappableArray<double> d_cutoff_elastic_cross_section;
 
   // The cutoff elastic electron cross section threshold energy index
   unsigned d_cutoff_elastic_cross_section_threshold_index;
 
   // The screened rutherford elastic electron cross section (b)
-  std::vector<double> d_screened_rutherford_elastic_cross_section;
+  Utility::MappableArray<double> d_screened_rutherford_elastic_cross_section;
 
   // The screened rutherford elastic electron cross section threshold energy index
   unsigned d_screened_rutherford_elastic_cross_section_threshold_index;
 
   // The total elastic electron cross section (b)
-  std::vector<double> d_total_elastic_cross_section;
+  Utility::MappableArray<double> d_total_elastic_cross_section;
 
   // The total elastic electron cross section threshold energy index
   unsigned d_total_elastic_cross_section_threshold_index;
@@ -1303,13 +1307,13 @@ private:
     d_electroionization_subshell_cross_section_threshold_index;
 
   // The bremsstrahlung electron cross section (b)
-  std::vector<double> d_bremsstrahlung_cross_section;
+  Utility::MappableArray<double> d_bremsstrahlung_cross_section;
 
   // The bremsstrahlung electron cross section threshold energy index
   unsigned d_bremsstrahlung_cross_section_threshold_index;
 
   // The atomic excitation electron cross section (b)
-  std::vector<double> d_atomic_excitation_cross_section;
+  Utility::MappableArray<double> d_atomic_excitation_cross_section;
 
   // The atomic excitation electron cross section threshold energy index
   unsigned d_atomic_excitation_cross_section_threshold_index;
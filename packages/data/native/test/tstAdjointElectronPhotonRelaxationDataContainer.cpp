@@ -2022,6 +2022,44 @@ FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
                        electron_energy_grid );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the electron energy grid is returned when there are no separate
+// electroionization and bremsstrahlung energy grids
+FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
+                   getAdjointElectroionizationAndBremsstrahlungEnergyGrid_no_separate_grids )
+{
+  Data::AdjointElectronPhotonRelaxationVolatileDataContainer local_data_container;
+
+  std::set<unsigned> subshells;
+  subshells.insert( 1 );
+
+  local_data_container.setSubshells( subshells );
+
+  std::vector<double> electron_energy_grid( 3 );
+  electron_energy_grid[0] = 1e-3;
+  electron_energy_grid[1] = 1.0;
+  electron_energy_grid[2] = 20.0;
+
+  local_data_container.setAdjointElectronEnergyGrid( electron_energy_grid );
+
+  FRENSIE_REQUIRE( !local_data_container.separateAdjointElectroionizationEnergyGrid() );
+  FRENSIE_REQUIRE( !local_data_container.separateAdjointBremsstrahlungEnergyGrid() );
+
+  Utility::ArrayView<const double> electroionization_energy_grid =
+    local_data_container.getAdjointElectroionizationEnergyGrid( 1 );
+
+  FRENSIE_CHECK_EQUAL( electroionization_energy_grid, electron_energy_grid );
+  FRENSIE_CHECK_EQUAL( electroionization_energy_grid.data(),
+                       local_data_container.getAdjointElectronEnergyGrid().data() );
+
+  Utility::ArrayView<const double> bremsstrahlung_energy_grid =
+    local_data_container.getAdjointElectronBremsstrahlungEnergyGrid();
+
+  FRENSIE_CHECK_EQUAL( bremsstrahlung_energy_grid, electron_energy_grid );
+  FRENSIE_CHECK_EQUAL( bremsstrahlung_energy_grid.data(),
+                       local_data_container.getAdjointElectronEnergyGrid().data() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the cutoff elastic electron cross section can be set
 FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
@@ -2565,6 +2603,37 @@ FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
   FRENSIE_CHECK_EQUAL( epr_data_container_copy.getForwardAtomicExcitationElectronCrossSectionThresholdEnergyIndex(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be exported and imported
+FRENSIE_UNIT_TEST( AdjointElectronPhotonRelaxationDataContainer,
+                   export_importData_flat )
+{
+  const std::string test_flat_file_name( "test_aepr_data_container.flat" );
+
+  epr_data_container.saveToFile( test_flat_file_name, true );
+
+  const Data::AdjointElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_flat_file_name );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointPhotonEnergyGrid(),
+                       epr_data_container.getAdjointPhotonEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointElectronEnergyGrid(),
+                       epr_data_container.getAdjointElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAdjointCutoffElasticCrossSection(),
+                       epr_data_container.getAdjointCutoffElasticCrossSection() );
+
+  // The tables of the loaded container view the mapped file - copies of the
+  // container share the mapped file instead of copying the tables
+  const Data::AdjointElectronPhotonRelaxationDataContainer
+    epr_data_container_mapped_copy( epr_data_container_copy );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_mapped_copy.getAdjointPhotonEnergyGrid().data(),
+                       epr_data_container_copy.getAdjointPhotonEnergyGrid().data() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_mapped_copy.getAdjointElectronEnergyGrid().data(),
+                       epr_data_container_copy.getAdjointElectronEnergyGrid().data() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstAdjointElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
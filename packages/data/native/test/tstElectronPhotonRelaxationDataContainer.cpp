@@ -13,6 +13,7 @@
 // FRENSIE Includes
 #include "Data_ElectronPhotonRelaxationVolatileDataContainer.hpp"
 #include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_FlatArchiveFile.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 
 //---------------------------------------------------------------------------//
@@ -2171,6 +2172,89 @@ FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
                        0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the data can be exported and imported
+FRENSIE_UNIT_TEST( ElectronPhotonRelaxationDataContainer,
+                   export_importData_flat )
+{
+  const std::string test_flat_file_name( "test_epr_data_container.flat" );
+
+  epr_data_container.saveToFile( test_flat_file_name, true );
+
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_copy( test_flat_file_name );
+
+  // Table Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getNotes(), notes );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicNumber(), 1 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getAtomicWeight(), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffAngleCosine(),
+                       0.9 );
+
+  // Relaxation Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshells(),
+                       epr_data_container.getSubshells() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellOccupancy( 1 ), 1.0 );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getSubshellRelaxationVacancies( 1 ),
+                       epr_data_container.getSubshellRelaxationVacancies( 1 ) );
+
+  // Photon Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getComptonProfile( 1 ),
+                       epr_data_container.getComptonProfile( 1 ) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+  FRENSIE_CHECK( epr_data_container_copy.hasAveragePhotonHeatingNumbers() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSection(),
+                       epr_data_container.getPairProductionCrossSection() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getPairProductionCrossSectionThresholdEnergyIndex(),
+                       1 );
+
+  // Electron Tests
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronTwoDInterpPolicy(),
+                       epr_data_container.getElectronTwoDInterpPolicy() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getCutoffElasticAngles(1.0),
+                       epr_data_container.getCutoffElasticAngles(1.0) );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getElectroionizationRecoilPDF(1u, 1.0),
+    epr_data_container.getElectroionizationRecoilPDF(1u, 1.0) );
+  FRENSIE_CHECK_EQUAL( epr_data_container_copy.getElectronEnergyGrid(),
+                       epr_data_container.getElectronEnergyGrid() );
+  FRENSIE_CHECK_EQUAL(
+    epr_data_container_copy.getAtomicExcitationCrossSectionThresholdEnergyIndex(),
+                       0 );
+
+  // The arrays can also be viewed directly in the mapped file
+  Utility::FlatArchiveFile flat_file( test_flat_file_name );
+
+  Utility::ArrayView<const double> photon_energy_grid =
+    flat_file.getEntry<double>( "container/photon_energy_grid" );
+
+  FRENSIE_CHECK_EQUAL( photon_energy_grid.size(),
+                       epr_data_container.getPhotonEnergyGrid().size() );
+  FRENSIE_CHECK_EQUAL( photon_energy_grid.front(),
+                       epr_data_container.getPhotonEnergyGrid().front() );
+
+  // The tables of the loaded container view the mapped file - copies of the
+  // container share the mapped file instead of copying the tables
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_mapped_copy( epr_data_container_copy );
+
+  FRENSIE_CHECK_EQUAL( epr_data_container_mapped_copy.getPhotonEnergyGrid().data(),
+                       epr_data_container_copy.getPhotonEnergyGrid().data() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_mapped_copy.getElectronEnergyGrid().data(),
+                       epr_data_container_copy.getElectronEnergyGrid().data() );
+
+  // The tables of containers that are not loaded from a flat archive are
+  // owned by the container
+  const Data::ElectronPhotonRelaxationDataContainer
+    epr_data_container_owned_copy( epr_data_container );
+
+  FRENSIE_CHECK( epr_data_container_owned_copy.getPhotonEnergyGrid().data() !=
+                 epr_data_container.getPhotonEnergyGrid().data() );
+  FRENSIE_CHECK_EQUAL( epr_data_container_owned_copy.getPhotonEnergyGrid(),
+                       epr_data_container.getPhotonEnergyGrid() );
+}
+
 //---------------------------------------------------------------------------//
 // end tstElectronPhotonRelaxationDataContainer.cpp
 //---------------------------------------------------------------------------//
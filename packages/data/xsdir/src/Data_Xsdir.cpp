@@ -268,6 +268,48 @@ size_t Xsdir::quickExtractFileStartLineFromEntryTokens(
   return Utility::fromString<size_t>( entry_tokens[5] );
 }
 
+// Extract the record length of a binary table from the entry tokens
+/*! \details The record length is given in bytes.
+ */
+size_t Xsdir::extractRecordLengthFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  TEST_FOR_EXCEPTION( !Xsdir::isLineTableEntry( entry_tokens ),
+                      std::logic_error,
+                      "The line does not have table data!" );
+
+  TEST_FOR_EXCEPTION( Xsdir::isTableHumanReadable( entry_tokens ),
+                      std::logic_error,
+                      "The line does not specify data for a binary table!" );
+
+  TEST_FOR_EXCEPTION( entry_tokens.size() < 9,
+                      std::logic_error,
+                      "The line does not specify the binary table record "
+                      "length!" );
+
+  return Utility::fromString<size_t>( entry_tokens[7] );
+}
+
+// Extract the entries per record of a binary table from the entry tokens
+size_t Xsdir::extractEntriesPerRecordFromEntryTokens(
+                                 const std::vector<std::string>& entry_tokens )
+{
+  TEST_FOR_EXCEPTION( !Xsdir::isLineTableEntry( entry_tokens ),
+                      std::logic_error,
+                      "The line does not have table data!" );
+
+  TEST_FOR_EXCEPTION( Xsdir::isTableHumanReadable( entry_tokens ),
+                      std::logic_error,
+                      "The line does not specify data for a binary table!" );
+
+  TEST_FOR_EXCEPTION( entry_tokens.size() < 9,
+                      std::logic_error,
+                      "The line does not specify the binary table entries "
+                      "per record!" );
+
+  return Utility::fromString<size_t>( entry_tokens[8] );
+}
+
 // Extract the table evaluation temperature from the entry tokens
 auto Xsdir::extractEvaluationTemperatureFromEntryTokens(
                        const std::vector<std::string>& entry_tokens ) -> Energy
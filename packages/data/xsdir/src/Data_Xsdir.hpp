@@ -144,6 +144,14 @@ protected:
   static size_t extractFileStartLineFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
 
+  //! Extract the record length of a binary table from the entry tokens
+  static size_t extractRecordLengthFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
+  //! Extract the entries per record of a binary table from the entry tokens
+  static size_t extractEntriesPerRecordFromEntryTokens(
+                                const std::vector<std::string>& entry_tokens );
+
   //! Extract the table evaluation temperature from the entry tokens
   static Energy extractEvaluationTemperatureFromEntryTokens(
                                 const std::vector<std::string>& entry_tokens );
@@ -41,6 +41,8 @@ struct TestXsdir : public Data::Xsdir
   using Xsdir::extractAtomicWeightRatioFromEntryTokens;
   using Xsdir::extractPathFromEntryTokens;
   using Xsdir::extractFileStartLineFromEntryTokens;
+  using Xsdir::extractRecordLengthFromEntryTokens;
+  using Xsdir::extractEntriesPerRecordFromEntryTokens;
   using Xsdir::extractEvaluationTemperatureFromEntryTokens;
 };
 
@@ -701,6 +703,67 @@ FRENSIE_UNIT_TEST( Xsdir, extractFileStartLineFromEntryTokens )
   FRENSIE_CHECK_EQUAL( file_start_line, 7921 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the record length of a binary table can be extracted from the
+// entry tokens
+FRENSIE_UNIT_TEST( Xsdir, extractRecordLengthFromEntryTokens )
+{
+  std::vector<std::string> entry_tokens;
+
+  TestXsdir::splitLineIntoEntryTokens( "atomic weight ratios", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractRecordLengthFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractRecordLengthFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractRecordLengthFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 4096 512 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractRecordLengthFromEntryTokens( entry_tokens ),
+                       4096 );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 8192 1024 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractRecordLengthFromEntryTokens( entry_tokens ),
+                       8192 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the entries per record of a binary table can be extracted from
+// the entry tokens
+FRENSIE_UNIT_TEST( Xsdir, extractEntriesPerRecordFromEntryTokens )
+{
+  std::vector<std::string> entry_tokens;
+
+  TestXsdir::splitLineIntoEntryTokens( "atomic weight ratios", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractEntriesPerRecordFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 1 4 17969 0 0 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_THROW( TestXsdir::extractEntriesPerRecordFromEntryTokens( entry_tokens ),
+                       std::logic_error );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 4096 512 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractEntriesPerRecordFromEntryTokens( entry_tokens ),
+                       512 );
+
+  TestXsdir::splitLineIntoEntryTokens( "1001.80c 0.999167 h1.710nc 0 2 1 17969 8192 1024 2.5301E-08", entry_tokens );
+
+  FRENSIE_CHECK_EQUAL( TestXsdir::extractEntriesPerRecordFromEntryTokens( entry_tokens ),
+                       1024 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the table evaluation temperature can be extracted from the entry
 // tokens
@@ -13,6 +13,7 @@
 #include <algorithm>
 
 // FRENSIE Includes
+#include "DataGen_ParallelEvaluationHelpers.hpp"
 #include "Utility_GaussKronrodIntegrator.hpp"
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_SortAlgorithms.hpp"
@@ -428,20 +429,37 @@ void AdjointElectronGridGenerator<TwoDInterpPolicy>::generateAndEvaluateDistribu
   testPrecondition( threshold_index >= 0 );
   testPrecondition( adjoint_cross_sections.size() + threshold_index == primary_energy_grid.size() );
 
+  // Create the map entries before the distributions are evaluated so that
+  // the maps are not modified while the distributions are evaluated
+  std::vector<unsigned> cross_section_indices;
+  std::vector<std::vector<double>*> outgoing_energy_grids, evaluated_pdfs;
+
   for( unsigned i = 0; i < adjoint_cross_sections.size(); ++i )
   {
     double incoming_energy = primary_energy_grid[i + threshold_index];
 
     if( this->getNudgedMinEnergy( incoming_energy ) < this->getMaxOutgoingEnergy() )
     {
-      this->generateAndEvaluateDistribution(
-              outgoing_energy_grid[incoming_energy],
-              evaluated_pdf[incoming_energy],
-              evaluation_tol,
-              incoming_energy,
-              adjoint_cross_sections[i] );
+      cross_section_indices.push_back( i );
+      outgoing_energy_grids.push_back( &outgoing_energy_grid[incoming_energy] );
+      evaluated_pdfs.push_back( &evaluated_pdf[incoming_energy] );
     }
   }
+
+  // Evaluate the distribution at every primary energy (each primary energy
+  // is independent of the others)
+  DataGen::evaluateInParallel( cross_section_indices.size(),
+                               [&]( const size_t j )
+  {
+    const unsigned i = cross_section_indices[j];
+
+    this->generateAndEvaluateDistribution(
+              *outgoing_energy_grids[j],
+              *evaluated_pdfs[j],
+              evaluation_tol,
+              primary_energy_grid[i + threshold_index],
+              adjoint_cross_sections[i] );
+  } );
 }
 
 // Initialize the secondary energy grid at an energy grid point
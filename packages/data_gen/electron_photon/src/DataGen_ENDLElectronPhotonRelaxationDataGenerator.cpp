@@ -17,6 +17,7 @@
 #include "DataGen_ScatteringFunctionEvaluator.hpp"
 #include "DataGen_OccupationNumberEvaluator.hpp"
 #include "DataGen_ComptonProfileGenerator.hpp"
+#include "DataGen_ParallelEvaluationHelpers.hpp"
 #include "MonteCarlo_ComptonProfileHelpers.hpp"
 #include "MonteCarlo_ComptonProfileSubshellConverterFactory.hpp"
 #include "MonteCarlo_ElasticElectronScatteringDistributionNativeFactory.hpp"
@@ -1993,22 +1994,19 @@ void ENDLElectronPhotonRelaxationDataGenerator::createCrossSectionOnUnionEnergyG
              std::vector<double>& cross_section,
              unsigned& threshold_index ) const
 {
-  std::vector<double> raw_cross_section( union_energy_grid.size() );
+  const double evaluation_tol =
+    this->getSubshellIncoherentEvaluationTolerance();
 
-  std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
+  // Evaluate the cross section at every energy grid point (each integration
+  // is independent of the others)
+  std::vector<double> raw_cross_section;
 
-  unsigned index = 0u;
-
-  while( energy_grid_pt != union_energy_grid.end() )
-  {
-    raw_cross_section[index] =
-      original_cross_section->evaluateIntegratedCrossSection(
-                            *energy_grid_pt,
-                            this->getSubshellIncoherentEvaluationTolerance() );
-
-    ++energy_grid_pt;
-    ++index;
-  }
+  DataGen::evaluateOnGridInParallel( union_energy_grid,
+                                     raw_cross_section,
+                                     [&]( const double energy )
+                                     {
+                                       return original_cross_section->evaluateIntegratedCrossSection( energy, evaluation_tol );
+                                     } );
 
   // The subshell incoherent cross section is zero at the threshold energy
   this->populateCrossSection( raw_cross_section,
@@ -2047,7 +2045,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculateTotalPhotoelectricCross
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getPhotonEnergyGrid();
 
   std::vector<double> raw_cross_section( energy_grid.size(), 0.0 );
@@ -2091,7 +2089,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculateImpulseApproxTotalIncoh
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getPhotonEnergyGrid();
 
   std::vector<double> raw_cross_section( energy_grid.size(), 0.0 );
@@ -2136,7 +2134,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculatePhotonTotalCrossSection
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getPhotonEnergyGrid();
 
   std::vector<double> total_cross_section( energy_grid.size(), 0.0 );
@@ -2193,7 +2191,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculateElectronTotalCrossSecti
   Data::ElectronPhotonRelaxationVolatileDataContainer& data_container =
     this->getVolatileDataContainer();
 
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getElectronEnergyGrid();
 
   std::vector<double> total_cross_section( energy_grid.size(), 0.0 );
@@ -2224,7 +2222,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculateElectronTotalCrossSecti
     // Add the electroionization subshell cs
     this->addCrossSectionToTotalCrossSection(
                         energy_grid,
-                        data_container.getElectroionizationCrossSection(*shell),
+                        Utility::arrayViewOfConst( data_container.getElectroionizationCrossSection(*shell) ),
                         total_cross_section );
   }
 
@@ -2233,9 +2231,9 @@ void ENDLElectronPhotonRelaxationDataGenerator::calculateElectronTotalCrossSecti
 
 // Add cross section to total cross section
 void ENDLElectronPhotonRelaxationDataGenerator::addCrossSectionToTotalCrossSection(
-                               const std::vector<double>& energy_grid,
-                               const std::vector<double>& cross_section,
-                               std::vector<double>& total_cross_section ) const
+                         const Utility::ArrayView<const double>& energy_grid,
+                         const Utility::ArrayView<const double>& cross_section,
+                         std::vector<double>& total_cross_section ) const
 {
   unsigned start_index = energy_grid.size() - cross_section.size();
 
@@ -2334,7 +2332,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedBremsstrahlungDistribu
                       " is invalid or currently not supported!" );
     }
 
-    std::vector<double>::const_iterator start_it = data_container.getElectronEnergyGrid().begin();
+    Utility::ArrayView<const double>::const_iterator start_it = data_container.getElectronEnergyGrid().begin();
     std::advance( start_it, data_container.getBremsstrahlungCrossSectionThresholdEnergyIndex() );
 
     double min_grid_energy =
@@ -2352,14 +2350,9 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedBremsstrahlungDistribu
     std::vector<double> endl_energy_grid =
       d_endl_data_container->getBremsstrahlungPhotonEnergyGrid();
 
-    // Generate the distribution at all incoming energies
+    // Initialize the distribution at all incoming energies
     for( auto&& energy : energy_grid )
     {
-      // Construct the evaluator functor
-      auto&& pdf_evaluator = [&distribution, energy ]( const double& outgoing_energy ){
-        return distribution->evaluatePDF( energy, outgoing_energy );
-      };
-
       // Check if the energy is an originally tabulated energy
       if ( std::find(endl_energy_grid.begin(), endl_energy_grid.end(), energy) != endl_energy_grid.end() )
       {
@@ -2374,11 +2367,26 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedBremsstrahlungDistribu
                                 distribution->getMaxPhotonEnergy(energy) };
       }
 
-      grid_generator.generateAndEvaluateInPlace( evaluated_grid[energy],
-                                                evaluated_pdf[energy],
-                                                pdf_evaluator );
+      evaluated_pdf[energy];
     }
 
+    // Generate the distribution at all incoming energies (the map entries
+    // already exist so each incoming energy can be refined independently)
+    DataGen::evaluateInParallel( energy_grid.size(),
+                                 [&]( const size_t i )
+    {
+      const double energy = energy_grid[i];
+
+      // Construct the evaluator functor
+      auto&& pdf_evaluator = [&distribution, energy ]( const double& outgoing_energy ){
+        return distribution->evaluatePDF( energy, outgoing_energy );
+      };
+
+      grid_generator.generateAndEvaluateInPlace( evaluated_grid.find( energy )->second,
+                                                 evaluated_pdf.find( energy )->second,
+                                                 pdf_evaluator );
+    } );
+
     // Set the recoil energy
     data_container.setBremsstrahlungPhotonEnergy( evaluated_grid );
 
@@ -2503,7 +2511,7 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedElectroionizationSubsh
                       " is invalid or currently not supported!" );
     }
 
-    std::vector<double>::const_iterator start_it = data_container.getElectronEnergyGrid().begin();
+    Utility::ArrayView<const double>::const_iterator start_it = data_container.getElectronEnergyGrid().begin();
     std::advance( start_it, data_container.getElectroionizationCrossSectionThresholdEnergyIndex( shell ) );
 
     double min_grid_energy =
@@ -2523,14 +2531,9 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedElectroionizationSubsh
     energy_grid[0] = min_grid_energy;
 
     std::map<double,std::vector<double> > evaluated_grid, evaluated_pdf;
-    // Generate the distribution at all incoming energies
+    // Initialize the distribution at all incoming energies
     for( auto&& energy : energy_grid )
     {
-      // Construct the evaluator functor
-      auto&& pdf_evaluator = [&distribution, energy ]( const double& outgoing_energy ){
-        return distribution->evaluateProcessedPDF( energy, outgoing_energy );
-      };
-
       // Insert the min and max energy into the grid
       double min_energy = distribution->getMinSecondaryEnergy(energy);
       double max_energy = distribution->getMaxSecondaryEnergy(energy);
@@ -2543,11 +2546,26 @@ void ENDLElectronPhotonRelaxationDataGenerator::setRefinedElectroionizationSubsh
                                                         max_energy,
                                                         shell );
 
-      grid_generator.generateAndEvaluateInPlace( evaluated_grid[energy],
-                                                  evaluated_pdf[energy],
-                                                  pdf_evaluator );
+      evaluated_pdf[energy];
     }
 
+    // Generate the distribution at all incoming energies (the map entries
+    // already exist so each incoming energy can be refined independently)
+    DataGen::evaluateInParallel( energy_grid.size(),
+                                 [&]( const size_t i )
+    {
+      const double energy = energy_grid[i];
+
+      // Construct the evaluator functor
+      auto&& pdf_evaluator = [&distribution, energy ]( const double& outgoing_energy ){
+        return distribution->evaluateProcessedPDF( energy, outgoing_energy );
+      };
+
+      grid_generator.generateAndEvaluateInPlace( evaluated_grid.find( energy )->second,
+                                                 evaluated_pdf.find( energy )->second,
+                                                 pdf_evaluator );
+    } );
+
     // Set the recoil data
     if( sampling_type == MonteCarlo::KNOCK_ON_SAMPLING )
     {
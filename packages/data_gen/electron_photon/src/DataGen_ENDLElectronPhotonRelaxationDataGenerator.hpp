@@ -241,9 +241,9 @@ private:
 
   // Add cross section to electron/photon total cross section
   void addCrossSectionToTotalCrossSection(
-                              const std::vector<double>& energy_grid,
-                              const std::vector<double>& cross_section,
-                              std::vector<double>& total_cross_section ) const;
+                        const Utility::ArrayView<const double>& energy_grid,
+                        const Utility::ArrayView<const double>& cross_section,
+                        std::vector<double>& total_cross_section ) const;
 
   // The if a value is not equal to zero
   static bool notEqualZero( const double value );
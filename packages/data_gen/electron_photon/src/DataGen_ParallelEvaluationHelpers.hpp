@@ -0,0 +1,56 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_ParallelEvaluationHelpers.hpp
+//! \author Alex Robinson
+//! \brief  Parallel evaluation helpers declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_GEN_PARALLEL_EVALUATION_HELPERS_HPP
+#define DATA_GEN_PARALLEL_EVALUATION_HELPERS_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <list>
+
+namespace DataGen{
+
+/*! Evaluate a functor at every index in [0,number_of_evaluations)
+ *
+ * The indices are distributed over the threads requested through
+ * Utility::OpenMPProperties. The functor must only write to data associated
+ * with the index that it is passed so that the results are independent of the
+ * number of threads. If the functor throws, the exception from the lowest
+ * index will be rethrown once all indices have been processed.
+ */
+template<typename IndexFunctor>
+void evaluateInParallel( const size_t number_of_evaluations,
+                         const IndexFunctor& functor );
+
+//! Evaluate a functor at every grid point in parallel
+template<typename EvaluationFunctor>
+void evaluateOnGridInParallel( const std::vector<double>& grid,
+                               std::vector<double>& evaluated_grid,
+                               const EvaluationFunctor& functor );
+
+//! Evaluate a functor at every grid point in parallel
+template<typename EvaluationFunctor>
+void evaluateOnGridInParallel( const std::list<double>& grid,
+                               std::vector<double>& evaluated_grid,
+                               const EvaluationFunctor& functor );
+
+} // end DataGen namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "DataGen_ParallelEvaluationHelpers_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end DATA_GEN_PARALLEL_EVALUATION_HELPERS_HPP
+
+//---------------------------------------------------------------------------//
+// end DataGen_ParallelEvaluationHelpers.hpp
+//---------------------------------------------------------------------------//
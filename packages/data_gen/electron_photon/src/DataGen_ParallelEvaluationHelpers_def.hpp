@@ -0,0 +1,86 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   DataGen_ParallelEvaluationHelpers_def.hpp
+//! \author Alex Robinson
+//! \brief  Parallel evaluation helpers definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef DATA_GEN_PARALLEL_EVALUATION_HELPERS_DEF_HPP
+#define DATA_GEN_PARALLEL_EVALUATION_HELPERS_DEF_HPP
+
+// Std Lib Includes
+#include <exception>
+
+// FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
+
+namespace DataGen{
+
+// Evaluate a functor at every index in [0,number_of_evaluations)
+/*! \details Dynamic scheduling is used because the cost of an evaluation
+ * (e.g. an adaptive integration) can vary greatly from index to index. If
+ * this function is called from inside of an active parallel region the
+ * indices will be processed by the calling thread only.
+ */
+template<typename IndexFunctor>
+void evaluateInParallel( const size_t number_of_evaluations,
+                         const IndexFunctor& functor )
+{
+  std::exception_ptr first_exception;
+  long long first_exception_index = number_of_evaluations;
+
+  #pragma omp parallel for schedule( dynamic, 1 ) num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  for( long long i = 0; i < (long long)number_of_evaluations; ++i )
+  {
+    try{
+      functor( (size_t)i );
+    }
+    catch( ... )
+    {
+      #pragma omp critical( data_gen_parallel_evaluation_exception )
+      {
+        if( i < first_exception_index )
+        {
+          first_exception_index = i;
+          first_exception = std::current_exception();
+        }
+      }
+    }
+  }
+
+  if( first_exception )
+    std::rethrow_exception( first_exception );
+}
+
+// Evaluate a functor at every grid point in parallel
+template<typename EvaluationFunctor>
+void evaluateOnGridInParallel( const std::vector<double>& grid,
+                               std::vector<double>& evaluated_grid,
+                               const EvaluationFunctor& functor )
+{
+  evaluated_grid.resize( grid.size() );
+
+  DataGen::evaluateInParallel( grid.size(),
+                               [&]( const size_t i )
+                               { evaluated_grid[i] = functor( grid[i] ); } );
+}
+
+// Evaluate a functor at every grid point in parallel
+template<typename EvaluationFunctor>
+void evaluateOnGridInParallel( const std::list<double>& grid,
+                               std::vector<double>& evaluated_grid,
+                               const EvaluationFunctor& functor )
+{
+  std::vector<double> grid_copy( grid.begin(), grid.end() );
+
+  DataGen::evaluateOnGridInParallel( grid_copy, evaluated_grid, functor );
+}
+
+} // end DataGen namespace
+
+#endif // end DATA_GEN_PARALLEL_EVALUATION_HELPERS_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end DataGen_ParallelEvaluationHelpers_def.hpp
+//---------------------------------------------------------------------------//
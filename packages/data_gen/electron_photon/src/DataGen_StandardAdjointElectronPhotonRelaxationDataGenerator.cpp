@@ -17,6 +17,7 @@
 #include "DataGen_ElectronElasticDataEvaluator.hpp"
 #include "DataGen_StandardAdjointElectronPhotonRelaxationDataGenerator.hpp"
 #include "DataGen_AdjointPairProductionEnergyDistributionNormConstantEvaluator.hpp"
+#include "DataGen_ParallelEvaluationHelpers.hpp"
 #include "MonteCarlo_ElectroatomicReactionNativeFactory.hpp"
 #include "MonteCarlo_ElectroionizationSubshellElectronScatteringDistributionNativeFactory.hpp"
 #include "MonteCarlo_BremsstrahlungElectronScatteringDistributionNativeFactory.hpp"
@@ -672,7 +673,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointPairProduct
   unsigned threshold_index =
     d_forward_epr_data->getPairProductionCrossSectionThresholdEnergyIndex();
 
-  std::vector<double>::const_iterator start_it =
+  Utility::ArrayView<const double>::const_iterator start_it =
     d_forward_epr_data->getPhotonEnergyGrid().begin() + threshold_index;
 
   energy_grid.assign( start_it,
@@ -736,7 +737,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::setAdjointTripletProd
   unsigned threshold_index =
     d_forward_epr_data->getTripletProductionCrossSectionThresholdEnergyIndex();
 
-  std::vector<double>::const_iterator start_it =
+  Utility::ArrayView<const double>::const_iterator start_it =
     d_forward_epr_data->getPhotonEnergyGrid().begin() + threshold_index;
 
   energy_grid.assign( start_it,
@@ -886,13 +887,13 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::initializeAdjointPhot
                                    std::list<double>& union_energy_grid ) const
 {
   // Find the location of the first grid point that is >= the min photon energy
-  std::vector<double>::const_iterator lower_location_it =
+  Utility::ArrayView<const double>::const_iterator lower_location_it =
     std::lower_bound( d_forward_epr_data->getPhotonEnergyGrid().begin(),
                       d_forward_epr_data->getPhotonEnergyGrid().end(),
                       this->getMinPhotonEnergy() );
 
   // Find the location of the first grid point that is >= the max photon energy
-  std::vector<double>::const_iterator upper_location_it =
+  Utility::ArrayView<const double>::const_iterator upper_location_it =
     std::lower_bound( d_forward_epr_data->getPhotonEnergyGrid().begin(),
                       d_forward_epr_data->getPhotonEnergyGrid().end(),
                       this->getMaxPhotonEnergy() );
@@ -1174,39 +1175,30 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                            cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
+  // Evaluate the cross section at every energy grid point (each grid point
+  // is independent of the others)
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-  while( energy_grid_it != union_energy_grid.end() )
+  DataGen::evaluateInParallel( energy_grid.size(),
+                               [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() > *energy_grid_it )
+    if( max_energy_grid[i].front() > energy_grid[i] )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert( max_energy_grid_it->begin(),
-                                  *energy_grid_it );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert( max_energy_grid[i].begin(), energy_grid[i] );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1249,40 +1241,32 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
   // Evaluate the cross section at every energy grid point at or above the
-  // threshold energy
-  std::list<double>::const_iterator energy_grid_it = start;
+  // threshold energy (each grid point is independent of the others)
+  const std::vector<double> energy_grid( start,
+                                         union_energy_grid.end() );
 
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
+  const double binding_energy = cs_evaluator->getSubshellBindingEnergy();
 
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
+  DataGen::evaluateInParallel( energy_grid.size(),
+                               [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
+    if( max_energy_grid[i].front() > energy_grid[i] + binding_energy )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert( max_energy_grid[i].begin(),
+                                 energy_grid[i] + binding_energy );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1312,41 +1296,33 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
     grid_generator.createCrossSectionEvaluator(
                   cs_evaluator, this->getAdjointIncoherentEvaluationTolerance() );
 
-  // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<std::vector<double> >::iterator max_energy_grid_it =
-    max_energy_grid.begin();
+  // Evaluate the cross section at every energy grid point (each grid point
+  // is independent of the others)
+  const std::vector<double> energy_grid( union_energy_grid.begin(),
+                                         union_energy_grid.end() );
 
-  std::vector<std::vector<double> >::iterator cross_section_it =
-    cross_section.begin();
+  const double binding_energy = cs_evaluator->getSubshellBindingEnergy();
 
-  while( energy_grid_it != union_energy_grid.end() )
+  DataGen::evaluateInParallel( energy_grid.size(),
+                               [&]( const size_t i )
   {
-    grid_generator.generateAndEvaluateSecondaryInPlace(*max_energy_grid_it,
-                                                       *cross_section_it,
-                                                       *energy_grid_it,
-                                                       cs_evaluation_wrapper );
+    grid_generator.generateAndEvaluateSecondaryInPlace( max_energy_grid[i],
+                                                        cross_section[i],
+                                                        energy_grid[i],
+                                                        cs_evaluation_wrapper );
 
     // Check if the first max energy grid point is valid. The energy to
     // max energy nudge value is used to improve convergence time by ignoring
     // the secondary grid point where the cross section is zero
     // (energy = max energy). We must add it back in for the grid to be usable.
-    if( max_energy_grid_it->front() >
-        *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() )
+    if( max_energy_grid[i].front() > energy_grid[i] + binding_energy )
     {
       // This operation is inefficient with vectors!!!
-      max_energy_grid_it->insert(
-                  max_energy_grid_it->begin(),
-                  *energy_grid_it + cs_evaluator->getSubshellBindingEnergy() );
-      cross_section_it->insert( cross_section_it->begin(), 0.0 );
+      max_energy_grid[i].insert( max_energy_grid[i].begin(),
+                                 energy_grid[i] + binding_energy );
+      cross_section[i].insert( cross_section[i].begin(), 0.0 );
     }
-
-    ++energy_grid_it;
-    ++max_energy_grid_it;
-    ++cross_section_it;
-  }
+  } );
 }
 
 // Create the cross section on the union energy grid
@@ -1355,22 +1331,11 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
           const std::shared_ptr<const Utility::UnivariateDistribution>& cs_evaluator,
           std::vector<double>& cross_section ) const
 {
-  // Resize the cross section array
-  cross_section.resize( union_energy_grid.size() );
-
   // Evaluate the cross section at every energy grid point
-  std::list<double>::const_iterator energy_grid_it =
-    union_energy_grid.begin();
-
-  std::vector<double>::iterator cross_section_it = cross_section.begin();
-
-  while( energy_grid_it != union_energy_grid.end() )
-  {
-    *cross_section_it = cs_evaluator->evaluate( *energy_grid_it );
-
-    ++energy_grid_it;
-    ++cross_section_it;
-  }
+  DataGen::evaluateOnGridInParallel( union_energy_grid,
+                                     cross_section,
+                                     [&cs_evaluator]( const double energy )
+                                     { return cs_evaluator->evaluate( energy ); } );
 }
 
 // Calculate the total incoherent adjoint cross section
@@ -1380,7 +1345,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointImpul
     this->getVolatileDataContainer();
 
   // Get the union energy grid
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getAdjointPhotonEnergyGrid();
 
   // Initialize the max energy grid
@@ -1464,7 +1429,7 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointDoppl
     this->getVolatileDataContainer();
 
   // Get the union energy grid
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getAdjointPhotonEnergyGrid();
 
   // Initialize the max energy grid
@@ -1537,11 +1502,11 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::calculateAdjointPhoto
     this->getVolatileDataContainer();
 
   // Get the adjoint photon energy grid
-  const std::vector<double>& energy_grid =
+  const Utility::ArrayView<const double> energy_grid =
     data_container.getAdjointPhotonEnergyGrid();
 
   // Get the coherent cross section
-  const std::vector<double>& coherent_cs =
+  const Utility::ArrayView<const double> coherent_cs =
     data_container.getAdjointWallerHartreeCoherentCrossSection();
 
   // Get the max energy grid and initialize the cross section
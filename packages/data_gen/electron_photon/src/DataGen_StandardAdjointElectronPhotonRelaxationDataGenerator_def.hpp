@@ -9,11 +9,16 @@
 #ifndef DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 #define DATA_GEN_STANDARD_ADJOINT_ELECTRON_PHOTON_RELAXATION_DATA_GENERATOR_DEF_HPP
 
+// FRENSIE Includes
+#include "DataGen_ParallelEvaluationHelpers.hpp"
+
 namespace DataGen{
 
 // Create the cross section on the union energy grid
 /*! \detials The functor should take the incoming adjoint energy (double) as its
- *  argument and return the adjoint cross section. 
+ *  argument and return the adjoint cross section. The functor will be called
+ *  concurrently when multiple threads have been requested so it must not
+ *  modify any shared state.
  */
 template <typename Functor>
 void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnUnionEnergyGrid(
@@ -22,20 +27,12 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::createCrossSectionOnU
    std::vector<double>& cross_section,
    unsigned& threshold_index ) const
 {
-   std::vector<double> raw_cross_section( union_energy_grid.size() );
-
-   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
-
-   unsigned index = 0u;
+   std::vector<double> raw_cross_section;
 
-   while( energy_grid_pt != union_energy_grid.end() )
-   {
-     raw_cross_section[index] =
-       adjoint_cross_section_functor( *energy_grid_pt );
-
-     ++energy_grid_pt;
-     ++index;
-   }
+   DataGen::evaluateOnGridInParallel( union_energy_grid,
+                                      raw_cross_section,
+                                      [&adjoint_cross_section_functor]( const double energy )
+                                      { return adjoint_cross_section_functor( energy ); } );
 
    std::vector<double>::iterator start =
      std::find_if( raw_cross_section.begin(),
@@ -63,6 +60,11 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
 {
   std::vector<double> raw_cross_section( union_energy_grid.size() );
 
+  // Copy the old cross section values and record the grid points that must
+  // still be evaluated
+  std::vector<double> new_energy_grid;
+  std::vector<unsigned> new_energy_grid_indices;
+
   std::list<double>::const_iterator energy_grid_pt = union_energy_grid.begin();
   std::list<double>::const_iterator old_energy_grid_pt =
     old_union_energy_grid.begin();
@@ -72,7 +74,8 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
 
   while( energy_grid_pt != union_energy_grid.end() )
   {
-    if ( *energy_grid_pt == *old_energy_grid_pt )
+    if ( old_energy_grid_pt != old_union_energy_grid.end() &&
+         *energy_grid_pt == *old_energy_grid_pt )
     {
       raw_cross_section[index] = old_cross_section[old_index];
    
@@ -81,14 +84,22 @@ void StandardAdjointElectronPhotonRelaxationDataGenerator::updateCrossSectionOnU
     }
     else
     {
-      raw_cross_section[index] =
-        adjoint_cross_section_functor( *energy_grid_pt );
+      new_energy_grid.push_back( *energy_grid_pt );
+      new_energy_grid_indices.push_back( index );
     }
 
     ++energy_grid_pt;
     ++index;
   }
 
+  // Evaluate the cross section at the new grid points
+  DataGen::evaluateInParallel( new_energy_grid.size(),
+                               [&]( const size_t i )
+                               {
+                                 raw_cross_section[new_energy_grid_indices[i]] =
+                                   adjoint_cross_section_functor( new_energy_grid[i] );
+                               } );
+
   std::vector<double>::iterator start =
     std::find_if( raw_cross_section.begin(),
                   raw_cross_section.end(),
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstParallelEvaluationHelpers.cpp
+//! \author Alex Robinson
+//! \brief  Parallel evaluation helper function unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "DataGen_ParallelEvaluationHelpers.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Evaluate a test function (with a cost that varies with the value)
+double evaluateTestFunction( const double value )
+{
+  double result = 0.0;
+
+  for( unsigned i = 0; i < 100u*(unsigned)(1.0 + value); ++i )
+    result += std::exp( -value*i*1e-3 );
+
+  return result;
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that a functor can be evaluated at every index
+FRENSIE_UNIT_TEST( ParallelEvaluationHelpers, evaluateInParallel )
+{
+  std::vector<double> expected_values( 1000 );
+
+  for( size_t i = 0; i < expected_values.size(); ++i )
+    expected_values[i] = evaluateTestFunction( i*1e-2 );
+
+  for( unsigned threads = 1u; threads <= 4u; ++threads )
+  {
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+    std::vector<double> values( expected_values.size(), 0.0 );
+
+    DataGen::evaluateInParallel( values.size(),
+                                 [&values]( const size_t i )
+                                 { values[i] = evaluateTestFunction( i*1e-2 ); } );
+
+    FRENSIE_CHECK_EQUAL( values, expected_values );
+  }
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the exception thrown at the lowest index is rethrown
+FRENSIE_UNIT_TEST( ParallelEvaluationHelpers, evaluateInParallel_exception )
+{
+  for( unsigned threads = 1u; threads <= 4u; ++threads )
+  {
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+    std::vector<int> evaluated( 100, 0 );
+    std::string message;
+
+    try{
+      DataGen::evaluateInParallel( evaluated.size(),
+                                   [&evaluated]( const size_t i )
+                                   {
+                                     evaluated[i] = 1;
+
+                                     if( i >= 10 && i % 10 == 0 )
+                                       throw std::runtime_error( std::to_string( i ) );
+                                   } );
+    }
+    catch( const std::runtime_error& exception )
+    {
+      message = exception.what();
+    }
+
+    FRENSIE_CHECK_EQUAL( message, "10" );
+    FRENSIE_CHECK_EQUAL( evaluated, std::vector<int>( 100, 1 ) );
+  }
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a functor can be evaluated on a grid
+FRENSIE_UNIT_TEST( ParallelEvaluationHelpers, evaluateOnGridInParallel )
+{
+  std::list<double> grid;
+
+  for( unsigned i = 0; i < 500u; ++i )
+    grid.push_back( i*2e-2 );
+
+  std::vector<double> expected_values;
+
+  for( auto&& value : grid )
+    expected_values.push_back( evaluateTestFunction( value ) );
+
+  for( unsigned threads = 1u; threads <= 4u; ++threads )
+  {
+    Utility::OpenMPProperties::setNumberOfThreads( threads );
+
+    std::vector<double> values;
+
+    DataGen::evaluateOnGridInParallel( grid, values, evaluateTestFunction );
+
+    FRENSIE_CHECK_EQUAL( values, expected_values );
+
+    values.clear();
+
+    DataGen::evaluateOnGridInParallel(
+                     std::vector<double>( grid.begin(), grid.end() ),
+                     values,
+                     evaluateTestFunction );
+
+    FRENSIE_CHECK_EQUAL( values, expected_values );
+  }
+
+  Utility::OpenMPProperties::setNumberOfThreads( 1u );
+}
+
+//---------------------------------------------------------------------------//
+// end tstParallelEvaluationHelpers.cpp
+//---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // Must be included first
 #include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Geometry{
 
@@ -115,6 +116,24 @@ auto InfiniteMediumModel::getCellVolume(
     return Utility::QuantityTraits<Volume>::zero();
 }
 
+// Get the number of dense cell indices
+size_t InfiniteMediumModel::getNumberOfCellIndices() const
+{
+  return 1;
+}
+
+// Get the dense index of a cell
+/*! \details The infinite medium cell always has index 0.
+ */
+size_t InfiniteMediumModel::getCellIndex( const EntityId cell ) const
+{
+  TEST_FOR_EXCEPTION( cell != d_cell,
+                      std::runtime_error,
+                      "Cell " << cell << " does not exist!" );
+
+  return 0;
+}
+
 // Create a raw, heap-allocated navigator
 InfiniteMediumNavigator* InfiniteMediumModel::createNavigatorAdvanced(
     const Navigator::AdvanceCompleteCallback& advance_complete_callback ) const
@@ -67,6 +67,12 @@ public:
   //! Get the cell volume
   Volume getCellVolume( const EntityId cell ) const override;
 
+  //! Get the number of dense cell indices
+  size_t getNumberOfCellIndices() const override;
+
+  //! Get the dense index of a cell
+  size_t getCellIndex( const EntityId cell ) const override;
+
   //! Create a raw, heap-allocated navigator
   InfiniteMediumNavigator* createNavigatorAdvanced(
                                     const Navigator::AdvanceCompleteCallback&
@@ -83,6 +83,9 @@ public:
   //! The cell id density map type
   typedef std::map<EntityId,Density> CellIdDensityMap;
 
+  //! The cell id temperature map type (temperatures in MeV)
+  typedef std::map<EntityId,double> CellIdTemperatureMap;
+
   //! The cell id array type
   typedef std::vector<EntityId> CellIdArray;
 
@@ -124,6 +127,10 @@ public:
   //! Get the cell densities
   virtual void getCellDensities( CellIdDensityMap& cell_density_map ) const = 0;
 
+  //! Get the cell temperatures
+  virtual void getCellTemperatures(
+                     CellIdTemperatureMap& cell_id_temperature_map ) const;
+
   //! Get the cell estimator data
   virtual void getCellEstimatorData(
                 CellEstimatorIdDataMap& cell_estimator_id_data_map ) const = 0;
@@ -140,6 +147,23 @@ public:
   //! Get the cell volume
   virtual Volume getCellVolume( const EntityId cell ) const = 0;
 
+  /*! Get the number of dense cell indices
+   *
+   * Every cell index returned by getCellIndex will be less than this value.
+   */
+  virtual size_t getNumberOfCellIndices() const = 0;
+
+  /*! Get the dense index of a cell
+   *
+   * Cell ids can be arbitrary (and sparse). The cell index is a dense
+   * alternative that can be used to address flat per-cell lookup tables.
+   * For a navigator created by this model,
+   * navigator.getCurrentCellIndex() must equal
+   * model.getCellIndex( navigator.getCurrentCell() ). A std::runtime_error
+   * (or class derived from it) must be thrown if the cell does not exist.
+   */
+  virtual size_t getCellIndex( const EntityId cell ) const = 0;
+
   //! The invalid cell id
   static EntityId invalidCellId();
 
@@ -196,6 +220,14 @@ inline bool Model::isAdvanced() const
   return false;
 }
 
+// Get the cell temperatures
+/*! \details Cells without a temperature will use the temperature of the
+ * data that is assigned to them. By default no cell temperatures are
+ * assigned.
+ */
+inline void Model::getCellTemperatures( CellIdTemperatureMap& ) const
+{ /* ... */ }
+
 // Create a raw, heap-allocated navigator
 inline Geometry::Navigator* Model::createNavigatorAdvanced() const
 {
@@ -24,6 +24,7 @@
 #include "Utility_UnitTraits.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_SerializationHelpers.hpp"
+#include "Utility_ThreadLocalMemoryPool.hpp"
 
 namespace Geometry{
 
@@ -62,6 +63,14 @@ public:
   virtual ~Navigator()
   { /* ... */ }
 
+  //! Allocate memory for a navigator from the thread-local memory pool
+  static void* operator new( size_t size )
+  { return Utility::ThreadLocalMemoryPool::allocate( size ); }
+
+  //! Return the memory of a navigator to the thread-local memory pool
+  static void operator delete( void* navigator, size_t size ) noexcept
+  { Utility::ThreadLocalMemoryPool::deallocate( navigator, size ); }
+
   /*! Get the location of a point w.r.t. a given cell
    *
    * The direction can be used to help determine if the point is inside or
@@ -217,6 +226,14 @@ public:
    */
   virtual EntityId getCurrentCell() const = 0;
 
+  /*! Get the dense index of the cell that contains the internal ray
+   *
+   * The index will be the one returned by Model::getCellIndex for the
+   * current cell. A std::runtime_error (or class derived from it) must be
+   * thrown if an error occurs.
+   */
+  virtual size_t getCurrentCellIndex() const = 0;
+
   /*! Get the distance from the internal ray pos. to the nearest boundary in all directions
    *
    * A std::runtime_error (or class derived from it) must be thrown if a ray
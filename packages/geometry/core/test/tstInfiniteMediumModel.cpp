@@ -187,6 +187,17 @@ FRENSIE_UNIT_TEST( InfiniteMediumModel, getCellVolume )
                        Utility::QuantityTraits<Geometry::Model::Volume>::inf() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dense cell indices can be returned
+FRENSIE_UNIT_TEST( InfiniteMediumModel, getCellIndex )
+{
+  Geometry::InfiniteMediumModel model( 2 );
+
+  FRENSIE_CHECK_EQUAL( model.getNumberOfCellIndices(), 1 );
+  FRENSIE_CHECK_EQUAL( model.getCellIndex( 2 ), 0 );
+  FRENSIE_CHECK_THROW( model.getCellIndex( 1 ), std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a navigator can be created
 FRENSIE_UNIT_TEST( InfiniteMediumModel, createNavigatorAdvanced )
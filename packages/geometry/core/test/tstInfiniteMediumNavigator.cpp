@@ -190,6 +190,22 @@ FRENSIE_UNIT_TEST( InfiniteMediumNavigator, setState )
   FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 1 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dense index of the current cell can be returned
+FRENSIE_UNIT_TEST( InfiniteMediumNavigator, getCurrentCellIndex )
+{
+  std::unique_ptr<Geometry::Navigator>
+    navigator( new Geometry::InfiniteMediumNavigator( 2 ) );
+
+  navigator->setState( 0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0*cgs::centimeter,
+                       0.0, 0.0, 1.0 );
+
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(), 0 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the distance to closest boundary
 FRENSIE_UNIT_TEST( InfiniteMediumNavigator, getDistanceToClosestBoundary )
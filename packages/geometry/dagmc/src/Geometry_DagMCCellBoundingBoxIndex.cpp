@@ -0,0 +1,427 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellBoundingBoxIndex.cpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell bounding box index class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellBoundingBoxIndex.hpp"
+#include "Utility_MOABException.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Geometry{
+
+// Initialize static member data
+const double DagMCCellBoundingBoxIndex::s_relative_padding = 1e-6;
+const size_t DagMCCellBoundingBoxIndex::s_max_voxels_per_dimension = 128;
+const size_t DagMCCellBoundingBoxIndex::s_voxels_per_cell = 4;
+
+// Constructor
+/*! \details The DagMC OBB trees must be initialized before the index is
+ * constructed.
+ */
+DagMCCellBoundingBoxIndex::DagMCCellBoundingBoxIndex(
+                                        const moab::DagMC* dagmc_instance,
+                                        const DagMCCellHandler& cell_handler )
+  : d_cell_handles( cell_handler.begin(), cell_handler.end() ),
+    d_voxel_cell_offsets(),
+    d_voxel_cells(),
+    d_unbounded_cells(),
+    d_cell_neighbor_offsets(),
+    d_cell_neighbors()
+{
+  // Make sure the DagMC instance is valid
+  testPrecondition( dagmc_instance != NULL );
+
+  moab::DagMC* nonconst_dagmc_instance =
+    const_cast<moab::DagMC*>( dagmc_instance );
+
+  std::vector<double> lower_bounds, upper_bounds;
+  std::vector<unsigned char> bounded_cells;
+
+  this->calculateCellBoundingBoxes( *nonconst_dagmc_instance,
+                                    lower_bounds,
+                                    upper_bounds,
+                                    bounded_cells );
+
+  this->constructGrid( lower_bounds, upper_bounds, bounded_cells );
+
+  this->constructNeighborLists( *nonconst_dagmc_instance, cell_handler );
+}
+
+// Get the number of cells
+size_t DagMCCellBoundingBoxIndex::getNumberOfCells() const
+{
+  return d_cell_handles.size();
+}
+
+// Get the cell handle associated with a dense cell index
+moab::EntityHandle DagMCCellBoundingBoxIndex::getCellHandle(
+                                               const size_t cell_index ) const
+{
+  // Make sure the cell index is valid
+  testPrecondition( cell_index < d_cell_handles.size() );
+
+  return d_cell_handles[cell_index];
+}
+
+// Get the number of grid voxels
+size_t DagMCCellBoundingBoxIndex::getNumberOfVoxels() const
+{
+  return d_voxel_cell_offsets.size() - 1;
+}
+
+// Get the number of cells that do not have a bounding box
+size_t DagMCCellBoundingBoxIndex::getNumberOfUnboundedCells() const
+{
+  return d_unbounded_cells.size();
+}
+
+// Get the cells that could contain a point
+/*! \details If the point is outside of the grid only the cells that do not
+ * have a bounding box will be returned.
+ */
+Utility::ArrayView<const size_t> DagMCCellBoundingBoxIndex::getCandidateCells(
+                                            const double position[3] ) const
+{
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    if( !(position[d] >= d_grid_lower_bounds[d] &&
+          position[d] <= d_grid_upper_bounds[d]) )
+    {
+      return Utility::ArrayView<const size_t>( d_unbounded_cells.data(),
+                                               d_unbounded_cells.size() );
+    }
+  }
+
+  const size_t voxel_index = this->calculateVoxelIndex( position[0], 0 ) +
+    d_grid_voxels[0]*(this->calculateVoxelIndex( position[1], 1 ) +
+                      d_grid_voxels[1]*this->calculateVoxelIndex( position[2], 2 ));
+
+  return Utility::ArrayView<const size_t>(
+                      d_voxel_cells.data() + d_voxel_cell_offsets[voxel_index],
+                      d_voxel_cells.data() + d_voxel_cell_offsets[voxel_index+1] );
+}
+
+// Get the cells that share a surface with a cell
+Utility::ArrayView<const size_t> DagMCCellBoundingBoxIndex::getNeighborCells(
+                                              const size_t cell_index ) const
+{
+  // Make sure the cell index is valid
+  testPrecondition( cell_index < d_cell_handles.size() );
+
+  return Utility::ArrayView<const size_t>(
+                   d_cell_neighbors.data() + d_cell_neighbor_offsets[cell_index],
+                   d_cell_neighbors.data() + d_cell_neighbor_offsets[cell_index+1] );
+}
+
+// Calculate the cell bounding boxes
+/*! \details The implicit complement and any cell whose bounding box cannot
+ * be determined will be treated as an unbounded cell.
+ */
+void DagMCCellBoundingBoxIndex::calculateCellBoundingBoxes(
+                                   moab::DagMC& dagmc_instance,
+                                   std::vector<double>& lower_bounds,
+                                   std::vector<double>& upper_bounds,
+                                   std::vector<unsigned char>& bounded_cells )
+{
+  lower_bounds.resize( 3*d_cell_handles.size() );
+  upper_bounds.resize( 3*d_cell_handles.size() );
+  bounded_cells.resize( d_cell_handles.size(), false );
+
+  for( size_t i = 0; i < d_cell_handles.size(); ++i )
+  {
+    if( dagmc_instance.is_implicit_complement( d_cell_handles[i] ) )
+      continue;
+
+    moab::ErrorCode return_value =
+      dagmc_instance.getobb( d_cell_handles[i],
+                             &lower_bounds[3*i],
+                             &upper_bounds[3*i] );
+
+    if( return_value != moab::MB_SUCCESS )
+      continue;
+
+    bool valid_bounds = true;
+
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      if( !std::isfinite( lower_bounds[3*i+d] ) ||
+          !std::isfinite( upper_bounds[3*i+d] ) ||
+          lower_bounds[3*i+d] > upper_bounds[3*i+d] )
+      {
+        valid_bounds = false;
+      }
+    }
+
+    bounded_cells[i] = valid_bounds;
+  }
+}
+
+// Construct the grid
+/*! \details The grid covers the union of the cell bounding boxes. The number
+ * of voxels along each dimension is chosen so that the voxels are roughly
+ * cubic and so that there are a few voxels per bounded cell.
+ */
+void DagMCCellBoundingBoxIndex::constructGrid(
+                              const std::vector<double>& lower_bounds,
+                              const std::vector<double>& upper_bounds,
+                              const std::vector<unsigned char>& bounded_cells )
+{
+  size_t number_of_bounded_cells = 0;
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    d_grid_lower_bounds[d] = std::numeric_limits<double>::max();
+    d_grid_upper_bounds[d] = -std::numeric_limits<double>::max();
+  }
+
+  for( size_t i = 0; i < d_cell_handles.size(); ++i )
+  {
+    if( bounded_cells[i] )
+    {
+      ++number_of_bounded_cells;
+
+      for( unsigned d = 0; d < 3; ++d )
+      {
+        d_grid_lower_bounds[d] =
+          std::min( d_grid_lower_bounds[d], lower_bounds[3*i+d] );
+
+        d_grid_upper_bounds[d] =
+          std::max( d_grid_upper_bounds[d], upper_bounds[3*i+d] );
+      }
+    }
+    else
+      d_unbounded_cells.push_back( i );
+  }
+
+  // No cells have a bounding box - every point is outside of the grid
+  if( number_of_bounded_cells == 0 )
+  {
+    for( unsigned d = 0; d < 3; ++d )
+    {
+      d_grid_lower_bounds[d] = 0.0;
+      d_grid_upper_bounds[d] = -1.0;
+      d_grid_inverse_voxel_widths[d] = 0.0;
+      d_grid_voxels[d] = 1;
+    }
+
+    d_voxel_cell_offsets.assign( 2, 0 );
+
+    return;
+  }
+
+  // Pad the grid so that points on the model boundary are inside of it
+  double padding = 0.0;
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    padding = std::max( padding,
+                        d_grid_upper_bounds[d] - d_grid_lower_bounds[d] );
+  }
+
+  padding = std::max( padding*s_relative_padding, s_relative_padding );
+
+  double extents[3];
+  double grid_volume = 1.0;
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    d_grid_lower_bounds[d] -= padding;
+    d_grid_upper_bounds[d] += padding;
+
+    extents[d] = d_grid_upper_bounds[d] - d_grid_lower_bounds[d];
+
+    grid_volume *= extents[d];
+  }
+
+  // Choose the number of voxels along each dimension
+  const double target_number_of_voxels =
+    std::min( (double)(s_voxels_per_cell*number_of_bounded_cells),
+              std::pow( (double)s_max_voxels_per_dimension, 3 ) );
+
+  const double voxel_width =
+    std::cbrt( grid_volume/target_number_of_voxels );
+
+  size_t number_of_voxels = 1;
+
+  for( unsigned d = 0; d < 3; ++d )
+  {
+    d_grid_voxels[d] =
+      std::max( (size_t)1,
+                std::min( s_max_voxels_per_dimension,
+                          (size_t)std::ceil( extents[d]/voxel_width ) ) );
+
+    d_grid_inverse_voxel_widths[d] = d_grid_voxels[d]/extents[d];
+
+    number_of_voxels *= d_grid_voxels[d];
+  }
+
+  // Count the cells that overlap each voxel
+  std::vector<size_t> voxel_cell_counts( number_of_voxels,
+                                         d_unbounded_cells.size() );
+
+  std::vector<size_t> cell_voxel_bounds( 6*d_cell_handles.size(), 0 );
+
+  for( size_t i = 0; i < d_cell_handles.size(); ++i )
+  {
+    if( bounded_cells[i] )
+    {
+      size_t* voxel_bounds = &cell_voxel_bounds[6*i];
+
+      for( unsigned d = 0; d < 3; ++d )
+      {
+        voxel_bounds[d] =
+          this->calculateVoxelIndex( lower_bounds[3*i+d] - padding, d );
+
+        voxel_bounds[d+3] =
+          this->calculateVoxelIndex( upper_bounds[3*i+d] + padding, d );
+      }
+
+      for( size_t k = voxel_bounds[2]; k <= voxel_bounds[5]; ++k )
+      {
+        for( size_t j = voxel_bounds[1]; j <= voxel_bounds[4]; ++j )
+        {
+          for( size_t l = voxel_bounds[0]; l <= voxel_bounds[3]; ++l )
+            ++voxel_cell_counts[l + d_grid_voxels[0]*(j + d_grid_voxels[1]*k)];
+        }
+      }
+    }
+  }
+
+  // Calculate the voxel offsets
+  d_voxel_cell_offsets.resize( number_of_voxels+1 );
+  d_voxel_cell_offsets[0] = 0;
+
+  for( size_t v = 0; v < number_of_voxels; ++v )
+  {
+    d_voxel_cell_offsets[v+1] =
+      d_voxel_cell_offsets[v] + voxel_cell_counts[v];
+  }
+
+  // Fill the voxel cell lists (cells are added in ascending order)
+  d_voxel_cells.resize( d_voxel_cell_offsets.back() );
+
+  std::vector<size_t> voxel_fill_positions( d_voxel_cell_offsets.begin(),
+                                            d_voxel_cell_offsets.end()-1 );
+
+  for( size_t i = 0; i < d_cell_handles.size(); ++i )
+  {
+    if( bounded_cells[i] )
+    {
+      const size_t* voxel_bounds = &cell_voxel_bounds[6*i];
+
+      for( size_t k = voxel_bounds[2]; k <= voxel_bounds[5]; ++k )
+      {
+        for( size_t j = voxel_bounds[1]; j <= voxel_bounds[4]; ++j )
+        {
+          for( size_t l = voxel_bounds[0]; l <= voxel_bounds[3]; ++l )
+          {
+            const size_t v = l + d_grid_voxels[0]*(j + d_grid_voxels[1]*k);
+
+            d_voxel_cells[voxel_fill_positions[v]++] = i;
+          }
+        }
+      }
+    }
+    else
+    {
+      for( size_t v = 0; v < number_of_voxels; ++v )
+        d_voxel_cells[voxel_fill_positions[v]++] = i;
+    }
+  }
+}
+
+// Construct the cell neighbor lists
+/*! \details Two cells are neighbors if they share a surface.
+ */
+void DagMCCellBoundingBoxIndex::constructNeighborLists(
+                                         moab::DagMC& dagmc_instance,
+                                         const DagMCCellHandler& cell_handler )
+{
+  moab::Interface* moab_instance = dagmc_instance.moab_instance();
+
+  d_cell_neighbor_offsets.resize( d_cell_handles.size()+1 );
+  d_cell_neighbor_offsets[0] = 0;
+
+  std::vector<moab::EntityHandle> surface_handles, surface_cell_handles;
+  std::vector<size_t> neighbors;
+
+  for( size_t i = 0; i < d_cell_handles.size(); ++i )
+  {
+    surface_handles.clear();
+    neighbors.clear();
+
+    moab::ErrorCode return_value =
+      moab_instance->get_child_meshsets( d_cell_handles[i], surface_handles );
+
+    TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                        Utility::MOABException,
+                        moab::ErrorCodeStr[return_value] );
+
+    for( size_t j = 0; j < surface_handles.size(); ++j )
+    {
+      surface_cell_handles.clear();
+
+      return_value = moab_instance->get_parent_meshsets( surface_handles[j],
+                                                         surface_cell_handles );
+
+      TEST_FOR_EXCEPTION( return_value != moab::MB_SUCCESS,
+                          Utility::MOABException,
+                          moab::ErrorCodeStr[return_value] );
+
+      for( size_t k = 0; k < surface_cell_handles.size(); ++k )
+      {
+        if( surface_cell_handles[k] != d_cell_handles[i] &&
+            cell_handler.doesCellHandleExist( surface_cell_handles[k] ) )
+        {
+          neighbors.push_back(
+                      cell_handler.getCellIndex( surface_cell_handles[k] ) );
+        }
+      }
+    }
+
+    std::sort( neighbors.begin(), neighbors.end() );
+
+    neighbors.erase( std::unique( neighbors.begin(), neighbors.end() ),
+                     neighbors.end() );
+
+    d_cell_neighbors.insert( d_cell_neighbors.end(),
+                             neighbors.begin(),
+                             neighbors.end() );
+
+    d_cell_neighbor_offsets[i+1] = d_cell_neighbors.size();
+  }
+}
+
+// Calculate the voxel index along a dimension
+/*! \details Coordinates outside of the grid will be clamped to the grid.
+ */
+size_t DagMCCellBoundingBoxIndex::calculateVoxelIndex(
+                                          const double coordinate,
+                                          const unsigned dimension ) const
+{
+  const double raw_index = (coordinate - d_grid_lower_bounds[dimension])*
+    d_grid_inverse_voxel_widths[dimension];
+
+  if( raw_index <= 0.0 )
+    return 0;
+  else if( raw_index >= d_grid_voxels[dimension] )
+    return d_grid_voxels[dimension] - 1;
+  else
+    return (size_t)raw_index;
+}
+
+} // end Geometry namespace
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellBoundingBoxIndex.cpp
+//---------------------------------------------------------------------------//
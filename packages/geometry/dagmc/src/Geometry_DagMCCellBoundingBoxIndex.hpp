@@ -0,0 +1,138 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Geometry_DagMCCellBoundingBoxIndex.hpp
+//! \author Alex Robinson
+//! \brief  The DagMC cell bounding box index class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef GEOMETRY_DAGMC_CELL_BOUNDING_BOX_INDEX_HPP
+#define GEOMETRY_DAGMC_CELL_BOUNDING_BOX_INDEX_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Moab Includes
+#include <DagMC.hpp>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellHandler.hpp"
+#include "Utility_ArrayView.hpp"
+
+namespace Geometry{
+
+/*! The DagMC cell bounding box index class
+ * \details This class is used to reduce the number of cells that must be
+ * tested when searching for the cell that contains a point. The axis-aligned
+ * bounding box of every cell is placed in a uniform grid that covers the
+ * model. A point can only be inside of the cells whose bounding boxes
+ * overlap the grid voxel that contains the point. Cells that do not have a
+ * bounding box (e.g. the implicit complement) are candidates for every point.
+ * The cells that share a surface with each cell are also stored so that
+ * the neighbors of a recently found cell can be tested first. Cells are
+ * referred to by their dense cell index (see
+ * Geometry::DagMCCellHandler::getCellIndex). The candidate cells are always
+ * returned in ascending cell index order.
+ */
+class DagMCCellBoundingBoxIndex
+{
+
+public:
+
+  //! Constructor
+  DagMCCellBoundingBoxIndex( const moab::DagMC* dagmc_instance,
+                             const DagMCCellHandler& cell_handler );
+
+  //! Destructor
+  ~DagMCCellBoundingBoxIndex()
+  { /* ... */ }
+
+  //! Get the number of cells
+  size_t getNumberOfCells() const;
+
+  //! Get the cell handle associated with a dense cell index
+  moab::EntityHandle getCellHandle( const size_t cell_index ) const;
+
+  //! Get the number of grid voxels
+  size_t getNumberOfVoxels() const;
+
+  //! Get the number of cells that do not have a bounding box
+  size_t getNumberOfUnboundedCells() const;
+
+  //! Get the cells that could contain a point
+  Utility::ArrayView<const size_t> getCandidateCells(
+                                           const double position[3] ) const;
+
+  //! Get the cells that share a surface with a cell
+  Utility::ArrayView<const size_t> getNeighborCells(
+                                              const size_t cell_index ) const;
+
+private:
+
+  // Calculate the cell bounding boxes
+  void calculateCellBoundingBoxes(
+                              moab::DagMC& dagmc_instance,
+                              std::vector<double>& lower_bounds,
+                              std::vector<double>& upper_bounds,
+                              std::vector<unsigned char>& bounded_cells );
+
+  // Construct the grid
+  void constructGrid( const std::vector<double>& lower_bounds,
+                      const std::vector<double>& upper_bounds,
+                      const std::vector<unsigned char>& bounded_cells );
+
+  // Construct the cell neighbor lists
+  void constructNeighborLists( moab::DagMC& dagmc_instance,
+                               const DagMCCellHandler& cell_handler );
+
+  // Calculate the voxel index along a dimension
+  size_t calculateVoxelIndex( const double coordinate,
+                              const unsigned dimension ) const;
+
+  // The padding that is added to every bounding box (relative to the model)
+  static const double s_relative_padding;
+
+  // The maximum number of voxels along a dimension
+  static const size_t s_max_voxels_per_dimension;
+
+  // The target number of voxels per bounded cell
+  static const size_t s_voxels_per_cell;
+
+  // The cell handles (indexed by dense cell index)
+  std::vector<moab::EntityHandle> d_cell_handles;
+
+  // The lower bounds of the grid
+  double d_grid_lower_bounds[3];
+
+  // The upper bounds of the grid
+  double d_grid_upper_bounds[3];
+
+  // The inverse voxel widths
+  double d_grid_inverse_voxel_widths[3];
+
+  // The number of voxels along each dimension
+  size_t d_grid_voxels[3];
+
+  // The cell list offsets of each voxel
+  std::vector<size_t> d_voxel_cell_offsets;
+
+  // The cells (dense indices) that overlap each voxel
+  std::vector<size_t> d_voxel_cells;
+
+  // The cells (dense indices) that do not have a bounding box
+  std::vector<size_t> d_unbounded_cells;
+
+  // The neighbor list offsets of each cell
+  std::vector<size_t> d_cell_neighbor_offsets;
+
+  // The neighbors (dense indices) of each cell
+  std::vector<size_t> d_cell_neighbors;
+};
+
+} // end Geometry namespace
+
+#endif // end GEOMETRY_DAGMC_CELL_BOUNDING_BOX_INDEX_HPP
+
+//---------------------------------------------------------------------------//
+// end Geometry_DagMCCellBoundingBoxIndex.hpp
+//---------------------------------------------------------------------------//
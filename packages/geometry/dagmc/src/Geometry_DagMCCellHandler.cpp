@@ -60,6 +60,13 @@ bool DagMCCellHandler::doesCellHandleExist(
   return this->doesEntityHandleExist( cell_handle );
 }
 
+// Get the dense cell index from a cell handle
+size_t DagMCCellHandler::getCellIndex(
+                                  const moab::EntityHandle cell_handle ) const
+{
+  return this->getEntityIndex( cell_handle );
+}
+
 } // end Geometry namespace
 
 //---------------------------------------------------------------------------//
@@ -44,6 +44,9 @@ public:
   virtual bool doesCellHandleExist(
                                   const moab::EntityHandle cell_handle ) const;
 
+  //! Get the dense cell index from a cell handle
+  size_t getCellIndex( const moab::EntityHandle cell_handle ) const;
+
   //! Get the cell id from a cell handle
   virtual EntityId getCellId(
                               const moab::EntityHandle cell_handle ) const = 0;
@@ -47,6 +47,20 @@ bool DagMCEntityHandler::doesEntityHandleExist(
   return d_entities.find( entity_handle ) != d_entities.end();
 }
 
+// Get the dense index of the entity (position in the entity range)
+/*! \details The index will be in [0,number of entities). The moab::Range
+ * stores its handles in sorted, run-length encoded blocks so this is
+ * considerably cheaper than a map lookup.
+ */
+size_t DagMCEntityHandler::getEntityIndex(
+                                 const moab::EntityHandle entity_handle ) const
+{
+  // Make sure the entity exists
+  testPrecondition( this->doesEntityHandleExist( entity_handle ) );
+
+  return d_entities.index( entity_handle );
+}
+
 // Get the beginning const iterator
 moab::Range::const_iterator DagMCEntityHandler::begin() const
 {
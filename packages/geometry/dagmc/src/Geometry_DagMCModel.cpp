@@ -21,6 +21,7 @@
 #include "Utility_3DCartesianVectorHelpers.hpp"
 #include "Utility_MOABException.hpp"
 #include "Utility_FromStringTraits.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
@@ -37,6 +38,7 @@ DagMCModel::DagMCModel( const DagMCModelProperties& model_properties,
   : d_dagmc( NULL ),
     d_cell_handler(),
     d_surface_handler(),
+    d_cell_bounding_box_index(),
     d_termination_cells(),
     d_reflecting_surfaces(),
     d_model_properties( new DagMCModelProperties( model_properties ) )
@@ -100,6 +102,14 @@ void DagMCModel::initialize( const bool suppress_dagmc_output )
   EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
                            "Unable to construct the entity handlers!" );
 
+  // Construct the cell bounding box index (used for point location)
+  try{
+    this->constructCellBoundingBoxIndex();
+  }
+  EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                           "Unable to construct the cell bounding box "
+                           "index!" );
+
   // Extract the termination cells
   try{
     this->extractTerminationCells();
@@ -269,6 +279,19 @@ void DagMCModel::constructEntityHandlers()
   }
 }
 
+// Construct the cell bounding box index
+void DagMCModel::constructCellBoundingBoxIndex()
+{
+  try{
+    d_cell_bounding_box_index.reset(
+             new DagMCCellBoundingBoxIndex( d_dagmc, *d_cell_handler ) );
+  }
+  EXCEPTION_CATCH_RETHROW_AS( Utility::MOABException,
+                              InvalidDagMCGeometry,
+                              "Unable to set up the cell bounding box "
+                              "index!" );
+}
+
 // Extract the termination cells
 void DagMCModel::extractTerminationCells()
 {
@@ -483,6 +506,50 @@ void DagMCModel::getCellDensities( CellIdDensityMap& cell_id_density_map ) const
   }
 }
 
+// Get the cell temperatures
+/*! \details The temperatures must be specified in Kelvin in the model
+ * (e.g. temperature_600). They will be converted to MeV.
+ */
+void DagMCModel::getCellTemperatures(
+                        CellIdTemperatureMap& cell_id_temperature_map ) const
+{
+  // Load a map of the cell ids and temperature names
+  CellIdPropertyValuesMap cell_id_temperature_name_map;
+
+  try{
+    this->getCellPropertyValues(
+                              d_model_properties->getTemperaturePropertyName(),
+                              cell_id_temperature_name_map );
+  }
+  EXCEPTION_CATCH_RETHROW( InvalidDagMCGeometry,
+                           "Unable to parse the cell temperatures!" );
+
+  CellIdPropertyValuesMap::const_iterator cell_it =
+    cell_id_temperature_name_map.begin();
+
+  while( cell_it != cell_id_temperature_name_map.end() )
+  {
+    TEST_FOR_EXCEPTION( cell_it->second.size() > 1,
+                        InvalidDagMCGeometry,
+                        "Cell " << cell_it->first << " has multiple "
+                        "temperatures assigned!" );
+
+    TEST_FOR_EXCEPTION(
+                  cell_it->second.front().find_first_not_of( ".0123456789" ) <
+                  cell_it->second.front().size(),
+                  InvalidDagMCGeometry,
+                  "Cell " << cell_it->first << " has an invalid "
+                  "temperature (" << cell_it->second.front() << ")! " );
+
+    // Convert K to MeV
+    cell_id_temperature_map[cell_it->first] =
+      Utility::fromString<double>( cell_it->second.front() )*
+      Utility::PhysicalConstants::boltzmann_constant;
+
+    ++cell_it;
+  }
+}
+
 // Get the cell estimator data
 void DagMCModel::getCellEstimatorData(
                           CellEstimatorIdDataMap& estimator_id_data_map ) const
@@ -673,6 +740,26 @@ auto DagMCModel::getCellVolume( const EntityId cell_id ) const -> Volume
   return Volume::from_value(raw_volume);
 }
 
+// Get the number of dense cell indices
+size_t DagMCModel::getNumberOfCellIndices() const
+{
+  return d_cell_handler->getNumberOfCells();
+}
+
+// Get the dense index of a cell
+/*! \details The cell index is the position of the cell handle in the
+ * (sorted) range of cell handles stored by the cell handler.
+ */
+size_t DagMCModel::getCellIndex( const EntityId cell_id ) const
+{
+  TEST_FOR_EXCEPTION( !this->doesCellExist( cell_id ),
+                      InvalidDagMCGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  return d_cell_handler->getCellIndex(
+                                  d_cell_handler->getCellHandle( cell_id ) );
+}
+
 // Get the surface area
 auto DagMCModel::getSurfaceArea( const EntityId surface_id ) const -> Area
 {
@@ -960,6 +1047,13 @@ const Geometry::DagMCSurfaceHandler& DagMCModel::getSurfaceHandler() const
   return *d_surface_handler;
 }
 
+// Return the cell bounding box index
+const Geometry::DagMCCellBoundingBoxIndex&
+DagMCModel::getCellBoundingBoxIndex() const
+{
+  return *d_cell_bounding_box_index;
+}
+
 // Return the reflecting surfaces
 const DagMCNavigator::ReflectingSurfaceIdHandleMap&
 DagMCModel::getReflectingSurfaceIdHandleMap() const
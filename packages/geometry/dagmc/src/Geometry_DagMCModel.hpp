@@ -22,6 +22,7 @@
 #include "Geometry_DagMCModelProperties.hpp"
 #include "Geometry_DagMCCellHandler.hpp"
 #include "Geometry_DagMCSurfaceHandler.hpp"
+#include "Geometry_DagMCCellBoundingBoxIndex.hpp"
 #include "Geometry_DagMCNavigator.hpp"
 #include "Geometry_PointLocation.hpp"
 #include "Geometry_AdvancedModel.hpp"
@@ -77,6 +78,10 @@ public:
   //! Get the cell densities
   void getCellDensities( CellIdDensityMap& cell_id_density_map ) const override;
 
+  //! Get the cell temperatures
+  void getCellTemperatures(
+          CellIdTemperatureMap& cell_id_temperature_map ) const override;
+
   //! Get the cell estimator data
   void getCellEstimatorData( CellEstimatorIdDataMap& estimator_id_data_map ) const override;
 
@@ -92,6 +97,12 @@ public:
   //! Get the cell volume
   Volume getCellVolume( const EntityId cell_id ) const override;
 
+  //! Get the number of dense cell indices
+  size_t getNumberOfCellIndices() const override;
+
+  //! Get the dense index of a cell
+  size_t getCellIndex( const EntityId cell_id ) const override;
+
   //! Get the problem surfaces
   void getSurfaces( SurfaceIdSet& surface_set ) const override;
 
@@ -156,6 +167,9 @@ private:
   // Construct the entity handlers
   void constructEntityHandlers();
 
+  // Construct the cell bounding box index
+  void constructCellBoundingBoxIndex();
+
   // Extract the termination cells
   void extractTerminationCells();
 
@@ -210,6 +224,9 @@ private:
   //! Return the surface handler
   const Geometry::DagMCSurfaceHandler& getSurfaceHandler() const;
 
+  //! Return the cell bounding box index
+  const Geometry::DagMCCellBoundingBoxIndex& getCellBoundingBoxIndex() const;
+
   //! Return the reflecting surfaces
   const DagMCNavigator::ReflectingSurfaceIdHandleMap&
   getReflectingSurfaceIdHandleMap() const;
@@ -245,6 +262,9 @@ private:
   // The DagMC surface handle
   std::unique_ptr<const Geometry::DagMCSurfaceHandler> d_surface_handler;
 
+  // The DagMC cell bounding box index
+  std::unique_ptr<const Geometry::DagMCCellBoundingBoxIndex> d_cell_bounding_box_index;
+
   // The termination cells
   CellIdSet d_termination_cells;
 
@@ -35,6 +35,7 @@ DagMCModelProperties::DagMCModelProperties(
     d_reflecting_surface_property( "reflecting.surface" ),
     d_material_property( "material" ),
     d_density_property( "density" ),
+    d_temperature_property( "temperature" ),
     d_estimator_property( "estimator" ),
     d_surface_current_name( "surface.current" ),
     d_surface_flux_name( "surface.flux" ),
@@ -175,6 +176,23 @@ const std::string& DagMCModelProperties::getDensityPropertyName() const
   return d_density_property;
 }
 
+// Set the temperature property name
+void DagMCModelProperties::setTemperaturePropertyName( const std::string& name )
+{
+  // Make sure that the name is valid
+  TEST_FOR_EXCEPTION( name.find( "_" ) < name.size(),
+                      std::runtime_error,
+                      "The \"_\" character is reserved!" );
+
+  d_temperature_property = name;
+}
+
+// Get the temperature property name
+const std::string& DagMCModelProperties::getTemperaturePropertyName() const
+{
+  return d_temperature_property;
+}
+
 // Set the estimator property name
 void DagMCModelProperties::setEstimatorPropertyName( const std::string& name )
 {
@@ -196,13 +214,14 @@ const std::string& DagMCModelProperties::getEstimatorPropertyName() const
 void DagMCModelProperties::getPropertyNames( std::vector<std::string>& properties ) const
 {
   properties.clear();
-  properties.resize( 5 );
+  properties.resize( 6 );
 
   properties[0] = d_termination_cell_property;
   properties[1] = d_reflecting_surface_property;
   properties[2] = d_material_property;
   properties[3] = d_density_property;
   properties[4] = d_estimator_property;
+  properties[5] = d_temperature_property;
 }
 
 // Set the surface current name
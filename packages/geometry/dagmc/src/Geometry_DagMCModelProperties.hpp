@@ -86,6 +86,12 @@ public:
   //! Get the density property name
   const std::string& getDensityPropertyName() const;
 
+  //! Set the temperature property name
+  void setTemperaturePropertyName( const std::string& name );
+
+  //! Get the temperature property name
+  const std::string& getTemperaturePropertyName() const;
+
   //! Set the estimator property name
   void setEstimatorPropertyName( const std::string& name );
 
@@ -221,6 +227,9 @@ private:
   // The density property name
   std::string d_density_property;
 
+  // The temperature property name
+  std::string d_temperature_property;
+
   // The estimator property name
   std::string d_estimator_property;
 
@@ -285,6 +294,7 @@ void DagMCModelProperties::save( Archive& ar, const unsigned version ) const
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photon_name );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_neutron_name );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_electron_name );
+  ar & BOOST_SERIALIZATION_NVP( d_temperature_property );
 }
 
 // Load the model from an archive
@@ -322,11 +332,14 @@ void DagMCModelProperties::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_photon_name );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_neutron_name );
   ar & BOOST_SERIALIZATION_NVP( d_adjoint_electron_name );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_temperature_property );
 }
 
 } // end Geometry namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( DagMCModelProperties, Geometry, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( DagMCModelProperties, Geometry, 1 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( DagMCModelProperties, Geometry );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Geometry, DagMCModelProperties );
 
@@ -8,6 +8,8 @@
 
 // Std Lib Includes
 #include <sstream>
+#include <algorithm>
+#include <limits>
 
 // FRENSIE Includes
 #include "Geometry_DagMCNavigator.hpp"
@@ -25,6 +27,7 @@ const double DagMCNavigator::s_boundary_tol = 1e-5;
 
 // Default constructor
 DagMCNavigator::DagMCNavigator()
+  : d_last_found_cell_index( std::numeric_limits<size_t>::max() )
 { /* ... */ }
 
 // Constructor
@@ -33,7 +36,8 @@ DagMCNavigator::DagMCNavigator(
           const Navigator::AdvanceCompleteCallback& advance_complete_callback )
   : Navigator( advance_complete_callback ),
     d_dagmc_model( dagmc_model ),
-    d_internal_ray()
+    d_internal_ray(),
+    d_last_found_cell_index( std::numeric_limits<size_t>::max() )
 {
   // Make sure that the dagmc instance is valid
   testPrecondition( dagmc_model.get() );
@@ -45,7 +49,8 @@ DagMCNavigator::DagMCNavigator(
 DagMCNavigator::DagMCNavigator( const DagMCNavigator& other )
   : Navigator( other ),
     d_dagmc_model( other.d_dagmc_model ),
-    d_internal_ray( other.d_internal_ray )
+    d_internal_ray( other.d_internal_ray ),
+    d_last_found_cell_index( other.d_last_found_cell_index )
 { /* ... */ }
 
 // Get the point location w.r.t. a given cell
@@ -269,6 +274,15 @@ auto DagMCNavigator::getCurrentCell() const -> EntityId
   return d_dagmc_model->getCellHandler().getCellId( d_internal_ray.getCurrentCell() );
 }
 
+// Get the dense index of the cell that contains the internal ray
+size_t DagMCNavigator::getCurrentCellIndex() const
+{
+  // Make sure that the ray is set
+  testPrecondition( this->isStateSet() );
+
+  return d_dagmc_model->getCellHandler().getCellIndex( d_internal_ray.getCurrentCell() );
+}
+
 // Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
 auto DagMCNavigator::getDistanceToClosestBoundary() -> Length
 {
@@ -546,7 +560,106 @@ moab::EntityHandle DagMCNavigator::getBoundaryCellHandle(
   return boundary_cell_handle;
 }
 
+// Check if the ray is inside of a cell
+bool DagMCNavigator::isRayInsideCellHandle(
+                                 const Length position[3],
+                                 const double direction[3],
+                                 const moab::EntityHandle cell_handle ) const
+{
+  PointLocation test_point_location;
+
+  try{
+    test_point_location =
+      this->getPointLocationWithCellHandle( position,
+                                            direction,
+                                            cell_handle );
+  }
+  EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
+                           "Could not find the location of the ray with "
+                           "respect to cell "
+                           << d_dagmc_model->getCellHandler().getCellId( cell_handle ) <<
+                           "! Here are the details...\n"
+                           "  Position: "
+                           << this->arrayToString( position ) << "\n"
+                           "  Direction: "
+                           << this->arrayToString( direction ) );
+
+  return test_point_location == POINT_INSIDE_CELL;
+}
+
+// Find the cell handle that contains the ray using the cell index
+/*! \details The last cell that was found by this navigator is tested first,
+ * followed by its neighbors and then by the cells whose bounding boxes
+ * contain the ray position. If no cell is found a handle of 0 will be
+ * returned.
+ */
+moab::EntityHandle DagMCNavigator::findCellHandleContainingRayUsingIndex(
+                                          const Length position[3],
+                                          const double direction[3] ) const
+{
+  const DagMCCellBoundingBoxIndex& cell_index =
+    d_dagmc_model->getCellBoundingBoxIndex();
+
+  Utility::ArrayView<const size_t> neighbor_cells;
+
+  // Test the last cell that was found and its neighbors
+  if( d_last_found_cell_index < cell_index.getNumberOfCells() )
+  {
+    moab::EntityHandle cell_handle =
+      cell_index.getCellHandle( d_last_found_cell_index );
+
+    if( this->isRayInsideCellHandle( position, direction, cell_handle ) )
+      return cell_handle;
+
+    neighbor_cells = cell_index.getNeighborCells( d_last_found_cell_index );
+
+    for( size_t i = 0; i < neighbor_cells.size(); ++i )
+    {
+      cell_handle = cell_index.getCellHandle( neighbor_cells[i] );
+
+      if( this->isRayInsideCellHandle( position, direction, cell_handle ) )
+      {
+        d_last_found_cell_index = neighbor_cells[i];
+
+        return cell_handle;
+      }
+    }
+  }
+
+  // Test the cells whose bounding boxes contain the ray position
+  Utility::ArrayView<const size_t> candidate_cells =
+    cell_index.getCandidateCells( Utility::reinterpretAsRaw(position) );
+
+  for( size_t i = 0; i < candidate_cells.size(); ++i )
+  {
+    // Skip the cells that have already been tested
+    if( candidate_cells[i] == d_last_found_cell_index )
+      continue;
+
+    if( std::binary_search( neighbor_cells.begin(),
+                            neighbor_cells.end(),
+                            candidate_cells[i] ) )
+      continue;
+
+    moab::EntityHandle cell_handle =
+      cell_index.getCellHandle( candidate_cells[i] );
+
+    if( this->isRayInsideCellHandle( position, direction, cell_handle ) )
+    {
+      d_last_found_cell_index = candidate_cells[i];
+
+      return cell_handle;
+    }
+  }
+
+  return 0;
+}
+
 // Find the cell handle that contains the ray
+/*! \details The cell bounding box index is used to limit the number of
+ * cells that must be tested. All cells will only be tested if none of the
+ * candidate cells contain the ray.
+ */
 moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
                                            const Length position[3],
                                            const double direction[3],
@@ -555,39 +668,29 @@ moab::EntityHandle DagMCNavigator::findCellHandleContainingRay(
   // Make sure that the direction is valid
   testPrecondition( Utility::isUnitVector( direction ) );
 
-  moab::EntityHandle cell_handle = 0;
+  moab::EntityHandle cell_handle =
+    this->findCellHandleContainingRayUsingIndex( position, direction );
 
   // Test all of the cells
-  moab::Range::const_iterator cell_handle_it = d_dagmc_model->getCellHandler().begin();
-
-  while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
+  if( cell_handle == 0 )
   {
-    PointLocation test_point_location;
-
-    try{
-      test_point_location =
-        this->getPointLocationWithCellHandle( position,
-                                              direction,
-                                              *cell_handle_it );
-    }
-    EXCEPTION_CATCH_RETHROW( DagMCGeometryError,
-                             "Could not find the location of the ray with "
-                             "respect to cell "
-                             << d_dagmc_model->getCellHandler().getCellId( *cell_handle_it ) <<
-                             "! Here are the details...\n"
-                             "  Position: "
-                             << this->arrayToString( position ) << "\n"
-                             "  Direction: "
-                             << this->arrayToString( direction ) );
+    moab::Range::const_iterator cell_handle_it =
+      d_dagmc_model->getCellHandler().begin();
 
-    if( test_point_location == POINT_INSIDE_CELL )
+    while( cell_handle_it != d_dagmc_model->getCellHandler().end() )
     {
-      cell_handle = *cell_handle_it;
+      if( this->isRayInsideCellHandle( position, direction, *cell_handle_it ) )
+      {
+        cell_handle = *cell_handle_it;
 
-      break;
-    }
+        d_last_found_cell_index =
+          d_dagmc_model->getCellHandler().getCellIndex( cell_handle );
+
+        break;
+      }
 
-    ++cell_handle_it;
+      ++cell_handle_it;
+    }
   }
 
   // Make sure that a cell handle was found
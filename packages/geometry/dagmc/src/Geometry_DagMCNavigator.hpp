@@ -107,6 +107,9 @@ public:
   //! Get the cell containing the internal DagMC ray position
   EntityId getCurrentCell() const override;
 
+  //! Get the dense index of the cell that contains the internal ray
+  size_t getCurrentCellIndex() const override;
+
   //! Get the distance from the internal DagMC ray pos. to the nearest boundary in all directions
   Length getDistanceToClosestBoundary() override;
 
@@ -165,6 +168,16 @@ private:
                       const moab::EntityHandle cell_handle,
                       const moab::EntityHandle boundary_surface_handle ) const;
 
+  // Check if the ray is inside of a cell
+  bool isRayInsideCellHandle( const Length position[3],
+                              const double direction[3],
+                              const moab::EntityHandle cell_handle ) const;
+
+  // Find the cell handle that contains the ray using the cell index
+  moab::EntityHandle findCellHandleContainingRayUsingIndex(
+                                       const Length position[3],
+                                       const double direction[3] ) const;
+
   // Find the cell handle that contains the ray
   moab::EntityHandle findCellHandleContainingRay(
                                   const Length position[3],
@@ -211,6 +224,11 @@ private:
 
   // The internal ray
   DagMCRay d_internal_ray;
+
+  // The dense index of the last cell that was found to contain a ray
+  // Note: navigators are not shared between threads so this acts as a
+  //       per-thread cache
+  mutable size_t d_last_found_cell_index;
 };
 
 /*! The DagMC geometry error
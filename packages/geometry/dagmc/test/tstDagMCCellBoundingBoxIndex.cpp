@@ -0,0 +1,194 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDagMCCellBoundingBoxIndex.cpp
+//! \author Alex Robinson
+//! \brief  DagMCCellBoundingBoxIndex class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Geometry_DagMCCellBoundingBoxIndex.hpp"
+#include "Geometry_StandardDagMCCellHandler.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<Geometry::DagMCCellHandler> cell_handler;
+std::shared_ptr<Geometry::DagMCCellBoundingBoxIndex> cell_index;
+moab::DagMC* dagmc_instance;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Check if a cell is a candidate for a point
+bool isCandidateCell( const double position[3],
+                      const Geometry::Navigator::EntityId cell_id )
+{
+  Utility::ArrayView<const size_t> candidate_cells =
+    cell_index->getCandidateCells( position );
+
+  const size_t cell_dense_index =
+    cell_handler->getCellIndex( cell_handler->getCellHandle( cell_id ) );
+
+  return std::find( candidate_cells.begin(),
+                    candidate_cells.end(),
+                    cell_dense_index ) != candidate_cells.end();
+}
+
+//---------------------------------------------------------------------------//
+// Tests
+//---------------------------------------------------------------------------//
+// Check that the cell bounding box index can be constructed
+FRENSIE_UNIT_TEST( DagMCCellBoundingBoxIndex, constructor )
+{
+  FRENSIE_CHECK_NO_THROW( cell_index.reset( new Geometry::DagMCCellBoundingBoxIndex( dagmc_instance, *cell_handler ) ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of cells can be returned
+FRENSIE_UNIT_TEST( DagMCCellBoundingBoxIndex, getNumberOfCells )
+{
+  FRENSIE_CHECK_EQUAL( cell_index->getNumberOfCells(),
+                       cell_handler->getNumberOfCells() );
+  FRENSIE_CHECK( cell_index->getNumberOfVoxels() > 0 );
+  FRENSIE_CHECK( cell_index->getNumberOfUnboundedCells() <
+                 cell_index->getNumberOfCells() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cell handles can be returned
+FRENSIE_UNIT_TEST( DagMCCellBoundingBoxIndex, getCellHandle )
+{
+  moab::Range::const_iterator cell_handle_it = cell_handler->begin();
+
+  while( cell_handle_it != cell_handler->end() )
+  {
+    FRENSIE_CHECK_EQUAL( cell_index->getCellHandle( cell_handler->getCellIndex( *cell_handle_it ) ),
+                         *cell_handle_it );
+
+    ++cell_handle_it;
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the candidate cells for a point can be returned
+FRENSIE_UNIT_TEST( DagMCCellBoundingBoxIndex, getCandidateCells )
+{
+  double position[3] = {-40.0, -40.0, 59.0};
+
+  FRENSIE_CHECK( isCandidateCell( position, 53 ) );
+
+  position[2] = 61.0;
+
+  FRENSIE_CHECK( isCandidateCell( position, 54 ) );
+
+  position[2] = 64.0;
+
+  FRENSIE_CHECK( isCandidateCell( position, 55 ) );
+
+  // The candidate cells must be sorted
+  Utility::ArrayView<const size_t> candidate_cells =
+    cell_index->getCandidateCells( position );
+
+  FRENSIE_CHECK( std::is_sorted( candidate_cells.begin(),
+                                 candidate_cells.end() ) );
+  FRENSIE_CHECK( candidate_cells.size() < cell_index->getNumberOfCells() );
+
+  // Only the unbounded cells can contain a point outside of the grid
+  position[0] = 1e6;
+
+  candidate_cells = cell_index->getCandidateCells( position );
+
+  FRENSIE_CHECK_EQUAL( candidate_cells.size(),
+                       cell_index->getNumberOfUnboundedCells() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the neighbors of a cell can be returned
+FRENSIE_UNIT_TEST( DagMCCellBoundingBoxIndex, getNeighborCells )
+{
+  for( size_t i = 0; i < cell_index->getNumberOfCells(); ++i )
+  {
+    Utility::ArrayView<const size_t> neighbor_cells =
+      cell_index->getNeighborCells( i );
+
+    FRENSIE_CHECK( std::is_sorted( neighbor_cells.begin(),
+                                   neighbor_cells.end() ) );
+    FRENSIE_CHECK( std::find( neighbor_cells.begin(),
+                              neighbor_cells.end(),
+                              i ) == neighbor_cells.end() );
+
+    // The neighbor relationship must be symmetric
+    for( size_t j = 0; j < neighbor_cells.size(); ++j )
+    {
+      Utility::ArrayView<const size_t> other_neighbor_cells =
+        cell_index->getNeighborCells( neighbor_cells[j] );
+
+      FRENSIE_CHECK( std::binary_search( other_neighbor_cells.begin(),
+                                         other_neighbor_cells.end(),
+                                         i ) );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_dagmc_geom_file_name;
+bool suppress_dagmc_output = true;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_cad_file",
+                                        test_dagmc_geom_file_name, "",
+                                        "Test CAD file name" );
+
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "suppress_dagmc_output",
+                                        suppress_dagmc_output, true,
+                                        "Suppress DagMC output" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize dagmc
+  dagmc_instance = new moab::DagMC();
+
+  std::streambuf* cout_streambuf, *cerr_streambuf;
+
+  if( suppress_dagmc_output )
+  {
+    cout_streambuf = std::cout.rdbuf();
+    cerr_streambuf = std::cerr.rdbuf();
+
+    std::cout.rdbuf( NULL );
+    std::cerr.rdbuf( NULL );
+  }
+
+  moab::ErrorCode return_value =
+    dagmc_instance->load_file( test_dagmc_geom_file_name.c_str() );
+
+  // The bounding boxes are calculated from the OBB trees
+  return_value = dagmc_instance->init_OBBTree();
+
+  if( suppress_dagmc_output )
+  {
+    std::cout.rdbuf( cout_streambuf );
+    std::cerr.rdbuf( cerr_streambuf );
+  }
+
+  cell_handler.reset( new Geometry::StandardDagMCCellHandler( dagmc_instance ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDagMCCellBoundingBoxIndex.cpp
+//---------------------------------------------------------------------------//
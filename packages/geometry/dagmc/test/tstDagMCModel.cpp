@@ -673,6 +673,36 @@ FRENSIE_UNIT_TEST( DagMCModel, getCellVolume )
                                    1e-6 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dense cell indices can be returned
+FRENSIE_UNIT_TEST( DagMCModel, getCellIndex )
+{
+  std::shared_ptr<Geometry::DagMCModel> 
+    model( new Geometry::DagMCModel( *model_properties ) );
+
+  Geometry::Model::CellIdSet cells;
+
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK_EQUAL( model->getNumberOfCellIndices(), cells.size() );
+
+  // Every cell must have a unique index in [0,number of cell indices)
+  std::set<size_t> cell_indices;
+
+  for( auto&& cell : cells )
+  {
+    const size_t cell_index = model->getCellIndex( cell );
+
+    FRENSIE_CHECK( cell_index < model->getNumberOfCellIndices() );
+
+    cell_indices.insert( cell_index );
+  }
+
+  FRENSIE_CHECK_EQUAL( cell_indices.size(), cells.size() );
+  FRENSIE_CHECK_THROW( model->getCellIndex( 1000000 ),
+                       Geometry::InvalidDagMCGeometry );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the problem surfaces can be returned
 FRENSIE_UNIT_TEST( DagMCModel, getSurfaces )
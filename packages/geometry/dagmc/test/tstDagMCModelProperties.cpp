@@ -38,6 +38,8 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, default_properties )
                        "material" );
   FRENSIE_CHECK_EQUAL( default_properties.getDensityPropertyName(),
                        "density" );
+  FRENSIE_CHECK_EQUAL( default_properties.getTemperaturePropertyName(),
+                       "temperature" );
   FRENSIE_CHECK_EQUAL( default_properties.getEstimatorPropertyName(),
                        "estimator" );
   FRENSIE_CHECK_EQUAL( default_properties.getSurfaceCurrentName(),
@@ -140,6 +142,19 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, setDensityPropertyName )
   FRENSIE_CHECK_EQUAL( properties.getDensityPropertyName(), "rho" );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the temperature property name can be set
+FRENSIE_UNIT_TEST( DagMCModelProperties, setTemperaturePropertyName )
+{
+  Geometry::DagMCModelProperties properties( "test.h5m" );
+  properties.setTemperaturePropertyName( "temp" );
+
+  FRENSIE_CHECK_EQUAL( properties.getTemperaturePropertyName(), "temp" );
+
+  FRENSIE_CHECK_THROW( properties.setTemperaturePropertyName( "temp_k" ),
+                       std::runtime_error );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the estimator property name can be set
 FRENSIE_UNIT_TEST( DagMCModelProperties, setEstimatorPropertyName )
@@ -160,7 +175,7 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, getPropertyNames )
 
   properties.getPropertyNames( property_names );
 
-  FRENSIE_CHECK_EQUAL( property_names.size(), 5 );
+  FRENSIE_CHECK_EQUAL( property_names.size(), 6 );
   FRENSIE_CHECK( std::find( property_names.begin(),
                           property_names.end(),
                           "termination.cell" ) != property_names.end() );
@@ -176,6 +191,9 @@ FRENSIE_UNIT_TEST( DagMCModelProperties, getPropertyNames )
   FRENSIE_CHECK( std::find( property_names.begin(),
                           property_names.end(),
                           "estimator" ) != property_names.end() );
+  FRENSIE_CHECK( std::find( property_names.begin(),
+                          property_names.end(),
+                          "temperature" ) != property_names.end() );
 }
 
 //---------------------------------------------------------------------------//
@@ -457,6 +475,7 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DagMCModelProperties,
     properties.setReflectingSurfacePropertyName( "ref.surf" );
     properties.setMaterialPropertyName( "mat" );
     properties.setDensityPropertyName( "rho" );
+    properties.setTemperaturePropertyName( "temp" );
     properties.setEstimatorPropertyName( "tally" );
     properties.setSurfaceCurrentName( "s.cur" );
     properties.setSurfaceFluxName( "s.flux" );
@@ -495,6 +514,8 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( DagMCModelProperties,
                        "mat" );
   FRENSIE_CHECK_EQUAL( properties.getDensityPropertyName(),
                        "rho" );
+  FRENSIE_CHECK_EQUAL( properties.getTemperaturePropertyName(),
+                       "temp" );
   FRENSIE_CHECK_EQUAL( properties.getEstimatorPropertyName(),
                        "tally" );
   FRENSIE_CHECK_EQUAL( properties.getSurfaceCurrentName(),
@@ -223,6 +223,28 @@ FRENSIE_UNIT_TEST( DagMCNavigator, findCellContainingRay )
   FRENSIE_CHECK_EQUAL( cell, 55 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the cell containing the external ray can be found repeatedly
+// (the last cell found and its neighbors are tested first)
+FRENSIE_UNIT_TEST( DagMCNavigator, findCellContainingRay_repeated )
+{
+  std::shared_ptr<Geometry::Navigator> navigator =
+    model->createNavigator();
+
+  const double z_positions[7] = {59.0, 59.5, 61.0, 59.0, 64.0, 61.0, 64.0};
+  const Geometry::Navigator::EntityId cells[7] = {53, 53, 54, 53, 55, 54, 55};
+
+  for( size_t i = 0; i < 7; ++i )
+  {
+    Geometry::Navigator::Ray ray( -40.0*cgs::centimeter,
+                                  -40.0*cgs::centimeter,
+                                  z_positions[i]*cgs::centimeter,
+                                  0.0, 0.0, 1.0 );
+
+    FRENSIE_CHECK_EQUAL( navigator->findCellContainingRay( ray ), cells[i] );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that the internal ray can be set
 FRENSIE_UNIT_TEST( DagMCNavigator, setState_unknown_cell )
@@ -264,6 +286,8 @@ FRENSIE_UNIT_TEST( DagMCNavigator, setState_unknown_cell )
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 0.0 );
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 1.0 );
   FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 54 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(),
+                       model->getCellIndex( 54 ) );
 }
 
 //---------------------------------------------------------------------------//
@@ -294,6 +318,8 @@ FRENSIE_UNIT_TEST( DagMCNavigator, setState_known_cell )
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[1], 0.0 );
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 1.0 );
   FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 53 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(),
+                       model->getCellIndex( 53 ) );
 
   ray.reset( new Geometry::Navigator::Ray( -40.0*cgs::centimeter,
                                            -40.0*cgs::centimeter,
@@ -481,6 +481,36 @@ RootNavigator* RootModel::createNavigatorAdvanced() const
   return new RootNavigator( RootModel::getInstance() );
 }
 
+// Get the number of dense cell indices
+/*! \details Every unique root volume has an index, including any volumes
+ * that have not been assigned a cell id, so the number of indices can be
+ * larger than the number of cells.
+ */
+size_t RootModel::getNumberOfCellIndices() const
+{
+  // Make sure that root has been initialized
+  testPrecondition( this->isInitialized() );
+
+  return d_manager->GetListOfUVolumes()->GetEntriesFast();
+}
+
+// Get the dense index of a cell
+/*! \details The cell index is the root volume number (uid).
+ */
+size_t RootModel::getCellIndex( const EntityId cell_id ) const
+{
+  // Make sure that root has been initialized
+  testPrecondition( this->isInitialized() );
+
+  CellIdUidMap::const_iterator cell_it = d_cell_id_uid_map.find( cell_id );
+
+  TEST_FOR_EXCEPTION( cell_it == d_cell_id_uid_map.end(),
+                      InvalidRootGeometry,
+                      "Cell " << cell_id << " does not exist!" );
+
+  return cell_it->second;
+}
+
 // Get the cell
 TGeoVolume* RootModel::getVolumePtr( const EntityId& cell_id ) const
 {
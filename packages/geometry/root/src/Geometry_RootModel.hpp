@@ -102,6 +102,12 @@ public:
   //! Get the cell volume
   Volume getCellVolume( const EntityId cell_id ) const override;
 
+  //! Get the number of dense cell indices
+  size_t getNumberOfCellIndices() const override;
+
+  //! Get the dense index of a cell
+  size_t getCellIndex( const EntityId cell_id ) const override;
+
   //! Create a raw, heap-allocated navigator
   RootNavigator* createNavigatorAdvanced(
                                     const Navigator::AdvanceCompleteCallback&
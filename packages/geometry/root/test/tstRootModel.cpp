@@ -255,6 +255,36 @@ FRENSIE_UNIT_TEST( RootModel, getCellVolume )
                                    1e-9 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the dense cell indices can be returned
+FRENSIE_UNIT_TEST( RootModel, getCellIndex )
+{
+  std::shared_ptr<const Geometry::RootModel> model =
+    Geometry::RootModel::getInstance();
+
+  Geometry::Model::CellIdSet cells;
+
+  model->getCells( cells, true, true );
+
+  FRENSIE_CHECK( model->getNumberOfCellIndices() >= cells.size() );
+
+  // Every cell must have a unique index in [0,number of cell indices)
+  std::set<size_t> cell_indices;
+
+  for( auto&& cell : cells )
+  {
+    const size_t cell_index = model->getCellIndex( cell );
+
+    FRENSIE_CHECK( cell_index < model->getNumberOfCellIndices() );
+
+    cell_indices.insert( cell_index );
+  }
+
+  FRENSIE_CHECK_EQUAL( cell_indices.size(), cells.size() );
+  FRENSIE_CHECK_THROW( model->getCellIndex( 1000000 ),
+                       Geometry::InvalidRootGeometry );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a Root navigator can be created
 FRENSIE_UNIT_TEST( RootModel, createNavigatorAdvanced )
@@ -323,6 +323,8 @@ FRENSIE_UNIT_TEST( RootNavigator, setState )
   FRENSIE_CHECK_EQUAL( navigator->getDirection()[2], 1.0 );
 
   FRENSIE_CHECK_EQUAL( navigator->getCurrentCell(), 2 );
+  FRENSIE_CHECK_EQUAL( navigator->getCurrentCellIndex(),
+                       model->getCellIndex( 2 ) );
 
   ray.reset( new Geometry::Navigator::Ray( 1.0*cgs::centimeter,
                                            1.0*cgs::centimeter,
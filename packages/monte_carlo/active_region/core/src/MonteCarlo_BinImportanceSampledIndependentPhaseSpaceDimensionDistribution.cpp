@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.cpp
+//! \author Alex Robinson
+//! \brief  Bin importance sampled independent phase space dimension
+//!         distribution class template instantiations
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp"
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentPrimarySpatialDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_SPATIAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_SPATIAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentSecondarySpatialDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_SPATIAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_SPATIAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentTertiarySpatialDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_SPATIAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_SPATIAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentPrimaryDirectionalDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_DIRECTIONAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentSecondaryDirectionalDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_DIRECTIONAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentTertiaryDirectionalDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_DIRECTIONAL_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentEnergyDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentTimeDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TIME_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TIME_DIMENSION> );
+
+BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::BinImportanceSampledIndependentWeightDimensionDistribution );
+EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::WEIGHT_DIMENSION> );
+EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::WEIGHT_DIMENSION> );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp
+//! \author Alex Robinson
+//! \brief  Bin importance sampled independent phase space dimension
+//!         distribution class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_HPP
+#define MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_IndependentPhaseSpaceDimensionDistribution.hpp"
+#include "Utility_TabularUnivariateDistribution.hpp"
+
+namespace MonteCarlo{
+
+/*! The bin importance sampled independent phase space dimension distribution
+ * \details The importance distribution is the dimension distribution scaled
+ * by a constant importance in each bin of a bin structure. Dimension values
+ * are sampled exactly from this importance distribution by first sampling
+ * a bin from the biased bin probabilities and then sampling the dimension
+ * distribution restricted to the bin (using its CDF). The weight of a
+ * sample is the ratio of the bin probability and the biased bin
+ * probability, which is constant in each bin.
+ */
+template<PhaseSpaceDimension dimension>
+class BinImportanceSampledIndependentPhaseSpaceDimensionDistribution : public IndependentPhaseSpaceDimensionDistribution<dimension>
+{
+
+  // Typedef for the base type
+  typedef IndependentPhaseSpaceDimensionDistribution<dimension> BaseType;
+
+public:
+
+  //! The trial counter type
+  typedef PhaseSpaceDimensionDistribution::Counter Counter;
+
+  //! Constructor
+  BinImportanceSampledIndependentPhaseSpaceDimensionDistribution(
+           const std::shared_ptr<const Utility::TabularUnivariateDistribution>&
+           dimension_distribution,
+           const std::vector<double>& bin_boundaries,
+           const std::vector<double>& bin_importances );
+
+  //! Destructor
+  ~BinImportanceSampledIndependentPhaseSpaceDimensionDistribution()
+  { /* ... */ }
+
+  //! Return the bin boundaries
+  const std::vector<double>& getBinBoundaries() const;
+
+  //! Return the weight of a sample in each bin
+  const std::vector<double>& getBinWeights() const;
+
+  //! Sample a dimension value without a cascade to the dependent dists.
+  void sampleWithoutCascade(
+                    PhaseSpacePoint& phase_space_sample ) const final override;
+
+  //! Sample a dimension value without a cascade to the dependent dists.
+  void sampleAndRecordTrialsWithoutCascade(
+                                        PhaseSpacePoint& phase_space_sample,
+                                        Counter& trials ) const final override;
+
+private:
+
+  // Default constructor
+  BinImportanceSampledIndependentPhaseSpaceDimensionDistribution()
+  { /* ... */ }
+
+  // Sample a dimension value and the bin that it was sampled in
+  double sampleImpl( size_t& bin_index ) const;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the data from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The tabular dimension distribution
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+  d_tabular_dimension_distribution;
+
+  // The bin boundaries
+  std::vector<double> d_bin_boundaries;
+
+  // The dimension distribution CDF at the bin boundaries
+  std::vector<double> d_bin_boundary_cdf_values;
+
+  // The biased bin CDF (the value at the upper boundary of each bin)
+  std::vector<double> d_biased_bin_cdf;
+
+  // The weight of a sample in each bin
+  std::vector<double> d_bin_weights;
+};
+
+//! The bin importance sampled independent primary spatial phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<PRIMARY_SPATIAL_DIMENSION> BinImportanceSampledIndependentPrimarySpatialDimensionDistribution;
+
+//! The bin importance sampled independent secondary spatial phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<SECONDARY_SPATIAL_DIMENSION> BinImportanceSampledIndependentSecondarySpatialDimensionDistribution;
+
+//! The bin importance sampled independent tertiary spatial phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<TERTIARY_SPATIAL_DIMENSION> BinImportanceSampledIndependentTertiarySpatialDimensionDistribution;
+
+//! The bin importance sampled independent primary directional phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<PRIMARY_DIRECTIONAL_DIMENSION> BinImportanceSampledIndependentPrimaryDirectionalDimensionDistribution;
+
+//! The bin importance sampled independent secondary directional phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<SECONDARY_DIRECTIONAL_DIMENSION> BinImportanceSampledIndependentSecondaryDirectionalDimensionDistribution;
+
+//! The bin importance sampled independent tertiary directional phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<TERTIARY_DIRECTIONAL_DIMENSION> BinImportanceSampledIndependentTertiaryDirectionalDimensionDistribution;
+
+//! The bin importance sampled independent energy phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<ENERGY_DIMENSION> BinImportanceSampledIndependentEnergyDimensionDistribution;
+
+//! The bin importance sampled independent time phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<TIME_DIMENSION> BinImportanceSampledIndependentTimeDimensionDistribution;
+
+//! The bin importance sampled independent weight phase space dimension distribution
+typedef BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<WEIGHT_DIMENSION> BinImportanceSampledIndependentWeightDimensionDistribution;
+
+} // end MonteCarlo namespace
+
+#define BOOST_SERIALIZATION_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_VERSION( version ) \
+  BOOST_SERIALIZATION_TEMPLATE_CLASS_VERSION_IMPL(                      \
+    BinImportanceSampledIndependentPhaseSpaceDimensionDistribution, MonteCarlo, version, \
+    __BOOST_SERIALIZATION_FORWARD_AS_SINGLE_ARG__( MonteCarlo::PhaseSpaceDimension Dim ), \
+    __BOOST_SERIALIZATION_FORWARD_AS_SINGLE_ARG__( Dim ) )
+
+BOOST_SERIALIZATION_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_VERSION( 0 );
+
+//---------------------------------------------------------------------------//
+// Template Includes.
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,253 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution_def.hpp
+//! \author Alex Robinson
+//! \brief  Bin importance sampled independent phase space dimension
+//!         distribution template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_DEF_HPP
+#define MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+
+// FRENSIE Includes
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The bin boundaries must be sorted and must cover the range of
+ * the dimension distribution. Every bin that the dimension distribution has
+ * a nonzero probability in must have a positive importance. The biased
+ * probability of bin i is proportional to p_i*I_i, where p_i is the
+ * probability of bin i and I_i is the importance of bin i.
+ */
+template<PhaseSpaceDimension dimension>
+BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution(
+           const std::shared_ptr<const Utility::TabularUnivariateDistribution>&
+           dimension_distribution,
+           const std::vector<double>& bin_boundaries,
+           const std::vector<double>& bin_importances )
+  : BaseType( dimension_distribution ),
+    d_tabular_dimension_distribution( dimension_distribution ),
+    d_bin_boundaries( bin_boundaries ),
+    d_bin_boundary_cdf_values( bin_boundaries.size() ),
+    d_biased_bin_cdf( bin_importances.size() ),
+    d_bin_weights( bin_importances.size(), 1.0 )
+{
+  // Make sure that the dimension distribution is valid
+  testPrecondition( dimension_distribution.get() );
+
+  TEST_FOR_EXCEPTION( bin_boundaries.size() < 2,
+                      std::runtime_error,
+                      "At least one bin must be specified!" );
+
+  TEST_FOR_EXCEPTION( bin_importances.size() != bin_boundaries.size()-1,
+                      std::runtime_error,
+                      "There must be an importance for every bin!" );
+
+  TEST_FOR_EXCEPTION( !std::is_sorted( bin_boundaries.begin(),
+                                       bin_boundaries.end() ),
+                      std::runtime_error,
+                      "The bin boundaries must be sorted!" );
+
+  TEST_FOR_EXCEPTION( bin_boundaries.front() >
+                      dimension_distribution->getLowerBoundOfIndepVar() ||
+                      bin_boundaries.back() <
+                      dimension_distribution->getUpperBoundOfIndepVar(),
+                      std::runtime_error,
+                      "The bins must cover the range of the dimension "
+                      "distribution!" );
+
+  for( size_t i = 0; i < bin_boundaries.size(); ++i )
+  {
+    d_bin_boundary_cdf_values[i] =
+      dimension_distribution->evaluateCDF( bin_boundaries[i] );
+  }
+
+  // Calculate the biased bin probabilities
+  double biased_norm = 0.0;
+
+  for( size_t i = 0; i < bin_importances.size(); ++i )
+  {
+    const double bin_probability =
+      d_bin_boundary_cdf_values[i+1] - d_bin_boundary_cdf_values[i];
+
+    TEST_FOR_EXCEPTION( bin_probability > 0.0 && !(bin_importances[i] > 0.0),
+                        std::runtime_error,
+                        "The importance of bin " << i << " must be "
+                        "positive!" );
+
+    if( bin_probability > 0.0 )
+      biased_norm += bin_probability*bin_importances[i];
+
+    d_biased_bin_cdf[i] = biased_norm;
+  }
+
+  TEST_FOR_EXCEPTION( biased_norm <= 0.0,
+                      std::runtime_error,
+                      "The dimension distribution does not have a nonzero "
+                      "probability in any bin!" );
+
+  // Normalize the biased bin CDF and calculate the bin weights
+  for( size_t i = 0; i < bin_importances.size(); ++i )
+  {
+    d_biased_bin_cdf[i] /= biased_norm;
+
+    if( d_bin_boundary_cdf_values[i+1] > d_bin_boundary_cdf_values[i] )
+      d_bin_weights[i] = biased_norm/bin_importances[i];
+  }
+
+  d_biased_bin_cdf.back() = 1.0;
+}
+
+// Return the bin boundaries
+template<PhaseSpaceDimension dimension>
+const std::vector<double>& BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::getBinBoundaries() const
+{
+  return d_bin_boundaries;
+}
+
+// Return the weight of a sample in each bin
+template<PhaseSpaceDimension dimension>
+const std::vector<double>& BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::getBinWeights() const
+{
+  return d_bin_weights;
+}
+
+// Sample a dimension value without a cascade to the dependent dists.
+/*! \details The weight of the dimension will be the ratio of the probability
+ * of the sampled bin and the biased probability of the sampled bin. This
+ * preserves the expected value of the phase space dimension distribution.
+ */
+template<PhaseSpaceDimension dimension>
+void BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::sampleWithoutCascade(
+                                    PhaseSpacePoint& phase_space_sample ) const
+{
+  size_t bin_index;
+
+  const double sample = this->sampleImpl( bin_index );
+
+  MonteCarlo::setCoordinate<dimension>( phase_space_sample, sample );
+  MonteCarlo::setCoordinateWeight<dimension>( phase_space_sample,
+                                              d_bin_weights[bin_index] );
+}
+
+// Sample a dimension value without a cascade to the dependent dists.
+template<PhaseSpaceDimension dimension>
+void BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::sampleAndRecordTrialsWithoutCascade(
+                                           PhaseSpacePoint& phase_space_sample,
+                                           Counter& trials ) const
+{
+  ++trials;
+
+  this->sampleWithoutCascade( phase_space_sample );
+}
+
+// Sample a dimension value and the bin that it was sampled in
+template<PhaseSpaceDimension dimension>
+double BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::sampleImpl( size_t& bin_index ) const
+{
+  // Sample the bin
+  const double bin_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  bin_index = std::upper_bound( d_biased_bin_cdf.begin(),
+                                d_biased_bin_cdf.end(),
+                                bin_random_number ) -
+    d_biased_bin_cdf.begin();
+
+  if( bin_index == d_biased_bin_cdf.size() )
+    --bin_index;
+
+  // Sample the dimension distribution in the bin
+  const double random_number =
+    d_bin_boundary_cdf_values[bin_index] +
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    (d_bin_boundary_cdf_values[bin_index+1] -
+     d_bin_boundary_cdf_values[bin_index]);
+
+  return d_tabular_dimension_distribution->sampleWithRandomNumber(
+                                                               random_number );
+}
+
+// Save the data to an archive
+template<PhaseSpaceDimension dimension>
+template<typename Archive>
+void BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::save( Archive& ar, const unsigned version ) const
+{
+  // Save the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType );
+
+  // Save the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_tabular_dimension_distribution );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_boundaries );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_boundary_cdf_values );
+  ar & BOOST_SERIALIZATION_NVP( d_biased_bin_cdf );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_weights );
+}
+
+// Load the data from an archive
+template<PhaseSpaceDimension dimension>
+template<typename Archive>
+void BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<dimension>::load( Archive& ar, const unsigned version )
+{
+  // Load the base class member data
+  ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( BaseType );
+
+  // Load the local member data
+  ar & BOOST_SERIALIZATION_NVP( d_tabular_dimension_distribution );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_boundaries );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_boundary_cdf_values );
+  ar & BOOST_SERIALIZATION_NVP( d_biased_bin_cdf );
+  ar & BOOST_SERIALIZATION_NVP( d_bin_weights );
+}
+
+} // end MonteCarlo namespace
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentPrimarySpatialDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_SPATIAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_SPATIAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentSecondarySpatialDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_SPATIAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_SPATIAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentTertiarySpatialDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_SPATIAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_SPATIAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentPrimaryDirectionalDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_DIRECTIONAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::PRIMARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentSecondaryDirectionalDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_DIRECTIONAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::SECONDARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentTertiaryDirectionalDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_DIRECTIONAL_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TERTIARY_DIRECTIONAL_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentEnergyDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::ENERGY_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentTimeDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TIME_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::TIME_DIMENSION> );
+
+BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( BinImportanceSampledIndependentWeightDimensionDistribution, MonteCarlo );
+EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::WEIGHT_DIMENSION> );
+EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo, BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<MonteCarlo::WEIGHT_DIMENSION> );
+
+#endif // end MONTE_CARLO_BIN_IMPORTANCE_SAMPLED_INDEPENDENT_PHASE_SPACE_DIMENSION_DISTRIBUTION_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,321 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstBinImportanceSampledIndependentPhaseSpaceDimensionDistribution.cpp
+//! \author Alex Robinson
+//! \brief  Bin importance sampled indep. phase space dimension dist. tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp"
+#include "MonteCarlo_PhaseSpaceDimensionTraits.hpp"
+#include "Utility_BasicCartesianCoordinateConversionPolicy.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using namespace MonteCarlo;
+
+typedef std::tuple<std::integral_constant<PhaseSpaceDimension,PRIMARY_SPATIAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,SECONDARY_SPATIAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,TERTIARY_SPATIAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,PRIMARY_DIRECTIONAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,SECONDARY_DIRECTIONAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,TERTIARY_DIRECTIONAL_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,ENERGY_DIMENSION>,
+                   std::integral_constant<PhaseSpaceDimension,TIME_DIMENSION>
+                  > TestPhaseSpaceDimensionsNoWeight;
+
+typedef decltype(std::tuple_cat(TestPhaseSpaceDimensionsNoWeight(),std::make_tuple(std::integral_constant<PhaseSpaceDimension,WEIGHT_DIMENSION>()))) TestPhaseSpaceDimensions;
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<const Utility::SpatialCoordinateConversionPolicy>
+spatial_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+std::shared_ptr<const Utility::DirectionalCoordinateConversionPolicy>
+directional_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+std::shared_ptr<const Utility::TabularUnivariateDistribution>
+distribution( new Utility::UniformDistribution( 0.0, 2.0, 1.0 ) );
+
+// The bin probabilities are 0.5 and 0.5 - the biased bin probabilities are
+// 2/3 and 1/3
+std::vector<double> bin_boundaries( {0.0, 1.0, 2.0} );
+std::vector<double> bin_importances( {1.0, 0.5} );
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Test that the dimension can be returned
+FRENSIE_UNIT_TEST_TEMPLATE(
+                BinImportanceSampledIndependentPhaseSpaceDimensionDistribution,
+                getDimension,
+                TestPhaseSpaceDimensions )
+{
+  FETCH_TEMPLATE_PARAM( 0, WrappedDimension );
+  constexpr PhaseSpaceDimension Dimension = WrappedDimension::value;
+
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    dimension_distribution( new MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<Dimension>( distribution, bin_boundaries, bin_importances ) );
+
+  FRENSIE_CHECK_EQUAL( dimension_distribution->getDimension(), Dimension );
+}
+
+//---------------------------------------------------------------------------//
+// Test that invalid bins are rejected
+FRENSIE_UNIT_TEST_TEMPLATE(
+                BinImportanceSampledIndependentPhaseSpaceDimensionDistribution,
+                constructor_invalid_bins,
+                TestPhaseSpaceDimensions )
+{
+  FETCH_TEMPLATE_PARAM( 0, WrappedDimension );
+  constexpr PhaseSpaceDimension Dimension = WrappedDimension::value;
+
+  typedef MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<Dimension> DistributionType;
+
+  // No bins
+  FRENSIE_CHECK_THROW( DistributionType( distribution,
+                                         std::vector<double>( {0.0} ),
+                                         std::vector<double>() ),
+                       std::runtime_error );
+
+  // Missing importance
+  FRENSIE_CHECK_THROW( DistributionType( distribution,
+                                         bin_boundaries,
+                                         std::vector<double>( {1.0} ) ),
+                       std::runtime_error );
+
+  // Unsorted bins
+  FRENSIE_CHECK_THROW( DistributionType( distribution,
+                                         std::vector<double>( {0.0, 2.0, 1.0} ),
+                                         bin_importances ),
+                       std::runtime_error );
+
+  // The bins do not cover the distribution
+  FRENSIE_CHECK_THROW( DistributionType( distribution,
+                                         std::vector<double>( {0.0, 1.0, 1.5} ),
+                                         bin_importances ),
+                       std::runtime_error );
+
+  // A bin with a nonzero probability has a zero importance
+  FRENSIE_CHECK_THROW( DistributionType( distribution,
+                                         bin_boundaries,
+                                         std::vector<double>( {1.0, 0.0} ) ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the bin boundaries and weights can be returned
+FRENSIE_UNIT_TEST_TEMPLATE(
+                BinImportanceSampledIndependentPhaseSpaceDimensionDistribution,
+                getBinWeights,
+                TestPhaseSpaceDimensions )
+{
+  FETCH_TEMPLATE_PARAM( 0, WrappedDimension );
+  constexpr PhaseSpaceDimension Dimension = WrappedDimension::value;
+
+  MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<Dimension>
+    dimension_distribution( distribution, bin_boundaries, bin_importances );
+
+  FRENSIE_CHECK_EQUAL( dimension_distribution.getBinBoundaries(),
+                       bin_boundaries );
+  FRENSIE_CHECK_FLOATING_EQUALITY( dimension_distribution.getBinWeights(),
+                                   std::vector<double>( {0.75, 1.5} ),
+                                   1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Test if the distribution can be sampled without a cascade
+FRENSIE_UNIT_TEST_TEMPLATE(
+                BinImportanceSampledIndependentPhaseSpaceDimensionDistribution,
+                sampleWithoutCascade,
+                TestPhaseSpaceDimensionsNoWeight )
+{
+  FETCH_TEMPLATE_PARAM( 0, WrappedDimension );
+  constexpr PhaseSpaceDimension Dimension = WrappedDimension::value;
+
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    dimension_distribution( new MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<Dimension>( distribution, bin_boundaries, bin_importances ) );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  // The first random number selects the bin, the second samples the bin
+  std::vector<double> fake_stream = {0.0, 0.0, 0.25, 0.75, 0.9, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  dimension_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_EQUAL( getCoordinate<Dimension>( point ), 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<Dimension>( point ),
+                                   0.75,
+                                   1e-15 );
+
+  dimension_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<Dimension>( point ),
+                                   0.75,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<Dimension>( point ),
+                                   0.75,
+                                   1e-15 );
+
+  dimension_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<Dimension>( point ),
+                                   1.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<Dimension>( point ),
+                                   1.5,
+                                   1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Test if the distribution can be sampled without a cascade
+FRENSIE_UNIT_TEST_TEMPLATE(
+                BinImportanceSampledIndependentPhaseSpaceDimensionDistribution,
+                sampleAndRecordTrialsWithoutCascade,
+                TestPhaseSpaceDimensionsNoWeight )
+{
+  FETCH_TEMPLATE_PARAM( 0, WrappedDimension );
+  constexpr PhaseSpaceDimension Dimension = WrappedDimension::value;
+
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    dimension_distribution( new MonteCarlo::BinImportanceSampledIndependentPhaseSpaceDimensionDistribution<Dimension>( distribution, bin_boundaries, bin_importances ) );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  MonteCarlo::PhaseSpaceDimensionDistribution::Counter trials = 0;
+
+  std::vector<double> fake_stream = {0.25, 0.75, 0.9, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  dimension_distribution->sampleAndRecordTrialsWithoutCascade( point, trials );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<Dimension>( point ),
+                                   0.75,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<Dimension>( point ),
+                                   0.75,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( trials, 1 );
+
+  dimension_distribution->sampleAndRecordTrialsWithoutCascade( point, trials );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<Dimension>( point ),
+                                   1.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<Dimension>( point ),
+                                   1.5,
+                                   1e-15 );
+  FRENSIE_CHECK_EQUAL( trials, 2 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the distribution can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( PhaseSpaceDimension,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_bin_importance_sampled_independent_phase_dimension_distribution" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+      energy_dimension_distribution( new MonteCarlo::BinImportanceSampledIndependentEnergyDimensionDistribution( distribution, bin_boundaries, bin_importances ) );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP(energy_dimension_distribution) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived distribution
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    energy_dimension_distribution;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP(energy_dimension_distribution) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( energy_dimension_distribution->getDimension(),
+                       ENERGY_DIMENSION );
+
+  std::vector<double> fake_stream = {0.25, 0.75, 0.9, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  energy_dimension_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<ENERGY_DIMENSION>( point ),
+                                   0.75,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<ENERGY_DIMENSION>( point ),
+                                   0.75,
+                                   1e-15 );
+
+  energy_dimension_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinate<ENERGY_DIMENSION>( point ),
+                                   1.5,
+                                   1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( getCoordinateWeight<ENERGY_DIMENSION>( point ),
+                                   1.5,
+                                   1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstBinImportanceSampledIndependentPhaseSpaceDimensionDistribution.cpp
+//---------------------------------------------------------------------------//
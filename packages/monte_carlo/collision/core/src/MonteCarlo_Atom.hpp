@@ -113,6 +113,10 @@ public:
   //! Return the reaction types
   void getReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
+  //! Add the energy grid points of the reactions to an array
+  virtual void getEnergyGridPoints(
+                           std::vector<double>& energy_grid_points ) const;
+
   //! Collide with a particle
   virtual void collideAnalogue( ParticleStateType& particle,
                                 ParticleBank& bank ) const;
@@ -183,12 +187,14 @@ private:
 
   // Sample an absorption reaction
   void sampleAbsorptionReaction( const double scaled_random_number,
+                                 const double cross_section,
                                  const unsigned energy_grid_bin,
                                  ParticleStateType& particle,
                                  ParticleBank& bank ) const;
 
   // Sample a scattering reaction
   void sampleScatteringReaction( const double scaled_random_number,
+                                 const double cross_section,
                                  const unsigned energy_grid_bin,
                                  ParticleStateType& particle,
                                  ParticleBank& bank ) const;
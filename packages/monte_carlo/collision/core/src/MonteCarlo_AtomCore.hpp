@@ -18,6 +18,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
+#include "MonteCarlo_ReactionCrossSectionTable.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Map.hpp"
@@ -34,7 +35,11 @@ namespace MonteCarlo{
  * with photonuclear data - photo-nuclides that share the same atomic number
  * need the same photoatomic data. This class allows each photo-nuclide to
  * share the photoatomic data without copying that data (even if each
- * photo-nuclide has its own copy of the atom core object).
+ * photo-nuclide has its own copy of the atom core object). When the total
+ * reaction is created and all reactions share a common energy grid, the
+ * scattering and absorption reaction cross sections are also flattened
+ * into reaction cross section tables, which are used to sample reactions
+ * without iterating over the reaction maps.
  */
 template<typename _ReactionEnumType,
          typename _ReactionType,
@@ -66,6 +71,9 @@ public:
   //! Typedef for the const reaction map
   typedef MapType<ReactionEnumType,std::shared_ptr<const ReactionType> > ConstReactionMap;
 
+  //! Typedef for the reaction cross section table
+  typedef ReactionCrossSectionTable<ReactionType> ReactionCrossSectionTableType;
+
   //! Destructor
   virtual ~AtomCore()
   { /* ... */ }
@@ -109,6 +117,18 @@ public:
   //! Test if all of the reactions share a common energy grid
   bool hasSharedEnergyGrid() const;
 
+  //! Check if the scattering reaction cross section table has been created
+  bool hasScatteringReactionCrossSectionTable() const;
+
+  //! Return the scattering reaction cross section table
+  const ReactionCrossSectionTableType& getScatteringReactionCrossSectionTable() const;
+
+  //! Check if the absorption reaction cross section table has been created
+  bool hasAbsorptionReactionCrossSectionTable() const;
+
+  //! Return the absorption reaction cross section table
+  const ReactionCrossSectionTableType& getAbsorptionReactionCrossSectionTable() const;
+
 protected:
 
   //! Default constructor
@@ -179,6 +199,17 @@ protected:
   
 private:
 
+  // Create the scattering and absorption reaction cross section tables
+  void createReactionCrossSectionTables(
+                                 const std::vector<double>& energy_grid,
+                                 const Utility::InterpolationType interp_type );
+
+  // Create a reaction cross section table
+  static std::shared_ptr<const ReactionCrossSectionTableType>
+  createReactionCrossSectionTable( const std::vector<double>& energy_grid,
+                                   const ConstReactionMap& reactions,
+                                   const Utility::InterpolationType interp_type );
+
   // The reaction types that will be treated as absorption
   static ReactionEnumTypeSet s_absorption_reaction_types;
 
@@ -197,6 +228,14 @@ private:
   // The miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
 
+  // The scattering reaction cross section table
+  std::shared_ptr<const ReactionCrossSectionTableType>
+  d_scattering_reaction_table;
+
+  // The absorption reaction cross section table
+  std::shared_ptr<const ReactionCrossSectionTableType>
+  d_absorption_reaction_table;
+
   // The atomic relaxation model
   std::shared_ptr<const AtomicRelaxationModel> d_relaxation_model;
 
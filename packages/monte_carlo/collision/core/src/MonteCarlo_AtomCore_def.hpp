@@ -53,6 +53,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_scattering_reactions(),
     d_absorption_reactions(),
     d_miscellaneous_reactions(),
+    d_scattering_reaction_table(),
+    d_absorption_reaction_table(),
     d_relaxation_model( relaxation_model ),
     d_grid_searcher( grid_searcher )
 {
@@ -121,9 +123,11 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
           grid_searcher )
   : d_total_reaction( total_reaction ),
     d_total_absorption_reaction( total_absorption_reaction ),
-    d_scattering_reactions( d_scattering_reactions ),
+    d_scattering_reactions( scattering_reactions ),
     d_absorption_reactions( absorption_reactions ),
     d_miscellaneous_reactions( miscellaneous_reactions ),
+    d_scattering_reaction_table(),
+    d_absorption_reaction_table(),
     d_relaxation_model( relaxation_model ),
     d_grid_searcher( grid_searcher )
 {
@@ -153,6 +157,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::At
     d_scattering_reactions( instance.d_scattering_reactions ),
     d_absorption_reactions( instance.d_absorption_reactions ),
     d_miscellaneous_reactions( instance.d_miscellaneous_reactions ),
+    d_scattering_reaction_table( instance.d_scattering_reaction_table ),
+    d_absorption_reaction_table( instance.d_absorption_reaction_table ),
     d_relaxation_model( instance.d_relaxation_model ),
     d_grid_searcher( instance.d_grid_searcher )
 {
@@ -198,6 +204,8 @@ AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::op
     d_scattering_reactions = instance.d_scattering_reactions;
     d_absorption_reactions = instance.d_absorption_reactions;
     d_miscellaneous_reactions = instance.d_miscellaneous_reactions;
+    d_scattering_reaction_table = instance.d_scattering_reaction_table;
+    d_absorption_reaction_table = instance.d_absorption_reaction_table;
     d_relaxation_model = instance.d_relaxation_model;
     d_grid_searcher = instance.d_grid_searcher;
   }
@@ -457,6 +465,9 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 						  total_threshold_energy_index,
                                                   d_grid_searcher,
                                                   total_reaction_type ) );
+
+  this->createReactionCrossSectionTables( *energy_grid,
+                                          InterpPolicy::getInterpolationType() );
 }
 
 // Calculate the processed total absorption cross section
@@ -532,6 +543,18 @@ void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
                                                   total_threshold_energy_index,
                                                   d_grid_searcher,
                                                   total_reaction_type ) );
+
+  // The reaction cross section tables use the raw energy grid
+  std::vector<double> raw_energy_grid( energy_grid->size() );
+
+  for( size_t i = 0; i < energy_grid->size(); ++i )
+  {
+    raw_energy_grid[i] =
+      InterpPolicy::recoverProcessedIndepVar( (*energy_grid)[i] );
+  }
+
+  this->createReactionCrossSectionTables( raw_energy_grid,
+                                          InterpPolicy::getInterpolationType() );
 }
 
 // Set the absorption reaction types
@@ -757,6 +780,132 @@ bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType
 
   return true;
 }
+
+// Check if the scattering reaction cross section table has been created
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::hasScatteringReactionCrossSectionTable() const
+{
+  return d_scattering_reaction_table.get() != NULL;
+}
+
+// Return the scattering reaction cross section table
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getScatteringReactionCrossSectionTable() const -> const ReactionCrossSectionTableType&
+{
+  // Make sure the table has been created
+  testPrecondition( d_scattering_reaction_table.get() );
+
+  return *d_scattering_reaction_table;
+}
+
+// Check if the absorption reaction cross section table has been created
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline bool AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::hasAbsorptionReactionCrossSectionTable() const
+{
+  return d_absorption_reaction_table.get() != NULL;
+}
+
+// Return the absorption reaction cross section table
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+inline auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::getAbsorptionReactionCrossSectionTable() const -> const ReactionCrossSectionTableType&
+{
+  // Make sure the table has been created
+  testPrecondition( d_absorption_reaction_table.get() );
+
+  return *d_absorption_reaction_table;
+}
+
+// Create the scattering and absorption reaction cross section tables
+/*! \details The tables can only be created when all of the reactions share
+ * the energy grid that is used to create the total reaction (the grid
+ * searcher bin indices must be valid for every reaction) and the
+ * interpolation type of the reactions is supported by the tables. If the
+ * tables cannot be created reactions will be sampled from the reaction maps.
+ */
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+void AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::createReactionCrossSectionTables(
+                                 const std::vector<double>& energy_grid,
+                                 const Utility::InterpolationType interp_type )
+{
+  if( this->hasSharedEnergyGrid() &&
+      ReactionCrossSectionTableType::isInterpolationTypeSupported( interp_type ) )
+  {
+    d_scattering_reaction_table =
+      ThisType::createReactionCrossSectionTable( energy_grid,
+                                                 d_scattering_reactions,
+                                                 interp_type );
+
+    d_absorption_reaction_table =
+      ThisType::createReactionCrossSectionTable( energy_grid,
+                                                 d_absorption_reactions,
+                                                 interp_type );
+  }
+  else
+  {
+    d_scattering_reaction_table.reset();
+    d_absorption_reaction_table.reset();
+  }
+}
+
+// Create a reaction cross section table
+/*! \details The reactions will be stored in the table in the order that
+ * they are visited in the map so that the sampling order is preserved. A
+ * null pointer will be returned if the map is empty.
+ */
+template<typename _ReactionEnumType,
+         typename _ReactionType,
+         typename _ParticleStateType,
+         template<typename,typename,typename...> class MapType,
+         template<typename,typename...> class SetType>
+auto AtomCore<_ReactionEnumType,_ReactionType,_ParticleStateType,MapType,SetType>::createReactionCrossSectionTable(
+                                 const std::vector<double>& energy_grid,
+                                 const ConstReactionMap& reactions,
+                                 const Utility::InterpolationType interp_type )
+  -> std::shared_ptr<const ReactionCrossSectionTableType>
+{
+  std::shared_ptr<const ReactionCrossSectionTableType> table;
+
+  if( reactions.size() > 0 )
+  {
+    typename ReactionCrossSectionTableType::ReactionArray
+      reaction_array( reactions.size() );
+
+    typename ConstReactionMap::const_iterator reaction_it = reactions.begin();
+
+    for( size_t i = 0; i < reaction_array.size(); ++i )
+    {
+      reaction_array[i] = reaction_it->second;
+
+      ++reaction_it;
+    }
+
+    table.reset( new ReactionCrossSectionTableType( energy_grid,
+                                                    reaction_array,
+                                                    interp_type ) );
+  }
+
+  return table;
+}
   
 } // end MonteCarlo namespace
 
@@ -440,6 +440,39 @@ void Atom<AtomCore>::getReactionTypes( ReactionEnumTypeSet& reaction_types ) con
   d_core.getReactionTypes( reaction_types );
 }
 
+// Add the energy grid points of the reactions to an array
+/*! \details The grid points of the total reaction and of any scattering or
+ * absorption reaction that does not share the total reaction energy grid
+ * will be added (duplicate points are not removed). Nuclear reactions are
+ * not considered by default.
+ */
+template<typename AtomCore>
+void Atom<AtomCore>::getEnergyGridPoints(
+                           std::vector<double>& energy_grid_points ) const
+{
+  const typename AtomCore::ReactionType& total_reaction =
+    d_core.getTotalReaction();
+
+  total_reaction.getEnergyGridPoints( energy_grid_points );
+
+  const ConstReactionMap* reaction_maps[2] =
+    {&d_core.getScatteringReactions(), &d_core.getAbsorptionReactions()};
+
+  for( size_t i = 0; i < 2; ++i )
+  {
+    typename ConstReactionMap::const_iterator reaction_it =
+      reaction_maps[i]->begin();
+
+    while( reaction_it != reaction_maps[i]->end() )
+    {
+      if( !reaction_it->second->isEnergyGridShared( total_reaction ) )
+        reaction_it->second->getEnergyGridPoints( energy_grid_points );
+
+      ++reaction_it;
+    }
+  }
+}
+
 // Collide with a particle
 template<typename AtomCore>
 void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
@@ -467,6 +500,7 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   if( scaled_random_number < absorption_cross_section )
   {
     this->sampleAbsorptionReaction( scaled_random_number,
+                                    absorption_cross_section,
                                     energy_grid_bin,
                                     particle,
                                     bank );
@@ -478,6 +512,7 @@ void Atom<AtomCore>::collideAnalogue( ParticleStateType& particle,
   {
     this->sampleScatteringReaction(
                               scaled_random_number - absorption_cross_section,
+                              scattering_cross_section,
                               energy_grid_bin,
                               particle,
                               bank );
@@ -519,6 +554,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
       this->sampleScatteringReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             scattering_cross_section,
+            scattering_cross_section,
             energy_grid_bin,
             particle,
             bank );
@@ -528,6 +564,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
       this->sampleAbsorptionReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             absorption_cross_section,
+            absorption_cross_section,
             energy_grid_bin,
             particle_copy,
             bank );
@@ -537,6 +574,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
       this->sampleAbsorptionReaction(
             Utility::RandomNumberGenerator::getRandomNumber<double>()*
             absorption_cross_section,
+            absorption_cross_section,
             energy_grid_bin,
             particle,
             bank );
@@ -549,6 +587,7 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
     this->sampleScatteringReaction(
           Utility::RandomNumberGenerator::getRandomNumber<double>()*
           scattering_cross_section,
+          scattering_cross_section,
           energy_grid_bin,
           particle,
           bank );
@@ -556,73 +595,119 @@ void Atom<AtomCore>::collideSurvivalBias( ParticleStateType& particle,
 }
 
 // Sample an absorption reaction
+/*! \details If the core has an absorption reaction cross section table the
+ * reaction will be sampled from the table using the fraction of the
+ * absorption cross section that the scaled random number represents.
+ * Otherwise the absorption reaction map will be searched.
+ */
 template<typename AtomCore>
 void Atom<AtomCore>::sampleAbsorptionReaction( const double scaled_random_number,
+                                     const double cross_section,
                                      unsigned energy_grid_bin,
                                      ParticleStateType& particle,
                                      ParticleBank& bank ) const
 {
-  double partial_cross_section = 0.0;
-
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getAbsorptionReactions().begin();
+  Data::SubshellType subshell_vacancy;
 
-  while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+  if( d_core.hasAbsorptionReactionCrossSectionTable() )
+  {
+    // Make sure the cross section is valid
+    testPrecondition( cross_section > 0.0 );
+
+    // Undergo reaction selected
+    d_core.getAbsorptionReactionCrossSectionTable().sampleReaction(
+                                           scaled_random_number/cross_section,
+                                           particle.getEnergy(),
+                                           energy_grid_bin ).react(
+                                                        particle,
+                                                        bank,
+                                                        subshell_vacancy );
+  }
+  else
   {
-    partial_cross_section +=
-      atomic_reaction->second->getCrossSection( particle.getEnergy(),
-                                                energy_grid_bin );
+    double partial_cross_section = 0.0;
 
-    if( scaled_random_number < partial_cross_section )
-      break;
+    typename ConstReactionMap::const_iterator atomic_reaction =
+      d_core.getAbsorptionReactions().begin();
 
-    ++atomic_reaction;
-  }
+    while( atomic_reaction != d_core.getAbsorptionReactions().end() )
+    {
+      partial_cross_section +=
+        atomic_reaction->second->getCrossSection( particle.getEnergy(),
+                                                  energy_grid_bin );
 
-  // Make sure a reaction was selected
-  testPostcondition( atomic_reaction != d_core.getAbsorptionReactions().end() );
+      if( scaled_random_number < partial_cross_section )
+        break;
 
-  // Undergo reaction selected
-  Data::SubshellType subshell_vacancy;
+      ++atomic_reaction;
+    }
 
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
+    // Make sure a reaction was selected
+    testPostcondition( atomic_reaction != d_core.getAbsorptionReactions().end() );
+
+    // Undergo reaction selected
+    atomic_reaction->second->react( particle, bank, subshell_vacancy );
+  }
 
   // Relax the atom
   this->relaxAtom( subshell_vacancy, particle, bank );
 }
 
 // Sample a scattering reaction
+/*! \details If the core has a scattering reaction cross section table the
+ * reaction will be sampled from the table using the fraction of the
+ * scattering cross section that the scaled random number represents.
+ * Otherwise the scattering reaction map will be searched.
+ */
 template<typename AtomCore>
 void Atom<AtomCore>::sampleScatteringReaction(
                                              const double scaled_random_number,
+                                             const double cross_section,
                                              unsigned energy_grid_bin,
                                              ParticleStateType& particle,
                                              ParticleBank& bank ) const
 {
-  double partial_cross_section = 0.0;
-
-  typename ConstReactionMap::const_iterator atomic_reaction =
-    d_core.getScatteringReactions().begin();
+  Data::SubshellType subshell_vacancy;
 
-  while( atomic_reaction != d_core.getScatteringReactions().end() )
+  if( d_core.hasScatteringReactionCrossSectionTable() )
+  {
+    // Make sure the cross section is valid
+    testPrecondition( cross_section > 0.0 );
+
+    // Undergo reaction selected
+    d_core.getScatteringReactionCrossSectionTable().sampleReaction(
+                                           scaled_random_number/cross_section,
+                                           particle.getEnergy(),
+                                           energy_grid_bin ).react(
+                                                        particle,
+                                                        bank,
+                                                        subshell_vacancy );
+  }
+  else
   {
-    partial_cross_section +=
-      atomic_reaction->second->getCrossSection( particle.getEnergy(),
-                                                energy_grid_bin );
+    double partial_cross_section = 0.0;
 
-    if( scaled_random_number < partial_cross_section )
-      break;
+    typename ConstReactionMap::const_iterator atomic_reaction =
+      d_core.getScatteringReactions().begin();
 
-    ++atomic_reaction;
-  }
+    while( atomic_reaction != d_core.getScatteringReactions().end() )
+    {
+      partial_cross_section +=
+        atomic_reaction->second->getCrossSection( particle.getEnergy(),
+                                                  energy_grid_bin );
 
-  // Make sure the reaction was found
-  testPostcondition( atomic_reaction != d_core.getScatteringReactions().end() );
+      if( scaled_random_number < partial_cross_section )
+        break;
 
-  // Undergo reaction selected
-  Data::SubshellType subshell_vacancy;
+      ++atomic_reaction;
+    }
+
+    // Make sure the reaction was found
+    testPostcondition( atomic_reaction != d_core.getScatteringReactions().end() );
 
-  atomic_reaction->second->react( particle, bank, subshell_vacancy );
+    // Undergo reaction selected
+    atomic_reaction->second->react( particle, bank, subshell_vacancy );
+  }
 
   // Relax the atom
   this->relaxAtom( subshell_vacancy, particle, bank );
@@ -16,6 +16,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_HashBasedGridSearcher.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -106,6 +107,22 @@ public:
   virtual void collideSurvivalBias( ParticleStateType& particle,
                                     ParticleBank& bank ) const;
 
+  //! Construct the unionized energy grid (returns the memory used in bytes)
+  uint64_t constructUnionizedEnergyGrid( const double min_energy,
+                                         const double max_energy,
+                                         const uint64_t memory_budget );
+
+  //! Check if the unionized energy grid has been constructed
+  bool hasUnionizedEnergyGrid() const;
+
+  //! Return the number of points in the unionized energy grid
+  size_t getUnionizedEnergyGridSize() const;
+
+  //! Merge the scattering center energy grids
+  void mergeScatteringCenterEnergyGrids( const double min_energy,
+                                         const double max_energy,
+                                         std::vector<double>& energy_grid ) const;
+
 protected:
 
   //! The macroscopic cross section evaluation functor type
@@ -141,6 +158,9 @@ protected:
   //! Return the scattering center at the desired index
   const ScatteringCenter& getScatteringCenter( const size_t index ) const;
 
+  //! Return the number density of the scattering center at the desired index
+  double getScatteringCenterNumberDensity( const size_t index ) const;
+
 private:
 
   // Get the atomic weight from an atom pointer
@@ -150,6 +170,40 @@ private:
   // Sample the atom that is collided with
   size_t sampleCollisionScatteringCenter( const double energy ) const;
 
+
+  // Evaluate the cross sections that get tabulated on the unionized grid
+  void evaluateUnionizedCrossSections(
+                                  const double energy,
+                                  std::vector<double>& cross_sections ) const;
+
+  // Check if the tabulated cross sections can be interpolated in a bin
+  static bool isUnionizedEnergyBinConverged(
+                                   const std::vector<double>& lower_values,
+                                   const std::vector<double>& upper_values,
+                                   const std::vector<double>& mid_values );
+
+  // Find the unionized energy grid bin and the interpolation fraction
+  bool findUnionizedEnergyGridBin( const double energy,
+                                   size_t& bin_index,
+                                   double& interpolation_fraction ) const;
+
+  // Interpolate a cross section that is tabulated on the unionized grid
+  double interpolateUnionizedCrossSection(
+                                     const std::vector<double>& cross_section,
+                                     const size_t bin_index,
+                                     const double interpolation_fraction,
+                                     const size_t stride = 1,
+                                     const size_t offset = 0 ) const;
+
+  // The max relative interpolation error allowed in the unionized grid
+  static const double s_unionized_grid_tolerance;
+
+  // The min relative unionized energy bin width
+  static const double s_unionized_grid_min_relative_bin_width;
+
+  // The number of hash bins used by the unionized grid searcher
+  static const size_t s_unionized_grid_hash_bins;
+
   // The ScatteringCenter::getTotalCrossSection function wrapper
   static MicroscopicCrossSectionEvaluationFunctor s_total_cs_evaluation_functor;
   // The ScatteringCenter::getAbsorptionCrossSection function wrapper
@@ -170,6 +224,23 @@ private:
   // The getMacroscopicTotalCrossSection function wrapper
   MacroscopicCrossSectionEvaluationFunctor
   d_macroscopic_total_cs_evaluation_functor;
+
+  // The unionized energy grid
+  std::shared_ptr<const std::vector<double> > d_unionized_energy_grid;
+
+  // The unionized energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_unionized_grid_searcher;
+
+  // The macroscopic total cross section on the unionized grid
+  std::vector<double> d_unionized_total_cross_section;
+
+  // The macroscopic absorption cross section on the unionized grid
+  std::vector<double> d_unionized_absorption_cross_section;
+
+  // The cumulative scattering center macroscopic total cross sections on the
+  // unionized grid (one row of scattering center values per grid point)
+  std::vector<double> d_unionized_cumulative_cross_sections;
 };
 
 } // end MonteCarlo namespace
@@ -9,8 +9,13 @@
 #ifndef MONTE_CARLO_MATERIAL_DEF_HPP
 #define MONTE_CARLO_MATERIAL_DEF_HPP
 
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
 // FRENSIE Includes
 #include "MonteCarlo_MaterialHelpers.hpp"
+#include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
@@ -33,6 +38,15 @@ Material<ScatteringCenter>::s_absorption_cs_evaluation_functor(
                                                    std::placeholders::_1,
                                                    std::placeholders::_2 ) );
 
+template<typename ScatteringCenter>
+const double Material<ScatteringCenter>::s_unionized_grid_tolerance = 1e-3;
+
+template<typename ScatteringCenter>
+const double Material<ScatteringCenter>::s_unionized_grid_min_relative_bin_width = 1e-9;
+
+template<typename ScatteringCenter>
+const size_t Material<ScatteringCenter>::s_unionized_grid_hash_bins = 1000;
+
 // Constructor (without photonuclear data)
 template<typename ScatteringCenter>
 Material<ScatteringCenter>::Material(
@@ -181,8 +195,21 @@ template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicTotalCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection( energy,
-                                           s_total_cs_evaluation_functor );
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy, bin_index, interpolation_fraction ) )
+  {
+    return this->interpolateUnionizedCrossSection(
+                                               d_unionized_total_cross_section,
+                                               bin_index,
+                                               interpolation_fraction );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection( energy,
+                                             s_total_cs_evaluation_functor );
+  }
 }
 
 // Return the macroscopic absorption cross section (1/cm)
@@ -190,9 +217,22 @@ template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getMacroscopicAbsorptionCrossSection(
 						    const double energy ) const
 {
-  return this->getMacroscopicCrossSection(
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy, bin_index, interpolation_fraction ) )
+  {
+    return this->interpolateUnionizedCrossSection(
+                                          d_unionized_absorption_cross_section,
+                                          bin_index,
+                                          interpolation_fraction );
+  }
+  else
+  {
+    return this->getMacroscopicCrossSection(
                                           energy,
                                           s_absorption_cs_evaluation_functor );
+  }
 }
 
 // Return the macroscopic cross section (1/cm) for a specific reaction
@@ -356,6 +396,15 @@ const ScatteringCenter& Material<ScatteringCenter>::getScatteringCenter( const s
   return *Utility::get<1>( d_scattering_centers[index] );
 }
 
+// Return the number density of the scattering center at the desired index
+template<typename ScatteringCenter>
+double Material<ScatteringCenter>::getScatteringCenterNumberDensity( const size_t index ) const
+{
+  testPrecondition( index < d_scattering_centers.size() );
+
+  return Utility::get<0>( d_scattering_centers[index] );
+}
+
 // Get the atomic weight from an atom pointer
 template<typename ScatteringCenter>
 double Material<ScatteringCenter>::getAtomicWeightFromPair(
@@ -405,13 +454,343 @@ size_t Material<ScatteringCenter>::sampleCollisionScatteringCenterImpl(
 }
 
 // Sample the atom that is collided with
+/*! \details When the unionized energy grid is available the cumulative
+ * scattering center cross sections are interpolated from the tabulated values
+ * so that only a single grid search is required.
+ */
 template<typename ScatteringCenter>
 size_t Material<ScatteringCenter>::sampleCollisionScatteringCenter( const double energy ) const
 {
-  return this->sampleCollisionScatteringCenterImpl(
+  size_t bin_index;
+  double interpolation_fraction;
+
+  if( this->findUnionizedEnergyGridBin( energy, bin_index, interpolation_fraction ) )
+  {
+    const size_t number_of_scattering_centers = d_scattering_centers.size();
+    
+    const double scaled_random_number =
+      Utility::RandomNumberGenerator::getRandomNumber<double>()*
+      this->interpolateUnionizedCrossSection( d_unionized_total_cross_section,
+                                              bin_index,
+                                              interpolation_fraction );
+
+    for( size_t i = 0u; i < number_of_scattering_centers - 1; ++i )
+    {
+      if( scaled_random_number <
+          this->interpolateUnionizedCrossSection(
+                                         d_unionized_cumulative_cross_sections,
+                                         bin_index,
+                                         interpolation_fraction,
+                                         number_of_scattering_centers,
+                                         i ) )
+        return i;
+    }
+
+    return number_of_scattering_centers - 1;
+  }
+  else
+  {
+    return this->sampleCollisionScatteringCenterImpl(
                                      energy,
                                      d_macroscopic_total_cs_evaluation_functor,
                                      s_total_cs_evaluation_functor );
+  }
+}
+
+// Construct the unionized energy grid (returns the memory used in bytes)
+/*! \details The macroscopic total cross section, the macroscopic absorption
+ * cross section and the cumulative scattering center total cross sections
+ * will be tabulated on a material level energy grid. The grid starts as the
+ * union of the scattering center energy grids so that no tabulated
+ * cross section structure will be missed. Each union grid bin is then
+ * bisected until lin-lin interpolation reproduces every tabulated cross
+ * section at the bin midpoint to within a fraction of the macroscopic total
+ * cross section (only scattering centers with data that is not lin-lin,
+ * e.g. log-log photoatomic data, will require extra points). If the grid
+ * will not fit within the memory budget it will be discarded, zero will be
+ * returned and the cross sections will continue to be evaluated from the
+ * scattering centers directly.
+ */
+template<typename ScatteringCenter>
+uint64_t Material<ScatteringCenter>::constructUnionizedEnergyGrid(
+                                                const double min_energy,
+                                                const double max_energy,
+                                                const uint64_t memory_budget )
+{
+  // Make sure that the energy bounds are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+
+  d_unionized_energy_grid.reset();
+  d_unionized_grid_searcher.reset();
+  d_unionized_total_cross_section.clear();
+  d_unionized_absorption_cross_section.clear();
+  d_unionized_cumulative_cross_sections.clear();
+
+  const size_t number_of_scattering_centers = d_scattering_centers.size();
+  
+  // Values per grid point: energy, total, absorption, cumulative totals
+  const uint64_t bytes_per_grid_point =
+    (number_of_scattering_centers + 3)*sizeof(double);
+
+  const uint64_t max_grid_points = memory_budget/bytes_per_grid_point;
+
+  std::vector<double> union_energy_grid;
+
+  this->mergeScatteringCenterEnergyGrids( min_energy,
+                                          max_energy,
+                                          union_energy_grid );
+
+  // The union grid will not fit within the memory budget
+  if( union_energy_grid.size() > max_grid_points )
+    return 0;
+
+  std::vector<double> energy_grid;
+  std::vector<double> tabulated_values;
+
+  energy_grid.reserve( union_energy_grid.size() );
+  tabulated_values.reserve( union_energy_grid.size()*
+                            (number_of_scattering_centers + 2) );
+
+  std::vector<double> lower_values, mid_values;
+  
+  double lower_energy = union_energy_grid.front();
+
+  this->evaluateUnionizedCrossSections( lower_energy, lower_values );
+
+  energy_grid.push_back( lower_energy );
+  tabulated_values.insert( tabulated_values.end(),
+                           lower_values.begin(),
+                           lower_values.end() );
+
+  // The grid points that still need to be processed (upper bin bounds)
+  std::vector<std::pair<double,std::vector<double> > > upper_grid_points;
+
+  for( size_t i = 1; i < union_energy_grid.size(); ++i )
+  {
+    upper_grid_points.resize( 1 );
+    upper_grid_points.front().first = union_energy_grid[i];
+    
+    this->evaluateUnionizedCrossSections( union_energy_grid[i],
+                                          upper_grid_points.front().second );
+
+    while( !upper_grid_points.empty() )
+    {
+      const double upper_bin_energy = upper_grid_points.back().first;
+      const double mid_energy = 0.5*(lower_energy + upper_bin_energy);
+
+      bool bin_converged = true;
+
+      if( upper_bin_energy - lower_energy >
+          s_unionized_grid_min_relative_bin_width*mid_energy )
+      {
+        this->evaluateUnionizedCrossSections( mid_energy, mid_values );
+
+        bin_converged =
+          ThisType::isUnionizedEnergyBinConverged(
+                                             lower_values,
+                                             upper_grid_points.back().second,
+                                             mid_values );
+      }
+
+      if( bin_converged )
+      {
+        lower_energy = upper_bin_energy;
+        lower_values.swap( upper_grid_points.back().second );
+
+        upper_grid_points.pop_back();
+
+        energy_grid.push_back( lower_energy );
+        tabulated_values.insert( tabulated_values.end(),
+                                 lower_values.begin(),
+                                 lower_values.end() );
+
+        // The grid will not fit within the memory budget
+        if( energy_grid.size() > max_grid_points )
+          return 0;
+      }
+      else
+        upper_grid_points.emplace_back( mid_energy, mid_values );
+    }
+  }
+
+  // Split the tabulated values into the cached cross sections
+  const size_t values_per_grid_point = number_of_scattering_centers + 2;
+  
+  d_unionized_total_cross_section.resize( energy_grid.size() );
+  d_unionized_absorption_cross_section.resize( energy_grid.size() );
+  d_unionized_cumulative_cross_sections.resize(
+                           energy_grid.size()*number_of_scattering_centers );
+
+  for( size_t i = 0; i < energy_grid.size(); ++i )
+  {
+    const double* grid_point_values =
+      tabulated_values.data() + i*values_per_grid_point;
+    
+    d_unionized_total_cross_section[i] = grid_point_values[0];
+    d_unionized_absorption_cross_section[i] = grid_point_values[1];
+
+    std::copy( grid_point_values + 2,
+               grid_point_values + values_per_grid_point,
+               d_unionized_cumulative_cross_sections.begin() +
+               i*number_of_scattering_centers );
+  }
+
+  std::shared_ptr<std::vector<double> >
+    unionized_energy_grid( new std::vector<double> );
+
+  unionized_energy_grid->swap( energy_grid );
+  
+  d_unionized_energy_grid = unionized_energy_grid;
+  
+  d_unionized_grid_searcher.reset(
+          new Utility::StandardHashBasedGridSearcher<std::vector<double>,false>(
+                                                 d_unionized_energy_grid,
+                                                 s_unionized_grid_hash_bins ) );
+
+  return d_unionized_energy_grid->size()*bytes_per_grid_point;
+}
+
+// Check if the unionized energy grid has been constructed
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::hasUnionizedEnergyGrid() const
+{
+  return d_unionized_grid_searcher.get() != NULL;
+}
+
+// Return the number of points in the unionized energy grid
+template<typename ScatteringCenter>
+size_t Material<ScatteringCenter>::getUnionizedEnergyGridSize() const
+{
+  if( d_unionized_energy_grid )
+    return d_unionized_energy_grid->size();
+  else
+    return 0;
+}
+
+// Merge the scattering center energy grids
+/*! \details The merged grid will only contain the unique grid points that
+ * fall within the energy bounds (the bounds are always included).
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::mergeScatteringCenterEnergyGrids(
+                                   const double min_energy,
+                                   const double max_energy,
+                                   std::vector<double>& energy_grid ) const
+{
+  energy_grid.clear();
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    Utility::get<1>( d_scattering_centers[i] )->getEnergyGridPoints(
+                                                                energy_grid );
+  }
+
+  energy_grid.erase( std::remove_if( energy_grid.begin(),
+                                     energy_grid.end(),
+                                     [min_energy,max_energy]( const double energy ){
+                                       return energy <= min_energy ||
+                                         energy >= max_energy; } ),
+                     energy_grid.end() );
+
+  energy_grid.push_back( min_energy );
+  energy_grid.push_back( max_energy );
+
+  std::sort( energy_grid.begin(), energy_grid.end() );
+
+  energy_grid.erase( std::unique( energy_grid.begin(), energy_grid.end() ),
+                     energy_grid.end() );
+}
+
+// Evaluate the cross sections that get tabulated on the unionized grid
+/*! \details The cross sections will be stored in the following order:
+ * total, absorption, cumulative scattering center totals.
+ */
+template<typename ScatteringCenter>
+void Material<ScatteringCenter>::evaluateUnionizedCrossSections(
+                                   const double energy,
+                                   std::vector<double>& cross_sections ) const
+{
+  cross_sections.resize( d_scattering_centers.size() + 2 );
+
+  double cumulative_cross_section = 0.0;
+  double absorption_cross_section = 0.0;
+
+  for( size_t i = 0u; i < d_scattering_centers.size(); ++i )
+  {
+    const double number_density = Utility::get<0>( d_scattering_centers[i] );
+    const ScatteringCenter& scattering_center =
+      *Utility::get<1>( d_scattering_centers[i] );
+    
+    cumulative_cross_section += number_density*
+      s_total_cs_evaluation_functor( scattering_center, energy );
+
+    absorption_cross_section += number_density*
+      s_absorption_cs_evaluation_functor( scattering_center, energy );
+
+    cross_sections[i+2] = cumulative_cross_section;
+  }
+
+  cross_sections[0] = cumulative_cross_section;
+  cross_sections[1] = absorption_cross_section;
+}
+
+// Check if the tabulated cross sections can be interpolated in a bin
+template<typename ScatteringCenter>
+bool Material<ScatteringCenter>::isUnionizedEnergyBinConverged(
+                                   const std::vector<double>& lower_values,
+                                   const std::vector<double>& upper_values,
+                                   const std::vector<double>& mid_values )
+{
+  // The interpolation error is measured relative to the total cross section
+  const double max_error = s_unionized_grid_tolerance*mid_values[0];
+
+  for( size_t i = 0; i < mid_values.size(); ++i )
+  {
+    if( std::fabs( 0.5*(lower_values[i] + upper_values[i]) - mid_values[i] ) >
+        max_error )
+      return false;
+  }
+
+  return true;
+}
+
+// Find the unionized energy grid bin and the interpolation fraction
+template<typename ScatteringCenter>
+inline bool Material<ScatteringCenter>::findUnionizedEnergyGridBin(
+                                        const double energy,
+                                        size_t& bin_index,
+                                        double& interpolation_fraction ) const
+{
+  if( !d_unionized_grid_searcher )
+    return false;
+
+  if( !d_unionized_grid_searcher->isValueWithinGridBounds( energy ) )
+    return false;
+
+  bin_index = d_unionized_grid_searcher->findLowerBinIndex( energy );
+
+  const double lower_energy = (*d_unionized_energy_grid)[bin_index];
+
+  interpolation_fraction = (energy - lower_energy)/
+    ((*d_unionized_energy_grid)[bin_index+1] - lower_energy);
+
+  return true;
+}
+
+// Interpolate a cross section that is tabulated on the unionized grid
+template<typename ScatteringCenter>
+inline double Material<ScatteringCenter>::interpolateUnionizedCrossSection(
+                                     const std::vector<double>& cross_section,
+                                     const size_t bin_index,
+                                     const double interpolation_fraction,
+                                     const size_t stride,
+                                     const size_t offset ) const
+{
+  const double lower_value = cross_section[bin_index*stride + offset];
+  
+  return lower_value + interpolation_fraction*
+    (cross_section[(bin_index+1)*stride + offset] - lower_value);
 }
 
 } // end MonteCarlo namespace
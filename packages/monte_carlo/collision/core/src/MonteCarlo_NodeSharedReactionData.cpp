@@ -0,0 +1,268 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_NodeSharedReactionData.cpp
+//! \author Alex Robinson
+//! \brief  The node shared reaction data class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+
+// Boost Includes
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NodeSharedReactionData.hpp"
+#include "Utility_NodeSharedMemory.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+/*! \details Each cross section starts on a cache line of the shared memory.
+ */
+const size_t NodeSharedReactionData::s_cross_section_alignment = 64;
+
+std::shared_ptr<const Utility::Communicator> NodeSharedReactionData::s_node_comm;
+
+bool NodeSharedReactionData::s_arena_open = false;
+
+std::vector<NodeSharedReactionData::QueuedCrossSection>
+NodeSharedReactionData::s_queued_cross_sections;
+
+std::unordered_map<const Utility::ArrayView<const double>*,size_t>
+NodeSharedReactionData::s_queued_cross_section_indices;
+
+// Constructor (open the arena)
+NodeSharedReactionData::CrossSectionArena::CrossSectionArena()
+{
+  TEST_FOR_EXCEPTION( s_arena_open,
+                      std::runtime_error,
+                      "A cross section arena is already open!" );
+
+  s_arena_open = true;
+}
+
+// Destructor (close the arena)
+NodeSharedReactionData::CrossSectionArena::~CrossSectionArena()
+{
+  this->close();
+}
+
+// Close the arena
+void NodeSharedReactionData::CrossSectionArena::close()
+{
+  s_queued_cross_sections.clear();
+  s_queued_cross_section_indices.clear();
+
+  s_arena_open = false;
+}
+
+// Share the queued cross sections with the other processes of the node
+/*! \details The queued cross sections will be copied to a single block of
+ * node shared memory (only the cross sections of the root process of the
+ * node communicator are copied). The views will then refer to the node
+ * shared memory and the owners will be replaced by the node shared memory,
+ * which releases the private cross sections if they have no other owners.
+ * Every process of the node must have queued cross sections of the same
+ * sizes in the same order - an exception will be thrown by every process if
+ * this is not the case. The arena will be closed once the cross sections
+ * have been shared.
+ */
+void NodeSharedReactionData::CrossSectionArena::share()
+{
+  // Make sure the arena is open
+  testPrecondition( s_arena_open );
+
+  if( !NodeSharedReactionData::isReactionDataShared() )
+  {
+    this->close();
+
+    return;
+  }
+
+  // Layout the cross sections in the shared memory
+  std::vector<size_t> cross_section_sizes;
+  cross_section_sizes.reserve( s_queued_cross_sections.size() );
+
+  std::vector<size_t> cross_section_offsets;
+  cross_section_offsets.reserve( s_queued_cross_sections.size() );
+
+  size_t shared_memory_size = 0;
+
+  for( size_t i = 0; i < s_queued_cross_sections.size(); ++i )
+  {
+    // Cancelled cross sections are skipped
+    if( !s_queued_cross_sections[i].first )
+      continue;
+
+    cross_section_sizes.push_back( s_queued_cross_sections[i].first->size() );
+    cross_section_offsets.push_back( shared_memory_size );
+
+    shared_memory_size += ((cross_section_sizes.back()*sizeof(double) +
+                            s_cross_section_alignment - 1)/
+                           s_cross_section_alignment)*s_cross_section_alignment;
+  }
+
+  // Make sure that every process of the node queued the same cross sections
+  std::vector<size_t> root_cross_section_sizes;
+
+  if( s_node_comm->rank() == 0 )
+    root_cross_section_sizes = cross_section_sizes;
+
+  Utility::broadcast( *s_node_comm, root_cross_section_sizes, 0 );
+
+  int consistent_layout =
+    (root_cross_section_sizes == cross_section_sizes ? 1 : 0);
+
+  Utility::allReduce( *s_node_comm,
+                      consistent_layout,
+                      Utility::minimum<int>() );
+
+  if( consistent_layout == 0 )
+    this->close();
+
+  TEST_FOR_EXCEPTION( consistent_layout == 0,
+                      std::runtime_error,
+                      "The processes of the node did not construct the same "
+                      "reactions in the same order - the cross sections "
+                      "cannot be shared!" );
+
+  // Copy the cross sections of the root process to the shared memory
+  std::vector<const double*> cross_sections;
+  cross_sections.reserve( cross_section_sizes.size() );
+
+  for( size_t i = 0; i < s_queued_cross_sections.size(); ++i )
+  {
+    if( s_queued_cross_sections[i].first )
+      cross_sections.push_back( s_queued_cross_sections[i].first->data() );
+  }
+
+  std::shared_ptr<const Utility::NodeSharedMemory> shared_cross_sections =
+    std::make_shared<const Utility::NodeSharedMemory>(
+            *s_node_comm,
+            shared_memory_size,
+            [&cross_sections, &cross_section_sizes, &cross_section_offsets]( void* address ){
+              for( size_t i = 0; i < cross_sections.size(); ++i )
+              {
+                std::copy( cross_sections[i],
+                           cross_sections[i]+cross_section_sizes[i],
+                           reinterpret_cast<double*>( static_cast<char*>( address ) + cross_section_offsets[i] ) );
+              }
+            } );
+
+  // Refer to the shared cross sections
+  const char* shared_address =
+    static_cast<const char*>( shared_cross_sections->getAddress() );
+
+  size_t j = 0;
+
+  for( size_t i = 0; i < s_queued_cross_sections.size(); ++i )
+  {
+    if( !s_queued_cross_sections[i].first )
+      continue;
+
+    *s_queued_cross_sections[i].first = Utility::ArrayView<const double>(
+                         reinterpret_cast<const double*>(
+                                   shared_address + cross_section_offsets[j] ),
+                         cross_section_sizes[j] );
+
+    *s_queued_cross_sections[i].second = shared_cross_sections;
+
+    ++j;
+  }
+
+  this->close();
+}
+
+// Set the node communicator used to share the reaction data
+/*! \details This must be done on every process of the node before any of
+ * the collision handlers are created. Sharing a cross section arena is a
+ * collective operation on the node communicator: every process of the node
+ * must create the same filled geometry models (and therefore the same
+ * scattering center factories and reactions) in the same order. If the
+ * processes create different reactions the sharing of the arena will fail
+ * on every process. If a process does not create a filled geometry model at
+ * all, the other processes of the node will wait for it indefinitely.
+ */
+void NodeSharedReactionData::setNodeCommunicator(
+                 const std::shared_ptr<const Utility::Communicator>& node_comm )
+{
+  // Make sure the communicator is valid
+  testPrecondition( node_comm.get() );
+
+  s_node_comm = node_comm;
+}
+
+// Unset the node communicator used to share the reaction data
+void NodeSharedReactionData::unsetNodeCommunicator()
+{
+  s_node_comm.reset();
+}
+
+// Check if the reaction data is shared within nodes
+bool NodeSharedReactionData::isReactionDataShared()
+{
+  return s_node_comm && s_node_comm->size() > 1;
+}
+
+// Check if a cross section arena is open
+bool NodeSharedReactionData::isCrossSectionArenaOpen()
+{
+  return s_arena_open;
+}
+
+// Return the number of queued cross sections
+size_t NodeSharedReactionData::getNumberOfQueuedCrossSections()
+{
+  return s_queued_cross_section_indices.size();
+}
+
+// Share a cross section with the other processes of the node
+/*! \details If the reaction data is shared within nodes and a cross section
+ * arena is open, the cross section will be queued. The view and the owner
+ * will be modified when the arena is shared, so they must not be destroyed
+ * before the arena is shared unless the sharing is cancelled (see
+ * MonteCarlo::NodeSharedReactionData::cancelCrossSectionSharing).
+ * Otherwise the cross section and the owner will not be modified.
+ */
+void NodeSharedReactionData::shareCrossSection(
+                            Utility::ArrayView<const double>& cross_section,
+                            std::shared_ptr<const void>& cross_section_owner )
+{
+  if( !s_arena_open || !NodeSharedReactionData::isReactionDataShared() )
+    return;
+
+  s_queued_cross_section_indices[&cross_section] =
+    s_queued_cross_sections.size();
+
+  s_queued_cross_sections.push_back(
+                  QueuedCrossSection( &cross_section, &cross_section_owner ) );
+}
+
+// Cancel the sharing of a queued cross section
+void NodeSharedReactionData::cancelCrossSectionSharing(
+                      const Utility::ArrayView<const double>& cross_section )
+{
+  if( s_queued_cross_section_indices.empty() )
+    return;
+
+  std::unordered_map<const Utility::ArrayView<const double>*,size_t>::iterator
+    index_it = s_queued_cross_section_indices.find( &cross_section );
+
+  if( index_it != s_queued_cross_section_indices.end() )
+  {
+    s_queued_cross_sections[index_it->second] =
+      QueuedCrossSection( NULL, NULL );
+
+    s_queued_cross_section_indices.erase( index_it );
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_NodeSharedReactionData.cpp
+//---------------------------------------------------------------------------//
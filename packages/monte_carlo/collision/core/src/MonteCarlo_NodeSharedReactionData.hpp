@@ -0,0 +1,124 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_NodeSharedReactionData.hpp
+//! \author Alex Robinson
+//! \brief  The node shared reaction data class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_NODE_SHARED_REACTION_DATA_HPP
+#define MONTE_CARLO_NODE_SHARED_REACTION_DATA_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_Communicator.hpp"
+#include "Utility_ArrayView.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Map.hpp"
+
+namespace MonteCarlo{
+
+/*! The node shared reaction data class
+ * \details When a node communicator has been set (see
+ * Utility::Communicator::splitByNode), the cross section of every reaction
+ * that is constructed (see MonteCarlo::StandardReactionBaseImpl) while a
+ * cross section arena is open will be queued. When the arena is shared, the
+ * queued cross sections are packed into a single block of memory that is
+ * shared by every process of the node and the private copies are released.
+ * The filled geometry models open an arena around each scattering center
+ * factory (see MonteCarlo::StandardFilledParticleGeometryModel), so the cross
+ * sections created by the ACE and the native collision handler factories are
+ * stored once per node instead of once per process, using one memory
+ * mapping and one collective operation per factory. The energy grids and the
+ * grid searchers are also referenced by the nuclides and atoms (and by the
+ * hash-based grid searchers), which store them as std::vector objects, so
+ * they are not shared.
+ */
+class NodeSharedReactionData
+{
+
+public:
+
+  /*! The cross section arena
+   * \details The cross sections of the reactions that are constructed
+   * while an arena is open will be queued. Sharing the arena is a collective
+   * operation on the node communicator. If the arena is destroyed before it
+   * is shared the queued cross sections will remain private. Arenas cannot
+   * be nested and must only be used by a single thread.
+   */
+  class CrossSectionArena
+  {
+
+  public:
+
+    //! Constructor (open the arena)
+    CrossSectionArena();
+
+    //! Destructor (close the arena)
+    ~CrossSectionArena();
+
+    //! Share the queued cross sections with the other processes of the node
+    void share();
+
+  private:
+
+    // Close the arena
+    void close();
+  };
+
+  //! Set the node communicator used to share the reaction data
+  static void setNodeCommunicator(
+                const std::shared_ptr<const Utility::Communicator>& node_comm );
+
+  //! Unset the node communicator used to share the reaction data
+  static void unsetNodeCommunicator();
+
+  //! Check if the reaction data is shared within nodes
+  static bool isReactionDataShared();
+
+  //! Check if a cross section arena is open
+  static bool isCrossSectionArenaOpen();
+
+  //! Return the number of queued cross sections
+  static size_t getNumberOfQueuedCrossSections();
+
+  //! Share a cross section with the other processes of the node
+  static void shareCrossSection(
+                           Utility::ArrayView<const double>& cross_section,
+                           std::shared_ptr<const void>& cross_section_owner );
+
+  //! Cancel the sharing of a queued cross section
+  static void cancelCrossSectionSharing(
+                     const Utility::ArrayView<const double>& cross_section );
+
+private:
+
+  // The queued cross section type
+  typedef std::pair<Utility::ArrayView<const double>*,std::shared_ptr<const void>*> QueuedCrossSection;
+
+  // The alignment of each cross section in the shared memory (bytes)
+  static const size_t s_cross_section_alignment;
+
+  // The node communicator used to share the reaction data
+  static std::shared_ptr<const Utility::Communicator> s_node_comm;
+
+  // Records if a cross section arena is open
+  static bool s_arena_open;
+
+  // The queued cross sections (in the order that they were queued)
+  static std::vector<QueuedCrossSection> s_queued_cross_sections;
+
+  // The index of each queued cross section
+  static std::unordered_map<const Utility::ArrayView<const double>*,size_t>
+  s_queued_cross_section_indices;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_NODE_SHARED_REACTION_DATA_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_NodeSharedReactionData.hpp
+//---------------------------------------------------------------------------//
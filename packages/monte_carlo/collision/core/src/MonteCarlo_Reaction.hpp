@@ -10,6 +10,7 @@
 #define MONTE_CARLO_REACTION_HPP
 
 #include <cstddef>
+#include <vector>
 
 namespace MonteCarlo{
 
@@ -39,6 +40,9 @@ public:
   //! Return the max energy
   virtual double getMaxEnergy() const = 0;
 
+  //! Add the energy grid points (threshold energy to max energy) to an array
+  virtual void getEnergyGridPoints( std::vector<double>& energy_grid_points ) const;
+
   //! Return the cross section at the given energy
   virtual double getCrossSection( const double energy ) const = 0;
 
@@ -58,6 +62,18 @@ inline bool Reaction::isEnergyGridShared( const Reaction& other_reaction ) const
   return this->getEnergyGridHead() == other_reaction.getEnergyGridHead();
 }
 
+// Add the energy grid points (threshold energy to max energy) to an array
+/*! \details By default only the threshold energy and the max energy will be
+ * added. Reactions that store a tabulated cross section should add every
+ * energy grid point.
+ */
+inline void Reaction::getEnergyGridPoints(
+                           std::vector<double>& energy_grid_points ) const
+{
+  energy_grid_points.push_back( this->getThresholdEnergy() );
+  energy_grid_points.push_back( this->getMaxEnergy() );
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_REACTION_HPP
@@ -0,0 +1,152 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ReactionCrossSectionTable.hpp
+//! \author Alex Robinson
+//! \brief  The reaction cross section table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+#define MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_InterpolationType.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The reaction cross section table class
+ * \details This class stores the cumulative cross sections of a group of
+ * reactions that share a common (union) energy grid in a single contiguous
+ * array (structure-of-arrays layout). The cumulative cross sections
+ * at grid point i are stored in row i so that selecting a reaction only
+ * requires a single linearly interpolated cumulative sum over two adjacent
+ * rows of the table - no virtual calls or map iterations are required. The
+ * reaction cross sections are evaluated on the energy grid when the table
+ * is constructed, which means that the table is exact at every grid point.
+ * Between grid points the interpolation type of the reactions is used
+ * (lin-lin, lin-log, log-lin or log-log). When the cross sections are
+ * interpolated logarithmically the individual reaction cross sections and
+ * the log of the ratio of their values in each bin are stored instead of
+ * the cumulative cross sections (the interpolated cross sections are not
+ * linear in the cumulative cross sections). The reactions are stored in the
+ * order that they are provided.
+ */
+template<typename ReactionType>
+class ReactionCrossSectionTable
+{
+
+public:
+
+  //! Typedef for the reaction array
+  typedef std::vector<std::shared_ptr<const ReactionType> > ReactionArray;
+
+  //! Constructor
+  ReactionCrossSectionTable( const std::vector<double>& energy_grid,
+                             const ReactionArray& reactions,
+                             const Utility::InterpolationType interp_type =
+                             Utility::LINLIN_INTERPOLATION );
+
+  //! Destructor
+  ~ReactionCrossSectionTable()
+  { /* ... */ }
+
+  //! Check if an interpolation type is supported by the table
+  static bool isInterpolationTypeSupported(
+                                const Utility::InterpolationType interp_type );
+
+  //! Return the interpolation type used by the table
+  Utility::InterpolationType getInterpolationType() const;
+
+  //! Return the number of reactions in the table
+  size_t getNumberOfReactions() const;
+
+  //! Return the number of energy grid points in the table
+  size_t getNumberOfEnergies() const;
+
+  //! Return the reaction at the desired index
+  const ReactionType& getReaction( const size_t reaction_index ) const;
+
+  //! Return the threshold energy index of the reaction at the desired index
+  size_t getThresholdEnergyIndex( const size_t reaction_index ) const;
+
+  //! Return the cross section of the reaction at the desired index
+  double getCrossSection( const size_t reaction_index,
+                          const double energy,
+                          const size_t energy_grid_bin ) const;
+
+  //! Return the sum of the reaction cross sections
+  double getTotalCrossSection( const double energy,
+                               const size_t energy_grid_bin ) const;
+
+  //! Sample the index of a reaction
+  size_t sampleReactionIndex( const double random_number,
+                              const double energy,
+                              const size_t energy_grid_bin ) const;
+
+  //! Sample a reaction
+  const ReactionType& sampleReaction( const double random_number,
+                                      const double energy,
+                                      const size_t energy_grid_bin ) const;
+
+private:
+
+  // Calculate the interpolation fraction
+  double calculateInterpolationFraction( const double energy,
+                                         const size_t energy_grid_bin ) const;
+
+  // Calculate a log interpolated reaction cross section
+  double calculateLogInterpolatedCrossSection(
+                                         const size_t reaction_index,
+                                         const double interp_fraction,
+                                         const size_t energy_grid_bin ) const;
+
+  // The interpolation type
+  Utility::InterpolationType d_interp_type;
+
+  // Use log interpolation in the energy
+  bool d_log_energy_interpolation;
+
+  // Use log interpolation in the cross sections
+  bool d_log_cross_section_interpolation;
+
+  // The raw energy grid
+  std::vector<double> d_energy_grid;
+
+  // The reactions
+  ReactionArray d_reactions;
+
+  // The threshold energy index of each reaction
+  std::vector<size_t> d_threshold_energy_indices;
+
+  // The cumulative cross sections (row i stores grid point i - lin cross
+  // section interpolation only)
+  std::vector<double> d_cumulative_cross_sections;
+
+  // The reaction cross sections (row i stores grid point i - log cross
+  // section interpolation only)
+  std::vector<double> d_cross_sections;
+
+  // The log of the ratio of the upper and lower reaction cross sections
+  // (row i stores bin i - log cross section interpolation only)
+  std::vector<double> d_log_cross_section_ratios;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_ReactionCrossSectionTable_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ReactionCrossSectionTable.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,378 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ReactionCrossSectionTable_def.hpp
+//! \author Alex Robinson
+//! \brief  The reaction cross section table class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+#define MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The energy grid must be the raw (unprocessed) union energy grid
+ * that is shared by all of the reactions. Each reaction cross section will
+ * be evaluated at every grid point. The interpolation type must be the
+ * interpolation type used by the reactions (see
+ * MonteCarlo::ReactionCrossSectionTable::isInterpolationTypeSupported).
+ */
+template<typename ReactionType>
+ReactionCrossSectionTable<ReactionType>::ReactionCrossSectionTable(
+                                  const std::vector<double>& energy_grid,
+                                  const ReactionArray& reactions,
+                                  const Utility::InterpolationType interp_type )
+  : d_interp_type( interp_type ),
+    d_log_energy_interpolation( interp_type == Utility::LINLOG_INTERPOLATION ||
+                                interp_type == Utility::LOGLOG_INTERPOLATION ),
+    d_log_cross_section_interpolation(
+                                interp_type == Utility::LOGLIN_INTERPOLATION ||
+                                interp_type == Utility::LOGLOG_INTERPOLATION ),
+    d_energy_grid( energy_grid ),
+    d_reactions( reactions ),
+    d_threshold_energy_indices( reactions.size(), energy_grid.size() ),
+    d_cumulative_cross_sections(),
+    d_cross_sections(),
+    d_log_cross_section_ratios()
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid.size() > 1 );
+  testPrecondition( std::is_sorted( energy_grid.begin(), energy_grid.end() ) );
+  // Make sure there is at least one reaction
+  testPrecondition( reactions.size() > 0 );
+  // Make sure the interpolation type is supported
+  testPrecondition( isInterpolationTypeSupported( interp_type ) );
+  // Make sure the energy grid is valid for log energy interpolation
+  testPrecondition( !d_log_energy_interpolation || energy_grid.front() > 0.0 );
+
+  const size_t number_of_reactions = d_reactions.size();
+
+  if( d_log_cross_section_interpolation )
+    d_cross_sections.resize( d_energy_grid.size()*number_of_reactions );
+  else
+    d_cumulative_cross_sections.resize( d_energy_grid.size()*number_of_reactions );
+
+  for( size_t i = 0; i < d_energy_grid.size(); ++i )
+  {
+    // The last grid point must be evaluated in the last bin
+    const size_t bin_index = (i < d_energy_grid.size() - 1 ? i : i-1);
+
+    double cumulative_cross_section = 0.0;
+
+    for( size_t j = 0; j < number_of_reactions; ++j )
+    {
+      const double cross_section =
+        d_reactions[j]->getCrossSection( d_energy_grid[i], bin_index );
+
+      if( cross_section > 0.0 && d_threshold_energy_indices[j] > i )
+        d_threshold_energy_indices[j] = i;
+
+      if( d_log_cross_section_interpolation )
+        d_cross_sections[i*number_of_reactions+j] = cross_section;
+      else
+      {
+        cumulative_cross_section += cross_section;
+
+        d_cumulative_cross_sections[i*number_of_reactions+j] =
+          cumulative_cross_section;
+      }
+    }
+  }
+
+  // The log of the cross section ratio in each bin must be cached
+  if( d_log_cross_section_interpolation )
+  {
+    d_log_cross_section_ratios.resize( (d_energy_grid.size()-1)*number_of_reactions );
+
+    for( size_t i = 0; i < d_energy_grid.size() - 1; ++i )
+    {
+      for( size_t j = 0; j < number_of_reactions; ++j )
+      {
+        const double lower_cross_section =
+          d_cross_sections[i*number_of_reactions+j];
+        const double upper_cross_section =
+          d_cross_sections[(i+1)*number_of_reactions+j];
+
+        double& log_ratio = d_log_cross_section_ratios[i*number_of_reactions+j];
+
+        // The cross section is zero below the threshold grid point
+        if( lower_cross_section <= 0.0 )
+          log_ratio = 0.0;
+        // The log of a zero cross section is approximated by the log of the
+        // smallest positive value
+        else if( upper_cross_section <= 0.0 )
+        {
+          log_ratio = std::log( std::numeric_limits<double>::min()/
+                                lower_cross_section );
+        }
+        else
+          log_ratio = std::log( upper_cross_section/lower_cross_section );
+      }
+    }
+  }
+}
+
+// Check if an interpolation type is supported by the table
+template<typename ReactionType>
+inline bool ReactionCrossSectionTable<ReactionType>::isInterpolationTypeSupported(
+                                 const Utility::InterpolationType interp_type )
+{
+  return interp_type == Utility::LINLIN_INTERPOLATION ||
+    interp_type == Utility::LINLOG_INTERPOLATION ||
+    interp_type == Utility::LOGLIN_INTERPOLATION ||
+    interp_type == Utility::LOGLOG_INTERPOLATION;
+}
+
+// Return the interpolation type used by the table
+template<typename ReactionType>
+inline Utility::InterpolationType ReactionCrossSectionTable<ReactionType>::getInterpolationType() const
+{
+  return d_interp_type;
+}
+
+// Return the number of reactions in the table
+template<typename ReactionType>
+inline size_t ReactionCrossSectionTable<ReactionType>::getNumberOfReactions() const
+{
+  return d_reactions.size();
+}
+
+// Return the number of energy grid points in the table
+template<typename ReactionType>
+inline size_t ReactionCrossSectionTable<ReactionType>::getNumberOfEnergies() const
+{
+  return d_energy_grid.size();
+}
+
+// Return the reaction at the desired index
+template<typename ReactionType>
+inline const ReactionType& ReactionCrossSectionTable<ReactionType>::getReaction(
+                                            const size_t reaction_index ) const
+{
+  // Make sure the reaction index is valid
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  return *d_reactions[reaction_index];
+}
+
+// Return the threshold energy index of the reaction at the desired index
+/*! \details The threshold energy index is the index of the first grid point
+ * where the reaction cross section is nonzero. If the reaction cross section
+ * is zero at every grid point the number of energies will be returned.
+ */
+template<typename ReactionType>
+inline size_t ReactionCrossSectionTable<ReactionType>::getThresholdEnergyIndex(
+                                            const size_t reaction_index ) const
+{
+  // Make sure the reaction index is valid
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  return d_threshold_energy_indices[reaction_index];
+}
+
+// Calculate the interpolation fraction
+/*! \details The interpolation fraction is calculated from the processed
+ * energies (the log of the energies when log energy interpolation is used).
+ */
+template<typename ReactionType>
+inline double ReactionCrossSectionTable<ReactionType>::calculateInterpolationFraction(
+                                           const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  // Make sure the energy grid bin is valid
+  testPrecondition( energy_grid_bin < d_energy_grid.size() - 1 );
+
+  if( d_log_energy_interpolation )
+  {
+    return std::log( energy/d_energy_grid[energy_grid_bin] )/
+      std::log( d_energy_grid[energy_grid_bin+1]/
+                d_energy_grid[energy_grid_bin] );
+  }
+  else
+  {
+    return (energy - d_energy_grid[energy_grid_bin])/
+      (d_energy_grid[energy_grid_bin+1] - d_energy_grid[energy_grid_bin]);
+  }
+}
+
+// Calculate a log interpolated reaction cross section
+template<typename ReactionType>
+inline double ReactionCrossSectionTable<ReactionType>::calculateLogInterpolatedCrossSection(
+                                           const size_t reaction_index,
+                                           const double interp_fraction,
+                                           const size_t energy_grid_bin ) const
+{
+  const size_t index =
+    energy_grid_bin*d_reactions.size() + reaction_index;
+
+  return d_cross_sections[index]*
+    std::exp( interp_fraction*d_log_cross_section_ratios[index] );
+}
+
+// Return the cross section of the reaction at the desired index
+template<typename ReactionType>
+double ReactionCrossSectionTable<ReactionType>::getCrossSection(
+                                           const size_t reaction_index,
+                                           const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  // Make sure the reaction index is valid
+  testPrecondition( reaction_index < d_reactions.size() );
+
+  const double interp_fraction =
+    this->calculateInterpolationFraction( energy, energy_grid_bin );
+
+  if( d_log_cross_section_interpolation )
+  {
+    return this->calculateLogInterpolatedCrossSection( reaction_index,
+                                                       interp_fraction,
+                                                       energy_grid_bin );
+  }
+
+  const size_t number_of_reactions = d_reactions.size();
+
+  const double* lower_row = d_cumulative_cross_sections.data() +
+    energy_grid_bin*number_of_reactions;
+  const double* upper_row = lower_row + number_of_reactions;
+
+  double lower_cross_section = lower_row[reaction_index];
+  double upper_cross_section = upper_row[reaction_index];
+
+  if( reaction_index > 0 )
+  {
+    lower_cross_section -= lower_row[reaction_index-1];
+    upper_cross_section -= upper_row[reaction_index-1];
+  }
+
+  return lower_cross_section +
+    interp_fraction*(upper_cross_section - lower_cross_section);
+}
+
+// Return the sum of the reaction cross sections
+template<typename ReactionType>
+inline double ReactionCrossSectionTable<ReactionType>::getTotalCrossSection(
+                                           const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  const double interp_fraction =
+    this->calculateInterpolationFraction( energy, energy_grid_bin );
+
+  const size_t number_of_reactions = d_reactions.size();
+
+  if( d_log_cross_section_interpolation )
+  {
+    double total_cross_section = 0.0;
+
+    for( size_t j = 0; j < number_of_reactions; ++j )
+    {
+      total_cross_section +=
+        this->calculateLogInterpolatedCrossSection( j,
+                                                    interp_fraction,
+                                                    energy_grid_bin );
+    }
+
+    return total_cross_section;
+  }
+
+  const double lower_cross_section =
+    d_cumulative_cross_sections[(energy_grid_bin+1)*number_of_reactions-1];
+  const double upper_cross_section =
+    d_cumulative_cross_sections[(energy_grid_bin+2)*number_of_reactions-1];
+
+  return lower_cross_section +
+    interp_fraction*(upper_cross_section - lower_cross_section);
+}
+
+// Sample the index of a reaction
+/*! \details The random number must be in [0,1]. Because the interpolated
+ * cumulative cross sections are monotonic, the index of the sampled
+ * reaction is equal to the number of interpolated cumulative cross sections
+ * that are less than or equal to the scaled random number. This count
+ * has no data dependent branches, which allows the compiler to vectorize
+ * the loop. When the cross sections are interpolated logarithmically the
+ * cumulative cross sections must be accumulated from the interpolated
+ * reaction cross sections.
+ */
+template<typename ReactionType>
+inline size_t ReactionCrossSectionTable<ReactionType>::sampleReactionIndex(
+                                           const double random_number,
+                                           const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const double interp_fraction =
+    this->calculateInterpolationFraction( energy, energy_grid_bin );
+
+  const size_t number_of_reactions = d_reactions.size();
+
+  size_t reaction_index = 0;
+
+  if( d_log_cross_section_interpolation )
+  {
+    const double scaled_random_number = random_number*
+      this->getTotalCrossSection( energy, energy_grid_bin );
+
+    double cumulative_cross_section = 0.0;
+
+    for( size_t j = 0; j < number_of_reactions; ++j )
+    {
+      cumulative_cross_section +=
+        this->calculateLogInterpolatedCrossSection( j,
+                                                    interp_fraction,
+                                                    energy_grid_bin );
+
+      reaction_index += (scaled_random_number >= cumulative_cross_section);
+    }
+  }
+  else
+  {
+    const double* lower_row = d_cumulative_cross_sections.data() +
+      energy_grid_bin*number_of_reactions;
+    const double* upper_row = lower_row + number_of_reactions;
+
+    const double scaled_random_number = random_number*
+      (lower_row[number_of_reactions-1] + interp_fraction*
+       (upper_row[number_of_reactions-1] - lower_row[number_of_reactions-1]));
+
+    for( size_t j = 0; j < number_of_reactions; ++j )
+    {
+      reaction_index += (scaled_random_number >=
+                         lower_row[j] + interp_fraction*(upper_row[j] - lower_row[j]));
+    }
+  }
+
+  // Guard against round-off and a zero total cross section
+  return std::min( reaction_index, number_of_reactions - 1 );
+}
+
+// Sample a reaction
+template<typename ReactionType>
+inline const ReactionType& ReactionCrossSectionTable<ReactionType>::sampleReaction(
+                                           const double random_number,
+                                           const double energy,
+                                           const size_t energy_grid_bin ) const
+{
+  return *d_reactions[this->sampleReactionIndex( random_number,
+                                                 energy,
+                                                 energy_grid_bin )];
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_REACTION_CROSS_SECTION_TABLE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ReactionCrossSectionTable_def.hpp
+//---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "Utility_Vector.hpp"
+#include "Utility_ArrayView.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_HashBasedGridSearcher.hpp"
 
@@ -31,7 +32,9 @@ namespace MonteCarlo{
  * ACE photon library would use the Utility::LogLog policy with
  * processed_cross_section = true. Cross section data from a ACE neutron
  * library or a native library would use Utility::LinLin with
- * processed_cross_section = false.
+ * processed_cross_section = false. The cross section will be stored once per
+ * node when the reaction data is shared within nodes (see
+ * MonteCarlo::NodeSharedReactionData).
  */
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -56,8 +59,7 @@ public:
      grid_searcher );
 
   //! Destructor
-  virtual ~StandardReactionBaseImpl()
-  { /* ... */ }
+  virtual ~StandardReactionBaseImpl();
 
   //! Test if the energy falls within the energy grid
   bool isEnergyWithinEnergyGrid( const double energy ) const final override;
@@ -75,6 +77,10 @@ public:
   //! Return the threshold energy
   double getThresholdEnergy() const final override;
 
+  //! Add the energy grid points (threshold energy to max energy) to an array
+  void getEnergyGridPoints(
+            std::vector<double>& energy_grid_points ) const final override;
+
 protected:
 
   //! Return the head of the energy grid
@@ -90,6 +96,11 @@ protected:
 
 private:
 
+  // Return the cross section at the given energy
+  double getCrossSectionImpl( const double* cross_section,
+                              const double energy,
+                              const size_t bin_index ) const;
+
   // Set the max energy index
   void setMaxEnergyIndex();
 
@@ -100,7 +111,10 @@ private:
   std::shared_ptr<const std::vector<double> > d_incoming_energy_grid;
 
   // The processed cross section values evaluated on the incoming e. grid
-  std::shared_ptr<const std::vector<double> > d_cross_section;
+  Utility::ArrayView<const double> d_cross_section;
+
+  // The owner of the cross section memory
+  std::shared_ptr<const void> d_cross_section_owner;
 
   // The threshold energy index
   size_t d_threshold_energy_index;
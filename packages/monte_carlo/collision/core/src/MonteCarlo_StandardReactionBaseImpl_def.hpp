@@ -10,6 +10,7 @@
 #define MONTE_CARLO_STANDARD_REACTION_BASE_IMPL_DEF_HPP
 
 // FRENSIE Includes
+#include "MonteCarlo_NodeSharedReactionData.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_SortAlgorithms.hpp"
 #include "Utility_SearchAlgorithms.hpp"
@@ -285,7 +286,8 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
        const std::shared_ptr<const std::vector<double> >& cross_section,
        const size_t threshold_energy_index )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section( Utility::arrayViewOfConst( *cross_section ) ),
+    d_cross_section_owner( cross_section ),
     d_threshold_energy_index( threshold_energy_index ),
     d_max_energy_index()
 {
@@ -301,6 +303,10 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
   testPrecondition( cross_section->size() + threshold_energy_index <=
                     incoming_energy_grid->size() );
 
+  // Share the cross section with the other processes of the node
+  NodeSharedReactionData::shareCrossSection( d_cross_section,
+                                             d_cross_section_owner );
+
   // Set the max energy index
   this->setMaxEnergyIndex();
 
@@ -326,7 +332,8 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
       const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
       grid_searcher )
   : d_incoming_energy_grid( incoming_energy_grid ),
-    d_cross_section( cross_section ),
+    d_cross_section( Utility::arrayViewOfConst( *cross_section ) ),
+    d_cross_section_owner( cross_section ),
     d_threshold_energy_index( threshold_energy_index ),
     d_grid_searcher( grid_searcher )
 {
@@ -346,6 +353,10 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
   // Make sure the grid searcher is valid
   testPrecondition( grid_searcher.get() );
 
+  // Share the cross section with the other processes of the node
+  NodeSharedReactionData::shareCrossSection( d_cross_section,
+                                             d_cross_section_owner );
+
   // Set the max energy index
   this->setMaxEnergyIndex();
 
@@ -353,6 +364,18 @@ StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::Sta
   this->setGetCrossSectionFirstBinMethod();
 }
 
+// Destructor
+/*! \details If the cross section is still queued in a node shared reaction
+ * data arena it will no longer be shared.
+ */
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::~StandardReactionBaseImpl()
+{
+  NodeSharedReactionData::cancelCrossSectionSharing( d_cross_section );
+}
+
 // Test if the energy falls within the energy grid
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -384,7 +407,7 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
                                                const double energy,
                                                const size_t bin_index ) const
 {
-  return this->getCrossSectionImpl( *d_cross_section, energy, bin_index );
+  return this->getCrossSectionImpl( d_cross_section.data(), energy, bin_index );
 }
 
 // Return the cross section at the given energy
@@ -400,6 +423,18 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
                                       const std::vector<double>& cross_section,
                                       const double energy,
                                       const size_t bin_index ) const
+{
+  return this->getCrossSectionImpl( cross_section.data(), energy, bin_index );
+}
+
+// Return the cross section at the given energy
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getCrossSectionImpl(
+                                      const double* cross_section,
+                                      const double energy,
+                                      const size_t bin_index ) const
 {
   // Make sure the bin index is valid
   testPrecondition( bin_index < d_incoming_energy_grid->size() - 1 );
@@ -455,6 +490,25 @@ double StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_sectio
   return Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[d_threshold_energy_index] );
 }
 
+// Add the energy grid points (threshold energy to max energy) to an array
+/*! \details Processed energy grid points will be converted back to
+ * energies.
+ */
+template<typename ReactionBase,
+         typename InterpPolicy,
+         bool processed_cross_section>
+void StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::getEnergyGridPoints(
+                           std::vector<double>& energy_grid_points ) const
+{
+  energy_grid_points.reserve( energy_grid_points.size() +
+                              d_max_energy_index - d_threshold_energy_index + 1 );
+  
+  for( size_t i = d_threshold_energy_index; i <= d_max_energy_index; ++i )
+  {
+    energy_grid_points.push_back( Details::StandardReactionBaseImplInterpPolicyHelper<InterpPolicy,processed_cross_section>::returnEnergyOfInterest( (*d_incoming_energy_grid)[i] ) );
+  }
+}
+
 // Return the head of the energy grid
 template<typename ReactionBase,
          typename InterpPolicy,
@@ -470,7 +524,7 @@ template<typename ReactionBase,
          bool processed_cross_section>
 void StandardReactionBaseImpl<ReactionBase,InterpPolicy,processed_cross_section>::setMaxEnergyIndex()
 {
-  d_max_energy_index = d_threshold_energy_index + d_cross_section->size() - 1;
+  d_max_energy_index = d_threshold_energy_index + d_cross_section.size() - 1;
 }
 
 // Set the max energy index
@@ -0,0 +1,283 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNodeSharedReactionData.cpp
+//! \author Alex Robinson
+//! \brief  Node shared reaction data unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_NodeSharedReactionData.hpp"
+#include "MonteCarlo_StandardReactionBaseImpl.hpp"
+#include "MonteCarlo_Reaction.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef MonteCarlo::StandardReactionBaseImpl<MonteCarlo::Reaction,Utility::LinLin,false> TestReaction;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const std::vector<double> > energy_grid;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the reaction data is only shared when requested
+FRENSIE_UNIT_TEST( NodeSharedReactionData, setNodeCommunicator )
+{
+  FRENSIE_CHECK( !MonteCarlo::NodeSharedReactionData::isReactionDataShared() );
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  MonteCarlo::NodeSharedReactionData::setNodeCommunicator( node_comm );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::isReactionDataShared(),
+                       node_comm->size() > 1 );
+
+  MonteCarlo::NodeSharedReactionData::unsetNodeCommunicator();
+
+  FRENSIE_CHECK( !MonteCarlo::NodeSharedReactionData::isReactionDataShared() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that cross sections are only queued while an arena is open
+FRENSIE_UNIT_TEST( NodeSharedReactionData, shareCrossSection_no_arena )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  MonteCarlo::NodeSharedReactionData::setNodeCommunicator( node_comm );
+
+  FRENSIE_CHECK( !MonteCarlo::NodeSharedReactionData::isCrossSectionArenaOpen() );
+
+  std::shared_ptr<const std::vector<double> > cross_section(
+                          new std::vector<double>( energy_grid->size(), 2.0 ) );
+
+  Utility::ArrayView<const double> cross_section_view =
+    Utility::arrayViewOfConst( *cross_section );
+
+  std::shared_ptr<const void> cross_section_owner = cross_section;
+
+  MonteCarlo::NodeSharedReactionData::shareCrossSection( cross_section_view,
+                                                         cross_section_owner );
+
+  FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(), 0 );
+  FRENSIE_CHECK_EQUAL( cross_section_view.data(), cross_section->data() );
+  FRENSIE_CHECK( cross_section_owner == cross_section );
+
+  MonteCarlo::NodeSharedReactionData::unsetNodeCommunicator();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the queued cross sections can be shared
+FRENSIE_UNIT_TEST( NodeSharedReactionData, shareCrossSection )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  MonteCarlo::NodeSharedReactionData::setNodeCommunicator( node_comm );
+
+  std::shared_ptr<const std::vector<double> > cross_section(
+                          new std::vector<double>( energy_grid->size(), 2.0 ) );
+
+  std::weak_ptr<const std::vector<double> > weak_cross_section =
+    cross_section;
+
+  Utility::ArrayView<const double> cross_section_view =
+    Utility::arrayViewOfConst( *cross_section );
+
+  std::shared_ptr<const void> cross_section_owner = cross_section;
+
+  cross_section.reset();
+
+  // Small cross sections are packed into the same memory
+  std::shared_ptr<const std::vector<double> > small_cross_section(
+                                             new std::vector<double>( 10, 1.0 ) );
+
+  std::weak_ptr<const std::vector<double> > weak_small_cross_section =
+    small_cross_section;
+
+  Utility::ArrayView<const double> small_cross_section_view =
+    Utility::arrayViewOfConst( *small_cross_section );
+
+  std::shared_ptr<const void> small_cross_section_owner = small_cross_section;
+
+  small_cross_section.reset();
+
+  {
+    MonteCarlo::NodeSharedReactionData::CrossSectionArena arena;
+
+    FRENSIE_CHECK( MonteCarlo::NodeSharedReactionData::isCrossSectionArenaOpen() );
+
+    MonteCarlo::NodeSharedReactionData::shareCrossSection(
+                                                       cross_section_view,
+                                                       cross_section_owner );
+
+    MonteCarlo::NodeSharedReactionData::shareCrossSection(
+                                                   small_cross_section_view,
+                                                   small_cross_section_owner );
+
+    FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(),
+                         node_comm->size() > 1 ? 2 : 0 );
+
+    // The cross sections are only shared when the arena is shared
+    FRENSIE_CHECK( !weak_cross_section.expired() );
+    FRENSIE_CHECK( !weak_small_cross_section.expired() );
+
+    arena.share();
+
+    FRENSIE_CHECK( !MonteCarlo::NodeSharedReactionData::isCrossSectionArenaOpen() );
+    FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(), 0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( cross_section_view.size(), energy_grid->size() );
+  FRENSIE_CHECK_EQUAL( cross_section_view.front(), 2.0 );
+  FRENSIE_CHECK_EQUAL( cross_section_view.back(), 2.0 );
+  FRENSIE_CHECK_EQUAL( small_cross_section_view.size(), 10 );
+  FRENSIE_CHECK_EQUAL( small_cross_section_view.front(), 1.0 );
+  FRENSIE_CHECK_EQUAL( small_cross_section_view.back(), 1.0 );
+
+  // The private cross sections are released once they have been shared
+  FRENSIE_CHECK_EQUAL( weak_cross_section.expired(),
+                       node_comm->size() > 1 );
+  FRENSIE_CHECK_EQUAL( weak_small_cross_section.expired(),
+                       node_comm->size() > 1 );
+
+  // Both cross sections are stored in the same memory
+  FRENSIE_CHECK( cross_section_owner == small_cross_section_owner );
+
+  MonteCarlo::NodeSharedReactionData::unsetNodeCommunicator();
+}
+
+//---------------------------------------------------------------------------//
+// Check that cross sections that have not been shared remain private
+FRENSIE_UNIT_TEST( NodeSharedReactionData, CrossSectionArena_not_shared )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  MonteCarlo::NodeSharedReactionData::setNodeCommunicator( node_comm );
+
+  std::shared_ptr<const std::vector<double> > cross_section(
+                          new std::vector<double>( energy_grid->size(), 2.0 ) );
+
+  Utility::ArrayView<const double> cross_section_view =
+    Utility::arrayViewOfConst( *cross_section );
+
+  std::shared_ptr<const void> cross_section_owner = cross_section;
+
+  {
+    MonteCarlo::NodeSharedReactionData::CrossSectionArena arena;
+
+    MonteCarlo::NodeSharedReactionData::shareCrossSection(
+                                                       cross_section_view,
+                                                       cross_section_owner );
+  }
+
+  FRENSIE_CHECK( !MonteCarlo::NodeSharedReactionData::isCrossSectionArenaOpen() );
+  FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(), 0 );
+  FRENSIE_CHECK_EQUAL( cross_section_view.data(), cross_section->data() );
+  FRENSIE_CHECK( cross_section_owner == cross_section );
+
+  MonteCarlo::NodeSharedReactionData::unsetNodeCommunicator();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the cross section of a reaction can be shared
+FRENSIE_UNIT_TEST( NodeSharedReactionData, reaction_cross_section )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  MonteCarlo::NodeSharedReactionData::setNodeCommunicator( node_comm );
+
+  // The cross section is zero below the threshold and rises linearly
+  const size_t threshold_index = 100;
+
+  std::shared_ptr<std::vector<double> > cross_section(
+             new std::vector<double>( energy_grid->size() - threshold_index ) );
+
+  for( size_t i = 0; i < cross_section->size(); ++i )
+    (*cross_section)[i] = (*energy_grid)[i+threshold_index];
+
+  std::weak_ptr<const std::vector<double> > weak_cross_section =
+    cross_section;
+
+  std::unique_ptr<TestReaction> reaction;
+
+  {
+    MonteCarlo::NodeSharedReactionData::CrossSectionArena arena;
+
+    reaction.reset( new TestReaction( energy_grid,
+                                      cross_section,
+                                      threshold_index ) );
+
+    // A reaction that is destroyed before the arena is shared is not shared
+    std::unique_ptr<TestReaction> temp_reaction( new TestReaction(
+                                                        energy_grid,
+                                                        cross_section,
+                                                        threshold_index ) );
+
+    FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(),
+                         node_comm->size() > 1 ? 2 : 0 );
+
+    temp_reaction.reset();
+
+    FRENSIE_CHECK_EQUAL( MonteCarlo::NodeSharedReactionData::getNumberOfQueuedCrossSections(),
+                         node_comm->size() > 1 ? 1 : 0 );
+
+    arena.share();
+  }
+
+  cross_section.reset();
+
+  FRENSIE_CHECK_EQUAL( weak_cross_section.expired(),
+                       node_comm->size() > 1 );
+
+  FRENSIE_CHECK_EQUAL( reaction->getThresholdEnergy(),
+                       (*energy_grid)[threshold_index] );
+  FRENSIE_CHECK_EQUAL( reaction->getMaxEnergy(), energy_grid->back() );
+  FRENSIE_CHECK_EQUAL( reaction->getCrossSection( 0.5 ), 0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( reaction->getCrossSection( 500.5 ),
+                                   500.5,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                             reaction->getCrossSection( energy_grid->back() ),
+                             energy_grid->back(),
+                             1e-12 );
+
+  MonteCarlo::NodeSharedReactionData::unsetNodeCommunicator();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::shared_ptr<std::vector<double> > grid( new std::vector<double>( 1000 ) );
+
+  for( size_t i = 0; i < grid->size(); ++i )
+    (*grid)[i] = i + 1.0;
+
+  energy_grid = grid;
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstNodeSharedReactionData.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,319 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstReactionCrossSectionTable.cpp
+//! \author Alex Robinson
+//! \brief  Reaction cross section table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_ReactionCrossSectionTable.hpp"
+#include "MonteCarlo_Reaction.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Structs
+//---------------------------------------------------------------------------//
+// A reaction with a lin-lin or log-log cross section on the shared energy
+// grid
+class TestReaction : public MonteCarlo::Reaction
+{
+public:
+
+  TestReaction( const std::shared_ptr<const std::vector<double> >& energy_grid,
+                const std::vector<double>& cross_section,
+                const bool log_log = false )
+    : d_energy_grid( energy_grid ),
+      d_cross_section( cross_section ),
+      d_log_log( log_log )
+  { /* ... */ }
+
+  ~TestReaction()
+  { /* ... */ }
+
+  bool isEnergyWithinEnergyGrid( const double energy ) const override
+  { return energy >= d_energy_grid->front() && energy <= d_energy_grid->back(); }
+
+  double getThresholdEnergy() const override
+  { return d_energy_grid->front(); }
+
+  double getMaxEnergy() const override
+  { return d_energy_grid->back(); }
+
+  double getCrossSection( const double energy ) const override
+  {
+    size_t bin_index = 0;
+
+    while( bin_index < d_energy_grid->size() - 2 &&
+           energy >= (*d_energy_grid)[bin_index+1] )
+      ++bin_index;
+
+    return this->getCrossSection( energy, bin_index );
+  }
+
+  double getCrossSection( const double energy,
+                          const size_t bin_index ) const override
+  {
+    const double energy_0 = (*d_energy_grid)[bin_index];
+    const double energy_1 = (*d_energy_grid)[bin_index+1];
+
+    if( d_log_log )
+    {
+      // The cross section is zero below the threshold grid point
+      if( d_cross_section[bin_index] == 0.0 )
+        return 0.0;
+
+      return d_cross_section[bin_index]*
+        std::pow( d_cross_section[bin_index+1]/d_cross_section[bin_index],
+                  std::log( energy/energy_0 )/std::log( energy_1/energy_0 ) );
+    }
+
+    return d_cross_section[bin_index] +
+      (energy - energy_0)/(energy_1 - energy_0)*
+      (d_cross_section[bin_index+1] - d_cross_section[bin_index]);
+  }
+
+protected:
+
+  const double* getEnergyGridHead() const override
+  { return d_energy_grid->data(); }
+
+private:
+
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+  std::vector<double> d_cross_section;
+  bool d_log_log;
+};
+
+typedef MonteCarlo::ReactionCrossSectionTable<TestReaction> Table;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+std::shared_ptr<const std::vector<double> > energy_grid;
+Table::ReactionArray reactions;
+std::unique_ptr<const Table> table;
+
+std::shared_ptr<const std::vector<double> > log_log_energy_grid;
+Table::ReactionArray log_log_reactions;
+std::unique_ptr<const Table> log_log_table;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the interpolation types can be checked
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, isInterpolationTypeSupported )
+{
+  FRENSIE_CHECK( Table::isInterpolationTypeSupported( Utility::LINLIN_INTERPOLATION ) );
+  FRENSIE_CHECK( Table::isInterpolationTypeSupported( Utility::LINLOG_INTERPOLATION ) );
+  FRENSIE_CHECK( Table::isInterpolationTypeSupported( Utility::LOGLIN_INTERPOLATION ) );
+  FRENSIE_CHECK( Table::isInterpolationTypeSupported( Utility::LOGLOG_INTERPOLATION ) );
+  FRENSIE_CHECK( !Table::isInterpolationTypeSupported( Utility::HISTOGRAM_INTERPOLATION ) );
+
+  FRENSIE_CHECK_EQUAL( table->getInterpolationType(),
+                       Utility::LINLIN_INTERPOLATION );
+  FRENSIE_CHECK_EQUAL( log_log_table->getInterpolationType(),
+                       Utility::LOGLOG_INTERPOLATION );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the table dimensions can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getNumberOfReactions )
+{
+  FRENSIE_CHECK_EQUAL( table->getNumberOfReactions(), 3 );
+  FRENSIE_CHECK_EQUAL( table->getNumberOfEnergies(), 4 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the reactions can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getReaction )
+{
+  for( size_t i = 0; i < reactions.size(); ++i )
+    FRENSIE_CHECK_EQUAL( &table->getReaction( i ), reactions[i].get() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the threshold energy indices can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getThresholdEnergyIndex )
+{
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergyIndex( 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergyIndex( 1 ), 2 );
+  FRENSIE_CHECK_EQUAL( table->getThresholdEnergyIndex( 2 ), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the reaction cross sections can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getCrossSection )
+{
+  for( size_t i = 0; i < reactions.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( i, 1.0, 0 ),
+                                     reactions[i]->getCrossSection( 1.0, 0 ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( i, 2.5, 1 ),
+                                     reactions[i]->getCrossSection( 2.5, 1 ),
+                                     1e-15 );
+    FRENSIE_CHECK_FLOATING_EQUALITY( table->getCrossSection( i, 4.0, 2 ),
+                                     reactions[i]->getCrossSection( 4.0, 2 ),
+                                     1e-15 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the total cross section can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getTotalCrossSection )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 1.0, 0 ),
+                                   3.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 2.5, 1 ),
+                                   4.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( table->getTotalCrossSection( 4.0, 2 ),
+                                   8.0, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a reaction can be sampled
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, sampleReactionIndex )
+{
+  // Below the threshold of the second reaction: sigma = {2, 0, 1}
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.0, 1.0, 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.66, 1.0, 0 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.67, 1.0, 0 ), 2 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 1.0, 1.0, 0 ), 2 );
+
+  // Inside of the second bin: sigma = {2, 1, 1}
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.49, 2.5, 1 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.5, 2.5, 1 ), 1 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.74, 2.5, 1 ), 1 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.75, 2.5, 1 ), 2 );
+
+  // At the last grid point: sigma = {2, 4, 2}
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.24, 4.0, 2 ), 0 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.25, 4.0, 2 ), 1 );
+  FRENSIE_CHECK_EQUAL( table->sampleReactionIndex( 0.75, 4.0, 2 ), 2 );
+  FRENSIE_CHECK_EQUAL( &table->sampleReaction( 0.99, 4.0, 2 ),
+                       reactions[2].get() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the log-log reaction cross sections can be returned
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, getCrossSection_log_log )
+{
+  for( size_t i = 0; i < log_log_reactions.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                      log_log_table->getCrossSection( i, 3.0, 0 ),
+                      log_log_reactions[i]->getCrossSection( 3.0, 0 ),
+                      1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                      log_log_table->getCrossSection( i, 30.0, 1 ),
+                      log_log_reactions[i]->getCrossSection( 30.0, 1 ),
+                      1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                      log_log_table->getCrossSection( i, 100.0, 1 ),
+                      log_log_reactions[i]->getCrossSection( 100.0, 1 ),
+                      1e-12 );
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( log_log_table->getTotalCrossSection( 30.0, 1 ),
+                                   log_log_reactions[0]->getCrossSection( 30.0, 1 ) +
+                                   log_log_reactions[1]->getCrossSection( 30.0, 1 ) +
+                                   log_log_reactions[2]->getCrossSection( 30.0, 1 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sampled log-log reaction frequencies match the exact
+// reaction cross section ratios
+FRENSIE_UNIT_TEST( ReactionCrossSectionTable, sampleReactionIndex_log_log )
+{
+  const std::vector<double> energies( {3.0, 30.0} );
+  const std::vector<size_t> bins( {0, 1} );
+
+  // Stratified random numbers
+  const size_t number_of_samples = 1000000;
+
+  for( size_t k = 0; k < energies.size(); ++k )
+  {
+    std::vector<double> reaction_counts( log_log_reactions.size(), 0.0 );
+
+    for( size_t i = 0; i < number_of_samples; ++i )
+    {
+      const double random_number = (i + 0.5)/number_of_samples;
+
+      reaction_counts[log_log_table->sampleReactionIndex( random_number,
+                                                          energies[k],
+                                                          bins[k] )] += 1.0;
+    }
+
+    double total_cross_section = 0.0;
+
+    for( size_t j = 0; j < log_log_reactions.size(); ++j )
+    {
+      total_cross_section +=
+        log_log_reactions[j]->getCrossSection( energies[k], bins[k] );
+    }
+
+    for( size_t j = 0; j < log_log_reactions.size(); ++j )
+    {
+      const double exact_ratio =
+        log_log_reactions[j]->getCrossSection( energies[k], bins[k] )/
+        total_cross_section;
+
+      const double sampled_ratio = reaction_counts[j]/number_of_samples;
+
+      if( exact_ratio == 0.0 )
+      {
+        FRENSIE_CHECK_EQUAL( sampled_ratio, 0.0 );
+      }
+      else
+      {
+        FRENSIE_CHECK_FLOATING_EQUALITY( sampled_ratio, exact_ratio, 1e-5 );
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  energy_grid.reset( new std::vector<double>( {1.0, 2.0, 3.0, 4.0} ) );
+
+  reactions.push_back( std::make_shared<const TestReaction>(
+                              energy_grid, std::vector<double>( {2.0, 2.0, 2.0, 2.0} ) ) );
+  reactions.push_back( std::make_shared<const TestReaction>(
+                              energy_grid, std::vector<double>( {0.0, 0.0, 2.0, 4.0} ) ) );
+  reactions.push_back( std::make_shared<const TestReaction>(
+                              energy_grid, std::vector<double>( {1.0, 1.0, 1.0, 2.0} ) ) );
+
+  table.reset( new Table( *energy_grid, reactions ) );
+
+  log_log_energy_grid.reset( new std::vector<double>( {1.0, 10.0, 100.0} ) );
+
+  log_log_reactions.push_back( std::make_shared<const TestReaction>(
+                   log_log_energy_grid, std::vector<double>( {1.0, 10.0, 1.0} ), true ) );
+  log_log_reactions.push_back( std::make_shared<const TestReaction>(
+                   log_log_energy_grid, std::vector<double>( {4.0, 2.0, 8.0} ), true ) );
+  log_log_reactions.push_back( std::make_shared<const TestReaction>(
+                   log_log_energy_grid, std::vector<double>( {0.0, 3.0, 30.0} ), true ) );
+
+  log_log_table.reset( new Table( *log_log_energy_grid,
+                                  log_log_reactions,
+                                  Utility::LOGLOG_INTERPOLATION ) );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstReactionCrossSectionTable.cpp
+//---------------------------------------------------------------------------//
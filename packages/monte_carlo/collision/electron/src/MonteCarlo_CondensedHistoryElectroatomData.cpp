@@ -0,0 +1,628 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectroatomData.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electroatom data class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectroatomData.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_KinematicHelpers.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details The knock-on production threshold is the minimum kinetic energy
+ * of a knock-on electron that will be produced explicitly. The
+ * bremsstrahlung production threshold is the minimum energy of a
+ * bremsstrahlung photon that will be produced explicitly. The binding
+ * energy of a soft electroionization collision is included in the
+ * restricted stopping power.
+ */
+CondensedHistoryElectroatomData::CondensedHistoryElectroatomData(
+               const Data::ElectronPhotonRelaxationDataContainer& data_container,
+               const double knock_on_threshold,
+               const double bremsstrahlung_threshold,
+               const bool elastic_mode_on,
+               const bool electroionization_mode_on,
+               const bool bremsstrahlung_mode_on,
+               const bool atomic_excitation_mode_on )
+  : d_knock_on_threshold( knock_on_threshold ),
+    d_bremsstrahlung_threshold( bremsstrahlung_threshold ),
+    d_energy_grid( data_container.getElectronEnergyGrid() ),
+    d_restricted_stopping_cross_section( d_energy_grid.size(), 0.0 ),
+    d_transport_cross_section( d_energy_grid.size(), 0.0 ),
+    d_hard_knock_on_cross_section( d_energy_grid.size(), 0.0 ),
+    d_hard_knock_on_reactions(),
+    d_hard_bremsstrahlung_reaction()
+{
+  // Make sure the thresholds are valid
+  testPrecondition( knock_on_threshold > 0.0 );
+  testPrecondition( bremsstrahlung_threshold > 0.0 );
+  // Make sure the energy grid is valid
+  testPrecondition( d_energy_grid.size() > 1 );
+
+  // Atomic excitation collisions are always soft
+  if( atomic_excitation_mode_on )
+  {
+    const Utility::ArrayView<const double> cross_section =
+      data_container.getAtomicExcitationCrossSection();
+
+    const Utility::ArrayView<const double> energy_loss_energy_grid =
+      data_container.getAtomicExcitationEnergyGrid();
+
+    const Utility::ArrayView<const double> energy_loss =
+      data_container.getAtomicExcitationEnergyLoss();
+
+    const size_t threshold_energy_index =
+      data_container.getAtomicExcitationCrossSectionThresholdEnergyIndex();
+
+    for( size_t i = threshold_energy_index; i < d_energy_grid.size(); ++i )
+    {
+      d_restricted_stopping_cross_section[i] +=
+        cross_section[i-threshold_energy_index]*
+        this->interpolate( energy_loss_energy_grid,
+                           energy_loss,
+                           d_energy_grid[i] );
+    }
+  }
+
+  // Split each electroionization subshell reaction into soft and hard parts
+  if( electroionization_mode_on )
+  {
+    const std::set<unsigned>& subshells = data_container.getSubshells();
+
+    d_hard_knock_on_reactions.resize( subshells.size() );
+
+    std::set<unsigned>::const_iterator subshell = subshells.begin();
+
+    for( size_t s = 0; s < d_hard_knock_on_reactions.size(); ++s )
+    {
+      this->tabulateReaction(
+         data_container.getElectroionizationRecoilEnergy( *subshell ),
+         data_container.getElectroionizationRecoilPDF( *subshell ),
+         data_container.getElectroionizationCrossSection( *subshell ),
+         data_container.getElectroionizationCrossSectionThresholdEnergyIndex( *subshell ),
+         knock_on_threshold,
+         data_container.getSubshellBindingEnergy( *subshell ),
+         d_hard_knock_on_reactions[s] );
+
+      for( size_t i = 0; i < d_energy_grid.size(); ++i )
+      {
+        d_hard_knock_on_cross_section[i] +=
+          d_hard_knock_on_reactions[s].cross_section[i];
+      }
+
+      ++subshell;
+    }
+  }
+
+  // Split the bremsstrahlung reaction into soft and hard parts
+  if( bremsstrahlung_mode_on )
+  {
+    d_hard_bremsstrahlung_reaction.reset( new HardReactionData );
+
+    this->tabulateReaction(
+         data_container.getBremsstrahlungPhotonEnergy(),
+         data_container.getBremsstrahlungPhotonPDF(),
+         data_container.getBremsstrahlungCrossSection(),
+         data_container.getBremsstrahlungCrossSectionThresholdEnergyIndex(),
+         bremsstrahlung_threshold,
+         0.0,
+         *d_hard_bremsstrahlung_reaction );
+  }
+
+  // Calculate the transport cross section from the cutoff elastic data
+  // Note: the screened Rutherford peak (mu > cutoff) is ignored
+  if( elastic_mode_on )
+  {
+    const std::map<double,std::vector<double> >& angles =
+      data_container.getCutoffElasticAngles();
+
+    const std::map<double,std::vector<double> >& pdfs =
+      data_container.getCutoffElasticPDF();
+
+    std::vector<double> energies, mean_angular_deflections;
+
+    for( std::map<double,std::vector<double> >::const_iterator angles_it =
+           angles.begin(); angles_it != angles.end(); ++angles_it )
+    {
+      double integral, first_moment, total_integral;
+
+      // All angle cosines are below the threshold (2.0)
+      this->integrateTabulatedPDF( angles_it->second,
+                                   pdfs.find( angles_it->first )->second,
+                                   2.0,
+                                   integral,
+                                   first_moment,
+                                   total_integral );
+
+      energies.push_back( angles_it->first );
+
+      if( integral > 0.0 )
+        mean_angular_deflections.push_back( 1.0 - first_moment/integral );
+      else
+        mean_angular_deflections.push_back( 0.0 );
+    }
+
+    const Utility::ArrayView<const double> cross_section =
+      data_container.getCutoffElasticCrossSection();
+
+    const size_t threshold_energy_index =
+      data_container.getCutoffElasticCrossSectionThresholdEnergyIndex();
+
+    for( size_t i = threshold_energy_index; i < d_energy_grid.size(); ++i )
+    {
+      d_transport_cross_section[i] = cross_section[i-threshold_energy_index]*
+        this->interpolate( Utility::arrayViewOfConst( energies ),
+                           Utility::arrayViewOfConst( mean_angular_deflections ),
+                           d_energy_grid[i] );
+    }
+  }
+}
+
+// Tabulate the restricted quantities of a reaction
+/*! \details The fraction of the secondary energy pdf above the production
+ * threshold and the mean soft energy loss are calculated at each tabulated
+ * incoming energy and then interpolated onto the energy grid. The soft
+ * energy loss of each collision includes the binding energy.
+ */
+void CondensedHistoryElectroatomData::tabulateReaction(
+          const std::map<double,std::vector<double> >& secondary_energies,
+          const std::map<double,std::vector<double> >& secondary_energy_pdfs,
+          const std::vector<double>& cross_section,
+          const size_t threshold_energy_index,
+          const double production_threshold,
+          const double binding_energy,
+          HardReactionData& hard_reaction_data )
+{
+  hard_reaction_data.cross_section.assign( d_energy_grid.size(), 0.0 );
+  hard_reaction_data.binding_energy = binding_energy;
+
+  std::vector<double> hard_fractions, soft_energy_losses;
+
+  for( std::map<double,std::vector<double> >::const_iterator energies_it =
+         secondary_energies.begin();
+       energies_it != secondary_energies.end();
+       ++energies_it )
+  {
+    const std::vector<double>& values = energies_it->second;
+    const std::vector<double>& pdf =
+      secondary_energy_pdfs.find( energies_it->first )->second;
+
+    double soft_integral, soft_first_moment, total_integral;
+
+    this->integrateTabulatedPDF( values,
+                                 pdf,
+                                 production_threshold,
+                                 soft_integral,
+                                 soft_first_moment,
+                                 total_integral );
+
+    hard_reaction_data.incoming_energies.push_back( energies_it->first );
+
+    if( total_integral > 0.0 )
+    {
+      hard_fractions.push_back( 1.0 - soft_integral/total_integral );
+      soft_energy_losses.push_back(
+               (soft_first_moment + binding_energy*soft_integral)/total_integral );
+    }
+    else
+    {
+      hard_fractions.push_back( 0.0 );
+      soft_energy_losses.push_back( 0.0 );
+    }
+
+    // Construct the secondary energy distribution above the threshold
+    std::vector<double> hard_values, hard_pdf;
+
+    for( size_t j = 0; j < values.size(); ++j )
+    {
+      if( values[j] > production_threshold )
+      {
+        if( hard_values.empty() && j > 0 )
+        {
+          hard_values.push_back( production_threshold );
+          hard_pdf.push_back( pdf[j-1] + (pdf[j] - pdf[j-1])*
+                              (production_threshold - values[j-1])/
+                              (values[j] - values[j-1]) );
+        }
+
+        hard_values.push_back( values[j] );
+        hard_pdf.push_back( pdf[j] );
+      }
+    }
+
+    if( hard_values.size() > 1 &&
+        hard_fractions.back()*total_integral > 0.0 )
+    {
+      hard_reaction_data.secondary_energy_distributions.emplace_back(
+        new Utility::TabularDistribution<Utility::LinLin>( hard_values,
+                                                          hard_pdf ) );
+    }
+    else
+      hard_reaction_data.secondary_energy_distributions.emplace_back();
+  }
+
+  for( size_t i = threshold_energy_index; i < d_energy_grid.size(); ++i )
+  {
+    const double reaction_cross_section =
+      cross_section[i-threshold_energy_index];
+
+    hard_reaction_data.cross_section[i] = reaction_cross_section*
+      this->interpolate( Utility::arrayViewOfConst( hard_reaction_data.incoming_energies ),
+                         Utility::arrayViewOfConst( hard_fractions ),
+                         d_energy_grid[i] );
+
+    d_restricted_stopping_cross_section[i] += reaction_cross_section*
+      this->interpolate( Utility::arrayViewOfConst( hard_reaction_data.incoming_energies ),
+                         Utility::arrayViewOfConst( soft_energy_losses ),
+                         d_energy_grid[i] );
+  }
+}
+
+// Integrate a lin-lin tabulated pdf below a threshold
+void CondensedHistoryElectroatomData::integrateTabulatedPDF(
+                                            const std::vector<double>& values,
+                                            const std::vector<double>& pdf,
+                                            const double threshold,
+                                            double& soft_integral,
+                                            double& soft_first_moment,
+                                            double& total_integral )
+{
+  // Make sure the pdf is valid
+  testPrecondition( values.size() == pdf.size() );
+
+  soft_integral = 0.0;
+  soft_first_moment = 0.0;
+  total_integral = 0.0;
+
+  for( size_t j = 1; j < values.size(); ++j )
+  {
+    const double x_0 = values[j-1];
+    const double p_0 = pdf[j-1];
+
+    double x_1 = values[j];
+    double p_1 = pdf[j];
+
+    total_integral += 0.5*(p_0 + p_1)*(x_1 - x_0);
+
+    if( x_0 >= threshold )
+      continue;
+
+    // Only integrate the part of the bin below the threshold
+    if( x_1 > threshold )
+    {
+      p_1 = p_0 + (p_1 - p_0)*(threshold - x_0)/(x_1 - x_0);
+      x_1 = threshold;
+    }
+
+    soft_integral += 0.5*(p_0 + p_1)*(x_1 - x_0);
+    soft_first_moment +=
+      (x_1 - x_0)*(x_0*(2.0*p_0 + p_1) + x_1*(p_0 + 2.0*p_1))/6.0;
+  }
+}
+
+// Interpolate a lin-lin tabulated function (constant outside of the table)
+double CondensedHistoryElectroatomData::interpolate(
+                                   const Utility::ArrayView<const double>& x,
+                                   const Utility::ArrayView<const double>& y,
+                                   const double x_value )
+{
+  // Make sure the table is valid
+  testPrecondition( x.size() == y.size() );
+  testPrecondition( x.size() > 0 );
+
+  if( x_value <= x.front() )
+    return y.front();
+  else if( x_value >= x.back() )
+    return y.back();
+  else
+  {
+    const size_t index =
+      Utility::Search::binaryLowerBoundIndex( x.begin(), x.end(), x_value );
+
+    return y[index] + (y[index+1] - y[index])*
+      (x_value - x[index])/(x[index+1] - x[index]);
+  }
+}
+
+// Evaluate a tabulated quantity on the energy grid
+double CondensedHistoryElectroatomData::evaluate(
+                                          const std::vector<double>& quantity,
+                                          const double energy ) const
+{
+  return this->interpolate( Utility::arrayViewOfConst( d_energy_grid ),
+                            Utility::arrayViewOfConst( quantity ),
+                            energy );
+}
+
+// Return the min energy (MeV)
+double CondensedHistoryElectroatomData::getMinEnergy() const
+{
+  return d_energy_grid.front();
+}
+
+// Return the max energy (MeV)
+double CondensedHistoryElectroatomData::getMaxEnergy() const
+{
+  return d_energy_grid.back();
+}
+
+// Return the knock-on production threshold (MeV)
+double CondensedHistoryElectroatomData::getKnockOnThreshold() const
+{
+  return d_knock_on_threshold;
+}
+
+// Return the bremsstrahlung production threshold (MeV)
+double CondensedHistoryElectroatomData::getBremsstrahlungThreshold() const
+{
+  return d_bremsstrahlung_threshold;
+}
+
+// Return the restricted stopping cross section (MeV-b)
+double CondensedHistoryElectroatomData::getRestrictedStoppingCrossSection(
+                                                    const double energy ) const
+{
+  return this->evaluate( d_restricted_stopping_cross_section, energy );
+}
+
+// Return the transport cross section (b)
+double CondensedHistoryElectroatomData::getTransportCrossSection(
+                                                    const double energy ) const
+{
+  return this->evaluate( d_transport_cross_section, energy );
+}
+
+// Return the hard knock-on cross section (b)
+double CondensedHistoryElectroatomData::getHardKnockOnCrossSection(
+                                                    const double energy ) const
+{
+  return this->evaluate( d_hard_knock_on_cross_section, energy );
+}
+
+// Return the hard bremsstrahlung cross section (b)
+double CondensedHistoryElectroatomData::getHardBremsstrahlungCrossSection(
+                                                    const double energy ) const
+{
+  if( d_hard_bremsstrahlung_reaction )
+  {
+    return this->evaluate( d_hard_bremsstrahlung_reaction->cross_section,
+                           energy );
+  }
+  else
+    return 0.0;
+}
+
+// Return the hard collision cross section (b)
+double CondensedHistoryElectroatomData::getHardCrossSection(
+                                                    const double energy ) const
+{
+  return this->getHardKnockOnCrossSection( energy ) +
+    this->getHardBremsstrahlungCrossSection( energy );
+}
+
+// Undergo a hard collision
+/*! \details Atomic relaxation is not done after a hard knock-on collision -
+ * the binding energy is deposited locally.
+ */
+void CondensedHistoryElectroatomData::collideHard( ElectronState& electron,
+                                                   ParticleBank& bank ) const
+{
+  const double energy = electron.getEnergy();
+
+  const double hard_bremsstrahlung_cross_section =
+    this->getHardBremsstrahlungCrossSection( energy );
+
+  double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    (this->getHardKnockOnCrossSection( energy ) +
+     hard_bremsstrahlung_cross_section);
+
+  if( scaled_random_number < hard_bremsstrahlung_cross_section )
+  {
+    this->collideHardBremsstrahlung( *d_hard_bremsstrahlung_reaction,
+                                     electron,
+                                     bank );
+  }
+  else if( d_hard_knock_on_reactions.size() > 0 )
+  {
+    scaled_random_number -= hard_bremsstrahlung_cross_section;
+
+    size_t s = 0;
+
+    for( ; s < d_hard_knock_on_reactions.size() - 1; ++s )
+    {
+      scaled_random_number -=
+        this->evaluate( d_hard_knock_on_reactions[s].cross_section, energy );
+
+      if( scaled_random_number < 0.0 )
+        break;
+    }
+
+    this->collideHardKnockOn( d_hard_knock_on_reactions[s], electron, bank );
+  }
+}
+
+// Sample the secondary energy of a hard reaction
+/*! \details The secondary energy distribution at one of the bounding
+ * incoming energies is selected with probability equal to the
+ * interpolation fraction.
+ */
+double CondensedHistoryElectroatomData::sampleSecondaryEnergy(
+                                 const HardReactionData& hard_reaction_data,
+                                 const double energy )
+{
+  const std::vector<double>& incoming_energies =
+    hard_reaction_data.incoming_energies;
+
+  size_t index;
+
+  if( energy <= incoming_energies.front() )
+    index = 0;
+  else if( energy >= incoming_energies.back() )
+    index = incoming_energies.size() - 1;
+  else
+  {
+    index = Utility::Search::binaryLowerBoundIndex( incoming_energies.begin(),
+                                                    incoming_energies.end(),
+                                                    energy );
+
+    const double interpolation_fraction =
+      (energy - incoming_energies[index])/
+      (incoming_energies[index+1] - incoming_energies[index]);
+
+    if( Utility::RandomNumberGenerator::getRandomNumber<double>() <
+        interpolation_fraction )
+      ++index;
+  }
+
+  // Use the closest distribution with a hard part
+  size_t lower_index = index, upper_index = index;
+
+  while( true )
+  {
+    if( hard_reaction_data.secondary_energy_distributions[upper_index] )
+      return hard_reaction_data.secondary_energy_distributions[upper_index]->sample();
+    if( hard_reaction_data.secondary_energy_distributions[lower_index] )
+      return hard_reaction_data.secondary_energy_distributions[lower_index]->sample();
+
+    if( upper_index < incoming_energies.size() - 1 )
+      ++upper_index;
+    if( lower_index > 0 )
+      --lower_index;
+
+    TEST_FOR_EXCEPTION( upper_index == incoming_energies.size() - 1 &&
+                        lower_index == 0 &&
+                        !hard_reaction_data.secondary_energy_distributions[upper_index] &&
+                        !hard_reaction_data.secondary_energy_distributions[lower_index],
+                        std::runtime_error,
+                        "The reaction has no hard secondary energy "
+                        "distributions!" );
+  }
+}
+
+// Undergo a hard knock-on collision
+void CondensedHistoryElectroatomData::collideHardKnockOn(
+                                 const HardReactionData& hard_reaction_data,
+                                 ElectronState& electron,
+                                 ParticleBank& bank )
+{
+  const double energy = electron.getEnergy();
+  const double binding_energy = hard_reaction_data.binding_energy;
+
+  // The knock-on electron cannot have more energy than the primary electron
+  const double knock_on_energy =
+    std::min( CondensedHistoryElectroatomData::sampleSecondaryEnergy(
+                                                hard_reaction_data, energy ),
+              0.5*(energy - binding_energy) );
+
+  const double outgoing_energy = energy - knock_on_energy - binding_energy;
+
+  // The normalized incoming electron energy
+  const double normalized_energy =
+    energy/Utility::PhysicalConstants::electron_rest_mass_energy;
+
+  const double azimuthal_angle = 2.0*Utility::PhysicalConstants::pi*
+    Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  if( knock_on_energy > 0.0 )
+  {
+    const double energy_ratio = knock_on_energy/energy;
+
+    std::shared_ptr<ParticleState> knock_on_electron(
+                                     new ElectronState( electron, true, true ) );
+
+    knock_on_electron->setEnergy( knock_on_energy );
+
+    knock_on_electron->rotateDirection(
+            std::sqrt( energy_ratio*(normalized_energy + 2.0)/
+                       (energy_ratio*normalized_energy + 2.0) ),
+            azimuthal_angle );
+
+    bank.push( knock_on_electron );
+  }
+
+  electron.incrementGenerationNumber();
+
+  if( outgoing_energy > 0.0 )
+  {
+    const double energy_ratio = outgoing_energy/energy;
+
+    electron.setEnergy( outgoing_energy );
+
+    // The primary electron leaves on the opposite side of the knock-on
+    electron.rotateDirection(
+            std::sqrt( energy_ratio*(normalized_energy + 2.0)/
+                       (energy_ratio*normalized_energy + 2.0) ),
+            azimuthal_angle < Utility::PhysicalConstants::pi ?
+            azimuthal_angle + Utility::PhysicalConstants::pi :
+            azimuthal_angle - Utility::PhysicalConstants::pi );
+  }
+  else
+    electron.setAsGone();
+}
+
+// Undergo a hard bremsstrahlung collision
+/*! \details The photon angle is sampled from the dipole distribution.
+ */
+void CondensedHistoryElectroatomData::collideHardBremsstrahlung(
+                                 const HardReactionData& hard_reaction_data,
+                                 ElectronState& electron,
+                                 ParticleBank& bank )
+{
+  const double energy = electron.getEnergy();
+
+  const double photon_energy =
+    std::min( CondensedHistoryElectroatomData::sampleSecondaryEnergy(
+                                                hard_reaction_data, energy ),
+              energy );
+
+  const double beta =
+    std::sqrt( calculateDimensionlessRelativisticSpeedSquared(
+                         Utility::PhysicalConstants::electron_rest_mass_energy,
+                         energy ) );
+
+  const double scaled_random_number =
+    2.0*Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+  std::shared_ptr<PhotonState> bremsstrahlung_photon(
+                                       new PhotonState( electron, true, true ) );
+
+  bremsstrahlung_photon->setEnergy( photon_energy );
+
+  bremsstrahlung_photon->rotateDirection(
+                  (scaled_random_number - (1.0 + beta))/
+                  (scaled_random_number*beta - (1.0 + beta)),
+                  2.0*Utility::PhysicalConstants::pi*
+                  Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+  bank.push( bremsstrahlung_photon );
+
+  const double outgoing_energy = energy - photon_energy;
+
+  if( outgoing_energy > 0.0 )
+    electron.setEnergy( outgoing_energy );
+  else
+    electron.setAsGone();
+
+  electron.incrementGenerationNumber();
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectroatomData.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,181 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectroatomData.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electroatom data class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOM_DATA_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOM_DATA_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_UnivariateDistribution.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ArrayView.hpp"
+
+namespace MonteCarlo{
+
+/*! The condensed history electroatom data class
+ * \details This class stores the quantities that are needed to transport
+ * electrons through an atom with the class II condensed history method.
+ * The inelastic collisions are split into soft collisions (knock-on energy
+ * below the knock-on production threshold or photon energy below the
+ * bremsstrahlung production threshold) and hard collisions. The soft
+ * collisions (and all atomic excitation collisions) are grouped into a
+ * restricted stopping power that is used to calculate the continuous
+ * energy loss along a step. The elastic collisions are grouped into a
+ * transport cross section that is used to sample the multiple scattering
+ * angular deflection at the end of a step. The hard collisions are
+ * simulated explicitly. All quantities are derived from the tabulated
+ * native electron-photon-relaxation data on the electron energy grid.
+ */
+class CondensedHistoryElectroatomData
+{
+
+public:
+
+  //! Constructor
+  CondensedHistoryElectroatomData(
+               const Data::ElectronPhotonRelaxationDataContainer& data_container,
+               const double knock_on_threshold,
+               const double bremsstrahlung_threshold,
+               const bool elastic_mode_on = true,
+               const bool electroionization_mode_on = true,
+               const bool bremsstrahlung_mode_on = true,
+               const bool atomic_excitation_mode_on = true );
+
+  //! Destructor
+  ~CondensedHistoryElectroatomData()
+  { /* ... */ }
+
+  //! Return the min energy (MeV)
+  double getMinEnergy() const;
+
+  //! Return the max energy (MeV)
+  double getMaxEnergy() const;
+
+  //! Return the knock-on production threshold (MeV)
+  double getKnockOnThreshold() const;
+
+  //! Return the bremsstrahlung production threshold (MeV)
+  double getBremsstrahlungThreshold() const;
+
+  //! Return the restricted stopping cross section (MeV-b)
+  double getRestrictedStoppingCrossSection( const double energy ) const;
+
+  //! Return the transport cross section (b)
+  double getTransportCrossSection( const double energy ) const;
+
+  //! Return the hard knock-on cross section (b)
+  double getHardKnockOnCrossSection( const double energy ) const;
+
+  //! Return the hard bremsstrahlung cross section (b)
+  double getHardBremsstrahlungCrossSection( const double energy ) const;
+
+  //! Return the hard collision cross section (b)
+  double getHardCrossSection( const double energy ) const;
+
+  //! Undergo a hard collision
+  void collideHard( ElectronState& electron, ParticleBank& bank ) const;
+
+private:
+
+  // The hard reaction data
+  struct HardReactionData
+  {
+    // The hard cross section on the energy grid (b)
+    std::vector<double> cross_section;
+
+    // The incoming energies of the secondary energy distributions
+    std::vector<double> incoming_energies;
+
+    // The secondary energy distributions above the production threshold
+    std::vector<std::shared_ptr<const Utility::UnivariateDistribution> >
+    secondary_energy_distributions;
+
+    // The binding energy (zero for bremsstrahlung)
+    double binding_energy;
+  };
+
+  // Tabulate the restricted quantities of a reaction
+  void tabulateReaction(
+          const std::map<double,std::vector<double> >& secondary_energies,
+          const std::map<double,std::vector<double> >& secondary_energy_pdfs,
+          const std::vector<double>& cross_section,
+          const size_t threshold_energy_index,
+          const double production_threshold,
+          const double binding_energy,
+          HardReactionData& hard_reaction_data );
+
+  // Integrate a lin-lin tabulated pdf below a threshold
+  static void integrateTabulatedPDF( const std::vector<double>& values,
+                                     const std::vector<double>& pdf,
+                                     const double threshold,
+                                     double& soft_integral,
+                                     double& soft_first_moment,
+                                     double& total_integral );
+
+  // Interpolate a lin-lin tabulated function (constant outside of the table)
+  static double interpolate( const Utility::ArrayView<const double>& x,
+                             const Utility::ArrayView<const double>& y,
+                             const double x_value );
+
+  // Evaluate a tabulated quantity on the energy grid
+  double evaluate( const std::vector<double>& quantity,
+                   const double energy ) const;
+
+  // Sample the secondary energy of a hard reaction
+  static double sampleSecondaryEnergy(
+                                const HardReactionData& hard_reaction_data,
+                                const double energy );
+
+  // Undergo a hard knock-on collision
+  static void collideHardKnockOn( const HardReactionData& hard_reaction_data,
+                                  ElectronState& electron,
+                                  ParticleBank& bank );
+
+  // Undergo a hard bremsstrahlung collision
+  static void collideHardBremsstrahlung(
+                                const HardReactionData& hard_reaction_data,
+                                ElectronState& electron,
+                                ParticleBank& bank );
+
+  // The knock-on production threshold
+  double d_knock_on_threshold;
+
+  // The bremsstrahlung production threshold
+  double d_bremsstrahlung_threshold;
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The restricted stopping cross section (MeV-b)
+  std::vector<double> d_restricted_stopping_cross_section;
+
+  // The transport cross section (b)
+  std::vector<double> d_transport_cross_section;
+
+  // The hard knock-on cross section (b)
+  std::vector<double> d_hard_knock_on_cross_section;
+
+  // The hard knock-on reactions (one for each subshell)
+  std::vector<HardReactionData> d_hard_knock_on_reactions;
+
+  // The hard bremsstrahlung reaction
+  std::unique_ptr<HardReactionData> d_hard_bremsstrahlung_reaction;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTROATOM_DATA_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectroatomData.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,470 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronMaterialData.cpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron material data class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronMaterialData.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The number of grid points per energy decade
+const double CondensedHistoryElectronMaterialData::s_grid_points_per_decade = 50.0;
+
+// The min Wentzel screening parameter
+const double CondensedHistoryElectronMaterialData::s_min_screening_parameter = 1e-12;
+
+// The max Wentzel screening parameter (isotropic)
+const double CondensedHistoryElectronMaterialData::s_max_screening_parameter = 1e8;
+
+// Constructor
+/*! \details The energy grid will span the energy range that is shared by
+ * all of the atoms. The CSDA range at the min energy is zero.
+ */
+CondensedHistoryElectronMaterialData::CondensedHistoryElectronMaterialData(
+                                                      const AtomArray& atoms )
+  : d_atoms( atoms )
+{
+  // Make sure there is at least one atom
+  testPrecondition( atoms.size() > 0 );
+
+  double min_energy = 0.0;
+  double max_energy = std::numeric_limits<double>::max();
+
+  for( size_t i = 0; i < d_atoms.size(); ++i )
+  {
+    min_energy = std::max( min_energy, d_atoms[i].second->getMinEnergy() );
+    max_energy = std::min( max_energy, d_atoms[i].second->getMaxEnergy() );
+  }
+
+  TEST_FOR_EXCEPTION( min_energy >= max_energy,
+                      std::runtime_error,
+                      "The atoms do not share an energy range!" );
+
+  const size_t number_of_grid_points = 1 +
+    (size_t)std::ceil( std::log10( max_energy/min_energy )*
+                       s_grid_points_per_decade );
+
+  d_log_min_energy = std::log( min_energy );
+  d_log_energy_spacing =
+    std::log( max_energy/min_energy )/(number_of_grid_points - 1);
+
+  d_energy_grid.resize( number_of_grid_points );
+  d_restricted_stopping_power.resize( number_of_grid_points, 0.0 );
+  d_range.resize( number_of_grid_points, 0.0 );
+  d_macroscopic_transport_cross_section.resize( number_of_grid_points, 0.0 );
+  d_macroscopic_hard_cross_section.resize( number_of_grid_points, 0.0 );
+
+  for( size_t j = 0; j < number_of_grid_points; ++j )
+  {
+    // Make sure that the grid end points are exact
+    if( j == 0 )
+      d_energy_grid[j] = min_energy;
+    else if( j == number_of_grid_points - 1 )
+      d_energy_grid[j] = max_energy;
+    else
+      d_energy_grid[j] = std::exp( d_log_min_energy + j*d_log_energy_spacing );
+
+    for( size_t i = 0; i < d_atoms.size(); ++i )
+    {
+      const double number_density = d_atoms[i].first;
+      const CondensedHistoryElectroatomData& atom = *d_atoms[i].second;
+
+      d_restricted_stopping_power[j] += number_density*
+        atom.getRestrictedStoppingCrossSection( d_energy_grid[j] );
+
+      d_macroscopic_transport_cross_section[j] += number_density*
+        atom.getTransportCrossSection( d_energy_grid[j] );
+
+      d_macroscopic_hard_cross_section[j] += number_density*
+        atom.getHardCrossSection( d_energy_grid[j] );
+    }
+
+    TEST_FOR_EXCEPTION( d_restricted_stopping_power[j] <= 0.0,
+                        std::runtime_error,
+                        "The restricted stopping power must be positive "
+                        "(energy = " << d_energy_grid[j] << ")!" );
+
+    // Integrate dE/S = E/S dlnE with the trapezoid rule
+    if( j > 0 )
+    {
+      d_range[j] = d_range[j-1] + 0.5*d_log_energy_spacing*
+        (d_energy_grid[j-1]/d_restricted_stopping_power[j-1] +
+         d_energy_grid[j]/d_restricted_stopping_power[j]);
+    }
+  }
+}
+
+// Return the min energy (MeV)
+double CondensedHistoryElectronMaterialData::getMinEnergy() const
+{
+  return d_energy_grid.front();
+}
+
+// Return the max energy (MeV)
+double CondensedHistoryElectronMaterialData::getMaxEnergy() const
+{
+  return d_energy_grid.back();
+}
+
+// Calculate the energy grid index and the interpolation fraction
+/*! \details Energies outside of the grid will be mapped to the closest grid
+ * end point.
+ */
+inline size_t CondensedHistoryElectronMaterialData::calculateEnergyGridIndex(
+                                       const double energy,
+                                       double& interpolation_fraction ) const
+{
+  const double grid_coordinate =
+    (std::log( energy ) - d_log_min_energy)/d_log_energy_spacing;
+
+  const size_t last_bin = d_energy_grid.size() - 2;
+
+  if( grid_coordinate <= 0.0 )
+  {
+    interpolation_fraction = 0.0;
+
+    return 0;
+  }
+  else if( grid_coordinate >= last_bin + 1 )
+  {
+    interpolation_fraction = 1.0;
+
+    return last_bin;
+  }
+  else
+  {
+    const size_t index = (size_t)grid_coordinate;
+
+    interpolation_fraction = grid_coordinate - index;
+
+    return index;
+  }
+}
+
+// Interpolate a tabulated quantity
+inline double CondensedHistoryElectronMaterialData::interpolate(
+                                          const std::vector<double>& quantity,
+                                          const double energy ) const
+{
+  double interpolation_fraction;
+
+  const size_t index =
+    this->calculateEnergyGridIndex( energy, interpolation_fraction );
+
+  return quantity[index] +
+    interpolation_fraction*(quantity[index+1] - quantity[index]);
+}
+
+// Return the restricted stopping power (MeV/cm)
+double CondensedHistoryElectronMaterialData::getRestrictedStoppingPower(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_restricted_stopping_power, energy );
+}
+
+// Return the CSDA range (cm)
+double CondensedHistoryElectronMaterialData::getRange(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_range, energy );
+}
+
+// Return the macroscopic transport cross section (1/cm)
+double CondensedHistoryElectronMaterialData::getMacroscopicTransportCrossSection(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_macroscopic_transport_cross_section, energy );
+}
+
+// Return the macroscopic hard collision cross section (1/cm)
+double CondensedHistoryElectronMaterialData::getMacroscopicHardCrossSection(
+                                                    const double energy ) const
+{
+  return this->interpolate( d_macroscopic_hard_cross_section, energy );
+}
+
+// Return the energy after traveling the path length (MeV)
+/*! \details The min energy will be returned if the path length is greater
+ * than or equal to the CSDA range.
+ */
+double CondensedHistoryElectronMaterialData::getEnergyAfterStep(
+                                              const double energy,
+                                              const double path_length ) const
+{
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  const double remaining_range = this->getRange( energy ) - path_length;
+
+  if( remaining_range <= 0.0 )
+    return d_energy_grid.front();
+
+  // The range is linear in the log of the energy in each bin
+  const size_t index =
+    Utility::Search::binaryLowerBoundIndex( d_range.begin(),
+                                            d_range.end(),
+                                            remaining_range );
+
+  if( index >= d_energy_grid.size() - 1 )
+    return d_energy_grid.back();
+
+  const double interpolation_fraction =
+    (remaining_range - d_range[index])/(d_range[index+1] - d_range[index]);
+
+  return std::min( std::exp( d_log_min_energy +
+                             (index + interpolation_fraction)*
+                             d_log_energy_spacing ),
+                   energy );
+}
+
+// Return the max step length for the fractional energy loss (cm)
+double CondensedHistoryElectronMaterialData::getMaxStepLength(
+                                 const double energy,
+                                 const double max_energy_loss_fraction ) const
+{
+  // Make sure the fraction is valid
+  testPrecondition( max_energy_loss_fraction > 0.0 );
+  testPrecondition( max_energy_loss_fraction <= 1.0 );
+
+  const double final_energy = (1.0 - max_energy_loss_fraction)*energy;
+
+  if( final_energy <= d_energy_grid.front() )
+    return this->getRange( energy );
+  else
+    return this->getRange( energy ) - this->getRange( final_energy );
+}
+
+// Return the mean projected step length (cm)
+/*! \details The mean projected step length is the mean distance that the
+ * electron travels along its initial direction
+ * (\f$\langle z \rangle = (1 - e^{-s\Sigma_{tr}})/\Sigma_{tr}\f$). The
+ * macroscopic transport cross section is assumed to be constant along the
+ * step (the energy at the middle of the step should be used).
+ */
+double CondensedHistoryElectronMaterialData::getMeanProjectedStepLength(
+                                              const double energy,
+                                              const double path_length ) const
+{
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  const double transport_cross_section =
+    this->getMacroscopicTransportCrossSection( energy );
+
+  if( transport_cross_section <= 0.0 )
+    return path_length;
+
+  return -std::expm1( -path_length*transport_cross_section )/
+    transport_cross_section;
+}
+
+// Return the path length of a mean projected step length (cm)
+/*! \details This is the inverse of
+ * MonteCarlo::CondensedHistoryElectronMaterialData::getMeanProjectedStepLength.
+ * The projected step length must be less than the transport mean free path.
+ */
+double CondensedHistoryElectronMaterialData::getPathLength(
+                                    const double energy,
+                                    const double projected_step_length ) const
+{
+  // Make sure the projected step length is valid
+  testPrecondition( projected_step_length >= 0.0 );
+
+  const double transport_cross_section =
+    this->getMacroscopicTransportCrossSection( energy );
+
+  if( transport_cross_section <= 0.0 )
+    return projected_step_length;
+
+  const double scaled_projected_step_length =
+    projected_step_length*transport_cross_section;
+
+  // The projected step length cannot reach the transport mean free path
+  if( scaled_projected_step_length >= 1.0 )
+    return std::numeric_limits<double>::max();
+
+  return -std::log1p( -scaled_projected_step_length )/transport_cross_section;
+}
+
+// Return the root mean square lateral displacement at the end of a step
+/*! \details The mean square displacement of the step is
+ * \f$\langle r^2 \rangle = 2(s\Sigma_{tr} - 1 + e^{-s\Sigma_{tr}})/\Sigma_{tr}^2\f$.
+ * The mean square lateral displacement is approximated by
+ * \f$\langle r^2 \rangle - \langle z \rangle^2\f$, which reduces to the
+ * Fermi-Eyges result (\f$2s^3\Sigma_{tr}/3\f$) for short steps. The
+ * macroscopic transport cross section is assumed to be constant along the
+ * step (the energy at the middle of the step should be used).
+ */
+double CondensedHistoryElectronMaterialData::getRootMeanSquareLateralDisplacement(
+                                              const double energy,
+                                              const double path_length ) const
+{
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  const double transport_cross_section =
+    this->getMacroscopicTransportCrossSection( energy );
+
+  if( transport_cross_section <= 0.0 )
+    return 0.0;
+
+  const double scaled_path_length = path_length*transport_cross_section;
+
+  // Use the series expansion for short steps to avoid cancellation
+  double scaled_mean_square_lateral_displacement;
+
+  if( scaled_path_length < 1e-3 )
+  {
+    scaled_mean_square_lateral_displacement =
+      scaled_path_length*scaled_path_length*scaled_path_length*
+      (2.0/3.0 - scaled_path_length*(0.5 - 7.0/30.0*scaled_path_length));
+  }
+  else
+  {
+    const double scaled_mean_projected_step_length =
+      -std::expm1( -scaled_path_length );
+
+    scaled_mean_square_lateral_displacement =
+      2.0*(scaled_path_length - scaled_mean_projected_step_length) -
+      scaled_mean_projected_step_length*scaled_mean_projected_step_length;
+  }
+
+  if( scaled_mean_square_lateral_displacement <= 0.0 )
+    return 0.0;
+
+  return std::sqrt( scaled_mean_square_lateral_displacement )/
+    transport_cross_section;
+}
+
+// Sample the multiple scattering angle cosine at the end of a step
+/*! \details The macroscopic transport cross section is assumed to be
+ * constant along the step (the energy at the middle of the step should
+ * be used).
+ */
+double CondensedHistoryElectronMaterialData::sampleMultipleScatteringAngleCosine(
+                                              const double energy,
+                                              const double path_length ) const
+{
+  // Make sure the path length is valid
+  testPrecondition( path_length >= 0.0 );
+
+  const double mean_angular_deflection = -std::expm1(
+        -path_length*this->getMacroscopicTransportCrossSection( energy ) );
+
+  if( mean_angular_deflection <= 0.0 )
+    return 1.0;
+
+  return this->sampleWentzelAngleCosine(
+           this->calculateWentzelScreeningParameter( mean_angular_deflection ),
+           Utility::RandomNumberGenerator::getRandomNumber<double>() );
+}
+
+// Undergo a hard collision
+/*! \details The atom is sampled using the macroscopic hard collision cross
+ * sections of the atoms.
+ */
+void CondensedHistoryElectronMaterialData::collideHard(
+                                                  ElectronState& electron,
+                                                  ParticleBank& bank ) const
+{
+  const double energy = electron.getEnergy();
+
+  double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getMacroscopicHardCrossSection( energy );
+
+  size_t i = 0;
+
+  for( ; i < d_atoms.size() - 1; ++i )
+  {
+    scaled_random_number -=
+      d_atoms[i].first*d_atoms[i].second->getHardCrossSection( energy );
+
+    if( scaled_random_number < 0.0 )
+      break;
+  }
+
+  d_atoms[i].second->collideHard( electron, bank );
+}
+
+// Calculate the Wentzel screening parameter from the mean deflection
+/*! \details The mean angular deflection (\f$\langle 1-\mu \rangle\f$) of the
+ * Wentzel distribution is \f$2A[(1+A)\ln(1+1/A)-1]\f$, which increases
+ * monotonically from 0 to 1 as the screening parameter A increases. The
+ * screening parameter is found using bisection on ln(A).
+ */
+double CondensedHistoryElectronMaterialData::calculateWentzelScreeningParameter(
+                                         const double mean_angular_deflection )
+{
+  // Make sure the mean angular deflection is valid
+  testPrecondition( mean_angular_deflection > 0.0 );
+
+  double log_lower_bound = std::log( s_min_screening_parameter );
+  double log_upper_bound = std::log( s_max_screening_parameter );
+
+  // The distribution is effectively isotropic
+  if( mean_angular_deflection >= 1.0 )
+    return s_max_screening_parameter;
+
+  for( unsigned i = 0; i < 64; ++i )
+  {
+    const double log_screening_parameter =
+      0.5*(log_lower_bound + log_upper_bound);
+
+    const double screening_parameter = std::exp( log_screening_parameter );
+
+    const double trial_mean_angular_deflection = 2.0*screening_parameter*
+      ((1.0 + screening_parameter)*std::log1p( 1.0/screening_parameter ) - 1.0);
+
+    if( trial_mean_angular_deflection < mean_angular_deflection )
+      log_lower_bound = log_screening_parameter;
+    else
+      log_upper_bound = log_screening_parameter;
+
+    if( log_upper_bound - log_lower_bound < 1e-8 )
+      break;
+  }
+
+  return std::exp( 0.5*(log_lower_bound + log_upper_bound) );
+}
+
+// Sample an angle cosine from the Wentzel distribution
+/*! \details The Wentzel distribution is
+ * \f$p(\mu) \propto 1/(1 - \mu + 2A)^2\f$. The inverse of its cdf is
+ * \f$\mu = 1 - 2A\xi/(1 - \xi + A)\f$.
+ */
+double CondensedHistoryElectronMaterialData::sampleWentzelAngleCosine(
+                                             const double screening_parameter,
+                                             const double random_number )
+{
+  // Make sure the screening parameter is valid
+  testPrecondition( screening_parameter > 0.0 );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const double angle_cosine = 1.0 - 2.0*screening_parameter*random_number/
+    (1.0 - random_number + screening_parameter);
+
+  return std::max( std::min( angle_cosine, 1.0 ), -1.0 );
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronMaterialData.cpp
+//---------------------------------------------------------------------------//
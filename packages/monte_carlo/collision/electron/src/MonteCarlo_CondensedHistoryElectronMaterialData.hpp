@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_CondensedHistoryElectronMaterialData.hpp
+//! \author Alex Robinson
+//! \brief  The condensed history electron material data class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_MATERIAL_DATA_HPP
+#define MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_MATERIAL_DATA_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <utility>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectroatomData.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The condensed history electron material data class
+ * \details This class combines the condensed history data of the atoms in a
+ * material. The restricted stopping power, the continuous slowing down
+ * (CSDA) range, the macroscopic transport cross section and the macroscopic
+ * hard collision cross section are tabulated on a log-uniform energy grid
+ * so that they can be looked up without a search. The energy at the end of
+ * a step is calculated by inverting the CSDA range. The multiple scattering
+ * angular deflection at the end of a step is sampled from a Wentzel
+ * (screened Rutherford) distribution with a screening parameter that
+ * reproduces the Goudsmit-Saunderson mean angular deflection of the step
+ * (\f$\langle 1-\mu \rangle = 1 - e^{-s\Sigma_{tr}}\f$). The mean
+ * projected step length (path length correction) and the root mean square
+ * lateral displacement at the end of a step are calculated from the Lewis
+ * moments of the step.
+ */
+class CondensedHistoryElectronMaterialData
+{
+
+public:
+
+  //! The atom array type (number density (atom/b-cm), atom data)
+  typedef std::vector<std::pair<double,std::shared_ptr<const CondensedHistoryElectroatomData> > > AtomArray;
+
+  //! Constructor
+  CondensedHistoryElectronMaterialData( const AtomArray& atoms );
+
+  //! Destructor
+  ~CondensedHistoryElectronMaterialData()
+  { /* ... */ }
+
+  //! Return the min energy (MeV)
+  double getMinEnergy() const;
+
+  //! Return the max energy (MeV)
+  double getMaxEnergy() const;
+
+  //! Return the restricted stopping power (MeV/cm)
+  double getRestrictedStoppingPower( const double energy ) const;
+
+  //! Return the CSDA range (cm)
+  double getRange( const double energy ) const;
+
+  //! Return the macroscopic transport cross section (1/cm)
+  double getMacroscopicTransportCrossSection( const double energy ) const;
+
+  //! Return the macroscopic hard collision cross section (1/cm)
+  double getMacroscopicHardCrossSection( const double energy ) const;
+
+  //! Return the energy after traveling the path length (MeV)
+  double getEnergyAfterStep( const double energy,
+                             const double path_length ) const;
+
+  //! Return the max step length for the fractional energy loss (cm)
+  double getMaxStepLength( const double energy,
+                           const double max_energy_loss_fraction ) const;
+
+  //! Return the mean projected step length (cm)
+  double getMeanProjectedStepLength( const double energy,
+                                     const double path_length ) const;
+
+  //! Return the path length of a mean projected step length (cm)
+  double getPathLength( const double energy,
+                        const double projected_step_length ) const;
+
+  //! Return the root mean square lateral displacement at the end of a step
+  double getRootMeanSquareLateralDisplacement( const double energy,
+                                               const double path_length ) const;
+
+  //! Sample the multiple scattering angle cosine at the end of a step
+  double sampleMultipleScatteringAngleCosine( const double energy,
+                                              const double path_length ) const;
+
+  //! Undergo a hard collision
+  void collideHard( ElectronState& electron, ParticleBank& bank ) const;
+
+  //! Calculate the Wentzel screening parameter from the mean deflection
+  static double calculateWentzelScreeningParameter(
+                                        const double mean_angular_deflection );
+
+  //! Sample an angle cosine from the Wentzel distribution
+  static double sampleWentzelAngleCosine( const double screening_parameter,
+                                          const double random_number );
+
+private:
+
+  // Calculate the energy grid index and the interpolation fraction
+  size_t calculateEnergyGridIndex( const double energy,
+                                   double& interpolation_fraction ) const;
+
+  // Interpolate a tabulated quantity
+  double interpolate( const std::vector<double>& quantity,
+                      const double energy ) const;
+
+  // The number of grid points per energy decade
+  static const double s_grid_points_per_decade;
+
+  // The min Wentzel screening parameter
+  static const double s_min_screening_parameter;
+
+  // The max Wentzel screening parameter (isotropic)
+  static const double s_max_screening_parameter;
+
+  // The atoms
+  AtomArray d_atoms;
+
+  // The log of the min energy
+  double d_log_min_energy;
+
+  // The log energy grid spacing
+  double d_log_energy_spacing;
+
+  // The energy grid
+  std::vector<double> d_energy_grid;
+
+  // The restricted stopping power (MeV/cm)
+  std::vector<double> d_restricted_stopping_power;
+
+  // The CSDA range (cm)
+  std::vector<double> d_range;
+
+  // The macroscopic transport cross section (1/cm)
+  std::vector<double> d_macroscopic_transport_cross_section;
+
+  // The macroscopic hard collision cross section (1/cm)
+  std::vector<double> d_macroscopic_hard_cross_section;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_CONDENSED_HISTORY_ELECTRON_MATERIAL_DATA_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_CondensedHistoryElectronMaterialData.hpp
+//---------------------------------------------------------------------------//
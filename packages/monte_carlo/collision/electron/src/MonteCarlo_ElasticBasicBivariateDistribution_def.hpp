@@ -429,11 +429,8 @@ auto UnitAwareElasticBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependen
     Utility::RandomNumberGenerator::getRandomNumber<double>();
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                       &BaseUnivariateDistributionType::sampleWithRandomNumber,
-                       std::placeholders::_1,
-                       random_number );
+  Utility::Details::SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>
+    sampling_functor( random_number );
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -490,8 +487,7 @@ auto UnitAwareElasticBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependen
   SecondaryIndepQuantity dummy_raw_sample;
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Utility::Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
+  auto sampling_functor = Utility::Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
 
   return this->sampleDetailedImpl( primary_indep_var_value,
                                    sampling_functor,
@@ -516,8 +512,7 @@ auto UnitAwareElasticBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependen
   -> SecondaryIndepQuantity
 {
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Utility::Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
+  auto sampling_functor = Utility::Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
 
   return this->sampleDetailedImpl( primary_indep_var_value,
                                    sampling_functor,
@@ -540,11 +535,8 @@ auto UnitAwareElasticBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependen
   testPrecondition( random_number <= 1.0 );
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                       &BaseUnivariateDistributionType::sampleWithRandomNumber,
-                       std::placeholders::_1,
-                       random_number );
+  Utility::Details::SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>
+    sampling_functor( random_number );
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -586,29 +578,17 @@ auto UnitAwareElasticBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependen
   testPrecondition( max_secondary_indep_var_value >
                     d_lower_bound_conditional_indep_var );
 
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-      sampling_functor;
-
   // Check if the max_secondary_indep_var_value is greater than the max indep value at the energy
-  if ( max_secondary_indep_var_value >
-       d_upper_bound_conditional_indep_var )
-  {
-    // Create the sampling functor
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-             &BaseUnivariateDistributionType::sampleWithRandomNumberInSubrange,
-             std::placeholders::_1,
-             random_number,
-             d_upper_bound_conditional_indep_var );
-  }
-  else
-  {
-    // Create the sampling functor
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-             &BaseUnivariateDistributionType::sampleWithRandomNumberInSubrange,
-             std::placeholders::_1,
-             random_number,
-             max_secondary_indep_var_value );
-  }
+  const SecondaryIndepQuantity subrange_max_secondary_indep_var_value =
+    max_secondary_indep_var_value > d_upper_bound_conditional_indep_var ?
+    d_upper_bound_conditional_indep_var : max_secondary_indep_var_value;
+
+  // Create the sampling functor
+  auto sampling_functor =
+    [random_number, subrange_max_secondary_indep_var_value]( const BaseUnivariateDistributionType& distribution ){
+      return distribution.sampleWithRandomNumberInSubrange(
+                                    random_number,
+                                    subrange_max_secondary_indep_var_value ); };
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -17,6 +17,7 @@
 #include "MonteCarlo_ElectroatomicReaction.hpp"
 #include "MonteCarlo_AtomicRelaxationModel.hpp"
 #include "MonteCarlo_ElectroatomCore.hpp"
+#include "MonteCarlo_CondensedHistoryElectroatomData.hpp"
 #include "MonteCarlo_Atom.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_QuantityTraits.hpp"
@@ -82,6 +83,21 @@ public:
                     const double energy,
                     const ElectroatomicReactionType reaction ) const;
 
+  //! Set the condensed history data
+  void setCondensedHistoryData(
+   const std::shared_ptr<const CondensedHistoryElectroatomData>& condensed_history_data );
+
+  //! Check if there is condensed history data
+  bool hasCondensedHistoryData() const;
+
+  //! Return the condensed history data
+  const std::shared_ptr<const CondensedHistoryElectroatomData>&
+  getCondensedHistoryData() const;
+
+private:
+
+  // The condensed history data
+  std::shared_ptr<const CondensedHistoryElectroatomData> d_condensed_history_data;
 };
 
 // Relax the atom
@@ -95,6 +111,26 @@ inline void Electroatom::relaxAtom( const Data::SubshellType vacancy_shell,
                                                         bank );
 }
 
+// Set the condensed history data
+inline void Electroatom::setCondensedHistoryData(
+   const std::shared_ptr<const CondensedHistoryElectroatomData>& condensed_history_data )
+{
+  d_condensed_history_data = condensed_history_data;
+}
+
+// Check if there is condensed history data
+inline bool Electroatom::hasCondensedHistoryData() const
+{
+  return d_condensed_history_data.get() != NULL;
+}
+
+// Return the condensed history data
+inline const std::shared_ptr<const CondensedHistoryElectroatomData>&
+Electroatom::getCondensedHistoryData() const
+{
+  return d_condensed_history_data;
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "MonteCarlo_ElectroatomNativeFactory.hpp"
 #include "MonteCarlo_ElectroatomicReactionNativeFactory.hpp"
+#include "MonteCarlo_CondensedHistoryElectroatomData.hpp"
 #include "Utility_StandardHashBasedGridSearcher.hpp"
 #include "Utility_TwoDInterpolationPolicy.hpp"
 #include "Utility_DesignByContract.hpp"
@@ -151,10 +152,27 @@ void ElectroatomNativeFactory::createElectroatom(
 
 
   // Create the electroatom
-  electroatom.reset( new Electroatom( electroatom_name,
-                                      raw_electroatom_data.getAtomicNumber(),
-                                      atomic_weight,
-                                      *core ) );
+  std::shared_ptr<Electroatom> new_electroatom(
+                       new Electroatom( electroatom_name,
+                                        raw_electroatom_data.getAtomicNumber(),
+                                        atomic_weight,
+                                        *core ) );
+
+  // Create the condensed history data
+  if( properties.isCondensedHistoryModeOn() )
+  {
+    new_electroatom->setCondensedHistoryData(
+      std::make_shared<const CondensedHistoryElectroatomData>(
+                     raw_electroatom_data,
+                     properties.getCondensedHistoryKnockOnThreshold(),
+                     properties.getCondensedHistoryBremsstrahlungThreshold(),
+                     properties.isElasticModeOn(),
+                     properties.isElectroionizationModeOn(),
+                     properties.isBremsstrahlungModeOn(),
+                     properties.isAtomicExcitationModeOn() ) );
+  }
+
+  electroatom = new_electroatom;
 }
 
 } // end MonteCarlo namespace
@@ -31,7 +31,45 @@ ElectronMaterial::ElectronMaterial(
               electroatom_name_map,
               electroatom_fractions,
               electroatom_names )
-{ /* ... */ }
+{
+  // Combine the condensed history data of the electroatoms (if present)
+  CondensedHistoryElectronMaterialData::AtomArray condensed_history_atoms(
+                                        this->getNumberOfScatteringCenters() );
+
+  for( size_t i = 0; i < condensed_history_atoms.size(); ++i )
+  {
+    const Electroatom& electroatom = this->getScatteringCenter( i );
+
+    if( !electroatom.hasCondensedHistoryData() )
+      return;
+
+    condensed_history_atoms[i].first =
+      this->getScatteringCenterNumberDensity( i );
+    condensed_history_atoms[i].second = electroatom.getCondensedHistoryData();
+  }
+
+  if( !condensed_history_atoms.empty() )
+  {
+    d_condensed_history_data.reset(
+          new CondensedHistoryElectronMaterialData( condensed_history_atoms ) );
+  }
+}
+
+// Check if there is condensed history data
+bool ElectronMaterial::hasCondensedHistoryData() const
+{
+  return d_condensed_history_data.get() != NULL;
+}
+
+// Return the condensed history data
+const CondensedHistoryElectronMaterialData&
+ElectronMaterial::getCondensedHistoryData() const
+{
+  // Make sure that there is condensed history data
+  testPrecondition( this->hasCondensedHistoryData() );
+
+  return *d_condensed_history_data;
+}
 
 } // end MonteCarlo namespace
 
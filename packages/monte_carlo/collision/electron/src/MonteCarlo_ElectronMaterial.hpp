@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_Electroatom.hpp"
+#include "MonteCarlo_CondensedHistoryElectronMaterialData.hpp"
 #include "MonteCarlo_Material.hpp"
 #include "Utility_Tuple.hpp"
 #include "Utility_Vector.hpp"
@@ -61,6 +62,18 @@ public:
   //! Destructor
   ~ElectronMaterial()
   { /* ... */ }
+
+  //! Check if there is condensed history data
+  bool hasCondensedHistoryData() const;
+
+  //! Return the condensed history data
+  const CondensedHistoryElectronMaterialData& getCondensedHistoryData() const;
+
+private:
+
+  // The condensed history data (only if every electroatom has it)
+  std::shared_ptr<const CondensedHistoryElectronMaterialData>
+  d_condensed_history_data;
 };
 
 } // end MonteCarlo namespace
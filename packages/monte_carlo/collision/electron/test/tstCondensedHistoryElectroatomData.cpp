@@ -0,0 +1,157 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCondensedHistoryElectroatomData.cpp
+//! \author Alex Robinson
+//! \brief  Condensed history electroatom data unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectroatomData.hpp"
+#include "MonteCarlo_ElectronState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::unique_ptr<Data::ElectronPhotonRelaxationDataContainer> data_container;
+std::unique_ptr<const MonteCarlo::CondensedHistoryElectroatomData> data;
+std::unique_ptr<const MonteCarlo::CondensedHistoryElectroatomData> low_threshold_data;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the energy limits can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData, getMinMaxEnergy )
+{
+  FRENSIE_CHECK_EQUAL( data->getMinEnergy(),
+                       data_container->getElectronEnergyGrid().front() );
+  FRENSIE_CHECK_EQUAL( data->getMaxEnergy(),
+                       data_container->getElectronEnergyGrid().back() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the production thresholds can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData, getThresholds )
+{
+  FRENSIE_CHECK_EQUAL( data->getKnockOnThreshold(), 1e-2 );
+  FRENSIE_CHECK_EQUAL( data->getBremsstrahlungThreshold(), 1e-2 );
+
+  FRENSIE_CHECK_EQUAL( low_threshold_data->getKnockOnThreshold(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( low_threshold_data->getBremsstrahlungThreshold(),
+                       1e-3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the restricted stopping cross section can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData,
+                   getRestrictedStoppingCrossSection )
+{
+  FRENSIE_CHECK_GREATER( data->getRestrictedStoppingCrossSection( 1.0 ), 0.0 );
+  FRENSIE_CHECK_GREATER( data->getRestrictedStoppingCrossSection( 1e-2 ),
+                         0.0 );
+
+  // Lowering the production thresholds moves energy loss from the soft
+  // collisions to the hard collisions
+  FRENSIE_CHECK_LESS_OR_EQUAL(
+              low_threshold_data->getRestrictedStoppingCrossSection( 1.0 ),
+              data->getRestrictedStoppingCrossSection( 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the transport cross section can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData, getTransportCrossSection )
+{
+  FRENSIE_CHECK_GREATER( data->getTransportCrossSection( 1.0 ), 0.0 );
+
+  // The transport cross section decreases with energy
+  FRENSIE_CHECK_GREATER( data->getTransportCrossSection( 1e-2 ),
+                         data->getTransportCrossSection( 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hard cross sections can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData, getHardCrossSection )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                          data->getHardCrossSection( 1.0 ),
+                          data->getHardKnockOnCrossSection( 1.0 ) +
+                          data->getHardBremsstrahlungCrossSection( 1.0 ),
+                          1e-12 );
+
+  FRENSIE_CHECK_GREATER( data->getHardKnockOnCrossSection( 1.0 ), 0.0 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL(
+                           low_threshold_data->getHardCrossSection( 1.0 ),
+                           data->getHardCrossSection( 1.0 ) );
+
+  // Few hard knock-on electrons can be created near twice the threshold
+  FRENSIE_CHECK_LESS( data->getHardKnockOnCrossSection( 1.5e-2 ),
+                      data->getHardKnockOnCrossSection( 1.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a hard collision can be simulated
+FRENSIE_UNIT_TEST( CondensedHistoryElectroatomData, collideHard )
+{
+  MonteCarlo::ElectronState electron( 0 );
+  electron.setEnergy( 1.0 );
+  electron.setDirection( 0.0, 0.0, 1.0 );
+  electron.setWeight( 1.0 );
+
+  MonteCarlo::ParticleBank bank;
+
+  data->collideHard( electron, bank );
+
+  FRENSIE_CHECK_LESS( electron.getEnergy(), 1.0 );
+  FRENSIE_REQUIRE_EQUAL( bank.size(), 1 );
+
+  // The secondary must be above the production threshold
+  FRENSIE_CHECK_GREATER_OR_EQUAL( bank.top().getEnergy(), 1e-2 );
+  FRENSIE_CHECK_LESS_OR_EQUAL( bank.top().getEnergy() + electron.getEnergy(),
+                               1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_native_file_name;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_native_file",
+                                        test_native_file_name, "",
+                                        "Test native file name" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create the native data file container
+  data_container.reset( new Data::ElectronPhotonRelaxationDataContainer(
+                                                     test_native_file_name ) );
+
+  // Create the condensed history data
+  data.reset( new MonteCarlo::CondensedHistoryElectroatomData(
+                                            *data_container, 1e-2, 1e-2 ) );
+
+  low_threshold_data.reset( new MonteCarlo::CondensedHistoryElectroatomData(
+                                            *data_container, 1e-3, 1e-3 ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCondensedHistoryElectroatomData.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,273 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCondensedHistoryElectronMaterialData.cpp
+//! \author Alex Robinson
+//! \brief  Condensed history electron material data unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_CondensedHistoryElectronMaterialData.hpp"
+#include "Data_ElectronPhotonRelaxationDataContainer.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<const MonteCarlo::CondensedHistoryElectroatomData> atom_data;
+std::unique_ptr<const MonteCarlo::CondensedHistoryElectronMaterialData> material_data;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the energy limits can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData, getMinMaxEnergy )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY( material_data->getMinEnergy(),
+                                   atom_data->getMinEnergy(),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( material_data->getMaxEnergy(),
+                                   atom_data->getMaxEnergy(),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the macroscopic quantities are scaled by the number density
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   getMacroscopicQuantities )
+{
+  // Use an energy on the material energy grid
+  const double energy = 10.0*material_data->getMinEnergy();
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                      material_data->getRestrictedStoppingPower( energy ),
+                      0.5*atom_data->getRestrictedStoppingCrossSection( energy ),
+                      1e-9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                      material_data->getMacroscopicTransportCrossSection( energy ),
+                      0.5*atom_data->getTransportCrossSection( energy ),
+                      1e-9 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                      material_data->getMacroscopicHardCrossSection( energy ),
+                      0.5*atom_data->getHardCrossSection( energy ),
+                      1e-9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the CSDA range can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData, getRange )
+{
+  FRENSIE_CHECK_EQUAL( material_data->getRange( material_data->getMinEnergy() ),
+                       0.0 );
+
+  FRENSIE_CHECK_GREATER( material_data->getRange( 1e-2 ), 0.0 );
+  FRENSIE_CHECK_GREATER( material_data->getRange( 1.0 ),
+                         material_data->getRange( 1e-1 ) );
+  FRENSIE_CHECK_GREATER( material_data->getRange( 1e-1 ),
+                         material_data->getRange( 1e-2 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the energy after a step can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData, getEnergyAfterStep )
+{
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                             material_data->getEnergyAfterStep( 1.0, 0.0 ),
+                             1.0,
+                             1e-9 );
+
+  FRENSIE_CHECK_EQUAL(
+       material_data->getEnergyAfterStep( 1.0, material_data->getRange( 1.0 ) ),
+       material_data->getMinEnergy() );
+
+  const double energy_after_step = material_data->getEnergyAfterStep(
+                                   1.0, 0.5*material_data->getRange( 1.0 ) );
+
+  FRENSIE_CHECK_LESS( energy_after_step, 1.0 );
+  FRENSIE_CHECK_GREATER( energy_after_step, material_data->getMinEnergy() );
+
+  // The energy loss is consistent with the max step length
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+       material_data->getEnergyAfterStep(
+                          1.0, material_data->getMaxStepLength( 1.0, 0.1 ) ),
+       0.9,
+       1e-6 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the mean projected step length can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   getMeanProjectedStepLength )
+{
+  const double transport_cross_section =
+    material_data->getMacroscopicTransportCrossSection( 1.0 );
+
+  FRENSIE_CHECK_EQUAL( material_data->getMeanProjectedStepLength( 1.0, 0.0 ),
+                       0.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+              material_data->getMeanProjectedStepLength( 1.0, 1e-2 ),
+              (1.0 - std::exp( -1e-2*transport_cross_section ))/
+              transport_cross_section,
+              1e-12 );
+
+  // The path length correction always shortens the step
+  FRENSIE_CHECK_LESS( material_data->getMeanProjectedStepLength( 1.0, 1e-2 ),
+                      1e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the path length of a projected step length can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData, getPathLength )
+{
+  std::vector<double> path_lengths( {1e-6, 1e-4, 1e-2, 1e-1} );
+
+  for( size_t i = 0; i < path_lengths.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+         material_data->getPathLength(
+                 1.0,
+                 material_data->getMeanProjectedStepLength( 1.0, path_lengths[i] ) ),
+         path_lengths[i],
+         1e-9 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the root mean square lateral displacement can be returned
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   getRootMeanSquareLateralDisplacement )
+{
+  const double transport_cross_section =
+    material_data->getMacroscopicTransportCrossSection( 1.0 );
+
+  FRENSIE_CHECK_EQUAL(
+        material_data->getRootMeanSquareLateralDisplacement( 1.0, 0.0 ), 0.0 );
+
+  // Fermi-Eyges limit for short steps
+  const double short_path_length = 1e-5/transport_cross_section;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+        material_data->getRootMeanSquareLateralDisplacement( 1.0, short_path_length ),
+        std::sqrt( 2.0/3.0*short_path_length*short_path_length*
+                   short_path_length*transport_cross_section ),
+        1e-4 );
+
+  // Lewis moments for long steps
+  const double long_path_length = 2.0/transport_cross_section;
+  const double mean_projected_step_length =
+    (1.0 - std::exp( -2.0 ))/transport_cross_section;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+        material_data->getRootMeanSquareLateralDisplacement( 1.0, long_path_length ),
+        std::sqrt( 2.0*(1.0 + std::exp( -2.0 ))/
+                   (transport_cross_section*transport_cross_section) -
+                   mean_projected_step_length*mean_projected_step_length ),
+        1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Wentzel screening parameter reproduces the mean deflection
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   calculateWentzelScreeningParameter )
+{
+  std::vector<double> mean_angular_deflections( {1e-4, 1e-2, 0.1, 0.5, 0.9} );
+
+  for( size_t i = 0; i < mean_angular_deflections.size(); ++i )
+  {
+    const double screening_parameter = MonteCarlo::CondensedHistoryElectronMaterialData::calculateWentzelScreeningParameter( mean_angular_deflections[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+          2.0*screening_parameter*((1.0 + screening_parameter)*
+                                   std::log1p( 1.0/screening_parameter ) - 1.0),
+          mean_angular_deflections[i],
+          1e-6 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a Wentzel angle cosine can be sampled
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   sampleWentzelAngleCosine )
+{
+  FRENSIE_CHECK_EQUAL( MonteCarlo::CondensedHistoryElectronMaterialData::sampleWentzelAngleCosine( 0.1, 0.0 ),
+                       1.0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::CondensedHistoryElectronMaterialData::sampleWentzelAngleCosine( 0.1, 0.5 ),
+                                   1.0 - 0.1/0.6,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::CondensedHistoryElectronMaterialData::sampleWentzelAngleCosine( 0.1, 1.0 ),
+                                   -1.0,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the multiple scattering angle cosine can be sampled
+FRENSIE_UNIT_TEST( CondensedHistoryElectronMaterialData,
+                   sampleMultipleScatteringAngleCosine )
+{
+  // A zero length step does not deflect the electron
+  FRENSIE_CHECK_EQUAL(
+          material_data->sampleMultipleScatteringAngleCosine( 1.0, 0.0 ), 1.0 );
+
+  std::vector<double> fake_stream( {0.0, 0.5} );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL(
+          material_data->sampleMultipleScatteringAngleCosine( 1.0, 1e-2 ),
+          1.0 );
+
+  double angle_cosine =
+    material_data->sampleMultipleScatteringAngleCosine( 1.0, 1e-2 );
+
+  FRENSIE_CHECK_LESS( angle_cosine, 1.0 );
+  FRENSIE_CHECK_GREATER_OR_EQUAL( angle_cosine, -1.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+std::string test_native_file_name;
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_native_file",
+                                        test_native_file_name, "",
+                                        "Test native file name" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create the native data file container
+  Data::ElectronPhotonRelaxationDataContainer
+    data_container( test_native_file_name );
+
+  // Create the condensed history data
+  atom_data.reset( new MonteCarlo::CondensedHistoryElectroatomData(
+                                              data_container, 1e-2, 1e-2 ) );
+
+  MonteCarlo::CondensedHistoryElectronMaterialData::AtomArray atoms;
+  atoms.push_back( std::make_pair( 0.5, atom_data ) );
+
+  material_data.reset(
+                   new MonteCarlo::CondensedHistoryElectronMaterialData( atoms ) );
+
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCondensedHistoryElectronMaterialData.cpp
+//---------------------------------------------------------------------------//
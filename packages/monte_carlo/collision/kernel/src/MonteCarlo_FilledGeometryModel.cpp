@@ -109,6 +109,18 @@ bool FilledGeometryModel::isCellVoid(
   }
 }
 
+// Check if the cell containing the particle is a termination cell
+/*! \details The dense cell index stored by the particle's navigator will be
+ * used to look up the termination status, which avoids a search on the cell
+ * id.
+ */
+bool FilledGeometryModel::isTerminationCell(
+                                        const ParticleState& particle ) const
+{
+  return FilledNeutronGeometryModel::isTerminationCellAtIndex(
+                                                   particle.getCellIndex() );
+}
+
 // Get the unfilled geometry model
 const Geometry::Model& FilledGeometryModel::getUnfilledModel() const
 {
@@ -73,9 +73,26 @@ public:
   template<typename ParticleStateType>
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell containing the particle is void
+  template<typename State>
+  bool isCellVoid( const State& particle ) const;
+
+  //! Check if the cell with the dense index is void (as experienced by the given particle type)
+  template<typename ParticleStateType>
+  bool isCellVoidAtIndex( const size_t cell_index ) const;
+
   //! Check if a cell is a termination cell
   using FilledNeutronGeometryModel::isTerminationCell;
 
+  //! Check if the cell with the dense index is a termination cell
+  using FilledNeutronGeometryModel::isTerminationCellAtIndex;
+
+  //! Return the number of termination cells
+  using FilledNeutronGeometryModel::getNumberOfTerminationCells;
+
+  //! Check if the cell containing the particle is a termination cell
+  bool isTerminationCell( const ParticleState& particle ) const;
+
   //! Get the total macroscopic cross section of a material for the given particle type
   template<typename ParticleStateType>
   double getMacroscopicTotalCrossSection(
@@ -136,6 +153,12 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cs of a material for the given particle type
+  template<typename ParticleStateType>
+  double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const;
+
   //! Get the total forward macroscopic cs of a material for neutrons
   using FilledNeutronGeometryModel::getMacroscopicTotalForwardCrossSection;
 
@@ -196,6 +219,14 @@ public:
   //! Get the adjoint weight factor for adjoint electrons
   using FilledAdjointElectronGeometryModel::getAdjointWeightFactorQuick;
 
+  //! Check if a macroscopic majorant cross section exists for the given particle type
+  template<typename ParticleStateType>
+  bool hasMacroscopicMajorantCrossSection() const;
+
+  //! Get the macroscopic majorant cross section for the given particle type
+  template<typename ParticleStateType>
+  double getMacroscopicMajorantCrossSection( const double energy ) const;
+
   //! Get the critical line energies
   template<typename ParticleStateType>
   const std::vector<double>& getCriticalLineEnergies() const;
@@ -126,6 +126,24 @@ bool FilledGeometryModel::isCellVoid(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::isCellVoid( cell );
 }
 
+// Check if the cell containing the particle is void
+/*! \details The dense cell index stored by the particle's navigator will be
+ * used to look up the cell material, which avoids a search on the cell id.
+ */
+template<typename State>
+inline bool FilledGeometryModel::isCellVoid( const State& particle ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<State>::UpcastType::isCellVoidAtIndex( particle.getCellIndex() );
+}
+
+// Check if the cell with the dense index is void (as experienced by the given particle type)
+template<typename ParticleStateType>
+inline bool FilledGeometryModel::isCellVoidAtIndex(
+                                             const size_t cell_index ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::isCellVoidAtIndex( cell_index );
+}
+
 // Get the total macroscopic cross section of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getMacroscopicTotalCrossSection(
@@ -162,6 +180,33 @@ double FilledGeometryModel::getMacroscopicTotalForwardCrossSectionQuick(
   return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicTotalForwardCrossSectionQuick( cell, energy );
 }
 
+// Get the total forward macroscopic cs of a material for the given particle type
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename ParticleStateType>
+double FilledGeometryModel::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicTotalForwardCrossSectionQuickAtIndex( cell_index, energy );
+}
+
+// Check if a macroscopic majorant cross section exists for the given particle type
+template<typename ParticleStateType>
+bool FilledGeometryModel::hasMacroscopicMajorantCrossSection() const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::hasMacroscopicMajorantCrossSection();
+}
+
+// Get the macroscopic majorant cross section for the given particle type
+template<typename ParticleStateType>
+double FilledGeometryModel::getMacroscopicMajorantCrossSection(
+                                                   const double energy ) const
+{
+  return Details::FilledGeometryModelUpcastHelper<ParticleStateType>::UpcastType::getMacroscopicMajorantCrossSection( energy );
+}
+
 // Get the adjoint weight factor of a material for the given particle type
 template<typename ParticleStateType>
 double FilledGeometryModel::getAdjointWeightFactor(
@@ -6,9 +6,13 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <map>
+
 // FRENSIE Includes
 #include "MonteCarlo_FilledNeutronGeometryModel.hpp"
 #include "MonteCarlo_NuclideFactory.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
@@ -32,6 +36,101 @@ void FilledNeutronGeometryModel::loadScatteringCenters(
 
   nuclide_factory.createNuclideMap( scattering_center_name_map );
 }
+
+// Process the filled model
+/*! \details A broadened material will be created for each unique
+ * material and cell temperature pair.
+ */
+void FilledNeutronGeometryModel::processFilledModel()
+{
+  Geometry::Model::CellIdTemperatureMap cell_id_temperature_map;
+
+  this->getUnfilledModel().getCellTemperatures( cell_id_temperature_map );
+
+  d_cell_index_broadened_material_table.clear();
+
+  if( cell_id_temperature_map.empty() )
+    return;
+
+  d_cell_index_broadened_material_table.resize(
+                         this->getUnfilledModel().getNumberOfCellIndices() );
+
+  std::map<std::pair<const NeutronMaterial*,double>,std::shared_ptr<const DopplerBroadenedNeutronMaterial> > broadened_materials;
+
+  Geometry::Model::CellIdTemperatureMap::const_iterator cell_it =
+    cell_id_temperature_map.begin();
+
+  while( cell_it != cell_id_temperature_map.end() )
+  {
+    if( !this->isCellVoid( cell_it->first ) )
+    {
+      const std::shared_ptr<const NeutronMaterial>& material =
+        this->getMaterial( cell_it->first );
+
+      std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+        broadened_material =
+        broadened_materials[std::make_pair( material.get(), cell_it->second )];
+
+      if( !broadened_material )
+      {
+        broadened_material.reset( new DopplerBroadenedNeutronMaterial(
+                                                         material,
+                                                         cell_it->second ) );
+      }
+
+      d_cell_index_broadened_material_table[this->getUnfilledModel().getCellIndex( cell_it->first )] = broadened_material;
+    }
+
+    ++cell_it;
+  }
+}
+
+// Get the broadened material in the cell with the dense index
+/*! \details A null pointer will be returned if the cell is not broadened.
+ */
+const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+FilledNeutronGeometryModel::getBroadenedMaterialAtIndex(
+                                               const size_t cell_index ) const
+{
+  static const std::shared_ptr<const DopplerBroadenedNeutronMaterial>
+    null_material;
+
+  if( cell_index < d_cell_index_broadened_material_table.size() )
+    return d_cell_index_broadened_material_table[cell_index];
+  else
+    return null_material;
+}
+
+// Get the total macroscopic cross section of a material
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+double FilledNeutronGeometryModel::getMacroscopicTotalCrossSectionQuickAtIndex(
+                                                const size_t cell_index,
+                                                const double energy ) const
+{
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+    broadened_material = this->getBroadenedMaterialAtIndex( cell_index );
+
+  if( broadened_material )
+    return broadened_material->getMacroscopicTotalCrossSection( energy );
+  else
+    return BaseType::getMacroscopicTotalCrossSectionQuickAtIndex( cell_index,
+                                                                  energy );
+}
+
+// Get the key shared by cells that have identical cross sections
+const void* FilledNeutronGeometryModel::getCellCrossSectionKey(
+                                               const size_t cell_index ) const
+{
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+    broadened_material = this->getBroadenedMaterialAtIndex( cell_index );
+
+  if( broadened_material )
+    return broadened_material.get();
+  else
+    return BaseType::getCellCrossSectionKey( cell_index );
+}
   
 } // end MonteCarlo namespace
 
@@ -15,10 +15,16 @@
 // FRENSIE Includes
 #include "MonteCarlo_StandardFilledParticleGeometryModel.hpp"
 #include "MonteCarlo_NeutronMaterial.hpp"
+#include "MonteCarlo_DopplerBroadenedNeutronMaterial.hpp"
 
 namespace MonteCarlo{
 
-//! The filled neutron geometry model class
+/*! The filled neutron geometry model class
+ * \details Cells that have a temperature assigned in the unfilled model
+ * will use a Doppler broadened version of their material (see
+ * MonteCarlo::DopplerBroadenedNeutronMaterial). Cells without a temperature
+ * use the material data as is.
+ */
 class FilledNeutronGeometryModel : public StandardFilledParticleGeometryModel<NeutronMaterial>
 {
   // Typedef for the base type
@@ -42,6 +48,15 @@ public:
   ~FilledNeutronGeometryModel()
   { /* ... */ }
 
+  //! Get the broadened material in the cell with the dense index
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+  getBroadenedMaterialAtIndex( const size_t cell_index ) const;
+
+  //! Get the total macroscopic cross section of a material
+  double getMacroscopicTotalCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const final override;
+
 protected:
 
   //! Constructor
@@ -58,6 +73,18 @@ protected:
        const SimulationProperties& properties,
        const bool verbose,                  
        ScatteringCenterNameMap& scattering_center_name_map ) const final override;
+
+  //! Process the filled model
+  void processFilledModel() final override;
+
+  //! Get the key shared by cells that have identical cross sections
+  const void* getCellCrossSectionKey( const size_t cell_index ) const final override;
+
+private:
+
+  // The cell index broadened material table (null if not broadened)
+  std::vector<std::shared_ptr<const DopplerBroadenedNeutronMaterial> >
+  d_cell_index_broadened_material_table;
 };
   
 } // end MonteCarlo namespace
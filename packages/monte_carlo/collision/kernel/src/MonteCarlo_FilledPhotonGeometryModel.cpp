@@ -39,9 +39,13 @@ double FilledPhotonGeometryModel::getMacroscopicReactionCrossSection(
                                 const PhotonState& photon,
                                 const PhotonuclearReactionType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSection( photon.getCell(),
-                                                   photon.getEnergy(),
-                                                   reaction );
+  if( this->isCellVoid( photon ) )
+    return 0.0;
+  else
+  {
+    return this->getMaterial( photon )->getMacroscopicReactionCrossSection(
+                                                 photon.getEnergy(), reaction );
+  }
 }
 
 // Get the macroscopic cross section for a specific reaction
@@ -67,9 +71,11 @@ double FilledPhotonGeometryModel::getMacroscopicReactionCrossSectionQuick(
                                 const PhotonState& photon,
                                 const PhotonuclearReactionType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSectionQuick( photon.getCell(),
-                                                        photon.getEnergy(),
-                                                        reaction );
+  // Make sure that the cell is not void
+  testPrecondition( !this->isCellVoid( photon ) );
+
+  return this->getMaterial( photon )->getMacroscopicReactionCrossSection(
+                                                 photon.getEnergy(), reaction );
 }
 
 // Get the macroscopic cross section for a specific reaction
@@ -2,7 +2,7 @@
 //!
 //! \file   MonteCarlo_NeutronCollisionKernel.cpp
 //! \author Alex Robinson
-//! \brief  Neutron collision kernel class explicit template instantiation
+//! \brief  Neutron collision kernel class definition
 //!
 //---------------------------------------------------------------------------//
 
@@ -11,6 +11,44 @@
 
 namespace MonteCarlo{
 
+// Collide with the material in a cell (analogue)
+/*! \details If the cell has a temperature assigned the broadened material
+ * will be collided with.
+ */
+template<>
+void StandardParticleCollisionKernel<FilledNeutronGeometryModel>::collideWithCellMaterialAnalogue(
+                                                   ParticleStateType& particle,
+                                                   ParticleBank& bank ) const
+{
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+    broadened_material = d_filled_geometry_model->getBroadenedMaterialAtIndex(
+                                                     particle.getCellIndex() );
+
+  if( broadened_material )
+    broadened_material->collideAnalogue( particle, bank );
+  else
+    this->getCellMaterial( particle ).collideAnalogue( particle, bank );
+}
+
+// Collide with the material in a cell (survival bias)
+/*! \details If the cell has a temperature assigned the broadened material
+ * will be collided with.
+ */
+template<>
+void StandardParticleCollisionKernel<FilledNeutronGeometryModel>::collideWithCellMaterialSurvivalBias(
+                                                   ParticleStateType& particle,
+                                                   ParticleBank& bank ) const
+{
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+    broadened_material = d_filled_geometry_model->getBroadenedMaterialAtIndex(
+                                                     particle.getCellIndex() );
+
+  if( broadened_material )
+    broadened_material->collideSurvivalBias( particle, bank );
+  else
+    this->getCellMaterial( particle ).collideSurvivalBias( particle, bank );
+}
+
 EXPLICIT_TEMPLATE_CLASS_INST( StandardParticleCollisionKernel<FilledNeutronGeometryModel> );
   
 } // end MonteCarlo namespace
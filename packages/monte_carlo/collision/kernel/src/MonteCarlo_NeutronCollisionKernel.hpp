@@ -19,6 +19,18 @@ namespace MonteCarlo{
 //! The neutron collision kernel
 typedef StandardParticleCollisionKernel<FilledNeutronGeometryModel> NeutronCollisionKernel;
 
+//! Collide with the material in a cell (analogue)
+template<>
+void StandardParticleCollisionKernel<FilledNeutronGeometryModel>::collideWithCellMaterialAnalogue(
+                                                   ParticleStateType& particle,
+                                                   ParticleBank& bank ) const;
+
+//! Collide with the material in a cell (survival bias)
+template<>
+void StandardParticleCollisionKernel<FilledNeutronGeometryModel>::collideWithCellMaterialSurvivalBias(
+                                                   ParticleStateType& particle,
+                                                   ParticleBank& bank ) const;
+
 EXTERN_EXPLICIT_TEMPLATE_CLASS_INST( StandardParticleCollisionKernel<FilledNeutronGeometryModel> );
   
 } // end MonteCarlo namespace
@@ -43,21 +43,15 @@ public:
   { /* ... */ }
 
   //! Get the total forward macroscopic cross section of a material
-  double getMacroscopicTotalForwardCrossSection(
-                                const Geometry::Model::EntityId cell,
+  double getMacroscopicTotalForwardCrossSectionAtIndex(
+                                const size_t cell_index,
                                 const double energy ) const final override;
 
   //! Get the total forward macroscopic cross section of a material
-  double getMacroscopicTotalForwardCrossSectionQuick(
-                                const Geometry::Model::EntityId cell,
+  double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
                                 const double energy ) const final override;
 
-  //! Get the total forward macroscopic cross section of a material
-  using BaseType::getMacroscopicTotalForwardCrossSection;
-
-  //! Get the total forward macroscopic cross section of a material
-  using BaseType::getMacroscopicTotalForwardCrossSectionQuick;
-
   //! Get the adjoint weight factor
   double getAdjointWeightFactor( const ParticleStateType& particle ) const;
 
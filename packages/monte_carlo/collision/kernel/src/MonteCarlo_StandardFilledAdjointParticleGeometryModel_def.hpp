@@ -19,14 +19,14 @@ namespace MonteCarlo{
 
 // Get the total forward macroscopic cross section of a material
 template<typename Material>
-double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSection(
-                                const Geometry::Model::EntityId cell,
+double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionAtIndex(
+                                const size_t cell_index,
                                 const double energy ) const
 {
-  if( this->isCellVoid( cell ) )
+  if( this->isCellVoidAtIndex( cell_index ) )
     return 0.0;
   else
-    return this->getMaterial( cell )->getMacroscopicTotalForwardCrossSection( energy );
+    return this->getMaterialAtIndex( cell_index )->getMacroscopicTotalForwardCrossSection( energy );
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -34,22 +34,28 @@ double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotal
  * is void. Calling this method with a void cell is not allowed.
  */
 template<typename Material>
-double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuick(
-                                const Geometry::Model::EntityId cell,
+double StandardFilledAdjointParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
                                 const double energy ) const
 {
   // Make sure that the cell is not void
-  testPrecondition( !this->isCellVoid( cell ) );
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
 
-  return this->getMaterial( cell )->getMacroscopicTotalForwardCrossSection( energy );
+  return this->getMaterialAtIndex( cell_index )->getMacroscopicTotalForwardCrossSection( energy );
 }
 
 // Get the adjoint weight factor
 template<typename Material>
 double StandardFilledAdjointParticleGeometryModel<Material>::getAdjointWeightFactor( const ParticleStateType& particle ) const
 {
-  return this->getAdjointWeightFactor( particle.getCell(),
-                                       particle.getEnergy() );
+  // We don't want to modify the particle weight if the cell is void
+  if( this->isCellVoid( particle ) )
+    return 1.0;
+  else
+  {
+    return this->getMaterial( particle )->getAdjointWeightFactor(
+                                                        particle.getEnergy() );
+  }
 }
 
 // Get the adjoint weight factor
@@ -72,8 +78,11 @@ double StandardFilledAdjointParticleGeometryModel<Material>::getAdjointWeightFac
 template<typename Material>
 double StandardFilledAdjointParticleGeometryModel<Material>::getAdjointWeightFactorQuick( const ParticleStateType& particle ) const
 {
-  return this->getAdjointWeightFactorQuick( particle.getCell(),
-                                            particle.getEnergy() );
+  // Make sure that the cell is not void
+  testPrecondition( !this->isCellVoid( particle ) );
+
+  return this->getMaterial( particle )->getAdjointWeightFactor(
+                                                        particle.getEnergy() );
 }
 
 // Get the adjoint weight factor
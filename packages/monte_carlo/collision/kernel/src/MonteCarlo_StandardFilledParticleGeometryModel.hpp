@@ -54,13 +54,33 @@ public:
   //! Check if a cell is void
   bool isCellVoid( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell containing the particle is void
+  bool isCellVoid( const ParticleStateType& particle ) const;
+
+  //! Check if the cell with the dense index is void
+  bool isCellVoidAtIndex( const size_t cell_index ) const;
+
   //! Check if a cell is a termination cell
   bool isTerminationCell( const Geometry::Model::EntityId cell ) const;
 
+  //! Check if the cell with the dense index is a termination cell
+  bool isTerminationCellAtIndex( const size_t cell_index ) const;
+
+  //! Return the number of termination cells
+  size_t getNumberOfTerminationCells() const;
+
   //! Get the material contained in a cell
   const std::shared_ptr<const MaterialType>&
   getMaterial( const Geometry::Model::EntityId cell ) const;
 
+  //! Get the material contained in the cell containing the particle
+  const std::shared_ptr<const MaterialType>&
+  getMaterial( const ParticleStateType& particle ) const;
+
+  //! Get the material contained in the cell with the dense index
+  const std::shared_ptr<const MaterialType>&
+  getMaterialAtIndex( const size_t cell_index ) const;
+
   //! Destructor
   virtual ~StandardFilledParticleGeometryModel()
   { /* ... */ }
@@ -83,24 +103,39 @@ public:
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total macroscopic cross section of a material
+  virtual double getMacroscopicTotalCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const;
+
   //! Get the total forward macroscopic cross section of a material
   double getMacroscopicTotalForwardCrossSection(
                                      const ParticleStateType& particle ) const;
 
   //! Get the total forward macroscopic cross section of a material
-  virtual double getMacroscopicTotalForwardCrossSection(
+  double getMacroscopicTotalForwardCrossSection(
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of a material
+  virtual double getMacroscopicTotalForwardCrossSectionAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const;
+
   //! Get the total forward macroscopic cross section of a material
   double getMacroscopicTotalForwardCrossSectionQuick(
                                      const ParticleStateType& particle ) const;
 
   //! Get the total forward macroscopic cross section of a material
-  virtual double getMacroscopicTotalForwardCrossSectionQuick(
+  double getMacroscopicTotalForwardCrossSectionQuick(
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const;
 
+  //! Get the total forward macroscopic cross section of a material
+  virtual double getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const;
+
   //! Get the macroscopic reaction cross section for a specific reaction
   double getMacroscopicReactionCrossSection(
                                        const ParticleStateType& particle,
@@ -123,6 +158,12 @@ public:
                                 const double energy,
                                 const ReactionEnumType reaction ) const;
 
+  //! Check if a macroscopic majorant cross section has been constructed
+  bool hasMacroscopicMajorantCrossSection() const;
+
+  //! Get the macroscopic majorant cross section (max over all materials)
+  double getMacroscopicMajorantCrossSection( const double energy ) const;
+
   //! Get the unfilled model
   const Geometry::Model& getUnfilledModel() const;
   
@@ -168,6 +209,12 @@ protected:
   virtual void processLoadedScatteringCenters(
                    const ScatteringCenterNameMap& scattering_centers );
 
+  //! Process the filled model
+  virtual void processFilledModel();
+
+  //! Get the key shared by cells that have identical cross sections
+  virtual const void* getCellCrossSectionKey( const size_t cell_index ) const;
+
 private:
 
   // Add a material to the collision kernel
@@ -175,6 +222,19 @@ private:
                     const std::vector<Geometry::Model::EntityId>&
                     cells_containing_material );
 
+  // Construct the dense cell index tables
+  void constructCellIndexTables();
+
+  // Get the dense index of a cell (invalid if the cell does not exist)
+  size_t getCellIndex( const Geometry::Model::EntityId cell ) const;
+
+  // Construct the macroscopic majorant cross section
+  void constructMacroscopicMajorantCrossSection( const double min_energy,
+                                                 const double max_energy );
+
+  // The number of majorant cross section energy bins
+  static const size_t s_majorant_energy_bins;
+
   // The unfilled model
   std::shared_ptr<const Geometry::Model> d_unfilled_model;
 
@@ -187,11 +247,20 @@ private:
   
   MaterialNameMap d_material_name_map;
 
-  // The cell id material map
-  typedef std::unordered_map<Geometry::Model::EntityId,std::shared_ptr<const MaterialType> >
-  CellIdMaterialMap;
+  // The cell index material table (null for void cells)
+  std::vector<std::shared_ptr<const MaterialType> > d_cell_index_material_table;
+
+  // The cell index termination table
+  std::vector<unsigned char> d_cell_index_termination_table;
+
+  // The log of the min majorant cross section energy
+  double d_majorant_log_min_energy;
+
+  // The majorant cross section log energy bin width
+  double d_majorant_log_energy_bin_width;
 
-  CellIdMaterialMap d_cell_id_material_map;  
+  // The majorant cross section (one value per log energy bin)
+  std::vector<double> d_majorant_cross_section;
 };
   
 } // end MonteCarlo namespace
@@ -9,7 +9,13 @@
 #ifndef MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 #define MONTE_CARLO_STANDARD_FILLED_PARTICLE_GEOMETRY_MODEL_DEF_HPP
 
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
 // FRENSIE Includes
+#include "MonteCarlo_NodeSharedReactionData.hpp"
 #include "Utility_ToStringTraits.hpp"
 #include "Utility_ExceptionCatchMacros.hpp"
 #include "Utility_ExceptionTestMacros.hpp"
@@ -17,9 +23,16 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+template<typename Material>
+const size_t StandardFilledParticleGeometryModel<Material>::s_majorant_energy_bins = 1000;
+
 // Default constructor
 template<typename Material>
 StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryModel()
+  : d_majorant_log_min_energy( 0.0 ),
+    d_majorant_log_energy_bin_width( 0.0 ),
+    d_majorant_cross_section()
 { /* ... */ }
 
 // Constructor
@@ -29,10 +42,16 @@ StandardFilledParticleGeometryModel<Material>::StandardFilledParticleGeometryMod
   : d_unfilled_model( unfilled_model ),
     d_scattering_center_name_map(),
     d_material_name_map(),
-    d_cell_id_material_map()
+    d_cell_index_material_table(),
+    d_cell_index_termination_table(),
+    d_majorant_log_min_energy( 0.0 ),
+    d_majorant_log_energy_bin_width( 0.0 ),
+    d_majorant_cross_section()
 {
   // Make sure that the unfilled model is valid
   testPrecondition( unfilled_model.get() );
+
+  this->constructCellIndexTables();
 }
 
 // Set the unfilled model
@@ -42,8 +61,63 @@ void StandardFilledParticleGeometryModel<Material>::setUnfilledModel(
 {
   // Make sure that the unfilled model is valid
   testPrecondition( unfilled_model.get() );
-  
-  d_unfilled_model = unfilled_model;
+
+  // The cell index tables only need to be reconstructed for a new model
+  if( unfilled_model != d_unfilled_model )
+  {
+    d_unfilled_model = unfilled_model;
+
+    this->constructCellIndexTables();
+  }
+}
+
+// Construct the dense cell index tables
+/*! \details The material and termination status of every cell are stored
+ * in flat arrays that are addressed by the dense cell index reported by the
+ * unfilled model (and its navigators). This avoids a map lookup on the cell
+ * id each time that these properties are queried during transport.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::constructCellIndexTables()
+{
+  const size_t number_of_cell_indices =
+    d_unfilled_model->getNumberOfCellIndices();
+
+  d_cell_index_material_table.clear();
+  d_cell_index_material_table.resize( number_of_cell_indices );
+
+  d_cell_index_termination_table.clear();
+  d_cell_index_termination_table.resize( number_of_cell_indices, 0 );
+
+  Geometry::Model::CellIdSet cells;
+
+  d_unfilled_model->getCells( cells, true, true );
+
+  Geometry::Model::CellIdSet::const_iterator cell_it = cells.begin();
+
+  while( cell_it != cells.end() )
+  {
+    if( d_unfilled_model->isTerminationCell( *cell_it ) )
+    {
+      d_cell_index_termination_table[d_unfilled_model->getCellIndex( *cell_it )] = 1;
+    }
+
+    ++cell_it;
+  }
+}
+
+// Get the dense index of a cell (invalid if the cell does not exist)
+/*! \details If the cell does not exist an index that is outside of the
+ * cell index tables will be returned.
+ */
+template<typename Material>
+inline size_t StandardFilledParticleGeometryModel<Material>::getCellIndex(
+                               const Geometry::Model::EntityId cell ) const
+{
+  if( d_unfilled_model->doesCellExist( cell ) )
+    return d_unfilled_model->getCellIndex( cell );
+  else
+    return std::numeric_limits<size_t>::max();
 }
 
 // Load the materials and fill the model
@@ -62,6 +136,10 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
        const Geometry::Model::CellIdDensityMap& cell_id_density_map )
 {
   try{
+    // The cross sections of the scattering centers will be shared within
+    // nodes using a single block of memory (if requested)
+    NodeSharedReactionData::CrossSectionArena cross_section_arena;
+
     this->loadScatteringCenters( database_path,
                                  unique_scattering_center_names,
                                  scattering_center_definitions,
@@ -69,6 +147,8 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
                                  properties,
                                  verbose_material_construction,
                                  d_scattering_center_name_map );
+
+    cross_section_arena.share();
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Could not load the requested scattering "
@@ -79,6 +159,10 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
 
   // Create each material
   std::unordered_map<std::string,std::vector<Geometry::Model::EntityId> > material_name_cell_ids_map;
+
+  // The memory that remains for the material unionized energy grids
+  uint64_t remaining_unionized_grid_memory =
+    properties.getMaterialUnionizedGridMemoryBudget();
   
   Geometry::Model::CellIdMatIdMap::const_iterator
     cell_id_mat_id_it = cell_id_mat_id_map.begin();
@@ -125,11 +209,24 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
           Utility::get<1>( material_definition[i] );
       }
 
-      new_material.reset( new MaterialType( material_id,
-                                            density,
-                                            d_scattering_center_name_map,
-                                            scattering_center_fractions,
-                                            scattering_center_names ) );
+      std::shared_ptr<MaterialType> material(
+                             new MaterialType( material_id,
+                                               density,
+                                               d_scattering_center_name_map,
+                                               scattering_center_fractions,
+                                               scattering_center_names ) );
+
+      // Construct the unionized energy grid if it fits in the memory budget
+      if( remaining_unionized_grid_memory > 0 )
+      {
+        remaining_unionized_grid_memory -=
+          material->constructUnionizedEnergyGrid(
+             properties.template getMinParticleEnergy<ParticleStateType>(),
+             properties.template getMaxParticleEnergy<ParticleStateType>(),
+             remaining_unionized_grid_memory );
+      }
+
+      new_material = material;
     }
 
     material_name_cell_ids_map[material_name].push_back( cell_id );
@@ -148,6 +245,151 @@ void StandardFilledParticleGeometryModel<Material>::loadMaterialsAndFillModel(
     
     ++material_name_it;
   }
+
+  // Process the filled model
+  this->processFilledModel();
+
+  // Construct the majorant cross section used by delta tracking
+  if( properties.getTrackingMethod() == DELTA_TRACKING &&
+      !d_material_name_map.empty() )
+  {
+    this->constructMacroscopicMajorantCrossSection(
+       properties.template getMinParticleEnergy<ParticleStateType>(),
+       properties.template getMaxParticleEnergy<ParticleStateType>() );
+  }
+}
+
+// Construct the macroscopic majorant cross section
+/*! \details The majorant is tabulated on a log-uniform energy grid so that
+ * the bin containing an energy can be found without a search. The value
+ * stored in each bin is the largest total forward macroscopic cross section
+ * over all materials in the model found at the bin edges and at every
+ * scattering center energy grid point in the bin (both sides of each grid
+ * point are evaluated so that discontinuities are bounded). Because the
+ * cross sections are monotonic between grid points (lin-lin or log-log
+ * interpolation), the stored value is a true upper bound of the cross
+ * sections in the bin. Cross sections that are evaluated on the fly (e.g.
+ * Doppler broadened cells) are only bounded at the same points - the delta
+ * tracking method checks for any excess at each tentative collision site.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::constructMacroscopicMajorantCrossSection(
+                                                      const double min_energy,
+                                                      const double max_energy )
+{
+  // Make sure that the energies are valid
+  testPrecondition( min_energy > 0.0 );
+  testPrecondition( min_energy < max_energy );
+
+  // Find a representative cell for each unique set of cross sections (the
+  // forward cross section can be overridden by the adjoint models, which
+  // requires a cell)
+  std::unordered_map<const void*,size_t> material_representative_cell_map;
+
+  for( size_t i = 0; i < d_cell_index_material_table.size(); ++i )
+  {
+    if( d_cell_index_material_table[i] )
+    {
+      material_representative_cell_map.emplace(
+                                       this->getCellCrossSectionKey( i ), i );
+    }
+  }
+
+  // Merge the energy grids of every material in the model
+  std::vector<double> energy_grid;
+
+  {
+    std::vector<double> material_energy_grid;
+
+    std::unordered_map<const void*,size_t>::const_iterator
+      material_it = material_representative_cell_map.begin();
+
+    while( material_it != material_representative_cell_map.end() )
+    {
+      d_cell_index_material_table[material_it->second]->mergeScatteringCenterEnergyGrids(
+                                                        min_energy,
+                                                        max_energy,
+                                                        material_energy_grid );
+
+      energy_grid.insert( energy_grid.end(),
+                          material_energy_grid.begin(),
+                          material_energy_grid.end() );
+
+      ++material_it;
+    }
+
+    std::sort( energy_grid.begin(), energy_grid.end() );
+
+    energy_grid.erase( std::unique( energy_grid.begin(), energy_grid.end() ),
+                       energy_grid.end() );
+  }
+
+  d_majorant_log_min_energy = std::log( min_energy );
+  d_majorant_log_energy_bin_width =
+    (std::log( max_energy ) - d_majorant_log_min_energy)/
+    s_majorant_energy_bins;
+
+  d_majorant_cross_section.clear();
+  d_majorant_cross_section.resize( s_majorant_energy_bins, 0.0 );
+
+  std::vector<double>::const_iterator energy_grid_it = energy_grid.begin();
+
+  std::vector<double> bin_energies;
+
+  for( size_t i = 0; i < s_majorant_energy_bins; ++i )
+  {
+    const double lower_bin_energy =
+      std::max( std::exp( d_majorant_log_min_energy +
+                          i*d_majorant_log_energy_bin_width ),
+                min_energy );
+
+    const double upper_bin_energy = (i+1 == s_majorant_energy_bins ?
+                                     max_energy :
+                                     std::min( std::exp( d_majorant_log_min_energy +
+                                                         (i+1)*d_majorant_log_energy_bin_width ),
+                                               max_energy ) );
+
+    bin_energies.assign( {lower_bin_energy, upper_bin_energy} );
+
+    // Skip the grid points below the bin (a grid point on a bin edge is
+    // shared by both bins)
+    while( energy_grid_it != energy_grid.end() &&
+           *energy_grid_it < lower_bin_energy )
+      ++energy_grid_it;
+
+    std::vector<double>::const_iterator bin_energy_grid_it = energy_grid_it;
+
+    while( bin_energy_grid_it != energy_grid.end() &&
+           *bin_energy_grid_it <= upper_bin_energy )
+    {
+      bin_energies.push_back( *bin_energy_grid_it );
+      
+      bin_energies.push_back( std::max( std::nextafter( *bin_energy_grid_it, 0.0 ),
+                                        lower_bin_energy ) );
+
+      bin_energies.push_back( std::min( std::nextafter( *bin_energy_grid_it, max_energy ),
+                                        upper_bin_energy ) );
+      
+      ++bin_energy_grid_it;
+    }
+
+    std::unordered_map<const void*,size_t>::const_iterator
+      material_it = material_representative_cell_map.begin();
+
+    while( material_it != material_representative_cell_map.end() )
+    {
+      for( size_t j = 0; j < bin_energies.size(); ++j )
+      {
+        d_majorant_cross_section[i] =
+          std::max( d_majorant_cross_section[i],
+                    this->getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                           material_it->second,
+                                                           bin_energies[j] ) );
+      }
+      
+      ++material_it;
+    }
+  }
 }
 
 // Add a material to the collision kernel
@@ -164,14 +406,20 @@ void StandardFilledParticleGeometryModel<Material>::addMaterial(
 
   for( size_t i = 0; i < cells_containing_material.size(); ++i )
   {
-    TEST_FOR_EXCEPTION(
-                 d_cell_id_material_map.find( cells_containing_material[i] ) !=
-                 d_cell_id_material_map.end(),
-                 std::logic_error,
-                 "cell " << cells_containing_material[i] <<
-                 " already has a material assigned!" );
-
-    d_cell_id_material_map[cells_containing_material[i]] = material;
+    const size_t cell_index =
+      this->getCellIndex( cells_containing_material[i] );
+
+    TEST_FOR_EXCEPTION( cell_index >= d_cell_index_material_table.size(),
+                        std::logic_error,
+                        "cell " << cells_containing_material[i] <<
+                        " does not exist!" );
+
+    TEST_FOR_EXCEPTION( d_cell_index_material_table[cell_index].get(),
+                        std::logic_error,
+                        "cell " << cells_containing_material[i] <<
+                        " already has a material assigned!" );
+
+    d_cell_index_material_table[cell_index] = material;
   }
 }
 
@@ -188,7 +436,31 @@ auto StandardFilledParticleGeometryModel<Material>::getMaterial(
                       std::runtime_error,
                       "Cell " << cell << " is void!" );
   
-  return d_cell_id_material_map.find( cell )->second;
+  return d_cell_index_material_table[this->getCellIndex( cell )];
+}
+
+// Get the material contained in the cell containing the particle
+template<typename Material>
+inline auto StandardFilledParticleGeometryModel<Material>::getMaterial(
+                                     const ParticleStateType& particle ) const
+  -> const std::shared_ptr<const MaterialType>&
+{
+  return this->getMaterialAtIndex( particle.getCellIndex() );
+}
+
+// Get the material contained in the cell with the dense index
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+inline auto StandardFilledParticleGeometryModel<Material>::getMaterialAtIndex(
+                                             const size_t cell_index ) const
+  -> const std::shared_ptr<const MaterialType>&
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return d_cell_index_material_table[cell_index];
 }
 
 // Process loaded scattering centers
@@ -197,19 +469,59 @@ void StandardFilledParticleGeometryModel<Material>::processLoadedScatteringCente
                                                const ScatteringCenterNameMap& )
 { /* ... */ }
 
+// Process the filled model
+/*! \details This method is called after every cell has been filled and
+ * before the macroscopic majorant cross section is constructed.
+ */
+template<typename Material>
+void StandardFilledParticleGeometryModel<Material>::processFilledModel()
+{ /* ... */ }
+
+// Get the key shared by cells that have identical cross sections
+/*! \details By default, all cells that contain the same material have
+ * identical cross sections.
+ */
+template<typename Material>
+const void* StandardFilledParticleGeometryModel<Material>::getCellCrossSectionKey(
+                                               const size_t cell_index ) const
+{
+  return d_cell_index_material_table[cell_index].get();
+}
+
 // Check if the entire model is void
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isVoid() const
 {
-  return d_cell_id_material_map.empty();
+  return d_material_name_map.empty();
 }
 
 // Check if a cell is void
+/*! \details A cell that does not exist is considered void.
+ */
 template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isCellVoid(
                          const Geometry::Model::EntityId cell ) const
 {
-  return d_cell_id_material_map.find( cell ) == d_cell_id_material_map.end();
+  return this->isCellVoidAtIndex( this->getCellIndex( cell ) );
+}
+
+// Check if the cell containing the particle is void
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isCellVoid(
+                                     const ParticleStateType& particle ) const
+{
+  return this->isCellVoidAtIndex( particle.getCellIndex() );
+}
+
+// Check if the cell with the dense index is void
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isCellVoidAtIndex(
+                                             const size_t cell_index ) const
+{
+  if( cell_index < d_cell_index_material_table.size() )
+    return !d_cell_index_material_table[cell_index];
+  else
+    return true;
 }
 
 // Check if a cell is a termination cell
@@ -217,7 +529,27 @@ template<typename Material>
 bool StandardFilledParticleGeometryModel<Material>::isTerminationCell(
                          const Geometry::Model::EntityId cell ) const
 {
-  return d_unfilled_model->isTerminationCell( cell );
+  return this->isTerminationCellAtIndex( this->getCellIndex( cell ) );
+}
+
+// Check if the cell with the dense index is a termination cell
+template<typename Material>
+inline bool StandardFilledParticleGeometryModel<Material>::isTerminationCellAtIndex(
+                                             const size_t cell_index ) const
+{
+  if( cell_index < d_cell_index_termination_table.size() )
+    return d_cell_index_termination_table[cell_index];
+  else
+    return false;
+}
+
+// Return the number of termination cells
+template<typename Material>
+size_t StandardFilledParticleGeometryModel<Material>::getNumberOfTerminationCells() const
+{
+  return std::count( d_cell_index_termination_table.begin(),
+                     d_cell_index_termination_table.end(),
+                     1 );
 }
 
 // Get the total macroscopic cross section of a material
@@ -225,8 +557,14 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSection(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSection( particle.getCell(),
-                                                particle.getEnergy() );
+  if( this->isCellVoid( particle ) )
+    return 0.0;
+  else
+  {
+    return this->getMacroscopicTotalCrossSectionQuickAtIndex(
+                                                       particle.getCellIndex(),
+                                                       particle.getEnergy() );
+  }
 }
 
 // Get the total macroscopic cross section of a material
@@ -238,7 +576,10 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
   if( this->isCellVoid( cell ) )
     return 0.0;
   else
-    return this->getMaterial(cell)->getMacroscopicTotalCrossSection( energy );
+  {
+    return this->getMacroscopicTotalCrossSectionQuickAtIndex(
+                                         this->getCellIndex( cell ), energy );
+  }
 }
 
 // Get the total macroscopic cross section of a material
@@ -249,8 +590,12 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSectionQuick(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalCrossSectionQuick( particle.getCell(),
-                                                     particle.getEnergy() );
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoid( particle ) );
+
+  return this->getMacroscopicTotalCrossSectionQuickAtIndex(
+                                                       particle.getCellIndex(),
+                                                       particle.getEnergy() );
 }
 
 // Get the total macroscopic cross section of a material
@@ -265,7 +610,23 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
   // Make sure the cell is not void
   testPrecondition( !this->isCellVoid( cell ) );
 
-  return this->getMaterial( cell )->getMacroscopicTotalCrossSection( energy );
+  return this->getMacroscopicTotalCrossSectionQuickAtIndex(
+                                         this->getCellIndex( cell ), energy );
+}
+
+// Get the total macroscopic cross section of a material
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return this->getMaterialAtIndex( cell_index )->getMacroscopicTotalCrossSection( energy );
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -276,7 +637,8 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSection(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalForwardCrossSection( particle.getCell(),
+  return this->getMacroscopicTotalForwardCrossSectionAtIndex(
+                                                       particle.getCellIndex(),
                                                        particle.getEnergy() );
 }
 
@@ -286,10 +648,23 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
                                 const Geometry::Model::EntityId cell,
                                 const double energy ) const
 {
-  if( this->isCellVoid( cell ) )
+  return this->getMacroscopicTotalForwardCrossSectionAtIndex(
+                                         this->getCellIndex( cell ), energy );
+}
+
+// Get the total forward macroscopic cross section of a material
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const
+{
+  if( this->isCellVoidAtIndex( cell_index ) )
     return 0.0;
   else
-    return this->getMaterial(cell)->getMacroscopicTotalCrossSection( energy );
+  {
+    return this->getMacroscopicTotalCrossSectionQuickAtIndex( cell_index,
+                                                              energy );
+  }
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -302,8 +677,9 @@ template<typename Material>
 double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuick(
                                            const ParticleStateType& particle ) const
 {
-  return this->getMacroscopicTotalForwardCrossSectionQuick( particle.getCell(),
-                                                            particle.getEnergy() );
+  return this->getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                                       particle.getCellIndex(),
+                                                       particle.getEnergy() );
 }
 
 // Get the total forward macroscopic cross section of a material
@@ -317,8 +693,25 @@ inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotal
 {
   // Make sure the cell is not void
   testPrecondition( !this->isCellVoid( cell ) );
-  
-  return this->getMaterial( cell )->getMacroscopicTotalCrossSection( energy );
+
+  return this->getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                         this->getCellIndex( cell ), energy );
+}
+
+// Get the total forward macroscopic cross section of a material
+/*! \details Before calling this method you must first check if the cell
+ * is void. Calling this method with a void cell is not allowed.
+ */
+template<typename Material>
+double StandardFilledParticleGeometryModel<Material>::getMacroscopicTotalForwardCrossSectionQuickAtIndex(
+                                const size_t cell_index,
+                                const double energy ) const
+{
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoidAtIndex( cell_index ) );
+
+  return this->getMacroscopicTotalCrossSectionQuickAtIndex( cell_index,
+                                                            energy );
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
@@ -327,9 +720,13 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSection( particle.getCell(),
-                                                   particle.getEnergy(),
-                                                   reaction );
+  if( this->isCellVoid( particle ) )
+    return 0.0;
+  else
+  {
+    return this->getMaterial( particle )->getMacroscopicReactionCrossSection(
+                                               particle.getEnergy(), reaction );
+  }
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
@@ -357,9 +754,11 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                         const ParticleStateType& particle,
                                         const ReactionEnumType reaction ) const
 {
-  return this->getMacroscopicReactionCrossSectionQuick( particle.getCell(),
-                                                        particle.getEnergy(),
-                                                        reaction );
+  // Make sure the cell is not void
+  testPrecondition( !this->isCellVoid( particle ) );
+
+  return this->getMaterial( particle )->getMacroscopicReactionCrossSection(
+                                               particle.getEnergy(), reaction );
 }
 
 // Get the macroscopic reaction cross section for a specific reaction
@@ -379,6 +778,43 @@ double StandardFilledParticleGeometryModel<Material>::getMacroscopicReactionCros
                                                             energy, reaction );
 }
 
+// Check if a macroscopic majorant cross section has been constructed
+/*! \details The majorant will only be constructed when delta tracking has
+ * been requested and the model is not void.
+ */
+template<typename Material>
+bool StandardFilledParticleGeometryModel<Material>::hasMacroscopicMajorantCrossSection() const
+{
+  return !d_majorant_cross_section.empty();
+}
+
+// Get the macroscopic majorant cross section (max over all materials)
+/*! \details Energies outside of the tabulated range will be assigned the
+ * majorant of the closest energy bin. If the majorant has not been
+ * constructed, zero will be returned.
+ */
+template<typename Material>
+inline double StandardFilledParticleGeometryModel<Material>::getMacroscopicMajorantCrossSection(
+                                                   const double energy ) const
+{
+  // Make sure that the energy is valid
+  testPrecondition( energy > 0.0 );
+  
+  if( d_majorant_cross_section.empty() )
+    return 0.0;
+
+  const double bin =
+    (std::log( energy ) - d_majorant_log_min_energy)/
+    d_majorant_log_energy_bin_width;
+
+  if( bin <= 0.0 )
+    return d_majorant_cross_section.front();
+  else if( bin >= d_majorant_cross_section.size() )
+    return d_majorant_cross_section.back();
+  else
+    return d_majorant_cross_section[(size_t)bin];
+}
+
 // Get the unfilled model
 template<typename Material>
 const Geometry::Model& StandardFilledParticleGeometryModel<Material>::getUnfilledModel() const
@@ -51,9 +51,9 @@ template<typename _FilledGeometryModelType>
 auto StandardParticleCollisionKernel<_FilledGeometryModelType>::getCellMaterial( const ParticleStateType& particle ) const -> const MaterialType&
 {
   // Make sure the cell is not void
-  testPrecondition( !d_filled_geometry_model->isCellVoid( particle.getCell() ) );
+  testPrecondition( !d_filled_geometry_model->isCellVoid( particle ) );
 
-  return *d_filled_geometry_model->getMaterial( particle.getCell() );
+  return *d_filled_geometry_model->getMaterial( particle );
 }
 
 // Collide with the material in a cell
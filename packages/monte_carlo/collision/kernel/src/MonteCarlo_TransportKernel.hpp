@@ -76,11 +76,11 @@ double TransportKernel::sampleSimpleDistanceToNextCollisionSite(
   // to collision)
   double distance_to_collision = std::numeric_limits<double>::infinity();
 
-  if( !d_model->isCellVoid<ParticleStateType>( particle.getCell() ) )
+  if( !d_model->isCellVoid( particle ) )
   {
     macroscopic_total_cross_section =
-      d_model->getMacroscopicTotalForwardCrossSectionQuick<ParticleStateType>(
-                                    particle.getCell(), particle.getEnergy() );
+      d_model->getMacroscopicTotalForwardCrossSectionQuickAtIndex<ParticleStateType>(
+                               particle.getCellIndex(), particle.getEnergy() );
 
     distance_to_collision = this->sampleOpticalPathLengthToNextCollisionSite()/
       macroscopic_total_cross_section;
@@ -106,7 +106,7 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
   // transport kernel is defined in.
   testPrecondition( particle.isEmbeddedInModel( *d_model ) );
   // Make sure that the particle is still in the geometry
-  testPrecondition( !d_model->isTerminationCell( particle.getCell() ) );
+  testPrecondition( !d_model->isTerminationCell( particle ) );
 
   // Sample an optical path
   double remaining_optical_path_length =
@@ -124,10 +124,12 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
 
     double cell_total_macro_cross_section = 0.0;
 
-    if( !d_model->isCellVoid<ParticleStateType>(navigator->getCurrentCell()) )
+    const size_t cell_index = navigator->getCurrentCellIndex();
+
+    if( !d_model->isCellVoidAtIndex<ParticleStateType>( cell_index ) )
     {
       cell_total_macro_cross_section =
-        d_model->getMacroscopicTotalForwardCrossSectionQuick<ParticleStateType>( navigator->getCurrentCell(), particle.getEnergy() );
+        d_model->getMacroscopicTotalForwardCrossSectionQuickAtIndex<ParticleStateType>( cell_index, particle.getEnergy() );
     }
     // The particle is inside of an empty infinite medium
     else if( distance_to_cell_boundary == Utility::QuantityTraits<double>::inf() )
@@ -147,7 +149,7 @@ double TransportKernel::sampleDistanceToNextCollisionSite(
       // If the geometry is exited before the entire optical path has
       // been converted the distance traveled is infinite from the kernels
       // perspective.
-      if( d_model->isTerminationCell( navigator->getCurrentCell() ) )
+      if( d_model->isTerminationCellAtIndex( navigator->getCurrentCellIndex() ) )
       {
         distance_to_collision_site = std::numeric_limits<double>::infinity();
         break;
@@ -290,9 +290,28 @@ FRENSIE_UNIT_TEST( FilledGeometryModel, isCellVoid_neutron_mode )
                                                 true );
 
   FRENSIE_CHECK( !filled_model.isTerminationCell( 1 ) );
+  FRENSIE_CHECK( !filled_model.isTerminationCellAtIndex( 0 ) );
+  FRENSIE_CHECK_EQUAL( filled_model.getNumberOfTerminationCells(), 0 );
 
   FRENSIE_CHECK( !filled_model.isCellVoid( 1, MonteCarlo::NEUTRON ) );
   FRENSIE_CHECK( !filled_model.isCellVoid<MonteCarlo::NeutronState>( 1 ) );
+  FRENSIE_CHECK( !filled_model.isCellVoidAtIndex<MonteCarlo::NeutronState>( 0 ) );
+
+  // Cells that do not exist are void
+  FRENSIE_CHECK( filled_model.isCellVoid<MonteCarlo::NeutronState>( 2 ) );
+
+  {
+    MonteCarlo::NeutronState neutron( 0 );
+    neutron.embedInModel( unfilled_model );
+
+    FRENSIE_CHECK( !filled_model.isTerminationCell( neutron ) );
+    FRENSIE_CHECK( !filled_model.isCellVoid( neutron ) );
+
+    MonteCarlo::PhotonState photon( 0 );
+    photon.embedInModel( unfilled_model );
+
+    FRENSIE_CHECK( filled_model.isCellVoid( photon ) );
+  }
 
   FRENSIE_CHECK( filled_model.isCellVoid( 1, MonteCarlo::PHOTON ) );
   FRENSIE_CHECK( filled_model.isCellVoid<MonteCarlo::PhotonState>( 1 ) );
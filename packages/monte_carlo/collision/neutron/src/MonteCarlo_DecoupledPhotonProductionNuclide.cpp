@@ -94,6 +94,40 @@ void DecoupledPhotonProductionNuclide::collideSurvivalBias(
   Nuclide::collideSurvivalBias( neutron, bank );
 }
 
+// Collide with a neutron using the total and absorption cross sections
+void DecoupledPhotonProductionNuclide::collideAnalogue(
+                                 NeutronState& neutron,
+                                 ParticleBank& bank,
+                                 const double total_cross_section,
+                                 const double absorption_cross_section ) const
+{
+  // Sample photon production stochastically before the neutron's state changes
+  this->samplePhotonProductionReaction( neutron, bank );
+
+  // Call the base class implementation for the neutron
+  Nuclide::collideAnalogue( neutron,
+                            bank,
+                            total_cross_section,
+                            absorption_cross_section );
+}
+
+// Collide with a neutron and survival bias using the total and absorption cross sections
+void DecoupledPhotonProductionNuclide::collideSurvivalBias(
+                                 NeutronState& neutron,
+                                 ParticleBank& bank,
+                                 const double total_cross_section,
+                                 const double absorption_cross_section ) const
+{
+  // Sample photon production stochastically before the neutron's state changes
+  this->samplePhotonProductionReaction( neutron, bank );
+
+  // Call the base class implementation for the neutron
+  Nuclide::collideSurvivalBias( neutron,
+                                bank,
+                                total_cross_section,
+                                absorption_cross_section );
+}
+
 // Sample a decoupled photon production reaction
 void DecoupledPhotonProductionNuclide::samplePhotonProductionReaction(
                                                    const NeutronState& neutron,
@@ -64,6 +64,19 @@ public:
   //! Collide with a neutron and survival bias
   void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const override;
 
+  //! Collide with a neutron using the total and absorption cross sections
+  void collideAnalogue( NeutronState& neutron,
+                        ParticleBank& bank,
+                        const double total_cross_section,
+                        const double absorption_cross_section ) const override;
+
+  //! Collide with a neutron and survival bias using the total and absorption cross sections
+  void collideSurvivalBias(
+                        NeutronState& neutron,
+                        ParticleBank& bank,
+                        const double total_cross_section,
+                        const double absorption_cross_section ) const override;
+
   // Get total photon production cross section
   double getTotalPhotonProductionCrossSection( const double energy ) const;
 
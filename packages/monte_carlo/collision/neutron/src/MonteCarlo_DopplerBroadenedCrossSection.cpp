@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedCrossSection.cpp
+//! \author Alex Robinson
+//! \brief  The Doppler broadened cross section class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <cmath>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedCrossSection.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+/*! \details The contribution of target speeds that differ from the neutron
+ * speed by more than this many thermal speeds is below 1e-7.
+ */
+const double DopplerBroadenedCrossSection::s_max_reduced_speed_difference = 4.0;
+
+// Constructor
+/*! \details The broadening temperature is the difference between the
+ * desired temperature and the temperature of the tabulated cross section
+ * (both in MeV).
+ */
+DopplerBroadenedCrossSection::DopplerBroadenedCrossSection(
+              const std::shared_ptr<const std::vector<double> >& energy_grid,
+              const std::shared_ptr<const std::vector<double> >& cross_section,
+              const double atomic_weight_ratio,
+              const double broadening_temperature )
+  : d_energy_grid( energy_grid ),
+    d_cross_section( cross_section ),
+    d_atomic_weight_ratio( atomic_weight_ratio ),
+    d_broadening_temperature( broadening_temperature ),
+    d_broadened_cross_section( new std::atomic<double>[energy_grid->size()] )
+{
+  // Make sure the energy grid is valid
+  testPrecondition( energy_grid->size() > 1 );
+  // Make sure the cross section is valid
+  testPrecondition( cross_section->size() == energy_grid->size() );
+  // Make sure the atomic weight ratio is valid
+  testPrecondition( atomic_weight_ratio > 0.0 );
+  // Make sure the broadening temperature is valid
+  testPrecondition( broadening_temperature >= 0.0 );
+
+  for( size_t i = 0; i < energy_grid->size(); ++i )
+    d_broadened_cross_section[i].store( -1.0, std::memory_order_relaxed );
+}
+
+// Return the broadening temperature (MeV)
+double DopplerBroadenedCrossSection::getBroadeningTemperature() const
+{
+  return d_broadening_temperature;
+}
+
+// Return the broadened cross section at the desired energy
+/*! \details The broadened cross section is linearly interpolated between
+ * the bounding energy grid points.
+ */
+double DopplerBroadenedCrossSection::getCrossSection(
+                                             const double energy,
+                                             const size_t bin_index ) const
+{
+  // Make sure the bin index is valid
+  testPrecondition( bin_index < d_energy_grid->size() - 1 );
+
+  const double lower_energy = (*d_energy_grid)[bin_index];
+  const double upper_energy = (*d_energy_grid)[bin_index+1];
+
+  const double lower_cross_section =
+    this->getCrossSectionAtGridPoint( bin_index );
+
+  if( upper_energy == lower_energy )
+    return lower_cross_section;
+
+  const double upper_cross_section =
+    this->getCrossSectionAtGridPoint( bin_index+1 );
+
+  return lower_cross_section + (energy - lower_energy)/
+    (upper_energy - lower_energy)*(upper_cross_section - lower_cross_section);
+}
+
+// Return the broadened cross section at an energy grid point
+/*! \details If multiple threads request the same grid point before it has
+ * been cached, each thread will calculate (and store) the same value.
+ */
+double DopplerBroadenedCrossSection::getCrossSectionAtGridPoint(
+                                               const size_t grid_index ) const
+{
+  // Make sure the grid index is valid
+  testPrecondition( grid_index < d_energy_grid->size() );
+
+  double cross_section =
+    d_broadened_cross_section[grid_index].load( std::memory_order_relaxed );
+
+  if( cross_section < 0.0 )
+  {
+    if( d_broadening_temperature > 0.0 )
+    {
+      cross_section = DopplerBroadenedCrossSection::broaden(
+                                                 *d_energy_grid,
+                                                 *d_cross_section,
+                                                 d_atomic_weight_ratio,
+                                                 d_broadening_temperature,
+                                                 (*d_energy_grid)[grid_index] );
+    }
+    else
+      cross_section = (*d_cross_section)[grid_index];
+
+    d_broadened_cross_section[grid_index].store( cross_section,
+                                                 std::memory_order_relaxed );
+  }
+
+  return cross_section;
+}
+
+// Broaden a lin-lin tabulated cross section at the desired energy
+/*! \details The free gas broadened cross section is
+ * \f[
+ * \bar{\sigma}(y) = \frac{1}{\sqrt{\pi}y^2}\int_0^\infty x^2\sigma(x)
+ * \left[e^{-(x-y)^2}-e^{-(x+y)^2}\right]dx
+ * \f]
+ * where \f$x^2 = \alpha E'\f$, \f$y^2 = \alpha E\f$ and
+ * \f$\alpha = A/kT\f$. Since the cross section is linear in energy in each
+ * bin, it is quadratic in x, which allows the integral over each bin to be
+ * evaluated exactly. Only the bins within a few thermal speeds of the
+ * neutron speed are considered. Below the first energy grid point the
+ * cross section is extrapolated assuming 1/v behavior
+ * (\f$\sigma(x) = \sigma_0 x_0/x\f$), which is also integrated exactly.
+ */
+double DopplerBroadenedCrossSection::broaden(
+                                    const std::vector<double>& energy_grid,
+                                    const std::vector<double>& cross_section,
+                                    const double atomic_weight_ratio,
+                                    const double broadening_temperature,
+                                    const double energy )
+{
+  // Make sure the grid is valid
+  testPrecondition( energy_grid.size() == cross_section.size() );
+  // Make sure the energy is valid
+  testPrecondition( energy > 0.0 );
+
+  if( broadening_temperature <= 0.0 || energy_grid.size() < 2 )
+    return 0.0;
+
+  const double alpha = atomic_weight_ratio/broadening_temperature;
+  const double y = std::sqrt( alpha*energy );
+
+  const double lower_x =
+    std::max( y - s_max_reduced_speed_difference, 0.0 );
+  const double upper_x = y + s_max_reduced_speed_difference;
+
+  const double lower_energy = lower_x*lower_x/alpha;
+  const double upper_energy = upper_x*upper_x/alpha;
+
+  // Find the first bin that overlaps the integration range
+  size_t bin_index = std::upper_bound( energy_grid.begin(),
+                                       energy_grid.end(),
+                                       lower_energy ) - energy_grid.begin();
+
+  if( bin_index > 0 )
+    --bin_index;
+
+  double integral = 0.0;
+
+  // Extrapolate the cross section below the energy grid (1/v)
+  if( lower_energy < energy_grid.front() )
+  {
+    const double min_x = std::sqrt( alpha*energy_grid.front() );
+
+    const double coeffs[5] = {0.0, cross_section.front()*min_x, 0.0, 0.0, 0.0};
+
+    integral += DopplerBroadenedCrossSection::integrateSegment( lower_x,
+                                                                min_x,
+                                                                y,
+                                                                coeffs );
+  }
+
+  while( bin_index < energy_grid.size() - 1 &&
+         energy_grid[bin_index] < upper_energy )
+  {
+    const double bin_lower_energy = energy_grid[bin_index];
+    const double bin_upper_energy = energy_grid[bin_index+1];
+
+    if( bin_upper_energy > bin_lower_energy )
+    {
+      const double slope =
+        (cross_section[bin_index+1] - cross_section[bin_index])/
+        (bin_upper_energy - bin_lower_energy);
+
+      // x^2*sigma(x) = c_0*x^2 + c_2*x^4
+      const double coeffs[5] =
+        {0.0, 0.0, cross_section[bin_index] - slope*bin_lower_energy,
+         0.0, slope/alpha};
+
+      integral += DopplerBroadenedCrossSection::integrateSegment(
+                                         std::sqrt( alpha*bin_lower_energy ),
+                                         std::sqrt( alpha*bin_upper_energy ),
+                                         y,
+                                         coeffs );
+    }
+
+    ++bin_index;
+  }
+
+  return std::max( integral/(std::sqrt( Utility::PhysicalConstants::pi )*y*y),
+                   0.0 );
+}
+
+// Calculate the integral of t^n*exp(-t^2) from a to infinity (n=0,...,4)
+void DopplerBroadenedCrossSection::calculateIncompleteGaussianMoments(
+                                                             const double a,
+                                                             double moments[5] )
+{
+  const double exp_term = std::exp( -a*a );
+
+  moments[0] = 0.5*std::sqrt( Utility::PhysicalConstants::pi )*std::erfc( a );
+  moments[1] = 0.5*exp_term;
+  moments[2] = 0.5*moments[0] + 0.5*a*exp_term;
+  moments[3] = moments[1] + 0.5*a*a*exp_term;
+  moments[4] = 1.5*moments[2] + 0.5*a*a*a*exp_term;
+}
+
+// Integrate the broadening kernel over a cross section segment
+/*! \details The product of the cross section and \f$x^2\f$ in the segment
+ * must be a polynomial in x of at most fourth order:
+ * \f$x^2\sigma(x) = \sum_{k=0}^{4} c_k x^k\f$ (e.g. \f$c_2\f$ and
+ * \f$c_4\f$ are nonzero for a lin-lin segment and \f$c_1\f$ is nonzero
+ * for a 1/v segment). With the substitution \f$x = t + s\f$ the integrand
+ * becomes a polynomial in t times \f$e^{-t^2}\f$, where \f$s = y\f$ for
+ * the first term of the kernel and \f$s = -y\f$ for the second term.
+ */
+double DopplerBroadenedCrossSection::integrateSegment(
+                                                const double lower_x,
+                                                const double upper_x,
+                                                const double y,
+                                                const double coeffs[5] )
+{
+  // The binomial coefficients
+  static const double binomial_coeffs[5][5] = {{1.0, 0.0, 0.0, 0.0, 0.0},
+                                               {1.0, 1.0, 0.0, 0.0, 0.0},
+                                               {1.0, 2.0, 1.0, 0.0, 0.0},
+                                               {1.0, 3.0, 3.0, 1.0, 0.0},
+                                               {1.0, 4.0, 6.0, 4.0, 1.0}};
+
+  double integral = 0.0;
+
+  for( int term = 0; term < 2; ++term )
+  {
+    const double s = (term == 0 ? y : -y);
+
+    // Restrict the segment to the range that contributes to the integral
+    const double term_lower_x =
+      std::max( lower_x, s - s_max_reduced_speed_difference );
+    const double term_upper_x =
+      std::min( upper_x, s + s_max_reduced_speed_difference );
+
+    if( term_upper_x <= term_lower_x )
+      continue;
+
+    double lower_moments[5], upper_moments[5];
+
+    DopplerBroadenedCrossSection::calculateIncompleteGaussianMoments(
+                                             term_lower_x - s, lower_moments );
+    DopplerBroadenedCrossSection::calculateIncompleteGaussianMoments(
+                                             term_upper_x - s, upper_moments );
+
+    double h[5];
+
+    for( size_t n = 0; n < 5; ++n )
+      h[n] = lower_moments[n] - upper_moments[n];
+
+    // (t+s)^k = sum_j C(k,j)*s^(k-j)*t^j
+    double term_integral = 0.0;
+
+    for( size_t k = 0; k < 5; ++k )
+    {
+      if( coeffs[k] == 0.0 )
+        continue;
+
+      double expanded_integral = 0.0;
+      double s_power = 1.0;
+
+      for( size_t j = k+1; j > 0; --j )
+      {
+        expanded_integral += binomial_coeffs[k][j-1]*s_power*h[j-1];
+
+        s_power *= s;
+      }
+
+      term_integral += coeffs[k]*expanded_integral;
+    }
+
+    integral += (term == 0 ? term_integral : -term_integral);
+  }
+
+  return integral;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedCrossSection.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,101 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedCrossSection.hpp
+//! \author Alex Robinson
+//! \brief  The Doppler broadened cross section class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DOPPLER_BROADENED_CROSS_SECTION_HPP
+#define MONTE_CARLO_DOPPLER_BROADENED_CROSS_SECTION_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <atomic>
+
+// FRENSIE Includes
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The Doppler broadened cross section class
+ * \details This class evaluates a lin-lin tabulated cross section after it
+ * has been Doppler broadened from the temperature of the tabulated data to a
+ * higher temperature. The exact free gas kernel (SIGMA1 method) is used
+ * (with a 1/v extrapolation below the first energy grid point),
+ * which allows one to broaden data that is already broadened by using the
+ * temperature difference. The broadened cross section is evaluated at the
+ * tabulated energy grid points the first time that a grid point is needed
+ * and is then cached, so that repeated lookups only cost an interpolation.
+ * The cache can be filled safely from multiple threads.
+ */
+class DopplerBroadenedCrossSection
+{
+
+public:
+
+  //! Constructor
+  DopplerBroadenedCrossSection(
+              const std::shared_ptr<const std::vector<double> >& energy_grid,
+              const std::shared_ptr<const std::vector<double> >& cross_section,
+              const double atomic_weight_ratio,
+              const double broadening_temperature );
+
+  //! Destructor
+  ~DopplerBroadenedCrossSection()
+  { /* ... */ }
+
+  //! Return the broadening temperature (MeV)
+  double getBroadeningTemperature() const;
+
+  //! Return the broadened cross section at the desired energy
+  double getCrossSection( const double energy, const size_t bin_index ) const;
+
+  //! Return the broadened cross section at an energy grid point
+  double getCrossSectionAtGridPoint( const size_t grid_index ) const;
+
+  //! Broaden a lin-lin tabulated cross section at the desired energy
+  static double broaden( const std::vector<double>& energy_grid,
+                         const std::vector<double>& cross_section,
+                         const double atomic_weight_ratio,
+                         const double broadening_temperature,
+                         const double energy );
+
+private:
+
+  // Calculate the integral of t^n*exp(-t^2) from a to infinity (n=0,...,4)
+  static void calculateIncompleteGaussianMoments( const double a,
+                                                  double moments[5] );
+
+  // Integrate the broadening kernel over a cross section segment
+  static double integrateSegment( const double lower_x,
+                                  const double upper_x,
+                                  const double y,
+                                  const double coeffs[5] );
+
+  // The max reduced speed difference that contributes to the integral
+  static const double s_max_reduced_speed_difference;
+
+  // The energy grid
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+
+  // The unbroadened cross section
+  std::shared_ptr<const std::vector<double> > d_cross_section;
+
+  // The atomic weight ratio
+  double d_atomic_weight_ratio;
+
+  // The broadening temperature (MeV)
+  double d_broadening_temperature;
+
+  // The cached broadened cross section (negative values are not cached yet)
+  std::unique_ptr<std::atomic<double>[]> d_broadened_cross_section;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DOPPLER_BROADENED_CROSS_SECTION_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedCrossSection.hpp
+//---------------------------------------------------------------------------//
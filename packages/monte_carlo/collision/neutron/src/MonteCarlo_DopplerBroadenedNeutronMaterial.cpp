@@ -0,0 +1,252 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedNeutronMaterial.cpp
+//! \author Alex Robinson
+//! \brief  Doppler broadened neutron material class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedNeutronMaterial.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Initialize static member data
+/*! \details Temperatures that are below the data temperature by less than
+ * this relative amount are assumed to be equal to the data temperature
+ * (e.g. due to round-off when converting from K to MeV).
+ */
+const double DopplerBroadenedNeutronMaterial::s_temperature_tolerance = 1e-6;
+
+// Constructor
+/*! \details The temperature must be in MeV. The cross sections of each
+ * nuclide with data below the requested temperature will be broadened by
+ * the temperature difference. Data cannot be unbroadened - a warning will
+ * be logged for each nuclide with data above the requested temperature and
+ * the tabulated (data temperature) cross sections will be used.
+ */
+DopplerBroadenedNeutronMaterial::DopplerBroadenedNeutronMaterial(
+                      const std::shared_ptr<const NeutronMaterial>& material,
+                      const double temperature )
+  : d_material( material ),
+    d_temperature( temperature ),
+    d_nuclides( material->getNumberOfNuclides() )
+{
+  // Make sure the material is valid
+  testPrecondition( material.get() );
+  // Make sure the temperature is valid
+  testPrecondition( temperature >= 0.0 );
+
+  for( size_t i = 0; i < d_nuclides.size(); ++i )
+  {
+    const Nuclide& nuclide = material->getNuclide( i );
+
+    d_nuclides[i].number_density = material->getNuclideNumberDensity( i );
+    d_nuclides[i].nuclide = &nuclide;
+
+    if( temperature < nuclide.getTemperature()*(1.0 - s_temperature_tolerance) )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "DopplerBroadenedNeutronMaterial",
+                                  "The requested temperature ("
+                                  << temperature << " MeV) is below the "
+                                  "temperature of the data for nuclide "
+                                  << nuclide.getName() << " ("
+                                  << nuclide.getTemperature() << " MeV). "
+                                  "The cross sections of this nuclide will "
+                                  "not be broadened!" );
+    }
+    else if( temperature > nuclide.getTemperature() )
+    {
+      const double broadening_temperature =
+        temperature - nuclide.getTemperature();
+
+      d_nuclides[i].total_cross_section.reset(
+                new DopplerBroadenedCrossSection(
+                                   nuclide.getEnergyGrid(),
+                                   nuclide.getTotalCrossSectionOnEnergyGrid(),
+                                   nuclide.getAtomicWeightRatio(),
+                                   broadening_temperature ) );
+
+      d_nuclides[i].absorption_cross_section.reset(
+                new DopplerBroadenedCrossSection(
+                              nuclide.getEnergyGrid(),
+                              nuclide.getAbsorptionCrossSectionOnEnergyGrid(),
+                              nuclide.getAtomicWeightRatio(),
+                              broadening_temperature ) );
+    }
+  }
+}
+
+// Return the material that is broadened
+const NeutronMaterial& DopplerBroadenedNeutronMaterial::getMaterial() const
+{
+  return *d_material;
+}
+
+// Return the temperature of the material (MeV)
+double DopplerBroadenedNeutronMaterial::getTemperature() const
+{
+  return d_temperature;
+}
+
+// Return the macroscopic total cross section (1/cm)
+double DopplerBroadenedNeutronMaterial::getMacroscopicTotalCrossSection(
+                                                    const double energy ) const
+{
+  double cross_section = 0.0;
+
+  for( size_t i = 0; i < d_nuclides.size(); ++i )
+  {
+    double total_cross_section, absorption_cross_section;
+
+    DopplerBroadenedNeutronMaterial::getNuclideCrossSections(
+                                                   d_nuclides[i],
+                                                   energy,
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+
+    cross_section += d_nuclides[i].number_density*total_cross_section;
+  }
+
+  return cross_section;
+}
+
+// Return the macroscopic absorption cross section (1/cm)
+double DopplerBroadenedNeutronMaterial::getMacroscopicAbsorptionCrossSection(
+                                                    const double energy ) const
+{
+  double cross_section = 0.0;
+
+  for( size_t i = 0; i < d_nuclides.size(); ++i )
+  {
+    double total_cross_section, absorption_cross_section;
+
+    DopplerBroadenedNeutronMaterial::getNuclideCrossSections(
+                                                   d_nuclides[i],
+                                                   energy,
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+
+    cross_section += d_nuclides[i].number_density*absorption_cross_section;
+  }
+
+  return cross_section;
+}
+
+// Collide with a neutron
+void DopplerBroadenedNeutronMaterial::collideAnalogue(
+                                                   NeutronState& neutron,
+                                                   ParticleBank& bank ) const
+{
+  double total_cross_section, absorption_cross_section;
+
+  size_t nuclide_index = this->sampleCollisionNuclide(
+                                                   neutron.getEnergy(),
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+
+  d_nuclides[nuclide_index].nuclide->collideAnalogue(
+                                                   neutron,
+                                                   bank,
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+}
+
+// Collide with a neutron and survival bias
+void DopplerBroadenedNeutronMaterial::collideSurvivalBias(
+                                                   NeutronState& neutron,
+                                                   ParticleBank& bank ) const
+{
+  double total_cross_section, absorption_cross_section;
+
+  size_t nuclide_index = this->sampleCollisionNuclide(
+                                                   neutron.getEnergy(),
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+
+  d_nuclides[nuclide_index].nuclide->collideSurvivalBias(
+                                                   neutron,
+                                                   bank,
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+}
+
+// Return the total and absorption cross sections of a nuclide
+/*! \details Outside of the nuclide energy grid the tabulated cross sections
+ * will be returned.
+ */
+void DopplerBroadenedNeutronMaterial::getNuclideCrossSections(
+                                    const BroadenedNuclide& nuclide_data,
+                                    const double energy,
+                                    double& total_cross_section,
+                                    double& absorption_cross_section )
+{
+  const Nuclide& nuclide = *nuclide_data.nuclide;
+
+  if( nuclide_data.total_cross_section &&
+      nuclide.getGridSearcher()->isValueWithinGridBounds( energy ) )
+  {
+    const size_t bin_index =
+      nuclide.getGridSearcher()->findLowerBinIndexIncludingUpperBound( energy );
+
+    total_cross_section =
+      nuclide_data.total_cross_section->getCrossSection( energy, bin_index );
+
+    absorption_cross_section =
+      nuclide_data.absorption_cross_section->getCrossSection( energy,
+                                                              bin_index );
+  }
+  else
+  {
+    total_cross_section = nuclide.getTotalCrossSection( energy );
+    absorption_cross_section = nuclide.getAbsorptionCrossSection( energy );
+  }
+}
+
+// Sample the nuclide that is collided with
+/*! \details The broadened total and absorption cross sections of the
+ * sampled nuclide will also be returned.
+ */
+size_t DopplerBroadenedNeutronMaterial::sampleCollisionNuclide(
+                                    const double energy,
+                                    double& total_cross_section,
+                                    double& absorption_cross_section ) const
+{
+  const double scaled_random_number =
+    Utility::RandomNumberGenerator::getRandomNumber<double>()*
+    this->getMacroscopicTotalCrossSection( energy );
+
+  double partial_cross_section = 0.0;
+
+  size_t nuclide_index = 0;
+
+  for( ; nuclide_index < d_nuclides.size(); ++nuclide_index )
+  {
+    DopplerBroadenedNeutronMaterial::getNuclideCrossSections(
+                                                   d_nuclides[nuclide_index],
+                                                   energy,
+                                                   total_cross_section,
+                                                   absorption_cross_section );
+
+    partial_cross_section +=
+      d_nuclides[nuclide_index].number_density*total_cross_section;
+
+    if( scaled_random_number < partial_cross_section )
+      break;
+  }
+
+  // Protect against round-off when the random number is close to one
+  if( nuclide_index == d_nuclides.size() )
+    --nuclide_index;
+
+  return nuclide_index;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedNeutronMaterial.cpp
+//---------------------------------------------------------------------------//
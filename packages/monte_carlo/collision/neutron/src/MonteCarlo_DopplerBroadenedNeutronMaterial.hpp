@@ -0,0 +1,117 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_DopplerBroadenedNeutronMaterial.hpp
+//! \author Alex Robinson
+//! \brief  Doppler broadened neutron material class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_MATERIAL_HPP
+#define MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_MATERIAL_HPP
+
+// Std Lib Includes
+#include <memory>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronMaterial.hpp"
+#include "MonteCarlo_DopplerBroadenedCrossSection.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The Doppler broadened neutron material class
+ * \details This class wraps a neutron material and evaluates the total and
+ * absorption cross sections of its nuclides at a temperature that is higher
+ * than the temperature of the tabulated data. The broadening is done on the
+ * fly (see MonteCarlo::DopplerBroadenedCrossSection), which allows one to
+ * model cells at many different temperatures without generating a data file
+ * for each temperature. Nuclides with data at or above the material
+ * temperature are not modified (a warning is logged when the data
+ * temperature is above the material temperature). The scattering and absorption partial
+ * reactions are still sampled using the tabulated data.
+ */
+class DopplerBroadenedNeutronMaterial
+{
+
+public:
+
+  //! The particle state type
+  typedef NeutronMaterial::ParticleStateType ParticleStateType;
+
+  //! Constructor
+  DopplerBroadenedNeutronMaterial(
+                      const std::shared_ptr<const NeutronMaterial>& material,
+                      const double temperature );
+
+  //! Destructor
+  ~DopplerBroadenedNeutronMaterial()
+  { /* ... */ }
+
+  //! Return the material that is broadened
+  const NeutronMaterial& getMaterial() const;
+
+  //! Return the temperature of the material (MeV)
+  double getTemperature() const;
+
+  //! Return the macroscopic total cross section (1/cm)
+  double getMacroscopicTotalCrossSection( const double energy ) const;
+
+  //! Return the macroscopic absorption cross section (1/cm)
+  double getMacroscopicAbsorptionCrossSection( const double energy ) const;
+
+  //! Collide with a neutron
+  void collideAnalogue( NeutronState& neutron, ParticleBank& bank ) const;
+
+  //! Collide with a neutron and survival bias
+  void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const;
+
+private:
+
+  // The broadened nuclide data
+  struct BroadenedNuclide
+  {
+    // The number density of the nuclide (atom/b-cm)
+    double number_density;
+
+    // The nuclide
+    const Nuclide* nuclide;
+
+    // The broadened total cross section (null if not broadened)
+    std::unique_ptr<const DopplerBroadenedCrossSection> total_cross_section;
+
+    // The broadened absorption cross section (null if not broadened)
+    std::unique_ptr<const DopplerBroadenedCrossSection>
+    absorption_cross_section;
+  };
+
+  // Return the total and absorption cross sections of a nuclide
+  static void getNuclideCrossSections( const BroadenedNuclide& nuclide_data,
+                                       const double energy,
+                                       double& total_cross_section,
+                                       double& absorption_cross_section );
+
+  // Sample the nuclide that is collided with
+  size_t sampleCollisionNuclide( const double energy,
+                                 double& total_cross_section,
+                                 double& absorption_cross_section ) const;
+
+  // The relative tolerance used when comparing temperatures
+  static const double s_temperature_tolerance;
+
+  // The material that is broadened
+  std::shared_ptr<const NeutronMaterial> d_material;
+
+  // The temperature of the material (MeV)
+  double d_temperature;
+
+  // The broadened nuclides
+  std::vector<BroadenedNuclide> d_nuclides;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_DOPPLER_BROADENED_NEUTRON_MATERIAL_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_DopplerBroadenedNeutronMaterial.hpp
+//---------------------------------------------------------------------------//
@@ -17,6 +17,19 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+NeutronMaterial::MicroscopicCrossSectionEvaluationFunctor
+NeutronMaterial::s_fission_cs_evaluation_functor(
+                       std::bind<double>( &Nuclide::getFissionCrossSection,
+                                          std::placeholders::_1,
+                                          std::placeholders::_2 ) );
+
+NeutronMaterial::MicroscopicCrossSectionEvaluationFunctor
+NeutronMaterial::s_fission_neutron_production_cs_evaluation_functor(
+      std::bind<double>( &Nuclide::getFissionNeutronProductionCrossSection,
+                         std::placeholders::_1,
+                         std::placeholders::_2 ) );
+
 // Constructor
 NeutronMaterial::NeutronMaterial(
                                 const MaterialId id,
@@ -27,6 +40,59 @@ NeutronMaterial::NeutronMaterial(
   : BaseType( id, density, nuclide_name_map, nuclide_fractions, nuclide_names )
 { /* ... */ }
 
+// Return the number of nuclides in the material
+size_t NeutronMaterial::getNumberOfNuclides() const
+{
+  return this->getNumberOfScatteringCenters();
+}
+
+// Return the nuclide at the desired index
+const Nuclide& NeutronMaterial::getNuclide( const size_t index ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < this->getNumberOfNuclides() );
+
+  return this->getScatteringCenter( index );
+}
+
+// Return the number density of the nuclide at the desired index
+double NeutronMaterial::getNuclideNumberDensity( const size_t index ) const
+{
+  // Make sure the index is valid
+  testPrecondition( index < this->getNumberOfNuclides() );
+
+  return this->getScatteringCenterNumberDensity( index );
+}
+
+// Check if the material is fissionable
+bool NeutronMaterial::isFissionable() const
+{
+  for( size_t i = 0; i < this->getNumberOfScatteringCenters(); ++i )
+  {
+    if( this->getScatteringCenter( i ).isFissionable() )
+      return true;
+  }
+
+  return false;
+}
+
+// Return the macroscopic fission cross section (1/cm)
+double NeutronMaterial::getMacroscopicFissionCrossSection(
+                                                    const double energy ) const
+{
+  return this->getMacroscopicCrossSection( energy,
+                                           s_fission_cs_evaluation_functor );
+}
+
+// Return the macroscopic fission neutron production cross section (1/cm)
+double NeutronMaterial::getMacroscopicFissionNeutronProductionCrossSection(
+                                                    const double energy ) const
+{
+  return this->getMacroscopicCrossSection(
+                          energy,
+                          s_fission_neutron_production_cs_evaluation_functor );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
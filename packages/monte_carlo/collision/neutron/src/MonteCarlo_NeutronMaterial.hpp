@@ -60,6 +60,35 @@ public:
   //! Destructor
   ~NeutronMaterial()
   { /* ... */ }
+
+  //! Return the number of nuclides in the material
+  size_t getNumberOfNuclides() const;
+
+  //! Return the nuclide at the desired index
+  const Nuclide& getNuclide( const size_t index ) const;
+
+  //! Return the number density of the nuclide at the desired index
+  double getNuclideNumberDensity( const size_t index ) const;
+
+  //! Check if the material is fissionable
+  bool isFissionable() const;
+
+  //! Return the macroscopic fission cross section (1/cm)
+  double getMacroscopicFissionCrossSection( const double energy ) const;
+
+  //! Return the macroscopic fission neutron production cross section (1/cm)
+  double getMacroscopicFissionNeutronProductionCrossSection(
+                                                  const double energy ) const;
+
+private:
+
+  // The fission cross section evaluation functor
+  static MicroscopicCrossSectionEvaluationFunctor
+  s_fission_cs_evaluation_functor;
+
+  // The fission neutron production cross section evaluation functor
+  static MicroscopicCrossSectionEvaluationFunctor
+  s_fission_neutron_production_cs_evaluation_functor;
 };
 
 } // end MonteCarlo namespace
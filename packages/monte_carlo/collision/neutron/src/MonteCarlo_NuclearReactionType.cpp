@@ -444,6 +444,25 @@ NuclearReactionType convertMTNumberToNuclearReactionType(
   }
 }
 
+// Check if a reaction is a fission reaction (total or partial)
+/*! \details The raw reaction type is accepted so that the reaction tags
+ * passed to the particle banks can be checked directly.
+ */
+bool isFissionReaction( const int reaction )
+{
+  switch( reaction )
+  {
+  case N__TOTAL_FISSION_REACTION:
+  case N__FISSION_REACTION:
+  case N__N_FISSION_REACTION:
+  case N__2N_FISSION_REACTION:
+  case N__3N_FISSION_REACTION:
+    return true;
+  default:
+    return false;
+  }
+}
+
 } // end MonteCarlo namespace
 
 namespace Utility{
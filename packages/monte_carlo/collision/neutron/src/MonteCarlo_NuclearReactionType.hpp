@@ -441,6 +441,9 @@ enum NuclearReactionType{
 NuclearReactionType convertMTNumberToNuclearReactionType(
 						     const unsigned reaction );
 
+//! Check if a reaction is a fission reaction (total or partial)
+bool isFissionReaction( const int reaction );
+
 } // end MonteCarlo namespace
 
 namespace Utility{
@@ -118,6 +118,8 @@ Nuclide::Nuclide(
     d_isomer_number( isomer_number ),
     d_atomic_weight_ratio( atomic_weight_ratio ),
     d_temperature( temperature ),
+    d_energy_grid( energy_grid ),
+    d_grid_searcher( grid_searcher ),
     d_total_reaction(),
     d_total_absorption_reaction()
 {
@@ -170,6 +172,9 @@ Nuclide::Nuclide(
 
   // Calculate the total cross section
   this->calculateTotalReaction( energy_grid, grid_searcher );
+
+  // Find the fission reactions
+  this->findFissionReactions();
 }
 
 // Return the nuclide name
@@ -220,6 +225,43 @@ double Nuclide::getTemperature() const
   return d_temperature;
 }
 
+// Return the energy grid
+const std::shared_ptr<const std::vector<double> >&
+Nuclide::getEnergyGrid() const
+{
+  return d_energy_grid;
+}
+
+// Return the energy grid searcher
+const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+Nuclide::getGridSearcher() const
+{
+  return d_grid_searcher;
+}
+
+// Add the energy grid points to an array
+void Nuclide::getEnergyGridPoints(
+                           std::vector<double>& energy_grid_points ) const
+{
+  energy_grid_points.insert( energy_grid_points.end(),
+                             d_energy_grid->begin(),
+                             d_energy_grid->end() );
+}
+
+// Return the total cross section evaluated on the energy grid
+const std::shared_ptr<const std::vector<double> >&
+Nuclide::getTotalCrossSectionOnEnergyGrid() const
+{
+  return d_total_cross_section;
+}
+
+// Return the total absorption cross section evaluated on the energy grid
+const std::shared_ptr<const std::vector<double> >&
+Nuclide::getAbsorptionCrossSectionOnEnergyGrid() const
+{
+  return d_absorption_cross_section;
+}
+
 // Return the total cross section at the desired energy
 double Nuclide::getTotalCrossSection( const double energy ) const
 {
@@ -282,6 +324,41 @@ double Nuclide::getReactionCrossSection(
   }
 }
 
+// Check if the nuclide is fissionable
+bool Nuclide::isFissionable() const
+{
+  return !d_fission_reactions.empty();
+}
+
+// Return the fission cross section at the desired energy
+double Nuclide::getFissionCrossSection( const double energy ) const
+{
+  double cross_section = 0.0;
+
+  for( size_t i = 0; i < d_fission_reactions.size(); ++i )
+    cross_section += d_fission_reactions[i]->getCrossSection( energy );
+
+  return cross_section;
+}
+
+// Return the fission neutron production cross section (nu*sigma_f)
+/*! \details The average total (prompt + delayed) number of neutrons
+ * emitted per fission is used.
+ */
+double Nuclide::getFissionNeutronProductionCrossSection(
+                                                   const double energy ) const
+{
+  double cross_section = 0.0;
+
+  for( size_t i = 0; i < d_fission_reactions.size(); ++i )
+  {
+    cross_section += d_fission_reactions[i]->getCrossSection( energy )*
+      d_fission_reactions[i]->getAverageNumberOfEmittedParticles( energy );
+  }
+
+  return cross_section;
+}
+
 // Return the absorption reaction types
 void Nuclide::getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 {
@@ -340,19 +417,98 @@ void Nuclide::getReactionTypes( ReactionEnumTypeSet& reaction_types ) const
 void Nuclide::collideAnalogue( NeutronState& neutron,
 			       ParticleBank& bank ) const
 {
-  double total_cross_section =
+  const double total_cross_section =
+    d_total_reaction->getCrossSection( neutron.getEnergy() );
+
+  const double absorption_cross_section =
+    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+
+  this->collideAnalogueImpl( neutron,
+                             bank,
+                             total_cross_section,
+                             absorption_cross_section,
+                             total_cross_section,
+                             absorption_cross_section );
+}
+
+// Collide with a neutron and survival bias
+void Nuclide::collideSurvivalBias( NeutronState& neutron,
+				   ParticleBank& bank) const
+{
+  const double total_cross_section =
     d_total_reaction->getCrossSection( neutron.getEnergy() );
 
+  const double absorption_cross_section =
+    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+
+  this->collideSurvivalBiasImpl( neutron,
+                                 bank,
+                                 total_cross_section,
+                                 absorption_cross_section,
+                                 total_cross_section - absorption_cross_section );
+}
+
+// Collide with a neutron using the total and absorption cross sections
+/*! \details The total and absorption cross sections can differ from the
+ * tabulated values (e.g. when they have been Doppler broadened to a
+ * different temperature). They are used to decide if absorption or
+ * scattering occurs. The partial reaction is then sampled using the
+ * tabulated partial cross sections.
+ */
+void Nuclide::collideAnalogue( NeutronState& neutron,
+                               ParticleBank& bank,
+                               const double total_cross_section,
+                               const double absorption_cross_section ) const
+{
+  this->collideAnalogueImpl(
+         neutron,
+         bank,
+         total_cross_section,
+         absorption_cross_section,
+         d_total_reaction->getCrossSection( neutron.getEnergy() ),
+         d_total_absorption_reaction->getCrossSection( neutron.getEnergy() ) );
+}
+
+// Collide with a neutron and survival bias using the total and absorption cross sections
+void Nuclide::collideSurvivalBias( NeutronState& neutron,
+                                   ParticleBank& bank,
+                                   const double total_cross_section,
+                                   const double absorption_cross_section ) const
+{
+  this->collideSurvivalBiasImpl(
+        neutron,
+        bank,
+        total_cross_section,
+        absorption_cross_section,
+        d_total_reaction->getCrossSection( neutron.getEnergy() ) -
+        d_total_absorption_reaction->getCrossSection( neutron.getEnergy() ) );
+}
+
+// Collide with a neutron using the total, absorption and tabulated cross sections
+/*! \details The tabulated cross sections are passed in so that the
+ * unbroadened collision does not look them up a second time.
+ */
+void Nuclide::collideAnalogueImpl(
+                         NeutronState& neutron,
+                         ParticleBank& bank,
+                         const double total_cross_section,
+                         const double absorption_cross_section,
+                         const double tabulated_total_cross_section,
+                         const double tabulated_absorption_cross_section ) const
+{
   double scaled_random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>()*
     total_cross_section;
 
-  double absorption_cross_section =
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
-
   // Check if absorption occurs
   if( scaled_random_number < absorption_cross_section )
   {
+    if( tabulated_absorption_cross_section != absorption_cross_section )
+    {
+      scaled_random_number *=
+        tabulated_absorption_cross_section/absorption_cross_section;
+    }
+
     sampleAbsorptionReaction( scaled_random_number, neutron, bank );
 
     // Set the neutron as gone regardless of the reaction that occurred.
@@ -360,24 +516,37 @@ void Nuclide::collideAnalogue( NeutronState& neutron,
   }
   else
   {
-    sampleScatteringReaction( scaled_random_number - absorption_cross_section,
-			      neutron,
-			      bank );
+    scaled_random_number -= absorption_cross_section;
+
+    double scattering_cross_section =
+      total_cross_section - absorption_cross_section;
+
+    double tabulated_scattering_cross_section =
+      tabulated_total_cross_section - tabulated_absorption_cross_section;
+
+    if( tabulated_scattering_cross_section != scattering_cross_section )
+    {
+      scaled_random_number *=
+        tabulated_scattering_cross_section/scattering_cross_section;
+    }
+
+    sampleScatteringReaction( scaled_random_number, neutron, bank );
   }
 }
 
-// Collide with a neutron and survival bias
-void Nuclide::collideSurvivalBias( NeutronState& neutron,
-				   ParticleBank& bank) const
+// Collide with a neutron and survival bias using the tabulated scattering cross section
+void Nuclide::collideSurvivalBiasImpl(
+                   NeutronState& neutron,
+                   ParticleBank& bank,
+                   const double total_cross_section,
+                   const double absorption_cross_section,
+                   const double tabulated_scattering_cross_section ) const
 {
   double random_number =
     Utility::RandomNumberGenerator::getRandomNumber<double>();
 
-  double total_cross_section =
-    d_total_reaction->getCrossSection( neutron.getEnergy() );
-
-  double scattering_cross_section = total_cross_section -
-    d_total_absorption_reaction->getCrossSection( neutron.getEnergy() );
+  double scattering_cross_section =
+    total_cross_section - absorption_cross_section;
 
   double survival_prob = scattering_cross_section/total_cross_section;
 
@@ -386,7 +555,7 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
   {
     neutron.multiplyWeight( survival_prob );
 
-    sampleScatteringReaction( random_number*scattering_cross_section,
+    sampleScatteringReaction( random_number*tabulated_scattering_cross_section,
 			      neutron,
 			      bank );
   }
@@ -394,6 +563,31 @@ void Nuclide::collideSurvivalBias( NeutronState& neutron,
     neutron.setAsGone();
 }
 
+// Find the fission reactions
+/*! \details When the partial fission reactions are present they will be
+ * used. Otherwise the total fission reaction will be used (if present).
+ */
+void Nuclide::findFissionReactions()
+{
+  std::shared_ptr<const NeutronNuclearReaction> total_fission_reaction;
+
+  for( const ConstReactionMap* reactions : {&d_scattering_reactions,
+                                            &d_absorption_reactions,
+                                            &d_miscellaneous_reactions} )
+  {
+    for( auto&& reaction : *reactions )
+    {
+      if( reaction.first == N__TOTAL_FISSION_REACTION )
+        total_fission_reaction = reaction.second;
+      else if( isFissionReaction( reaction.first ) )
+        d_fission_reactions.push_back( reaction.second );
+    }
+  }
+
+  if( d_fission_reactions.empty() && total_fission_reaction )
+    d_fission_reactions.push_back( total_fission_reaction );
+}
+
 // Calculate the total absorption cross section
 void Nuclide::calculateTotalAbsorptionReaction(
           const std::shared_ptr<const std::vector<double> >& energy_grid,
@@ -424,6 +618,8 @@ void Nuclide::calculateTotalAbsorptionReaction(
     }
   }
 
+  d_absorption_cross_section = cross_section;
+
   // Create the total absorption reaction
   d_total_absorption_reaction.reset( new NeutronAbsorptionReaction(
                                                   energy_grid,
@@ -467,6 +663,8 @@ void Nuclide::calculateTotalReaction(
     }
   }
 
+  d_total_cross_section = cross_section;
+
   // Create the total reaction
   d_total_reaction.reset( new NeutronAbsorptionReaction( energy_grid,
                                                          cross_section,
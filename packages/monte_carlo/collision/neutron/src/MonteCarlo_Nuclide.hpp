@@ -103,6 +103,24 @@ public:
   //! Return the temperature of the nuclide (in MeV)
   double getTemperature() const;
 
+  //! Return the energy grid
+  const std::shared_ptr<const std::vector<double> >& getEnergyGrid() const;
+
+  //! Return the energy grid searcher
+  const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
+  getGridSearcher() const;
+
+  //! Add the energy grid points to an array
+  void getEnergyGridPoints( std::vector<double>& energy_grid_points ) const;
+
+  //! Return the total cross section evaluated on the energy grid
+  const std::shared_ptr<const std::vector<double> >&
+  getTotalCrossSectionOnEnergyGrid() const;
+
+  //! Return the total absorption cross section evaluated on the energy grid
+  const std::shared_ptr<const std::vector<double> >&
+  getAbsorptionCrossSectionOnEnergyGrid() const;
+
   //! Return the total cross section at the desired energy
   double getTotalCrossSection( const double energy ) const;
 
@@ -116,6 +134,15 @@ public:
   double getReactionCrossSection( const double energy,
 				  const NuclearReactionType reaction ) const;
 
+  //! Check if the nuclide is fissionable
+  bool isFissionable() const;
+
+  //! Return the fission cross section at the desired energy
+  double getFissionCrossSection( const double energy ) const;
+
+  //! Return the fission neutron production cross section (nu*sigma_f)
+  double getFissionNeutronProductionCrossSection( const double energy ) const;
+
   //! Return the absorption reaction types
   void getAbsorptionReactionTypes( ReactionEnumTypeSet& reaction_types ) const;
 
@@ -134,8 +161,36 @@ public:
   //! Collide with a neutron and survival bias
   virtual void collideSurvivalBias( NeutronState& neutron, ParticleBank& bank ) const;
 
+  //! Collide with a neutron using the total and absorption cross sections
+  virtual void collideAnalogue( NeutronState& neutron,
+                                ParticleBank& bank,
+                                const double total_cross_section,
+                                const double absorption_cross_section ) const;
+
+  //! Collide with a neutron and survival bias using the total and absorption cross sections
+  virtual void collideSurvivalBias(
+                                NeutronState& neutron,
+                                ParticleBank& bank,
+                                const double total_cross_section,
+                                const double absorption_cross_section ) const;
+
 private:
 
+  // Collide with a neutron using the total, absorption and tabulated cross sections
+  void collideAnalogueImpl( NeutronState& neutron,
+                            ParticleBank& bank,
+                            const double total_cross_section,
+                            const double absorption_cross_section,
+                            const double tabulated_total_cross_section,
+                            const double tabulated_absorption_cross_section ) const;
+
+  // Collide with a neutron and survival bias using the tabulated scattering cross section
+  void collideSurvivalBiasImpl( NeutronState& neutron,
+                                ParticleBank& bank,
+                                const double total_cross_section,
+                                const double absorption_cross_section,
+                                const double tabulated_scattering_cross_section ) const;
+
   // Set the default absorption reaction types
   static std::unordered_set<NuclearReactionType>
   setDefaultAbsorptionReactionTypes();
@@ -146,6 +201,9 @@ private:
           const std::shared_ptr<const Utility::HashBasedGridSearcher<double> >&
           grid_searcher );
 
+  // Find the fission reactions
+  void findFissionReactions();
+
   // Calculate the total cross section
   void calculateTotalReaction(
           const std::shared_ptr<const std::vector<double> >& energy_grid,
@@ -186,6 +244,19 @@ private:
   // The temperature of the nuclide (MeV)
   double d_temperature;
 
+  // The energy grid
+  std::shared_ptr<const std::vector<double> > d_energy_grid;
+
+  // The energy grid searcher
+  std::shared_ptr<const Utility::HashBasedGridSearcher<double> >
+  d_grid_searcher;
+
+  // The total cross section on the energy grid
+  std::shared_ptr<const std::vector<double> > d_total_cross_section;
+
+  // The total absorption cross section on the energy grid
+  std::shared_ptr<const std::vector<double> > d_absorption_cross_section;
+
   // The total reaction
   std::unique_ptr<const NeutronNuclearReaction> d_total_reaction;
 
@@ -200,6 +271,10 @@ private:
 
   // Miscellaneous reactions
   ConstReactionMap d_miscellaneous_reactions;
+
+  // The fission reactions (either the total or the partial reactions)
+  std::vector<std::shared_ptr<const NeutronNuclearReaction> >
+  d_fission_reactions;
 };
 
 } // end MonteCarlo namespace
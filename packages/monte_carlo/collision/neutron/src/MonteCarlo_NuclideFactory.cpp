@@ -132,7 +132,8 @@ void NuclideFactory::createNuclideFromACETable(
     Data::XSSNeutronDataExtractor xss_data_extractor(
 					 ace_file_handler.getTableNXSArray(),
 					 ace_file_handler.getTableJXSArray(),
-				         ace_file_handler.getTableXSSArray() );
+				         ace_file_handler.getTableXSSArrayView(),
+				         ace_file_handler.getTableXSSArrayOwner() );
 
     // Initialize the new nuclide
     NuclideNameMap::mapped_type& nuclide = d_nuclide_name_map[nuclide_name];
@@ -0,0 +1,231 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDopplerBroadenedCrossSection.cpp
+//! \author Alex Robinson
+//! \brief  Doppler broadened cross section unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <cmath>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "MonteCarlo_DopplerBroadenedCrossSection.hpp"
+#include "Utility_PhysicalConstants.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::shared_ptr<std::vector<double> > energy_grid;
+std::shared_ptr<std::vector<double> > constant_cross_section;
+std::shared_ptr<std::vector<double> > one_over_v_cross_section;
+
+// The broadening temperature (293.6 K in MeV)
+const double broadening_temperature = 2.53e-8;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Evaluate the analytic broadened cross section of a constant cross section
+double evaluateBroadenedConstantCrossSection( const double cross_section,
+                                              const double atomic_weight_ratio,
+                                              const double energy )
+{
+  const double y =
+    std::sqrt( atomic_weight_ratio*energy/broadening_temperature );
+
+  return cross_section*((1.0 + 0.5/(y*y))*std::erf( y ) +
+                        std::exp( -y*y )/
+                        (y*std::sqrt( Utility::PhysicalConstants::pi )));
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a constant cross section can be broadened
+FRENSIE_UNIT_TEST( DopplerBroadenedCrossSection, broaden_constant )
+{
+  std::vector<double> energies( {1e-9, 1e-8, 2.53e-8, 1e-6, 1e-3, 1.0} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    double cross_section =
+      MonteCarlo::DopplerBroadenedCrossSection::broaden(
+                                                       *energy_grid,
+                                                       *constant_cross_section,
+                                                       1.0,
+                                                       broadening_temperature,
+                                                       energies[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                 cross_section,
+                 evaluateBroadenedConstantCrossSection( 10.0, 1.0, energies[i] ),
+                 1e-6 );
+  }
+
+  // A heavy nuclide is broadened less
+  double cross_section =
+    MonteCarlo::DopplerBroadenedCrossSection::broaden( *energy_grid,
+                                                       *constant_cross_section,
+                                                       235.0,
+                                                       broadening_temperature,
+                                                       1e-8 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                 cross_section,
+                 evaluateBroadenedConstantCrossSection( 10.0, 235.0, 1e-8 ),
+                 1e-6 );
+  FRENSIE_CHECK_LESS( cross_section,
+                      evaluateBroadenedConstantCrossSection( 10.0, 1.0, 1e-8 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a 1/v cross section is not changed by broadening
+FRENSIE_UNIT_TEST( DopplerBroadenedCrossSection, broaden_one_over_v )
+{
+  std::vector<double> energies( {1e-9, 1e-8, 2.53e-8, 1e-6, 1e-3, 1.0} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    double cross_section =
+      MonteCarlo::DopplerBroadenedCrossSection::broaden(
+                                                     *energy_grid,
+                                                     *one_over_v_cross_section,
+                                                     1.0,
+                                                     broadening_temperature,
+                                                     energies[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( cross_section,
+                                     1.0/std::sqrt( energies[i] ),
+                                     1e-5 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a 1/v cross section is extrapolated below the energy grid
+FRENSIE_UNIT_TEST( DopplerBroadenedCrossSection,
+                   broaden_one_over_v_below_grid )
+{
+  // Remove the grid points below 1e-8 MeV
+  const size_t first_index =
+    std::lower_bound( energy_grid->begin(), energy_grid->end(), 1e-8 ) -
+    energy_grid->begin();
+
+  std::vector<double> truncated_energy_grid( energy_grid->begin()+first_index,
+                                             energy_grid->end() );
+  std::vector<double> truncated_cross_section(
+                           one_over_v_cross_section->begin()+first_index,
+                           one_over_v_cross_section->end() );
+
+  std::vector<double> energies( {truncated_energy_grid.front(),
+                                 2e-8,
+                                 2.53e-8,
+                                 1e-7} );
+
+  for( size_t i = 0; i < energies.size(); ++i )
+  {
+    double cross_section =
+      MonteCarlo::DopplerBroadenedCrossSection::broaden(
+                                                     truncated_energy_grid,
+                                                     truncated_cross_section,
+                                                     1.0,
+                                                     broadening_temperature,
+                                                     energies[i] );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY( cross_section,
+                                     1.0/std::sqrt( energies[i] ),
+                                     1e-5 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the broadened cross section can be evaluated on the grid
+FRENSIE_UNIT_TEST( DopplerBroadenedCrossSection, getCrossSectionAtGridPoint )
+{
+  MonteCarlo::DopplerBroadenedCrossSection
+    cross_section( energy_grid, constant_cross_section, 1.0, broadening_temperature );
+
+  FRENSIE_CHECK_EQUAL( cross_section.getBroadeningTemperature(),
+                       broadening_temperature );
+
+  for( size_t i = 1000; i < energy_grid->size(); i += 1000 )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                  cross_section.getCrossSectionAtGridPoint( i ),
+                  evaluateBroadenedConstantCrossSection( 10.0, 1.0, (*energy_grid)[i] ),
+                  1e-6 );
+
+    // The cached value must be returned the second time
+    FRENSIE_CHECK_EQUAL( cross_section.getCrossSectionAtGridPoint( i ),
+                         cross_section.getCrossSectionAtGridPoint( i ) );
+  }
+
+  // No broadening
+  MonteCarlo::DopplerBroadenedCrossSection
+    unbroadened_cross_section( energy_grid, one_over_v_cross_section, 1.0, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( unbroadened_cross_section.getCrossSectionAtGridPoint( 10 ),
+                       (*one_over_v_cross_section)[10] );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the broadened cross section can be evaluated
+FRENSIE_UNIT_TEST( DopplerBroadenedCrossSection, getCrossSection )
+{
+  MonteCarlo::DopplerBroadenedCrossSection
+    cross_section( energy_grid, constant_cross_section, 1.0, broadening_temperature );
+
+  const size_t bin_index = 2500;
+
+  const double lower_energy = (*energy_grid)[bin_index];
+  const double upper_energy = (*energy_grid)[bin_index+1];
+
+  FRENSIE_CHECK_EQUAL( cross_section.getCrossSection( lower_energy, bin_index ),
+                       cross_section.getCrossSectionAtGridPoint( bin_index ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+                   cross_section.getCrossSection( upper_energy, bin_index ),
+                   cross_section.getCrossSectionAtGridPoint( bin_index+1 ),
+                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY(
+     cross_section.getCrossSection( 0.5*(lower_energy + upper_energy), bin_index ),
+     0.5*(cross_section.getCrossSectionAtGridPoint( bin_index ) +
+          cross_section.getCrossSectionAtGridPoint( bin_index+1 )),
+     1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Create a log spaced energy grid
+  const size_t grid_size = 5000;
+  const double log_min_energy = std::log( 1e-13 );
+  const double log_max_energy = std::log( 20.0 );
+
+  energy_grid.reset( new std::vector<double>( grid_size ) );
+  constant_cross_section.reset( new std::vector<double>( grid_size, 10.0 ) );
+  one_over_v_cross_section.reset( new std::vector<double>( grid_size ) );
+
+  for( size_t i = 0; i < grid_size; ++i )
+  {
+    (*energy_grid)[i] = std::exp( log_min_energy +
+                                  (log_max_energy - log_min_energy)*i/
+                                  (grid_size - 1) );
+
+    (*one_over_v_cross_section)[i] = 1.0/std::sqrt( (*energy_grid)[i] );
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstDopplerBroadenedCrossSection.cpp
+//---------------------------------------------------------------------------//
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_NuclideFactory.hpp"
@@ -28,6 +29,8 @@ using boost::units::si::kelvin;
 
 std::shared_ptr<const MonteCarlo::NeutronMaterial> material;
 
+MonteCarlo::NuclideFactory::NuclideNameMap nuclide_map;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -245,6 +248,105 @@ FRENSIE_UNIT_TEST( NeutronMaterial_hydrogen, collideSurvivalBias )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the unionized energy grid can be constructed
+FRENSIE_UNIT_TEST( NeutronMaterial_water, constructUnionizedEnergyGrid )
+{
+  std::vector<double> nuclide_fractions( {2.0, 1.0} );
+  std::vector<std::string> nuclide_names( {"H-1_293.6K", "O-16_293.6K"} );
+
+  MonteCarlo::NeutronMaterial local_material( 1,
+                                              -1.0,
+                                              nuclide_map,
+                                              nuclide_fractions,
+                                              nuclide_names );
+
+  FRENSIE_CHECK( !local_material.hasUnionizedEnergyGrid() );
+
+  const MonteCarlo::Nuclide& h1_nuclide =
+    *nuclide_map.find( "H-1_293.6K" )->second;
+  const MonteCarlo::Nuclide& o16_nuclide =
+    *nuclide_map.find( "O-16_293.6K" )->second;
+
+  const double h1_number_density =
+    local_material.getScatteringCenterNumberDensity( "H-1_293.6K" );
+  const double o16_number_density =
+    local_material.getScatteringCenterNumberDensity( "O-16_293.6K" );
+
+  // The grid will not fit within a tiny memory budget
+  FRENSIE_CHECK_EQUAL( local_material.constructUnionizedEnergyGrid( 1e-11, 20.0, 100 ),
+                       0 );
+  FRENSIE_CHECK( !local_material.hasUnionizedEnergyGrid() );
+
+  uint64_t memory_used =
+    local_material.constructUnionizedEnergyGrid( 1e-11, 20.0, 100000000 );
+
+  FRENSIE_CHECK( memory_used > 0 );
+  FRENSIE_CHECK( local_material.hasUnionizedEnergyGrid() );
+
+  // The union of the lin-lin nuclide grids needs no refinement
+  std::vector<double> nuclide_grid_points;
+
+  h1_nuclide.getEnergyGridPoints( nuclide_grid_points );
+  o16_nuclide.getEnergyGridPoints( nuclide_grid_points );
+
+  nuclide_grid_points.erase( std::remove_if( nuclide_grid_points.begin(),
+                                             nuclide_grid_points.end(),
+                                             []( const double energy ){
+                                               return energy <= 1e-11 ||
+                                                 energy >= 20.0; } ),
+                             nuclide_grid_points.end() );
+
+  nuclide_grid_points.push_back( 1e-11 );
+  nuclide_grid_points.push_back( 20.0 );
+
+  std::sort( nuclide_grid_points.begin(), nuclide_grid_points.end() );
+
+  nuclide_grid_points.erase( std::unique( nuclide_grid_points.begin(),
+                                          nuclide_grid_points.end() ),
+                             nuclide_grid_points.end() );
+
+  FRENSIE_CHECK_EQUAL( local_material.getUnionizedEnergyGridSize(),
+                       nuclide_grid_points.size() );
+
+  // The tabulated values match the direct nuclide sum everywhere
+  for( size_t i = 0; i < nuclide_grid_points.size(); ++i )
+  {
+    std::vector<double> energies( {nuclide_grid_points[i]} );
+
+    if( i > 0 )
+    {
+      energies.push_back( 0.5*(nuclide_grid_points[i-1] +
+                               nuclide_grid_points[i]) );
+    }
+
+    for( size_t j = 0; j < energies.size(); ++j )
+    {
+      const double energy = energies[j];
+
+      const double direct_total_cross_section =
+        h1_number_density*h1_nuclide.getTotalCrossSection( energy ) +
+        o16_number_density*o16_nuclide.getTotalCrossSection( energy );
+
+      const double direct_absorption_cross_section =
+        h1_number_density*h1_nuclide.getAbsorptionCrossSection( energy ) +
+        o16_number_density*o16_nuclide.getAbsorptionCrossSection( energy );
+
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+                    local_material.getMacroscopicTotalCrossSection( energy ),
+                    direct_total_cross_section,
+                    1e-12 );
+      FRENSIE_CHECK_FLOATING_EQUALITY(
+               local_material.getMacroscopicAbsorptionCrossSection( energy ),
+               direct_absorption_cross_section,
+               1e-12 );
+    }
+  }
+
+  // The global material is not modified
+  FRENSIE_CHECK( !material->hasUnionizedEnergyGrid() );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -262,8 +364,6 @@ FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
 
 FRENSIE_CUSTOM_UNIT_TEST_INIT()
 {
-  MonteCarlo::NuclideFactory::NuclideNameMap nuclide_map;
-
   {
     // Determine the database directory
     boost::filesystem::path database_path =
@@ -277,6 +377,9 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
     const Data::NuclideProperties& h1_properties =
       database.getNuclideProperties( 1001 );
 
+    const Data::NuclideProperties& o16_properties =
+      database.getNuclideProperties( 8016 );
+
     // Initialize the nuclide definitions
     MonteCarlo::ScatteringCenterDefinitionDatabase nuclide_definitions;
 
@@ -289,9 +392,20 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                          7,
                                          2.53010E-08*MeV,
                                          true ) );
+
+    MonteCarlo::ScatteringCenterDefinition& o16_293K_definition =
+      nuclide_definitions.createDefinition( "O-16_293.6K", 8016 );
+
+    o16_293K_definition.setNuclearDataProperties(
+                                o16_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
   
     MonteCarlo::NuclideFactory::ScatteringCenterNameSet nuclides_to_create;
     nuclides_to_create.insert( "H-1_293.6K" );
+    nuclides_to_create.insert( "O-16_293.6K" );
 
     MonteCarlo::SimulationProperties properties;
     properties.setNumberOfNeutronHashGridBins( 100 );
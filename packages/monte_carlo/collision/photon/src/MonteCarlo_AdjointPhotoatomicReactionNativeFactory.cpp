@@ -37,7 +37,7 @@ void AdjointPhotoatomicReactionNativeFactory::createUnionEnergyGrid(
   if( max_energy < raw_adjoint_photoatom_data.getAdjointPhotonEnergyGrid().back() )
   {
     // Find the bin that contains the max energy
-    std::vector<double>::const_iterator lower_bound =
+    Utility::ArrayView<const double>::const_iterator lower_bound =
       Utility::Search::binaryLowerBound(
                raw_adjoint_photoatom_data.getAdjointPhotonEnergyGrid().begin(),
                raw_adjoint_photoatom_data.getAdjointPhotonEnergyGrid().end(),
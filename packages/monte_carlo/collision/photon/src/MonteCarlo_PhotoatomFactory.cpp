@@ -163,7 +163,8 @@ void PhotoatomFactory::createPhotoatomFromACETable(
     Data::XSSEPRDataExtractor xss_data_extractor(
 					 ace_file_handler.getTableNXSArray(),
 					 ace_file_handler.getTableJXSArray(),
-					 ace_file_handler.getTableXSSArray() );
+					 ace_file_handler.getTableXSSArrayView(),
+					 ace_file_handler.getTableXSSArrayOwner() );
 
     // Create the atomic relaxation model
     std::shared_ptr<const AtomicRelaxationModel> atomic_relaxation_model;
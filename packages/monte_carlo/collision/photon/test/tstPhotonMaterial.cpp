@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <algorithm>
 
 // FRENSIE Includes
 #include "MonteCarlo_PhotoatomFactory.hpp"
@@ -22,6 +23,8 @@
 
 std::shared_ptr<MonteCarlo::PhotonMaterial> material;
 
+MonteCarlo::PhotoatomFactory::PhotoatomNameMap atom_map;
+
 //---------------------------------------------------------------------------//
 // Tests.
 //---------------------------------------------------------------------------//
@@ -416,6 +419,116 @@ FRENSIE_UNIT_TEST( PhotonMaterial, collideSurvivalBias )
   Utility::RandomNumberGenerator::unsetFakeStream();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the unionized energy grid can be constructed
+FRENSIE_UNIT_TEST( PhotonMaterial, constructUnionizedEnergyGrid )
+{
+  std::vector<double> atom_fractions( {1.0, 1.0} );
+  std::vector<std::string> atom_names( {"Pb", "O"} );
+
+  MonteCarlo::PhotonMaterial local_material( 1,
+                                             -9.53,
+                                             atom_map,
+                                             atom_fractions,
+                                             atom_names );
+
+  FRENSIE_CHECK( !local_material.hasUnionizedEnergyGrid() );
+  FRENSIE_CHECK_EQUAL( local_material.getUnionizedEnergyGridSize(), 0 );
+
+  const MonteCarlo::Photoatom& pb_atom = *atom_map.find( "Pb" )->second;
+  const MonteCarlo::Photoatom& o_atom = *atom_map.find( "O" )->second;
+
+  const double pb_number_density =
+    local_material.getScatteringCenterNumberDensity( "Pb" );
+  const double o_number_density =
+    local_material.getScatteringCenterNumberDensity( "O" );
+
+  // The grid will not fit within a tiny memory budget
+  FRENSIE_CHECK_EQUAL( local_material.constructUnionizedEnergyGrid( 1e-3, 20.0, 100 ),
+                       0 );
+  FRENSIE_CHECK( !local_material.hasUnionizedEnergyGrid() );
+
+  uint64_t memory_used =
+    local_material.constructUnionizedEnergyGrid( 1e-3, 20.0, 100000000 );
+
+  FRENSIE_CHECK( memory_used > 0 );
+  FRENSIE_CHECK( memory_used <= 100000000 );
+  FRENSIE_CHECK( local_material.hasUnionizedEnergyGrid() );
+
+  // Every atom grid point in the energy range is in the unionized grid
+  std::vector<double> atom_grid_points;
+
+  pb_atom.getEnergyGridPoints( atom_grid_points );
+  o_atom.getEnergyGridPoints( atom_grid_points );
+
+  atom_grid_points.erase( std::remove_if( atom_grid_points.begin(),
+                                          atom_grid_points.end(),
+                                          []( const double energy ){
+                                            return energy < 1e-3 ||
+                                              energy > 20.0; } ),
+                          atom_grid_points.end() );
+
+  std::sort( atom_grid_points.begin(), atom_grid_points.end() );
+
+  atom_grid_points.erase( std::unique( atom_grid_points.begin(),
+                                       atom_grid_points.end() ),
+                          atom_grid_points.end() );
+
+  FRENSIE_CHECK( local_material.getUnionizedEnergyGridSize() >=
+                 atom_grid_points.size() );
+
+  // The tabulated values are exact at the atom grid points
+  for( size_t i = 0; i < atom_grid_points.size(); ++i )
+  {
+    const double energy = atom_grid_points[i];
+
+    const double direct_total_cross_section =
+      pb_number_density*pb_atom.getTotalCrossSection( energy ) +
+      o_number_density*o_atom.getTotalCrossSection( energy );
+
+    const double direct_absorption_cross_section =
+      pb_number_density*pb_atom.getAbsorptionCrossSection( energy ) +
+      o_number_density*o_atom.getAbsorptionCrossSection( energy );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                    local_material.getMacroscopicTotalCrossSection( energy ),
+                    direct_total_cross_section,
+                    1e-12 );
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+               local_material.getMacroscopicAbsorptionCrossSection( energy ),
+               direct_absorption_cross_section,
+               1e-12 );
+  }
+
+  // The interpolated values are within the construction tolerance between
+  // the atom grid points
+  for( size_t i = 1; i < atom_grid_points.size(); ++i )
+  {
+    const double energy =
+      0.5*(atom_grid_points[i-1] + atom_grid_points[i]);
+
+    const double direct_total_cross_section =
+      pb_number_density*pb_atom.getTotalCrossSection( energy ) +
+      o_number_density*o_atom.getTotalCrossSection( energy );
+
+    const double direct_absorption_cross_section =
+      pb_number_density*pb_atom.getAbsorptionCrossSection( energy ) +
+      o_number_density*o_atom.getAbsorptionCrossSection( energy );
+
+    FRENSIE_CHECK_FLOATING_EQUALITY(
+                    local_material.getMacroscopicTotalCrossSection( energy ),
+                    direct_total_cross_section,
+                    1e-3 );
+    FRENSIE_CHECK_SMALL(
+               local_material.getMacroscopicAbsorptionCrossSection( energy ) -
+               direct_absorption_cross_section,
+               1e-3*direct_total_cross_section );
+  }
+
+  // The global material is not modified
+  FRENSIE_CHECK( !material->hasUnionizedEnergyGrid() );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
@@ -446,6 +559,9 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
     const Data::AtomProperties& pb_properties =
       database.getAtomProperties( Data::Pb_ATOM );
 
+    const Data::AtomProperties& o_properties =
+      database.getAtomProperties( Data::O_ATOM );
+
     // Set the scattering center definitions
     MonteCarlo::ScatteringCenterDefinitionDatabase photoatom_definitions;
 
@@ -457,8 +573,17 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                  Data::PhotoatomicDataProperties::ACE_EPR_FILE,
                                  12 ) );
 
+    MonteCarlo::ScatteringCenterDefinition& o_definition =
+      photoatom_definitions.createDefinition( "O", Data::O_ATOM );
+
+    o_definition.setPhotoatomicDataProperties(
+           o_properties.getSharedPhotoatomicDataProperties(
+                                 Data::PhotoatomicDataProperties::ACE_EPR_FILE,
+                                 12 ) );
+
     MonteCarlo::PhotoatomFactory::ScatteringCenterNameSet photoatom_aliases;
     photoatom_aliases.insert( "Pb" );
+    photoatom_aliases.insert( "O" );
 
     // Set the simulation properties
     MonteCarlo::SimulationProperties properties;
@@ -480,8 +605,6 @@ FRENSIE_CUSTOM_UNIT_TEST_INIT()
                                           properties,
                                           true );
     
-    MonteCarlo::PhotoatomFactory::PhotoatomNameMap atom_map;
-
     factory.createPhotoatomMap( atom_map );
     
     // Assign the atom fractions and names
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <algorithm>
+#include <iterator>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
@@ -16,21 +17,25 @@
 
 namespace MonteCarlo{
 
+// Initialize static member data
+const size_t ParticleBank::s_min_compaction_size = 1024;
+
 // Default Constructor
 ParticleBank::ParticleBank()
-  : d_particle_states()
+  : d_particle_states(),
+    d_front( 0 )
 { /* ... */ }
 
 // Check if the bank is empty
 bool ParticleBank::isEmpty() const
 {
-  return d_particle_states.size() == 0;
+  return d_front == d_particle_states.size();
 }
 
 // The size of the bank
 unsigned long long ParticleBank::size() const
 {
-  return d_particle_states.size();
+  return d_particle_states.size() - d_front;
 }
 
 // Access the top element
@@ -39,7 +44,7 @@ ParticleState& ParticleBank::top()
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  return *d_particle_states[d_front];
 }
 
 // Access the top element
@@ -48,7 +53,7 @@ const ParticleState& ParticleBank::top() const
   // Make sure there is at least one particle in the bank
   testPrecondition( this->size() > 0 );
 
-  return *d_particle_states.front();
+  return *d_particle_states[d_front];
 }
 
 // Push a particle to the bank
@@ -57,7 +62,7 @@ const ParticleState& ParticleBank::top() const
  */
 void ParticleBank::push( const ParticleState& particle )
 {
-  d_particle_states.emplace_back( particle.clone() );
+  d_particle_states.push_back( ParticleBank::createClone( particle ) );
 }
 
 // Insert a neutron into the bank after an interaction (Most Efficient/Recommended)
@@ -85,18 +90,43 @@ void ParticleBank::push( const NeutronState& neutron,
 }
 
 // Pop a particle from the bank
+/*! \details The storage used by the bank is retained so that it can be
+ * reused by later pushes.
+ */
 void ParticleBank::pop()
 {
   // Make sure the bank is not empty
   testPrecondition( !this->isEmpty() );
 
-  d_particle_states.pop_front();
+  d_particle_states[d_front].reset();
+
+  ++d_front;
+
+  this->compact();
+}
+
+// Pop the top particle from the bank and store it in the shared pointer (Most Efficient/Recommended)
+/*! \details If the bank has sole ownership of the top particle it will
+ * be moved into the shared pointer. Otherwise a copy (clone) of the particle
+ * will be created.
+ */
+void ParticleBank::pop( std::shared_ptr<ParticleState>& particle )
+{
+  // Make sure the bank is not empty
+  testPrecondition( !this->isEmpty() );
+
+  if( d_particle_states[d_front].use_count() == 1 )
+    particle = std::move( d_particle_states[d_front] );
+  else
+    particle = ParticleBank::createClone( this->top() );
+
+  this->pop();
 }
 
 // Check if the bank is sorted
 bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 {
-  return std::is_sorted( d_particle_states.begin(),
+  return std::is_sorted( this->frontIterator(),
 			 d_particle_states.end(),
 			 std::bind<bool>(compare_function,
 					   std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
@@ -104,16 +134,24 @@ bool ParticleBank::isSorted( const CompareFunctionType& compare_function )
 }
 
 // Sort the particle states
+/*! \details The sort is stable (the relative order of equivalent particle
+ * states will be preserved).
+ */
 bool ParticleBank::sort( const CompareFunctionType& compare_function )
 {
-  d_particle_states.sort( std::bind<bool>(compare_function,
-					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
-					    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  std::stable_sort( this->frontIterator(),
+                    d_particle_states.end(),
+                    std::bind<bool>(compare_function,
+                                    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
+                                    std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+
+  return true;
 }
 
 // Merge the bank with another bank
 /*! Both banks must be sorted before calling this method. The input bank will
- * be emptied by this operation.
+ * be emptied by this operation. Equivalent particle states from this bank
+ * will precede those from the input bank.
  */
 void ParticleBank::merge( ParticleBank& other_bank,
 			  const CompareFunctionType& compare_function )
@@ -122,10 +160,16 @@ void ParticleBank::merge( ParticleBank& other_bank,
   testPrecondition( this->isSorted( compare_function ) );
   testPrecondition( other_bank.isSorted( compare_function ) );
 
-  d_particle_states.merge( other_bank.d_particle_states,
-			   std::bind<bool>(compare_function,
-					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
-					     std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
+  const size_t middle = d_particle_states.size();
+
+  this->splice( other_bank );
+
+  std::inplace_merge( this->frontIterator(),
+                      d_particle_states.begin() + middle,
+                      d_particle_states.end(),
+                      std::bind<bool>(compare_function,
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_1),
+                                      std::bind<const ParticleState&>(ParticleBank::dereference, std::placeholders::_2) ) );
 }
 
 // Splice the bank with another bank
@@ -134,8 +178,47 @@ void ParticleBank::merge( ParticleBank& other_bank,
  */
 void ParticleBank::splice( ParticleBank& other_bank )
 {
-  d_particle_states.splice( d_particle_states.end(),
-			    other_bank.d_particle_states );
+  d_particle_states.insert( d_particle_states.end(),
+                            std::make_move_iterator( other_bank.frontIterator() ),
+                            std::make_move_iterator( other_bank.d_particle_states.end() ) );
+
+  other_bank.d_particle_states.clear();
+  other_bank.d_front = 0;
+}
+
+// Create a shared pointer that owns a clone of the particle
+/*! \details The control block of the shared pointer is allocated from the
+ * thread-local memory pool (as is the cloned particle state).
+ */
+std::shared_ptr<ParticleState> ParticleBank::createClone(
+                                             const ParticleState& particle )
+{
+  return std::shared_ptr<ParticleState>(
+                  particle.clone(),
+                  std::default_delete<ParticleState>(),
+                  Utility::ThreadLocalMemoryPoolAllocator<ParticleState>() );
+}
+
+// Remove the popped particle slots from the front of the container
+/*! \details The container is cleared (without releasing its storage) once
+ * every particle has been popped. If particles are pushed as fast as they
+ * are popped the container will never be emptied so the popped slots are
+ * also removed once they make up at least half of the container.
+ */
+void ParticleBank::compact()
+{
+  if( d_front == d_particle_states.size() )
+  {
+    d_particle_states.clear();
+    d_front = 0;
+  }
+  else if( d_front >= s_min_compaction_size &&
+           2*d_front >= d_particle_states.size() )
+  {
+    d_particle_states.erase( d_particle_states.begin(),
+                             this->frontIterator() );
+    d_front = 0;
+  }
 }
 
 EXPLICIT_CLASS_SERIALIZE_INST( ParticleBank );
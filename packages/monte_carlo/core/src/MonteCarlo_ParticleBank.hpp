@@ -23,11 +23,18 @@
 #include "MonteCarlo_ParticleState.hpp"
 #include "MonteCarlo_NeutronState.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_ThreadLocalMemoryPool.hpp"
+#include "Utility_Vector.hpp"
 #include "Utility_List.hpp"
 
 namespace MonteCarlo{
 
-//! The particle bank base class (FIFO)
+/*! The particle bank base class (FIFO)
+ * \details The particle states are stored in a contiguous container. Popping
+ * a particle simply advances the front of the bank so the storage can be
+ * reused by subsequent pushes without any reallocation once the bank has
+ * reached its working size.
+ */
 class ParticleBank
 {
 
@@ -86,6 +93,9 @@ public:
   template<template<typename> class SmartPointer>
   void pop( SmartPointer<ParticleState>& particle );
 
+  //! Pop the top particle from the bank and store it in the shared pointer (Most Efficient/Recommended)
+  void pop( std::shared_ptr<ParticleState>& particle );
+
   //! Check if the bank is sorted
   virtual bool isSorted( const CompareFunctionType& compare_function );
 
@@ -102,7 +112,11 @@ public:
 protected:
 
   //! The bank container type
-  typedef std::list<std::shared_ptr<ParticleState> > BankContainerType;
+  typedef std::vector<std::shared_ptr<ParticleState> > BankContainerType;
+
+  //! Create a shared pointer that owns a clone of the particle
+  static std::shared_ptr<ParticleState> createClone(
+                                            const ParticleState& particle );
 
 private:
 
@@ -110,16 +124,33 @@ private:
   static const ParticleState& dereference(
                                const std::shared_ptr<ParticleState>& pointer );
 
+  // Get an iterator to the top of the bank
+  BankContainerType::iterator frontIterator();
+
+  // Remove the popped particle slots from the front of the container
+  void compact();
+
   // Save the bank to an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  { ar & BOOST_SERIALIZATION_NVP(d_particle_states); }
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the bank from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
 
   // Declare the boost serialization access object as a friend
   friend class boost::serialization::access;
 
-  // A list of particle states
+  // The number of popped slots that must be reached before compacting
+  static const size_t s_min_compaction_size;
+
+  // The particle states
   BankContainerType d_particle_states;
+
+  // The index of the top particle state
+  size_t d_front;
 };
 
 // Dereference a smart pointer
@@ -129,9 +160,15 @@ inline const ParticleState& ParticleBank::dereference(
   return *pointer;
 }
 
+// Get an iterator to the top of the bank
+inline ParticleBank::BankContainerType::iterator ParticleBank::frontIterator()
+{
+  return d_particle_states.begin() + d_front;
+}
+
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleBank, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleBank, MonteCarlo, 1 );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleBank );
 
 //---------------------------------------------------------------------------//
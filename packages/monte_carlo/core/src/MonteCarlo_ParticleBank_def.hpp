@@ -83,6 +83,38 @@ void ParticleBank::pop( SmartPointer<ParticleState>& particle )
   this->pop();
 }
 
+// Save the bank to an archive
+/*! \details Only the particle states that have not been popped are saved.
+ */
+template<typename Archive>
+void ParticleBank::save( Archive& ar, const unsigned version ) const
+{
+  BankContainerType particle_states( d_particle_states.begin() + d_front,
+                                     d_particle_states.end() );
+
+  ar & boost::serialization::make_nvp( "d_particle_states", particle_states );
+}
+
+// Load the bank from an archive
+/*! \details Version 0 archives store the particle states in a list.
+ */
+template<typename Archive>
+void ParticleBank::load( Archive& ar, const unsigned version )
+{
+  if( version == 0 )
+  {
+    std::list<std::shared_ptr<ParticleState> > particle_states;
+
+    ar & boost::serialization::make_nvp( "d_particle_states", particle_states );
+
+    d_particle_states.assign( particle_states.begin(), particle_states.end() );
+  }
+  else
+    ar & BOOST_SERIALIZATION_NVP( d_particle_states );
+
+  d_front = 0;
+}
+
 } // end MonteCarlo namespace
 
 #endif // end MONTE_CARLO_PARTICLE_BANK_DEF_HPP
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <limits>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleState.hpp"
@@ -38,9 +41,10 @@ ParticleState::ParticleState()
     d_source_cell( 0 ),
     d_lost( false ),
     d_gone( false ),
-    d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
+    d_model( ParticleState::getDefaultModel() ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( std::make_pair(1.0, 1.0))
+    d_importance_pair( std::make_pair(1.0, 1.0)),
+    d_cached_mesh_element( std::numeric_limits<meshElementHandleType>::max() )
 { /* ... */ }
 
 // Constructor
@@ -64,9 +68,10 @@ ParticleState::ParticleState(
     d_source_cell( 0 ),
     d_lost( false ),
     d_gone( false ),
-    d_model( new Geometry::InfiniteMediumModel( d_source_cell ) ),
+    d_model( ParticleState::getDefaultModel() ),
     d_navigator( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( std::make_pair(1.0, 1.0))
+    d_importance_pair( std::make_pair(1.0, 1.0)),
+    d_cached_mesh_element( std::numeric_limits<meshElementHandleType>::max() )
 { /* ... */ }
 
 // Copy constructor
@@ -99,7 +104,8 @@ ParticleState::ParticleState( const ParticleState& existing_base_state,
     d_gone( false ),
     d_model( existing_base_state.d_model ),
     d_navigator( existing_base_state.d_navigator->clone( this->createAdvanceCompleteCallback() ) ),
-    d_importance_pair( existing_base_state.d_importance_pair )
+    d_importance_pair( existing_base_state.d_importance_pair ),
+    d_cached_mesh_element( existing_base_state.d_cached_mesh_element )
 {
   // Increment the generation number if requested
   if( increment_generation_number )
@@ -184,6 +190,21 @@ const std::pair<double, double>& ParticleState::getImportancePair() const
   return d_importance_pair;
 }
 
+// Return the mesh element that the particle was last located in (search hint)
+/*! \details The maximum handle value is returned if the particle has not
+ * been located in a mesh element yet.
+ */
+auto ParticleState::getCachedMeshElement() const -> meshElementHandleType
+{
+  return d_cached_mesh_element;
+}
+
+// Set the mesh element that the particle was last located in (search hint)
+void ParticleState::setCachedMeshElement( const meshElementHandleType element )
+{
+  d_cached_mesh_element = element;
+}
+
 // Return the source id that created the particle (history)
 ParticleState::sourceIdType ParticleState::getSourceId() const
 {
@@ -218,6 +239,15 @@ Geometry::Model::EntityId ParticleState::getCell() const
   return d_navigator->getCurrentCell();
 }
 
+// Return the dense index of the cell containing the particle
+/*! \details The cell index can be used to address the flat per-cell tables
+ * of the filled geometry model (see Geometry::Model::getCellIndex).
+ */
+size_t ParticleState::getCellIndex() const
+{
+  return d_navigator->getCurrentCellIndex();
+}
+
 // Return the x position of the particle
 double ParticleState::getXPosition() const
 {
@@ -713,7 +743,7 @@ void ParticleState::extractFromModel()
 
   d_navigator.reset();
 
-  d_model.reset( new Geometry::InfiniteMediumModel( d_source_cell ) );
+  d_model = ParticleState::getDefaultModel();
 
   // Create the dummy navigator
   d_navigator.reset( d_model->createNavigatorAdvanced( this->createAdvanceCompleteCallback() ) );
@@ -747,6 +777,21 @@ ParticleState::createAdvanceCompleteCallback()
                           std::placeholders::_1 );
 }
 
+// Get the default model that particles are embedded in
+/*! \details All particles created on a thread that are not embedded in a
+ * model of interest share the same infinite medium model (with cell id 0).
+ * This avoids a heap allocation every time that a particle is constructed or
+ * extracted from a model. Each thread has its own copy so that the reference
+ * count updates do not contend across threads.
+ */
+const std::shared_ptr<const Geometry::Model>& ParticleState::getDefaultModel()
+{
+  thread_local const std::shared_ptr<const Geometry::Model>
+    default_model( new Geometry::InfiniteMediumModel( 0 ) );
+
+  return default_model;
+}
+
 EXPLICIT_CLASS_SAVE_LOAD_INST( ParticleState );
 
 } // end MonteCarlo
@@ -27,6 +27,7 @@
 #include "Utility_PhysicalConstants.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_QuantityTraits.hpp"
+#include "Utility_ThreadLocalMemoryPool.hpp"
 
 namespace MonteCarlo{
 
@@ -63,6 +64,9 @@ public:
   //! Typedef for ray safety distance type
   typedef double raySafetyDistanceType;
 
+  //! Typedef for mesh element handle type
+  typedef uint64_t meshElementHandleType;
+
 private:
 
   // Typedef for QuantityTraits
@@ -90,6 +94,14 @@ public:
   virtual ~ParticleState()
   { /* ... */ }
 
+  //! Allocate memory for a particle state from the thread-local memory pool
+  static void* operator new( size_t size )
+  { return Utility::ThreadLocalMemoryPool::allocate( size ); }
+
+  //! Return the memory of a particle state to the thread-local memory pool
+  static void operator delete( void* particle, size_t size ) noexcept
+  { Utility::ThreadLocalMemoryPool::deallocate( particle, size ); }
+
   /*! Clone the particle state (do not use to generate new particles through reactions, VR is fine!)
    * \details This method returns a heap-allocated pointer. It is only safe
    * to call this method inside of a smart pointer constructor or reset
@@ -117,6 +129,12 @@ public:
 
   const std::pair<double, double>& getImportancePair() const;
 
+  //! Return the mesh element that the particle was last located in (search hint)
+  meshElementHandleType getCachedMeshElement() const;
+
+  //! Set the mesh element that the particle was last located in (search hint)
+  void setCachedMeshElement( const meshElementHandleType element );
+
   //! Return the id of the source that created the particle (history)
   sourceIdType getSourceId() const;
 
@@ -132,6 +150,9 @@ public:
   //! Return the cell handle for the cell containing the particle
   Geometry::Model::EntityId getCell() const;
 
+  //! Return the dense index of the cell containing the particle
+  size_t getCellIndex() const;
+
   //! Return the x position of the particle
   double getXPosition() const;
 
@@ -313,6 +334,9 @@ private:
   // Create the navigator AdvanceComplete callback method
   Geometry::Navigator::AdvanceCompleteCallback createAdvanceCompleteCallback();
 
+  // Get the default model that particles are embedded in
+  static const std::shared_ptr<const Geometry::Model>& getDefaultModel();
+
   // Save the state to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -385,6 +409,11 @@ private:
 
   // The navigator used by the particle
   std::unique_ptr<Geometry::Navigator> d_navigator;
+
+  // The mesh element that the particle was last located in
+  // Note: This is only a hint for mesh element searches (it may belong to
+  //       a different mesh or be out of date) so it is not archived.
+  meshElementHandleType d_cached_mesh_element;
 };
 
 // Set the position of the particle
@@ -41,7 +41,11 @@ SimulationElectronProperties::SimulationElectronProperties()
     d_electroionization_sampling_mode( KNOCK_ON_SAMPLING ),
     d_atomic_excitation_mode_on( true ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_condensed_history_mode_on( false ),
+    d_condensed_history_max_energy_loss_fraction( 0.1 ),
+    d_condensed_history_knock_on_threshold( 1e-2 ),
+    d_condensed_history_bremsstrahlung_threshold( 1e-2 )
 { /* ... */ }
 
 // Set the minimum electron energy (MeV)
@@ -347,6 +351,79 @@ double SimulationElectronProperties::getElectronRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set condensed history mode to off (off by default)
+void SimulationElectronProperties::setCondensedHistoryModeOff()
+{
+  d_condensed_history_mode_on = false;
+}
+
+// Set condensed history mode to on (off by default)
+/*! \details When condensed history mode is on, electrons will be transported
+ * with the class II condensed history method: soft collisions will be
+ * grouped into steps with continuous energy loss and multiple scattering
+ * angular deflections while hard collisions (above the knock-on and
+ * bremsstrahlung production thresholds) will be simulated explicitly.
+ */
+void SimulationElectronProperties::setCondensedHistoryModeOn()
+{
+  d_condensed_history_mode_on = true;
+}
+
+// Return if condensed history mode is on
+bool SimulationElectronProperties::isCondensedHistoryModeOn() const
+{
+  return d_condensed_history_mode_on;
+}
+
+// Set the max fractional energy loss per condensed history step
+void SimulationElectronProperties::setCondensedHistoryMaxEnergyLossFraction(
+                                                        const double fraction )
+{
+  // Make sure the fraction is valid
+  testPrecondition( fraction > 0.0 );
+  testPrecondition( fraction <= 1.0 );
+
+  d_condensed_history_max_energy_loss_fraction = fraction;
+}
+
+// Return the max fractional energy loss per condensed history step
+double SimulationElectronProperties::getCondensedHistoryMaxEnergyLossFraction() const
+{
+  return d_condensed_history_max_energy_loss_fraction;
+}
+
+// Set the condensed history knock-on production threshold (MeV)
+void SimulationElectronProperties::setCondensedHistoryKnockOnThreshold(
+                                                       const double threshold )
+{
+  // Make sure the threshold is valid
+  testPrecondition( threshold > 0.0 );
+
+  d_condensed_history_knock_on_threshold = threshold;
+}
+
+// Return the condensed history knock-on production threshold (MeV)
+double SimulationElectronProperties::getCondensedHistoryKnockOnThreshold() const
+{
+  return d_condensed_history_knock_on_threshold;
+}
+
+// Set the condensed history bremsstrahlung production threshold (MeV)
+void SimulationElectronProperties::setCondensedHistoryBremsstrahlungThreshold(
+                                                       const double threshold )
+{
+  // Make sure the threshold is valid
+  testPrecondition( threshold > 0.0 );
+
+  d_condensed_history_bremsstrahlung_threshold = threshold;
+}
+
+// Return the condensed history bremsstrahlung production threshold (MeV)
+double SimulationElectronProperties::getCondensedHistoryBremsstrahlungThreshold() const
+{
+  return d_condensed_history_bremsstrahlung_threshold;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationElectronProperties );
 
 } // end MonteCarlo namespace
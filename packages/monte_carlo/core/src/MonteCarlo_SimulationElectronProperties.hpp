@@ -182,6 +182,35 @@ public:
   //! Return the cutoff roulette survival weight
   double getElectronRouletteSurvivalWeight() const;
 
+  /* ------ Condensed History Properties ------ */
+
+  //! Set condensed history mode to off (off by default)
+  void setCondensedHistoryModeOff();
+
+  //! Set condensed history mode to on (off by default)
+  void setCondensedHistoryModeOn();
+
+  //! Return if condensed history mode is on
+  bool isCondensedHistoryModeOn() const;
+
+  //! Set the max fractional energy loss per condensed history step (0.1 by default)
+  void setCondensedHistoryMaxEnergyLossFraction( const double fraction );
+
+  //! Return the max fractional energy loss per condensed history step
+  double getCondensedHistoryMaxEnergyLossFraction() const;
+
+  //! Set the condensed history knock-on production threshold (MeV) (1e-2 by default)
+  void setCondensedHistoryKnockOnThreshold( const double threshold );
+
+  //! Return the condensed history knock-on production threshold (MeV)
+  double getCondensedHistoryKnockOnThreshold() const;
+
+  //! Set the condensed history bremsstrahlung production threshold (MeV) (1e-2 by default)
+  void setCondensedHistoryBremsstrahlungThreshold( const double threshold );
+
+  //! Return the condensed history bremsstrahlung production threshold (MeV)
+  double getCondensedHistoryBremsstrahlungThreshold() const;
+
 private:
 
   // Save the state to an archive
@@ -260,6 +289,18 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The condensed history mode (true = on, false = off - default)
+  bool d_condensed_history_mode_on;
+
+  // The max fractional energy loss per condensed history step
+  double d_condensed_history_max_energy_loss_fraction;
+
+  // The condensed history knock-on production threshold (MeV)
+  double d_condensed_history_knock_on_threshold;
+
+  // The condensed history bremsstrahlung production threshold (MeV)
+  double d_condensed_history_bremsstrahlung_threshold;
 };
 
 // Save/load the state to an archive
@@ -288,13 +329,28 @@ void SimulationElectronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_atomic_excitation_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_mode_on );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_max_energy_loss_fraction );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_knock_on_threshold );
+    ar & BOOST_SERIALIZATION_NVP( d_condensed_history_bremsstrahlung_threshold );
+  }
+  else
+  {
+    d_condensed_history_mode_on = false;
+    d_condensed_history_max_energy_loss_fraction = 0.1;
+    d_condensed_history_knock_on_threshold = 1e-2;
+    d_condensed_history_bremsstrahlung_threshold = 1e-2;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationElectronProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationElectronProperties, "SimulationElectronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationElectronProperties );
 
@@ -26,7 +26,15 @@ SimulationGeneralProperties::SimulationGeneralProperties()
     d_number_of_batches_per_processor( 1 ),
     d_number_of_snapshots_per_batch( 1 ),
     d_wall_time( Utility::QuantityTraits<double>::inf() ),
-    d_implicit_capture_mode_on( false )
+    d_implicit_capture_mode_on( false ),
+    d_tracking_method( STANDARD_TRACKING ),
+    d_delta_tracking_majorant_ratio_threshold( 0.25 ),
+    d_material_unionized_grid_memory_budget( 0 ),
+    d_history_schedule( STATIC_HISTORY_SCHEDULE ),
+    d_history_schedule_chunk_size( 1 ),
+    d_asynchronous_rendezvous_mode_on( false ),
+    d_random_number_generator_type( Utility::LINEAR_CONGRUENTIAL_GENERATOR ),
+    d_history_ordered_estimator_merge_mode_on( false )
 { /* ... */ }
 
 // Set the particle mode
@@ -201,6 +209,192 @@ bool SimulationGeneralProperties::isImplicitCaptureModeOn() const
   return d_implicit_capture_mode_on;
 }
 
+// Set the tracking method (standard by default)
+/*! \details The alternative tracking method will still be used for particle
+ * types that have forced collision cells.
+ */
+void SimulationGeneralProperties::setTrackingMethod(
+                                    const TrackingMethodType tracking_method )
+{
+  d_tracking_method = tracking_method;
+}
+
+// Return the tracking method
+TrackingMethodType SimulationGeneralProperties::getTrackingMethod() const
+{
+  return d_tracking_method;
+}
+
+// Set the delta tracking majorant ratio threshold
+/*! \details When delta tracking is used, a particle will be surface tracked
+ * through any cell where the ratio of the cell total macroscopic cross section
+ * to the majorant cross section is below this threshold (void cells are
+ * always surface tracked). A threshold of 0.0 will result in pure delta
+ * tracking through all non-void cells.
+ */
+void SimulationGeneralProperties::setDeltaTrackingMajorantRatioThreshold(
+                                                       const double threshold )
+{
+  TEST_FOR_EXCEPTION( threshold < 0.0,
+                      std::runtime_error,
+                      "The delta tracking majorant ratio threshold must be "
+                      "in the range [0.0,1.0]!" );
+
+  TEST_FOR_EXCEPTION( threshold > 1.0,
+                      std::runtime_error,
+                      "The delta tracking majorant ratio threshold must be "
+                      "in the range [0.0,1.0]!" );
+
+  d_delta_tracking_majorant_ratio_threshold = threshold;
+}
+
+// Return the delta tracking majorant ratio threshold
+double SimulationGeneralProperties::getDeltaTrackingMajorantRatioThreshold() const
+{
+  return d_delta_tracking_majorant_ratio_threshold;
+}
+
+// Set the material unionized energy grid memory budget (bytes)
+/*! \details When the budget is greater than zero, each material will tabulate
+ * its macroscopic total, absorption and cumulative scattering center total
+ * cross sections on a material level energy grid so that a single grid search
+ * is required for each evaluation. The budget applies to all of the materials
+ * of a particular particle type. Materials that do not fit within the
+ * remaining budget will evaluate their cross sections directly from the
+ * scattering centers. A budget of zero (default) disables the unionized
+ * grids.
+ */
+void SimulationGeneralProperties::setMaterialUnionizedGridMemoryBudget(
+                                                        const uint64_t budget )
+{
+  d_material_unionized_grid_memory_budget = budget;
+}
+
+// Return the material unionized energy grid memory budget (bytes)
+uint64_t SimulationGeneralProperties::getMaterialUnionizedGridMemoryBudget() const
+{
+  return d_material_unionized_grid_memory_budget;
+}
+
+// Set the history schedule (static by default)
+/*! \details The dynamic, guided and queue schedules balance the load between
+ * threads when the cost of a history varies significantly (e.g. coupled
+ * electron-photon histories). The results do not depend on the schedule.
+ */
+void SimulationGeneralProperties::setHistorySchedule(
+                                         const HistoryScheduleType schedule )
+{
+  d_history_schedule = schedule;
+}
+
+// Return the history schedule
+HistoryScheduleType SimulationGeneralProperties::getHistorySchedule() const
+{
+  return d_history_schedule;
+}
+
+// Set the history schedule chunk size
+/*! \details The chunk size is the number of histories that a thread will
+ * claim at once with the dynamic and queue schedules and the minimum number
+ * of histories that a thread will claim at once with the guided schedule.
+ * It is ignored by the static schedule.
+ */
+void SimulationGeneralProperties::setHistoryScheduleChunkSize(
+                                                    const uint64_t chunk_size )
+{
+  TEST_FOR_EXCEPTION( chunk_size == 0,
+                      std::runtime_error,
+                      "The history schedule chunk size must be greater than "
+                      "zero!" );
+
+  d_history_schedule_chunk_size = chunk_size;
+}
+
+// Return the history schedule chunk size
+uint64_t SimulationGeneralProperties::getHistoryScheduleChunkSize() const
+{
+  return d_history_schedule_chunk_size;
+}
+
+// Set asynchronous rendezvous mode to on (off by default)
+/*! \details Only the disk write of a rendezvous archive is asynchronous in
+ * this mode. The simulation state is still serialized into an in memory
+ * binary archive by the rendezvous thread while the other threads wait (as
+ * is the reduction of the observer data in distributed simulations). A
+ * background thread then writes the archive to disk while the simulation
+ * continues. The model will only be stored once, in a separate static data
+ * archive that the rendezvous files refer to. Other archive types than
+ * binary (bin) are converted from the in memory binary archive by the
+ * background thread, which requires roughly three times the memory of the
+ * archived state (the live state, the binary archive and the converted
+ * copy), and the next rendezvous will wait for the conversion to finish
+ * before it serializes the state.
+ */
+void SimulationGeneralProperties::setAsynchronousRendezvousModeOn()
+{
+  d_asynchronous_rendezvous_mode_on = true;
+}
+
+// Set synchronous rendezvous mode to on (on by default)
+void SimulationGeneralProperties::setSynchronousRendezvousModeOn()
+{
+  d_asynchronous_rendezvous_mode_on = false;
+}
+
+// Return if asynchronous rendezvous mode has been set
+bool SimulationGeneralProperties::isAsynchronousRendezvousModeOn() const
+{
+  return d_asynchronous_rendezvous_mode_on;
+}
+
+// Set history ordered estimator merge mode to on (off by default)
+/*! \details By default each thread accumulates the estimator moments
+ * locally and the thread moments are merged in thread order, which does not
+ * require any locking. The merged moments will then depend on the
+ * assignment of the histories to the threads. In history ordered estimator
+ * merge mode the estimators store every history contribution and add them
+ * to the moments in history order, which makes the moments bit-identical to
+ * the moments from a serial run regardless of the number of threads and
+ * the history schedule. The merge is serial and the stored contributions
+ * (32 bytes each) are only released at each snapshot and rendezvous, so
+ * this mode should only be used when reproducibility is required.
+ */
+void SimulationGeneralProperties::setHistoryOrderedEstimatorMergeModeOn()
+{
+  d_history_ordered_estimator_merge_mode_on = true;
+}
+
+// Set thread ordered estimator merge mode to on (on by default)
+void SimulationGeneralProperties::setThreadOrderedEstimatorMergeModeOn()
+{
+  d_history_ordered_estimator_merge_mode_on = false;
+}
+
+// Return if history ordered estimator merge mode has been set
+bool SimulationGeneralProperties::isHistoryOrderedEstimatorMergeModeOn() const
+{
+  return d_history_ordered_estimator_merge_mode_on;
+}
+
+// Set the random number generator type (linear congruential by default)
+/*! \details The counter-based Philox generator provides a separate random
+ * number stream for every particle of a history, which means that the
+ * histories can never overlap. The type is stored in the rendezvous archives
+ * so that a restarted simulation will continue with the same generator.
+ */
+void SimulationGeneralProperties::setRandomNumberGeneratorType(
+                                const Utility::RandomNumberGeneratorType type )
+{
+  d_random_number_generator_type = type;
+}
+
+// Return the random number generator type
+Utility::RandomNumberGeneratorType
+SimulationGeneralProperties::getRandomNumberGeneratorType() const
+{
+  return d_random_number_generator_type;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationGeneralProperties );
 
 } // end MonteCarlo namespace
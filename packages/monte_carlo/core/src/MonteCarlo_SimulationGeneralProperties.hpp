@@ -17,6 +17,9 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleModeType.hpp"
+#include "MonteCarlo_TrackingMethodType.hpp"
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_QuantityTraits.hpp"
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 
@@ -101,6 +104,60 @@ public:
   //! Return if implicit capture mode has been set
   bool isImplicitCaptureModeOn() const;
 
+  //! Set the tracking method (standard by default)
+  void setTrackingMethod( const TrackingMethodType tracking_method );
+
+  //! Return the tracking method
+  TrackingMethodType getTrackingMethod() const;
+
+  //! Set the delta tracking majorant ratio threshold
+  void setDeltaTrackingMajorantRatioThreshold( const double threshold );
+
+  //! Return the delta tracking majorant ratio threshold
+  double getDeltaTrackingMajorantRatioThreshold() const;
+
+  //! Set the material unionized energy grid memory budget (bytes)
+  void setMaterialUnionizedGridMemoryBudget( const uint64_t budget );
+
+  //! Return the material unionized energy grid memory budget (bytes)
+  uint64_t getMaterialUnionizedGridMemoryBudget() const;
+
+  //! Set the history schedule (static by default)
+  void setHistorySchedule( const HistoryScheduleType schedule );
+
+  //! Return the history schedule
+  HistoryScheduleType getHistorySchedule() const;
+
+  //! Set the history schedule chunk size
+  void setHistoryScheduleChunkSize( const uint64_t chunk_size );
+
+  //! Return the history schedule chunk size
+  uint64_t getHistoryScheduleChunkSize() const;
+
+  //! Set asynchronous rendezvous (archive write) mode to on (off by default)
+  void setAsynchronousRendezvousModeOn();
+
+  //! Set synchronous rendezvous mode to on (on by default)
+  void setSynchronousRendezvousModeOn();
+
+  //! Return if asynchronous rendezvous mode has been set
+  bool isAsynchronousRendezvousModeOn() const;
+
+  //! Set history ordered estimator merge mode to on (off by default)
+  void setHistoryOrderedEstimatorMergeModeOn();
+
+  //! Set thread ordered estimator merge mode to on (on by default)
+  void setThreadOrderedEstimatorMergeModeOn();
+
+  //! Return if history ordered estimator merge mode has been set
+  bool isHistoryOrderedEstimatorMergeModeOn() const;
+
+  //! Set the random number generator type (linear congruential by default)
+  void setRandomNumberGeneratorType( const Utility::RandomNumberGeneratorType type );
+
+  //! Return the random number generator type
+  Utility::RandomNumberGeneratorType getRandomNumberGeneratorType() const;
+
 private:
 
   // Save the state to an archive
@@ -145,6 +202,31 @@ private:
 
   // The capture mode (true = implicit, false = analogue - default)
   bool d_implicit_capture_mode_on;
+
+  // The tracking method
+  TrackingMethodType d_tracking_method;
+
+  // The delta tracking majorant ratio threshold
+  double d_delta_tracking_majorant_ratio_threshold;
+
+  // The material unionized energy grid memory budget (bytes)
+  uint64_t d_material_unionized_grid_memory_budget;
+
+  // The history schedule
+  HistoryScheduleType d_history_schedule;
+
+  // The history schedule chunk size
+  uint64_t d_history_schedule_chunk_size;
+
+  // The rendezvous mode (true = asynchronous, false = synchronous - default)
+  bool d_asynchronous_rendezvous_mode_on;
+
+  // The random number generator type
+  Utility::RandomNumberGeneratorType d_random_number_generator_type;
+
+  // The estimator merge mode (true = history ordered, false = thread ordered
+  // - default)
+  bool d_history_ordered_estimator_merge_mode_on;
 };
 
 // Save the state to an archive
@@ -179,6 +261,38 @@ void SimulationGeneralProperties::save( Archive& ar, const unsigned version ) co
   }
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_tracking_method );
+    ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_majorant_ratio_threshold );
+  }
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_material_unionized_grid_memory_budget );
+  }
+
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule );
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  }
+
+  if( version > 3 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_asynchronous_rendezvous_mode_on );
+  }
+
+  if( version > 4 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_random_number_generator_type );
+  }
+
+  if( version > 5 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_ordered_estimator_merge_mode_on );
+  }
 }
 
 // Load the state to an archive
@@ -203,13 +317,71 @@ void SimulationGeneralProperties::load( Archive& ar, const unsigned version )
     d_wall_time = Utility::QuantityTraits<double>::inf();
 
   ar & BOOST_SERIALIZATION_NVP( d_implicit_capture_mode_on );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_tracking_method );
+    ar & BOOST_SERIALIZATION_NVP( d_delta_tracking_majorant_ratio_threshold );
+  }
+  else
+  {
+    d_tracking_method = STANDARD_TRACKING;
+    d_delta_tracking_majorant_ratio_threshold = 0.25;
+  }
+
+  if( version > 1 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_material_unionized_grid_memory_budget );
+  }
+  else
+  {
+    d_material_unionized_grid_memory_budget = 0;
+  }
+
+  if( version > 2 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule );
+    ar & BOOST_SERIALIZATION_NVP( d_history_schedule_chunk_size );
+  }
+  else
+  {
+    d_history_schedule = STATIC_HISTORY_SCHEDULE;
+    d_history_schedule_chunk_size = 1;
+  }
+
+  if( version > 3 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_asynchronous_rendezvous_mode_on );
+  }
+  else
+  {
+    d_asynchronous_rendezvous_mode_on = false;
+  }
+
+  if( version > 4 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_random_number_generator_type );
+  }
+  else
+  {
+    d_random_number_generator_type = Utility::LINEAR_CONGRUENTIAL_GENERATOR;
+  }
+
+  if( version > 5 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_history_ordered_estimator_merge_mode_on );
+  }
+  else
+  {
+    d_history_ordered_estimator_merge_mode_on = false;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationGeneralProperties, 6 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationGeneralProperties, "SimulationGeneralProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationGeneralProperties );
 
@@ -9,6 +9,7 @@
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // Must be included first
 #include "MonteCarlo_SimulationNeutronProperties.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -27,7 +28,11 @@ SimulationNeutronProperties::SimulationNeutronProperties()
     d_free_gas_threshold( 400.0 ),
     d_unresolved_resonance_probability_table_mode_on( true ),
     d_threshold_weight( 0.0 ),
-    d_survival_weight()
+    d_survival_weight(),
+    d_number_of_inactive_cycles( 0 ),
+    d_number_of_active_cycles( 0 ),
+    d_number_of_histories_per_cycle( 1000 ),
+    d_shannon_entropy_mesh_bins_per_dimension( 0 )
 { /* ... */ }
 
 // Set the minimum neutron energy (MeV)
@@ -159,6 +164,80 @@ double SimulationNeutronProperties::getNeutronRouletteSurvivalWeight() const
   return d_survival_weight;
 }
 
+// Set the number of inactive k-eigenvalue cycles
+/*! \details Inactive cycles are used to converge the fission source. No
+ * observer contributions from these cycles will be kept.
+ */
+void SimulationNeutronProperties::setNumberOfInactiveCycles(
+                                                        const unsigned cycles )
+{
+  d_number_of_inactive_cycles = cycles;
+}
+
+// Return the number of inactive k-eigenvalue cycles
+unsigned SimulationNeutronProperties::getNumberOfInactiveCycles() const
+{
+  return d_number_of_inactive_cycles;
+}
+
+// Set the number of active k-eigenvalue cycles
+/*! \details Setting a value greater than zero will turn on k-eigenvalue
+ * mode.
+ */
+void SimulationNeutronProperties::setNumberOfActiveCycles(
+                                                        const unsigned cycles )
+{
+  d_number_of_active_cycles = cycles;
+}
+
+// Return the number of active k-eigenvalue cycles
+unsigned SimulationNeutronProperties::getNumberOfActiveCycles() const
+{
+  return d_number_of_active_cycles;
+}
+
+// Set the number of histories per k-eigenvalue cycle
+void SimulationNeutronProperties::setNumberOfHistoriesPerCycle(
+                                                     const uint64_t histories )
+{
+  TEST_FOR_EXCEPTION( histories == 0,
+                      std::runtime_error,
+                      "The number of histories per cycle must be greater "
+                      "than 0!" );
+
+  d_number_of_histories_per_cycle = histories;
+}
+
+// Return the number of histories per k-eigenvalue cycle
+uint64_t SimulationNeutronProperties::getNumberOfHistoriesPerCycle() const
+{
+  return d_number_of_histories_per_cycle;
+}
+
+// Check if k-eigenvalue mode is on (off by default)
+bool SimulationNeutronProperties::isKEigenvalueModeOn() const
+{
+  return d_number_of_active_cycles > 0;
+}
+
+// Set the number of Shannon entropy mesh bins per dimension
+/*! \details The Shannon entropy mesh is a uniform mesh that covers the
+ * bounding box of the fission sites from the first cycle. If the number of
+ * bins is 0 (default) it will be chosen so that there are approximately 20
+ * fission sites per bin.
+ */
+void SimulationNeutronProperties::setShannonEntropyMeshBinsPerDimension(
+                                                          const unsigned bins )
+{
+  d_shannon_entropy_mesh_bins_per_dimension = bins;
+}
+
+// Return the number of Shannon entropy mesh bins per dimension
+unsigned SimulationNeutronProperties::getShannonEntropyMeshBinsPerDimension() const
+{
+  return d_shannon_entropy_mesh_bins_per_dimension;
+}
+
 EXPLICIT_CLASS_SERIALIZE_INST( SimulationNeutronProperties );
 
 } // end MonteCarlo namespace
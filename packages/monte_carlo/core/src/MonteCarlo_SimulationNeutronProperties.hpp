@@ -9,6 +9,9 @@
 #ifndef MONTE_CARLO_SIMULATION_NEUTRON_PROPERTIES_HPP
 #define MONTE_CARLO_SIMULATION_NEUTRON_PROPERTIES_HPP
 
+// Std Lib Includes
+#include <cstdint>
+
 // Boost Includes
 #include <boost/serialization/shared_ptr.hpp>
 #include <boost/serialization/split_member.hpp>
@@ -87,6 +90,33 @@ public:
   //! Return the cutoff roulette survival weight
   double getNeutronRouletteSurvivalWeight() const;
 
+  //! Set the number of inactive k-eigenvalue cycles
+  void setNumberOfInactiveCycles( const unsigned cycles );
+
+  //! Return the number of inactive k-eigenvalue cycles
+  unsigned getNumberOfInactiveCycles() const;
+
+  //! Set the number of active k-eigenvalue cycles
+  void setNumberOfActiveCycles( const unsigned cycles );
+
+  //! Return the number of active k-eigenvalue cycles
+  unsigned getNumberOfActiveCycles() const;
+
+  //! Set the number of histories per k-eigenvalue cycle
+  void setNumberOfHistoriesPerCycle( const uint64_t histories );
+
+  //! Return the number of histories per k-eigenvalue cycle
+  uint64_t getNumberOfHistoriesPerCycle() const;
+
+  //! Check if k-eigenvalue mode is on (off by default)
+  bool isKEigenvalueModeOn() const;
+
+  //! Set the number of Shannon entropy mesh bins per dimension
+  void setShannonEntropyMeshBinsPerDimension( const unsigned bins );
+
+  //! Return the number of Shannon entropy mesh bins per dimension
+  unsigned getShannonEntropyMeshBinsPerDimension() const;
+
 private:
 
   // Save/load the state to an archive
@@ -124,6 +154,18 @@ private:
 
   // The roulette survival weight
   double d_survival_weight;
+
+  // The number of inactive k-eigenvalue cycles
+  unsigned d_number_of_inactive_cycles;
+
+  // The number of active k-eigenvalue cycles
+  unsigned d_number_of_active_cycles;
+
+  // The number of histories per k-eigenvalue cycle
+  uint64_t d_number_of_histories_per_cycle;
+
+  // The number of Shannon entropy mesh bins per dimension (0 = automatic)
+  unsigned d_shannon_entropy_mesh_bins_per_dimension;
 };
 
 // Save/load the state to an archive
@@ -138,13 +180,28 @@ void SimulationNeutronProperties::serialize( Archive& ar,
   ar & BOOST_SERIALIZATION_NVP( d_unresolved_resonance_probability_table_mode_on );
   ar & BOOST_SERIALIZATION_NVP( d_threshold_weight );
   ar & BOOST_SERIALIZATION_NVP( d_survival_weight );
+
+  if( version > 0 )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_inactive_cycles );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_active_cycles );
+    ar & BOOST_SERIALIZATION_NVP( d_number_of_histories_per_cycle );
+    ar & BOOST_SERIALIZATION_NVP( d_shannon_entropy_mesh_bins_per_dimension );
+  }
+  else
+  {
+    d_number_of_inactive_cycles = 0;
+    d_number_of_active_cycles = 0;
+    d_number_of_histories_per_cycle = 1000;
+    d_shannon_entropy_mesh_bins_per_dimension = 0;
+  }
 }
 
 } // end MonteCarlo namespace
 
 #if !defined SWIG
 
-BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 0 );
+BOOST_CLASS_VERSION( MonteCarlo::SimulationNeutronProperties, 1 );
 BOOST_CLASS_EXPORT_KEY2( MonteCarlo::SimulationNeutronProperties, "SimulationNeutronProperties" );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, SimulationNeutronProperties );
 
@@ -0,0 +1,45 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TrackingMethodType.cpp
+//! \author Alex Robinson
+//! \brief  Tracking method type helper function definitions
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "MonteCarlo_TrackingMethodType.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+// Convert a MonteCarlo::TrackingMethodType to a string
+std::string ToStringTraits<MonteCarlo::TrackingMethodType>::toString( const MonteCarlo::TrackingMethodType type )
+{
+  switch( type )
+  {
+    case MonteCarlo::STANDARD_TRACKING:
+      return "Standard Tracking";
+    case MonteCarlo::ALTERNATIVE_TRACKING:
+      return "Alternative Tracking";
+    case MonteCarlo::DELTA_TRACKING:
+      return "Delta Tracking";
+    default:
+    {
+      THROW_EXCEPTION( std::logic_error,
+                       "TrackingMethodType " << (unsigned)type <<
+                       " cannot be converted to a string!" );
+    }
+  }
+}
+
+// Place the MonteCarlo::TrackingMethodType in a stream
+void ToStringTraits<MonteCarlo::TrackingMethodType>::toStream( std::ostream& os, const MonteCarlo::TrackingMethodType type )
+{
+  os << ToStringTraits<MonteCarlo::TrackingMethodType>::toString( type );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TrackingMethodType.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_TrackingMethodType.hpp
+//! \author Alex Robinson
+//! \brief  Tracking method type enum and helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_TRACKING_METHOD_TYPE_HPP
+#define MONTE_CARLO_TRACKING_METHOD_TYPE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace MonteCarlo{
+
+/*! The particle tracking method enumeration
+ *
+ * The standard and alternative methods are surface tracking methods (a ray
+ * is fired through every cell that is entered). The alternative method will
+ * always be used for particle types that have forced collision cells. The
+ * delta tracking method (Woodcock tracking) samples tentative collision sites
+ * using a majorant cross section and only requires point location at those
+ * sites. When adding a new type the ToStringTraits methods and the
+ * serialization method must be updated.
+ */
+enum TrackingMethodType
+{
+  STANDARD_TRACKING = 0,
+  ALTERNATIVE_TRACKING,
+  DELTA_TRACKING
+};
+
+} // end MonteCarlo namespace
+
+namespace Utility{
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * MonteCarlo::TrackingMethodType
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<MonteCarlo::TrackingMethodType>
+{
+  //! Convert a MonteCarlo::TrackingMethodType to a string
+  static std::string toString( const MonteCarlo::TrackingMethodType type );
+
+  //! Place the MonteCarlo::TrackingMethodType in a stream
+  static void toStream( std::ostream& os, const MonteCarlo::TrackingMethodType type );
+};
+
+} // end Utility namespace
+
+namespace std{
+
+//! Stream operator for printing TrackingMethodType enums
+inline std::ostream& operator<<( std::ostream& os,
+                                 const MonteCarlo::TrackingMethodType type )
+{
+  os << Utility::toString( type );
+  return os;
+}
+
+} // end std namespace
+
+namespace boost{
+
+namespace serialization{
+
+//! Serialize the MonteCarlo::TrackingMethodType enum
+template<typename Archive>
+void serialize( Archive& archive,
+                MonteCarlo::TrackingMethodType& type,
+                const unsigned version )
+{
+  if( Archive::is_saving::value )
+    archive & (int)type;
+  else
+  {
+    int raw_type;
+
+    archive & raw_type;
+
+    switch( raw_type )
+    {
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::STANDARD_TRACKING, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::ALTERNATIVE_TRACKING, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( MonteCarlo::DELTA_TRACKING, int, type );
+
+      default:
+      {
+        THROW_EXCEPTION( std::logic_error,
+                         "Cannot convert the deserialized raw tracking "
+                         "method type to its corresponding enum value!" );
+      }
+    }
+  }
+}
+
+} // end serialization namespace
+
+} // end boost namespace
+
+#endif // end MONTE_CARLO_TRACKING_METHOD_TYPE_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_TrackingMethodType.hpp
+//---------------------------------------------------------------------------//
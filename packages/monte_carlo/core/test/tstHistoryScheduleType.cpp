@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstHistoryScheduleType.cpp
+//! \author Alex Robinson
+//! \brief  History schedule type helper unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_HistoryScheduleType.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the history schedule types can be converted to int
+FRENSIE_UNIT_TEST( HistoryScheduleType, convert_to_int )
+{
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::STATIC_HISTORY_SCHEDULE, 0 );
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::DYNAMIC_HISTORY_SCHEDULE, 1 );
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::GUIDED_HISTORY_SCHEDULE, 2 );
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::QUEUE_HISTORY_SCHEDULE, 3 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a history schedule type can be converted to a string
+FRENSIE_UNIT_TEST( HistoryScheduleType, toString )
+{
+  std::string type_string =
+    Utility::toString( MonteCarlo::STATIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Static History Schedule" );
+
+  type_string = Utility::toString( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Dynamic History Schedule" );
+
+  type_string = Utility::toString( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Guided History Schedule" );
+
+  type_string = Utility::toString( MonteCarlo::QUEUE_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Queue History Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a history schedule type can be sent to a stream
+FRENSIE_UNIT_TEST( HistoryScheduleType, stream_operator )
+{
+  std::stringstream ss;
+
+  ss << MonteCarlo::STATIC_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Static History Schedule" );
+
+  ss.str( "" );
+  ss << MonteCarlo::DYNAMIC_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Dynamic History Schedule" );
+
+  ss.str( "" );
+  ss << MonteCarlo::GUIDED_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Guided History Schedule" );
+
+  ss.str( "" );
+  ss << MonteCarlo::QUEUE_HISTORY_SCHEDULE;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Queue History Schedule" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a history schedule type can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( HistoryScheduleType,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_history_schedule_type" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::HistoryScheduleType type_1 = MonteCarlo::STATIC_HISTORY_SCHEDULE;
+    MonteCarlo::HistoryScheduleType type_2 = MonteCarlo::DYNAMIC_HISTORY_SCHEDULE;
+    MonteCarlo::HistoryScheduleType type_3 = MonteCarlo::GUIDED_HISTORY_SCHEDULE;
+    MonteCarlo::HistoryScheduleType type_4 = MonteCarlo::QUEUE_HISTORY_SCHEDULE;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_1 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_2 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_3 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_4 ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived types
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::HistoryScheduleType type_1;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_1 ) );
+  FRENSIE_CHECK_EQUAL( type_1, MonteCarlo::STATIC_HISTORY_SCHEDULE );
+
+  MonteCarlo::HistoryScheduleType type_2;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_2 ) );
+  FRENSIE_CHECK_EQUAL( type_2, MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  MonteCarlo::HistoryScheduleType type_3;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_3 ) );
+  FRENSIE_CHECK_EQUAL( type_3, MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  MonteCarlo::HistoryScheduleType type_4;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_4 ) );
+  FRENSIE_CHECK_EQUAL( type_4, MonteCarlo::QUEUE_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// end tstHistoryScheduleType.cpp
+//---------------------------------------------------------------------------//
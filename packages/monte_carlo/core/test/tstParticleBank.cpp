@@ -248,6 +248,62 @@ FRENSIE_UNIT_TEST( ParticleBank, pop_store )
   FRENSIE_CHECK_EQUAL( bank.size(), 0 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that particles can be pushed and popped in any order
+FRENSIE_UNIT_TEST( ParticleBank, push_pop_interleaved )
+{
+  MonteCarlo::ParticleBank bank;
+
+  unsigned long long next_pushed_history = 0ull;
+  unsigned long long next_popped_history = 0ull;
+
+  // Push two particles for every particle that is popped
+  for( size_t i = 0; i < 3000; ++i )
+  {
+    bank.push( MonteCarlo::PhotonState( next_pushed_history++ ) );
+    bank.push( MonteCarlo::PhotonState( next_pushed_history++ ) );
+
+    FRENSIE_REQUIRE_EQUAL( bank.top().getHistoryNumber(),
+                           next_popped_history );
+
+    bank.pop();
+
+    ++next_popped_history;
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3000 );
+
+  // Push one particle for every particle that is popped
+  for( size_t i = 0; i < 3000; ++i )
+  {
+    bank.push( MonteCarlo::PhotonState( next_pushed_history++ ) );
+
+    std::shared_ptr<MonteCarlo::ParticleState> particle;
+
+    bank.pop( particle );
+
+    FRENSIE_REQUIRE_EQUAL( particle->getHistoryNumber(),
+                           next_popped_history );
+
+    ++next_popped_history;
+  }
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 3000 );
+
+  // Empty the bank
+  while( !bank.isEmpty() )
+  {
+    FRENSIE_REQUIRE_EQUAL( bank.top().getHistoryNumber(),
+                           next_popped_history );
+
+    bank.pop();
+
+    ++next_popped_history;
+  }
+
+  FRENSIE_CHECK_EQUAL( next_popped_history, next_pushed_history );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the bank can be sorted
 FRENSIE_UNIT_TEST( ParticleBank, sort )
@@ -8,6 +8,7 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <limits>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleState.hpp"
@@ -373,6 +374,25 @@ FRENSIE_UNIT_TEST( ParticleState, setRaySafetyDistance )
   FRENSIE_CHECK_EQUAL( particle.getRaySafetyDistance(), 1.0 );
 }
 
+//---------------------------------------------------------------------------//
+// Set/get the cached mesh element of a particle
+FRENSIE_UNIT_TEST( ParticleState, setgetCachedMeshElement )
+{
+  TestParticleState particle( 1ull );
+
+  FRENSIE_CHECK_EQUAL( particle.getCachedMeshElement(),
+                       std::numeric_limits<MonteCarlo::ParticleState::meshElementHandleType>::max() );
+
+  particle.setCachedMeshElement( 10 );
+
+  FRENSIE_CHECK_EQUAL( particle.getCachedMeshElement(), 10 );
+
+  // Particles created from this particle start from the same element
+  TestParticleState particle_gen_b( particle, true );
+
+  FRENSIE_CHECK_EQUAL( particle_gen_b.getCachedMeshElement(), 10 );
+}
+
 //---------------------------------------------------------------------------//
 // Test if a particle is lost
 FRENSIE_UNIT_TEST( ParticleState, lost )
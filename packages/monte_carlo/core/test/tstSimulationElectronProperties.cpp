@@ -55,6 +55,12 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties, defaults )
   FRENSIE_CHECK( properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getElectronRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.1 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryKnockOnThreshold(), 1e-2 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBremsstrahlungThreshold(),
+                       1e-2 );
 }
 
 //---------------------------------------------------------------------------//
@@ -382,6 +388,49 @@ FRENSIE_UNIT_TEST( SimulationElectronProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Test that condensed history mode can be turned on
+FRENSIE_UNIT_TEST( SimulationElectronProperties, setCondensedHistoryModeOnOff )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryModeOn();
+
+  FRENSIE_CHECK( properties.isCondensedHistoryModeOn() );
+
+  properties.setCondensedHistoryModeOff();
+
+  FRENSIE_CHECK( !properties.isCondensedHistoryModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the condensed history max energy loss fraction can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setCondensedHistoryMaxEnergyLossFraction )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryMaxEnergyLossFraction( 0.05 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryMaxEnergyLossFraction(),
+                       0.05 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the condensed history production thresholds can be set
+FRENSIE_UNIT_TEST( SimulationElectronProperties,
+                   setCondensedHistoryProductionThresholds )
+{
+  MonteCarlo::SimulationElectronProperties properties;
+
+  properties.setCondensedHistoryKnockOnThreshold( 1e-3 );
+  properties.setCondensedHistoryBremsstrahlungThreshold( 2e-3 );
+
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryKnockOnThreshold(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( properties.getCondensedHistoryBremsstrahlungThreshold(),
+                       2e-3 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
@@ -422,6 +471,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
     custom_properties.setAtomicExcitationModeOff();
     custom_properties.setElectronRouletteThresholdWeight( 1e-15 );
     custom_properties.setElectronRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setCondensedHistoryModeOn();
+    custom_properties.setCondensedHistoryMaxEnergyLossFraction( 0.05 );
+    custom_properties.setCondensedHistoryKnockOnThreshold( 1e-3 );
+    custom_properties.setCondensedHistoryBremsstrahlungThreshold( 2e-3 );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -462,6 +515,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK( default_properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getElectronRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK( !default_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.1 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryKnockOnThreshold(), 1e-2 );
+  FRENSIE_CHECK_EQUAL( default_properties.getCondensedHistoryBremsstrahlungThreshold(), 1e-2 );
 
   MonteCarlo::SimulationElectronProperties custom_properties;
 
@@ -490,6 +547,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationElectronProperties,
   FRENSIE_CHECK( !custom_properties.isAtomicExcitationModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getElectronRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK( custom_properties.isCondensedHistoryModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryMaxEnergyLossFraction(), 0.05 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryKnockOnThreshold(), 1e-3 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getCondensedHistoryBremsstrahlungThreshold(), 2e-3 );
 }
 
 //---------------------------------------------------------------------------//
@@ -41,6 +41,18 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, defaults )
   FRENSIE_CHECK_EQUAL( properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getTrackingMethod(),
+                       MonteCarlo::STANDARD_TRACKING );
+  FRENSIE_CHECK_EQUAL( properties.getDeltaTrackingMajorantRatioThreshold(),
+                       0.25 );
+  FRENSIE_CHECK_EQUAL( properties.getMaterialUnionizedGridMemoryBudget(), 0 );
+  FRENSIE_CHECK_EQUAL( properties.getHistorySchedule(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !properties.isAsynchronousRendezvousModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+  FRENSIE_CHECK( !properties.isHistoryOrderedEstimatorMergeModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -193,6 +205,149 @@ FRENSIE_UNIT_TEST( SimulationGeneralProperties, setImplicitCaptureModeOnOff )
   FRENSIE_CHECK( !properties.isImplicitCaptureModeOn() );
 }
 
+//---------------------------------------------------------------------------//
+// Test that the tracking method can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setTrackingMethod )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setTrackingMethod( MonteCarlo::ALTERNATIVE_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( properties.getTrackingMethod(),
+                       MonteCarlo::ALTERNATIVE_TRACKING );
+
+  properties.setTrackingMethod( MonteCarlo::DELTA_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( properties.getTrackingMethod(),
+                       MonteCarlo::DELTA_TRACKING );
+
+  properties.setTrackingMethod( MonteCarlo::STANDARD_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( properties.getTrackingMethod(),
+                       MonteCarlo::STANDARD_TRACKING );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the delta tracking majorant ratio threshold can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setDeltaTrackingMajorantRatioThreshold )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setDeltaTrackingMajorantRatioThreshold( 0.0 );
+
+  FRENSIE_CHECK_EQUAL( properties.getDeltaTrackingMajorantRatioThreshold(),
+                       0.0 );
+
+  properties.setDeltaTrackingMajorantRatioThreshold( 0.9 );
+
+  FRENSIE_CHECK_EQUAL( properties.getDeltaTrackingMajorantRatioThreshold(),
+                       0.9 );
+
+  FRENSIE_CHECK_THROW( properties.setDeltaTrackingMajorantRatioThreshold( -0.1 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( properties.setDeltaTrackingMajorantRatioThreshold( 1.1 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the material unionized grid memory budget can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setMaterialUnionizedGridMemoryBudget )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setMaterialUnionizedGridMemoryBudget( 1000000 );
+
+  FRENSIE_CHECK_EQUAL( properties.getMaterialUnionizedGridMemoryBudget(),
+                       1000000 );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistorySchedule )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistorySchedule( MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistorySchedule(),
+                       MonteCarlo::DYNAMIC_HISTORY_SCHEDULE );
+
+  properties.setHistorySchedule( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistorySchedule(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+
+  properties.setHistorySchedule( MonteCarlo::QUEUE_HISTORY_SCHEDULE );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistorySchedule(),
+                       MonteCarlo::QUEUE_HISTORY_SCHEDULE );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the history schedule chunk size can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setHistoryScheduleChunkSize )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryScheduleChunkSize( 16 );
+
+  FRENSIE_CHECK_EQUAL( properties.getHistoryScheduleChunkSize(), 16 );
+
+  FRENSIE_CHECK_THROW( properties.setHistoryScheduleChunkSize( 0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Test that asynchronous rendezvous mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setAsynchronousRendezvousModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setAsynchronousRendezvousModeOn();
+
+  FRENSIE_CHECK( properties.isAsynchronousRendezvousModeOn() );
+
+  properties.setSynchronousRendezvousModeOn();
+
+  FRENSIE_CHECK( !properties.isAsynchronousRendezvousModeOn() );
+}
+
+//---------------------------------------------------------------------------//
+// Test that the random number generator type can be set
+FRENSIE_UNIT_TEST( SimulationGeneralProperties, setRandomNumberGeneratorType )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setRandomNumberGeneratorType( Utility::PHILOX_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::PHILOX_GENERATOR );
+
+  properties.setRandomNumberGeneratorType( Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+}
+
+//---------------------------------------------------------------------------//
+// Test that history ordered estimator merge mode can be turned on and off
+FRENSIE_UNIT_TEST( SimulationGeneralProperties,
+                   setHistoryOrderedEstimatorMergeModeOnOff )
+{
+  MonteCarlo::SimulationGeneralProperties properties;
+
+  properties.setHistoryOrderedEstimatorMergeModeOn();
+
+  FRENSIE_CHECK( properties.isHistoryOrderedEstimatorMergeModeOn() );
+
+  properties.setThreadOrderedEstimatorMergeModeOn();
+
+  FRENSIE_CHECK( !properties.isHistoryOrderedEstimatorMergeModeOn() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
@@ -226,6 +381,14 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
     custom_properties.setNumberOfBatchesPerProcessor( 25 );
     custom_properties.setNumberOfSnapshotsPerBatch( 3 );
     custom_properties.setImplicitCaptureModeOn();
+    custom_properties.setTrackingMethod( MonteCarlo::DELTA_TRACKING );
+    custom_properties.setDeltaTrackingMajorantRatioThreshold( 0.5 );
+    custom_properties.setMaterialUnionizedGridMemoryBudget( 1000000 );
+    custom_properties.setHistorySchedule( MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+    custom_properties.setHistoryScheduleChunkSize( 8 );
+    custom_properties.setAsynchronousRendezvousModeOn();
+    custom_properties.setRandomNumberGeneratorType( Utility::PHILOX_GENERATOR );
+    custom_properties.setHistoryOrderedEstimatorMergeModeOn();
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -257,6 +420,19 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfBatchesPerProcessor(), 1 );
   FRENSIE_CHECK_EQUAL( default_properties.getNumberOfSnapshotsPerBatch(), 1 );
   FRENSIE_CHECK( !default_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getTrackingMethod(),
+                       MonteCarlo::STANDARD_TRACKING );
+  FRENSIE_CHECK_EQUAL( default_properties.getDeltaTrackingMajorantRatioThreshold(),
+                       0.25 );
+  FRENSIE_CHECK_EQUAL( default_properties.getMaterialUnionizedGridMemoryBudget(),
+                       0 );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistorySchedule(),
+                       MonteCarlo::STATIC_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( default_properties.getHistoryScheduleChunkSize(), 1 );
+  FRENSIE_CHECK( !default_properties.isAsynchronousRendezvousModeOn() );
+  FRENSIE_CHECK_EQUAL( default_properties.getRandomNumberGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+  FRENSIE_CHECK( !default_properties.isHistoryOrderedEstimatorMergeModeOn() );
 
   MonteCarlo::SimulationGeneralProperties custom_properties;
 
@@ -275,6 +451,19 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationGeneralProperties,
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfBatchesPerProcessor(), 25 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfSnapshotsPerBatch(), 3 );
   FRENSIE_CHECK( custom_properties.isImplicitCaptureModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getTrackingMethod(),
+                       MonteCarlo::DELTA_TRACKING );
+  FRENSIE_CHECK_EQUAL( custom_properties.getDeltaTrackingMajorantRatioThreshold(),
+                       0.5 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getMaterialUnionizedGridMemoryBudget(),
+                       1000000 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistorySchedule(),
+                       MonteCarlo::GUIDED_HISTORY_SCHEDULE );
+  FRENSIE_CHECK_EQUAL( custom_properties.getHistoryScheduleChunkSize(), 8 );
+  FRENSIE_CHECK( custom_properties.isAsynchronousRendezvousModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getRandomNumberGeneratorType(),
+                       Utility::PHILOX_GENERATOR );
+  FRENSIE_CHECK( custom_properties.isHistoryOrderedEstimatorMergeModeOn() );
 }
 
 //---------------------------------------------------------------------------//
@@ -37,6 +37,11 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties, defaults )
   FRENSIE_CHECK( properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( properties.getNeutronRouletteSurvivalWeight(), 1e-30 );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 0u );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 0u );
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfHistoriesPerCycle(), 1000u );
+  FRENSIE_CHECK( !properties.isKEigenvalueModeOn() );
+  FRENSIE_CHECK_EQUAL( properties.getShannonEntropyMeshBinsPerDimension(), 0u );
 }
 
 //---------------------------------------------------------------------------//
@@ -130,6 +135,33 @@ FRENSIE_UNIT_TEST( SimulationNeutronProperties,
                        weight );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the k-eigenvalue cycle properties can be set
+FRENSIE_UNIT_TEST( SimulationNeutronProperties, setKEigenvalueCycles )
+{
+  MonteCarlo::SimulationNeutronProperties properties;
+
+  properties.setNumberOfInactiveCycles( 10u );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfInactiveCycles(), 10u );
+  FRENSIE_CHECK( !properties.isKEigenvalueModeOn() );
+
+  properties.setNumberOfActiveCycles( 50u );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfActiveCycles(), 50u );
+  FRENSIE_CHECK( properties.isKEigenvalueModeOn() );
+
+  properties.setNumberOfHistoriesPerCycle( 5000u );
+
+  FRENSIE_CHECK_EQUAL( properties.getNumberOfHistoriesPerCycle(), 5000u );
+  FRENSIE_CHECK_THROW( properties.setNumberOfHistoriesPerCycle( 0u ),
+                       std::runtime_error );
+
+  properties.setShannonEntropyMeshBinsPerDimension( 8u );
+
+  FRENSIE_CHECK_EQUAL( properties.getShannonEntropyMeshBinsPerDimension(), 8u );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the properties can be archived
 FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
@@ -160,6 +192,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
     custom_properties.setUnresolvedResonanceProbabilityTableModeOff();
     custom_properties.setNeutronRouletteThresholdWeight( 1e-15 );
     custom_properties.setNeutronRouletteSurvivalWeight( 1e-13 );
+    custom_properties.setNumberOfInactiveCycles( 10u );
+    custom_properties.setNumberOfActiveCycles( 50u );
+    custom_properties.setNumberOfHistoriesPerCycle( 5000u );
+    custom_properties.setShannonEntropyMeshBinsPerDimension( 8u );
 
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( default_properties ) );
     FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( custom_properties ) );
@@ -186,6 +222,10 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK( default_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteThresholdWeight(), 1e-30 );
   FRENSIE_CHECK_SMALL( default_properties.getNeutronRouletteSurvivalWeight(), 1e-30  );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfInactiveCycles(), 0u );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfActiveCycles(), 0u );
+  FRENSIE_CHECK_EQUAL( default_properties.getNumberOfHistoriesPerCycle(), 1000u );
+  FRENSIE_CHECK_EQUAL( default_properties.getShannonEntropyMeshBinsPerDimension(), 0u );
 
   MonteCarlo::SimulationNeutronProperties custom_properties;
 
@@ -200,6 +240,11 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( SimulationNeutronProperties,
   FRENSIE_CHECK( !custom_properties.isUnresolvedResonanceProbabilityTableModeOn() );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteThresholdWeight(), 1e-15 );
   FRENSIE_CHECK_EQUAL( custom_properties.getNeutronRouletteSurvivalWeight(), 1e-13 );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfInactiveCycles(), 10u );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfActiveCycles(), 50u );
+  FRENSIE_CHECK_EQUAL( custom_properties.getNumberOfHistoriesPerCycle(), 5000u );
+  FRENSIE_CHECK( custom_properties.isKEigenvalueModeOn() );
+  FRENSIE_CHECK_EQUAL( custom_properties.getShannonEntropyMeshBinsPerDimension(), 8u );
 }
 
 //---------------------------------------------------------------------------//
@@ -136,6 +136,8 @@ FRENSIE_UNIT_TEST( SimulationProperties, getMinParticleEnergy )
                        1e-4 );
   FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::AdjointElectronState>(),
                        1e-4 );
+  FRENSIE_CHECK_EQUAL( properties.getMinParticleEnergy<MonteCarlo::PositronState>(),
+                       1e-4 );
 }
 
 //---------------------------------------------------------------------------//
@@ -154,6 +156,8 @@ FRENSIE_UNIT_TEST( SimulationProperties, getMaxParticleEnergy )
                        20.0 );
   FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::AdjointElectronState>(),
                        20.0 );
+  FRENSIE_CHECK_EQUAL( properties.getMaxParticleEnergy<MonteCarlo::PositronState>(),
+                       20.0 );
 }
 
 //---------------------------------------------------------------------------//
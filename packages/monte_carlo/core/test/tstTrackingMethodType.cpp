@@ -0,0 +1,129 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstTrackingMethodType.cpp
+//! \author Alex Robinson
+//! \brief  Tracking method type helper unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_TrackingMethodType.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the tracking method types can be converted to int
+FRENSIE_UNIT_TEST( TrackingMethodType, convert_to_int )
+{
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::STANDARD_TRACKING, 0 );
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::ALTERNATIVE_TRACKING, 1 );
+  FRENSIE_CHECK_EQUAL( (unsigned)MonteCarlo::DELTA_TRACKING, 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a tracking method type can be converted to a string
+FRENSIE_UNIT_TEST( TrackingMethodType, toString )
+{
+  std::string type_string =
+    Utility::toString( MonteCarlo::STANDARD_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Standard Tracking" );
+
+  type_string = Utility::toString( MonteCarlo::ALTERNATIVE_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Alternative Tracking" );
+
+  type_string = Utility::toString( MonteCarlo::DELTA_TRACKING );
+
+  FRENSIE_CHECK_EQUAL( type_string, "Delta Tracking" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a tracking method type can be sent to a stream
+FRENSIE_UNIT_TEST( TrackingMethodType, stream_operator )
+{
+  std::stringstream ss;
+
+  ss << MonteCarlo::STANDARD_TRACKING;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Standard Tracking" );
+
+  ss.str( "" );
+  ss << MonteCarlo::ALTERNATIVE_TRACKING;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Alternative Tracking" );
+
+  ss.str( "" );
+  ss << MonteCarlo::DELTA_TRACKING;
+
+  FRENSIE_CHECK_EQUAL( ss.str(), "Delta Tracking" );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a tracking method type can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( TrackingMethodType,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_tracking_method_type" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::TrackingMethodType type_1 = MonteCarlo::STANDARD_TRACKING;
+    MonteCarlo::TrackingMethodType type_2 = MonteCarlo::ALTERNATIVE_TRACKING;
+    MonteCarlo::TrackingMethodType type_3 = MonteCarlo::DELTA_TRACKING;
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_1 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_2 ) );
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( type_3 ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived types
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::TrackingMethodType type_1;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_1 ) );
+  FRENSIE_CHECK_EQUAL( type_1, MonteCarlo::STANDARD_TRACKING );
+
+  MonteCarlo::TrackingMethodType type_2;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_2 ) );
+  FRENSIE_CHECK_EQUAL( type_2, MonteCarlo::ALTERNATIVE_TRACKING );
+
+  MonteCarlo::TrackingMethodType type_3;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( type_3 ) );
+  FRENSIE_CHECK_EQUAL( type_3, MonteCarlo::DELTA_TRACKING );
+}
+
+//---------------------------------------------------------------------------//
+// end tstTrackingMethodType.cpp
+//---------------------------------------------------------------------------//
@@ -41,16 +41,6 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
     // Set the dimension range method
     d_dimension_use_range_map[dimension] = range_dimension;
 
-    d_dimension_range_method_map[dimension].first =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-    
-    d_dimension_range_method_map[dimension].second =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-                                                             *discretization,
-                                                             range_dimension );
-
     // Calculate the index step size for the new dimension
     size_t dimension_index_step_size = 1;
 
@@ -64,6 +54,8 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
 
     // Add the dimension of the discretization to the dimension ordering array
     d_dimension_ordering.push_back( dimension );
+
+    this->compileDimensionPipeline();
   }
   else
   {
@@ -74,6 +66,48 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::assignDiscretizationToDimensi
   }
 }
 
+// Compile the dimension pipeline
+/*! \details The pipeline stores the discretization, index step size and
+ * range flag of each dimension contiguously (in the dimension ordering) so
+ * that the bin index calculations do not need to do any map lookups.
+ */
+void DetailedObserverPhaseSpaceDiscretizationImpl::compileDimensionPipeline()
+{
+  d_dimension_pipeline.resize( d_dimension_ordering.size() );
+
+  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
+  {
+    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+
+    DimensionStage& dimension_stage = d_dimension_pipeline[i];
+
+    dimension_stage.discretization =
+      d_dimension_discretization_map.find( dimension )->second.get();
+
+    dimension_stage.index_step_size =
+      d_dimension_index_step_size_map.find( dimension )->second;
+
+    dimension_stage.range_dimension =
+      d_dimension_use_range_map.find( dimension )->second;
+  }
+}
+
+// Get the thread local scratch bin index array
+auto DetailedObserverPhaseSpaceDiscretizationImpl::getThreadScratchBinIndexArray() -> BinIndexArray&
+{
+  thread_local BinIndexArray scratch_bin_indices;
+
+  return scratch_bin_indices;
+}
+
+// Get the thread local scratch bin index and weight array
+auto DetailedObserverPhaseSpaceDiscretizationImpl::getThreadScratchBinIndexWeightPairArray() -> BinIndexWeightPairArray&
+{
+  thread_local BinIndexWeightPairArray scratch_bin_indices_and_weights;
+
+  return scratch_bin_indices_and_weights;
+}
+
 // Get a dimension discretization
 const ObserverPhaseSpaceDimensionDiscretization&
 DetailedObserverPhaseSpaceDiscretizationImpl::getDimensionDiscretization(
@@ -260,10 +294,20 @@ bool DetailedObserverPhaseSpaceDiscretizationImpl::isValueInDimensionDiscretizat
 bool DetailedObserverPhaseSpaceDiscretizationImpl::doesRangeIntersectDiscretization(
              const ObserverParticleStateWrapper& particle_state_wrapper ) const
 {
-  for( auto dimension_range_method : d_dimension_range_method_map )
+  for( size_t i = 0; i < d_dimension_pipeline.size(); ++i )
   {
-    if( !dimension_range_method.second.first( particle_state_wrapper ) )
-      return false;
+    const DimensionStage& dimension_stage = d_dimension_pipeline[i];
+
+    if( dimension_stage.range_dimension )
+    {
+      if( !dimension_stage.discretization->doesRangeIntersectDiscretization( particle_state_wrapper ) )
+        return false;
+    }
+    else
+    {
+      if( !dimension_stage.discretization->isValueInDiscretization( particle_state_wrapper ) )
+        return false;
+    }
   }
 
   return true;
@@ -279,21 +323,18 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
+                                  const DimensionStage& dimension_stage,
                                   const DimensionValueMap& dimension_values,
                                   BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  const ObserverPhaseSpaceDimensionDiscretization&
-    dimension_discretization = *d_dimension_discretization_map.find( dimension )->second;
-
   const DimensionValueMap::mapped_type& dimension_value =
-    dimension_values.find( dimension )->second;
+    dimension_values.find( dimension_stage.discretization->getDimension() )->second;
 
-  dimension_discretization.calculateBinIndicesOfValue( dimension_value,
-                                                       local_bin_indices );
+  dimension_stage.discretization->calculateBinIndicesOfValue( dimension_value,
+                                                              local_bin_indices );
 }
   
 // Calculate the bin indices of a point
@@ -306,74 +347,92 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPoint(
 
 // Calculate the local bin indices of the value
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
+                   const DimensionStage& dimension_stage,
                    const ObserverParticleStateWrapper& particle_state_wrapper,
                    BinIndexArray& local_bin_indices ) const
 {
   // Clear the local bin indices
   local_bin_indices.clear();
 
-  d_dimension_discretization_map.find( dimension )->second->calculateBinIndicesOfValue( particle_state_wrapper, local_bin_indices );
+  dimension_stage.discretization->calculateBinIndicesOfValue( particle_state_wrapper, local_bin_indices );
+}
+
+// Calculate the local bin indices and weights of the range
+void DetailedObserverPhaseSpaceDiscretizationImpl::calculateLocalBinIndicesAndWeightsOfRange(
+              const DimensionStage& dimension_stage,
+              const ObserverParticleStateWrapper& particle_state_wrapper,
+              BinIndexWeightPairArray& local_bin_indices_and_weights ) const
+{
+  if( dimension_stage.range_dimension )
+  {
+    dimension_stage.discretization->calculateBinIndicesOfRange(
+                                               particle_state_wrapper,
+                                               local_bin_indices_and_weights );
+  }
+  else
+  {
+    dimension_stage.discretization->calculateBinIndicesOfValue(
+                                               particle_state_wrapper,
+                                               local_bin_indices_and_weights );
+  }
 }
 
 // Calculate the bin indices and weights of a range
+/*! \details The bin indices of the first dimension in the dimension ordering
+ * vary fastest. The local bin indices and weights are stored in a thread
+ * local scratch array so that no memory will be allocated once the scratch
+ * array and the bin indices and weights array have grown to their working
+ * size.
+ */
 void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesAndWeightsOfRange(
              const ObserverParticleStateWrapper& particle_state_wrapper,
              BinIndexWeightPairArray& bin_indices_and_weights ) const
 {
-  // Clear the bin indices array
+  BinIndexWeightPairArray& local_bin_indices_and_weights =
+    DetailedObserverPhaseSpaceDiscretizationImpl::getThreadScratchBinIndexWeightPairArray();
+
+  // Initialize the bin indices and weights array
   bin_indices_and_weights.resize( 1 );
   bin_indices_and_weights[0].first = 0;
   bin_indices_and_weights[0].second = 1.0;
 
-  BinIndexWeightPairArray previous_bin_indices_and_weights,
-    local_bin_indices_and_weights;
-
-  for( size_t i = 0; i < d_dimension_ordering.size(); ++i )
+  for( size_t d = 0; d < d_dimension_pipeline.size(); ++d )
   {
-    const ObserverPhaseSpaceDimension dimension = d_dimension_ordering[i];
+    const DimensionStage& dimension_stage = d_dimension_pipeline[d];
 
-    decltype(d_dimension_range_method_map)::const_iterator
-      dimension_range_method_it = d_dimension_range_method_map.find( dimension );
-    if( i != 0 )
-    {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                local_bin_indices_and_weights );
+    this->calculateLocalBinIndicesAndWeightsOfRange(
+                                             dimension_stage,
+                                             particle_state_wrapper,
+                                             local_bin_indices_and_weights );
+
+    const size_t number_of_previous_indices = bin_indices_and_weights.size();
 
-      const size_t dimension_index_step_size =
-        d_dimension_index_step_size_map.find( dimension )->second;
+    // Calculate the number of bins that have been intersected
+    bin_indices_and_weights.resize( number_of_previous_indices*
+                                    local_bin_indices_and_weights.size() );
 
-      // Cache the current bin indices
-      previous_bin_indices_and_weights = bin_indices_and_weights;
+    // Calculate the bin indices that have been intersected - the previous
+    // bin indices are stored at the front of the array so they must be
+    // overwritten last
+    for( size_t i = local_bin_indices_and_weights.size(); i > 0; --i )
+    {
+      const size_t index_shift = local_bin_indices_and_weights[i-1].first*
+        dimension_stage.index_step_size;
 
-      // Calculate the number of bins that have been intersected
-      bin_indices_and_weights.resize( previous_bin_indices_and_weights.size()*
-                                      local_bin_indices_and_weights.size() );
+      const double local_weight = local_bin_indices_and_weights[i-1].second;
 
-      // Calculate the bin indices that have been intersected
-      for( size_t i = 0; i < local_bin_indices_and_weights.size(); ++i )
+      for( size_t j = 0; j < number_of_previous_indices; ++j )
       {
-        for( size_t j = 0; j < previous_bin_indices_and_weights.size(); ++j )
-        {
-          BinIndexWeightPairArray::value_type& bin_index_and_weight =
-            bin_indices_and_weights[i*previous_bin_indices_and_weights.size()+j];
-          
-          bin_index_and_weight.first =
-            previous_bin_indices_and_weights[j].first +
-            local_bin_indices_and_weights[i].first*dimension_index_step_size;
-
-          bin_index_and_weight.second =
-            previous_bin_indices_and_weights[j].second*
-            local_bin_indices_and_weights[i].second;
-        }
+        BinIndexWeightPairArray::value_type& bin_index_and_weight =
+          bin_indices_and_weights[(i-1)*number_of_previous_indices+j];
+
+        bin_index_and_weight.second =
+          bin_indices_and_weights[j].second*local_weight;
+
+        bin_index_and_weight.first =
+          bin_indices_and_weights[j].first + index_shift;
       }
     }
-    // Initialize the bin indices and weights array
-    else
-    {
-      dimension_range_method_it->second.second( particle_state_wrapper,
-                                                bin_indices_and_weights );
-    }
   }
 
   // Make sure that the bin indices are valid
@@ -386,82 +445,27 @@ size_t DetailedObserverPhaseSpaceDiscretizationImpl::calculateDiscretizationInde
   // Test if the given vector is the same size as the number of dimensions discretized
   testPrecondition( dimension_bin_indices.size() == d_dimension_ordering.size() );
 
-  size_t discretization_index;
+  size_t discretization_index = 0;
 
-  std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>> ordered_dimension_bin_indices;
-
-  for(auto i = d_dimension_ordering.begin(); i < d_dimension_ordering.end(); ++i)
+  for( size_t i = 0; i < d_dimension_pipeline.size(); ++i )
   {
+    const DimensionStage& dimension_stage = d_dimension_pipeline[i];
+
+    auto dimension_bin_index_it =
+      dimension_bin_indices.find( dimension_stage.discretization->getDimension() );
+
     // Make sure dimension bin indices has the relevant discretized dimensions each time
-    TEST_FOR_EXCEPTION(dimension_bin_indices.find(*i) == dimension_bin_indices.end(), std::invalid_argument, "Dimension is not discretized for this observer.");
+    TEST_FOR_EXCEPTION(dimension_bin_index_it == dimension_bin_indices.end(), std::invalid_argument, "Dimension is not discretized for this observer.");
     // Make sure index isn't larger than the size of that discretized dimension index bounds
-    TEST_FOR_EXCEPTION(dimension_bin_indices.at(*i) > (d_dimension_discretization_map.at(*i))->getNumberOfBins()-1, std::invalid_argument, "Dimension index is out of bounds");
+    TEST_FOR_EXCEPTION(dimension_bin_index_it->second > dimension_stage.discretization->getNumberOfBins()-1, std::invalid_argument, "Dimension index is out of bounds");
 
-    ordered_dimension_bin_indices.push_back(std::make_pair(*i, dimension_bin_indices.at(*i)));
+    discretization_index +=
+      dimension_stage.index_step_size*dimension_bin_index_it->second;
   }
 
-  return this->calculateDiscretizationIndex(ordered_dimension_bin_indices);
-}
-
-// Same as above, but used by the code itself assuming the map is already in the same order as dimension order (private)
-size_t DetailedObserverPhaseSpaceDiscretizationImpl::calculateDiscretizationIndex( const std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>>& dimension_bin_indices ) const
-{
-  size_t discretization_index;
-  for(auto i = dimension_bin_indices.begin(); i != dimension_bin_indices.end(); ++i)
-  {
-    //std::cout << "Dimension being input: " << i->first << std::endl;
-    if( i == dimension_bin_indices.begin() )
-    {
-      discretization_index = i->second;
-    }
-    else
-    {
-      discretization_index = discretization_index + d_dimension_index_step_size_map.at(i->first)*i->second;
-    }
-  }
   return discretization_index;
 }
 
-// Create a range intersection method
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> RangeIntersectionMethod
-{
-  if( is_range_dimension )
-  {
-    return std::bind<bool>( &ObserverPhaseSpaceDimensionDiscretization::doesRangeIntersectDiscretization,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-  else
-  {
-    return std::bind<bool>( static_cast<bool(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&)const>(&ObserverPhaseSpaceDimensionDiscretization::isValueInDiscretization),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1 );
-  }
-}
-
-// Create a calculate range method object
-auto DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension ) -> CalculateLocalBinIndicesOfRangeMethod
-{
-  if( is_range_dimension )
-  {
-    return std::bind<void>( &ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfRange,
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
-  }
-  else
-  {
-    return std::bind<void>( static_cast<void(ObserverPhaseSpaceDimensionDiscretization::*)(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)const>(&ObserverPhaseSpaceDimensionDiscretization::calculateBinIndicesOfValue),
-                            std::cref(dimension_discretization),
-                            std::placeholders::_1,
-                            std::placeholders::_2 );
-  }
-}
-
 // Check if the dimension value map is valid
 bool DetailedObserverPhaseSpaceDiscretizationImpl::isDimensionValueMapValid(
                               const DimensionValueMap& dimension_values ) const
@@ -9,9 +9,6 @@
 #ifndef MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 #define MONTE_CARLO_DETAILED_OBSERVER_PHASE_SPACE_DISCRETIZATION_IMPL_HPP
 
-// Std Lib Includes
-#include <functional>
-
 // FRENSIE Includes
 #include "MonteCarlo_ObserverPhaseSpaceDiscretizationImpl.hpp"
 #include "MonteCarlo_ObserverPhaseSpaceDimensionDiscretization.hpp"
@@ -114,27 +111,32 @@ public:
              const ObserverParticleStateWrapper& particle_state_wrapper,
              BinIndexWeightPairArray& bin_indices_and_weights ) const override;
 
+  //! Calculate the discretization index from the dimension bin indices
   size_t calculateDiscretizationIndex( const std::unordered_map<ObserverPhaseSpaceDimension, size_t>& dimension_bin_indices) const override;
 
 private:
 
-  // The range intersects discretization method
-  typedef std::function<bool(const ObserverParticleStateWrapper&)> RangeIntersectionMethod;
+  // The compiled dimension stage used by the bin index calculations
+  struct DimensionStage
+  {
+    // The dimension discretization (owned by the discretization map)
+    const ObserverPhaseSpaceDimensionDiscretization* discretization;
 
-  // The calculate indices of range method type
-  typedef std::function<void(const ObserverParticleStateWrapper&,BinIndexWeightPairArray&)> CalculateLocalBinIndicesOfRangeMethod;
+    // The dimension index step size
+    size_t index_step_size;
 
-  size_t calculateDiscretizationIndex( const std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>>& dimension_bin_indices) const;
+    // Use the dimension range instead of the dimension value
+    bool range_dimension;
+  };
 
-  // Create a range intersection method
-  static RangeIntersectionMethod createRangeIntersectionMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
-  
-  // Create a calculate range method object
-  static CalculateLocalBinIndicesOfRangeMethod createCalculateRangeMethodObject(
-     const ObserverPhaseSpaceDimensionDiscretization& dimension_discretization,
-     const bool is_range_dimension );
+  // Compile the dimension pipeline
+  void compileDimensionPipeline();
+
+  // Get the thread local scratch bin index array
+  static BinIndexArray& getThreadScratchBinIndexArray();
+
+  // Get the thread local scratch bin index and weight array
+  static BinIndexWeightPairArray& getThreadScratchBinIndexWeightPairArray();
 
   // Check if the dimension value map is valid
   bool isDimensionValueMapValid(
@@ -170,15 +172,21 @@ private:
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                                  const ObserverPhaseSpaceDimension dimension,
+                                  const DimensionStage& dimension_stage,
                                   const DimensionValueMap& dimension_values,
                                   BinIndexArray& local_bin_indices ) const;
 
   // Calculate the local bin indices of the value
   void calculateLocalBinIndicesOfValue(
-                   const ObserverPhaseSpaceDimension dimension,
+                   const DimensionStage& dimension_stage,
                    const ObserverParticleStateWrapper& particle_state_wrapper,
                    BinIndexArray& local_bin_indices ) const;
+
+  // Calculate the local bin indices and weights of the range
+  void calculateLocalBinIndicesAndWeightsOfRange(
+              const DimensionStage& dimension_stage,
+              const ObserverParticleStateWrapper& particle_state_wrapper,
+              BinIndexWeightPairArray& local_bin_indices_and_weights ) const;
   
   // Save the data to an archive
   template<typename Archive>
@@ -201,16 +209,15 @@ private:
   std::map<ObserverPhaseSpaceDimension,bool>
   d_dimension_use_range_map;
 
-  // The observer phase space dimension range method map
-  std::map<ObserverPhaseSpaceDimension,std::pair<RangeIntersectionMethod,CalculateLocalBinIndicesOfRangeMethod> >
-  d_dimension_range_method_map;
-
   // The observer phase space dimension index step size map
   std::map<ObserverPhaseSpaceDimension,size_t>
   d_dimension_index_step_size_map;
 
   // The observer phase space dimension ordering
   std::vector<ObserverPhaseSpaceDimension> d_dimension_ordering;
+
+  // The compiled dimension pipeline (in the dimension ordering)
+  std::vector<DimensionStage> d_dimension_pipeline;
 };
 
 } // end MonteCarlo namespace
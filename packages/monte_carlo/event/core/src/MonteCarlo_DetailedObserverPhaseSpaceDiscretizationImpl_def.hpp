@@ -17,9 +17,9 @@ template<typename DimensionValueContainer>
 inline bool DetailedObserverPhaseSpaceDiscretizationImpl::isPointInDiscretizationImpl(
                const DimensionValueContainer& dimension_value_container ) const
 {
-  for( auto dimension : d_dimension_discretization_map )
+  for( size_t i = 0; i < d_dimension_pipeline.size(); ++i )
   {
-    if( !this->isValueInDimensionDiscretization( *dimension.second, dimension_value_container ) )
+    if( !this->isValueInDimensionDiscretization( *d_dimension_pipeline[i].discretization, dimension_value_container ) )
       return false;
   }
 
@@ -27,57 +27,49 @@ inline bool DetailedObserverPhaseSpaceDiscretizationImpl::isPointInDiscretizatio
 }
 
 // Calculate the local bin indices of the point (implementation)
+/*! \details The bin indices of every combination of local dimension bin
+ * indices will be calculated. The bin indices of the first dimension in the
+ * dimension ordering vary fastest. The local bin indices are stored in a
+ * thread local scratch array so that no memory will be allocated once the
+ * scratch array and the bin indices array have grown to their working size.
+ */
 template<typename DimensionValueContainer>
 inline void DetailedObserverPhaseSpaceDiscretizationImpl::calculateBinIndicesOfPointImpl(
                       const DimensionValueContainer& dimension_value_container,
                       BinIndexArray& bin_indices ) const
 {
+  BinIndexArray& local_bin_indices =
+    DetailedObserverPhaseSpaceDiscretizationImpl::getThreadScratchBinIndexArray();
 
-  // BinIndexArray is just a vector of size_t
-  BinIndexArray local_bin_indices;
-  std::vector<std::pair<ObserverPhaseSpaceDimension, BinIndexArray>> index_array_of_pairs;
+  bin_indices.assign( 1, 0 );
 
-  size_t number_of_indices = 1;
-  for( auto i = d_dimension_ordering.begin(); i < d_dimension_ordering.end(); ++i )
+  for( size_t d = 0; d < d_dimension_pipeline.size(); ++d )
   {
-    // Calculate the local bin indices for a dimension
-    this->calculateLocalBinIndicesOfValue(  *i,
-                                            dimension_value_container,
-                                            local_bin_indices );
-    
-    // Put each vector of indices for a dimension into the index array map
-    index_array_of_pairs.push_back(std::make_pair(*i, local_bin_indices));
-    // Multiply the number of indices by the local bin size such that it grows with the number of combinations of indices given
-    number_of_indices = number_of_indices*local_bin_indices.size();
-  }
+    const DimensionStage& dimension_stage = d_dimension_pipeline[d];
 
-  bin_indices.resize(number_of_indices);
+    // Calculate the local bin indices for the dimension
+    this->calculateLocalBinIndicesOfValue( dimension_stage,
+                                           dimension_value_container,
+                                           local_bin_indices );
 
-  /* Complicated loop that goes through the map created and calculates the index of every combination of bin indices.
-   * Outer loop loops through the bin index vector.
-   */
-  std::vector<std::pair<ObserverPhaseSpaceDimension, size_t>> temp_index_vector;
-  for(auto i = bin_indices.begin(); i < bin_indices.end(); ++i)
-  {
-    bool pop_completed = false;
-    /* Second loop takes the first elements of each vector combined with its respective dimension and places that into the temporary map.
-     * If the size of the vector was greater than zero, the first vector encountered with a size greater than zero is deleted. Each combination of
-     * indices is only needed once, so deleting one of the elements ensures that a new combination is presented every time and that no combination is missed.
-     */
-    for(auto j = index_array_of_pairs.begin(); j != index_array_of_pairs.end(); ++j)
+    const size_t number_of_previous_indices = bin_indices.size();
+
+    bin_indices.resize( number_of_previous_indices*local_bin_indices.size() );
+
+    // Combine the local bin indices with the previous bin indices - the
+    // previous bin indices are stored at the front of the array so they must
+    // be overwritten last
+    for( size_t i = local_bin_indices.size(); i > 0; --i )
     {
-      temp_index_vector.push_back(std::make_pair(j->first, j->second[0]));
-      if(!pop_completed)
+      const size_t index_shift =
+        local_bin_indices[i-1]*dimension_stage.index_step_size;
+
+      for( size_t j = 0; j < number_of_previous_indices; ++j )
       {
-        if(j->second.size() > 1)
-        {
-          j->second.erase(j->second.begin());
-          pop_completed = true;
-        }
+        bin_indices[(i-1)*number_of_previous_indices+j] =
+          bin_indices[j] + index_shift;
       }
     }
-    *i = this->calculateDiscretizationIndex(temp_index_vector);
-    temp_index_vector.clear();
   }
 
   // Make sure that the bin indices are valid
@@ -111,19 +103,8 @@ void DetailedObserverPhaseSpaceDiscretizationImpl::load( Archive& ar, const unsi
   ar & BOOST_SERIALIZATION_NVP( d_dimension_index_step_size_map );
   ar & BOOST_SERIALIZATION_NVP( d_dimension_ordering );
 
-  // Initialize the dimension range method map
-  for( auto dimension : d_dimension_use_range_map )
-  {
-    d_dimension_range_method_map[dimension.first].first =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createRangeIntersectionMethodObject(
-                              *d_dimension_discretization_map[dimension.first],
-                              dimension.second );
-    
-    d_dimension_range_method_map[dimension.first].second =
-      DetailedObserverPhaseSpaceDiscretizationImpl::createCalculateRangeMethodObject(
-                              *d_dimension_discretization_map[dimension.first],
-                              dimension.second );
-  }
+  // Compile the dimension pipeline
+  this->compileDimensionPipeline();
 }
   
 } // end MonteCarlo namespace
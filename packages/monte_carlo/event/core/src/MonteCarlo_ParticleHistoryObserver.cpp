@@ -49,6 +49,26 @@ double ParticleHistoryObserver::getElapsedTime()
   return s_elapsed_time;
 }
 
+// Accumulate the thread data locally until it is explicitly merged
+/*! \details The default implementation does nothing (the observer data is
+ * always shared by the threads).
+ */
+void ParticleHistoryObserver::enableThreadLocalDataAccumulation()
+{ /* ... */ }
+
+// Merge the locally accumulated thread data in history order
+/*! \details The default implementation does nothing (the observer data
+ * does not depend on the order in which it is merged).
+ */
+void ParticleHistoryObserver::enableHistoryOrderedThreadLocalDataMerge()
+{ /* ... */ }
+
+// Merge the locally accumulated thread data
+/*! \details The default implementation does nothing.
+ */
+void ParticleHistoryObserver::mergeThreadLocalData()
+{ /* ... */ }
+
 // Log a summary of the data
 void ParticleHistoryObserver::logSummary() const
 {
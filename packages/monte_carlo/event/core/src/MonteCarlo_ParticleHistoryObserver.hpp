@@ -50,6 +50,15 @@ public:
   //! Enable support for multiple threads
   virtual void enableThreadSupport( const unsigned num_threads ) = 0;
 
+  //! Accumulate the thread data locally until it is explicitly merged
+  virtual void enableThreadLocalDataAccumulation();
+
+  //! Merge the locally accumulated thread data in history order
+  virtual void enableHistoryOrderedThreadLocalDataMerge();
+
+  //! Merge the locally accumulated thread data
+  virtual void mergeThreadLocalData();
+
   //! Check if the observer has uncommitted history contributions
   virtual bool hasUncommittedHistoryContribution() const = 0;
 
@@ -26,6 +26,25 @@
 
 typedef TestArchiveHelper::TestArchives TestArchives;
 
+//---------------------------------------------------------------------------//
+// Testing Classes
+//---------------------------------------------------------------------------//
+
+// An unordered collision number discretization (bins may overlap)
+class TestUnorderedCollisionNumberDimensionDiscretization : public MonteCarlo::UnorderedTypedObserverPhaseSpaceDimensionDiscretization<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION>
+{
+  typedef MonteCarlo::UnorderedTypedObserverPhaseSpaceDimensionDiscretization<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION> BaseType;
+
+public:
+
+  TestUnorderedCollisionNumberDimensionDiscretization( const BaseType::BinSetArray& data )
+    : BaseType( data )
+  { /* ... */ }
+
+  ~TestUnorderedCollisionNumberDimensionDiscretization()
+  { /* ... */ }
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -2639,6 +2658,137 @@ FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization, print )
                  oss.str().size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the bin index arrays can be reused without reallocation
+FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
+                   calculateBinIndicesOfPoint_reuse_array )
+{
+  MonteCarlo::ObserverPhaseSpaceDiscretization phase_space_discretization;
+
+  phase_space_discretization.assignDiscretizationToDimension( energy_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( cosine_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( source_id_dimension_discretization );
+
+  typedef MonteCarlo::ObserverPhaseSpaceDimensionTraits<MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION> SIDT;
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::DimensionValueMap
+    phase_space_point;
+
+  phase_space_point[MonteCarlo::OBSERVER_ENERGY_DIMENSION] =
+    boost::any( 5e-5 );
+  phase_space_point[MonteCarlo::OBSERVER_COSINE_DIMENSION] =
+    boost::any( 0.0 );
+  phase_space_point[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] =
+    boost::any( (SIDT::dimensionType)1 );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::BinIndexArray bin_indices;
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 13 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 22 );
+
+  const size_t* bin_indices_data = bin_indices.data();
+
+  phase_space_point[MonteCarlo::OBSERVER_ENERGY_DIMENSION] =
+    boost::any( 5e-4 );
+  phase_space_point[MonteCarlo::OBSERVER_COSINE_DIMENSION] =
+    boost::any( 0.5 );
+  phase_space_point[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] =
+    boost::any( (SIDT::dimensionType)0 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 8 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 17 );
+  FRENSIE_CHECK_EQUAL( bin_indices.data(), bin_indices_data );
+}
+
+//---------------------------------------------------------------------------//
+// Check that every combination of bin indices is calculated when more than
+// one dimension returns several bins
+FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization,
+                   calculateBinIndicesOfPoint_multiple_multi_bin_dimensions )
+{
+  // Collision number bins: {0,1}, {1,2}, {2,3}
+  TestUnorderedCollisionNumberDimensionDiscretization::BinSetArray
+    collision_number_bins( 3 );
+
+  collision_number_bins[0].insert( 0 );
+  collision_number_bins[0].insert( 1 );
+
+  collision_number_bins[1].insert( 1 );
+  collision_number_bins[1].insert( 2 );
+
+  collision_number_bins[2].insert( 2 );
+  collision_number_bins[2].insert( 3 );
+
+  std::shared_ptr<const MonteCarlo::ObserverPhaseSpaceDimensionDiscretization>
+    unordered_collision_number_dimension_discretization( new TestUnorderedCollisionNumberDimensionDiscretization( collision_number_bins ) );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization phase_space_discretization;
+
+  phase_space_discretization.assignDiscretizationToDimension( energy_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( source_id_dimension_discretization );
+  phase_space_discretization.assignDiscretizationToDimension( unordered_collision_number_dimension_discretization );
+
+  FRENSIE_REQUIRE_EQUAL( phase_space_discretization.getNumberOfBins(), 27 );
+
+  typedef MonteCarlo::ObserverPhaseSpaceDimensionTraits<MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION> SIDT;
+  typedef MonteCarlo::ObserverPhaseSpaceDimensionTraits<MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION> CNDT;
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::DimensionValueMap
+    phase_space_point;
+
+  // Source id 1 falls in bins 1 and 2, collision number 2 falls in bins 1
+  // and 2
+  phase_space_point[MonteCarlo::OBSERVER_ENERGY_DIMENSION] =
+    boost::any( 5e-5 );
+  phase_space_point[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] =
+    boost::any( (SIDT::dimensionType)1 );
+  phase_space_point[MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION] =
+    boost::any( (CNDT::dimensionType)2 );
+
+  MonteCarlo::ObserverPhaseSpaceDiscretization::BinIndexArray bin_indices;
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 4 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 1 + 3*1 + 9*1 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 1 + 3*2 + 9*1 );
+  FRENSIE_CHECK_EQUAL( bin_indices[2], 1 + 3*1 + 9*2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[3], 1 + 3*2 + 9*2 );
+
+  // Source id 0 falls in bins 0 and 1, collision number 1 falls in bins 0
+  // and 1, energy 5e-4 falls in bin 2
+  phase_space_point[MonteCarlo::OBSERVER_ENERGY_DIMENSION] =
+    boost::any( 5e-4 );
+  phase_space_point[MonteCarlo::OBSERVER_SOURCE_ID_DIMENSION] =
+    boost::any( (SIDT::dimensionType)0 );
+  phase_space_point[MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION] =
+    boost::any( (CNDT::dimensionType)1 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 4 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 2 + 3*0 + 9*0 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 2 + 3*1 + 9*0 );
+  FRENSIE_CHECK_EQUAL( bin_indices[2], 2 + 3*0 + 9*1 );
+  FRENSIE_CHECK_EQUAL( bin_indices[3], 2 + 3*1 + 9*1 );
+
+  // Collision number 3 only falls in bin 2
+  phase_space_point[MonteCarlo::OBSERVER_COLLISION_NUMBER_DIMENSION] =
+    boost::any( (CNDT::dimensionType)3 );
+
+  phase_space_discretization.calculateBinIndicesOfPoint( phase_space_point, bin_indices );
+
+  FRENSIE_REQUIRE_EQUAL( bin_indices.size(), 2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[0], 2 + 3*0 + 9*2 );
+  FRENSIE_CHECK_EQUAL( bin_indices[1], 2 + 3*1 + 9*2 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a discretization index can be calculated from individual dimension bin indices.
 FRENSIE_UNIT_TEST( ObserverPhaseSpaceDiscretization, calculateBinIndex )
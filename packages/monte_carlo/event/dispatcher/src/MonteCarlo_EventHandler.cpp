@@ -467,6 +467,31 @@ const Estimator& EventHandler::getEstimator( const uint32_t estimator_id ) const
   return *d_estimators.find( estimator_id )->second;
 }
 
+// Check if any cell track-length or surface estimators score the type
+/*! \details These estimators only receive contributions when a particle is
+ * surface tracked (subtracks ending in a cell and surface crossings are not
+ * resolved by delta tracking).
+ */
+bool EventHandler::hasSurfaceTrackingEstimators(
+                                   const ParticleType particle_type ) const
+{
+  EstimatorIdMap::const_iterator estimator_it = d_estimators.begin();
+
+  while( estimator_it != d_estimators.end() )
+  {
+    if( estimator_it->second->isParticleTypeAssigned( particle_type ) )
+    {
+      if( estimator_it->second->isSurfaceEstimator() ||
+          dynamic_cast<const ParticleSubtrackEndingInCellEventObserver*>( estimator_it->second.get() ) )
+        return true;
+    }
+    
+    ++estimator_it;
+  }
+
+  return false;
+}
+
 // Check if a particle tracker with the given id exists
 bool EventHandler::doesParticleTrackerExist( const uint32_t particle_tracker_id ) const
 {
@@ -512,6 +537,10 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
   {
     (*it)->enableThreadSupport( num_threads );
 
+    // The thread data will be merged explicitly by the handler
+    if( num_threads > 1 )
+      (*it)->enableThreadLocalDataAccumulation();
+
     ++it;
   }
 
@@ -519,6 +548,23 @@ void EventHandler::enableThreadSupport( const unsigned num_threads )
   d_number_of_committed_histories_from_last_snapshot.resize( num_threads, 0 );
 }
 
+// Set the model used to build the cell event dispatcher index tables
+/*! \details Once set, the cell event dispatchers can be looked up directly
+ * from the cell index stored in the particle's navigator instead of hashing
+ * the cell id on every event. The model must be initialized.
+ */
+void EventHandler::setCellIndexModel(
+                         const std::shared_ptr<const Geometry::Model>& model )
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  this->getParticleEnteringCellEventDispatcher().setCellIndexModel( model );
+  this->getParticleLeavingCellEventDispatcher().setCellIndexModel( model );
+  this->getParticleCollidingInCellEventDispatcher().setCellIndexModel( model );
+  this->getParticleSubtrackEndingInCellEventDispatcher().setCellIndexModel( model );
+}
+
 // Update observers from particle simulation started event
 void EventHandler::updateObserversFromParticleSimulationStartedEvent()
 {
@@ -536,6 +582,8 @@ void EventHandler::updateObserversFromParticleSimulationStoppedEvent()
 
   ParticleHistoryObserver::setElapsedTime( this->getElapsedTime() );
   ParticleHistoryObserver::setNumberOfHistories( this->getNumberOfCommittedHistories() );
+
+  this->mergeObserverThreadLocalData();
 }
 
 // Commit the estimator history contributions
@@ -556,6 +604,52 @@ void EventHandler::commitObserverHistoryContributions()
   ++d_number_of_committed_histories_from_last_snapshot[Utility::OpenMPProperties::getThreadId()];
 }
 
+// Merge the observer data accumulated locally by each thread
+/*! \details Once thread support has been enabled for more than one thread,
+ * the observers accumulate the thread data locally. This method must be
+ * called (outside of a parallel block) before the observer data is
+ * requested or archived. It is called automatically when the simulation
+ * stops, when a snapshot is taken and when the data is reduced.
+ */
+void EventHandler::mergeObserverThreadLocalData()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  ParticleHistoryObservers::iterator it =
+    d_particle_history_observers.begin();
+
+  while( it != d_particle_history_observers.end() )
+  {
+    (*it)->mergeThreadLocalData();
+
+    ++it;
+  }
+}
+
+// Merge the observer data accumulated locally in history order
+/*! \details The merged observer data will be bit-identical to the data from
+ * a serial run, regardless of the number of threads and the history
+ * schedule, but the merge will be serial and the observers will store every
+ * history contribution until it is merged. This should be called after
+ * thread support has been enabled.
+ */
+void EventHandler::enableHistoryOrderedObserverThreadLocalDataMerge()
+{
+  // Make sure only the master thread calls this function
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  ParticleHistoryObservers::iterator it =
+    d_particle_history_observers.begin();
+
+  while( it != d_particle_history_observers.end() )
+  {
+    (*it)->enableHistoryOrderedThreadLocalDataMerge();
+
+    ++it;
+  }
+}
+
 // Take a snapshot of the observer states
 void EventHandler::takeSnapshotOfObserverStates()
 {
@@ -568,6 +662,9 @@ void EventHandler::takeSnapshotOfObserverStates()
   uint64_t num_additional_histories =
     this->getNumberOfCommittedHistoriesSinceLastSnapshot();
 
+  // The snapshots must include the data accumulated by every thread
+  this->mergeObserverThreadLocalData();
+
   ParticleHistoryObservers::iterator it =
     d_particle_history_observers.begin();
   
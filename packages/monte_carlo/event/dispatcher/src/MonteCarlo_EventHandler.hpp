@@ -109,6 +109,9 @@ public:
   //! Return the estimator
   const Estimator& getEstimator( const Estimator::Id estimator_id ) const;
 
+  //! Check if any cell track-length or surface estimators score the type
+  bool hasSurfaceTrackingEstimators( const ParticleType particle_type ) const;
+
   //! Check if a particle tracker with the given id exists
   bool doesParticleTrackerExist( const ParticleTracker::Id particle_tracker_id ) const;
 
@@ -121,6 +124,9 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads );
 
+  //! Set the model used to build the cell event dispatcher index tables
+  void setCellIndexModel( const std::shared_ptr<const Geometry::Model>& model );
+
   //! Update observers from particle simulation started event
   void updateObserversFromParticleSimulationStartedEvent();
 
@@ -133,6 +139,12 @@ public:
   //! Take a snapshot of the observer states
   void takeSnapshotOfObserverStates();
 
+  //! Merge the observer data accumulated locally by each thread
+  void mergeObserverThreadLocalData();
+
+  //! Merge the observer data accumulated locally in history order
+  void enableHistoryOrderedObserverThreadLocalDataMerge();
+
   //! Print the observer summaries
   void printObserverSummaries( std::ostream& os ) const;
 
@@ -31,6 +31,37 @@ void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEven
   }
 }
 
+// Dispatch the particle colliding in cell event to the observers
+/*! \details When a cell index model has been set the local dispatcher will
+ * be found with the cell index. Otherwise the cell id will be used.
+ */
+void ParticleCollidingInCellEventDispatcher::dispatchParticleCollidingInCellEvent(
+                             const ParticleState& particle,
+                             const Geometry::Model::EntityId cell_of_collision,
+                             const size_t cell_of_collision_index,
+                             const double inverse_total_cross_section )
+{
+  if( this->hasCellIndexTable() )
+  {
+    ParticleCollidingInCellEventLocalDispatcher* local_dispatcher =
+      this->getLocalDispatcherAtCellIndex( cell_of_collision_index );
+
+    if( local_dispatcher )
+    {
+      local_dispatcher->dispatchParticleCollidingInCellEvent(
+                                                 particle,
+                                                 cell_of_collision,
+                                                 inverse_total_cross_section );
+    }
+  }
+  else
+  {
+    this->dispatchParticleCollidingInCellEvent( particle,
+                                                cell_of_collision,
+                                                inverse_total_cross_section );
+  }
+}
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::ParticleCollidingInCellEventDispatcher );
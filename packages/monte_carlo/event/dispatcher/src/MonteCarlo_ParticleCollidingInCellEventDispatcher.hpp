@@ -38,6 +38,13 @@ public:
 	                     const Geometry::Model::EntityId cell_of_collision,
                              const double inverse_total_cross_section );
 
+  //! Dispatch the particle colliding in cell event to the observers
+  void dispatchParticleCollidingInCellEvent(
+                             const ParticleState& particle,
+	                     const Geometry::Model::EntityId cell_of_collision,
+                             const size_t cell_of_collision_index,
+                             const double inverse_total_cross_section );
+
 private:
 
   // Serialize the observer
@@ -32,14 +32,28 @@ ParticleCollidingInCellEventHandler::getParticleCollidingInCellEventDispatcher()
 }
 
 // Update the observers from a particle colliding in cell event
+/*! \details The particle's cell index will be used to find the observers
+ * when a cell index model has been set.
+ */
 void ParticleCollidingInCellEventHandler::updateObserversFromParticleCollidingInCellEvent(
                                     const ParticleState& particle,
                                     const double inverse_total_cross_section )
 {
-  d_particle_colliding_in_cell_event_dispatcher.dispatchParticleCollidingInCellEvent(
+  if( d_particle_colliding_in_cell_event_dispatcher.hasCellIndexTable() )
+  {
+    d_particle_colliding_in_cell_event_dispatcher.dispatchParticleCollidingInCellEvent(
 						 particle,
 						 particle.getCell(),
+                                                 particle.getCellIndex(),
 						 inverse_total_cross_section );
+  }
+  else
+  {
+    d_particle_colliding_in_cell_event_dispatcher.dispatchParticleCollidingInCellEvent(
+						 particle,
+						 particle.getCell(),
+						 inverse_total_cross_section );
+  }
 }
 
 } // end MonteCarlo namespace
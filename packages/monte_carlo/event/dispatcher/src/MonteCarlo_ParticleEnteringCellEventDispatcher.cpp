@@ -23,6 +23,27 @@ void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
   if( it != this->getDispatcherMap().end() )
     it->second->dispatchParticleEnteringCellEvent( particle, cell_entering );
 }
+
+// Dispatch the particle entering cell event to the observers
+/*! \details When a cell index model has been set the local dispatcher will
+ * be found with the cell index. Otherwise the cell id will be used.
+ */
+void ParticleEnteringCellEventDispatcher::dispatchParticleEnteringCellEvent(
+                                const ParticleState& particle,
+                                const Geometry::Model::EntityId cell_entering,
+                                const size_t cell_entering_index )
+{
+  if( this->hasCellIndexTable() )
+  {
+    ParticleEnteringCellEventLocalDispatcher* local_dispatcher =
+      this->getLocalDispatcherAtCellIndex( cell_entering_index );
+
+    if( local_dispatcher )
+      local_dispatcher->dispatchParticleEnteringCellEvent( particle, cell_entering );
+  }
+  else
+    this->dispatchParticleEnteringCellEvent( particle, cell_entering );
+}
   
 } // end MonteCarlo namespace
 
@@ -37,6 +37,12 @@ public:
                                const ParticleState& particle,
                                const Geometry::Model::EntityId cell_entering );
 
+  //! Dispatch the particle entering cell event to the observers
+  void dispatchParticleEnteringCellEvent(
+                               const ParticleState& particle,
+                               const Geometry::Model::EntityId cell_entering,
+                               const size_t cell_entering_index );
+
 private:
 
   // Serialize the observer
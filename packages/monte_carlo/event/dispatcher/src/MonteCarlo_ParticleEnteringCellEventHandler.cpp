@@ -41,6 +41,21 @@ void ParticleEnteringCellEventHandler::updateObserversFromParticleEnteringCellEv
                                                                cell_entering );
 }
 
+// Update the observers from a particle entering cell event
+/*! \details The cell index must be the one that the cell index model (if
+ * one has been set) assigns to the cell.
+ */
+void ParticleEnteringCellEventHandler::updateObserversFromParticleEnteringCellEvent(
+              const ParticleState& particle,
+              const Geometry::Model::EntityId cell_entering,
+              const size_t cell_entering_index )
+{
+  d_particle_entering_cell_event_dispatcher.dispatchParticleEnteringCellEvent(
+                                                         particle,
+                                                         cell_entering,
+                                                         cell_entering_index );
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleEnteringCellEventHandler );
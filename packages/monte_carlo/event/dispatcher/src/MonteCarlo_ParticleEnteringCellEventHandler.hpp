@@ -50,6 +50,12 @@ public:
                                const ParticleState& particle,
                                const Geometry::Model::EntityId cell_entering );
 
+  //! Update the observers from a particle entering cell event
+  void updateObserversFromParticleEnteringCellEvent(
+                               const ParticleState& particle,
+                               const Geometry::Model::EntityId cell_entering,
+                               const size_t cell_entering_index );
+
 protected:
 
   /*! \brief Register an observer with the appropriate particle entering cell
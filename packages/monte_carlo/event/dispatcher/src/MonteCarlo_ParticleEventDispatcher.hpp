@@ -11,6 +11,7 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
 
 // Boost Includes
 #include <boost/serialization/split_member.hpp>
@@ -22,7 +23,9 @@
 // FRENSIE Includes
 #include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
 #include "Utility_SerializationHelpers.hpp"
+#include "Geometry_Model.hpp"
 #include "Utility_Map.hpp"
+#include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
 
@@ -64,6 +67,15 @@ public:
   //! Detach all observers
   void detachAllObservers();
 
+  //! Set the model used to look up the local dispatchers by cell index
+  void setCellIndexModel( const std::shared_ptr<const Geometry::Model>& model );
+
+  //! Check if the local dispatchers can be looked up by cell index
+  bool hasCellIndexTable() const;
+
+  //! Get the local dispatcher for the given cell index (nullptr if none)
+  Dispatcher* getLocalDispatcherAtCellIndex( const size_t cell_index ) const;
+
 protected:
 
   // Typedef for the dispatcher map
@@ -75,6 +87,12 @@ protected:
 
 private:
 
+  // Add a local dispatcher to the cell index table
+  void addToCellIndexTable( const uint64_t entity_id, Dispatcher& dispatcher );
+
+  // Rebuild the cell index table
+  void rebuildCellIndexTable();
+
   // Serialize the observer
   template<typename Archive>
   void serialize( Archive& ar, const unsigned version );
@@ -83,6 +101,13 @@ private:
   friend class boost::serialization::access;
 
   DispatcherMap d_dispatcher_map;
+
+  // The model used to look up the local dispatchers by cell index
+  // Note: the model and the table are not archived
+  std::shared_ptr<const Geometry::Model> d_cell_index_model;
+
+  // The local dispatchers (non-owning) at each cell index
+  std::vector<Dispatcher*> d_cell_index_table;
 };
 
 } // end MonteCarlo namespace
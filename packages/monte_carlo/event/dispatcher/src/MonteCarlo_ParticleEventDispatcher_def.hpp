@@ -14,7 +14,9 @@ namespace MonteCarlo{
 // Constructor
 template<typename Dispatcher>
 ParticleEventDispatcher<Dispatcher>::ParticleEventDispatcher()
-  : d_dispatcher_map()
+  : d_dispatcher_map(),
+    d_cell_index_model(),
+    d_cell_index_table()
 { /* ... */ }
 
 // Get the appropriate local dispatcher for the given entity id
@@ -33,6 +35,8 @@ inline Dispatcher& ParticleEventDispatcher<Dispatcher>::getLocalDispatcher(
 
     new_dispatcher.reset( new Dispatcher( entity_id ) );
 
+    this->addToCellIndexTable( entity_id, *new_dispatcher );
+
     return *new_dispatcher;
   }
 }
@@ -86,6 +90,84 @@ template<typename Dispatcher>
 void ParticleEventDispatcher<Dispatcher>::detachAllObservers()
 {
   d_dispatcher_map.clear();
+
+  this->rebuildCellIndexTable();
+}
+
+// Set the model used to look up the local dispatchers by cell index
+/*! \details The dispatcher map is keyed by entity id and is the one that
+ * gets archived. Once a model has been set, a dense table of the local
+ * dispatchers is also kept (one entry per cell index of the model) so that
+ * the dispatchers can be found without hashing the cell id of every event.
+ * Passing a null model removes the table.
+ */
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::setCellIndexModel(
+                         const std::shared_ptr<const Geometry::Model>& model )
+{
+  d_cell_index_model = model;
+
+  this->rebuildCellIndexTable();
+}
+
+// Check if the local dispatchers can be looked up by cell index
+template<typename Dispatcher>
+inline bool ParticleEventDispatcher<Dispatcher>::hasCellIndexTable() const
+{
+  return d_cell_index_model.get() != nullptr;
+}
+
+// Get the local dispatcher for the given cell index (nullptr if none)
+template<typename Dispatcher>
+inline Dispatcher* ParticleEventDispatcher<Dispatcher>::getLocalDispatcherAtCellIndex(
+                                                const size_t cell_index ) const
+{
+  // Make sure that the cell index table exists
+  testPrecondition( this->hasCellIndexTable() );
+  // Make sure that the cell index is valid
+  testPrecondition( cell_index < d_cell_index_table.size() );
+
+  return d_cell_index_table[cell_index];
+}
+
+// Add a local dispatcher to the cell index table
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::addToCellIndexTable(
+                                                     const uint64_t entity_id,
+                                                     Dispatcher& dispatcher )
+{
+  // Entities that are not cells of the model can never be dispatched to
+  // through the table
+  if( d_cell_index_model )
+  {
+    if( d_cell_index_model->doesCellExist( entity_id ) )
+    {
+      d_cell_index_table[d_cell_index_model->getCellIndex( entity_id )] =
+        &dispatcher;
+    }
+  }
+}
+
+// Rebuild the cell index table
+template<typename Dispatcher>
+void ParticleEventDispatcher<Dispatcher>::rebuildCellIndexTable()
+{
+  d_cell_index_table.clear();
+
+  if( d_cell_index_model )
+  {
+    d_cell_index_table.resize( d_cell_index_model->getNumberOfCellIndices(),
+                               nullptr );
+
+    typename DispatcherMap::iterator it = d_dispatcher_map.begin();
+
+    while( it != d_dispatcher_map.end() )
+    {
+      this->addToCellIndexTable( it->first, *it->second );
+
+      ++it;
+    }
+  }
 }
 
 // Get the dispatcher map
@@ -101,6 +183,10 @@ template<typename Archive>
 void ParticleEventDispatcher<Dispatcher>::serialize( Archive& ar, const unsigned version )
 {
   ar & BOOST_SERIALIZATION_NVP( d_dispatcher_map );
+
+  // The loaded local dispatchers replace any that were in the table
+  if( Archive::is_loading::value )
+    this->rebuildCellIndexTable();
 }
 
 } // end MonteCarlo namespace
@@ -23,6 +23,27 @@ void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
   if( it != this->getDispatcherMap().end() )
     it->second->dispatchParticleLeavingCellEvent( particle, cell_leaving );
 }
+
+// Dispatch the particle leaving cell event to the observers
+/*! \details When a cell index model has been set the local dispatcher will
+ * be found with the cell index. Otherwise the cell id will be used.
+ */
+void ParticleLeavingCellEventDispatcher::dispatchParticleLeavingCellEvent(
+                                 const ParticleState& particle,
+	                         const Geometry::Model::EntityId cell_leaving,
+                                 const size_t cell_leaving_index )
+{
+  if( this->hasCellIndexTable() )
+  {
+    ParticleLeavingCellEventLocalDispatcher* local_dispatcher =
+      this->getLocalDispatcherAtCellIndex( cell_leaving_index );
+
+    if( local_dispatcher )
+      local_dispatcher->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+  }
+  else
+    this->dispatchParticleLeavingCellEvent( particle, cell_leaving );
+}
   
 } // end MonteCarlo namespace
 
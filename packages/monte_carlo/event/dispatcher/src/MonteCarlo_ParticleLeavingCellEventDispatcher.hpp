@@ -37,6 +37,12 @@ public:
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_leaving );
 
+  //! Dispatch the particle leaving cell event to the observers
+  void dispatchParticleLeavingCellEvent(
+                                const ParticleState& particle,
+                                const Geometry::Model::EntityId cell_leaving,
+                                const size_t cell_leaving_index );
+
 private:
 
   // Serialize the observer
@@ -41,6 +41,21 @@ void ParticleLeavingCellEventHandler::updateObserversFromParticleLeavingCellEven
                                                                 cell_leaving );
 }
 
+// Update the observers from a particle leaving cell event
+/*! \details The cell index must be the one that the cell index model (if
+ * one has been set) assigns to the cell.
+ */
+void ParticleLeavingCellEventHandler::updateObserversFromParticleLeavingCellEvent(
+               const ParticleState& particle,
+               const Geometry::Model::EntityId cell_leaving,
+               const size_t cell_leaving_index )
+{
+  d_particle_leaving_cell_event_dispatcher.dispatchParticleLeavingCellEvent(
+                                                          particle,
+                                                          cell_leaving,
+                                                          cell_leaving_index );
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleLeavingCellEventHandler );
@@ -50,6 +50,12 @@ public:
                                 const ParticleState& particle,
                                 const Geometry::Model::EntityId cell_leaving );
 
+  //! Update the observers from a particle leaving cell event
+  void updateObserversFromParticleLeavingCellEvent(
+                                const ParticleState& particle,
+                                const Geometry::Model::EntityId cell_leaving,
+                                const size_t cell_leaving_index );
+
 protected:
 
   // Register an observer with the appropriate particle leaving cell event
@@ -30,6 +30,37 @@ void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEnding
   }
 }
 
+// Dispatch the particle subtrack ending in cell event to the observers
+/*! \details When a cell index model has been set the local dispatcher will
+ * be found with the cell index. Otherwise the cell id will be used.
+ */
+void ParticleSubtrackEndingInCellEventDispatcher::dispatchParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const size_t cell_of_subtrack_index,
+                              const double track_length )
+{
+  if( this->hasCellIndexTable() )
+  {
+    ParticleSubtrackEndingInCellEventLocalDispatcher* local_dispatcher =
+      this->getLocalDispatcherAtCellIndex( cell_of_subtrack_index );
+
+    if( local_dispatcher )
+    {
+      local_dispatcher->dispatchParticleSubtrackEndingInCellEvent(
+                                                              particle,
+                                                              cell_of_subtrack,
+                                                              track_length );
+    }
+  }
+  else
+  {
+    this->dispatchParticleSubtrackEndingInCellEvent( particle,
+                                                     cell_of_subtrack,
+                                                     track_length );
+  }
+}
+
 } // end MonteCarlo namespace
 
 BOOST_CLASS_EXPORT_IMPLEMENT( MonteCarlo::ParticleSubtrackEndingInCellEventDispatcher );
@@ -38,6 +38,13 @@ public:
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double track_length );
 
+  //! Dispatch the particle subtrack ending in cell event to the observers
+  void dispatchParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const size_t cell_of_subtrack_index,
+                              const double track_length );
+
 private:
 
   // Serialize the observer
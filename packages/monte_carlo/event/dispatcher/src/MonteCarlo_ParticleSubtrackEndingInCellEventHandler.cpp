@@ -43,6 +43,23 @@ void ParticleSubtrackEndingInCellEventHandler::updateObserversFromParticleSubtra
 						    particle_subtrack_length );
 }
 
+// Update the observers from a particle subtrack ending in cell event
+/*! \details The cell index must be the one that the cell index model (if
+ * one has been set) assigns to the cell.
+ */
+void ParticleSubtrackEndingInCellEventHandler::updateObserversFromParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const size_t cell_of_subtrack_index,
+                              const double particle_subtrack_length )
+{
+  d_particle_subtrack_ending_in_cell_event_dispatcher.dispatchParticleSubtrackEndingInCellEvent(
+						    particle,
+						    cell_of_subtrack,
+                                                    cell_of_subtrack_index,
+						    particle_subtrack_length );
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ParticleSubtrackEndingInCellEventHandler );
@@ -51,6 +51,13 @@ public:
                               const Geometry::Model::EntityId cell_of_subtrack,
                               const double particle_subtrack_length );
 
+  //! Update the observers from a particle subtrack ending in cell event
+  void updateObserversFromParticleSubtrackEndingInCellEvent(
+                              const ParticleState& particle,
+                              const Geometry::Model::EntityId cell_of_subtrack,
+                              const size_t cell_of_subtrack_index,
+                              const double particle_subtrack_length );
+
 protected:
 
   /*! \brief Register an observer with the appropriate particle subtrack ending
@@ -427,6 +427,32 @@ FRENSIE_UNIT_TEST( EventHandler, addEstimator_model_set )
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check if any estimators require surface tracking
+FRENSIE_UNIT_TEST( EventHandler, hasSurfaceTrackingEstimators )
+{
+  MonteCarlo::EventHandler event_handler;
+
+  FRENSIE_CHECK( !event_handler.hasSurfaceTrackingEstimators( MonteCarlo::PHOTON ) );
+
+  event_handler.addEstimator( estimator_1 );
+  event_handler.addEstimator( mesh_estimator_1 );
+
+  FRENSIE_CHECK( !event_handler.hasSurfaceTrackingEstimators( MonteCarlo::PHOTON ) );
+
+  event_handler.addEstimator( estimator_4 );
+
+  FRENSIE_CHECK( event_handler.hasSurfaceTrackingEstimators( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !event_handler.hasSurfaceTrackingEstimators( MonteCarlo::NEUTRON ) );
+
+  MonteCarlo::EventHandler surface_event_handler;
+
+  surface_event_handler.addEstimator( estimator_13 );
+
+  FRENSIE_CHECK( surface_event_handler.hasSurfaceTrackingEstimators( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !surface_event_handler.hasSurfaceTrackingEstimators( MonteCarlo::ELECTRON ) );
+}
+
 //---------------------------------------------------------------------------//
 // Check that stored estimators can be returned
 FRENSIE_UNIT_TEST( EventHandler, getEstimator )
@@ -16,6 +16,7 @@
 #include "MonteCarlo_PhotonState.hpp"
 #include "MonteCarlo_ElectronState.hpp"
 #include "Geometry_Model.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
 #include "ArchiveTestHelpers.hpp"
 
@@ -575,6 +576,50 @@ FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( ParticleEnteringCellEventDispatcher,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that a particle entering cell event can be dispatched by cell index
+FRENSIE_UNIT_TEST( ParticleEnteringCellEventDispatcher,
+                   dispatchParticleEnteringCellEvent_cell_index )
+{
+  std::shared_ptr<MonteCarlo::ParticleEnteringCellEventDispatcher>
+    dispatcher( new MonteCarlo::ParticleEnteringCellEventDispatcher );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellPulseHeightEstimator> estimator(
+             new MonteCarlo::WeightMultipliedCellPulseHeightEstimator(
+                           3, 1.0, std::vector<Geometry::Model::EntityId>( {1} ) ) );
+
+  dispatcher->attachObserver( 1, estimator->getParticleTypes(), estimator );
+
+  FRENSIE_CHECK( !dispatcher->hasCellIndexTable() );
+
+  std::shared_ptr<const Geometry::Model>
+    model( new Geometry::InfiniteMediumModel( 1 ) );
+
+  dispatcher->setCellIndexModel( model );
+
+  FRENSIE_REQUIRE( dispatcher->hasCellIndexTable() );
+  FRENSIE_REQUIRE( dispatcher->getLocalDispatcherAtCellIndex( 0 ) != NULL );
+  FRENSIE_CHECK_EQUAL( dispatcher->getLocalDispatcherAtCellIndex( 0 )->getEntityId(),
+                       1 );
+
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setWeight( 1.0 );
+  photon.setEnergy( 2.0 );
+
+  FRENSIE_CHECK( !estimator->hasUncommittedHistoryContribution() );
+
+  dispatcher->dispatchParticleEnteringCellEvent( photon, 1, 0 );
+
+  FRENSIE_CHECK( estimator->hasUncommittedHistoryContribution() );
+
+  estimator->commitHistoryContribution();
+
+  Utility::ArrayView<const double> first_moments =
+    estimator->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_CHECK_EQUAL( first_moments, std::vector<double>( {2.0} ) );
+}
+
 //---------------------------------------------------------------------------//
 // Custom setup
 //---------------------------------------------------------------------------//
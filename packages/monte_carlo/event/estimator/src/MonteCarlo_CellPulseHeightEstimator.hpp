@@ -29,19 +29,22 @@ namespace MonteCarlo{
  * \ingroup particle_entering_cell_event
  * \ingroup particle_leaving_cell_event
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call
- * should only appear within an omp critical block. Use the enable thread
- * support member function to set up an instance of this class for the
- * requested number of threads. The classes default initialization is for
- * a single thread.
+ * threads. Each thread uses its own update tracker, so the
+ * commitHistoryContribution member function can be called concurrently by
+ * different threads (see MonteCarlo::EntityEstimator for how the committed
+ * contributions are combined). Use the enable thread support
+ * member function to set up an instance of this class for the requested
+ * number of threads. The classes default initialization is for a single
+ * thread.
  */
 template<typename ContributionMultiplierPolicy = WeightMultiplier>
 class CellPulseHeightEstimator : public EntityEstimator,
                                  public ParticleEnteringCellEventObserver,
                                  public ParticleLeavingCellEventObserver
 {
-  // Typedef for the serial update tracker
-  typedef std::pair<double,std::unordered_map<Geometry::Model::EntityId,std::tuple<double,double> > >
+  // Typedef for the serial update tracker (the cells are ordered so that the
+  // deposition sums of a history do not depend on the thread that ran it)
+  typedef std::pair<double,std::map<Geometry::Model::EntityId,std::tuple<double,double> > >
   SerialUpdateTracker;
 
   // Typedef for the parallel update tracker
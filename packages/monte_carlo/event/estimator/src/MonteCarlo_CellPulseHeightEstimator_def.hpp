@@ -106,6 +106,8 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
 
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
+  this->setHistoryNumberOfThread( particle.getHistoryNumber() );
+
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
   this->checkAndCorrectPositronEnergyContribution( particle, energy_contribution );
@@ -137,6 +139,8 @@ inline void CellPulseHeightEstimator<ContributionMultiplierPolicy>::updateFromPa
   testPrecondition( this->isParticleTypeAssigned( particle.getParticleType() ) );
   unsigned thread_id = Utility::OpenMPProperties::getThreadId();
 
+  this->setHistoryNumberOfThread( particle.getHistoryNumber() );
+
   double energy_contribution = particle.getWeight()*particle.getEnergy();
 
   this->checkAndCorrectPositronEnergyContribution( particle, energy_contribution );
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_EntityEstimator.hpp"
@@ -28,6 +31,10 @@ EntityEstimator::EntityEstimator( const Id id,
     d_supplied_norm_constants( false ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_thread_local_data_accumulation( false ),
+    d_history_ordered_thread_local_data_merge( false ),
+    d_thread_local_data( 1 ),
+    d_merged_history_contributions(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -192,6 +199,8 @@ void EntityEstimator::takeSnapshot( const uint64_t num_histories_since_last_snap
   
   if( d_entity_bin_snapshots_enabled )
   {
+    this->mergeThreadLocalData();
+
     d_estimator_total_bin_data_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                        time_since_last_snapshot,
                                                        d_estimator_total_bin_data );
@@ -482,6 +491,9 @@ void EntityEstimator::enableSampleMomentHistogramsOnEntityBins()
 
   this->initializeEntityEstimatorHistogramsMap();
   this->resizeEstimatorTotalHistograms();
+
+  // The threads must accumulate the histograms as well
+  this->initializeThreadLocalData();
 }
 
 // Check if sample moment histograms are enabled on on entity bins
@@ -529,6 +541,159 @@ void EntityEstimator::getTotalBinSampleMomentHistogram(
     histogram = d_estimator_total_bin_histograms[bin_index];
 }
 
+// Enable support for multiple threads
+/*! \details Any data that has been accumulated by the threads is merged
+ * into the estimator data before the thread data is set up. Thread local
+ * data accumulation must be enabled separately.
+ */
+void EntityEstimator::enableThreadSupport( const unsigned num_threads )
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+  // Make sure the number of threads is valid
+  testPrecondition( num_threads > 0 );
+
+  Estimator::enableThreadSupport( num_threads );
+
+  // Merge any thread data before the thread data is resized
+  this->mergeThreadLocalData();
+
+  d_thread_local_data.resize( num_threads );
+
+  this->initializeThreadLocalData();
+}
+
+// Accumulate the thread moments locally until they are explicitly merged
+/*! \details Every thread (including the master thread) will accumulate the
+ * moments of the history contributions that it commits (and the sample
+ * moment histograms) in its own copy of the estimator data, which removes
+ * the critical section from the history contribution commits. The memory
+ * required by the estimator data is multiplied by the number of threads.
+ * The owner of the estimator is responsible for calling
+ * mergeThreadLocalData (outside of a parallel block) before the estimator
+ * moments are requested or archived - the particle simulation manager
+ * merges the thread data when a snapshot is taken and at every rendezvous.
+ */
+void EntityEstimator::enableThreadLocalDataAccumulation()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  d_thread_local_data_accumulation = true;
+
+  this->initializeThreadLocalData();
+}
+
+// Merge the locally accumulated thread contributions in history order
+/*! \details Instead of accumulating the moments, every thread will store
+ * the history contributions that it commits, along with the history number,
+ * in its own list. The stored contributions are added to the estimator
+ * moments in history order when the thread data is merged, which makes the
+ * moments bit-identical to the moments from a serial run regardless of the
+ * history schedule. The merge is serial and the lists grow with the number
+ * of contributions committed between merges (32 bytes per contribution),
+ * so this should only be used when reproducibility is required. This only
+ * has an effect once thread local data accumulation has been enabled.
+ */
+void EntityEstimator::enableHistoryOrderedThreadLocalDataMerge()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  // Merge any thread data before the thread data is set up
+  this->mergeThreadLocalData();
+
+  d_history_ordered_thread_local_data_merge = true;
+
+  this->initializeThreadLocalData();
+}
+
+// Merge the locally accumulated thread moments into the estimator moments
+/*! \details The data of the threads is added to the estimator data in
+ * thread order so the merged data does not depend on the order in which the
+ * threads finished. If history ordered merging has been enabled the stored
+ * contributions of every thread are added to the estimator moments in
+ * history order instead. This must only be called outside of a parallel
+ * block.
+ */
+void EntityEstimator::mergeThreadLocalData()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  if( d_history_ordered_thread_local_data_merge )
+    this->mergeThreadHistoryContributions();
+
+  for( auto&& thread_data : d_thread_local_data )
+  {
+    if( !thread_data.updated )
+      continue;
+
+    if( !d_history_ordered_thread_local_data_merge )
+    {
+      mergeCollection( d_estimator_total_bin_data,
+                       thread_data.estimator_total_bin_data );
+
+      for( auto&& entity_data : d_entity_estimator_moments_map )
+      {
+        mergeCollection( entity_data.second,
+                         thread_data.entity_estimator_moments_map.find( entity_data.first )->second );
+      }
+    }
+
+    if( d_entity_bin_histograms_enabled )
+    {
+      mergeHistogramArray( d_estimator_total_bin_histograms,
+                           thread_data.estimator_total_bin_histograms );
+
+      for( auto&& entity_data : d_entity_estimator_histograms_map )
+      {
+        mergeHistogramArray( entity_data.second,
+                             thread_data.entity_estimator_histograms_map.find( entity_data.first )->second );
+      }
+    }
+
+    thread_data.updated = false;
+  }
+}
+
+// Merge the history contributions stored by the threads in history order
+/*! \details The contributions of a history are added in the order that they
+ * were committed. This is the order in which a serial run adds them.
+ */
+void EntityEstimator::mergeThreadHistoryContributions()
+{
+  d_merged_history_contributions.clear();
+
+  for( auto&& thread_data : d_thread_local_data )
+  {
+    d_merged_history_contributions.insert(
+                                      d_merged_history_contributions.end(),
+                                      thread_data.contributions.begin(),
+                                      thread_data.contributions.end() );
+
+    thread_data.contributions.clear();
+  }
+
+  // A history is only ever simulated by one thread so a stable sort will
+  // preserve the commit order of the contributions of each history
+  std::stable_sort( d_merged_history_contributions.begin(),
+                    d_merged_history_contributions.end(),
+                    []( const HistoryContribution& a,
+                        const HistoryContribution& b ){
+                      return a.history_number < b.history_number;
+                    } );
+
+  for( auto&& history_contribution : d_merged_history_contributions )
+  {
+    history_contribution.collection->addRawScore(
+                                           history_contribution.bin_index,
+                                           history_contribution.contribution );
+  }
+
+  d_merged_history_contributions.clear();
+}
+
 // Reset the estimator data
 void EntityEstimator::resetData()
 {
@@ -539,6 +704,9 @@ void EntityEstimator::resetData()
   for( auto&& entity_data : d_entity_estimator_moments_map )
     entity_data.second.reset();
 
+  // Reset the thread data
+  this->initializeThreadLocalData();
+
   if( d_entity_bin_snapshots_enabled )
   {
     // Reset the total snapshot data
@@ -571,6 +739,9 @@ void EntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Merge the thread moments before reducing them
+  this->mergeThreadLocalData();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -945,6 +1116,9 @@ void EntityEstimator::assignEntities(
   this->resizeEstimatorTotalCollection();
   this->resizeEstimatorTotalSnapshots();
   this->resizeEstimatorTotalHistograms();
+
+  // Reinitialize the thread data (the collections may have been reallocated)
+  this->initializeThreadLocalData();
 }
 
 // Assign discretization to an estimator dimension
@@ -974,6 +1148,9 @@ void EntityEstimator::assignDiscretization(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Reinitialize the thread data (the collections may have been reallocated)
+  this->initializeThreadLocalData();
 }
 
 // Set the response functions
@@ -999,6 +1176,9 @@ void EntityEstimator::assignResponseFunction(
 
   // Resize the estimator total histograms
   this->resizeEstimatorTotalHistograms();
+
+  // Reinitialize the thread data (the collections may have been reallocated)
+  this->initializeThreadLocalData();
 }
 
 // Assign the history score pdf bins
@@ -1017,6 +1197,9 @@ void EntityEstimator::assignSampleMomentHistogramBins( const std::shared_ptr<con
         histogram.setBinBoundaries( bins );
     }
   }
+
+  // The thread histograms must use the new bins
+  this->initializeThreadLocalData();
 }
 
 // Commit history contribution to a bin of an entity
@@ -1032,13 +1215,31 @@ void EntityEstimator::commitHistoryContributionToBinOfEntity(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  FourEstimatorMomentsCollection& entity_estimator_moments =
+  FourEstimatorMomentsCollection& entity_collection =
     d_entity_estimator_moments_map.find( entity_id )->second;
 
-  // Update the moments
-  #pragma omp critical
+  if( d_thread_local_data_accumulation )
   {
-    entity_estimator_moments.addRawScore( bin_index, contribution );
+    // Store the contribution until it can be merged in history order
+    if( d_history_ordered_thread_local_data_merge )
+    {
+      this->storeHistoryContribution( entity_collection,
+                                      bin_index,
+                                      contribution );
+    }
+    // Update the moments of the thread
+    else
+    {
+      this->getThreadLocalData().entity_estimator_moments_map.find( entity_id )->second.addRawScore( bin_index, contribution );
+    }
+  }
+  // Update the moments (the threads share the moments)
+  else
+  {
+    #pragma omp critical
+    {
+      entity_collection.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id,
@@ -1061,13 +1262,21 @@ void EntityEstimator::addHistoryContributionToEntityBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
-
-    // Update the histogram
-    #pragma omp critical
+    // Update the histogram of the thread
+    if( d_thread_local_data_accumulation )
     {
-      histogram.addRawScore( contribution );
+      this->getThreadLocalData().entity_estimator_histograms_map.find( entity_id )->second[bin_index].addRawScore( contribution );
+    }
+    // Update the histogram (the threads share the histograms)
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_entity_estimator_histograms_map.find( entity_id )->second[bin_index];
+
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
     }
   }
 }
@@ -1082,10 +1291,30 @@ void EntityEstimator::commitHistoryContributionToBinOfTotal(
 		    this->getNumberOfBins()*
                     this->getNumberOfResponseFunctions() );
 
-  // Update the moments
-  #pragma omp critical
+  if( d_thread_local_data_accumulation )
   {
-    d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    // Store the contribution until it can be merged in history order
+    if( d_history_ordered_thread_local_data_merge )
+    {
+      this->storeHistoryContribution( d_estimator_total_bin_data,
+                                      bin_index,
+                                      contribution );
+    }
+    // Update the moments of the thread
+    else
+    {
+      this->getThreadLocalData().estimator_total_bin_data.addRawScore(
+                                                                bin_index,
+                                                                contribution );
+    }
+  }
+  // Update the moments (the threads share the moments)
+  else
+  {
+    #pragma omp critical
+    {
+      d_estimator_total_bin_data.addRawScore( bin_index, contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( bin_index, contribution );
@@ -1103,12 +1332,21 @@ void EntityEstimator::addHistoryContributionToTotalBinHistogram(
 
   if( d_entity_bin_histograms_enabled )
   {
-    Utility::SampleMomentHistogram<double>& histogram =
-      d_estimator_total_bin_histograms[bin_index];
-
-    #pragma omp critical
+    // Update the histogram of the thread
+    if( d_thread_local_data_accumulation )
     {
-      histogram.addRawScore( contribution );
+      this->getThreadLocalData().estimator_total_bin_histograms[bin_index].addRawScore( contribution );
+    }
+    // Update the histogram (the threads share the histograms)
+    else
+    {
+      Utility::SampleMomentHistogram<double>& histogram =
+        d_estimator_total_bin_histograms[bin_index];
+
+      #pragma omp critical
+      {
+        histogram.addRawScore( contribution );
+      }
     }
   }
 }
@@ -1219,6 +1457,187 @@ EntityEstimator::getEntityBinData( const EntityId entity_id ) const
   return d_entity_estimator_moments_map.find( entity_id )->second;
 }
 
+// Return the number of threads that have been set up
+unsigned EntityEstimator::getNumberOfThreads() const
+{
+  return d_thread_local_data.size();
+}
+
+// Check if thread local data accumulation has been enabled
+bool EntityEstimator::isThreadLocalDataAccumulationEnabled() const
+{
+  return d_thread_local_data_accumulation;
+}
+
+// Check if the thread local data is merged in history order
+bool EntityEstimator::isThreadLocalDataMergedInHistoryOrder() const
+{
+  return d_history_ordered_thread_local_data_merge;
+}
+
+// Set the history number of the contributions committed by this thread
+/*! \details The history number is only used to order the contributions
+ * when history ordered merging has been enabled. It must be set before the
+ * contributions of a history are committed (estimators set it when they
+ * receive a partial history contribution).
+ */
+void EntityEstimator::setHistoryNumberOfThread( const uint64_t history_number )
+{
+  // Make sure the thread id is valid
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    this->getNumberOfThreads() );
+
+  d_thread_local_data[Utility::OpenMPProperties::getThreadId()].history_number = history_number;
+}
+
+// Return the data of the calling thread
+/*! \details The thread data will be marked as updated.
+ */
+EntityEstimator::ThreadLocalData& EntityEstimator::getThreadLocalData()
+{
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < this->getNumberOfThreads() );
+
+  ThreadLocalData& thread_data = d_thread_local_data[thread_id];
+
+  if( !thread_data.updated )
+    thread_data.updated = true;
+
+  return thread_data;
+}
+
+// Store a history contribution until it is merged in history order
+/*! \details The contribution will be tagged with the history number of the
+ * calling thread. The collection must not be reallocated before the merge
+ * (initializeThreadLocalData must be called if it is).
+ */
+void EntityEstimator::storeHistoryContribution(
+                                   FourEstimatorMomentsCollection& collection,
+                                   const size_t bin_index,
+                                   const double contribution )
+{
+  // Make sure the bin index is valid
+  testPrecondition( bin_index < collection.size() );
+
+  ThreadLocalData& thread_data = this->getThreadLocalData();
+
+  HistoryContribution history_contribution;
+  history_contribution.history_number = thread_data.history_number;
+  history_contribution.collection = &collection;
+  history_contribution.bin_index = bin_index;
+  history_contribution.contribution = contribution;
+
+  thread_data.contributions.push_back( history_contribution );
+}
+
+// Initialize the data of each thread
+/*! \details Any data that has been accumulated by the threads will be
+ * discarded. The thread copies of the estimator moments are only allocated
+ * when thread local data accumulation has been enabled and the
+ * contributions are not merged in history order. The thread copies of the
+ * histograms are allocated whenever thread local data accumulation has been
+ * enabled. Derived classes that accumulate their own estimator data must
+ * override this method and call it.
+ */
+void EntityEstimator::initializeThreadLocalData()
+{
+  const bool accumulate_moments = d_thread_local_data_accumulation &&
+    !d_history_ordered_thread_local_data_merge;
+
+  const bool accumulate_histograms = d_thread_local_data_accumulation &&
+    d_entity_bin_histograms_enabled;
+
+  for( auto&& thread_data : d_thread_local_data )
+  {
+    thread_data.updated = false;
+    thread_data.contributions.clear();
+
+    thread_data.estimator_total_bin_data.clear();
+    thread_data.entity_estimator_moments_map.clear();
+    thread_data.estimator_total_bin_histograms.clear();
+    thread_data.entity_estimator_histograms_map.clear();
+
+    if( accumulate_moments )
+    {
+      thread_data.estimator_total_bin_data =
+        FourEstimatorMomentsCollection( d_estimator_total_bin_data.size() );
+
+      for( auto&& entity_data : d_entity_estimator_moments_map )
+      {
+        thread_data.entity_estimator_moments_map[entity_data.first] =
+          FourEstimatorMomentsCollection( entity_data.second.size() );
+      }
+    }
+
+    if( accumulate_histograms )
+    {
+      thread_data.estimator_total_bin_histograms =
+        d_estimator_total_bin_histograms;
+
+      for( auto&& histogram : thread_data.estimator_total_bin_histograms )
+        histogram.reset();
+
+      thread_data.entity_estimator_histograms_map =
+        d_entity_estimator_histograms_map;
+
+      for( auto&& entity_data : thread_data.entity_estimator_histograms_map )
+      {
+        for( auto&& histogram : entity_data.second )
+          histogram.reset();
+      }
+    }
+  }
+}
+
+// Merge the moments of a thread collection into a collection
+/*! \details The thread collection will be reset after its moments have been
+ * merged.
+ */
+void EntityEstimator::mergeCollection(
+                            FourEstimatorMomentsCollection& collection,
+                            FourEstimatorMomentsCollection& thread_collection )
+{
+  // Make sure the collections are compatible
+  testPrecondition( collection.size() == thread_collection.size() );
+
+  for( size_t i = 0; i < collection.size(); ++i )
+  {
+    Utility::getCurrentScore<1>( collection, i ) +=
+      Utility::getCurrentScore<1>( thread_collection, i );
+
+    Utility::getCurrentScore<2>( collection, i ) +=
+      Utility::getCurrentScore<2>( thread_collection, i );
+
+    Utility::getCurrentScore<3>( collection, i ) +=
+      Utility::getCurrentScore<3>( thread_collection, i );
+
+    Utility::getCurrentScore<4>( collection, i ) +=
+      Utility::getCurrentScore<4>( thread_collection, i );
+  }
+
+  thread_collection.reset();
+}
+
+// Merge the thread histograms into the histograms
+/*! \details The thread histograms will be reset after they have been merged.
+ */
+void EntityEstimator::mergeHistogramArray(
+                               SampleMomentHistogramArray& histograms,
+                               SampleMomentHistogramArray& thread_histograms )
+{
+  // Make sure the histogram arrays are compatible
+  testPrecondition( histograms.size() == thread_histograms.size() );
+
+  for( size_t i = 0; i < histograms.size(); ++i )
+  {
+    histograms[i].mergeHistograms( thread_histograms[i] );
+
+    thread_histograms[i].reset();
+  }
+}
+
 // Calculate the total normalization constant
 void EntityEstimator::calculateTotalNormalizationConstant()
 {
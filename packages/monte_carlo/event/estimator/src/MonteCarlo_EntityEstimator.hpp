@@ -16,7 +16,25 @@
 
 namespace MonteCarlo{
 
-//! The entity estimator class
+/*! The entity estimator class
+ * \details By default the history contributions of every thread are
+ * committed to the estimator moments inside of a critical section. Once
+ * thread local data accumulation has been enabled (e.g. by the
+ * MonteCarlo::EventHandler) each thread accumulates the moments of the
+ * history contributions that it commits (and the sample moment histograms)
+ * in its own copy of the estimator data, without any locking. The thread
+ * data is only added to the estimator data, in thread order, when
+ * mergeThreadLocalData is called, when a snapshot is taken or when the data
+ * is reduced. A thread always commits its histories in increasing history
+ * order, but the merged moments will depend on the assignment of the
+ * histories to the threads. If the moments must be bit-identical to the
+ * moments from a serial run, history ordered merging can be enabled
+ * instead: each thread then stores the history contributions that it
+ * commits, tagged with the history number, and the stored contributions
+ * are added to the estimator moments in history order when the thread data
+ * is merged. The moment getters and the serialization methods will not
+ * merge the thread data.
+ */
 class EntityEstimator : public Estimator
 {
 
@@ -184,6 +202,18 @@ public:
       const size_t bin_index,
       Utility::SampleMomentHistogram<double>& histogram ) const final override;
 
+  //! Enable support for multiple threads
+  void enableThreadSupport( const unsigned num_threads ) override;
+
+  //! Accumulate the thread moments locally until they are explicitly merged
+  void enableThreadLocalDataAccumulation() override;
+
+  //! Merge the locally accumulated thread contributions in history order
+  void enableHistoryOrderedThreadLocalDataMerge() override;
+
+  //! Merge the locally accumulated thread moments into the estimator moments
+  void mergeThreadLocalData() override;
+
   //! Reset estimator data
   void resetData() override;
 
@@ -256,8 +286,39 @@ protected:
                            const int root_process,
                            SampleMomentHistogramArray& histogram_array ) const;
 
+  //! Return the number of threads that have been set up
+  unsigned getNumberOfThreads() const;
+
+  //! Check if thread local data accumulation has been enabled
+  bool isThreadLocalDataAccumulationEnabled() const;
+
+  //! Check if the thread local data is merged in history order
+  bool isThreadLocalDataMergedInHistoryOrder() const;
+
+  //! Set the history number of the contributions committed by this thread
+  void setHistoryNumberOfThread( const uint64_t history_number );
+
+  //! Initialize the data of each thread
+  virtual void initializeThreadLocalData();
+
+  //! Store a history contribution until it is merged in history order
+  void storeHistoryContribution( FourEstimatorMomentsCollection& collection,
+                                 const size_t bin_index,
+                                 const double contribution );
+
+  //! Merge the moments of a thread collection into a collection
+  static void mergeCollection( FourEstimatorMomentsCollection& collection,
+                               FourEstimatorMomentsCollection& thread_collection );
+
+  //! Merge the thread histograms into the histograms
+  static void mergeHistogramArray( SampleMomentHistogramArray& histograms,
+                                   SampleMomentHistogramArray& thread_histograms );
+
 private:
 
+  // The data accumulated by a thread that has not been merged
+  struct ThreadLocalData;
+
   // Initialize entity estimator moments map
   template<typename InputEntityId>
   void initializeEntityEstimatorMomentsMap(
@@ -311,6 +372,12 @@ private:
   void addHistoryContributionToTotalBinHistogram( const size_t bin_index,
                                                   const double contribution );
 
+  // Return the data of the calling thread
+  ThreadLocalData& getThreadLocalData();
+
+  // Merge the history contributions stored by the threads in history order
+  void mergeThreadHistoryContributions();
+
   // Reduce the entity collections
   void reduceEntityCollections(
                    const std::vector<EntityEstimatorMomentsCollectionMap>&
@@ -366,6 +433,64 @@ private:
   // The estimator moments (1st,2nd,3rd,4th) for each bin and each entity
   EntityEstimatorMomentsCollectionMap d_entity_estimator_moments_map;
 
+  // A history contribution that has been committed by a thread but that has
+  // not been added to the estimator moments yet
+  struct HistoryContribution
+  {
+    // The history number
+    uint64_t history_number;
+
+    // The estimator moments collection that the contribution will be added to
+    FourEstimatorMomentsCollection* collection;
+
+    // The bin index
+    size_t bin_index;
+
+    // The contribution
+    double contribution;
+  };
+
+  // The data accumulated by a thread that has not been merged
+  // Note: the members that are updated by every commit are at the front of
+  //       the struct and the struct is larger than two cache lines, so the
+  //       data of neighbouring threads never shares a cache line
+  struct ThreadLocalData
+  {
+    // Records if the thread has committed a contribution since the last merge
+    bool updated;
+
+    // The history number of the current history of the thread
+    uint64_t history_number;
+
+    // The stored contributions (only used by history ordered merges)
+    std::vector<HistoryContribution> contributions;
+
+    // The moments for each bin of the total
+    FourEstimatorMomentsCollection estimator_total_bin_data;
+
+    // The moments for each bin and each entity
+    EntityEstimatorMomentsCollectionMap entity_estimator_moments_map;
+
+    // The sample moment histograms for each bin of the total
+    SampleMomentHistogramArray estimator_total_bin_histograms;
+
+    // The sample moment histograms for each bin and each entity
+    EntityEstimatorSampleMomentHistogramArrayMap entity_estimator_histograms_map;
+  };
+
+  // Bool that records if thread local data accumulation has been enabled
+  bool d_thread_local_data_accumulation;
+
+  // Bool that records if the thread local data is merged in history order
+  bool d_history_ordered_thread_local_data_merge;
+
+  // The data accumulated by each thread
+  std::vector<ThreadLocalData> d_thread_local_data;
+
+  // The contributions of every thread sorted by history number (the memory is
+  // reused by every merge)
+  std::vector<HistoryContribution> d_merged_history_contributions;
+
   // Bool that record if entity bin moment snapshots have been enabled
   bool d_entity_bin_snapshots_enabled;
 
@@ -30,6 +30,10 @@ EntityEstimator::EntityEstimator(
     d_supplied_norm_constants( true ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_thread_local_data_accumulation( false ),
+    d_history_ordered_thread_local_data_merge( false ),
+    d_thread_local_data( 1 ),
+    d_merged_history_contributions(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -70,6 +74,10 @@ EntityEstimator::EntityEstimator( const Id id,
     d_supplied_norm_constants( false ),
     d_estimator_total_bin_data( 1 ),
     d_entity_estimator_moments_map(),
+    d_thread_local_data_accumulation( false ),
+    d_history_ordered_thread_local_data_merge( false ),
+    d_thread_local_data( 1 ),
+    d_merged_history_contributions(),
     d_entity_bin_snapshots_enabled( false ),
     d_estimator_total_bin_data_snapshots(),
     d_entity_estimator_moments_snapshots_map(),
@@ -174,6 +182,16 @@ void EntityEstimator::serialize( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_estimator_total_bin_histograms );
   ar & BOOST_SERIALIZATION_NVP( d_entity_estimator_histograms_map );
   ar & BOOST_SERIALIZATION_NVP( d_entity_norm_constants_map );
+
+  // Initialize the thread data (the thread data is never archived - it must
+  // be merged before the estimator is saved)
+  if( Archive::is_loading::value )
+  {
+    d_thread_local_data_accumulation = false;
+    d_history_ordered_thread_local_data_merge = false;
+    d_thread_local_data.assign( 1, ThreadLocalData() );
+    d_merged_history_contributions.clear();
+  }
 }
 
 } // end MonteCarlo namespace
@@ -20,6 +20,7 @@
 #include "MonteCarlo_EstimatorContributionMultiplierPolicy.hpp"
 #include "MonteCarlo_ParticleState.hpp"
 #include "Utility_Mesh.hpp"
+#include "Utility_StructuredHexMesh.hpp"
 #include "Utility_Vector.hpp"
 
 namespace MonteCarlo{
@@ -98,6 +99,12 @@ private:
 						 const double start_point[3],
 						 const double end_point[3] );
 
+  // Visit the mesh elements that a track passes through
+  template<typename ElementVisitor>
+  void traverseMeshElements( const double start_point[3],
+                             const double end_point[3],
+                             ElementVisitor&& visitor ) const;
+
   // Assign the update method
   void assignUpdateMethod();
 
@@ -120,6 +127,9 @@ private:
   // The mesh object
   std::shared_ptr<const Utility::Mesh> d_mesh;
 
+  // The structured hex mesh object (null if the mesh is not structured)
+  std::shared_ptr<const Utility::StructuredHexMesh> d_structured_hex_mesh;
+
   // The no-time-bins update method is being used
   bool d_no_time_bins_update_method;
 
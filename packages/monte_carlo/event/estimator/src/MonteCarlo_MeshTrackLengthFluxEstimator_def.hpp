@@ -28,6 +28,7 @@ MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::MeshTrackLengthFluxE
                              const std::shared_ptr<const Utility::Mesh>& mesh )
   : StandardEntityEstimator( id, multiplier ),
     d_mesh( mesh ),
+    d_structured_hex_mesh( std::dynamic_pointer_cast<const Utility::StructuredHexMesh>( mesh ) ),
     d_no_time_bins_update_method( true ),
     d_update_method()
 {
@@ -85,25 +86,21 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  Utility::Mesh::ElementHandleTrackLengthArray contribution_array;
-
-  d_mesh->computeTrackLengths( start_point, end_point, contribution_array );
-
-  if( contribution_array.size() > 0 )
-  {
-    ObserverParticleStateWrapper particle_state_wrapper( particle );
-
-    for( size_t i = 0; i < contribution_array.size(); ++i )
-    {
-      double weighted_contribution = Utility::get<2>( contribution_array[i] )*
-        ContributionMultiplierPolicy::multiplier( particle );
-
-      this->addPartialHistoryPointContribution(
-                                      Utility::get<0>( contribution_array[i] ),
-                                      particle_state_wrapper,
-                                      weighted_contribution );
-    }
-  }
+  ObserverParticleStateWrapper particle_state_wrapper( particle );
+
+  const double contribution_multiplier =
+    ContributionMultiplierPolicy::multiplier( particle );
+
+  this->traverseMeshElements( start_point, end_point,
+                              [&]( const Utility::Mesh::ElementHandle element,
+                                   const double,
+                                   const double partial_track_length )
+                              {
+                                this->addPartialHistoryPointContribution(
+                                  element,
+                                  particle_state_wrapper,
+                                  partial_track_length*contribution_multiplier );
+                              } );
 }
 
 // Add current history estimator contribution
@@ -113,29 +110,67 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
 						 const double start_point[3],
 						 const double end_point[3] )
 {
-  Utility::Mesh::ElementHandleTrackLengthArray contribution_array;
+  ObserverParticleStateWrapper particle_state_wrapper( particle );
 
-  d_mesh->computeTrackLengths( start_point, end_point, contribution_array );
+  const double total_track_length =
+    std::sqrt( (end_point[0]-start_point[0])*(end_point[0]-start_point[0]) +
+               (end_point[1]-start_point[1])*(end_point[1]-start_point[1]) +
+               (end_point[2]-start_point[2])*(end_point[2]-start_point[2]) );
 
-  if( contribution_array.size() > 0 )
-  {
-    ObserverParticleStateWrapper particle_state_wrapper( particle );
+  particle_state_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( total_track_length );
+
+  const double start_time = particle_state_wrapper.getStartTime();
 
-    const double total_track_length =
-      std::sqrt( (end_point[0]-start_point[0])*(end_point[0]-start_point[0]) +
-                 (end_point[1]-start_point[1])*(end_point[1]-start_point[1]) +
-                 (end_point[2]-start_point[2])*(end_point[2]-start_point[2]) );
+  const double contribution_multiplier =
+    ContributionMultiplierPolicy::multiplier( particle );
 
+  this->traverseMeshElements( start_point, end_point,
+                              [&]( const Utility::Mesh::ElementHandle element,
+                                   const double distance_to_element,
+                                   const double partial_track_length )
+                              {
+                                const double track_start_time = start_time +
+                                  distance_to_element/particle.getSpeed();
 
-    particle_state_wrapper.calculateStateTimesUsingParticleTimeAsEndTime( total_track_length );
+                                const double track_end_time = track_start_time +
+                                  partial_track_length/particle.getSpeed();
 
-    const double start_time = particle_state_wrapper.getStartTime();
+                                particle_state_wrapper.setStartTime( track_start_time );
+                                particle_state_wrapper.setEndTime( track_end_time );
+
+                                this->addPartialHistoryRangeContribution(
+                                  element,
+                                  particle_state_wrapper,
+                                  partial_track_length*contribution_multiplier );
+                              } );
+}
+
+// Visit the mesh elements that a track passes through
+/*! \details Structured hex meshes are traversed directly, which allows the
+ * contributions to be added to the update tracker as each element is crossed
+ * instead of being collected in an intermediate array first. The visitor
+ * will be called with the element handle, the distance from the start point
+ * to the element entry point and the partial track length in the element.
+ */
+template<typename ContributionMultiplierPolicy>
+template<typename ElementVisitor>
+void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::traverseMeshElements(
+                                              const double start_point[3],
+                                              const double end_point[3],
+                                              ElementVisitor&& visitor ) const
+{
+  if( d_structured_hex_mesh )
+  {
+    d_structured_hex_mesh->traverseElements( start_point, end_point, visitor );
+  }
+  else
+  {
+    Utility::Mesh::ElementHandleTrackLengthArray contribution_array;
+
+    d_mesh->computeTrackLengths( start_point, end_point, contribution_array );
 
     for( size_t i = 0; i < contribution_array.size(); ++i )
     {
-      double weighted_contribution = Utility::get<2>( contribution_array[i] )*
-        ContributionMultiplierPolicy::multiplier( particle );
-
       const auto& element_intersection_point =
         Utility::get<1>( contribution_array[i] );
 
@@ -144,19 +179,9 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::updateFromGloba
                    (element_intersection_point[1]-start_point[1])*(element_intersection_point[1]-start_point[1]) +
                    (element_intersection_point[2]-start_point[2])*(element_intersection_point[2]-start_point[2]) );
 
-      const double track_start_time =
-        start_time + distance_to_element_intersection/particle.getSpeed();
-
-      const double track_end_time =
-        track_start_time + Utility::get<2>( contribution_array[i] )/particle.getSpeed();
-
-      particle_state_wrapper.setStartTime( track_start_time );
-      particle_state_wrapper.setEndTime( track_end_time );
-
-      this->addPartialHistoryRangeContribution(
-                                      Utility::get<0>( contribution_array[i] ),
-                                      particle_state_wrapper,
-                                      weighted_contribution );
+      visitor( Utility::get<0>( contribution_array[i] ),
+               distance_to_element_intersection,
+               Utility::get<2>( contribution_array[i] ) );
     }
   }
 }
@@ -451,6 +476,9 @@ void MeshTrackLengthFluxEstimator<ContributionMultiplierPolicy>::load( Archive&
   ar & BOOST_SERIALIZATION_NVP( d_mesh );
   ar & BOOST_SERIALIZATION_NVP( d_no_time_bins_update_method );
 
+  d_structured_hex_mesh =
+    std::dynamic_pointer_cast<const Utility::StructuredHexMesh>( d_mesh );
+
   this->assignUpdateMethod();
 }
 
@@ -6,6 +6,9 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_StandardEntityEstimator.hpp"
@@ -17,6 +20,7 @@ namespace MonteCarlo{
 
 // Default constructor
 StandardEntityEstimator::StandardEntityEstimator()
+  : d_update_tracker( 1 )
 { /* ... */ }
 
 // Constructor with no entities (for mesh estimator)
@@ -133,7 +137,9 @@ void StandardEntityEstimator::takeSnapshot( const uint64_t num_histories_since_l
 {
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
-  
+
+  this->mergeThreadLocalData();
+
   d_total_estimator_moment_snapshots.takeSnapshot( num_histories_since_last_snapshot,
                                                    time_since_last_snapshot,
                                                    d_total_estimator_moments );
@@ -419,96 +425,130 @@ void StandardEntityEstimator::getTotalSampleMomentHistogram(
 }
 
 // Commit the contribution from the current history to the estimator
-/*! \details This function must only be called within an omp critical block
- * if multiple threads are being used. Failure to do this may result in
- * race conditions.
+/*! \details Each thread uses its own update tracker so this function can
+ * be called concurrently by different threads. The moment updates are only
+ * lock free once thread local data accumulation has been enabled.
+ * The contributions to each entity bin are summed in the order that they
+ * were added and the entities and bins are processed in ascending order so
+ * that the committed values do not depend on hashing.
  */
 void StandardEntityEstimator::commitHistoryContribution()
 {
   // Thread id
-  size_t thread_id = Utility::OpenMPProperties::getThreadId();
-
-  // Number of bins per response function
-  size_t num_bins = this->getNumberOfBins();
+  const size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
-  // Number of response functions
-  size_t num_response_funcs = this->getNumberOfResponseFunctions();
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_update_tracker.size() );
 
-  // The entity totals
-  std::vector<double> entity_totals( num_response_funcs, 0.0 );
+  SerialUpdateTracker& update_tracker = d_update_tracker[thread_id];
 
-  // The totals over all entities
-  std::vector<double> totals( num_response_funcs, 0.0 );
+  // Number of bins over all response functions
+  const size_t num_bins =
+    this->getNumberOfBins()*this->getNumberOfResponseFunctions();
 
-  // The bin totals over all entities
-  BinContributionMap bin_totals;
+  // Number of response functions
+  const size_t num_response_funcs = this->getNumberOfResponseFunctions();
+
+  // The scratch arrays will only be resized when the discretization changes
+  update_tracker.entity_totals.resize( num_response_funcs, 0.0 );
+  update_tracker.totals.resize( num_response_funcs, 0.0 );
+  update_tracker.bin_totals.resize( num_bins, 0.0 );
+  update_tracker.bin_total_updated.resize( num_bins, false );
+
+  // Group the contributions by entity and bin
+  std::vector<BinContribution>& bin_contributions =
+    update_tracker.bin_contributions;
+
+  std::sort( bin_contributions.begin(),
+             bin_contributions.end(),
+             []( const BinContribution& a, const BinContribution& b ){
+               if( a.entity_id != b.entity_id )
+                 return a.entity_id < b.entity_id;
+               else if( a.bin_index != b.bin_index )
+                 return a.bin_index < b.bin_index;
+               else
+                 return a.order < b.order;
+             } );
+
+  size_t i = 0;
+
+  while( i < bin_contributions.size() )
+  {
+    const EntityId entity_id = bin_contributions[i].entity_id;
 
-  // Get the entities with updated data
-  typename SerialUpdateTracker::const_iterator entity, end_entity;
+    // Process each updated bin of the entity
+    while( i < bin_contributions.size() &&
+           bin_contributions[i].entity_id == entity_id )
+    {
+      const size_t bin_index = bin_contributions[i].bin_index;
 
-  this->getEntityIteratorFromUpdateTracker( thread_id, entity, end_entity );
+      double bin_contribution = 0.0;
 
-  while( entity != end_entity )
-  {
-    // Process each updated bin
-    BinContributionMap::const_iterator bin_data, end_bin_data;
+      while( i < bin_contributions.size() &&
+             bin_contributions[i].entity_id == entity_id &&
+             bin_contributions[i].bin_index == bin_index )
+      {
+        bin_contribution += bin_contributions[i].contribution;
 
-    this->getBinIteratorFromUpdateTrackerIterator( thread_id,
-                                                   entity,
-                                                   bin_data,
-                                                   end_bin_data );
+        ++i;
+      }
 
-    while( bin_data != end_bin_data )
-    {
       size_t response_func_index =
-	this->calculateResponseFunctionIndex( bin_data->first );
-
-      const double bin_contribution = bin_data->second;
+        this->calculateResponseFunctionIndex( bin_index );
 
-      entity_totals[response_func_index] += bin_contribution;
+      update_tracker.entity_totals[response_func_index] += bin_contribution;
 
-      totals[response_func_index] += bin_contribution;
+      update_tracker.totals[response_func_index] += bin_contribution;
 
-      if( bin_totals.find( bin_data->first ) != bin_totals.end() )
-	bin_totals[bin_data->first] += bin_contribution;
-      else
-	bin_totals[bin_data->first] = bin_contribution;
+      if( !update_tracker.bin_total_updated[bin_index] )
+      {
+        update_tracker.bin_total_updated[bin_index] = true;
+        update_tracker.updated_bin_totals.push_back( bin_index );
+      }
 
-      this->commitHistoryContributionToBinOfEntity( entity->first,
-						    bin_data->first,
-						    bin_contribution );
+      update_tracker.bin_totals[bin_index] += bin_contribution;
 
-      ++bin_data;
+      this->commitHistoryContributionToBinOfEntity( entity_id,
+                                                    bin_index,
+                                                    bin_contribution );
     }
 
     // Commit the entity totals
-    for( size_t i = 0; i < num_response_funcs; ++i )
+    for( size_t r = 0; r < num_response_funcs; ++r )
     {
-      this->commitHistoryContributionToTotalOfEntity( entity->first,
-                                                      i,
-                                                      entity_totals[i] );
+      this->commitHistoryContributionToTotalOfEntity(
+                                                entity_id,
+                                                r,
+                                                update_tracker.entity_totals[r] );
 
       // Reset the entity totals
-      entity_totals[i] = 0.0;
+      update_tracker.entity_totals[r] = 0.0;
     }
-
-    ++entity;
   }
 
   // Commit the totals over all entities
-  for( size_t i = 0; i < num_response_funcs; ++i )
-    this->commitHistoryContributionToTotalOfEstimator( i, totals[i] );
+  for( size_t r = 0; r < num_response_funcs; ++r )
+  {
+    this->commitHistoryContributionToTotalOfEstimator( r,
+                                                       update_tracker.totals[r] );
+
+    // Reset the totals
+    update_tracker.totals[r] = 0.0;
+  }
 
   // Commit the bin totals over all entities
-  BinContributionMap::const_iterator bin_data, end_bin_data;
-  bin_data = bin_totals.begin();
-  end_bin_data = bin_totals.end();
+  std::sort( update_tracker.updated_bin_totals.begin(),
+             update_tracker.updated_bin_totals.end() );
 
-  while( bin_data != end_bin_data )
+  for( auto&& bin_index : update_tracker.updated_bin_totals )
   {
-    this->commitHistoryContributionToBinOfTotal( bin_data->first,
-						 bin_data->second );
-    ++bin_data;
+    this->commitHistoryContributionToBinOfTotal(
+                                         bin_index,
+                                         update_tracker.bin_totals[bin_index] );
+
+    // Reset the bin total
+    update_tracker.bin_totals[bin_index] = 0.0;
+    update_tracker.bin_total_updated[bin_index] = false;
   }
 
   // Reset the update tracker
@@ -524,10 +564,55 @@ void StandardEntityEstimator::enableThreadSupport( const unsigned num_threads )
   // Make sure only the root thread calls this
   testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
 
-  EntityEstimator::enableThreadSupport( num_threads );
-
   // Add thread support to update tracker
   d_update_tracker.resize( num_threads );
+
+  // Note: the thread contributions will be merged by the base class
+  EntityEstimator::enableThreadSupport( num_threads );
+}
+
+// Merge the locally accumulated thread moments into the estimator moments
+/*! \details The total data of the threads is merged in thread order after
+ * the bin data has been merged. This must only be called outside of a
+ * parallel block.
+ */
+void StandardEntityEstimator::mergeThreadLocalData()
+{
+  // Make sure only the root thread calls this
+  testPrecondition( Utility::OpenMPProperties::getThreadId() == 0 );
+
+  EntityEstimator::mergeThreadLocalData();
+
+  for( auto&& thread_data : d_thread_local_total_data )
+  {
+    if( !thread_data.updated )
+      continue;
+
+    // The moments of the stored contributions have been merged by the base
+    // class
+    if( !this->isThreadLocalDataMergedInHistoryOrder() )
+    {
+      mergeCollection( d_total_estimator_moments,
+                       thread_data.total_estimator_moments );
+
+      for( auto&& entity_data : d_entity_total_estimator_moments_map )
+      {
+        mergeCollection( entity_data.second,
+                         thread_data.entity_total_estimator_moments_map.find( entity_data.first )->second );
+      }
+    }
+
+    mergeHistogramArray( d_total_estimator_histograms,
+                         thread_data.total_estimator_histograms );
+
+    for( auto&& entity_data : d_entity_total_estimator_histograms_map )
+    {
+      mergeHistogramArray( entity_data.second,
+                           thread_data.entity_total_estimator_histograms_map.find( entity_data.first )->second );
+    }
+
+    thread_data.updated = false;
+  }
 }
 
 // Reset the estimator data
@@ -566,7 +651,7 @@ void StandardEntityEstimator::resetData()
   // Reset the update tracker
   for( size_t i = 0; i < d_update_tracker.size(); ++i )
   {
-    d_update_tracker[i].clear();
+    this->resetUpdateTracker( i );
 
     this->unsetHasUncommittedHistoryContribution( i );
   }
@@ -581,6 +666,9 @@ void StandardEntityEstimator::reduceData( const Utility::Communicator& comm,
   // Make sure the root process is valid
   testPrecondition( root_process < comm.size() );
 
+  // Merge the thread moments before reducing them
+  this->mergeThreadLocalData();
+
   // Only do the reduction if there is more than one process
   if( comm.size() > 1 )
   {
@@ -684,6 +772,9 @@ void StandardEntityEstimator::assignEntities(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Reinitialize the thread data (the collections may have been reallocated)
+  this->initializeThreadLocalData();
 }
 
 // Set the response functions
@@ -709,6 +800,9 @@ void StandardEntityEstimator::assignResponseFunction(
     d_total_estimator_histograms.resize( this->getNumberOfResponseFunctions(),
                                          default_histogram );
   }
+
+  // Reinitialize the thread data (the collections may have been reallocated)
+  this->initializeThreadLocalData();
 }
 
 // Assign the history score pdf bins
@@ -724,6 +818,9 @@ void StandardEntityEstimator::assignSampleMomentHistogramBins( const std::shared
     for( auto&& histogram : entity_data.second )
       histogram.setBinBoundaries( bins );
   }
+
+  // The thread histograms must use the new bins
+  this->initializeThreadLocalData();
 }
 
 // Print the estimator data
@@ -780,11 +877,14 @@ void StandardEntityEstimator::addPartialHistoryPointContribution(
 
   const size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
+  this->setHistoryNumberOfThread(
+             particle_state_wrapper.getParticleState().getHistoryNumber() );
+
   // Only add the contribution if the particle state is in the phase space
   if( this->isPointInObserverPhaseSpace( particle_state_wrapper ) )
   {
-    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexArray
-      bin_indices;
+    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexArray&
+      bin_indices = d_update_tracker[thread_id].bin_indices;
 
     for( size_t r = 0; r < this->getNumberOfResponseFunctions(); ++r )
     {
@@ -832,11 +932,15 @@ void StandardEntityEstimator::addPartialHistoryRangeContribution(
 
   const size_t thread_id = Utility::OpenMPProperties::getThreadId();
 
+  this->setHistoryNumberOfThread(
+             particle_state_wrapper.getParticleState().getHistoryNumber() );
+
   // Only add the contribution if the particle state is in the phase space
   if( this->doesRangeIntersectObserverPhaseSpace( particle_state_wrapper ) )
   {
-    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray
-      bin_indices_and_weights;
+    typename ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray&
+      bin_indices_and_weights =
+      d_update_tracker[thread_id].bin_indices_and_weights;
 
     this->calculateBinIndicesAndWeightsOfRange( particle_state_wrapper,
                                                 0,
@@ -925,14 +1029,31 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEntity(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Estimator::FourEstimatorMomentsCollection&
-    entity_total_estimator_moments_collection =
+  Estimator::FourEstimatorMomentsCollection& entity_collection =
     d_entity_total_estimator_moments_map.find( entity_id )->second;
 
-  // Update the moments
-  #pragma omp critical
+  if( this->isThreadLocalDataAccumulationEnabled() )
+  {
+    // Store the contribution until it can be merged in history order
+    if( this->isThreadLocalDataMergedInHistoryOrder() )
+    {
+      this->storeHistoryContribution( entity_collection,
+                                      response_function_index,
+                                      contribution );
+    }
+    // Update the moments of the thread
+    else
+    {
+      this->getThreadLocalTotalData().entity_total_estimator_moments_map.find( entity_id )->second.addRawScore( response_function_index, contribution );
+    }
+  }
+  // Update the moments (the threads share the moments)
+  else
   {
-    entity_total_estimator_moments_collection.addRawScore( response_function_index, contribution );
+    #pragma omp critical
+    {
+      entity_collection.addRawScore( response_function_index, contribution );
+    }
   }
 
   this->addHistoryContributionToEntityBinHistogram( entity_id, response_function_index, contribution );
@@ -952,13 +1073,21 @@ void StandardEntityEstimator::addHistoryContributionToEntityBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
-
-  // Update the histogram
-  #pragma omp critical
+  // Update the histogram of the thread
+  if( this->isThreadLocalDataAccumulationEnabled() )
   {
-    histogram.addRawScore( contribution );
+    this->getThreadLocalTotalData().entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index].addRawScore( contribution );
+  }
+  // Update the histogram (the threads share the histograms)
+  else
+  {
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_entity_total_estimator_histograms_map.find( entity_id )->second[response_function_index];
+
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
   }
 }  
 
@@ -973,10 +1102,31 @@ void StandardEntityEstimator::commitHistoryContributionToTotalOfEstimator(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  // Update the moments
-  #pragma omp critical
+  if( this->isThreadLocalDataAccumulationEnabled() )
+  {
+    // Store the contribution until it can be merged in history order
+    if( this->isThreadLocalDataMergedInHistoryOrder() )
+    {
+      this->storeHistoryContribution( d_total_estimator_moments,
+                                      response_function_index,
+                                      contribution );
+    }
+    // Update the moments of the thread
+    else
+    {
+      this->getThreadLocalTotalData().total_estimator_moments.addRawScore(
+                                                       response_function_index,
+                                                       contribution );
+    }
+  }
+  // Update the moments (the threads share the moments)
+  else
   {
-    d_total_estimator_moments.addRawScore( response_function_index, contribution );
+    #pragma omp critical
+    {
+      d_total_estimator_moments.addRawScore( response_function_index,
+                                             contribution );
+    }
   }
 
   this->addHistoryContributionToTotalBinHistogram( response_function_index,
@@ -994,13 +1144,21 @@ void StandardEntityEstimator::addHistoryContributionToTotalBinHistogram(
   // Make sure the contribution is valid
   testPrecondition( !Utility::QuantityTraits<double>::isnaninf( contribution ) );
 
-  Utility::SampleMomentHistogram<double>& histogram =
-    d_total_estimator_histograms[response_function_index];
-  
-  // Update the histogram
-  #pragma omp critical
+  // Update the histogram of the thread
+  if( this->isThreadLocalDataAccumulationEnabled() )
   {
-    histogram.addRawScore( contribution );
+    this->getThreadLocalTotalData().total_estimator_histograms[response_function_index].addRawScore( contribution );
+  }
+  // Update the histogram (the threads share the histograms)
+  else
+  {
+    Utility::SampleMomentHistogram<double>& histogram =
+      d_total_estimator_histograms[response_function_index];
+
+    #pragma omp critical
+    {
+      histogram.addRawScore( contribution );
+    }
   }
 }
 
@@ -1014,51 +1172,98 @@ void StandardEntityEstimator::addInfoToUpdateTracker(
   // Make sure the thread id is valid
   testPrecondition( thread_id < d_update_tracker.size() );
 
-  BinContributionMap& thread_entity_bin_contribution_map =
-    d_update_tracker[thread_id][entity_id];
+  std::vector<BinContribution>& bin_contributions =
+    d_update_tracker[thread_id].bin_contributions;
 
-  BinContributionMap::iterator entity_bin_data =
-    thread_entity_bin_contribution_map.find( bin_index );
+  BinContribution bin_contribution;
+  bin_contribution.entity_id = entity_id;
+  bin_contribution.bin_index = bin_index;
+  bin_contribution.order = bin_contributions.size();
+  bin_contribution.contribution = contribution;
 
-  if( entity_bin_data != thread_entity_bin_contribution_map.end() )
-    entity_bin_data->second += contribution;
-  else
-    thread_entity_bin_contribution_map[bin_index] = contribution;
+  bin_contributions.push_back( bin_contribution );
 }
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getEntityIteratorFromUpdateTracker(
-              const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const
+// Reset the update tracker
+/*! \details The update tracker memory is retained so that it can be reused
+ * by the next history.
+ */
+void StandardEntityEstimator::resetUpdateTracker( const size_t thread_id )
 {
-  // Make sure the thread is is valid
+  // Make sure the thread id is valid
   testPrecondition( thread_id < d_update_tracker.size() );
 
-  start_entity = d_update_tracker[thread_id].begin();
-  end_entity = d_update_tracker[thread_id].end();
+  d_update_tracker[thread_id].bin_contributions.clear();
+  d_update_tracker[thread_id].updated_bin_totals.clear();
 }
 
-// Get the bin iterator from an update tracker iterator
-void StandardEntityEstimator::getBinIteratorFromUpdateTrackerIterator(
-           const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const
+// Initialize the total data of each thread
+/*! \details Any total data that has been accumulated by the threads will be
+ * discarded. The thread copies of the total data are only allocated when
+ * thread local data accumulation has been enabled (the thread copies of the
+ * total moments are not needed when the contributions are merged in history
+ * order).
+ */
+void StandardEntityEstimator::initializeThreadLocalData()
 {
-  // Make sure the thread id is valid
-  testPrecondition( thread_id < d_update_tracker.size() );
-  // Make sure the entity iterator is valid
-  testPrecondition( entity_iterator != d_update_tracker[thread_id].end() );
+  EntityEstimator::initializeThreadLocalData();
+
+  d_thread_local_total_data.clear();
+
+  if( this->isThreadLocalDataAccumulationEnabled() )
+  {
+    d_thread_local_total_data.resize( this->getNumberOfThreads() );
+
+    for( auto&& thread_data : d_thread_local_total_data )
+    {
+      thread_data.updated = false;
+
+      if( !this->isThreadLocalDataMergedInHistoryOrder() )
+      {
+        thread_data.total_estimator_moments =
+          Estimator::FourEstimatorMomentsCollection( d_total_estimator_moments.size() );
+
+        for( auto&& entity_data : d_entity_total_estimator_moments_map )
+        {
+          thread_data.entity_total_estimator_moments_map[entity_data.first] =
+            Estimator::FourEstimatorMomentsCollection( entity_data.second.size() );
+        }
+      }
+
+      thread_data.total_estimator_histograms = d_total_estimator_histograms;
 
-  start_bin = entity_iterator->second.begin();
-  end_bin = entity_iterator->second.end();
+      for( auto&& histogram : thread_data.total_estimator_histograms )
+        histogram.reset();
+
+      thread_data.entity_total_estimator_histograms_map =
+        d_entity_total_estimator_histograms_map;
+
+      for( auto&& entity_data : thread_data.entity_total_estimator_histograms_map )
+      {
+        for( auto&& histogram : entity_data.second )
+          histogram.reset();
+      }
+    }
+  }
 }
 
-// Reset the update tracker
-void StandardEntityEstimator::resetUpdateTracker( const size_t thread_id )
+// Return the total data of the calling thread
+/*! \details The thread total data will be marked as updated.
+ */
+StandardEntityEstimator::ThreadLocalTotalData&
+StandardEntityEstimator::getThreadLocalTotalData()
 {
-  d_update_tracker[thread_id].clear();
+  const unsigned thread_id = Utility::OpenMPProperties::getThreadId();
+
+  // Make sure the thread id is valid
+  testPrecondition( thread_id < d_thread_local_total_data.size() );
+
+  ThreadLocalTotalData& thread_data = d_thread_local_total_data[thread_id];
+
+  if( !thread_data.updated )
+    thread_data.updated = true;
+
+  return thread_data;
 }
 
 EXPLICIT_CLASS_SAVE_LOAD_INST( MonteCarlo::StandardEntityEstimator );
@@ -19,22 +19,86 @@ namespace MonteCarlo{
 
 /*! The standard entity estimator class
  * \details This class has been set up to get correct results with multiple
- * threads. However, the commitHistoryContribution member function call should
- * only appear within an omp critical block. Use the enable thread support
- * member function to set up an instance of this class for the requested number
- * of threads. The classes default initialization is for a single thread.
+ * threads. Each thread tracks the contributions from its current history in
+ * its own update tracker, so the commitHistoryContribution member function
+ * can be called concurrently by different threads. Once thread local data
+ * accumulation has been enabled the total moments and histograms are
+ * accumulated by each thread in its own copy as well and they are merged
+ * along with the bin data (see MonteCarlo::EntityEstimator). Use the enable
+ * thread support member function to set up an instance of this class for
+ * the requested number of threads. The classes default initialization is
+ * for a single thread.
  */
 class StandardEntityEstimator : public EntityEstimator
 {
-  // Typedef for bin contribution map
-  typedef std::unordered_map<size_t,double> BinContributionMap;
+  // The contribution to an entity bin from the current history
+  struct BinContribution
+  {
+    // The entity id
+    EntityId entity_id;
 
-  // Typedef for serial update tracker
-  typedef std::unordered_map<EntityId,BinContributionMap> SerialUpdateTracker;
+    // The bin index
+    size_t bin_index;
+
+    // The order in which the contribution was added
+    size_t order;
+
+    // The contribution
+    double contribution;
+  };
+
+  // The contributions from the current history of a thread
+  struct SerialUpdateTracker
+  {
+    // The bin contributions (in the order that they were added)
+    std::vector<BinContribution> bin_contributions;
+
+    // The bin totals over all entities (dense)
+    std::vector<double> bin_totals;
+
+    // Records if a bin total has been updated (dense)
+    std::vector<uint8_t> bin_total_updated;
+
+    // The indices of the bin totals that have been updated
+    std::vector<size_t> updated_bin_totals;
+
+    // The entity totals for each response function
+    std::vector<double> entity_totals;
+
+    // The totals over all entities for each response function
+    std::vector<double> totals;
+
+    // The scratch bin indices of the current contribution
+    ObserverPhaseSpaceDimensionDiscretization::BinIndexArray bin_indices;
+
+    // The scratch bin indices and weights of the current contribution
+    ObserverPhaseSpaceDimensionDiscretization::BinIndexWeightPairArray
+    bin_indices_and_weights;
+  };
 
   // Typedef for parallel update tracker
   typedef std::vector<SerialUpdateTracker> ParallelUpdateTracker;
 
+  // The total data accumulated by a thread that has not been merged
+  struct ThreadLocalTotalData
+  {
+    // Records if the thread has committed a contribution since the last merge
+    bool updated;
+
+    // The thread copy of the total estimator moments
+    Estimator::FourEstimatorMomentsCollection total_estimator_moments;
+
+    // The thread copy of the total estimator moments of each entity
+    EntityEstimatorMomentsCollectionMap entity_total_estimator_moments_map;
+
+    // The thread copy of the total sample moment histograms
+    SampleMomentHistogramArray total_estimator_histograms;
+
+    // The thread copy of the total sample moment histograms of each entity
+    EntityEstimatorSampleMomentHistogramArrayMap
+    entity_total_estimator_histograms_map;
+  };
+
 protected:
 
   //! Typedef for the map of entity ids and estimator moments array
@@ -182,6 +246,9 @@ public:
   //! Enable support for multiple threads
   void enableThreadSupport( const unsigned num_threads ) final override;
 
+  //! Merge the locally accumulated thread moments into the estimator moments
+  void mergeThreadLocalData() final override;
+
   //! Reset estimator data
   void resetData() final override;
 
@@ -266,22 +333,15 @@ private:
                                const size_t bin_index,
                                const double contribution );
 
-  // Get entity iterators from update tracker
-  void getEntityIteratorFromUpdateTracker(
-	      const size_t thread_id,
-	      typename SerialUpdateTracker::const_iterator& start_entity,
-	      typename SerialUpdateTracker::const_iterator& end_entity ) const;
-
-  // Get the bin iterator from an update tracker iterator
-  void getBinIteratorFromUpdateTrackerIterator(
-	   const size_t thread_id,
-	   const typename SerialUpdateTracker::const_iterator& entity_iterator,
-	   BinContributionMap::const_iterator& start_bin,
-	   BinContributionMap::const_iterator& end_bin ) const;
-
   // Reset the update tracker
   void resetUpdateTracker( const size_t thread_id );
 
+  // Initialize the total data of each thread
+  void initializeThreadLocalData() final override;
+
+  // Return the total data of the calling thread
+  ThreadLocalTotalData& getThreadLocalTotalData();
+
   // Save the data to an archive
   template<typename Archive>
   void save( Archive& ar, const unsigned version ) const;
@@ -315,6 +375,9 @@ private:
 
   // The entities/bins that have been updated
   ParallelUpdateTracker d_update_tracker;
+
+  // The total data accumulated by each thread that has not been merged
+  std::vector<ThreadLocalTotalData> d_thread_local_total_data;
 };
 
 } // end MonteCarlo namespace
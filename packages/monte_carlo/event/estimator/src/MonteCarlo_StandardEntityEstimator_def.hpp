@@ -108,7 +108,8 @@ void StandardEntityEstimator::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_entity_total_estimator_histograms_map );
 
   // Initialize the thread data
-  d_update_tracker.resize( 1 );
+  d_update_tracker.assign( 1, SerialUpdateTracker() );
+  d_thread_local_total_data.clear();
 }
 
 } // end MonteCarlo namespace
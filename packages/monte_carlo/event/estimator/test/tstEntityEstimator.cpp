@@ -61,6 +61,7 @@ public:
   // Allow public access to the entity estimator protected member functions
   using MonteCarlo::EntityEstimator::commitHistoryContributionToBinOfEntity;
   using MonteCarlo::EntityEstimator::commitHistoryContributionToBinOfTotal;
+  using MonteCarlo::EntityEstimator::setHistoryNumberOfThread;
 };
 
 //---------------------------------------------------------------------------//
@@ -1846,6 +1847,314 @@ FRENSIE_UNIT_TEST( EntityEstimator,
   }
 }
 
+//---------------------------------------------------------------------------//
+// Check that history contributions can be accumulated locally by each thread
+FRENSIE_UNIT_TEST( EntityEstimator,
+                   commitHistoryContributionToBinOfEntity_thread_local )
+{
+  std::shared_ptr<TestEntityEstimator> entity_estimator;
+  initializeEntityEstimator( entity_estimator, true );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  entity_estimator->enableThreadSupport( threads );
+  entity_estimator->enableThreadLocalDataAccumulation();
+
+  size_t num_estimator_bins = entity_estimator->getNumberOfBins()*
+    entity_estimator->getNumberOfResponseFunctions();
+
+  // Commit one contribution to every bin of entity 0 from each thread
+  #pragma omp parallel num_threads( threads )
+  {
+    for( size_t i = 0u; i < num_estimator_bins; ++i )
+    {
+      entity_estimator->commitHistoryContributionToBinOfEntity(
+                                 0,
+                                 i,
+                                 Utility::OpenMPProperties::getThreadId()+1.0 );
+    }
+  }
+
+  // No contributions are in the estimator moments until they are merged
+  Utility::ArrayView<const double> entity_bin_first_moments =
+    entity_estimator->getEntityBinDataFirstMoments( 0 );
+
+  Utility::ArrayView<const double> entity_bin_second_moments =
+    entity_estimator->getEntityBinDataSecondMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( entity_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, 0.0 ) );
+  FRENSIE_CHECK_EQUAL( entity_bin_second_moments,
+                       std::vector<double>( num_estimator_bins, 0.0 ) );
+
+  // Merge the thread moments
+  entity_estimator->mergeThreadLocalData();
+
+  double moment_1 = threads*(threads+1.0)/2.0;
+  double moment_2 = threads*(threads+1.0)*(2*threads+1.0)/6.0;
+
+  entity_bin_first_moments =
+    entity_estimator->getEntityBinDataFirstMoments( 0 );
+
+  entity_bin_second_moments =
+    entity_estimator->getEntityBinDataSecondMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( entity_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, moment_1 ) );
+  FRENSIE_CHECK_EQUAL( entity_bin_second_moments,
+                       std::vector<double>( num_estimator_bins, moment_2 ) );
+
+  // The thread moments can only be merged once
+  entity_estimator->mergeThreadLocalData();
+
+  entity_bin_first_moments =
+    entity_estimator->getEntityBinDataFirstMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( entity_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, moment_1 ) );
+
+  // The other entities have not been updated
+  entity_bin_first_moments =
+    entity_estimator->getEntityBinDataFirstMoments( 1 );
+
+  FRENSIE_CHECK_EQUAL( entity_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, 0.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that total history contributions can be accumulated locally by each
+// thread
+FRENSIE_UNIT_TEST( EntityEstimator,
+                   commitHistoryContributionToBinOfTotal_thread_local )
+{
+  std::shared_ptr<TestEntityEstimator> entity_estimator;
+  initializeEntityEstimator( entity_estimator, true );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  entity_estimator->enableThreadSupport( threads );
+  entity_estimator->enableThreadLocalDataAccumulation();
+
+  size_t num_estimator_bins = entity_estimator->getNumberOfBins()*
+    entity_estimator->getNumberOfResponseFunctions();
+
+  // Commit one contribution to every bin of the total from each thread
+  #pragma omp parallel num_threads( threads )
+  {
+    for( size_t i = 0u; i < num_estimator_bins; ++i )
+    {
+      entity_estimator->commitHistoryContributionToBinOfTotal(
+                                 i,
+                                 Utility::OpenMPProperties::getThreadId()+1.0 );
+    }
+  }
+
+  // No contributions are in the estimator moments until they are merged
+  Utility::ArrayView<const double> total_bin_first_moments =
+    entity_estimator->getTotalBinDataFirstMoments();
+
+  FRENSIE_CHECK_EQUAL( total_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, 0.0 ) );
+
+  // Merge the thread moments
+  entity_estimator->mergeThreadLocalData();
+
+  double moment_1 = threads*(threads+1.0)/2.0;
+  double moment_2 = threads*(threads+1.0)*(2*threads+1.0)/6.0;
+  double moment_3 = (threads+1)*(threads+1)*threads*threads/4.0;
+
+  total_bin_first_moments = entity_estimator->getTotalBinDataFirstMoments();
+
+  Utility::ArrayView<const double> total_bin_second_moments =
+    entity_estimator->getTotalBinDataSecondMoments();
+
+  Utility::ArrayView<const double> total_bin_third_moments =
+    entity_estimator->getTotalBinDataThirdMoments();
+
+  FRENSIE_CHECK_EQUAL( total_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, moment_1 ) );
+  FRENSIE_CHECK_EQUAL( total_bin_second_moments,
+                       std::vector<double>( num_estimator_bins, moment_2 ) );
+  FRENSIE_CHECK_EQUAL( total_bin_third_moments,
+                       std::vector<double>( num_estimator_bins, moment_3 ) );
+
+  // Resetting the data will also reset the thread moments
+  #pragma omp parallel num_threads( threads )
+  {
+    entity_estimator->commitHistoryContributionToBinOfTotal( 0, 1.0 );
+  }
+
+  entity_estimator->resetData();
+  entity_estimator->mergeThreadLocalData();
+
+  total_bin_first_moments = entity_estimator->getTotalBinDataFirstMoments();
+
+  FRENSIE_CHECK_EQUAL( total_bin_first_moments,
+                       std::vector<double>( num_estimator_bins, 0.0 ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sample moment histograms can be accumulated locally by each
+// thread
+FRENSIE_UNIT_TEST( EntityEstimator,
+                   commitHistoryContributionToBinOfTotal_thread_local_with_histogram )
+{
+  std::shared_ptr<TestEntityEstimator> entity_estimator;
+  initializeEntityEstimator( entity_estimator, true );
+
+  entity_estimator->enableSampleMomentHistogramsOnEntityBins();
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  entity_estimator->enableThreadSupport( threads );
+  entity_estimator->enableThreadLocalDataAccumulation();
+
+  size_t num_estimator_bins = entity_estimator->getNumberOfBins()*
+    entity_estimator->getNumberOfResponseFunctions();
+
+  // Commit one contribution to every bin of the total from each thread
+  #pragma omp parallel num_threads( threads )
+  {
+    for( size_t i = 0u; i < num_estimator_bins; ++i )
+    {
+      entity_estimator->commitHistoryContributionToBinOfTotal(
+                                 i,
+                                 Utility::OpenMPProperties::getThreadId()+1.0 );
+    }
+  }
+
+  // No contributions are in the histograms until they are merged
+  Utility::SampleMomentHistogram<double> histogram;
+
+  for( size_t i = 0u; i < num_estimator_bins; ++i )
+  {
+    entity_estimator->getTotalBinSampleMomentHistogram( i, histogram );
+
+    FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), 0 );
+  }
+
+  // Merge the thread histograms
+  entity_estimator->mergeThreadLocalData();
+
+  for( size_t i = 0u; i < num_estimator_bins; ++i )
+  {
+    entity_estimator->getTotalBinSampleMomentHistogram( i, histogram );
+
+    FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+  }
+
+  // The thread histograms can only be merged once
+  entity_estimator->mergeThreadLocalData();
+
+  entity_estimator->getTotalBinSampleMomentHistogram( 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the thread moments merged in history order are bit-identical to
+// the serial moments
+FRENSIE_UNIT_TEST( EntityEstimator, mergeThreadLocalData_history_order )
+{
+  std::shared_ptr<TestEntityEstimator> serial_estimator;
+  initializeEntityEstimator( serial_estimator, true );
+
+  std::shared_ptr<TestEntityEstimator> threaded_estimator;
+  initializeEntityEstimator( threaded_estimator, true );
+
+  std::shared_ptr<TestEntityEstimator> reversed_estimator;
+  initializeEntityEstimator( reversed_estimator, true );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  threaded_estimator->enableThreadSupport( threads );
+  threaded_estimator->enableThreadLocalDataAccumulation();
+  threaded_estimator->enableHistoryOrderedThreadLocalDataMerge();
+
+  reversed_estimator->enableThreadSupport( 1 );
+  reversed_estimator->enableThreadLocalDataAccumulation();
+  reversed_estimator->enableHistoryOrderedThreadLocalDataMerge();
+
+  size_t num_estimator_bins = serial_estimator->getNumberOfBins()*
+    serial_estimator->getNumberOfResponseFunctions();
+
+  const int num_histories = 1000;
+
+  // The contributions are chosen so that the floating point sums depend on
+  // the order in which they are added
+  auto commit_history = []( TestEntityEstimator& estimator,
+                            const int history,
+                            const size_t num_bins ){
+    estimator.setHistoryNumberOfThread( history );
+
+    const size_t bin_index = history % num_bins;
+    const double contribution = 1.0/(history+1.0) + 1e-7*(history % 7);
+
+    estimator.commitHistoryContributionToBinOfEntity( history % 5,
+                                                      bin_index,
+                                                      contribution );
+    estimator.commitHistoryContributionToBinOfTotal( bin_index,
+                                                     contribution );
+    estimator.commitHistoryContributionToBinOfTotal( 0, contribution*1e3 );
+  };
+
+  for( int history = 0; history < num_histories; ++history )
+    commit_history( *serial_estimator, history, num_estimator_bins );
+
+  #pragma omp parallel for num_threads( threads ) schedule( dynamic, 1 )
+  for( int history = 0; history < num_histories; ++history )
+    commit_history( *threaded_estimator, history, num_estimator_bins );
+
+  for( int history = num_histories-1; history >= 0; --history )
+    commit_history( *reversed_estimator, history, num_estimator_bins );
+
+  threaded_estimator->mergeThreadLocalData();
+  reversed_estimator->mergeThreadLocalData();
+
+  auto to_vector = []( const Utility::ArrayView<const double>& view ){
+    return std::vector<double>( view.begin(), view.end() );
+  };
+
+  std::vector<double> expected_moments =
+    to_vector( serial_estimator->getTotalBinDataFirstMoments() );
+
+  FRENSIE_CHECK_EQUAL( to_vector( threaded_estimator->getTotalBinDataFirstMoments() ),
+                       expected_moments );
+  FRENSIE_CHECK_EQUAL( to_vector( reversed_estimator->getTotalBinDataFirstMoments() ),
+                       expected_moments );
+
+  expected_moments =
+    to_vector( serial_estimator->getTotalBinDataFourthMoments() );
+
+  FRENSIE_CHECK_EQUAL( to_vector( threaded_estimator->getTotalBinDataFourthMoments() ),
+                       expected_moments );
+  FRENSIE_CHECK_EQUAL( to_vector( reversed_estimator->getTotalBinDataFourthMoments() ),
+                       expected_moments );
+
+  for( size_t entity_id = 0; entity_id < 5; ++entity_id )
+  {
+    expected_moments =
+      to_vector( serial_estimator->getEntityBinDataFirstMoments( entity_id ) );
+
+    FRENSIE_CHECK_EQUAL( to_vector( threaded_estimator->getEntityBinDataFirstMoments( entity_id ) ),
+                         expected_moments );
+    FRENSIE_CHECK_EQUAL( to_vector( reversed_estimator->getEntityBinDataFirstMoments( entity_id ) ),
+                         expected_moments );
+
+    expected_moments =
+      to_vector( serial_estimator->getEntityBinDataSecondMoments( entity_id ) );
+
+    FRENSIE_CHECK_EQUAL( to_vector( threaded_estimator->getEntityBinDataSecondMoments( entity_id ) ),
+                         expected_moments );
+    FRENSIE_CHECK_EQUAL( to_vector( reversed_estimator->getEntityBinDataSecondMoments( entity_id ) ),
+                         expected_moments );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a snapshot of the estimator state can be made
 FRENSIE_UNIT_TEST( EntityEstimator, takeSnapshot_no_bin_snapshots )
@@ -1407,7 +1407,7 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
                        expected_histogram_values );
 
   estimator->getTotalSampleMomentHistogram( 1, histogram );
-  
+
   FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
   FRENSIE_CHECK_EQUAL( histogram.getBinBoundaries(),
                        expected_histogram_bins );
@@ -1415,6 +1415,76 @@ FRENSIE_UNIT_TEST( StandardEntityEstimator,
                        expected_histogram_values );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the total data can be accumulated locally by each thread
+FRENSIE_UNIT_TEST( StandardEntityEstimator,
+                   commitHistoryContribution_thread_local )
+{
+  std::shared_ptr<TestStandardEntityEstimator> estimator;
+  initializeStandardEntityEstimator( estimator );
+
+  unsigned threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  estimator->enableThreadSupport( threads );
+  estimator->enableThreadLocalDataAccumulation();
+
+  #pragma omp parallel num_threads( threads )
+  {
+    // bin 0 (E=0, Mu=0, T=0, Col=0)
+    MonteCarlo::PhotonState particle( 0ull );
+    MonteCarlo::ObserverParticleStateWrapper particle_wrapper( particle );
+
+    particle.setEnergy( 1e-2 );
+    particle_wrapper.setAngleCosine( -0.5 );
+    particle.setTime( 5e-6 );
+
+    estimator->addPartialHistoryPointContribution( 0, particle_wrapper, 1.0 );
+    estimator->addPartialHistoryPointContribution( 1, particle_wrapper, 1.0 );
+
+    estimator->commitHistoryContribution();
+  }
+
+  // No contributions are in the total data until it is merged
+  Utility::ArrayView<const double> total_first_moments =
+    estimator->getTotalDataFirstMoments();
+
+  FRENSIE_CHECK_EQUAL( total_first_moments, std::vector<double>( 2, 0.0 ) );
+
+  Utility::SampleMomentHistogram<double> histogram;
+
+  estimator->getTotalSampleMomentHistogram( 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), 0 );
+
+  // Merge the thread data
+  estimator->mergeThreadLocalData();
+
+  total_first_moments = estimator->getTotalDataFirstMoments();
+
+  Utility::ArrayView<const double> total_second_moments =
+    estimator->getTotalDataSecondMoments();
+
+  FRENSIE_CHECK_EQUAL( total_first_moments,
+                       std::vector<double>( 2, 2.0*threads ) );
+  FRENSIE_CHECK_EQUAL( total_second_moments,
+                       std::vector<double>( 2, 4.0*threads ) );
+
+  Utility::ArrayView<const double> entity_total_first_moments =
+    estimator->getEntityTotalDataFirstMoments( 0 );
+
+  FRENSIE_CHECK_EQUAL( entity_total_first_moments,
+                       std::vector<double>( 2, threads ) );
+
+  estimator->getTotalSampleMomentHistogram( 0, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+
+  estimator->getEntityTotalSampleMomentHistogram( 1, 1, histogram );
+
+  FRENSIE_CHECK_EQUAL( histogram.getNumberOfScores(), threads );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a partial history contribution can be added to the estimator
 // in a thread safe way
@@ -22,20 +22,29 @@ ImportanceMesh::ImportanceMesh()
 void ImportanceMesh::setMesh(const std::shared_ptr<const Utility::Mesh> mesh)
 {
   d_mesh = mesh;
+
+  this->fillImportanceArray();
 }
 
 void ImportanceMesh::setImportanceMap( std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>>& importance_map )
 {
   testPrecondition(d_mesh);
   d_importance_map = importance_map;
+
+  this->fillImportanceArray();
 }
 
+/*! \details The mesh element that contains the particle is cached in the
+ * particle and used as the starting point of the next element search.
+ */
 double ImportanceMesh::getImportance( ParticleState& particle) const
 {
   ObserverParticleStateWrapper observer_particle(particle);
-  ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
+
+  thread_local ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
   this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
-  return d_importance_map.at(d_mesh->whichElementIsPointIn(particle.getPosition()))[discretization_index[0]];
+
+  return d_importance_array.getElementValues(*d_mesh, particle)[discretization_index[0]];
 }
 
 bool ImportanceMesh::isParticleInImportanceDiscretization( ParticleState& particle ) const
@@ -56,6 +65,15 @@ const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>>& Imp
   return d_importance_map;
 }
 
+// Fill the importance array
+void ImportanceMesh::fillImportanceArray()
+{
+  if( d_mesh )
+    d_importance_array.fill( *d_mesh, d_importance_map );
+  else
+    d_importance_array.clear();
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::ImportanceMesh );
@@ -14,6 +14,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_Importance.hpp"
+#include "MonteCarlo_PopulationControlMeshArray.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
@@ -56,17 +57,38 @@ private:
   //! Map that contains importance windows. First key is the index of the mesh element, second key is the index of the discretization
   std::unordered_map<Utility::Mesh::ElementHandle, std::vector<double>> d_importance_map;
 
-  // Serialize the data
+  //! The importances stored in a flat [element][discretization index] array (rebuilt from the map)
+  PopulationControlMeshArray<double> d_importance_array;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    // Save the base class data
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Importance );
+    // Save the member data
+    ar & BOOST_SERIALIZATION_NVP( d_mesh );
+    ar & BOOST_SERIALIZATION_NVP( d_importance_map );
+  }
+
+  // Load the data from an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  {   
-    // Serialize the base class data
+  void load( Archive& ar, const unsigned version )
+  {
+    // Load the base class data
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( Importance );
-    // Serialize the member data
+    // Load the member data
     ar & BOOST_SERIALIZATION_NVP( d_mesh );
     ar & BOOST_SERIALIZATION_NVP( d_importance_map );
+
+    this->fillImportanceArray();
   }
 
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Fill the importance array
+  void fillImportanceArray();
+
 };
 
 } // end MonteCarlo namespace
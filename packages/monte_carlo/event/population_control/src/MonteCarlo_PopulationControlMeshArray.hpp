@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PopulationControlMeshArray.hpp
+//! \author Philip Britt
+//! \brief  Population control mesh array class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_HPP
+#define MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleState.hpp"
+#include "Utility_Mesh.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The population control mesh array class
+ * \details This class stores population control values (e.g. weight windows
+ * or importances) in a flat [element][discretization bin] array. The mesh
+ * element that contains a particle is found using the element cached in the
+ * particle as a search hint and the cached element is updated after every
+ * lookup. When the mesh element handles are contiguous (e.g. a structured
+ * hex mesh) the element row is found by indexing - otherwise a hash table
+ * is used.
+ */
+template<typename T>
+class PopulationControlMeshArray
+{
+
+public:
+
+  //! The mesh element, discretization values map type
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<T> > ElementValueMap;
+
+  //! Constructor
+  PopulationControlMeshArray();
+
+  //! Destructor
+  ~PopulationControlMeshArray()
+  { /* ... */ }
+
+  //! Fill the array
+  void fill( const Utility::Mesh& mesh, const ElementValueMap& element_values );
+
+  //! Clear the array
+  void clear();
+
+  //! Check if the array is empty
+  bool empty() const;
+
+  //! Return the number of values stored for each element
+  size_t getNumberOfValuesPerElement() const;
+
+  //! Return the values of the element that contains the particle
+  const T* getElementValues( const Utility::Mesh& mesh,
+                             ParticleState& particle ) const;
+
+private:
+
+  // The element row value that indicates that an element has no values
+  static const size_t s_no_row;
+
+  // The number of values stored for each element
+  size_t d_number_of_values_per_element;
+
+  // The element values (flat [row][discretization bin] array)
+  std::vector<T> d_values;
+
+  // The element rows (indexed by element handle - contiguous handles only)
+  std::vector<size_t> d_element_rows;
+
+  // The element rows (non-contiguous handles only)
+  std::unordered_map<Utility::Mesh::ElementHandle,size_t> d_element_row_map;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_PopulationControlMeshArray_def.hpp"
+
+#endif // end MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PopulationControlMeshArray.hpp
+//---------------------------------------------------------------------------//
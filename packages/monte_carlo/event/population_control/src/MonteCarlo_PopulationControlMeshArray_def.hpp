@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_PopulationControlMeshArray_def.hpp
+//! \author Philip Britt
+//! \brief  Population control mesh array class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_DEF_HPP
+#define MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_DEF_HPP
+
+// Std Lib Includes
+#include <limits>
+#include <stdexcept>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// The element row value that indicates that an element has no values
+template<typename T>
+const size_t PopulationControlMeshArray<T>::s_no_row =
+  std::numeric_limits<size_t>::max();
+
+// Constructor
+template<typename T>
+PopulationControlMeshArray<T>::PopulationControlMeshArray()
+  : d_number_of_values_per_element( 0 ),
+    d_values(),
+    d_element_rows(),
+    d_element_row_map()
+{ /* ... */ }
+
+// Fill the array
+/*! \details Every element must have the same number of values. Elements
+ * that are not in the mesh will be ignored.
+ */
+template<typename T>
+void PopulationControlMeshArray<T>::fill( const Utility::Mesh& mesh,
+                                          const ElementValueMap& element_values )
+{
+  this->clear();
+
+  if( element_values.empty() )
+    return;
+
+  d_number_of_values_per_element = element_values.begin()->second.size();
+
+  const size_t number_of_elements = mesh.getNumberOfElements();
+
+  // Check if the element handles can be used as array indices
+  bool contiguous_element_handles = true;
+
+  for( auto&& element_data : element_values )
+  {
+    TEST_FOR_EXCEPTION( element_data.second.size() !=
+                        d_number_of_values_per_element,
+                        std::runtime_error,
+                        "Mesh element " << element_data.first << " has "
+                        << element_data.second.size() << " values but "
+                        << d_number_of_values_per_element << " values are "
+                        "required!" );
+
+    if( element_data.first >= number_of_elements )
+      contiguous_element_handles = false;
+  }
+
+  if( contiguous_element_handles )
+    d_element_rows.resize( number_of_elements, s_no_row );
+
+  d_values.reserve( element_values.size()*d_number_of_values_per_element );
+
+  // Store the rows in mesh element order
+  size_t row = 0;
+
+  for( Utility::Mesh::ElementHandleIterator element_it =
+         mesh.getStartElementHandleIterator();
+       element_it != mesh.getEndElementHandleIterator();
+       ++element_it )
+  {
+    typename ElementValueMap::const_iterator element_data =
+      element_values.find( *element_it );
+
+    if( element_data == element_values.end() )
+      continue;
+
+    d_values.insert( d_values.end(),
+                     element_data->second.begin(),
+                     element_data->second.end() );
+
+    if( contiguous_element_handles )
+      d_element_rows[*element_it] = row;
+    else
+      d_element_row_map[*element_it] = row;
+
+    ++row;
+  }
+}
+
+// Clear the array
+template<typename T>
+void PopulationControlMeshArray<T>::clear()
+{
+  d_number_of_values_per_element = 0;
+  d_values.clear();
+  d_element_rows.clear();
+  d_element_row_map.clear();
+}
+
+// Check if the array is empty
+template<typename T>
+bool PopulationControlMeshArray<T>::empty() const
+{
+  return d_values.empty();
+}
+
+// Return the number of values stored for each element
+template<typename T>
+size_t PopulationControlMeshArray<T>::getNumberOfValuesPerElement() const
+{
+  return d_number_of_values_per_element;
+}
+
+// Return the values of the element that contains the particle
+/*! \details The particle must be in the mesh. The element that contains the
+ * particle will be cached in the particle.
+ */
+template<typename T>
+const T* PopulationControlMeshArray<T>::getElementValues(
+                                              const Utility::Mesh& mesh,
+                                              ParticleState& particle ) const
+{
+  // Make sure that the particle is in the mesh
+  testPrecondition( mesh.isPointInMesh( particle.getPosition() ) );
+
+  const Utility::Mesh::ElementHandle element =
+    mesh.whichElementIsPointIn( particle.getPosition(),
+                                particle.getCachedMeshElement() );
+
+  particle.setCachedMeshElement( element );
+
+  size_t row = s_no_row;
+
+  if( !d_element_rows.empty() )
+  {
+    if( element < d_element_rows.size() )
+      row = d_element_rows[element];
+  }
+  else
+  {
+    std::unordered_map<Utility::Mesh::ElementHandle,size_t>::const_iterator
+      element_row = d_element_row_map.find( element );
+
+    if( element_row != d_element_row_map.end() )
+      row = element_row->second;
+  }
+
+  TEST_FOR_EXCEPTION( row == s_no_row,
+                      std::out_of_range,
+                      "Mesh element " << element << " has no population "
+                      "control values!" );
+
+  return d_values.data() + row*d_number_of_values_per_element;
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_POPULATION_CONTROL_MESH_ARRAY_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_PopulationControlMeshArray_def.hpp
+//---------------------------------------------------------------------------//
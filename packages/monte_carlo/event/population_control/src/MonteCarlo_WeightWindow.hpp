@@ -51,9 +51,9 @@ public:
   void checkParticleWithPopulationController( ParticleState& particle, 
                                               ParticleBank& bank) const;
 
-  virtual const WeightWindow& getWeightWindow( const ParticleState& particle ) const = 0;
+  virtual const WeightWindow& getWeightWindow( ParticleState& particle ) const = 0;
 
-  virtual bool isParticleInWeightWindowDiscretization( const ParticleState& particle ) const = 0;
+  virtual bool isParticleInWeightWindowDiscretization( ParticleState& particle ) const = 0;
 
 private:
 
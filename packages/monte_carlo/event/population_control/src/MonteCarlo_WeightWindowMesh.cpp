@@ -22,6 +22,8 @@ WeightWindowMesh::WeightWindowMesh()
 void WeightWindowMesh::setMesh(const std::shared_ptr<const Utility::Mesh> mesh)
 {
   d_mesh = mesh;
+
+  this->fillWeightWindowArray();
 }
 
 // Set the weight windows
@@ -29,20 +31,26 @@ void WeightWindowMesh::setWeightWindowMap( std::unordered_map<Utility::Mesh::Ele
 {
   testPrecondition(d_mesh);
   d_weight_window_map = weight_window_map;
+
+  this->fillWeightWindowArray();
 }
 
 // Get a specific weight window
-const WeightWindow& WeightWindowMesh::getWeightWindow( const ParticleState& particle) const
+/*! \details The mesh element that contains the particle is cached in the
+ * particle and used as the starting point of the next element search.
+ */
+const WeightWindow& WeightWindowMesh::getWeightWindow( ParticleState& particle) const
 {
   ObserverParticleStateWrapper observer_particle(particle);
-  ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
+
+  thread_local ObserverPhaseSpaceDimensionDiscretization::BinIndexArray discretization_index;
   this->calculateBinIndicesOfPoint(observer_particle, discretization_index);
 
-  return d_weight_window_map.at(d_mesh->whichElementIsPointIn(particle.getPosition()))[discretization_index[0]];
+  return d_weight_window_array.getElementValues(*d_mesh, particle)[discretization_index[0]];
 }
 
 // Check if a particle is under the weight window phase space
-bool WeightWindowMesh::isParticleInWeightWindowDiscretization( const ParticleState& particle ) const
+bool WeightWindowMesh::isParticleInWeightWindowDiscretization( ParticleState& particle ) const
 {
   ObserverParticleStateWrapper observer_particle(particle);
 
@@ -67,6 +75,15 @@ const std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>
   return d_weight_window_map;
 }
 
+// Fill the weight window array
+void WeightWindowMesh::fillWeightWindowArray()
+{
+  if( d_mesh )
+    d_weight_window_array.fill( *d_mesh, d_weight_window_map );
+  else
+    d_weight_window_array.clear();
+}
+
 } // end MonteCarlo namespace
 
 EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::WeightWindowMesh );
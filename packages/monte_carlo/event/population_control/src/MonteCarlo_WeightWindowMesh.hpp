@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_WeightWindow.hpp"
+#include "MonteCarlo_PopulationControlMeshArray.hpp"
 #include "Utility_Mesh.hpp"
 #include "Utility_Map.hpp"
 
@@ -39,9 +40,9 @@ public:
   //! Set the discretization map for the weight window mesh (vector index is discretization index)
   void setWeightWindowMap( std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>>& weight_window_map );
 
-  const WeightWindow& getWeightWindow( const ParticleState& particle) const final override;
+  const WeightWindow& getWeightWindow( ParticleState& particle) const final override;
 
-  bool isParticleInWeightWindowDiscretization( const ParticleState& particle ) const final override;
+  bool isParticleInWeightWindowDiscretization( ParticleState& particle ) const final override;
 
   //! Get the mesh (for viewing purposes only)
   std::shared_ptr<const Utility::Mesh> getMesh() const;
@@ -59,17 +60,38 @@ private:
   //! Map that contains weight windows. First key is the index of the mesh element, second key is the index of the discretization
   std::unordered_map<Utility::Mesh::ElementHandle, std::vector<WeightWindow>> d_weight_window_map;
 
-  // Serialize the data
+  //! The weight windows stored in a flat [element][discretization index] array (rebuilt from the map)
+  PopulationControlMeshArray<WeightWindow> d_weight_window_array;
+
+  // Save the data to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    // Save the base class data
+    ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindowBase );
+    // Save the member data
+    ar & BOOST_SERIALIZATION_NVP( d_mesh );
+    ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+  }
+
+  // Load the data from an archive
   template<typename Archive>
-  void serialize( Archive& ar, const unsigned version )
-  {   
-    // Serialize the base class data
+  void load( Archive& ar, const unsigned version )
+  {
+    // Load the base class data
     ar & BOOST_SERIALIZATION_BASE_OBJECT_NVP( WeightWindowBase );
-    // Serialize the member data
+    // Load the member data
     ar & BOOST_SERIALIZATION_NVP( d_mesh );
     ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+
+    this->fillWeightWindowArray();
   }
 
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Fill the weight window array
+  void fillWeightWindowArray();
+
 };
 
 } // end MonteCarlo namespace
@@ -0,0 +1,605 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.cpp
+//! \author Philip Britt
+//! \brief  Weight window mesh generator class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <set>
+#include <limits>
+#include <algorithm>
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_BinImportanceSampledIndependentPhaseSpaceDimensionDistribution.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Default constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator()
+{ /* ... */ }
+
+// Constructor
+WeightWindowMeshGenerator::WeightWindowMeshGenerator(
+                       const std::shared_ptr<const Utility::Mesh>& mesh,
+                       const std::vector<double>& energy_bin_boundaries )
+  : d_mesh( mesh ),
+    d_energy_bin_boundaries( energy_bin_boundaries ),
+    d_max_relative_error( 0.5 ),
+    d_upper_to_lower_weight_ratio( 5.0 ),
+    d_survival_to_lower_weight_ratio( 3.0 ),
+    d_reference_lower_weight( 0.5 ),
+    d_weight_window_map()
+{
+  // Make sure the mesh is valid
+  testPrecondition( mesh.get() );
+
+  TEST_FOR_EXCEPTION( energy_bin_boundaries.size() < 2,
+                      std::runtime_error,
+                      "At least one energy bin must be specified!" );
+
+  TEST_FOR_EXCEPTION( !std::is_sorted( energy_bin_boundaries.begin(),
+                                       energy_bin_boundaries.end() ),
+                      std::runtime_error,
+                      "The energy bin boundaries must be sorted!" );
+}
+
+// Set the maximum relative error of an element flux used to generate a window
+void WeightWindowMeshGenerator::setMaximumRelativeError(
+                                              const double max_relative_error )
+{
+  TEST_FOR_EXCEPTION( max_relative_error <= 0.0,
+                      std::runtime_error,
+                      "The maximum relative error must be positive!" );
+
+  d_max_relative_error = max_relative_error;
+}
+
+// Return the maximum relative error of an element flux used to generate a window
+double WeightWindowMeshGenerator::getMaximumRelativeError() const
+{
+  return d_max_relative_error;
+}
+
+// Set the ratio of the upper weight to the lower weight
+void WeightWindowMeshGenerator::setUpperToLowerWeightRatio( const double ratio )
+{
+  TEST_FOR_EXCEPTION( ratio <= 1.0,
+                      std::runtime_error,
+                      "The upper to lower weight ratio must be greater than "
+                      "one!" );
+
+  TEST_FOR_EXCEPTION( ratio < d_survival_to_lower_weight_ratio,
+                      std::runtime_error,
+                      "The upper to lower weight ratio must not be less than "
+                      "the survival to lower weight ratio!" );
+
+  d_upper_to_lower_weight_ratio = ratio;
+}
+
+// Return the ratio of the upper weight to the lower weight
+double WeightWindowMeshGenerator::getUpperToLowerWeightRatio() const
+{
+  return d_upper_to_lower_weight_ratio;
+}
+
+// Set the ratio of the survival weight to the lower weight
+void WeightWindowMeshGenerator::setSurvivalToLowerWeightRatio( const double ratio )
+{
+  TEST_FOR_EXCEPTION( ratio < 1.0,
+                      std::runtime_error,
+                      "The survival to lower weight ratio must not be less "
+                      "than one!" );
+
+  TEST_FOR_EXCEPTION( ratio > d_upper_to_lower_weight_ratio,
+                      std::runtime_error,
+                      "The survival to lower weight ratio must not be "
+                      "greater than the upper to lower weight ratio!" );
+
+  d_survival_to_lower_weight_ratio = ratio;
+}
+
+// Return the ratio of the survival weight to the lower weight
+double WeightWindowMeshGenerator::getSurvivalToLowerWeightRatio() const
+{
+  return d_survival_to_lower_weight_ratio;
+}
+
+// Set the lower weight in the element with the maximum flux
+void WeightWindowMeshGenerator::setReferenceLowerWeight( const double lower_weight )
+{
+  TEST_FOR_EXCEPTION( lower_weight <= 0.0,
+                      std::runtime_error,
+                      "The reference lower weight must be positive!" );
+
+  d_reference_lower_weight = lower_weight;
+}
+
+// Return the lower weight in the element with the maximum flux
+double WeightWindowMeshGenerator::getReferenceLowerWeight() const
+{
+  return d_reference_lower_weight;
+}
+
+// Return the mesh
+std::shared_ptr<const Utility::Mesh> WeightWindowMeshGenerator::getMesh() const
+{
+  return d_mesh;
+}
+
+// Return the energy bin boundaries
+const std::vector<double>&
+WeightWindowMeshGenerator::getEnergyBinBoundaries() const
+{
+  return d_energy_bin_boundaries;
+}
+
+// Create a mesh flux estimator that can be used to generate the windows
+/*! \details The estimator must be registered with the event handler of the
+ * forward calculation. Once the calculation has finished the estimator can
+ * be passed to the generateWeightWindows method.
+ */
+std::shared_ptr<WeightMultipliedMeshTrackLengthFluxEstimator>
+WeightWindowMeshGenerator::createFluxEstimator(
+                                       const Estimator::Id id,
+                                       const ParticleType particle_type ) const
+{
+  std::shared_ptr<WeightMultipliedMeshTrackLengthFluxEstimator> estimator =
+    std::make_shared<WeightMultipliedMeshTrackLengthFluxEstimator>(
+                                                                  id,
+                                                                  1.0,
+                                                                  d_mesh );
+
+  estimator->setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+
+  estimator->setParticleTypes( std::vector<ParticleType>( 1, particle_type ) );
+
+  return estimator;
+}
+
+// Generate the weight windows from the mesh flux estimator data
+/*! \details The lower weight in element e and energy bin g is set to
+ * w_ref*phi(e,g)/max_e(phi(e,g)). Element fluxes that are zero or that have
+ * a relative error above the maximum relative error are ignored. Elements
+ * with an ignored flux keep the window from the previous iteration. If there
+ * is no previous window a window that will never be violated is assigned
+ * (the particles in these elements will not be split or rouletted).
+ */
+void WeightWindowMeshGenerator::generateWeightWindows(
+                                       const Estimator& mesh_flux_estimator )
+{
+  // Make sure the estimator is a mesh estimator
+  testPrecondition( mesh_flux_estimator.isMeshEstimator() );
+  // Make sure the estimator only has energy bins
+  testPrecondition( mesh_flux_estimator.getNumberOfBins() ==
+                    d_energy_bin_boundaries.size()-1 );
+  testPrecondition( mesh_flux_estimator.getNumberOfBins( OBSERVER_ENERGY_DIMENSION ) ==
+                    d_energy_bin_boundaries.size()-1 );
+  testPrecondition( mesh_flux_estimator.getNumberOfResponseFunctions() == 1 );
+
+  const size_t number_of_energy_bins = d_energy_bin_boundaries.size()-1;
+
+  // Extract the converged element fluxes
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >
+    converged_element_fluxes;
+
+  this->extractConvergedElementFluxes( mesh_flux_estimator,
+                                       converged_element_fluxes );
+
+  std::vector<double> max_fluxes( number_of_energy_bins, 0.0 );
+
+  for( auto&& element_data : converged_element_fluxes )
+  {
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( element_data.second[i] > max_fluxes[i] )
+        max_fluxes[i] = element_data.second[i];
+    }
+  }
+
+  // Generate the windows
+  for( auto&& element_data : converged_element_fluxes )
+  {
+    std::vector<WeightWindow>& element_windows =
+      d_weight_window_map[element_data.first];
+
+    if( element_windows.empty() )
+    {
+      element_windows.resize( number_of_energy_bins,
+                              this->createWeightWindow( 0.0 ) );
+    }
+
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( element_data.second[i] > 0.0 )
+      {
+        element_windows[i] = this->createWeightWindow(
+                 d_reference_lower_weight*element_data.second[i]/max_fluxes[i] );
+      }
+    }
+  }
+}
+
+// Generate consistent weight windows and source biasing from adjoint data
+/*! \details The adjoint mesh flux estimator must have been registered with
+ * the event handler of an adjoint calculation whose adjoint source is the
+ * response function of the forward detector (see createFluxEstimator). The
+ * adjoint flux at the source in energy bin g is the source element
+ * probability weighted average of the converged element adjoint fluxes and
+ * the response estimate (R) is the integral of the product of the source
+ * energy distribution and the source adjoint flux. Source elements that do
+ * not have a converged adjoint flux in energy bin g do not contribute to the
+ * average (or to its normalization). The returned energy
+ * dimension distribution samples the importance distribution
+ * q(E)*phi_adj(g)/R, where q is the source energy distribution and g is the
+ * energy bin that contains E (the source adjoint flux is assumed to be
+ * constant in each energy bin). The birth weight of a source particle in
+ * energy bin g is therefore exactly R/phi_adj(g). The survival weight in
+ * element e and energy bin g is set to R/phi_adj(e,g), which is the birth
+ * weight of a source particle in energy bin g when the source is confined to
+ * a single element. Since only the source energy is biased, a warning will
+ * be logged if the birth weight of a source particle falls outside of the
+ * window of a source element (i.e. when the source element adjoint fluxes
+ * differ by more than the window width from the average source adjoint
+ * flux).
+ * The lower and upper weights are set using the survival to lower and the
+ * upper to lower weight ratios (the reference lower weight is not used).
+ * Element adjoint fluxes that are zero or that have a relative error above
+ * the maximum relative error are handled in the same way as the forward
+ * fluxes in generateWeightWindows. Source energy bins with an ignored adjoint
+ * flux are assigned the minimum source adjoint flux (and a warning is logged)
+ * so that every source energy can still be sampled. The source energy
+ * distribution must be continuous and must be contained in the energy bins.
+ */
+std::shared_ptr<const PhaseSpaceDimensionDistribution>
+WeightWindowMeshGenerator::generateAdjointWeightWindows(
+         const Estimator& adjoint_mesh_flux_estimator,
+         const SourceElementProbabilityMap& source_element_probabilities,
+         const std::shared_ptr<const Utility::TabularUnivariateDistribution>&
+         source_energy_distribution )
+{
+  // Make sure the estimator is a mesh estimator
+  testPrecondition( adjoint_mesh_flux_estimator.isMeshEstimator() );
+  // Make sure the estimator only has energy bins
+  testPrecondition( adjoint_mesh_flux_estimator.getNumberOfBins() ==
+                    d_energy_bin_boundaries.size()-1 );
+  testPrecondition( adjoint_mesh_flux_estimator.getNumberOfBins( OBSERVER_ENERGY_DIMENSION ) ==
+                    d_energy_bin_boundaries.size()-1 );
+  testPrecondition( adjoint_mesh_flux_estimator.getNumberOfResponseFunctions() == 1 );
+  // Make sure the source energy distribution is valid
+  testPrecondition( source_energy_distribution.get() );
+
+  TEST_FOR_EXCEPTION( !source_energy_distribution->isContinuous(),
+                      std::runtime_error,
+                      "The source energy distribution must be continuous!" );
+
+  TEST_FOR_EXCEPTION( source_energy_distribution->getLowerBoundOfIndepVar() <
+                      d_energy_bin_boundaries.front() ||
+                      source_energy_distribution->getUpperBoundOfIndepVar() >
+                      d_energy_bin_boundaries.back(),
+                      std::runtime_error,
+                      "The source energy distribution must be contained in "
+                      "the energy bins!" );
+
+  const size_t number_of_energy_bins = d_energy_bin_boundaries.size()-1;
+
+  // Extract the converged element adjoint fluxes
+  std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >
+    converged_element_fluxes;
+
+  this->extractConvergedElementFluxes( adjoint_mesh_flux_estimator,
+                                       converged_element_fluxes );
+
+  // Calculate the adjoint flux at the source (only the source elements with
+  // a converged adjoint flux in an energy bin contribute to the bin)
+  std::vector<double> source_adjoint_fluxes( number_of_energy_bins, 0.0 );
+
+  std::vector<double> source_probability_norms( number_of_energy_bins, 0.0 );
+
+  double source_probability_norm = 0.0;
+
+  for( auto&& source_element_data : source_element_probabilities )
+  {
+    TEST_FOR_EXCEPTION( source_element_data.second < 0.0,
+                        std::runtime_error,
+                        "The probability of source element "
+                        << source_element_data.first << " is negative!" );
+
+    source_probability_norm += source_element_data.second;
+
+    auto element_data =
+      converged_element_fluxes.find( source_element_data.first );
+
+    if( element_data == converged_element_fluxes.end() )
+      continue;
+
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( element_data->second[i] > 0.0 )
+      {
+        source_adjoint_fluxes[i] +=
+          source_element_data.second*element_data->second[i];
+
+        source_probability_norms[i] += source_element_data.second;
+      }
+    }
+  }
+
+  TEST_FOR_EXCEPTION( source_probability_norm <= 0.0,
+                      std::runtime_error,
+                      "At least one source element must have a positive "
+                      "probability!" );
+
+  for( size_t i = 0; i < number_of_energy_bins; ++i )
+  {
+    if( source_probability_norms[i] > 0.0 )
+      source_adjoint_fluxes[i] /= source_probability_norms[i];
+  }
+
+  // Calculate the source energy bin probabilities
+  std::vector<double> source_bin_probabilities( number_of_energy_bins, 0.0 );
+
+  double min_source_adjoint_flux = std::numeric_limits<double>::infinity();
+
+  for( size_t i = 0; i < number_of_energy_bins; ++i )
+  {
+    const double lower_energy =
+      std::max( d_energy_bin_boundaries[i],
+                source_energy_distribution->getLowerBoundOfIndepVar() );
+
+    const double upper_energy =
+      std::min( d_energy_bin_boundaries[i+1],
+                source_energy_distribution->getUpperBoundOfIndepVar() );
+
+    if( upper_energy <= lower_energy )
+      continue;
+
+    source_bin_probabilities[i] =
+      source_energy_distribution->evaluateCDF( upper_energy ) -
+      source_energy_distribution->evaluateCDF( lower_energy );
+
+    if( source_bin_probabilities[i] > 0.0 &&
+        source_adjoint_fluxes[i] > 0.0 &&
+        source_adjoint_fluxes[i] < min_source_adjoint_flux )
+      min_source_adjoint_flux = source_adjoint_fluxes[i];
+  }
+
+  TEST_FOR_EXCEPTION( min_source_adjoint_flux ==
+                      std::numeric_limits<double>::infinity(),
+                      std::runtime_error,
+                      "There is no converged adjoint flux at the source!" );
+
+  // Calculate the response estimate
+  double response_estimate = 0.0;
+
+  for( size_t i = 0; i < number_of_energy_bins; ++i )
+  {
+    if( source_bin_probabilities[i] == 0.0 )
+      continue;
+
+    if( source_adjoint_fluxes[i] == 0.0 )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "WeightWindowMeshGenerator",
+                                  "There is no converged adjoint flux at "
+                                  "the source in energy bin ["
+                                  << d_energy_bin_boundaries[i] << ","
+                                  << d_energy_bin_boundaries[i+1] << "] "
+                                  "MeV. The minimum source adjoint flux ("
+                                  << min_source_adjoint_flux << ") will be "
+                                  "used so that these source energies can "
+                                  "still be sampled!" );
+
+      source_adjoint_fluxes[i] = min_source_adjoint_flux;
+    }
+
+    response_estimate += source_bin_probabilities[i]*source_adjoint_fluxes[i];
+  }
+
+  // Check that the birth weights are inside of the weight windows of the
+  // source elements - the source is only biased in energy so the birth
+  // weight in energy bin g is R/phi_adj(g) in every source element
+  size_t number_of_inconsistent_windows = 0;
+  double max_flux_ratio = 1.0;
+
+  for( auto&& source_element_data : source_element_probabilities )
+  {
+    if( source_element_data.second == 0.0 )
+      continue;
+
+    auto element_data =
+      converged_element_fluxes.find( source_element_data.first );
+
+    if( element_data == converged_element_fluxes.end() )
+      continue;
+
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( source_bin_probabilities[i] == 0.0 ||
+          element_data->second[i] == 0.0 )
+        continue;
+
+      // The ratio of the birth weight to the survival weight
+      const double flux_ratio =
+        element_data->second[i]/source_adjoint_fluxes[i];
+
+      if( flux_ratio < 1.0/d_survival_to_lower_weight_ratio ||
+          flux_ratio > d_upper_to_lower_weight_ratio/
+                       d_survival_to_lower_weight_ratio )
+      {
+        ++number_of_inconsistent_windows;
+
+        max_flux_ratio = std::max( max_flux_ratio,
+                                   std::max( flux_ratio, 1.0/flux_ratio ) );
+      }
+    }
+  }
+
+  if( number_of_inconsistent_windows > 0 )
+  {
+    FRENSIE_LOG_TAGGED_WARNING( "WeightWindowMeshGenerator",
+                                "The source is only biased in energy but "
+                                "the adjoint fluxes of the source elements "
+                                "differ by up to a factor of "
+                                << max_flux_ratio << " from the average "
+                                "source adjoint flux. Source particles will "
+                                "be born outside of "
+                                << number_of_inconsistent_windows <<
+                                " source element weight windows and will be "
+                                "split or rouletted immediately. Bias the "
+                                "spatial source distribution or generate "
+                                "the windows for each source element "
+                                "separately!" );
+  }
+
+  // Generate the windows
+  for( auto&& element_data : converged_element_fluxes )
+  {
+    std::vector<WeightWindow>& element_windows =
+      d_weight_window_map[element_data.first];
+
+    if( element_windows.empty() )
+    {
+      element_windows.resize( number_of_energy_bins,
+                              this->createWeightWindow( 0.0 ) );
+    }
+
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( element_data.second[i] > 0.0 )
+      {
+        element_windows[i] = this->createWeightWindow(
+                                   response_estimate/element_data.second[i]/
+                                   d_survival_to_lower_weight_ratio );
+      }
+    }
+  }
+
+  // Create the biased source energy dimension distribution
+  return std::make_shared<BinImportanceSampledIndependentEnergyDimensionDistribution>( source_energy_distribution, d_energy_bin_boundaries, source_adjoint_fluxes );
+}
+
+// Load the weight windows into a weight window mesh
+void WeightWindowMeshGenerator::updateWeightWindowMesh(
+                                   WeightWindowMesh& weight_window_mesh ) const
+{
+  weight_window_mesh.setMesh( d_mesh );
+  weight_window_mesh.setDiscretization<OBSERVER_ENERGY_DIMENSION>(
+                                                     d_energy_bin_boundaries );
+
+  WeightWindowMap weight_window_map( d_weight_window_map );
+
+  weight_window_mesh.setWeightWindowMap( weight_window_map );
+}
+
+// Create a weight window mesh with the weight windows
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshGenerator::createWeightWindowMesh() const
+{
+  std::shared_ptr<WeightWindowMesh> weight_window_mesh =
+    std::make_shared<WeightWindowMesh>();
+
+  this->updateWeightWindowMesh( *weight_window_mesh );
+
+  return weight_window_mesh;
+}
+
+// Set the weight window map
+/*! \details This can be used to continue the iterations from a window set
+ * that was generated elsewhere (e.g. on another process).
+ */
+void WeightWindowMeshGenerator::setWeightWindowMap(
+                                   const WeightWindowMap& weight_window_map )
+{
+  for( auto&& element_windows : weight_window_map )
+  {
+    TEST_FOR_EXCEPTION( element_windows.second.size() !=
+                        d_energy_bin_boundaries.size()-1,
+                        std::runtime_error,
+                        "The weight windows of element "
+                        << element_windows.first << " do not match the "
+                        "energy bins!" );
+  }
+
+  d_weight_window_map = weight_window_map;
+}
+
+// Return the weight window map
+auto WeightWindowMeshGenerator::getWeightWindowMap() const -> const WeightWindowMap&
+{
+  return d_weight_window_map;
+}
+
+// Extract the converged element fluxes from the mesh flux estimator
+/*! \details Element fluxes that have a relative error above the maximum
+ * relative error are set to zero.
+ */
+void WeightWindowMeshGenerator::extractConvergedElementFluxes(
+                        const Estimator& mesh_flux_estimator,
+                        std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >&
+                        converged_element_fluxes ) const
+{
+  const size_t number_of_energy_bins = d_energy_bin_boundaries.size()-1;
+
+  std::set<Estimator::EntityId> element_handles;
+
+  mesh_flux_estimator.getEntityIds( element_handles );
+
+  std::vector<double> mean, relative_error, variance_of_variance,
+    figure_of_merit;
+
+  for( auto&& element_handle : element_handles )
+  {
+    mesh_flux_estimator.getEntityBinProcessedData( element_handle,
+                                                   mean,
+                                                   relative_error,
+                                                   variance_of_variance,
+                                                   figure_of_merit );
+
+    std::vector<double>& element_fluxes =
+      converged_element_fluxes[element_handle];
+
+    element_fluxes.resize( number_of_energy_bins, 0.0 );
+
+    for( size_t i = 0; i < number_of_energy_bins; ++i )
+    {
+      if( mean[i] > 0.0 && relative_error[i] <= d_max_relative_error )
+        element_fluxes[i] = mean[i];
+    }
+  }
+}
+
+// Create a window from the lower weight
+/*! \details A lower weight of zero results in a window that will never be
+ * violated.
+ */
+WeightWindow WeightWindowMeshGenerator::createWeightWindow(
+                                              const double lower_weight ) const
+{
+  WeightWindow weight_window;
+
+  weight_window.lower_weight = lower_weight;
+  weight_window.survival_weight =
+    d_survival_to_lower_weight_ratio*lower_weight;
+
+  if( lower_weight > 0.0 )
+    weight_window.upper_weight = d_upper_to_lower_weight_ratio*lower_weight;
+  else
+    weight_window.upper_weight = std::numeric_limits<double>::infinity();
+
+  return weight_window;
+}
+
+} // end MonteCarlo namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo::WeightWindowMeshGenerator );
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,178 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshGenerator.hpp
+//! \author Philip Britt
+//! \brief  Weight window mesh generator class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <unordered_map>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "MonteCarlo_MeshTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_Estimator.hpp"
+#include "MonteCarlo_PhaseSpaceDimensionDistribution.hpp"
+#include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_Mesh.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Vector.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh generator class
+ * \details This class generates energy dependent weight windows on a mesh
+ * from the flux estimated in a forward calculation (MAGIC method). The lower
+ * weight bound in each mesh element and energy bin is set proportional to the
+ * ratio of the element flux to the maximum flux in the energy bin. Only
+ * element fluxes with a relative error below the maximum relative error are
+ * used. The windows can be regenerated after every iteration and loaded into
+ * a weight window mesh for the next iteration. Consistent source biasing
+ * and weight windows can also be generated from the flux estimated in an
+ * adjoint calculation (CADIS method).
+ */
+class WeightWindowMeshGenerator
+{
+
+public:
+
+  //! The weight window map type
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,std::vector<WeightWindow> > WeightWindowMap;
+
+  //! The source element probability map type
+  typedef std::unordered_map<Utility::Mesh::ElementHandle,double> SourceElementProbabilityMap;
+
+  //! Constructor
+  WeightWindowMeshGenerator(
+                       const std::shared_ptr<const Utility::Mesh>& mesh,
+                       const std::vector<double>& energy_bin_boundaries );
+
+  //! Destructor
+  ~WeightWindowMeshGenerator()
+  { /* ... */ }
+
+  //! Set the maximum relative error of an element flux used to generate a window
+  void setMaximumRelativeError( const double max_relative_error );
+
+  //! Return the maximum relative error of an element flux used to generate a window
+  double getMaximumRelativeError() const;
+
+  //! Set the ratio of the upper weight to the lower weight
+  void setUpperToLowerWeightRatio( const double ratio );
+
+  //! Return the ratio of the upper weight to the lower weight
+  double getUpperToLowerWeightRatio() const;
+
+  //! Set the ratio of the survival weight to the lower weight
+  void setSurvivalToLowerWeightRatio( const double ratio );
+
+  //! Return the ratio of the survival weight to the lower weight
+  double getSurvivalToLowerWeightRatio() const;
+
+  //! Set the lower weight in the element with the maximum flux
+  void setReferenceLowerWeight( const double lower_weight );
+
+  //! Return the lower weight in the element with the maximum flux
+  double getReferenceLowerWeight() const;
+
+  //! Return the mesh
+  std::shared_ptr<const Utility::Mesh> getMesh() const;
+
+  //! Return the energy bin boundaries
+  const std::vector<double>& getEnergyBinBoundaries() const;
+
+  //! Create a mesh flux estimator that can be used to generate the windows
+  std::shared_ptr<WeightMultipliedMeshTrackLengthFluxEstimator>
+  createFluxEstimator( const Estimator::Id id,
+                       const ParticleType particle_type ) const;
+
+  //! Generate the weight windows from the mesh flux estimator data
+  void generateWeightWindows( const Estimator& mesh_flux_estimator );
+
+  //! Generate consistent weight windows and source biasing from adjoint data
+  std::shared_ptr<const PhaseSpaceDimensionDistribution>
+  generateAdjointWeightWindows(
+         const Estimator& adjoint_mesh_flux_estimator,
+         const SourceElementProbabilityMap& source_element_probabilities,
+         const std::shared_ptr<const Utility::TabularUnivariateDistribution>&
+         source_energy_distribution );
+
+  //! Load the weight windows into a weight window mesh
+  void updateWeightWindowMesh( WeightWindowMesh& weight_window_mesh ) const;
+
+  //! Create a weight window mesh with the weight windows
+  std::shared_ptr<WeightWindowMesh> createWeightWindowMesh() const;
+
+  //! Set the weight window map
+  void setWeightWindowMap( const WeightWindowMap& weight_window_map );
+
+  //! Return the weight window map
+  const WeightWindowMap& getWeightWindowMap() const;
+
+private:
+
+  // Default constructor
+  WeightWindowMeshGenerator();
+
+  // Extract the converged element fluxes from the mesh flux estimator
+  void extractConvergedElementFluxes(
+                        const Estimator& mesh_flux_estimator,
+                        std::unordered_map<Utility::Mesh::ElementHandle,std::vector<double> >&
+                        converged_element_fluxes ) const;
+
+  // Create a window from the lower weight
+  WeightWindow createWeightWindow( const double lower_weight ) const;
+
+  // Serialize the data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_mesh );
+    ar & BOOST_SERIALIZATION_NVP( d_energy_bin_boundaries );
+    ar & BOOST_SERIALIZATION_NVP( d_max_relative_error );
+    ar & BOOST_SERIALIZATION_NVP( d_upper_to_lower_weight_ratio );
+    ar & BOOST_SERIALIZATION_NVP( d_survival_to_lower_weight_ratio );
+    ar & BOOST_SERIALIZATION_NVP( d_reference_lower_weight );
+    ar & BOOST_SERIALIZATION_NVP( d_weight_window_map );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The mesh
+  std::shared_ptr<const Utility::Mesh> d_mesh;
+
+  // The energy bin boundaries
+  std::vector<double> d_energy_bin_boundaries;
+
+  // The maximum relative error of an element flux used to generate a window
+  double d_max_relative_error;
+
+  // The ratio of the upper weight to the lower weight
+  double d_upper_to_lower_weight_ratio;
+
+  // The ratio of the survival weight to the lower weight
+  double d_survival_to_lower_weight_ratio;
+
+  // The lower weight in the element with the maximum flux
+  double d_reference_lower_weight;
+
+  // The weight windows (vector index is the energy bin index)
+  WeightWindowMap d_weight_window_map;
+};
+
+} // end MonteCarlo namespace
+
+BOOST_CLASS_VERSION( MonteCarlo::WeightWindowMeshGenerator, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, WeightWindowMeshGenerator );
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -71,6 +71,29 @@ FRENSIE_UNIT_TEST( ImportanceMesh, getImportance )
   FRENSIE_CHECK_EQUAL(2.0, importance);
 }
 
+FRENSIE_UNIT_TEST( ImportanceMesh, getImportance_cached_element )
+{
+  MonteCarlo::PhotonState photon(0);
+
+  photon.setEnergy( 1.0 );
+  photon.setPosition(0.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(importance_mesh->getImportance(photon), 2.0);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 0);
+
+  // The cached element is only used as a search hint
+  photon.setPosition(1.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(importance_mesh->getImportance(photon), 4.2);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 1);
+
+  photon.setCachedMeshElement( 100 );
+  photon.setEnergy( 1e-2 );
+
+  FRENSIE_CHECK_EQUAL(importance_mesh->getImportance(photon), 3.5);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 1);
+}
+
 FRENSIE_UNIT_TEST( ImportanceMesh, checkParticleWithPopulationController_initialize)
 {
     MonteCarlo::PhotonState photon(0);
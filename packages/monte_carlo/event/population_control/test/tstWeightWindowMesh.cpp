@@ -50,6 +50,63 @@ FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow )
   FRENSIE_CHECK_EQUAL(weight_window.survival_weight, 6.0001);
 }
 
+FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow_cached_element )
+{
+  MonteCarlo::PhotonState photon(0);
+
+  photon.setEnergy( 1.0 );
+  photon.setPosition(0.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(weight_window_mesh->getWeightWindow(photon).lower_weight, 6.0);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 0);
+
+  // The cached element is only used as a search hint
+  photon.setPosition(1.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(weight_window_mesh->getWeightWindow(photon).lower_weight, 0.5);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 1);
+
+  photon.setCachedMeshElement( 100 );
+  photon.setEnergy( 1e-2 );
+
+  FRENSIE_CHECK_EQUAL(weight_window_mesh->getWeightWindow(photon).lower_weight, 1e-6);
+  FRENSIE_CHECK_EQUAL(photon.getCachedMeshElement(), 1);
+}
+
+FRENSIE_UNIT_TEST( WeightWindowMesh, getWeightWindow_missing_element )
+{
+  std::vector<double> x_planes = {0, 1, 2};
+  std::vector<double> y_planes = {0, 1};
+  std::vector<double> z_planes = {0, 1};
+
+  std::shared_ptr<Utility::StructuredHexMesh> mesh = std::make_shared<Utility::StructuredHexMesh>(x_planes, y_planes, z_planes);
+
+  MonteCarlo::WeightWindowMesh partial_weight_window_mesh;
+  partial_weight_window_mesh.setMesh(mesh);
+
+  std::unordered_map<Utility::Mesh::ElementHandle, std::vector<MonteCarlo::WeightWindow>> weight_window_mesh_map;
+
+  MonteCarlo::WeightWindow weight_window = MonteCarlo::WeightWindow();
+  weight_window.lower_weight = 0.5;
+  weight_window.upper_weight = 2.0;
+  weight_window.survival_weight = 1.0;
+
+  weight_window_mesh_map.emplace(1, std::vector<MonteCarlo::WeightWindow>(1, weight_window));
+
+  partial_weight_window_mesh.setWeightWindowMap(weight_window_mesh_map);
+
+  MonteCarlo::PhotonState photon(0);
+
+  photon.setEnergy( 1.0 );
+  photon.setPosition(1.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_EQUAL(partial_weight_window_mesh.getWeightWindow(photon).upper_weight, 2.0);
+
+  photon.setPosition(0.5, 0.5, 0.5);
+
+  FRENSIE_CHECK_THROW(partial_weight_window_mesh.getWeightWindow(photon), std::out_of_range);
+}
+
 FRENSIE_UNIT_TEST( WeightWindowMesh, checkParticleWithPopulationController_split)
 {
   MonteCarlo::PhotonState photon(0);
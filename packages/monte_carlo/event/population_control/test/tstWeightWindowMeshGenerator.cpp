@@ -0,0 +1,585 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshGenerator.cpp
+//! \author Philip Britt
+//! \brief  WeightWindowMeshGenerator test
+//!
+//---------------------------------------------------------------------------//
+
+// std includes
+#include <memory>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "MonteCarlo_ParticleBank.hpp"
+#include "MonteCarlo_PhaseSpaceDimensionTraits.hpp"
+#include "Utility_BasicCartesianCoordinateConversionPolicy.hpp"
+#include "Utility_UniformDistribution.hpp"
+#include "Utility_DiscreteDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// The hex mesh (two unit cube elements along the x-axis)
+std::shared_ptr<const Utility::Mesh> mesh;
+
+// The energy bin boundaries
+std::vector<double> energy_bin_boundaries = {0.0, 1.0, 2.0};
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a mesh flux estimator with two histories of data
+/*! \details Each history contributes a track length of 1.0 to element 0 and
+ * a track length of 0.5 to element 1 in energy bin 0. Only the first history
+ * contributes to energy bin 1 (track length of 1.0 in element 0).
+ */
+std::shared_ptr<MonteCarlo::Estimator> createFluxEstimator(
+                     const MonteCarlo::WeightWindowMeshGenerator& generator )
+{
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    estimator = generator.createFluxEstimator( 0, MonteCarlo::PHOTON );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator_base = estimator;
+
+  double start_point[3] = {0.0, 0.5, 0.5};
+  double end_point[3] = {1.5, 0.5, 0.5};
+  double short_end_point[3] = {1.0, 0.5, 0.5};
+
+  MonteCarlo::PhotonState particle( 0 );
+  particle.setWeight( 1.0 );
+
+  // History 1
+  particle.setEnergy( 0.5 );
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                          start_point,
+                                                          end_point );
+
+  particle.setEnergy( 1.5 );
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                          start_point,
+                                                          short_end_point );
+
+  estimator_base->commitHistoryContribution();
+
+  // History 2
+  particle.setEnergy( 0.5 );
+
+  estimator->updateFromGlobalParticleSubtrackEndingEvent( particle,
+                                                          start_point,
+                                                          end_point );
+
+  estimator_base->commitHistoryContribution();
+
+  MonteCarlo::ParticleHistoryObserver::setNumberOfHistories( 2 );
+  MonteCarlo::ParticleHistoryObserver::setElapsedTime( 1.0 );
+
+  return estimator_base;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the default window parameters are correct
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, default_parameters )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  FRENSIE_CHECK_EQUAL( generator.getMesh(), mesh );
+  FRENSIE_CHECK_EQUAL( generator.getEnergyBinBoundaries(),
+                       energy_bin_boundaries );
+  FRENSIE_CHECK_EQUAL( generator.getMaximumRelativeError(), 0.5 );
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 5.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalToLowerWeightRatio(), 3.0 );
+  FRENSIE_CHECK_EQUAL( generator.getReferenceLowerWeight(), 0.5 );
+  FRENSIE_CHECK( generator.getWeightWindowMap().empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that invalid window parameters are rejected
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, invalid_parameters )
+{
+  FRENSIE_CHECK_THROW( MonteCarlo::WeightWindowMeshGenerator(
+                                            mesh, std::vector<double>( 1, 1.0 ) ),
+                       std::runtime_error );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  FRENSIE_CHECK_THROW( generator.setMaximumRelativeError( 0.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setUpperToLowerWeightRatio( 2.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setSurvivalToLowerWeightRatio( 6.0 ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( generator.setReferenceLowerWeight( -1.0 ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the flux estimator can be created
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, createFluxEstimator )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedMeshTrackLengthFluxEstimator>
+    estimator = generator.createFluxEstimator( 3, MonteCarlo::PHOTON );
+
+  FRENSIE_CHECK_EQUAL( estimator->getId(), 3 );
+  FRENSIE_CHECK( estimator->isMeshEstimator() );
+  FRENSIE_CHECK( estimator->isParticleTypeAssigned( MonteCarlo::PHOTON ) );
+  FRENSIE_CHECK( !estimator->isParticleTypeAssigned( MonteCarlo::NEUTRON ) );
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins(), 2 );
+  FRENSIE_CHECK_EQUAL( estimator->getNumberOfBins( MonteCarlo::OBSERVER_ENERGY_DIMENSION ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be generated
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateWeightWindows )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createFluxEstimator( generator );
+
+  // The element 0 energy bin 1 flux has a relative error of 0.707 and the
+  // element 1 energy bin 1 flux is zero - both will be ignored
+  generator.generateWeightWindows( *estimator );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    weight_window_map = generator.getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( 0 ).size(), 2 );
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.at( 1 ).size(), 2 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].upper_weight, 2.5, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].survival_weight, 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].upper_weight, 1.25, 1e-15 );
+
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 0 )[1].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 0 )[1].survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 0 )[1].upper_weight,
+                       std::numeric_limits<double>::infinity() );
+
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].survival_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].upper_weight,
+                       std::numeric_limits<double>::infinity() );
+
+  // Accept the element 0 energy bin 1 flux
+  generator.setMaximumRelativeError( 1.0 );
+  generator.generateWeightWindows( *estimator );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].upper_weight, 2.5, 1e-15 );
+
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].lower_weight, 0.0 );
+
+  // Ignored fluxes keep the windows from the previous iteration
+  generator.setMaximumRelativeError( 0.5 );
+  generator.setReferenceLowerWeight( 1.0 );
+  generator.generateWeightWindows( *estimator );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].lower_weight, 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].lower_weight, 0.5, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that consistent weight windows and source biasing can be generated
+// from adjoint data
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, generateAdjointWeightWindows )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+  generator.setMaximumRelativeError( 1.0 );
+
+  // The flux estimator data is used as the adjoint flux data
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createFluxEstimator( generator );
+
+  MonteCarlo::WeightWindowMeshGenerator::SourceElementProbabilityMap
+    source_element_probabilities;
+  source_element_probabilities[0] = 1.0;
+
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+    source_energy_distribution( new Utility::UniformDistribution( 0.0, 2.0, 1.0 ) );
+
+  // The source adjoint fluxes are 1.0 and 0.5 - the response estimate is 0.75
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    biased_source_energy_distribution =
+    generator.generateAdjointWeightWindows( *estimator,
+                                            source_element_probabilities,
+                                            source_energy_distribution );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    weight_window_map = generator.getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].survival_weight, 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].upper_weight, 1.25, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].upper_weight, 2.5, 1e-15 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].lower_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].survival_weight, 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].upper_weight, 2.5, 1e-15 );
+
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].lower_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( weight_window_map.at( 1 )[1].upper_weight,
+                       std::numeric_limits<double>::infinity() );
+
+  // The birth weights must match the source element survival weights
+  FRENSIE_CHECK_EQUAL( biased_source_energy_distribution->getDimension(),
+                       MonteCarlo::ENERGY_DIMENSION );
+
+  std::shared_ptr<const Utility::SpatialCoordinateConversionPolicy>
+    spatial_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  std::shared_ptr<const Utility::DirectionalCoordinateConversionPolicy>
+    directional_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  // The biased bin probabilities are 2/3 and 1/3
+  std::vector<double> fake_stream = {0.25, 0.75, 0.9, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 0.75, 1e-15 );
+
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 1.5, 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The shape of the source energy distribution is kept in each energy bin
+  // (q(E) = (1+E)/4) - the source bin probabilities are 0.375 and 0.625 and
+  // the response estimate is 0.6875
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+    linear_source_energy_distribution(
+       new Utility::TabularDistribution<Utility::LinLin>(
+                                       std::vector<double>( {0.0, 2.0} ),
+                                       std::vector<double>( {1.0, 3.0} ) ) );
+
+  biased_source_energy_distribution =
+    generator.generateAdjointWeightWindows( *estimator,
+                                            source_element_probabilities,
+                                            linear_source_energy_distribution );
+
+  // The biased bin probabilities are 0.375/0.6875 and 0.3125/0.6875
+  fake_stream = {0.5, 0.5, 0.6, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), std::sqrt( 2.5 ) - 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 0.6875, 1e-12 );
+
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), std::sqrt( 6.5 ) - 1.0, 1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 1.375, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // Discrete source energy distributions are not supported
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+    discrete_source_energy_distribution(
+           new Utility::DiscreteDistribution( std::vector<double>( {0.5, 1.5} ),
+                                              std::vector<double>( 2, 1.0 ) ) );
+
+  FRENSIE_CHECK_THROW( generator.generateAdjointWeightWindows(
+                                         *estimator,
+                                         source_element_probabilities,
+                                         discrete_source_energy_distribution ),
+                       std::runtime_error );
+
+  // The source must be contained in the energy bins
+  source_energy_distribution.reset( new Utility::UniformDistribution( 0.0, 3.0, 1.0 ) );
+
+  FRENSIE_CHECK_THROW( generator.generateAdjointWeightWindows(
+                                                  *estimator,
+                                                  source_element_probabilities,
+                                                  source_energy_distribution ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that source elements without a converged adjoint flux do not
+// contribute to the source adjoint flux
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator,
+                   generateAdjointWeightWindows_multiple_source_elements )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+  generator.setMaximumRelativeError( 1.0 );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createFluxEstimator( generator );
+
+  MonteCarlo::WeightWindowMeshGenerator::SourceElementProbabilityMap
+    source_element_probabilities;
+  source_element_probabilities[0] = 0.5;
+  source_element_probabilities[1] = 0.5;
+
+  std::shared_ptr<const Utility::TabularUnivariateDistribution>
+    source_energy_distribution( new Utility::UniformDistribution( 0.0, 2.0, 1.0 ) );
+
+  // The source adjoint fluxes are 0.75 and 0.5 (element 1 has no flux in
+  // energy bin 1) - the response estimate is 0.625
+  std::shared_ptr<const MonteCarlo::PhaseSpaceDimensionDistribution>
+    biased_source_energy_distribution =
+    generator.generateAdjointWeightWindows( *estimator,
+                                            source_element_probabilities,
+                                            source_energy_distribution );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    weight_window_map = generator.getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].survival_weight, 0.625, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[1].survival_weight, 1.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].survival_weight, 1.25, 1e-15 );
+
+  std::shared_ptr<const Utility::SpatialCoordinateConversionPolicy>
+    spatial_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  std::shared_ptr<const Utility::DirectionalCoordinateConversionPolicy>
+    directional_coord_conversion_policy( new Utility::BasicCartesianCoordinateConversionPolicy );
+
+  // The biased bin probabilities are 0.6 and 0.4
+  std::vector<double> fake_stream = {0.25, 0.5, 0.9, 0.5};
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  MonteCarlo::PhaseSpacePoint point( spatial_coord_conversion_policy,
+                                     directional_coord_conversion_policy );
+
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 0.625/0.75, 1e-15 );
+
+  // The birth weight in energy bin 1 matches the survival weight of the only
+  // source element with a converged adjoint flux
+  biased_source_energy_distribution->sampleWithoutCascade( point );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinate<MonteCarlo::ENERGY_DIMENSION>( point ), 1.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( MonteCarlo::getCoordinateWeight<MonteCarlo::ENERGY_DIMENSION>( point ), 1.25, 1e-15 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight windows can be loaded into a weight window mesh
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, createWeightWindowMesh )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createFluxEstimator( generator );
+
+  generator.generateWeightWindows( *estimator );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMesh> weight_window_mesh =
+    generator.createWeightWindowMesh();
+
+  FRENSIE_CHECK_EQUAL( weight_window_mesh->getMesh(), mesh );
+
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 0.5 );
+  photon.setPosition( 1.5, 0.5, 0.5 );
+
+  const MonteCarlo::WeightWindow& weight_window =
+    weight_window_mesh->getWeightWindow( photon );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.survival_weight, 0.75, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window.upper_weight, 1.25, 1e-15 );
+
+  // Particles in an element without a converged flux are left alone
+  photon.setEnergy( 1.5 );
+  photon.setWeight( 1e6 );
+
+  MonteCarlo::ParticleBank bank;
+
+  weight_window_mesh->checkParticleWithPopulationController( photon, bank );
+
+  FRENSIE_CHECK_EQUAL( bank.size(), 0 );
+  FRENSIE_CHECK_EQUAL( photon.getWeight(), 1e6 );
+  FRENSIE_CHECK( !photon.isGone() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weight window map can be set
+FRENSIE_UNIT_TEST( WeightWindowMeshGenerator, setWeightWindowMap )
+{
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  std::shared_ptr<MonteCarlo::Estimator> estimator =
+    createFluxEstimator( generator );
+
+  generator.generateWeightWindows( *estimator );
+
+  MonteCarlo::WeightWindowMeshGenerator other_generator( mesh,
+                                                         energy_bin_boundaries );
+
+  other_generator.setWeightWindowMap( generator.getWeightWindowMap() );
+
+  FRENSIE_REQUIRE_EQUAL( other_generator.getWeightWindowMap().size(),
+                         generator.getWeightWindowMap().size() );
+
+  for( auto&& element_windows : generator.getWeightWindowMap() )
+  {
+    const std::vector<MonteCarlo::WeightWindow>& other_element_windows =
+      other_generator.getWeightWindowMap().find( element_windows.first )->second;
+
+    FRENSIE_REQUIRE_EQUAL( other_element_windows.size(),
+                           element_windows.second.size() );
+
+    for( size_t i = 0; i < element_windows.second.size(); ++i )
+    {
+      FRENSIE_CHECK_EQUAL( other_element_windows[i].lower_weight,
+                           element_windows.second[i].lower_weight );
+    }
+  }
+
+  // The windows must match the energy bins
+  MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap
+    invalid_weight_window_map;
+
+  invalid_weight_window_map[0].resize( energy_bin_boundaries.size() );
+
+  FRENSIE_CHECK_THROW( other_generator.setWeightWindowMap( invalid_weight_window_map ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( WeightWindowMeshGenerator,
+                                   archive,
+                                   TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_weight_window_mesh_generator" );
+  std::ostringstream archive_ostream;
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                     energy_bin_boundaries );
+
+    generator.setUpperToLowerWeightRatio( 4.0 );
+    generator.setSurvivalToLowerWeightRatio( 2.0 );
+    generator.setReferenceLowerWeight( 0.25 );
+
+    std::shared_ptr<MonteCarlo::Estimator> estimator =
+      createFluxEstimator( generator );
+
+    generator.generateWeightWindows( *estimator );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << BOOST_SERIALIZATION_NVP( generator ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived generator
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  MonteCarlo::WeightWindowMeshGenerator generator( mesh,
+                                                   energy_bin_boundaries );
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> BOOST_SERIALIZATION_NVP( generator ) );
+
+  iarchive.reset();
+
+  FRENSIE_CHECK_EQUAL( generator.getMesh()->getNumberOfElements(), 2 );
+  FRENSIE_CHECK_EQUAL( generator.getEnergyBinBoundaries(),
+                       energy_bin_boundaries );
+  FRENSIE_CHECK_EQUAL( generator.getUpperToLowerWeightRatio(), 4.0 );
+  FRENSIE_CHECK_EQUAL( generator.getSurvivalToLowerWeightRatio(), 2.0 );
+  FRENSIE_CHECK_EQUAL( generator.getReferenceLowerWeight(), 0.25 );
+
+  const MonteCarlo::WeightWindowMeshGenerator::WeightWindowMap&
+    weight_window_map = generator.getWeightWindowMap();
+
+  FRENSIE_REQUIRE_EQUAL( weight_window_map.size(), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].lower_weight, 0.25, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].survival_weight, 0.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 0 )[0].upper_weight, 1.0, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( weight_window_map.at( 1 )[0].lower_weight, 0.125, 1e-15 );
+}
+
+//---------------------------------------------------------------------------//
+// Custom Setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  std::vector<double> x_planes = {0.0, 1.0, 2.0};
+  std::vector<double> y_planes = {0.0, 1.0};
+  std::vector<double> z_planes = {0.0, 1.0};
+
+  mesh = std::make_shared<Utility::StructuredHexMesh>( x_planes,
+                                                       y_planes,
+                                                       z_planes );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshGenerator.cpp
+//---------------------------------------------------------------------------//
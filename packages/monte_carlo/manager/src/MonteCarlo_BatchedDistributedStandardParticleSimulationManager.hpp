@@ -15,7 +15,15 @@
 
 namespace MonteCarlo{
 
-//! The batched distributed standard particle simulation manager
+/*! The batched distributed standard particle simulation manager
+ * \details The root process runs histories on its own threads and hands out
+ * work to the worker processes between its own (smaller) tasks. Workers
+ * request their next task before starting the current one so that the
+ * request/assignment round trip is hidden behind the transport. The size of
+ * each task is scaled by the measured history rate of the process that will
+ * run it and tasks shrink as the end of a rendezvous batch approaches so
+ * that all processes finish at approximately the same time.
+ */
 template<ParticleModeType mode>
 class BatchedDistributedStandardParticleSimulationManager : public StandardParticleSimulationManager<mode>
 {
@@ -61,6 +69,16 @@ protected:
   //! The signal handler
   void signalHandler( int signal ) final override;
 
+  //! Create a task for a process
+  std::pair<uint64_t,uint64_t> createTask( const int process,
+                                           const uint64_t assigned_histories ) const;
+
+  //! Calculate the task size for a process
+  uint64_t calculateTaskSize( const int process ) const;
+
+  //! Set the measured history rate (histories/s) of a process
+  void setProcessHistoryRate( const int process, const double history_rate );
+
 private:
 
   // Coorindate workers
@@ -69,15 +87,29 @@ private:
   // Tell workers to stop working
   void stopWorkersAndRecordWork( const bool simulation_complete,
                                  const bool rendezvous_required,
-                                 const uint64_t batch_number );
+                                 const uint64_t assigned_histories );
 
   // Check for idle worker
   bool isIdleWorkerPresent( Utility::Communicator::Status& idle_worker_info );
 
+  // Wait for the work request of a worker
+  void waitForWorkRequest( const int worker,
+                           Utility::Communicator::Status& idle_worker_info );
+
+  // Receive the work request (and history rate) from an idle worker
+  void receiveWorkRequest( const Utility::Communicator::Status& idle_worker_info );
+
   // Assign work to idle worker
   void assignWorkToIdleWorker( const Utility::Communicator::Status& idle_worker_info,
                                const std::pair<uint64_t,uint64_t>& task );
 
+  // Run a simulation batch and return the history rate (histories/s)
+  double runTimedSimulationBatch( const uint64_t batch_start_history,
+                                  const uint64_t batch_end_history );
+
+  // Request work from the root process
+  void requestWork( const double history_rate );
+
   // Complete assigned work
   void work();
 
@@ -86,6 +118,9 @@ private:
 
   // The number of batches per rendezvous
   uint64_t d_batches_per_rendezvous;
+
+  // The measured history rate (histories/s) of each process
+  std::vector<double> d_process_history_rates;
 };
   
 } // end MonteCarlo namespace
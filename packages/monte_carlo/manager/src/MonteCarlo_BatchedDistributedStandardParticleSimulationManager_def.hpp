@@ -10,6 +10,7 @@
 #define MONTE_CARLO_BATCHED_DISTRIBUTED_PARTICLE_SIMULATION_MANAGER_DEF_HPP
 
 // FRENSIE Includes
+#include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace MonteCarlo{
@@ -41,16 +42,18 @@ BatchedDistributedStandardParticleSimulationManager<mode>::BatchedDistributedSta
                                              rendezvous_number,
                                              use_single_rendezvous_file ),
   d_comm( comm ),
-  d_batches_per_rendezvous( 0 )
+  d_batches_per_rendezvous( 0 ),
+  d_process_history_rates( comm->size(), 0.0 )
 {
   // Make sure that the communicator pointer is valid
   testPrecondition( comm.get() );
   // Make sure that the communicator is not a serial communicator
   testPrecondition( comm->size() > 1 );
 
-  // Calculate the batch size
+  // Calculate the number of batches per rendezvous (the root process
+  // also runs histories)
   d_batches_per_rendezvous =
-    properties->getNumberOfBatchesPerProcessor()*(comm->size()-1);
+    properties->getNumberOfBatchesPerProcessor()*comm->size();
 
   // Calculate the batch size
   uint64_t batch_size =
@@ -124,6 +127,8 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
   // The simulation has finished
   this->registerSimulationStoppedEvent();
 
+  this->waitForPendingRendezvousArchive();
+
   if( d_comm->rank() == 0 )
   {
     FRENSIE_LOG_NOTIFICATION( "Simulation finished. " );
@@ -135,11 +140,22 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::runSimulation()
 }
 
 // Coorindate workers
+/*! \details The root process services all pending work requests and then
+ * runs a task of its own. Since the workers request their next task before
+ * starting their current one, the root process only needs to check for
+ * requests between its own tasks - it never waits in a polling loop. At the
+ * start of each rendezvous batch the workers are still finishing the
+ * rendezvous, so the root process waits for the first work request of every
+ * worker before it runs its first task of the batch, which is limited to half
+ * of the smallest task that was assigned to a worker (the next work requests
+ * of the workers can then be serviced before the workers finish their
+ * first tasks).
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorkers()
 {
-  // The current batch number
-  uint64_t batch_number = 0;
+  // The number of histories in the rendezvous batch that have been assigned
+  uint64_t assigned_histories = 0;
 
   // The batch info (start history, end history + 1)
   std::pair<uint64_t,uint64_t> task;
@@ -148,49 +164,100 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::coordinateWorker
   Utility::Communicator::Status idle_worker_info;
 
   bool rendezvous_required = false;
-  
+
   while( true )
   {
     if( this->isSimulationComplete() )
     {
-      this->stopWorkersAndRecordWork( true, rendezvous_required, batch_number );
+      this->stopWorkersAndRecordWork( true, rendezvous_required, assigned_histories );
 
       break;
     }
-    else if( batch_number == d_batches_per_rendezvous )
+    else if( assigned_histories == this->getRendezvousBatchSize() )
     {
-      this->stopWorkersAndRecordWork( false, true, batch_number );
-      
+      this->stopWorkersAndRecordWork( false, true, assigned_histories );
+
       // The rendezvous is complete
       rendezvous_required = false;
-      
-      // Reset the batch number
-      batch_number = 0;
-      
+
+      // Reset the number of assigned histories
+      assigned_histories = 0;
+
       continue;
     }
-    else if( this->isIdleWorkerPresent( idle_worker_info ) )
+
+    // Assign work to every worker at the start of a rendezvous batch
+    if( assigned_histories == 0 )
     {
-      // Set the batch start history
-      task.first = this->getNextHistory() + batch_number*this->getBatchSize();
-      
-      task.second = task.first + this->getBatchSize();
+      uint64_t min_worker_task_size = this->getRendezvousBatchSize();
+
+      for( int i = 1; i < d_comm->size(); ++i )
+      {
+        if( assigned_histories == this->getRendezvousBatchSize() )
+          break;
+
+        this->waitForWorkRequest( i, idle_worker_info );
+
+        this->receiveWorkRequest( idle_worker_info );
+
+        task = this->createTask( i, assigned_histories );
+
+        this->assignWorkToIdleWorker( idle_worker_info, task );
+
+        assigned_histories += task.second - task.first;
+
+        min_worker_task_size =
+          std::min( min_worker_task_size, task.second - task.first );
+
+        // A rendezvous is required
+        rendezvous_required = true;
+      }
 
-      // Check if the size of the last batch is correct
-      if( batch_number == d_batches_per_rendezvous - 1 )
+      // Run a short task on the root process
+      if( assigned_histories < this->getRendezvousBatchSize() )
       {
-        task.second += this->getRendezvousBatchSize() -
-          d_batches_per_rendezvous*this->getBatchSize();
+        task = this->createTask( 0, assigned_histories );
+
+        if( task.second - task.first > min_worker_task_size/2 )
+          task.second = task.first + std::max( min_worker_task_size/2, (uint64_t)1 );
+
+        assigned_histories += task.second - task.first;
+
+        d_process_history_rates[0] =
+          this->runTimedSimulationBatch( task.first, task.second );
       }
 
+      continue;
+    }
+
+    // Assign work to all of the idle workers
+    while( assigned_histories < this->getRendezvousBatchSize() &&
+           this->isIdleWorkerPresent( idle_worker_info ) )
+    {
+      this->receiveWorkRequest( idle_worker_info );
+
+      task = this->createTask( idle_worker_info.source(), assigned_histories );
+
       this->assignWorkToIdleWorker( idle_worker_info, task );
 
-      // Increment the batch number
-      ++batch_number;
+      assigned_histories += task.second - task.first;
 
       // A rendezvous is required
       rendezvous_required = true;
     }
+
+    // Run a task on the root process
+    if( assigned_histories < this->getRendezvousBatchSize() )
+    {
+      task = this->createTask( 0, assigned_histories );
+
+      assigned_histories += task.second - task.first;
+
+      rendezvous_required = true;
+
+      d_process_history_rates[0] =
+        this->runTimedSimulationBatch( task.first, task.second );
+    }
   }
 }
 
@@ -199,11 +266,11 @@ template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRecordWork(
                                                 const bool simulation_complete,
                                                 const bool rendezvous_required,
-                                                const uint64_t batch_number )
+                                                const uint64_t assigned_histories )
 {
-  // The idle worker messages
-  std::vector<int> idle_worker_messages( d_comm->size()-1 );
-  
+  // The idle worker messages (history rates)
+  std::vector<double> idle_worker_messages( d_comm->size()-1 );
+
   // The request for each worker
   std::vector<Utility::Communicator::Request> requests;
 
@@ -233,7 +300,7 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
     EXCEPTION_CATCH_RETHROW( std::runtime_error,
                              "Uable to receie message on root process from "
                              "worker process " << i << "!" );
-    
+
     try{
       requests.push_back( Utility::isend( *d_comm, i, 0, stop_message ) );
     }
@@ -247,16 +314,20 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::stopWorkersAndRe
 
   Utility::wait( requests, statuses );
 
+  // Record the latest history rates of the workers
+  for( int i = 1; i < d_comm->size(); ++i )
+  {
+    if( idle_worker_messages[i-1] > 0.0 )
+      d_process_history_rates[i] = idle_worker_messages[i-1];
+  }
+
   // Increment the next history
-  if( batch_number == d_batches_per_rendezvous )
-    this->incrementNextHistory( this->getRendezvousBatchSize() );
-  else
-    this->incrementNextHistory( batch_number*this->getBatchSize() );
+  this->incrementNextHistory( assigned_histories );
 
   // Rendezvous after rendezvous batch completed
   if( !simulation_complete )
     this->rendezvous();
-  
+
   // Rendezvous after simulation completed (if required)
   else if( rendezvous_required )
     this->rendezvous();
@@ -268,7 +339,7 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
 {
   // Probe for an idle worker
   try{
-    idle_worker_info = Utility::iprobe<int>( *d_comm );
+    idle_worker_info = Utility::iprobe<double>( *d_comm );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to probe for idle worker on root "
@@ -277,27 +348,49 @@ bool BatchedDistributedStandardParticleSimulationManager<mode>::isIdleWorkerPres
   return idle_worker_info.hasMessageDetails();
 }
 
-// Assign work to idle worker
+// Wait for the work request of a worker
 template<ParticleModeType mode>
-void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
-                         const Utility::Communicator::Status& idle_worker_info,
-                         const std::pair<uint64_t,uint64_t>& task )
+void BatchedDistributedStandardParticleSimulationManager<mode>::waitForWorkRequest(
+                            const int worker,
+                            Utility::Communicator::Status& idle_worker_info )
 {
-  // Contact the idle worker
-  int idle_worker_message;
-  
+  try{
+    idle_worker_info = Utility::probe<double>( *d_comm, worker, 0 );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to probe for the work request of worker "
+                           "process " << worker << " on root process!" );
+}
+
+// Receive the work request (and history rate) from an idle worker
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::receiveWorkRequest(
+                        const Utility::Communicator::Status& idle_worker_info )
+{
+  double history_rate;
+
   try{
     Utility::receive( *d_comm,
                       idle_worker_info.source(),
                       idle_worker_info.tag(),
-                      idle_worker_message );
+                      history_rate );
   }
   EXCEPTION_CATCH_RETHROW( std::runtime_error,
                            "Unable to receive message on root process from "
                            "worker process "
                            << idle_worker_info.source() << "!" );
 
-  // Assign the task to the worker
+  // A rate of zero indicates that the worker has not completed a task yet
+  if( history_rate > 0.0 )
+    d_process_history_rates[idle_worker_info.source()] = history_rate;
+}
+
+// Assign work to idle worker
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdleWorker(
+                         const Utility::Communicator::Status& idle_worker_info,
+                         const std::pair<uint64_t,uint64_t>& task )
+{
   try{
     Utility::send( *d_comm,
                    idle_worker_info.source(),
@@ -310,37 +403,192 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::assignWorkToIdle
                            << idle_worker_info.source() << "!" );
 }
 
+// Create a task for a process
+/*! \details The task size will be limited to an even share of the
+ * histories that have not been assigned yet (guided scheduling) so that the
+ * processes finish the rendezvous batch at approximately the same time.
+ */
+template<ParticleModeType mode>
+std::pair<uint64_t,uint64_t>
+BatchedDistributedStandardParticleSimulationManager<mode>::createTask(
+                                     const int process,
+                                     const uint64_t assigned_histories ) const
+{
+  // Make sure that there are unassigned histories
+  testPrecondition( assigned_histories < this->getRendezvousBatchSize() );
+
+  const uint64_t unassigned_histories =
+    this->getRendezvousBatchSize() - assigned_histories;
+
+  uint64_t task_size = this->calculateTaskSize( process );
+
+  // The root process runs smaller tasks so that the work requests of the
+  // workers can be serviced before the workers finish their current tasks
+  if( process == 0 )
+    task_size /= 2;
+
+  const uint64_t max_task_size = unassigned_histories/d_comm->size();
+
+  if( task_size > max_task_size )
+    task_size = max_task_size;
+
+  if( task_size == 0 )
+    task_size = 1;
+
+  std::pair<uint64_t,uint64_t> task;
+
+  task.first = this->getNextHistory() + assigned_histories;
+  task.second = task.first + task_size;
+
+  return task;
+}
+
+// Calculate the task size for a process
+/*! \details The default batch size is scaled by the ratio of the measured
+ * history rate of the process to the mean history rate of all processes.
+ * Until the history rate of the process has been measured the default batch
+ * size will be used.
+ */
+template<ParticleModeType mode>
+uint64_t BatchedDistributedStandardParticleSimulationManager<mode>::calculateTaskSize(
+                                                     const int process ) const
+{
+  const double process_history_rate = d_process_history_rates[process];
+
+  if( process_history_rate > 0.0 )
+  {
+    double history_rate_sum = 0.0;
+    size_t number_of_measured_processes = 0;
+
+    for( size_t i = 0; i < d_process_history_rates.size(); ++i )
+    {
+      if( d_process_history_rates[i] > 0.0 )
+      {
+        history_rate_sum += d_process_history_rates[i];
+
+        ++number_of_measured_processes;
+      }
+    }
+
+    const double mean_history_rate =
+      history_rate_sum/number_of_measured_processes;
+
+    return static_cast<uint64_t>( this->getBatchSize()*
+                                  process_history_rate/mean_history_rate );
+  }
+  else
+    return this->getBatchSize();
+}
+
+// Set the measured history rate (histories/s) of a process
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::setProcessHistoryRate(
+                                                    const int process,
+                                                    const double history_rate )
+{
+  // Make sure that the process is valid
+  testPrecondition( process >= 0 );
+  testPrecondition( process < d_comm->size() );
+  // Make sure that the history rate is valid
+  testPrecondition( history_rate >= 0.0 );
+
+  d_process_history_rates[process] = history_rate;
+}
+
+// Run a simulation batch and return the history rate (histories/s)
+template<ParticleModeType mode>
+double BatchedDistributedStandardParticleSimulationManager<mode>::runTimedSimulationBatch(
+                                            const uint64_t batch_start_history,
+                                            const uint64_t batch_end_history )
+{
+  std::shared_ptr<Utility::Timer> batch_timer =
+    Utility::OpenMPProperties::createTimer();
+
+  batch_timer->start();
+
+  this->runSimulationBatch( batch_start_history, batch_end_history );
+
+  batch_timer->stop();
+
+  const double batch_time = batch_timer->elapsed().count();
+
+  if( batch_time > 0.0 )
+    return (batch_end_history - batch_start_history)/batch_time;
+  else
+    return 0.0;
+}
+
+// Request work from the root process
+template<ParticleModeType mode>
+void BatchedDistributedStandardParticleSimulationManager<mode>::requestWork(
+                                                    const double history_rate )
+{
+  try{
+    Utility::send( *d_comm, 0, 0, history_rate );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Worker process " << d_comm->rank() <<
+                           " unable to request work from root process!" );
+}
+
 // Complete assigned work
+/*! \details The next task is requested (along with the history rate of the
+ * previous task) before the current task is started so that the root process
+ * has the duration of the current task to respond.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::work()
 {
-  std::pair<uint64_t,uint64_t> task;
+  std::pair<uint64_t,uint64_t> task, next_task;
+
+  // The history rate of the last completed task
+  double history_rate = 0.0;
+
+  bool task_requested = false;
 
-  int idle_message = 1;
-  
   while( true )
   {
     // Tell the root process that a new task can be done
-    try{
-      Utility::send( *d_comm, 0, 0, idle_message );
-    }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Worker process " << d_comm->rank() <<
-                             " unable to request work from root process!" );
+    if( !task_requested )
+    {
+      this->requestWork( history_rate );
 
-    // Get the task from the root process
-    try{
-      Utility::receive( *d_comm, 0, 0, task );
+      // Get the task from the root process
+      try{
+        Utility::receive( *d_comm, 0, 0, task );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Worker process " << d_comm->rank() <<
+                               " unable to receive work from root process!" );
     }
-    EXCEPTION_CATCH_RETHROW( std::runtime_error,
-                             "Worker process " << d_comm->rank() <<
-                             " unable to receive work from root process!" );
 
     // Run the simulation batch
     if( task.first != task.second )
-      this->runSimulationBatch( task.first, task.second );
+    {
+      // Request the next task before running the simulation batch
+      this->requestWork( history_rate );
+
+      Utility::Communicator::Request next_task_request;
+
+      try{
+        next_task_request = Utility::ireceive( *d_comm, 0, 0, next_task );
+      }
+      EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                               "Worker process " << d_comm->rank() <<
+                               " unable to receive work from root process!" );
+
+      history_rate = this->runTimedSimulationBatch( task.first, task.second );
+
+      next_task_request.wait();
+
+      task = next_task;
+
+      task_requested = true;
+    }
     else
     {
+      task_requested = false;
+
       // Rendezvous with the root process
       if( task.first < 2 )
         this->rendezvous();
@@ -378,6 +626,11 @@ void BatchedDistributedStandardParticleSimulationManager<mode>::signalHandler( i
 { /* ... */ }
 
 // Rendezvous (cache state)
+/*! \details The observer data is always reduced to the root process, which
+ * blocks every process. In asynchronous rendezvous mode the worker processes
+ * will then only wait for the root process to serialize the state - the
+ * archive will be written to disk while the next batches are simulated.
+ */
 template<ParticleModeType mode>
 void BatchedDistributedStandardParticleSimulationManager<mode>::rendezvous()
 {
@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+FissionSiteBank::FissionSiteBank()
+  : d_thread_data( 1 )
+{
+  d_thread_data[0].current_history = std::numeric_limits<uint64_t>::max();
+  d_thread_data[0].next_site_index = 0;
+}
+
+// Enable thread support
+/*! \details Any sites that have already been added will be discarded.
+ */
+void FissionSiteBank::enableThreadSupport( const unsigned threads )
+{
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  d_thread_data.clear();
+  d_thread_data.resize( threads );
+
+  this->clear();
+}
+
+// Add a fission site (thread safe)
+/*! \details Each thread must only add sites to the bank while it is
+ * simulating the history that created them.
+ */
+void FissionSiteBank::addSite( const NeutronState& neutron )
+{
+  // Make sure that thread support has been enabled
+  testPrecondition( Utility::OpenMPProperties::getThreadId() <
+                    d_thread_data.size() );
+
+  ThreadData& thread_data =
+    d_thread_data[Utility::OpenMPProperties::getThreadId()];
+
+  if( neutron.getHistoryNumber() != thread_data.current_history )
+  {
+    thread_data.current_history = neutron.getHistoryNumber();
+    thread_data.next_site_index = 0;
+  }
+
+  FissionSite site;
+  site.parent_history = thread_data.current_history;
+  site.site_index = thread_data.next_site_index;
+  site.position[0] = neutron.getXPosition();
+  site.position[1] = neutron.getYPosition();
+  site.position[2] = neutron.getZPosition();
+  site.direction[0] = neutron.getXDirection();
+  site.direction[1] = neutron.getYDirection();
+  site.direction[2] = neutron.getZDirection();
+  site.energy = neutron.getEnergy();
+  site.weight = neutron.getWeight();
+
+  thread_data.sites.push_back( site );
+
+  ++thread_data.next_site_index;
+}
+
+// Return the number of sites stored by all threads
+size_t FissionSiteBank::getNumberOfSites() const
+{
+  size_t number_of_sites = 0;
+
+  for( size_t i = 0; i < d_thread_data.size(); ++i )
+    number_of_sites += d_thread_data[i].sites.size();
+
+  return number_of_sites;
+}
+
+// Return the total weight of the sites stored by all threads
+double FissionSiteBank::getTotalWeight() const
+{
+  double total_weight = 0.0;
+
+  for( size_t i = 0; i < d_thread_data.size(); ++i )
+  {
+    for( size_t j = 0; j < d_thread_data[i].sites.size(); ++j )
+      total_weight += d_thread_data[i].sites[j].weight;
+  }
+
+  return total_weight;
+}
+
+// Remove all sites
+/*! \details The storage used by each thread is retained.
+ */
+void FissionSiteBank::clear()
+{
+  for( size_t i = 0; i < d_thread_data.size(); ++i )
+  {
+    d_thread_data[i].sites.clear();
+    d_thread_data[i].current_history = std::numeric_limits<uint64_t>::max();
+    d_thread_data[i].next_site_index = 0;
+  }
+}
+
+// Move the sites stored by all threads into a sorted container
+/*! \details The sites will be appended to the container and the entire
+ * container will then be sorted. The bank will be empty after this call.
+ */
+void FissionSiteBank::extractSortedSites( std::vector<FissionSite>& sites )
+{
+  sites.reserve( sites.size() + this->getNumberOfSites() );
+
+  for( size_t i = 0; i < d_thread_data.size(); ++i )
+  {
+    sites.insert( sites.end(),
+                  d_thread_data[i].sites.begin(),
+                  d_thread_data[i].sites.end() );
+  }
+
+  std::sort( sites.begin(), sites.end() );
+
+  this->clear();
+}
+
+// Resample the sites (systematic sampling weighted by site weight)
+/*! \details The sites are sampled with probability proportional to their
+ * weight. The comb offset is the position of the first tooth of the comb as
+ * a fraction of the tooth spacing and should be a random number in [0,1) -
+ * a fixed offset would always favor the same sites when the site weights
+ * repeat from one cycle to the next. The resampled sites are assigned a
+ * weight of one. The input sites must be sorted to get a reproducible set of
+ * resampled sites.
+ */
+void FissionSiteBank::resampleSites( const std::vector<FissionSite>& sites,
+                                     const uint64_t number_of_resampled_sites,
+                                     const double comb_offset,
+                                     std::vector<FissionSite>& resampled_sites )
+{
+  // Make sure that the comb offset is valid
+  testPrecondition( comb_offset >= 0.0 );
+  testPrecondition( comb_offset < 1.0 );
+
+  resampled_sites.clear();
+
+  if( sites.empty() || number_of_resampled_sites == 0 )
+    return;
+
+  double total_weight = 0.0;
+
+  for( size_t i = 0; i < sites.size(); ++i )
+    total_weight += sites[i].weight;
+
+  // Make sure that the total weight is valid
+  testInvariant( total_weight > 0.0 );
+
+  resampled_sites.reserve( number_of_resampled_sites );
+
+  const double weight_spacing = total_weight/number_of_resampled_sites;
+
+  size_t site_index = 0;
+  double cumulative_weight = sites[0].weight;
+
+  for( uint64_t i = 0; i < number_of_resampled_sites; ++i )
+  {
+    const double sample_weight = (i + comb_offset)*weight_spacing;
+
+    while( cumulative_weight < sample_weight &&
+           site_index < sites.size() - 1 )
+    {
+      ++site_index;
+
+      cumulative_weight += sites[site_index].weight;
+    }
+
+    resampled_sites.push_back( sites[site_index] );
+    resampled_sites.back().weight = 1.0;
+  }
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,137 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_FissionSiteBank.hpp
+//! \author Alex Robinson
+//! \brief  Fission site bank class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_FISSION_SITE_BANK_HPP
+#define MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/vector.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_NeutronState.hpp"
+
+namespace MonteCarlo{
+
+//! The fission site struct
+struct FissionSite
+{
+  //! The history number of the neutron that caused the fission
+  uint64_t parent_history;
+
+  //! The index of the site within the parent history
+  uint64_t site_index;
+
+  //! The position of the site
+  double position[3];
+
+  //! The direction of the emitted neutron
+  double direction[3];
+
+  //! The energy of the emitted neutron (MeV)
+  double energy;
+
+  //! The weight of the emitted neutron
+  double weight;
+
+  //! Save/load the site to an archive
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( parent_history );
+    ar & BOOST_SERIALIZATION_NVP( site_index );
+    ar & BOOST_SERIALIZATION_NVP( position );
+    ar & BOOST_SERIALIZATION_NVP( direction );
+    ar & BOOST_SERIALIZATION_NVP( energy );
+    ar & BOOST_SERIALIZATION_NVP( weight );
+  }
+};
+
+//! Check if a fission site comes before another fission site
+inline bool operator<( const FissionSite& site_a, const FissionSite& site_b )
+{
+  return site_a.parent_history < site_b.parent_history ||
+    (site_a.parent_history == site_b.parent_history &&
+     site_a.site_index < site_b.site_index);
+}
+
+/*! The fission site bank class
+ *
+ * Each thread stores the fission sites that it creates in its own
+ * container so that no synchronization is required while particles are
+ * being simulated. Every site is tagged with the history that created it
+ * and its index within that history. Because a history is always simulated
+ * by a single thread, sorting the sites by these tags gives an ordering that
+ * does not depend on the number of threads or processes.
+ */
+class FissionSiteBank
+{
+
+public:
+
+  //! Constructor
+  FissionSiteBank();
+
+  //! Destructor
+  ~FissionSiteBank()
+  { /* ... */ }
+
+  //! Enable thread support
+  void enableThreadSupport( const unsigned threads );
+
+  //! Add a fission site (thread safe)
+  void addSite( const NeutronState& neutron );
+
+  //! Return the number of sites stored by all threads
+  size_t getNumberOfSites() const;
+
+  //! Return the total weight of the sites stored by all threads
+  double getTotalWeight() const;
+
+  //! Remove all sites
+  void clear();
+
+  //! Move the sites stored by all threads into a sorted container
+  void extractSortedSites( std::vector<FissionSite>& sites );
+
+  //! Resample the sites (systematic sampling weighted by site weight)
+  static void resampleSites( const std::vector<FissionSite>& sites,
+                             const uint64_t number_of_resampled_sites,
+                             const double comb_offset,
+                             std::vector<FissionSite>& resampled_sites );
+
+private:
+
+  // The thread data
+  struct ThreadData
+  {
+    // The sites created by the thread
+    std::vector<FissionSite> sites;
+
+    // The history that the thread is currently simulating
+    uint64_t current_history;
+
+    // The index that will be assigned to the next site
+    uint64_t next_site_index;
+  };
+
+  // The thread data
+  std::vector<ThreadData> d_thread_data;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_FISSION_SITE_BANK_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_FissionSiteBank.hpp
+//---------------------------------------------------------------------------//
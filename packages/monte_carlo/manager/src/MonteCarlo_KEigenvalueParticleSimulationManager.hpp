@@ -0,0 +1,230 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_KEigenvalueParticleSimulationManager.hpp
+//! \author Alex Robinson
+//! \brief  K-eigenvalue particle simulation manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+#define MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_StandardParticleSimulationManager.hpp"
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "MonteCarlo_ShannonEntropyMesh.hpp"
+#include "Utility_Communicator.hpp"
+
+namespace MonteCarlo{
+
+/*! The k-eigenvalue particle simulation manager
+ *
+ * The fission source is converged with power iteration. Each cycle
+ * simulates a fixed number of neutron histories. Fission neutrons are not
+ * simulated as part of the history that created them. Instead they are
+ * stored as fission sites, and the sites are resampled to create the source
+ * for the next cycle. The first cycle uses the source set up by the user.
+ * Observer contributions from the inactive cycles are discarded. The
+ * generation, collision, absorption and track-length estimates of k are
+ * averaged over the active cycles. Subtracks completed with the delta
+ * tracking method are never registered, so the track-length estimate of k
+ * is turned off when delta tracking is used. The Shannon entropy of the
+ * fission source is reported for every cycle. When more than one process is used,
+ * the histories in each cycle are divided evenly between the processes and
+ * the fission sites are resampled by the root process.
+ */
+template<ParticleModeType mode>
+class KEigenvalueParticleSimulationManager : public StandardParticleSimulationManager<mode>
+{
+
+public:
+
+  //! Constructor
+  KEigenvalueParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<PopulationControl> population_controller,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm );
+
+  //! Destructor
+  ~KEigenvalueParticleSimulationManager()
+  { /* ... */ }
+
+  //! Run the simulation set up by the user
+  void runSimulation() final override;
+
+  //! Run the simulation set up by the user with the ability to interrupt
+  void runInterruptibleSimulation() final override;
+
+  //! Print the simulation data to the desired stream
+  void printSimulationSummary( std::ostream& os ) const final override;
+
+  //! Log the simulation data
+  void logSimulationSummary() const final override;
+
+  //! Return the number of completed cycles
+  unsigned getNumberOfCompletedCycles() const;
+
+  //! Return the generation estimate of k for each completed cycle
+  const std::vector<double>& getGenerationKEstimates() const;
+
+  //! Return the collision estimate of k for each completed cycle
+  const std::vector<double>& getCollisionKEstimates() const;
+
+  //! Return the absorption estimate of k for each completed cycle
+  const std::vector<double>& getAbsorptionKEstimates() const;
+
+  //! Check if the track-length estimate of k is on
+  bool isTrackLengthKEstimatorOn() const;
+
+  //! Return the track-length estimate of k for each completed cycle
+  const std::vector<double>& getTrackLengthKEstimates() const;
+
+  //! Return the Shannon entropy of the fission source for each cycle
+  const std::vector<double>& getShannonEntropies() const;
+
+  //! Calculate the mean and standard deviation of the mean (active cycles)
+  void calculateActiveCycleStatistics( const std::vector<double>& estimates,
+                                       double& mean,
+                                       double& std_dev_of_mean ) const;
+
+protected:
+
+  //! Sample the source particles for a history
+  void sampleSourceParticles( ParticleBank& source_bank,
+                              const uint64_t history ) final override;
+
+  //! Register a particle subtrack ending in a cell event
+  void registerParticleSubtrackEndingInCellEvent(
+                                  const ParticleState& particle,
+                                  const Geometry::Model::EntityId cell,
+                                  const double track_length ) final override;
+
+  //! Register a particle collision event
+  void registerParticleCollisionEvent(
+                        const ParticleState& particle,
+                        const double pre_collision_energy,
+                        const double pre_collision_weight ) final override;
+
+  //! Bank a fission neutron for the next generation
+  bool bankFissionNeutronForNextGeneration(
+                                 const NeutronState& neutron ) final override;
+
+  //! Reset the k estimator scores of every thread
+  void resetKEstimatorScores();
+
+  //! Sum the k estimator scores of every thread
+  void sumKEstimatorScores( double& source_weight,
+                            double& collision_score,
+                            double& absorption_score,
+                            double& track_length_score ) const;
+
+private:
+
+  // The k estimator scores for a thread
+  struct ThreadScores
+  {
+    // The total source weight
+    double source_weight;
+
+    // The collision estimator score
+    double collision;
+
+    // The absorption estimator score
+    double absorption;
+
+    // The track-length estimator score
+    double track_length;
+
+    // Pad the struct to two cache lines so that the scores of neighbouring
+    // threads can never share a cache line (std::vector does not guarantee
+    // cache line alignment of its elements)
+    double padding[12];
+  };
+
+  // Run a cycle
+  void runCycle();
+
+  // Sample the fission site comb offset for the current cycle
+  double sampleCombOffset() const;
+
+  // Check if the current cycle is active
+  bool isCycleActive() const;
+
+  // Print the k estimates
+  void printKEstimates( std::ostream& os ) const;
+
+  // Print the k estimate
+  void printKEstimate( std::ostream& os,
+                       const std::string& estimator_name,
+                       const std::vector<double>& estimates ) const;
+
+  // The filled geometry model
+  std::shared_ptr<const FilledGeometryModel> d_model;
+
+  // The communicator
+  std::shared_ptr<const Utility::Communicator> d_comm;
+
+  // The fission site bank
+  FissionSiteBank d_fission_site_bank;
+
+  // The fission sites that make up the source for the current cycle
+  std::vector<FissionSite> d_source_sites;
+
+  // The Shannon entropy mesh
+  ShannonEntropyMesh d_shannon_entropy_mesh;
+
+  // The k estimator scores for each thread
+  std::vector<ThreadScores> d_thread_scores;
+
+  // Records if the track-length estimate of k is on
+  bool d_track_length_k_estimator_on;
+
+  // The first history of the current cycle
+  uint64_t d_cycle_start_history;
+
+  // The current cycle
+  unsigned d_cycle;
+
+  // The generation estimates of k
+  std::vector<double> d_generation_k_estimates;
+
+  // The collision estimates of k
+  std::vector<double> d_collision_k_estimates;
+
+  // The absorption estimates of k
+  std::vector<double> d_absorption_k_estimates;
+
+  // The track-length estimates of k
+  std::vector<double> d_track_length_k_estimates;
+
+  // The Shannon entropy of the fission source
+  std::vector<double> d_shannon_entropies;
+};
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_KEigenvalueParticleSimulationManager.hpp
+//---------------------------------------------------------------------------//
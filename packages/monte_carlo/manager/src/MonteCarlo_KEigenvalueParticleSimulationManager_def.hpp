@@ -0,0 +1,704 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp
+//! \author Alex Robinson
+//! \brief  K-eigenvalue particle simulation manager class definition
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+#define MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_OpenMPProperties.hpp"
+#include "Utility_JustInTimeInitializer.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+template<ParticleModeType mode>
+KEigenvalueParticleSimulationManager<mode>::KEigenvalueParticleSimulationManager(
+                 const std::string& simulation_name,
+                 const std::string& archive_type,
+                 const std::shared_ptr<const FilledGeometryModel>& model,
+                 const std::shared_ptr<ParticleSource>& source,
+                 const std::shared_ptr<EventHandler>& event_handler,
+                 const std::shared_ptr<PopulationControl> population_controller,
+                 const std::shared_ptr<const CollisionForcer> collision_forcer,
+                 const std::shared_ptr<const SimulationProperties>& properties,
+                 const uint64_t next_history,
+                 const uint64_t rendezvous_number,
+                 const bool use_single_rendezvous_file,
+                 const std::shared_ptr<const Utility::Communicator>& comm )
+  : StandardParticleSimulationManager<mode>( simulation_name,
+                                             archive_type,
+                                             model,
+                                             source,
+                                             event_handler,
+                                             population_controller,
+                                             collision_forcer,
+                                             properties,
+                                             next_history,
+                                             rendezvous_number,
+                                             use_single_rendezvous_file ),
+    d_model( model ),
+    d_comm( comm ),
+    d_fission_site_bank(),
+    d_source_sites(),
+    d_shannon_entropy_mesh(),
+    d_thread_scores( 1 ),
+    d_track_length_k_estimator_on( properties->getTrackingMethod() !=
+                                   DELTA_TRACKING ),
+    d_cycle_start_history( next_history ),
+    d_cycle( 0 ),
+    d_generation_k_estimates(),
+    d_collision_k_estimates(),
+    d_absorption_k_estimates(),
+    d_track_length_k_estimates(),
+    d_shannon_entropies()
+{
+  // Make sure that the communicator pointer is valid
+  testPrecondition( comm.get() );
+
+  TEST_FOR_EXCEPTION( !properties->isKEigenvalueModeOn(),
+                      std::runtime_error,
+                      "K-eigenvalue simulations require at least one "
+                      "active cycle!" );
+
+  TEST_FOR_EXCEPTION( properties->getNumberOfHistoriesPerCycle() <
+                      (uint64_t)comm->size(),
+                      std::runtime_error,
+                      "The number of histories per cycle must be at least "
+                      "the number of processes!" );
+
+  if( !d_track_length_k_estimator_on && comm->rank() == 0 )
+  {
+    FRENSIE_LOG_WARNING( "The track-length estimate of k is not valid when "
+                         "delta tracking is used - it will not be "
+                         "calculated!" );
+  }
+
+  // The k estimators and the fission site bank are updated through the
+  // transport event hooks
+  this->enableTransportEventHooks();
+}
+
+// Run the simulation set up by the user with the ability to interrupt
+/*! \details Distributed simulations cannot be interrupted. The
+ * runSimulation method will be called after issuing a warning.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::runInterruptibleSimulation()
+{
+  if( d_comm->size() > 1 )
+  {
+    if( d_comm->rank() == 0 )
+    {
+      FRENSIE_LOG_WARNING( "Distributed simulations cannot be interrupted!" );
+    }
+
+    this->runSimulation();
+  }
+  else
+    ParticleSimulationManager::runInterruptibleSimulation();
+}
+
+// Run the simulation set up by the user
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::runSimulation()
+{
+  // Make sure that all objects are initialized before running the simulation
+  Utility::JustInTimeInitializer::getInstance().initializeObjectsAndClear();
+
+  d_comm->barrier();
+
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation started. " );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  // Enable thread support
+  this->enableThreadSupport();
+
+  d_fission_site_bank.enableThreadSupport(
+                     Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  d_thread_scores.resize(
+                     Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  // Conduct the first rendezvous (for caching only)
+  if( d_comm->rank() == 0 )
+    ParticleSimulationManager::rendezvous();
+
+  // Reset data on non-root processes to avoid double counting
+  else
+    this->resetData();
+
+  d_comm->barrier();
+
+  // The simulation has started
+  this->registerSimulationStartedEvent();
+
+  const unsigned number_of_cycles =
+    this->getSimulationProperties().getNumberOfInactiveCycles() +
+    this->getSimulationProperties().getNumberOfActiveCycles();
+
+  for( d_cycle = 0; d_cycle < number_of_cycles; ++d_cycle )
+  {
+    // End the simulation if requested (from signal handler)
+    if( this->hasEndSimulationRequestBeenMade() )
+      break;
+
+    this->runCycle();
+
+    // Discard the observer contributions from the inactive cycles
+    if( !this->isCycleActive() )
+      this->resetData();
+  }
+
+  // Combine the observer data from all processes
+  if( d_comm->size() > 1 )
+    this->reduceData( *d_comm, 0 );
+
+  // The simulation has finished
+  this->registerSimulationStoppedEvent();
+
+  if( d_comm->rank() == 0 )
+  {
+    ParticleSimulationManager::rendezvous();
+
+    this->waitForPendingRendezvousArchive();
+
+    if( !this->hasEndSimulationRequestBeenMade() )
+    {
+      FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation finished. " );
+    }
+    else
+    {
+      FRENSIE_LOG_NOTIFICATION( "K-eigenvalue simulation terminated. " );
+    }
+
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+
+  d_comm->barrier();
+}
+
+// Run a cycle
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::runCycle()
+{
+  const uint64_t histories_per_cycle =
+    this->getSimulationProperties().getNumberOfHistoriesPerCycle();
+
+  d_cycle_start_history = this->getNextHistory();
+
+  this->resetKEstimatorScores();
+
+  // Divide the histories in the cycle evenly between the processes
+  const uint64_t start_history = d_cycle_start_history +
+    (histories_per_cycle*d_comm->rank())/d_comm->size();
+
+  const uint64_t end_history = d_cycle_start_history +
+    (histories_per_cycle*(d_comm->rank()+1))/d_comm->size();
+
+  if( start_history < end_history )
+    this->runSimulationBatch( start_history, end_history );
+
+  this->incrementNextHistory( histories_per_cycle );
+
+  // Combine the k estimator scores from all threads and processes
+  std::vector<double> cycle_scores( 6, 0.0 );
+
+  this->sumKEstimatorScores( cycle_scores[0],
+                             cycle_scores[1],
+                             cycle_scores[2],
+                             cycle_scores[3] );
+
+  cycle_scores[4] = d_fission_site_bank.getTotalWeight();
+  cycle_scores[5] = d_fission_site_bank.getNumberOfSites();
+
+  if( d_comm->size() > 1 )
+  {
+    Utility::allReduce( *d_comm,
+                        Utility::arrayView( cycle_scores ),
+                        std::plus<double>() );
+  }
+
+  TEST_FOR_EXCEPTION( cycle_scores[5] == 0.0,
+                      std::runtime_error,
+                      "No fission sites were created in cycle "
+                      << d_cycle+1 << "!" );
+
+  // Collect the fission sites (in a reproducible order)
+  std::vector<FissionSite> sites;
+
+  d_fission_site_bank.extractSortedSites( sites );
+
+  if( d_comm->size() > 1 )
+  {
+    if( d_comm->rank() == 0 )
+    {
+      std::vector<std::vector<FissionSite> > process_sites;
+
+      Utility::gather( *d_comm, sites, process_sites, 0 );
+
+      sites.clear();
+
+      for( size_t i = 0; i < process_sites.size(); ++i )
+      {
+        sites.insert( sites.end(),
+                      process_sites[i].begin(),
+                      process_sites[i].end() );
+      }
+
+      std::sort( sites.begin(), sites.end() );
+    }
+    else
+      Utility::gather( *d_comm, sites, 0 );
+  }
+
+  // Calculate the Shannon entropy and resample the sites for the next cycle
+  double shannon_entropy = 0.0;
+
+  if( d_comm->rank() == 0 )
+  {
+    if( !d_shannon_entropy_mesh.isInitialized() )
+    {
+      d_shannon_entropy_mesh.initialize( sites,
+        this->getSimulationProperties().getShannonEntropyMeshBinsPerDimension() );
+    }
+
+    shannon_entropy = d_shannon_entropy_mesh.calculateEntropy( sites );
+
+    FissionSiteBank::resampleSites( sites,
+                                    histories_per_cycle,
+                                    this->sampleCombOffset(),
+                                    d_source_sites );
+  }
+
+  if( d_comm->size() > 1 )
+  {
+    Utility::broadcast( *d_comm, d_source_sites, 0 );
+    Utility::broadcast( *d_comm, shannon_entropy, 0 );
+  }
+
+  // Record the cycle estimates
+  d_generation_k_estimates.push_back( cycle_scores[4]/cycle_scores[0] );
+  d_collision_k_estimates.push_back( cycle_scores[1]/cycle_scores[0] );
+  d_absorption_k_estimates.push_back( cycle_scores[2]/cycle_scores[0] );
+
+  if( d_track_length_k_estimator_on )
+    d_track_length_k_estimates.push_back( cycle_scores[3]/cycle_scores[0] );
+
+  d_shannon_entropies.push_back( shannon_entropy );
+
+  if( d_comm->rank() == 0 )
+  {
+    FRENSIE_LOG_NOTIFICATION( " Cycle " << d_cycle+1
+                              << (this->isCycleActive() ?
+                                  " (active)" : " (inactive)" )
+                              << ": k = "
+                              << d_generation_k_estimates.back()
+                              << ", H = " << shannon_entropy );
+    FRENSIE_FLUSH_ALL_LOGS();
+  }
+}
+
+// Reset the k estimator scores of every thread
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::resetKEstimatorScores()
+{
+  for( size_t i = 0; i < d_thread_scores.size(); ++i )
+  {
+    d_thread_scores[i].source_weight = 0.0;
+    d_thread_scores[i].collision = 0.0;
+    d_thread_scores[i].absorption = 0.0;
+    d_thread_scores[i].track_length = 0.0;
+  }
+}
+
+// Sum the k estimator scores of every thread
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::sumKEstimatorScores(
+                                      double& source_weight,
+                                      double& collision_score,
+                                      double& absorption_score,
+                                      double& track_length_score ) const
+{
+  source_weight = 0.0;
+  collision_score = 0.0;
+  absorption_score = 0.0;
+  track_length_score = 0.0;
+
+  for( size_t i = 0; i < d_thread_scores.size(); ++i )
+  {
+    source_weight += d_thread_scores[i].source_weight;
+    collision_score += d_thread_scores[i].collision;
+    absorption_score += d_thread_scores[i].absorption;
+    track_length_score += d_thread_scores[i].track_length;
+  }
+}
+
+// Sample the fission site comb offset for the current cycle
+/*! \details Each cycle has its own random number stream so that the
+ * offset does not depend on the number of threads or processes. The streams
+ * are taken from the end of the history stream range, which will never be
+ * reached by the simulated histories.
+ */
+template<ParticleModeType mode>
+double KEigenvalueParticleSimulationManager<mode>::sampleCombOffset() const
+{
+  Utility::LinearCongruentialGenerator generator;
+
+  generator.changeHistory( std::numeric_limits<unsigned long long>::max() -
+                           d_cycle );
+
+  return generator.getRandomNumber();
+}
+
+// Check if the current cycle is active
+template<ParticleModeType mode>
+inline bool KEigenvalueParticleSimulationManager<mode>::isCycleActive() const
+{
+  return d_cycle >=
+    this->getSimulationProperties().getNumberOfInactiveCycles();
+}
+
+// Sample the source particles for a history
+/*! \details The user source is only used in the first cycle. The source
+ * is assumed to create a single particle for each history.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::sampleSourceParticles(
+                                                    ParticleBank& source_bank,
+                                                    const uint64_t history )
+{
+  if( d_source_sites.empty() )
+    ParticleSimulationManager::sampleSourceParticles( source_bank, history );
+  else
+  {
+    const FissionSite& site = d_source_sites[history - d_cycle_start_history];
+
+    std::shared_ptr<NeutronState> neutron( new NeutronState( history ) );
+
+    neutron->setEnergy( site.energy );
+    neutron->setWeight( site.weight );
+    neutron->embedInModel( *d_model, site.position, site.direction );
+
+    source_bank.push( neutron );
+  }
+
+  d_thread_scores[Utility::OpenMPProperties::getThreadId()].source_weight +=
+    source_bank.top().getWeight();
+}
+
+// Register a particle subtrack ending in a cell event
+/*! \details The track-length estimate of k is scored here (unless it has
+ * been turned off because delta tracking is used).
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::registerParticleSubtrackEndingInCellEvent(
+                                          const ParticleState& particle,
+                                          const Geometry::Model::EntityId cell,
+                                          const double track_length )
+{
+  if( particle.getParticleType() != NEUTRON ||
+      !d_track_length_k_estimator_on )
+    return;
+
+  const FilledNeutronGeometryModel& neutron_model = *d_model;
+
+  if( neutron_model.isCellVoid( cell ) )
+    return;
+
+  d_thread_scores[Utility::OpenMPProperties::getThreadId()].track_length +=
+    particle.getWeight()*track_length*
+    neutron_model.getMaterial( cell )->getMacroscopicFissionNeutronProductionCrossSection( particle.getEnergy() );
+}
+
+// Register a particle collision event
+/*! \details The collision and absorption estimates of k are scored here.
+ * The absorption estimator scores the weight removed from the neutron by
+ * the collision (through capture or fission), so it works with both analogue
+ * and implicit capture. In cells that have a temperature the collisions are
+ * sampled with the Doppler broadened total cross section, so the broadened
+ * total and absorption cross sections are used here as well (the fission
+ * cross sections are never broadened).
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::registerParticleCollisionEvent(
+                                          const ParticleState& particle,
+                                          const double pre_collision_energy,
+                                          const double pre_collision_weight )
+{
+  if( particle.getParticleType() != NEUTRON )
+    return;
+
+  const FilledNeutronGeometryModel& neutron_model = *d_model;
+
+  const NeutronState& neutron = static_cast<const NeutronState&>( particle );
+
+  if( neutron_model.isCellVoid( neutron ) )
+    return;
+
+  const NeutronMaterial& material = *neutron_model.getMaterial( neutron );
+
+  const double nu_fission_cross_section =
+    material.getMacroscopicFissionNeutronProductionCrossSection( pre_collision_energy );
+
+  if( nu_fission_cross_section == 0.0 )
+    return;
+
+  const std::shared_ptr<const DopplerBroadenedNeutronMaterial>&
+    broadened_material =
+    neutron_model.getBroadenedMaterialAtIndex( neutron.getCellIndex() );
+
+  double total_cross_section, absorption_cross_section;
+
+  if( broadened_material )
+  {
+    total_cross_section =
+      neutron_model.getMacroscopicTotalCrossSectionQuickAtIndex(
+                                                      neutron.getCellIndex(),
+                                                      pre_collision_energy );
+
+    absorption_cross_section =
+      broadened_material->getMacroscopicAbsorptionCrossSection( pre_collision_energy );
+  }
+  else
+  {
+    total_cross_section =
+      material.getMacroscopicTotalCrossSection( pre_collision_energy );
+
+    absorption_cross_section =
+      material.getMacroscopicAbsorptionCrossSection( pre_collision_energy );
+  }
+
+  // Note: the fission reactions are not included in the absorption
+  // cross section
+  absorption_cross_section +=
+    material.getMacroscopicFissionCrossSection( pre_collision_energy );
+
+  ThreadScores& scores =
+    d_thread_scores[Utility::OpenMPProperties::getThreadId()];
+
+  scores.collision +=
+    pre_collision_weight*nu_fission_cross_section/total_cross_section;
+
+  const double removed_weight = neutron ?
+    pre_collision_weight - neutron.getWeight() : pre_collision_weight;
+
+  if( removed_weight > 0.0 )
+  {
+    scores.absorption +=
+      removed_weight*nu_fission_cross_section/absorption_cross_section;
+  }
+}
+
+// Bank a fission neutron for the next generation
+template<ParticleModeType mode>
+bool KEigenvalueParticleSimulationManager<mode>::bankFissionNeutronForNextGeneration(
+                                                   const NeutronState& neutron )
+{
+  d_fission_site_bank.addSite( neutron );
+
+  return true;
+}
+
+// Return the number of completed cycles
+template<ParticleModeType mode>
+unsigned KEigenvalueParticleSimulationManager<mode>::getNumberOfCompletedCycles() const
+{
+  return d_generation_k_estimates.size();
+}
+
+// Return the generation estimate of k for each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>&
+KEigenvalueParticleSimulationManager<mode>::getGenerationKEstimates() const
+{
+  return d_generation_k_estimates;
+}
+
+// Return the collision estimate of k for each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>&
+KEigenvalueParticleSimulationManager<mode>::getCollisionKEstimates() const
+{
+  return d_collision_k_estimates;
+}
+
+// Return the absorption estimate of k for each completed cycle
+template<ParticleModeType mode>
+const std::vector<double>&
+KEigenvalueParticleSimulationManager<mode>::getAbsorptionKEstimates() const
+{
+  return d_absorption_k_estimates;
+}
+
+// Check if the track-length estimate of k is on
+/*! \details The track-length estimate of k is off when delta tracking is
+ * used.
+ */
+template<ParticleModeType mode>
+bool KEigenvalueParticleSimulationManager<mode>::isTrackLengthKEstimatorOn() const
+{
+  return d_track_length_k_estimator_on;
+}
+
+// Return the track-length estimate of k for each completed cycle
+/*! \details No estimates will be returned if the track-length estimate of k
+ * is off.
+ */
+template<ParticleModeType mode>
+const std::vector<double>&
+KEigenvalueParticleSimulationManager<mode>::getTrackLengthKEstimates() const
+{
+  return d_track_length_k_estimates;
+}
+
+// Return the Shannon entropy of the fission source for each cycle
+template<ParticleModeType mode>
+const std::vector<double>&
+KEigenvalueParticleSimulationManager<mode>::getShannonEntropies() const
+{
+  return d_shannon_entropies;
+}
+
+// Calculate the mean and standard deviation of the mean (active cycles)
+/*! \details Only the estimates from the completed active cycles will be
+ * used. If fewer than two active cycles have been completed the standard
+ * deviation of the mean will be zero.
+ */
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::calculateActiveCycleStatistics(
+                                         const std::vector<double>& estimates,
+                                         double& mean,
+                                         double& std_dev_of_mean ) const
+{
+  const size_t number_of_inactive_cycles =
+    this->getSimulationProperties().getNumberOfInactiveCycles();
+
+  mean = 0.0;
+  std_dev_of_mean = 0.0;
+
+  if( estimates.size() <= number_of_inactive_cycles )
+    return;
+
+  const double number_of_active_cycles =
+    estimates.size() - number_of_inactive_cycles;
+
+  double sum = 0.0, sum_of_squares = 0.0;
+
+  for( size_t i = number_of_inactive_cycles; i < estimates.size(); ++i )
+  {
+    sum += estimates[i];
+    sum_of_squares += estimates[i]*estimates[i];
+  }
+
+  mean = sum/number_of_active_cycles;
+
+  if( number_of_active_cycles > 1.0 )
+  {
+    const double variance = sum_of_squares/number_of_active_cycles - mean*mean;
+
+    if( variance > 0.0 )
+    {
+      std_dev_of_mean =
+        std::sqrt( variance/(number_of_active_cycles - 1.0) );
+    }
+  }
+}
+
+// Print the k estimate
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::printKEstimate(
+                                 std::ostream& os,
+                                 const std::string& estimator_name,
+                                 const std::vector<double>& estimates ) const
+{
+  double mean, std_dev_of_mean;
+
+  this->calculateActiveCycleStatistics( estimates, mean, std_dev_of_mean );
+
+  os << "  " << estimator_name << ": " << mean << " +/- "
+     << std_dev_of_mean << "\n";
+}
+
+// Print the k estimates
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::printKEstimates(
+                                                       std::ostream& os ) const
+{
+  const unsigned number_of_inactive_cycles =
+    this->getSimulationProperties().getNumberOfInactiveCycles();
+
+  const unsigned number_of_active_cycles =
+    this->getNumberOfCompletedCycles() > number_of_inactive_cycles ?
+    this->getNumberOfCompletedCycles() - number_of_inactive_cycles : 0;
+
+  os << "K-Eigenvalue Results (" << number_of_active_cycles
+     << " active cycles)\n";
+
+  this->printKEstimate( os, "generation  ", d_generation_k_estimates );
+  this->printKEstimate( os, "collision   ", d_collision_k_estimates );
+  this->printKEstimate( os, "absorption  ", d_absorption_k_estimates );
+
+  if( d_track_length_k_estimator_on )
+    this->printKEstimate( os, "track-length", d_track_length_k_estimates );
+
+  if( !d_shannon_entropies.empty() )
+  {
+    os << "  final Shannon entropy: " << d_shannon_entropies.back() << "\n";
+  }
+}
+
+// Print the simulation data to the desired stream
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::printSimulationSummary(
+                                                       std::ostream& os ) const
+{
+  if( d_comm->rank() == 0 )
+  {
+    this->printKEstimates( os );
+
+    ParticleSimulationManager::printSimulationSummary( os );
+  }
+}
+
+// Log the simulation data
+template<ParticleModeType mode>
+void KEigenvalueParticleSimulationManager<mode>::logSimulationSummary() const
+{
+  if( d_comm->rank() == 0 )
+  {
+    std::ostringstream oss;
+
+    this->printKEstimates( oss );
+
+    FRENSIE_LOG_NOTIFICATION( oss.str() );
+
+    ParticleSimulationManager::logSimulationSummary();
+  }
+}
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_K_EIGENVALUE_PARTICLE_SIMULATION_MANAGER_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_KEigenvalueParticleSimulationManager_def.hpp
+//---------------------------------------------------------------------------//
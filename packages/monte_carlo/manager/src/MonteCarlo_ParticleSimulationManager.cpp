@@ -9,14 +9,24 @@
 // Std Lib Includes
 #include <csignal>
 #include <fstream>
+#include <sstream>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManager.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_NuclearReactionType.hpp"
 #include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_PhysicalConstants.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_JustInTimeInitializer.hpp"
 #include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 #include "Utility_DesignByContract.hpp"
 
 // The registered managers (these must be global so that the custom signal
@@ -39,6 +49,42 @@ extern "C" void __custom_signal_handler__( int signal )
 
 namespace MonteCarlo{
 
+namespace Details{
+
+// Constructor
+CollisionParticleBank::CollisionParticleBank(
+                                         ParticleSimulationManager& manager )
+  : d_manager( manager )
+{ /* ... */ }
+
+// Insert a neutron into the bank after an interaction
+void CollisionParticleBank::push( std::shared_ptr<NeutronState>& neutron,
+                                  const int reaction )
+{
+  if( isFissionReaction( reaction ) )
+  {
+    if( d_manager.bankFissionNeutronForNextGeneration( *neutron ) )
+      return;
+  }
+
+  ParticleBank::push( neutron, reaction );
+}
+
+// Insert a neutron into the bank after an interaction
+void CollisionParticleBank::push( const NeutronState& neutron,
+                                  const int reaction )
+{
+  if( isFissionReaction( reaction ) )
+  {
+    if( d_manager.bankFissionNeutronForNextGeneration( neutron ) )
+      return;
+  }
+
+  ParticleBank::push( neutron, reaction );
+}
+
+} // end Details namespace
+
 // Constructor
 ParticleSimulationManager::ParticleSimulationManager(
                  const std::string& simulation_name,
@@ -68,6 +114,8 @@ ParticleSimulationManager::ParticleSimulationManager(
     d_rendezvous_batch_size( 0 ),
     d_batch_size( 0 ),
     d_use_single_rendezvous_file( use_single_rendezvous_file ),
+    d_rendezvous_archive_buffer_index( 0 ),
+    d_transport_event_hooks_enabled( false ),
     d_end_simulation( false ),
     d_exit_simulation( false )
 {
@@ -111,6 +159,25 @@ ParticleSimulationManager::ParticleSimulationManager(
 
   // Set the cutoff weight roulette
   this->setCutoffWeightRoulette();
+
+  // Look up the cell event observers by cell index during transport
+  d_event_handler->setCellIndexModel(
+                             (std::shared_ptr<const Geometry::Model>)(*model) );
+}
+
+// Destructor
+/*! \details The destructor will block until the pending rendezvous archive
+ * has been written.
+ */
+ParticleSimulationManager::~ParticleSimulationManager()
+{
+  try{
+    this->waitForPendingRendezvousArchive();
+  }
+  catch( const std::exception& exception )
+  {
+    FRENSIE_LOG_ERROR( exception.what() );
+  }
 }
 
 // Return the next history that will be completed
@@ -196,6 +263,8 @@ void ParticleSimulationManager::setSimulationName( const std::string& new_name )
   if( new_name.size() > 0 )
     d_simulation_name = new_name;
 
+  d_static_data_archive_name.clear();
+
   this->basicRendezvous();
 }
 
@@ -214,6 +283,8 @@ void ParticleSimulationManager::setSimulationArchiveType( const std::string& arc
   if( archive_type.size() > 0 )
     d_archive_type = archive_type;
 
+  d_static_data_archive_name.clear();
+
   this->basicRendezvous();
 }
 
@@ -231,6 +302,8 @@ void ParticleSimulationManager::setSimulationNameAndArchiveType(
   if( archive_type.size() > 0 )
     d_archive_type = archive_type;
 
+  d_static_data_archive_name.clear();
+
   this->basicRendezvous();
 }
 
@@ -391,7 +464,8 @@ void ParticleSimulationManager::runSimulation()
     else
       break;
 
-    // Exit the simulation if requested (from signal handler)
+    // Exit the simulation if requested (from signal handler) - the pending
+    // rendezvous archive will still be written
     if( d_exit_simulation )
       break;
 
@@ -410,6 +484,8 @@ void ParticleSimulationManager::runSimulation()
   if( !d_exit_simulation && rendezvous_needed )
     this->rendezvous();
 
+  this->waitForPendingRendezvousArchive();
+
   // The simulation has finished
   this->registerSimulationStoppedEvent();
 
@@ -430,7 +506,8 @@ void ParticleSimulationManager::runSimulation()
 /*! \details Sending a SIGINT signal (usually Ctrl+C) will cause the
  * simulation to be terminated once the current batch is completed. Sending
  * a second SIGINT signal before the simulation has been terminated will
- * cause the program to exit immediately.
+ * cause the program to exit immediately. The pending rendezvous archive will
+ * always be written before this method returns.
  */
 void ParticleSimulationManager::runInterruptibleSimulation()
 {
@@ -445,7 +522,31 @@ void ParticleSimulationManager::runInterruptibleSimulation()
     __registered_managers__.insert( this->shared_from_this() );
   }
 
-  this->runSimulation();
+  try{
+    this->runSimulation();
+  }
+  catch( ... )
+  {
+    // The pending rendezvous archive must be written before the default
+    // signal handler is restored
+    #pragma omp master
+    {
+      try{
+        this->waitForPendingRendezvousArchive();
+      }
+      catch( const std::exception& exception )
+      {
+        FRENSIE_LOG_ERROR( exception.what() );
+      }
+      
+      __registered_managers__.erase( this->shared_from_this() );
+
+      if( __registered_managers__.empty() )
+        std::signal( SIGINT, __default_signal_handler__ );
+    }
+
+    throw;
+  }
 
   #pragma omp master
   {
@@ -466,6 +567,8 @@ const CollisionForcer& ParticleSimulationManager::getCollisionForcer() const
 void ParticleSimulationManager::enableThreadSupport()
 {
   // Set up the random number generator for the number of threads requested
+  Utility::RandomNumberGenerator::setGeneratorType(
+                             d_properties->getRandomNumberGeneratorType() );
   Utility::RandomNumberGenerator::createStreams();
 
   // Enable source thread support
@@ -473,6 +576,9 @@ void ParticleSimulationManager::enableThreadSupport()
 
   // Enable event handler thread support
   d_event_handler->enableThreadSupport( Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  if( d_properties->isHistoryOrderedEstimatorMergeModeOn() )
+    d_event_handler->enableHistoryOrderedObserverThreadLocalDataMerge();
 }
 
 // Reset data
@@ -521,7 +627,24 @@ void ParticleSimulationManager::rendezvous()
 }
 
 // Conduct a basic rendezvous
-void ParticleSimulationManager::basicRendezvous() const
+/*! \details In asynchronous rendezvous mode only the disk write is moved off
+ * of the critical path: the simulation state is still serialized into a
+ * binary snapshot buffer by this thread while the other threads wait. The
+ * snapshot is then converted to the simulation archive type (if necessary)
+ * and written to disk by a background thread. Two snapshot buffers are used
+ * so that the next snapshot can be taken while the previous archive is being
+ * written - only one archive will be written at a time. The archive
+ * serializers are never used by the main thread and the background thread
+ * concurrently: a binary snapshot is simply copied to disk by the background
+ * thread, but a snapshot that must be converted to another archive type is
+ * loaded and saved again by the background thread (which also requires a
+ * second copy of the archived state in memory), so the next snapshot will
+ * only be taken once the conversion has finished. The model is only stored
+ * once, in a separate static data archive. The rendezvous archives store the
+ * incremental state and the name of the static data archive. HDF5 archives
+ * can only be written synchronously.
+ */
+void ParticleSimulationManager::basicRendezvous()
 {
   std::string archive_name( d_simulation_name );
   archive_name += "_rendezvous";
@@ -541,8 +664,22 @@ void ParticleSimulationManager::basicRendezvous() const
 
   FRENSIE_FLUSH_ALL_LOGS();
 
+  // The archived observer data must include the data of every thread
+  d_event_handler->mergeObserverThreadLocalData();
+
+  // Only the static data archive needs to store the model
+  std::shared_ptr<const FilledGeometryModel> model = d_model;
+
+  if( this->canWriteIncrementalRendezvousArchive() )
+  {
+    if( d_static_data_archive_name.empty() )
+      this->writeStaticDataArchive();
+    
+    model.reset();
+  }
+
   ParticleSimulationManagerFactory
-    tmp_factory( d_model,
+    tmp_factory( model,
                  d_source,
                  d_event_handler,
                  d_population_controller,
@@ -552,9 +689,138 @@ void ParticleSimulationManager::basicRendezvous() const
                  d_archive_type,
                  d_next_history,
                  d_rendezvous_number+1,
-                 d_use_single_rendezvous_file );
+                 d_use_single_rendezvous_file,
+                 d_static_data_archive_name );
+
+  if( d_properties->isAsynchronousRendezvousModeOn() &&
+      d_archive_type != "h5fa" )
+  {
+    // Snapshot the state (the other buffer may still be being written)
+    std::shared_ptr<std::stringstream>& snapshot_buffer =
+      d_rendezvous_archive_buffers[d_rendezvous_archive_buffer_index];
+
+    if( snapshot_buffer )
+    {
+      snapshot_buffer->str( std::string() );
+      snapshot_buffer->clear();
+    }
+    else
+      snapshot_buffer.reset( new std::stringstream );
+
+    // The background writer only uses the archive serializers when the
+    // snapshot must be converted to another archive type
+    const bool convert_snapshot = (d_archive_type != "bin");
+
+    if( convert_snapshot )
+      this->waitForPendingRendezvousArchive();
+
+    // Note: the state is serialized by this thread - only the write (and
+    // the conversion) will overlap with the simulation
+    tmp_factory.saveToStream( *snapshot_buffer, ".bin" );
+
+    if( !convert_snapshot )
+      this->waitForPendingRendezvousArchive();
+
+    d_rendezvous_archive_writer =
+      std::async( std::launch::async,
+                  &ParticleSimulationManager::writeRendezvousArchiveSnapshot,
+                  snapshot_buffer,
+                  archive_name,
+                  "." + d_archive_type );
+
+    d_rendezvous_archive_buffer_index = 1 - d_rendezvous_archive_buffer_index;
+  }
+  else
+  {
+    this->waitForPendingRendezvousArchive();
+    
+    tmp_factory.saveToFile( archive_name, true );
+  }
+}
+
+// Check if an incremental rendezvous archive can be written
+bool ParticleSimulationManager::canWriteIncrementalRendezvousArchive() const
+{
+  return d_properties->isAsynchronousRendezvousModeOn();
+}
+
+// Write the static data archive
+/*! \details The static data archive only stores the model. It will be
+ * written once (at the first rendezvous) and will be referenced by every
+ * rendezvous archive.
+ */
+void ParticleSimulationManager::writeStaticDataArchive()
+{
+  std::string archive_name( d_simulation_name );
+  archive_name += "_static_data.";
+  archive_name += d_archive_type;
+
+  ParticleSimulationManagerFactory
+    static_data_factory( d_model,
+                         std::shared_ptr<ParticleSource>(),
+                         std::shared_ptr<EventHandler>(),
+                         std::shared_ptr<PopulationControl>(),
+                         std::shared_ptr<const CollisionForcer>(),
+                         std::shared_ptr<const SimulationProperties>(),
+                         d_simulation_name,
+                         d_archive_type,
+                         d_next_history,
+                         d_rendezvous_number,
+                         d_use_single_rendezvous_file );
+
+  // The archive serializers cannot be shared with the background writer
+  this->waitForPendingRendezvousArchive();
+
+  static_data_factory.saveToFile( archive_name, true );
+
+  d_static_data_archive_name = archive_name;
+}
+
+// Write a rendezvous archive snapshot
+/*! \details The snapshot must be a binary archive. It will be converted to
+ * the requested archive type if necessary. The archive is written to a
+ * temporary file first, which is then renamed, so that an interrupted write
+ * cannot corrupt the previous rendezvous archive.
+ */
+void ParticleSimulationManager::writeRendezvousArchiveSnapshot(
+                     const std::shared_ptr<std::stringstream> snapshot_buffer,
+                     const std::string archive_name,
+                     const std::string extension )
+{
+  boost::filesystem::path tmp_archive_name( archive_name );
+  tmp_archive_name.replace_extension( ".tmp" + extension );
 
-  tmp_factory.saveToFile( archive_name, true );
+  if( extension == ".bin" )
+  {
+    std::ofstream archive_file( tmp_archive_name.string(),
+                                std::ofstream::binary );
+
+    TEST_FOR_EXCEPTION( !archive_file.good(),
+                        std::runtime_error,
+                        "Cannot create the rendezvous archive "
+                        << archive_name << "!" );
+
+    archive_file << snapshot_buffer->rdbuf();
+  }
+  else
+  {
+    ParticleSimulationManagerFactory
+      snapshot_factory( *snapshot_buffer, ".bin" );
+
+    snapshot_factory.saveToFile( tmp_archive_name, true );
+  }
+
+  boost::filesystem::rename( tmp_archive_name, archive_name );
+}
+
+// Wait for the pending rendezvous archive to be written
+/*! \details Any exception that was thrown while writing the archive will be
+ * rethrown.
+ */
+void ParticleSimulationManager::waitForPendingRendezvousArchive()
+{
+  if( d_rendezvous_archive_writer.valid() )
+    d_rendezvous_archive_writer.get();
 }
 
 // Print the simulation data to the desired stream
@@ -562,6 +828,8 @@ void ParticleSimulationManager::printSimulationSummary( std::ostream& os ) const
 {
   d_source->printSummary( os );
   d_event_handler->printObserverSummaries( os );
+
+  this->printThreadLoadBalanceSummary( os );
 }
 
 // Log the simulation data
@@ -569,6 +837,67 @@ void ParticleSimulationManager::logSimulationSummary() const
 {
   d_source->logSummary();
   d_event_handler->logObserverSummaries();
+
+  if( !d_thread_busy_times.empty() )
+  {
+    std::ostringstream oss;
+
+    this->printThreadLoadBalanceSummary( oss );
+
+    FRENSIE_LOG_NOTIFICATION( oss.str() );
+  }
+}
+
+// Return the time that each thread has spent simulating histories (s)
+const std::vector<double>& ParticleSimulationManager::getThreadBusyTimes() const
+{
+  return d_thread_busy_times;
+}
+
+// Return the time that each thread has spent waiting for other threads (s)
+/*! \details A thread is idle when it has finished its share of the histories
+ * in a micro batch but other threads are still simulating histories.
+ */
+const std::vector<double>& ParticleSimulationManager::getThreadIdleTimes() const
+{
+  return d_thread_idle_times;
+}
+
+// Print the thread load balance summary
+void ParticleSimulationManager::printThreadLoadBalanceSummary(
+                                                      std::ostream& os ) const
+{
+  if( d_thread_busy_times.empty() )
+    return;
+
+  os << "Thread Load Balance (" << d_properties->getHistorySchedule()
+     << "):" << std::endl;
+
+  double total_busy_time = 0.0;
+  double total_idle_time = 0.0;
+
+  for( size_t i = 0; i < d_thread_busy_times.size(); ++i )
+  {
+    const double thread_time = d_thread_busy_times[i] + d_thread_idle_times[i];
+
+    os << "  Thread " << i << ": busy " << d_thread_busy_times[i]
+       << " s, idle " << d_thread_idle_times[i] << " s";
+
+    if( thread_time > 0.0 )
+      os << " (" << 100.0*d_thread_idle_times[i]/thread_time << "% idle)";
+
+    os << std::endl;
+
+    total_busy_time += d_thread_busy_times[i];
+    total_idle_time += d_thread_idle_times[i];
+  }
+
+  if( total_busy_time + total_idle_time > 0.0 )
+  {
+    os << "  Total idle fraction: "
+       << 100.0*total_idle_time/(total_busy_time + total_idle_time) << "%"
+       << std::endl;
+  }
 }
 
 // Run the simulation batch
@@ -617,6 +946,13 @@ void ParticleSimulationManager::runSimulationBatch(
 }
 
 // Run the simulation micro batch
+/*! \details The histories are divided among the threads using the history
+ * schedule set in the simulation properties. The random number generator is
+ * initialized using the history number so the results do not depend on the
+ * schedule. The time that each thread spends simulating histories and the
+ * time that it spends waiting for the other threads to finish the micro
+ * batch will also be recorded.
+ */
 void ParticleSimulationManager::runSimulationMicroBatch(
                                             const uint64_t batch_start_history,
                                             const uint64_t batch_end_history )
@@ -624,76 +960,240 @@ void ParticleSimulationManager::runSimulationMicroBatch(
   // Make sure the history range is valid
   testPrecondition( batch_start_history < batch_end_history );
 
-  #pragma omp parallel num_threads( Utility::OpenMPProperties::getRequestedNumberOfThreads() )
+  const unsigned number_of_threads =
+    Utility::OpenMPProperties::getRequestedNumberOfThreads();
+
+  if( d_thread_busy_times.size() < number_of_threads )
+  {
+    d_thread_busy_times.resize( number_of_threads, 0.0 );
+    d_thread_idle_times.resize( number_of_threads, 0.0 );
+  }
+
+  const HistoryScheduleType history_schedule =
+    d_properties->getHistorySchedule();
+
+  const uint64_t chunk_size = d_properties->getHistoryScheduleChunkSize();
+
+  // The first history that has not been claimed by a thread (only used by
+  // the queue history schedule)
+  std::atomic<uint64_t> next_unclaimed_history( batch_start_history );
+
+  // The time that each thread spent simulating histories in this micro batch
+  std::vector<double> micro_batch_busy_times( number_of_threads, 0.0 );
+
+  std::shared_ptr<Utility::Timer> micro_batch_timer =
+    Utility::OpenMPProperties::createTimer();
+
+  micro_batch_timer->start();
+
+  #pragma omp parallel num_threads( number_of_threads )
   {
     // Create a bank for each thread
     ParticleBank source_bank, bank;
 
-    #pragma omp for
-    for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
-    {
-      // End the simulation if requested (by the signal handler)
-      // Note: Conformal OpenMP code cannot have a break statement. Therefore
-      //       we will simply loop through remaining histories without doing
-      //       anything if the simulation needs to be ended.
-      if( d_exit_simulation )
-        continue;
+    std::shared_ptr<Utility::Timer> thread_timer =
+      Utility::OpenMPProperties::createTimer();
 
-      // Initialize the random number generator for this history
-      Utility::RandomNumberGenerator::initialize( history );
+    thread_timer->start();
 
-      // Sample a particle state from the source
-      try{
-        d_source->sampleParticleState( source_bank, history );
-      }
-      catch( const Geometry::GeometryError& exception )
+    // Note: all threads will take the same branch
+    switch( history_schedule )
+    {
+      case STATIC_HISTORY_SCHEDULE:
       {
-        LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+        #pragma omp for schedule( static ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          this->simulateHistory( history, source_bank, bank );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        break;
+      }
+      case DYNAMIC_HISTORY_SCHEDULE:
+      {
+        #pragma omp for schedule( dynamic, chunk_size ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          this->simulateHistory( history, source_bank, bank );
 
-        continue;
+        break;
       }
-      catch( const std::runtime_error& exception )
+      case GUIDED_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+        #pragma omp for schedule( guided, chunk_size ) nowait
+        for( uint64_t history = batch_start_history; history < batch_end_history; ++history )
+          this->simulateHistory( history, source_bank, bank );
 
-        continue;
+        break;
       }
-      // The source has likely been constructed incorrectly
-      catch( const std::logic_error& exception )
+      case QUEUE_HISTORY_SCHEDULE:
       {
-        FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+        while( true )
+        {
+          const uint64_t chunk_start_history =
+            next_unclaimed_history.fetch_add( chunk_size );
 
-        FRENSIE_LOG_NESTED_ERROR( exception.what() );
+          if( chunk_start_history >= batch_end_history )
+            break;
 
-        d_exit_simulation = true;
+          const uint64_t chunk_end_history =
+            std::min( chunk_start_history + chunk_size, batch_end_history );
 
-        continue;
+          for( uint64_t history = chunk_start_history; history < chunk_end_history; ++history )
+            this->simulateHistory( history, source_bank, bank );
+        }
+
+        break;
       }
+    }
 
-      // Simulate the particles generated by the source first
-      while( source_bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+    thread_timer->stop();
 
-        source_bank.pop();
-      }
+    micro_batch_busy_times[Utility::OpenMPProperties::getThreadId()] =
+      thread_timer->elapsed().count();
+  }
 
-      // This history only ends when the particle bank is empty
-      while( bank.size() > 0 )
-      {
-        this->simulateUnresolvedParticle( bank.top(), bank, false );
+  micro_batch_timer->stop();
 
-        bank.pop();
-      }
+  const double micro_batch_time = micro_batch_timer->elapsed().count();
 
-      // History complete - commit all observer history contributions
-      d_event_handler->commitObserverHistoryContributions();
-    }
+  for( unsigned i = 0; i < number_of_threads; ++i )
+  {
+    d_thread_busy_times[i] += micro_batch_busy_times[i];
+
+    if( micro_batch_time > micro_batch_busy_times[i] )
+      d_thread_idle_times[i] += micro_batch_time - micro_batch_busy_times[i];
   }
 }
 
+// Simulate a history
+void ParticleSimulationManager::simulateHistory( const uint64_t history,
+                                                 ParticleBank& source_bank,
+                                                 ParticleBank& bank )
+{
+  // End the simulation if requested (by the signal handler)
+  // Note: Conformal OpenMP code cannot have a break statement. Therefore
+  //       we will simply loop through remaining histories without doing
+  //       anything if the simulation needs to be ended.
+  if( d_exit_simulation )
+    return;
+
+  // Initialize the random number generator for this history
+  Utility::RandomNumberGenerator::initialize( history );
+
+  // Sample a particle state from the source
+  try{
+    this->sampleSourceParticles( source_bank, history );
+  }
+  catch( const Geometry::GeometryError& exception )
+  {
+    LOG_LOST_PARTICLE_DETAILS( source_bank.top() );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return;
+  }
+  catch( const std::runtime_error& exception )
+  {
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    return;
+  }
+  // The source has likely been constructed incorrectly
+  catch( const std::logic_error& exception )
+  {
+    FRENSIE_LOG_ERROR( "There is an issue with the source!" );
+
+    FRENSIE_LOG_NESTED_ERROR( exception.what() );
+
+    d_exit_simulation = true;
+
+    return;
+  }
+
+  // Each particle of the history is simulated with its own random number
+  // stream (the source is sampled with the stream of particle 0). Only the
+  // counter-based generator has separate particle streams.
+  unsigned particle_number = 0u;
+
+  // Simulate the particles generated by the source first
+  while( source_bank.size() > 0 )
+  {
+    Utility::RandomNumberGenerator::initializeParticle( ++particle_number );
+
+    this->simulateUnresolvedParticle( source_bank.top(), bank, true );
+
+    source_bank.pop();
+  }
+
+  // This history only ends when the particle bank is empty
+  while( bank.size() > 0 )
+  {
+    Utility::RandomNumberGenerator::initializeParticle( ++particle_number );
+
+    this->simulateUnresolvedParticle( bank.top(), bank, false );
+
+    bank.pop();
+  }
+
+  // History complete - commit all observer history contributions
+  d_event_handler->commitObserverHistoryContributions();
+}
+
+// Sample the source particles for a history
+void ParticleSimulationManager::sampleSourceParticles(
+                                                    ParticleBank& source_bank,
+                                                    const uint64_t history )
+{
+  d_source->sampleParticleState( source_bank, history );
+}
+
+// Enable the transport event hooks (register/bank methods)
+/*! \details The registerParticleSubtrackEndingInCellEvent,
+ * registerParticleCollisionEvent and bankFissionNeutronForNextGeneration
+ * methods will only be called once the hooks have been enabled (e.g. by
+ * the k-eigenvalue manager). This keeps the virtual calls off of the
+ * fixed source transport path.
+ */
+void ParticleSimulationManager::enableTransportEventHooks()
+{
+  d_transport_event_hooks_enabled = true;
+}
+
+// Register a particle subtrack ending in a cell event
+/*! \details This method is called every time that a particle subtrack ends
+ * in a cell after the observers have been updated. Subtracks completed
+ * with the delta tracking method are not registered. The default
+ * implementation does nothing. This method will only be called if the
+ * transport event hooks have been enabled.
+ */
+void ParticleSimulationManager::registerParticleSubtrackEndingInCellEvent(
+                                          const ParticleState&,
+                                          const Geometry::Model::EntityId,
+                                          const double )
+{ /* ... */ }
+
+// Register a particle collision event
+/*! \details This method is called after a particle has collided with the
+ * material in its cell (but before the population controller has been
+ * applied). The default implementation does nothing. This method will only
+ * be called if the transport event hooks have been enabled.
+ */
+void ParticleSimulationManager::registerParticleCollisionEvent(
+                                                          const ParticleState&,
+                                                          const double,
+                                                          const double )
+{ /* ... */ }
+
+// Bank a fission neutron for the next generation
+/*! \details If true is returned the fission neutron will not be simulated
+ * as part of the current history. The default implementation always
+ * returns false. This method will only be called if the transport event
+ * hooks have been enabled.
+ */
+bool ParticleSimulationManager::bankFissionNeutronForNextGeneration(
+                                                           const NeutronState& )
+{
+  return false;
+}
+
 // The signal handler
 /*! \details The first signal will cause the simulation to finish. The
  * second signal will cause the simulation to end without caching its state.
@@ -715,7 +1215,9 @@ void ParticleSimulationManager::signalHandler( int signal )
     }
     else if( number_of_signals_handled == 2 )
     {
-      FRENSIE_LOG_NOTIFICATION( " Terminating simulation immediately ..." );
+      FRENSIE_LOG_NOTIFICATION( " Terminating simulation immediately "
+                                "(after the pending rendezvous archive has "
+                                "been written) ..." );
 
       d_exit_simulation = true;
     }
@@ -734,6 +1236,422 @@ bool ParticleSimulationManager::hasEndSimulationRequestBeenMade() const
   return d_end_simulation;
 }
 
+// Simulate an electron using the condensed history method
+void ParticleSimulationManager::simulateElectronCondensedHistory(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<ElectronState>( unresolved_particle,
+                                             bank,
+                                             source_particle,
+                                             std::bind<void>( &ParticleSimulationManager::simulateElectronTrackCondensedHistory,
+                                                              std::ref( *this ),
+                                                              std::placeholders::_1,
+                                                              std::placeholders::_2,
+                                                              std::placeholders::_3,
+                                                              std::placeholders::_4 ) );
+}
+
+// Simulate an electron track using the condensed history method
+/*! \details The track is broken into condensed history steps. The step
+ * length is limited by the max fractional energy loss, the distance to the
+ * next hard collision (sampled from the remaining optical path) and the
+ * distance to the next cell boundary. The electron loses energy
+ * continuously according to the restricted stopping power. Each step
+ * advances the electron along its direction by the mean projected step
+ * length (path length correction). At the end of a step the electron
+ * direction is deflected by the multiple scattering angle sampled for the
+ * path length that was traveled (including steps that end on a cell
+ * boundary). At the end of a step that does not end on a cell boundary the
+ * electron is also displaced laterally if the displacement cannot move it
+ * out of the cell. Observers receive the path length that was traveled.
+ * The subtrack events are dispatched with the electron at the mid-step energy
+ * (the mean energy over the step) while the surface crossing and collision
+ * events see the energy at the end of the step.
+ * Cells with materials that do not have condensed history data are
+ * tracked using the analog (event-by-event) method - the condensed history
+ * method is resumed once the electron enters a cell with condensed history
+ * data.
+ */
+void ParticleSimulationManager::simulateElectronTrackCondensedHistory(
+                                              ElectronState& electron,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source )
+{
+  const FilledElectronGeometryModel& electron_model = *d_model;
+
+  // Particle tracking information (op = optical_path)
+  double remaining_track_op = optical_path;
+  double distance_to_surface_hit;
+
+  double track_start_point[3] = {electron.getXPosition(),
+                                 electron.getYPosition(),
+                                 electron.getZPosition()};
+
+  // Surface information
+  Geometry::Model::EntityId surface_hit;
+
+  // Records if the current straight subtrack has been dispatched
+  bool global_subtrack_ending_event_dispatched = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                   electron,
+                                                   electron.getCell(),
+                                                   electron.getCellIndex() );
+  }
+
+  while( true )
+  {
+    // Stream through void cells
+    if( electron_model.isCellVoid( electron ) )
+    {
+      try{
+        distance_to_surface_hit =
+          Details::RaySafetyHelper<ElectronState>::getDistanceToSurfaceHit(
+                                   electron,
+                                   surface_hit,
+                                   std::numeric_limits<double>::infinity() );
+
+        this->advanceParticleToCellBoundary( electron,
+                                             surface_hit,
+                                             distance_to_surface_hit );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( electron ) )
+      {
+        electron.setAsGone();
+
+        break;
+      }
+
+      electron.setRaySafetyDistance( 0.0 );
+
+      continue;
+    }
+
+    const ElectronMaterial& material =
+      *electron_model.getMaterial( electron );
+
+    // Use the analog tracking method in cells without condensed history data
+    if( !material.hasCondensedHistoryData() )
+    {
+      const double cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( electron );
+
+      const double cell_distance_to_collision =
+        remaining_track_op/cell_total_macro_cross_section;
+
+      try{
+        distance_to_surface_hit =
+          Details::RaySafetyHelper<ElectronState>::getDistanceToSurfaceHit(
+                                                 electron,
+                                                 surface_hit,
+                                                 cell_distance_to_collision );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+      const double op_to_surface_hit =
+        distance_to_surface_hit*cell_total_macro_cross_section;
+
+      // The electron passes through this cell to the next
+      if( op_to_surface_hit < remaining_track_op )
+      {
+        try{
+          this->advanceParticleToCellBoundary( electron,
+                                               surface_hit,
+                                               distance_to_surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCell( electron ) )
+        {
+          electron.setAsGone();
+
+          break;
+        }
+
+        remaining_track_op -= op_to_surface_hit;
+
+        electron.setRaySafetyDistance( 0.0 );
+
+        continue;
+      }
+
+      // A collision occurs in this cell
+      else
+      {
+        this->advanceParticleToCollisionSite( electron,
+                                              remaining_track_op,
+                                              cell_distance_to_collision,
+                                              track_start_point,
+                                              global_subtrack_ending_event_dispatched );
+
+        Details::RaySafetyHelper<ElectronState>::updateRaySafetyDistance(
+                                                 electron,
+                                                 cell_distance_to_collision );
+
+        this->collideWithCellMaterial( electron, bank );
+
+        break;
+      }
+    }
+
+    const CondensedHistoryElectronMaterialData& condensed_history_data =
+      material.getCondensedHistoryData();
+
+    const double energy = electron.getEnergy();
+
+    // The electron has slowed down below the tabulated energy range
+    if( energy <= condensed_history_data.getMinEnergy() )
+    {
+      electron.setAsGone();
+
+      break;
+    }
+
+    // Determine the step length (path length)
+    const double hard_macro_cross_section =
+      condensed_history_data.getMacroscopicHardCrossSection( energy );
+
+    const double distance_to_hard_collision =
+      remaining_track_op/hard_macro_cross_section;
+
+    const double max_step_length = condensed_history_data.getMaxStepLength(
+               energy, d_properties->getCondensedHistoryMaxEnergyLossFraction() );
+
+    const bool hard_collision = distance_to_hard_collision <= max_step_length;
+
+    const double step_length =
+      (hard_collision ? distance_to_hard_collision : max_step_length);
+
+    const double energy_after_step =
+      condensed_history_data.getEnergyAfterStep( energy, step_length );
+
+    // The multiple scattering moments are evaluated at the mid-step energy
+    const double mid_step_energy = 0.5*(energy + energy_after_step);
+
+    const double projected_step_length =
+      condensed_history_data.getMeanProjectedStepLength( mid_step_energy,
+                                                         step_length );
+
+    try{
+      distance_to_surface_hit =
+        Details::RaySafetyHelper<ElectronState>::getDistanceToSurfaceHit(
+                                  electron, surface_hit, projected_step_length );
+    }
+    CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+    // The step ends on the cell boundary
+    if( distance_to_surface_hit < projected_step_length )
+    {
+      const double path_length =
+        std::min( condensed_history_data.getPathLength( mid_step_energy,
+                                                        distance_to_surface_hit ),
+                  step_length );
+
+      const double energy_at_boundary =
+        condensed_history_data.getEnergyAfterStep( energy, path_length );
+
+      // The subtrack is scored at the mid-step energy and the boundary
+      // crossing is scored at the energy at the boundary
+      electron.setEnergy( 0.5*(energy + energy_at_boundary) );
+
+      try{
+        this->advanceParticleToCellBoundaryImpl(
+                      electron,
+                      surface_hit,
+                      path_length,
+                      [this, &track_start_point, &energy_at_boundary,
+                       &global_subtrack_ending_event_dispatched]( ElectronState& electron )
+                      {
+                        d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      electron,
+                                                      track_start_point,
+                                                      electron.getPosition() );
+
+                        global_subtrack_ending_event_dispatched = true;
+
+                        electron.setEnergy( energy_at_boundary );
+                      } );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( electron );
+
+      // The particle has exited the geometry
+      if( d_model->isTerminationCell( electron ) )
+      {
+        electron.setAsGone();
+
+        break;
+      }
+
+      remaining_track_op -= path_length*hard_macro_cross_section;
+
+      electron.setRaySafetyDistance( 0.0 );
+
+      // Deflect the electron by the multiple scattering of the path traveled
+      const double angle_cosine =
+        condensed_history_data.sampleMultipleScatteringAngleCosine(
+                                        0.5*(energy + energy_at_boundary),
+                                        path_length );
+
+      electron.rotateDirection( angle_cosine,
+                                2*Utility::PhysicalConstants::pi*
+                                Utility::RandomNumberGenerator::getRandomNumber<double>() );
+    }
+
+    // The step ends in the cell
+    else
+    {
+      // The subtrack is scored at the mid-step energy
+      electron.setEnergy( mid_step_energy );
+
+      electron.navigator().advanceBySubstep( *Utility::reinterpretAsQuantity<Geometry::Navigator::Length>( &projected_step_length ) );
+
+      d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
+                                                          electron,
+                                                          electron.getCell(),
+                                                          electron.getCellIndex(),
+                                                          step_length );
+
+      if( d_transport_event_hooks_enabled )
+      {
+        this->registerParticleSubtrackEndingInCellEvent( electron,
+                                                         electron.getCell(),
+                                                         step_length );
+      }
+
+      d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      electron,
+                                                      track_start_point,
+                                                      electron.getPosition() );
+
+      electron.setEnergy( energy_after_step );
+
+      Details::RaySafetyHelper<ElectronState>::updateRaySafetyDistance(
+                                             electron, projected_step_length );
+
+      // Deflect the electron using the mid-step energy
+      const double initial_direction[3] = {electron.getXDirection(),
+                                           electron.getYDirection(),
+                                           electron.getZDirection()};
+
+      const double angle_cosine =
+        condensed_history_data.sampleMultipleScatteringAngleCosine(
+                                        mid_step_energy, step_length );
+
+      electron.rotateDirection( angle_cosine,
+                                2*Utility::PhysicalConstants::pi*
+                                Utility::RandomNumberGenerator::getRandomNumber<double>() );
+
+      this->displaceElectronLaterally(
+             electron,
+             initial_direction,
+             angle_cosine,
+             condensed_history_data.getRootMeanSquareLateralDisplacement(
+                                             mid_step_energy, step_length ) );
+
+      if( hard_collision )
+      {
+        global_subtrack_ending_event_dispatched = true;
+
+        if( energy_after_step > condensed_history_data.getMinEnergy() )
+        {
+          this->collideWithCellMaterialImpl(
+                      electron,
+                      bank,
+                      [&condensed_history_data]( ElectronState& electron,
+                                                 ParticleBank& local_bank )
+                      {
+                        condensed_history_data.collideHard( electron,
+                                                            local_bank );
+                      } );
+        }
+        else
+          electron.setAsGone();
+
+        break;
+      }
+
+      remaining_track_op -= step_length*hard_macro_cross_section;
+    }
+
+    // The next straight subtrack starts here
+    track_start_point[0] = electron.getXPosition();
+    track_start_point[1] = electron.getYPosition();
+    track_start_point[2] = electron.getZPosition();
+
+    global_subtrack_ending_event_dispatched = false;
+  }
+
+  if( !global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      electron,
+                                                      track_start_point,
+                                                      electron.getPosition() );
+  }
+
+  if( !electron )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( electron );
+}
+
+// Displace an electron laterally at the end of a condensed history step
+/*! \details The electron is displaced along the component of its new
+ * direction that is perpendicular to its initial direction, which
+ * correlates the displacement with the angular deflection. The electron
+ * will only be displaced if the displacement is less than the ray safety
+ * distance (a lower bound on the distance to the closest boundary) so that
+ * it cannot leave the cell.
+ */
+void ParticleSimulationManager::displaceElectronLaterally(
+                                     ElectronState& electron,
+                                     const double initial_direction[3],
+                                     const double angle_cosine,
+                                     const double lateral_displacement ) const
+{
+  if( lateral_displacement <= 0.0 ||
+      lateral_displacement >= electron.getRaySafetyDistance() )
+    return;
+
+  const double angle_sine =
+    std::sqrt( std::max( 1.0 - angle_cosine*angle_cosine, 0.0 ) );
+
+  if( angle_sine <= 0.0 )
+    return;
+
+  const double* direction = electron.getDirection();
+
+  const double scale = lateral_displacement/angle_sine;
+
+  Geometry::Navigator::Length position[3];
+
+  for( size_t i = 0; i < 3; ++i )
+  {
+    position[i] = Geometry::Navigator::Length::from_value(
+                    electron.getPosition()[i] + scale*
+                    (direction[i] - angle_cosine*initial_direction[i]) );
+  }
+
+  const double new_direction[3] = {direction[0], direction[1], direction[2]};
+
+  electron.navigator().setState( position, new_direction, electron.getCell() );
+
+  electron.setRaySafetyDistance( electron.getRaySafetyDistance() -
+                                 lateral_displacement );
+}
+
 } // end MonteCarlo namespace
 
 //---------------------------------------------------------------------------//
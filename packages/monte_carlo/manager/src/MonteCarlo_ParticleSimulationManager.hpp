@@ -11,6 +11,10 @@
 
 // Std Lib Includes
 #include <memory>
+#include <vector>
+#include <string>
+#include <sstream>
+#include <future>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -31,6 +35,48 @@ extern "C" void __custom_signal_handler__( int signal );
 
 namespace MonteCarlo{
 
+class ParticleSimulationManager;
+
+namespace Details{
+
+/*! The collision particle bank
+ *
+ * Neutrons that are created by a fission reaction are offered to the
+ * simulation manager before being added to the bank. This allows a manager
+ * to store fission neutrons for the next generation (e.g. k-eigenvalue
+ * simulations) instead of simulating them as part of the current history.
+ */
+class CollisionParticleBank : public ParticleBank
+{
+
+public:
+
+  //! Constructor
+  CollisionParticleBank( ParticleSimulationManager& manager );
+
+  //! Destructor
+  ~CollisionParticleBank()
+  { /* ... */ }
+
+  // Allow the non-neutron push methods to be used
+  using ParticleBank::push;
+
+  //! Insert a neutron into the bank after an interaction
+  void push( std::shared_ptr<NeutronState>& neutron,
+             const int reaction ) final override;
+
+  //! Insert a neutron into the bank after an interaction
+  void push( const NeutronState& neutron,
+             const int reaction ) final override;
+
+private:
+
+  // The simulation manager
+  ParticleSimulationManager& d_manager;
+};
+
+} // end Details namespace
+
 //! The particle simulation manager base class
 class ParticleSimulationManager : public std::enable_shared_from_this<ParticleSimulationManager>
 {
@@ -38,8 +84,7 @@ class ParticleSimulationManager : public std::enable_shared_from_this<ParticleSi
 public:
 
   //! Destructor
-  virtual ~ParticleSimulationManager()
-  { /* ... */ }
+  virtual ~ParticleSimulationManager();
 
   //! Return the next history that will be completed
   uint64_t getNextHistory() const;
@@ -108,6 +153,12 @@ public:
   //! Log the simulation data
   virtual void logSimulationSummary() const;
 
+  //! Return the time that each thread has spent simulating histories (s)
+  const std::vector<double>& getThreadBusyTimes() const;
+
+  //! Return the time that each thread has spent waiting for other threads (s)
+  const std::vector<double>& getThreadIdleTimes() const;
+
 protected:
 
   //! Constructor
@@ -155,6 +206,17 @@ protected:
                                     ParticleBank& bank,
                                     const bool source_particle );
 
+  //! Simulate a resolved particle using the delta tracking method
+  template<typename State>
+  void simulateParticleDelta( ParticleState& unresolved_particle,
+                              ParticleBank& bank,
+                              const bool source_particle );
+
+  //! Simulate an electron using the condensed history method
+  void simulateElectronCondensedHistory( ParticleState& unresolved_particle,
+                                         ParticleBank& bank,
+                                         const bool source_particle );
+
   //! Get the collision forcer
   const CollisionForcer& getCollisionForcer() const;
 
@@ -180,12 +242,38 @@ protected:
   //! Rendezvous (cache state)
   virtual void rendezvous();
 
+  //! Wait for the pending rendezvous archive to be written
+  void waitForPendingRendezvousArchive();
+
   //! The signal handler
   virtual void signalHandler( int signal );
 
   //! Check if a signal type is handled by the manager
   static bool isSignalTypeHandled( const int signal );
 
+  //! Sample the source particles for a history
+  virtual void sampleSourceParticles( ParticleBank& source_bank,
+                                      const uint64_t history );
+
+  //! Enable the transport event hooks (register/bank methods)
+  void enableTransportEventHooks();
+
+  //! Register a particle subtrack ending in a cell event
+  virtual void registerParticleSubtrackEndingInCellEvent(
+                                   const ParticleState& particle,
+                                   const Geometry::Model::EntityId cell,
+                                   const double track_length );
+
+  //! Register a particle collision event
+  virtual void registerParticleCollisionEvent(
+                                        const ParticleState& particle,
+                                        const double pre_collision_energy,
+                                        const double pre_collision_weight );
+
+  //! Bank a fission neutron for the next generation
+  virtual bool bankFissionNeutronForNextGeneration(
+                                                  const NeutronState& neutron );
+
 private:
 
   // Set the cutoff weight roulette
@@ -210,6 +298,14 @@ private:
   void runSimulationMicroBatch( const uint64_t batch_start_history,
                                 const uint64_t batch_end_history );
 
+  // Simulate a history
+  void simulateHistory( const uint64_t history,
+                        ParticleBank& source_bank,
+                        ParticleBank& bank );
+
+  // Print the thread load balance summary
+  void printThreadLoadBalanceSummary( std::ostream& os ) const;
+
   // Simulate a resolved particle implementation
   template<typename State, typename SimulateParticleTrackMethod>
   void simulateParticleImpl( ParticleState& unresolved_particle,
@@ -248,6 +344,25 @@ private:
                                          const double optical_path,
                                          const bool starting_from_source );
 
+  // Simulate a resolved particle track using the delta tracking method
+  template<typename State>
+  void simulateParticleTrackDelta( State& particle,
+                                   ParticleBank& bank,
+                                   const double optical_path,
+                                   const bool starting_from_source );
+
+  // Simulate an electron track using the condensed history method
+  void simulateElectronTrackCondensedHistory( ElectronState& electron,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source );
+
+  // Displace an electron laterally at the end of a condensed history step
+  void displaceElectronLaterally( ElectronState& electron,
+                                  const double initial_direction[3],
+                                  const double angle_cosine,
+                                  const double lateral_displacement ) const;
+
   // Advance a particle to the cell boundary
   template<typename State>
   void advanceParticleToCellBoundary(
@@ -255,6 +370,15 @@ private:
                               const Geometry::Model::EntityId surface_to_cross,
                               const double distance_to_surface );
 
+  // Advance a particle to the cell boundary and call the desired method
+  // once the subtrack ending in cell event has been dispatched
+  template<typename State, typename SubtrackEndedMethod>
+  void advanceParticleToCellBoundaryImpl(
+                              State& particle,
+                              const Geometry::Model::EntityId surface_to_cross,
+                              const double distance_to_surface,
+                              const SubtrackEndedMethod& subtrack_ended );
+
   // Advance a particle to a collision site
   template<typename State>
   void advanceParticleToCollisionSite(
@@ -269,12 +393,40 @@ private:
   void collideWithCellMaterial( State& particle,
                                 ParticleBank& bank );
 
+  // Collide with the cell material using the desired collision method
+  template<typename State, typename CollisionMethod>
+  void collideWithCellMaterialImpl( State& particle,
+                                    ParticleBank& bank,
+                                    const CollisionMethod& collide );
+
+  // Collide with the cell material using the desired collision method
+  template<typename State, typename CollisionMethod>
+  void collideWithCellMaterialImpl( State& particle,
+                                    ParticleBank& bank,
+                                    ParticleBank& local_bank,
+                                    const CollisionMethod& collide );
+
   // Conduct a basic rendezvous
-  void basicRendezvous() const;
+  void basicRendezvous();
+
+  // Check if an incremental rendezvous archive can be written
+  bool canWriteIncrementalRendezvousArchive() const;
+
+  // Write the static data archive
+  void writeStaticDataArchive();
+
+  // Write a rendezvous archive snapshot
+  static void writeRendezvousArchiveSnapshot(
+                     const std::shared_ptr<std::stringstream> snapshot_buffer,
+                     const std::string archive_name,
+                     const std::string extension );
 
   // Declare the custom signal handler as a friend
   friend void ::__custom_signal_handler__( int );
 
+  // Declare the collision particle bank as a friend
+  friend class Details::CollisionParticleBank;
+
   // The simulation name
   std::string d_simulation_name;
 
@@ -323,11 +475,33 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // The archive that stores the static data (model)
+  std::string d_static_data_archive_name;
+
+  // The rendezvous archive snapshot buffers (one buffer can be filled while
+  // the other buffer is being written)
+  std::shared_ptr<std::stringstream> d_rendezvous_archive_buffers[2];
+
+  // The rendezvous archive snapshot buffer that will be filled next
+  unsigned d_rendezvous_archive_buffer_index;
+
+  // The background writer of the pending rendezvous archive
+  std::future<void> d_rendezvous_archive_writer;
+
+  // Flag for calling the transport event hooks
+  bool d_transport_event_hooks_enabled;
+
   // Flag for ending simulation early
   bool d_end_simulation;
 
   // Flag for exiting the simulation immediately
   bool d_exit_simulation;
+
+  // The time that each thread has spent simulating histories
+  std::vector<double> d_thread_busy_times;
+
+  // The time that each thread has spent waiting for other threads
+  std::vector<double> d_thread_idle_times;
 };
 
 } // end MonteCarlo namespace
@@ -6,11 +6,15 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Boost Includes
+#include <boost/filesystem.hpp>
+
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp"
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
 #include "MonteCarlo_StandardParticleSimulationManager.hpp"
 #include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
+#include "MonteCarlo_KEigenvalueParticleSimulationManager.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_GlobalMPISession.hpp"
 #include "Utility_LoggingMacros.hpp"
@@ -34,7 +38,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
                 const std::string& archive_type,
                 const uint64_t next_history,
                 const uint64_t rendezvous_number,
-                const bool use_single_rendezvous_file )
+                const bool use_single_rendezvous_file,
+                const std::string& static_data_archive_name )
   : d_simulation_name( simulation_name ),
     d_archive_type( archive_type ),
     d_model( model ),
@@ -45,7 +50,8 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
     d_properties( properties ),
     d_next_history( next_history ),
     d_rendezvous_number( rendezvous_number ),
-    d_use_single_rendezvous_file( use_single_rendezvous_file )
+    d_use_single_rendezvous_file( use_single_rendezvous_file ),
+    d_static_data_archive_name( static_data_archive_name )
 { 
   TEST_FOR_EXCEPTION( next_history == std::numeric_limits<uint64_t>::max(),
                       std::runtime_error,
@@ -199,6 +205,18 @@ ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
   d_event_handler->setSimulationCompletionCriterion( updated_general_props );
 }
 
+// Snapshot constructor
+/*! \details The snapshot is only used to convert an archived simulation
+ * state to a different archive type. The static data archive referenced by
+ * the snapshot will not be loaded.
+ */
+ParticleSimulationManagerFactory::ParticleSimulationManagerFactory(
+                                    std::istream& archived_manager_snapshot,
+                                    const std::string& extension )
+{
+  this->loadFromStream( archived_manager_snapshot, extension );
+}
+
 // Load the archived object (implementation)
 void ParticleSimulationManagerFactory::loadFromFileImpl(
                         const boost::filesystem::path& archive_name_with_path )
@@ -216,6 +234,57 @@ void ParticleSimulationManagerFactory::loadFromFileImpl(
   // The bpis pointer must be restored to its original value so that libraries
   // that expect it to be non-NULL behave correctly
   this->restoreBpisPointer<Data::ZAID>( extension, zaid_bpis );
+
+  // Incremental rendezvous archives do not store the static data
+  if( !d_static_data_archive_name.empty() )
+    this->loadStaticData( archive_name_with_path );
+}
+
+// Load the archived object from a stream (implementation)
+void ParticleSimulationManagerFactory::loadFromStreamImpl(
+                                               std::istream& is,
+                                               const std::string& extension )
+{
+  // The bpis pointer must be NULL. Depending on the libraries that have been
+  // loaded the bpis might be initialized to a non-NULL value
+  const boost::archive::detail::basic_pointer_iserializer* zaid_bpis =
+    this->resetBpisPointer<Data::ZAID>( extension );
+
+  // Import the data in the archive
+  BaseArchivableObjectType::loadFromStreamImpl( is, extension );
+
+  // The bpis pointer must be restored to its original value so that libraries
+  // that expect it to be non-NULL behave correctly
+  this->restoreBpisPointer<Data::ZAID>( extension, zaid_bpis );
+}
+
+// Load the static data from the static data archive
+/*! \details The static data archive is expected to be in the same directory
+ * as the incremental archive. The static data archive only stores the model.
+ */
+void ParticleSimulationManagerFactory::loadStaticData(
+                        const boost::filesystem::path& archive_name_with_path )
+{
+  boost::filesystem::path static_data_archive_name_with_path =
+    archive_name_with_path.parent_path();
+
+  static_data_archive_name_with_path /= d_static_data_archive_name;
+
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( static_data_archive_name_with_path ),
+                      std::runtime_error,
+                      "The static data archive "
+                      << static_data_archive_name_with_path.string() <<
+                      " required by the incremental archive "
+                      << archive_name_with_path.string() <<
+                      " does not exist!" );
+
+  ParticleSimulationManagerFactory static_data_factory(
+                static_data_archive_name_with_path,
+                Utility::OpenMPProperties::getRequestedNumberOfThreads() );
+
+  d_model = static_data_factory.d_model;
+
+  d_static_data_archive_name.clear();
 }
 
 // Archive the object (implementation)
@@ -238,6 +307,24 @@ void ParticleSimulationManagerFactory::saveToFileImpl(
   this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
 }
 
+// Archive the object to a stream (implementation)
+void ParticleSimulationManagerFactory::saveToStreamImpl(
+                                          std::ostream& os,
+                                          const std::string& extension ) const
+{
+  // The bpos pointer must be NULL. Depending on the libraries that have been
+  // loaded the bpos might be initialized to a non-NULL value
+  const boost::archive::detail::basic_pointer_oserializer* zaid_bpos =
+    this->resetBposPointer<Data::ZAID>( extension );
+
+  // Import the data in the archive
+  BaseArchivableObjectType::saveToStreamImpl( os, extension );
+
+  // The bpos pointer must be restored to its original value so that libraries
+  // that expect it to be non-NULL behave correctly
+  this->restoreBposPointer<Data::ZAID>( extension, zaid_bpos );
+}
+
 // Set the weight windows that will be used by the manager
 void ParticleSimulationManagerFactory::setPopulationControl(
                     const std::shared_ptr<PopulationControl>& population_controller )
@@ -275,7 +362,24 @@ struct ParticleSimulationManagerFactoryCreateHelper
   template<ParticleModeType mode>
   static void createManager( ParticleSimulationManagerFactory& factory )
   {
-    if( factory.d_comm->size() > 1 )
+    if( factory.d_properties->isKEigenvalueModeOn() )
+    {
+      factory.d_simulation_manager.reset(
+                 new KEigenvalueParticleSimulationManager<mode>(
+                                          factory.d_simulation_name,
+                                          factory.d_archive_type,
+                                          factory.d_model,
+                                          factory.d_source,
+                                          factory.d_event_handler,
+                                          factory.d_population_controller,
+                                          factory.d_collision_forcer,
+                                          factory.d_properties,
+                                          factory.d_next_history,
+                                          factory.d_rendezvous_number,
+                                          factory.d_use_single_rendezvous_file,
+                                          factory.d_comm ) );
+    }
+    else if( factory.d_comm->size() > 1 )
     {
       factory.d_simulation_manager.reset(
                  new BatchedDistributedStandardParticleSimulationManager<mode>(
@@ -320,6 +424,15 @@ ParticleSimulationManagerFactory::getManager()
   if( !d_simulation_manager )
   {
     d_comm = Utility::Communicator::getDefault();
+
+    TEST_FOR_EXCEPTION( d_properties->isKEigenvalueModeOn() &&
+                        d_properties->getParticleMode() != NEUTRON_MODE &&
+                        d_properties->getParticleMode() != NEUTRON_PHOTON_MODE &&
+                        d_properties->getParticleMode() != NEUTRON_PHOTON_ELECTRON_MODE,
+                        std::runtime_error,
+                        "K-eigenvalue simulations require a particle mode "
+                        "that includes neutrons (not "
+                        << d_properties->getParticleMode() << ")!" );
     
     switch( d_properties->getParticleMode() )
     {
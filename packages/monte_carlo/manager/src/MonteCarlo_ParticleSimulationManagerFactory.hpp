@@ -90,10 +90,18 @@ protected:
   //! Load the archived object (implementation)
   void loadFromFileImpl( const boost::filesystem::path& archive_name_with_path ) final override;
 
+  //! Load the archived object from a stream (implementation)
+  void loadFromStreamImpl( std::istream& is,
+                           const std::string& extension ) final override;
+
   //! Archive the object (implementation)
   void saveToFileImpl( const boost::filesystem::path& archive_name_with_path,
                        const bool overwrite ) const final override;
 
+  //! Archive the object to a stream (implementation)
+  void saveToStreamImpl( std::ostream& os,
+                         const std::string& extension ) const final override;
+
 private:
 
   //! Archive constructor
@@ -108,7 +116,15 @@ private:
                 const std::string& archive_type,
                 const uint64_t next_history,
                 const uint64_t rendezvous_number,
-                const bool use_single_rendezvous_file );
+                const bool use_single_rendezvous_file,
+                const std::string& static_data_archive_name = std::string() );
+
+  // Snapshot constructor
+  ParticleSimulationManagerFactory( std::istream& archived_manager_snapshot,
+                                    const std::string& extension );
+
+  // Load the static data from the static data archive
+  void loadStaticData( const boost::filesystem::path& archive_name_with_path );
 
   // The name that will be used when archiving the object
   const char* getArchiveName() const final override;
@@ -162,6 +178,9 @@ private:
   // Use a single rendezvous file
   bool d_use_single_rendezvous_file;
 
+  // The name of the archive that stores the static data (model)
+  std::string d_static_data_archive_name;
+
   // The communicator
   std::shared_ptr<const Utility::Communicator> d_comm;
 
@@ -184,11 +203,14 @@ void ParticleSimulationManagerFactory::serialize( Archive& ar, const unsigned ve
   ar & BOOST_SERIALIZATION_NVP( d_next_history );
   ar & BOOST_SERIALIZATION_NVP( d_rendezvous_number );
   ar & BOOST_SERIALIZATION_NVP( d_use_single_rendezvous_file );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_static_data_archive_name );
 }
 
 } // end MonteCarlo namespace
 
-BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 0 );
+BOOST_SERIALIZATION_CLASS_VERSION( ParticleSimulationManagerFactory, MonteCarlo, 1 );
 EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( MonteCarlo, ParticleSimulationManagerFactory );
 
 #endif // end FRENSIE_PARTICLE_SIMULATION_MANAGER_FACTORY_HPP
@@ -13,6 +13,9 @@
 #include <functional>
 #include <type_traits>
 
+// FRENSIE Includes
+#include "Utility_RandomNumberGenerator.hpp"
+
 //! Log lost particle details
 #define LOG_LOST_PARTICLE_DETAILS( particle )   \
   FRENSIE_LOG_TAGGED_WARNING(                   \
@@ -170,6 +173,27 @@ void ParticleSimulationManager::simulateParticleAlternative(
                                                       std::placeholders::_4 ) );
 }
 
+// Simulate a resolved particle using the delta tracking method
+template<typename State>
+void ParticleSimulationManager::simulateParticleDelta(
+                                            ParticleState& unresolved_particle,
+                                            ParticleBank& bank,
+                                            const bool source_particle )
+{
+  // Make sure that the particle is embedded in the model
+  testPrecondition( unresolved_particle.isEmbeddedInModel( *d_model ) );
+
+  this->simulateParticleImpl<State>( unresolved_particle,
+                                     bank,
+                                     source_particle,
+                                     std::bind<void>( &ParticleSimulationManager::simulateParticleTrackDelta<State>,
+                                                      std::ref( *this ),
+                                                      std::placeholders::_1,
+                                                      std::placeholders::_2,
+                                                      std::placeholders::_3,
+                                                      std::placeholders::_4 ) );
+}
+
 // Simulate a resolved particle implementation
 template<typename State, typename SimulateParticleTrackMethod>
 void ParticleSimulationManager::simulateParticleImpl(
@@ -297,14 +321,16 @@ void ParticleSimulationManager::simulateParticleTrack(
   if( starting_from_source )
   {
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
-                                                particle, particle.getCell() );
+                                                   particle,
+                                                   particle.getCell(),
+                                                   particle.getCellIndex() );
   }
 
   // Ray trace until the necessary number of optical paths have been traveled
   while( true )
   {
     // Get the total cross section for the cell
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoid( particle ) )
     {
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
@@ -335,7 +361,7 @@ void ParticleSimulationManager::simulateParticleTrack(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCell( particle ) )
       {
         particle.setAsGone();
 
@@ -441,7 +467,9 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
   if( starting_from_source )
   {
     d_event_handler->updateObserversFromParticleEnteringCellEvent(
-                                                particle, particle.getCell() );
+                                                   particle,
+                                                   particle.getCell(),
+                                                   particle.getCellIndex() );
   }
 
   // Ray trace until a collision occurs
@@ -454,7 +482,7 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
     // Get the total cross section for the cell and the distance to collision
-    if( !d_model->isCellVoid<State>( particle.getCell() ) )
+    if( !d_model->isCellVoid( particle ) )
     {
       cell_total_macro_cross_section =
         d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
@@ -520,7 +548,7 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
       CATCH_LOST_PARTICLE_AND_BREAK( particle );
 
       // The particle has exited the geometry
-      if( d_model->isTerminationCell( particle.getCell() ) )
+      if( d_model->isTerminationCell( particle ) )
       {
         particle.setAsGone();
 
@@ -568,16 +596,313 @@ void ParticleSimulationManager::simulateParticleTrackAlternative(
     d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
 }
 
+// Simulate a resolved particle track using the delta tracking method
+/*! \details Cells with a total cross section that is close to the majorant
+ * cross section are traversed without ray tracing: the particle moves a
+ * distance sampled using the majorant and the new cell is found using point
+ * location. A real collision is accepted with probability
+ * \f$\Sigma_t/\Sigma_{maj}\f$. Void cells, cells with a total cross section
+ * ratio below the delta tracking threshold and cells that exceed the majorant
+ * are surface tracked instead. Because no surfaces are crossed during a delta
+ * step, cell track-length and surface estimators cannot be used with this
+ * tracking method (mesh, collision and global event estimators see the entire
+ * track). If the total cross section at a tentative collision site exceeds the
+ * majorant (which should only happen if the majorant was built from a
+ * different energy range), a warning will be logged and the collision will be
+ * accepted. If a tentative collision site is outside of the model or inside
+ * of a termination cell, the flight will be surface tracked from the start of
+ * the delta step instead, so that a particle only escapes when it reaches a
+ * termination cell. A delta step could still jump over a termination cell
+ * that lies between the start cell and the tentative collision site, so
+ * this tracking method is only used when the model has a single termination
+ * cell, which is assumed to be the outer boundary of the model (see
+ * MonteCarlo::StandardParticleSimulationManager).
+ * Note: Forced collisions cannot be done with this tracking method.
+ */
+template<typename State>
+void ParticleSimulationManager::simulateParticleTrackDelta(
+                                              State& particle,
+                                              ParticleBank& bank,
+                                              const double optical_path,
+                                              const bool starting_from_source )
+{
+  // Particle tracking information (op = optical_path)
+  double remaining_track_op = optical_path;
+  double op_to_surface_hit;
+  double distance_to_surface_hit;
+
+  double track_start_point[3] = {particle.getXPosition(),
+                                 particle.getYPosition(),
+                                 particle.getZPosition()};
+
+  // Surface information
+  Geometry::Model::EntityId surface_hit;
+
+  // Cell information
+  double cell_total_macro_cross_section;
+  double majorant_macro_cross_section;
+
+  const double majorant_ratio_threshold =
+    d_properties->getDeltaTrackingMajorantRatioThreshold();
+
+  // Records if global subtrack ending event has been dispatched
+  bool global_subtrack_ending_event_dispatched = false;
+
+  // Records if the particle must be surface tracked through the current cell
+  bool surface_track_flight = false;
+
+  // If the particle started from a source point, update the relevant
+  // particle entering cell event observers
+  if( starting_from_source )
+  {
+    d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                   particle,
+                                                   particle.getCell(),
+                                                   particle.getCellIndex() );
+  }
+
+  // Track until a real collision occurs
+  while( true )
+  {
+    // Get the total cross section for the cell
+    if( !d_model->isCellVoid( particle ) )
+    {
+      cell_total_macro_cross_section =
+        d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+    }
+    else
+      cell_total_macro_cross_section = 0.0;
+
+    majorant_macro_cross_section =
+      d_model->getMacroscopicMajorantCrossSection<State>( particle.getEnergy() );
+
+    // Surface track through this cell
+    if( surface_track_flight ||
+        cell_total_macro_cross_section == 0.0 ||
+        cell_total_macro_cross_section > majorant_macro_cross_section ||
+        cell_total_macro_cross_section <
+        majorant_ratio_threshold*majorant_macro_cross_section )
+    {
+      double cell_distance_to_collision =
+        remaining_track_op/cell_total_macro_cross_section;
+
+      // Fire a ray through the cell currently containing the particle
+      try{
+        distance_to_surface_hit =
+          particle.navigator().fireRay( surface_hit ).value();
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      // Convert the distance to the surface to optical path
+      op_to_surface_hit =
+        distance_to_surface_hit*cell_total_macro_cross_section;
+
+      // The particle passes through this cell to the next
+      if( op_to_surface_hit < remaining_track_op )
+      {
+        try{
+          this->advanceParticleToCellBoundary( particle,
+                                               surface_hit,
+                                               distance_to_surface_hit );
+        }
+        CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+        // The particle has exited the geometry
+        if( d_model->isTerminationCell( particle ) )
+        {
+          particle.setAsGone();
+
+          break;
+        }
+
+        // Update the remaining subtrack mfp
+        remaining_track_op -= op_to_surface_hit;
+
+        // The next cell can be delta tracked again
+        surface_track_flight = false;
+      }
+
+      // A collision occurs in this cell
+      else
+      {
+        this->advanceParticleToCollisionSite( particle,
+                                              remaining_track_op,
+                                              cell_distance_to_collision,
+                                              track_start_point,
+                                              global_subtrack_ending_event_dispatched );
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        break;
+      }
+    }
+
+    // Delta track to the next tentative collision site
+    else
+    {
+      const double distance_to_collision =
+        remaining_track_op/majorant_macro_cross_section;
+
+      const Geometry::Model::EntityId start_cell = particle.getCell();
+      const size_t start_cell_index = particle.getCellIndex();
+
+      // Locate the cell that contains the tentative collision site
+      const Geometry::Navigator::Length tentative_site[3] =
+        {Geometry::Navigator::Length::from_value( particle.getXPosition() + distance_to_collision*particle.getXDirection() ),
+         Geometry::Navigator::Length::from_value( particle.getYPosition() + distance_to_collision*particle.getYDirection() ),
+         Geometry::Navigator::Length::from_value( particle.getZPosition() + distance_to_collision*particle.getZDirection() )};
+
+      Geometry::Model::EntityId tentative_site_cell;
+
+      try{
+        tentative_site_cell = particle.navigator().findCellContainingRay(
+                                                   tentative_site,
+                                                   particle.getDirection() );
+      }
+      catch( const std::runtime_error& exception )
+      {
+        tentative_site_cell = Geometry::Model::invalidCellId();
+      }
+
+      // The tentative collision site is outside of the model or inside of a
+      // termination cell - surface track this flight so that the particle
+      // only escapes if it reaches a termination cell (any other failure
+      // will result in a lost particle)
+      if( tentative_site_cell == Geometry::Model::invalidCellId() ||
+          d_model->isTerminationCell( tentative_site_cell ) )
+      {
+        surface_track_flight = true;
+
+        continue;
+      }
+
+      // Move the particle to the tentative collision site
+      try{
+        particle.navigator().setState( tentative_site[0],
+                                       tentative_site[1],
+                                       tentative_site[2],
+                                       particle.getXDirection(),
+                                       particle.getYDirection(),
+                                       particle.getZDirection(),
+                                       tentative_site_cell );
+      }
+      CATCH_LOST_PARTICLE_AND_BREAK( particle );
+
+      particle.setTime( particle.getTime() +
+                        distance_to_collision/particle.getSpeed() );
+
+      if( particle.getCell() != start_cell )
+      {
+        // Update the observers: particle leaving cell event
+        d_event_handler->updateObserversFromParticleLeavingCellEvent(
+                                                            particle,
+                                                            start_cell,
+                                                            start_cell_index );
+
+        // Update the observers: particle entering cell event
+        d_event_handler->updateObserversFromParticleEnteringCellEvent(
+                                                     particle,
+                                                     particle.getCell(),
+                                                     particle.getCellIndex() );
+      }
+
+      // Get the total cross section at the tentative collision site
+      if( !d_model->isCellVoid( particle ) )
+      {
+        cell_total_macro_cross_section =
+          d_model->getMacroscopicTotalForwardCrossSectionQuick( particle );
+      }
+      else
+        cell_total_macro_cross_section = 0.0;
+
+      // The majorant does not bound the cell cross section - the collision
+      // must be accepted (the flight was under sampled)
+      if( cell_total_macro_cross_section > majorant_macro_cross_section )
+      {
+        FRENSIE_LOG_TAGGED_WARNING( "Delta Tracking",
+                                    "the total cross section of cell "
+                                    << particle.getCell() << " ("
+                                    << cell_total_macro_cross_section
+                                    << ") exceeds the majorant ("
+                                    << majorant_macro_cross_section
+                                    << ") at energy " << particle.getEnergy()
+                                    << " (history "
+                                    << particle.getHistoryNumber() << ")!" );
+      }
+
+      // A real collision occurs
+      if( Utility::RandomNumberGenerator::getRandomNumber<double>()*
+          majorant_macro_cross_section < cell_total_macro_cross_section )
+      {
+        d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+
+        global_subtrack_ending_event_dispatched = true;
+
+        this->collideWithCellMaterial( particle, bank );
+
+        // This track is finished
+        break;
+      }
+
+      // A virtual collision occurs - sample a new optical path
+      else
+      {
+        remaining_track_op =
+          d_transport_kernel->sampleOpticalPathLengthToNextCollisionSite();
+      }
+    }
+
+    // The ray safety distance is no longer valid
+    particle.setRaySafetyDistance( 0.0 );
+  }
+
+  if( !global_subtrack_ending_event_dispatched )
+  {
+    d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
+                                                      particle,
+                                                      track_start_point,
+                                                      particle.getPosition() );
+  }
+
+  if( !particle )
+    d_event_handler->updateObserversFromParticleGoneGlobalEvent( particle );
+}
+
 // Advance a particle to the cell boundary
 template<typename State>
 void ParticleSimulationManager::advanceParticleToCellBoundary(
                               State& particle,
                               const Geometry::Model::EntityId surface_to_cross,
                               const double distance_to_surface )
+{
+  this->advanceParticleToCellBoundaryImpl( particle,
+                                           surface_to_cross,
+                                           distance_to_surface,
+                                           []( State& ){} );
+}
+
+// Advance a particle to the cell boundary and call the desired method
+// once the subtrack ending in cell event has been dispatched
+/*! \details The subtrack ended method is called before the particle leaving
+ * cell, crossing surface and entering cell events are dispatched (e.g. to
+ * dispatch the subtrack ending global event or to update the particle state
+ * that is seen by the surface observers).
+ */
+template<typename State, typename SubtrackEndedMethod>
+void ParticleSimulationManager::advanceParticleToCellBoundaryImpl(
+                              State& particle,
+                              const Geometry::Model::EntityId surface_to_cross,
+                              const double distance_to_surface,
+                              const SubtrackEndedMethod& subtrack_ended )
 {
   // Advance the particle to the cell boundary
   // Note: this will change the particle's cell
   Geometry::Model::EntityId start_cell = particle.getCell();
+  size_t start_cell_index = particle.getCellIndex();
 
   double surface_normal[3];
   bool reflected = particle.navigator().advanceToCellBoundary( surface_normal );
@@ -586,10 +911,20 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
   d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
                                                          particle,
                                                          start_cell,
+                                                         start_cell_index,
                                                          distance_to_surface );
 
+  if( d_transport_event_hooks_enabled )
+  {
+    this->registerParticleSubtrackEndingInCellEvent( particle,
+                                                     start_cell,
+                                                     distance_to_surface );
+  }
+
+  subtrack_ended( particle );
+
   // Update the observers: particle leaving cell event
-  d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell );
+  d_event_handler->updateObserversFromParticleLeavingCellEvent( particle, start_cell, start_cell_index );
 
   // Update the observers: particle crossing surface event
   d_event_handler->updateObserversFromParticleCrossingSurfaceEvent(
@@ -607,7 +942,7 @@ void ParticleSimulationManager::advanceParticleToCellBoundary(
   }
 
   // Update the observers: particle entering cell event
-  d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell() );
+  d_event_handler->updateObserversFromParticleEnteringCellEvent( particle, particle.getCell(), particle.getCellIndex() );
 }
 
 // Advance a particle to a collision site
@@ -626,8 +961,16 @@ void ParticleSimulationManager::advanceParticleToCollisionSite(
   d_event_handler->updateObserversFromParticleSubtrackEndingInCellEvent(
                                                        particle,
                                                        particle.getCell(),
+                                                       particle.getCellIndex(),
                                                        distance_to_collision );
 
+  if( d_transport_event_hooks_enabled )
+  {
+    this->registerParticleSubtrackEndingInCellEvent( particle,
+                                                     particle.getCell(),
+                                                     distance_to_collision );
+  }
+
   // Update the observers: particle subtrack ending global event
   d_event_handler->updateObserversFromParticleSubtrackEndingGlobalEvent(
                                                       particle,
@@ -642,14 +985,62 @@ template<typename State>
 void ParticleSimulationManager::collideWithCellMaterial( State& particle,
                                                          ParticleBank& bank )
 {
-  ParticleBank local_bank;
+  this->collideWithCellMaterialImpl( particle,
+                                     bank,
+                                     [this]( State& particle,
+                                             ParticleBank& local_bank )
+                                     {
+                                       d_collision_kernel->collideWithCellMaterial( particle, local_bank );
+                                     } );
+}
+
+// Collide with the cell material using the desired collision method
+template<typename State, typename CollisionMethod>
+void ParticleSimulationManager::collideWithCellMaterialImpl(
+                                               State& particle,
+                                               ParticleBank& bank,
+                                               const CollisionMethod& collide )
+{
+  // Fission neutrons are only offered to the manager when the transport
+  // event hooks have been enabled
+  if( d_transport_event_hooks_enabled )
+  {
+    Details::CollisionParticleBank local_bank( *this );
+
+    this->collideWithCellMaterialImpl( particle, bank, local_bank, collide );
+  }
+  else
+  {
+    ParticleBank local_bank;
+
+    this->collideWithCellMaterialImpl( particle, bank, local_bank, collide );
+  }
+}
+
+// Collide with the cell material using the desired collision method
+template<typename State, typename CollisionMethod>
+void ParticleSimulationManager::collideWithCellMaterialImpl(
+                                               State& particle,
+                                               ParticleBank& bank,
+                                               ParticleBank& local_bank,
+                                               const CollisionMethod& collide )
+{
+  const double pre_collision_energy = particle.getEnergy();
+  const double pre_collision_weight = particle.getWeight();
 
   // Undergo a collision with the material in the cell
   try{
-    d_collision_kernel->collideWithCellMaterial( particle, local_bank );
+    collide( particle, local_bank );
   }
   CATCH_LOST_PARTICLE( particle );
 
+  if( d_transport_event_hooks_enabled && !particle.isLost() )
+  {
+    this->registerParticleCollisionEvent( particle,
+                                          pre_collision_energy,
+                                          pre_collision_weight );
+  }
+
   // Apply the population managers to the original particle and to each of its
   // progeny. Multiple particle mode will result in all different particle types using the same
   // population manager for now. Needs to be fixed later if desired.
@@ -0,0 +1,154 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ShannonEntropyMesh.cpp
+//! \author Alex Robinson
+//! \brief  Shannon entropy mesh class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_ShannonEntropyMesh.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+ShannonEntropyMesh::ShannonEntropyMesh()
+  : d_lower_bounds(),
+    d_bin_widths(),
+    d_bins_per_dimension( 0 )
+{ /* ... */ }
+
+// Initialize the mesh from the bounding box of the fission sites
+/*! \details If the number of bins per dimension is 0 it will be chosen so
+ * that there are approximately 20 sites per bin (assuming a uniform site
+ * distribution).
+ */
+void ShannonEntropyMesh::initialize( const std::vector<FissionSite>& sites,
+                                     const unsigned bins_per_dimension )
+{
+  // Make sure that there are sites
+  testPrecondition( sites.size() > 0 );
+
+  double upper_bounds[3];
+
+  for( size_t j = 0; j < 3; ++j )
+  {
+    d_lower_bounds[j] = std::numeric_limits<double>::max();
+    upper_bounds[j] = std::numeric_limits<double>::lowest();
+  }
+
+  for( size_t i = 0; i < sites.size(); ++i )
+  {
+    for( size_t j = 0; j < 3; ++j )
+    {
+      d_lower_bounds[j] = std::min( d_lower_bounds[j], sites[i].position[j] );
+      upper_bounds[j] = std::max( upper_bounds[j], sites[i].position[j] );
+    }
+  }
+
+  if( bins_per_dimension > 0 )
+    d_bins_per_dimension = bins_per_dimension;
+  else
+  {
+    d_bins_per_dimension =
+      std::max( (unsigned)std::floor( std::cbrt( sites.size()/20.0 ) ), 1u );
+  }
+
+  for( size_t j = 0; j < 3; ++j )
+  {
+    d_bin_widths[j] =
+      (upper_bounds[j] - d_lower_bounds[j])/d_bins_per_dimension;
+  }
+}
+
+// Check if the mesh has been initialized
+bool ShannonEntropyMesh::isInitialized() const
+{
+  return d_bins_per_dimension > 0;
+}
+
+// Return the number of bins per dimension
+unsigned ShannonEntropyMesh::getNumberOfBinsPerDimension() const
+{
+  return d_bins_per_dimension;
+}
+
+// Calculate the Shannon entropy of the fission sites
+/*! \details Sites that fall outside of the mesh will be assigned to the
+ * nearest boundary bin.
+ */
+double ShannonEntropyMesh::calculateEntropy(
+                                 const std::vector<FissionSite>& sites ) const
+{
+  // Make sure that the mesh has been initialized
+  testPrecondition( this->isInitialized() );
+
+  std::vector<double> bin_weights( (size_t)d_bins_per_dimension*
+                                   d_bins_per_dimension*
+                                   d_bins_per_dimension,
+                                   0.0 );
+
+  double total_weight = 0.0;
+
+  for( size_t i = 0; i < sites.size(); ++i )
+  {
+    bin_weights[this->calculateBinIndex( sites[i] )] += sites[i].weight;
+
+    total_weight += sites[i].weight;
+  }
+
+  double entropy = 0.0;
+
+  if( total_weight > 0.0 )
+  {
+    for( size_t i = 0; i < bin_weights.size(); ++i )
+    {
+      if( bin_weights[i] > 0.0 )
+      {
+        const double bin_probability = bin_weights[i]/total_weight;
+
+        entropy -= bin_probability*std::log2( bin_probability );
+      }
+    }
+  }
+
+  return entropy;
+}
+
+// Calculate the bin index of a site
+size_t ShannonEntropyMesh::calculateBinIndex( const FissionSite& site ) const
+{
+  size_t bin_index = 0;
+
+  for( int j = 2; j >= 0; --j )
+  {
+    size_t dimension_bin_index = 0;
+
+    if( d_bin_widths[j] > 0.0 )
+    {
+      const double relative_position =
+        (site.position[j] - d_lower_bounds[j])/d_bin_widths[j];
+
+      if( relative_position >= d_bins_per_dimension )
+        dimension_bin_index = d_bins_per_dimension - 1;
+      else if( relative_position > 0.0 )
+        dimension_bin_index = (size_t)relative_position;
+    }
+
+    bin_index = bin_index*d_bins_per_dimension + dimension_bin_index;
+  }
+
+  return bin_index;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ShannonEntropyMesh.cpp
+//---------------------------------------------------------------------------//
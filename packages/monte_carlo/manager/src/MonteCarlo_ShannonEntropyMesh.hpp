@@ -0,0 +1,73 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_ShannonEntropyMesh.hpp
+//! \author Alex Robinson
+//! \brief  Shannon entropy mesh class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_SHANNON_ENTROPY_MESH_HPP
+#define MONTE_CARLO_SHANNON_ENTROPY_MESH_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+
+namespace MonteCarlo{
+
+/*! The Shannon entropy mesh class
+ *
+ * The Shannon entropy of the fission source, H = -sum_i p_i log2(p_i), is
+ * calculated on a uniform Cartesian mesh, where p_i is the fraction of the
+ * fission site weight in mesh bin i. The entropy can be used to judge when
+ * the fission source has converged.
+ */
+class ShannonEntropyMesh
+{
+
+public:
+
+  //! Constructor
+  ShannonEntropyMesh();
+
+  //! Destructor
+  ~ShannonEntropyMesh()
+  { /* ... */ }
+
+  //! Initialize the mesh from the bounding box of the fission sites
+  void initialize( const std::vector<FissionSite>& sites,
+                   const unsigned bins_per_dimension );
+
+  //! Check if the mesh has been initialized
+  bool isInitialized() const;
+
+  //! Return the number of bins per dimension
+  unsigned getNumberOfBinsPerDimension() const;
+
+  //! Calculate the Shannon entropy of the fission sites
+  double calculateEntropy( const std::vector<FissionSite>& sites ) const;
+
+private:
+
+  // Calculate the bin index of a site
+  size_t calculateBinIndex( const FissionSite& site ) const;
+
+  // The lower bounds of the mesh
+  double d_lower_bounds[3];
+
+  // The bin widths of the mesh
+  double d_bin_widths[3];
+
+  // The number of bins per dimension
+  unsigned d_bins_per_dimension;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_SHANNON_ENTROPY_MESH_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_ShannonEntropyMesh.hpp
+//---------------------------------------------------------------------------//
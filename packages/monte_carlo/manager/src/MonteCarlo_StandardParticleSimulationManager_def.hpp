@@ -19,6 +19,8 @@
 #include "MonteCarlo_ParticleModeTypeTraits.hpp"
 #include "MonteCarlo_CollisionForcer.hpp"
 #include "MonteCarlo_StandardCollisionForcer.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace MonteCarlo{
 
@@ -111,7 +113,28 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
   // Make sure that the state is compatible with the mode
   testPrecondition( MonteCarlo::isParticleTypeCompatible<mode>( particle_type ) );
 
-  if( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) )
+  // Electrons can be transported with the condensed history method
+  if( particle_type == ELECTRON &&
+      this->getSimulationProperties().isCondensedHistoryModeOn() )
+  {
+    // The condensed history steps do not sample forced collisions
+    TEST_FOR_EXCEPTION( this->getCollisionForcer().hasForcedCollisionCells( particle_type ),
+                        std::runtime_error,
+                        "Forced collisions cannot be used with particle type "
+                        << particle_type << " because the condensed history "
+                        "method has been requested for it!" );
+
+    d_simulate_particle_function_map[particle_type] =
+      std::bind<void>( &StandardParticleSimulationManager<mode>::simulateElectronCondensedHistory,
+                       std::ref( *this ),
+                       std::placeholders::_1,
+                       std::placeholders::_2,
+                       std::placeholders::_3 );
+  }
+  // Forced collisions can only be done with the "alternative" tracking method
+  else if( this->getCollisionForcer().hasForcedCollisionCells( particle_type ) ||
+      this->getSimulationProperties().getTrackingMethod() ==
+      ALTERNATIVE_TRACKING )
   {
     d_simulate_particle_function_map[particle_type] =
       std::bind<void>( &ParticleSimulationManager::simulateParticleAlternative<State>,
@@ -120,6 +143,48 @@ void StandardParticleSimulationManager<mode>::addSimulateParticleFunction()
                        std::placeholders::_2,
                        std::placeholders::_3 );
   }
+  else if( this->getSimulationProperties().getTrackingMethod() ==
+           DELTA_TRACKING )
+  {
+    // Cell track-length and surface estimators would silently miss the
+    // delta tracked portions of the tracks
+    TEST_FOR_EXCEPTION( this->getEventHandler().hasSurfaceTrackingEstimators( particle_type ),
+                        std::runtime_error,
+                        "Delta tracking cannot be used with particle type "
+                        << particle_type << " because cell track-length "
+                        "flux or surface estimators have been assigned to "
+                        "it!" );
+
+    // A delta step can jump over a termination cell that is not the outer
+    // boundary of the model (only a single termination cell is assumed to
+    // be the outer boundary)
+    if( this->getModel().getNumberOfTerminationCells() > 1 )
+    {
+      FRENSIE_LOG_TAGGED_WARNING( "Delta Tracking",
+                                  "the model has "
+                                  << this->getModel().getNumberOfTerminationCells()
+                                  << " termination cells - "
+                                  << particle_type << "s will be surface "
+                                  "tracked so that no termination cell "
+                                  "can be skipped!" );
+
+      d_simulate_particle_function_map[particle_type] =
+        std::bind<void>( &ParticleSimulationManager::simulateParticle<State>,
+                         std::ref( *this ),
+                         std::placeholders::_1,
+                         std::placeholders::_2,
+                         std::placeholders::_3 );
+    }
+    else
+    {
+      d_simulate_particle_function_map[particle_type] =
+        std::bind<void>( &ParticleSimulationManager::simulateParticleDelta<State>,
+                         std::ref( *this ),
+                         std::placeholders::_1,
+                         std::placeholders::_2,
+                         std::placeholders::_3 );
+    }
+  }
   else
   {
     d_simulate_particle_function_map[particle_type] =
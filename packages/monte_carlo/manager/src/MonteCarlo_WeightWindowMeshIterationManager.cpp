@@ -0,0 +1,174 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshIterationManager.cpp
+//! \author Philip Britt
+//! \brief  Weight window mesh iteration manager class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <sstream>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshIterationManager.hpp"
+#include "MonteCarlo_EventHandler.hpp"
+#include "Utility_LoggingMacros.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace MonteCarlo{
+
+// Constructor
+/*! \details If the generator already has windows (e.g. from an archived
+ * generator) they will be used by the first iteration.
+ */
+WeightWindowMeshIterationManager::WeightWindowMeshIterationManager(
+                const std::shared_ptr<const FilledGeometryModel>& model,
+                const std::shared_ptr<ParticleSource>& source,
+                const std::shared_ptr<const SimulationProperties>& properties,
+                const std::shared_ptr<WeightWindowMeshGenerator>& generator,
+                const ParticleType particle_type,
+                const std::string& simulation_name,
+                const std::string& archive_type,
+                const unsigned threads )
+  : d_model( model ),
+    d_source( source ),
+    d_properties( properties ),
+    d_generator( generator ),
+    d_particle_type( particle_type ),
+    d_simulation_name( simulation_name ),
+    d_archive_type( archive_type ),
+    d_threads( threads ),
+    d_weight_window_mesh(),
+    d_completed_iterations( 0 ),
+    d_comm( Utility::Communicator::getDefault() )
+{
+  // Make sure that the model is valid
+  testPrecondition( model.get() );
+  // Make sure that the source is valid
+  testPrecondition( source.get() );
+  // Make sure that the properties are valid
+  testPrecondition( properties.get() );
+  // Make sure that the generator is valid
+  testPrecondition( generator.get() );
+  // Make sure that the number of threads is valid
+  testPrecondition( threads > 0 );
+
+  TEST_FOR_EXCEPTION( properties->isKEigenvalueModeOn(),
+                      std::runtime_error,
+                      "Weight windows cannot be generated with a "
+                      "k-eigenvalue simulation!" );
+
+  d_weight_window_mesh = d_generator->createWeightWindowMesh();
+}
+
+// Run the weight window iterations
+/*! \details This method must be called by every process.
+ */
+void WeightWindowMeshIterationManager::runIterations(
+                                         const unsigned number_of_iterations )
+{
+  for( unsigned i = 0; i < number_of_iterations; ++i )
+  {
+    this->runIteration();
+
+    if( d_comm->rank() == 0 )
+    {
+      FRENSIE_LOG_NOTIFICATION( "Weight window iteration "
+                                << d_completed_iterations << " finished ("
+                                << d_generator->getWeightWindowMap().size()
+                                << " mesh elements with windows)." );
+      FRENSIE_FLUSH_ALL_LOGS();
+    }
+  }
+}
+
+// Run a weight window iteration
+void WeightWindowMeshIterationManager::runIteration()
+{
+  // Only the generator flux estimator is needed in the forward calculation
+  std::shared_ptr<EventHandler> event_handler(
+                                        new EventHandler( *d_properties ) );
+
+  std::shared_ptr<WeightMultipliedMeshTrackLengthFluxEstimator>
+    flux_estimator = d_generator->createFluxEstimator( 0, d_particle_type );
+
+  event_handler->addEstimator( flux_estimator );
+
+  std::ostringstream iteration_simulation_name;
+
+  iteration_simulation_name << d_simulation_name << "_"
+                            << d_completed_iterations;
+
+  {
+    ParticleSimulationManagerFactory factory( d_model,
+                                              d_source,
+                                              event_handler,
+                                              d_properties,
+                                              iteration_simulation_name.str(),
+                                              d_archive_type,
+                                              d_threads );
+
+    // The first iteration of a new generator is run without windows
+    if( !d_generator->getWeightWindowMap().empty() )
+      factory.setPopulationControl( d_weight_window_mesh );
+
+    factory.getManager()->runSimulation();
+  }
+
+  // The estimator data is only complete on the root process
+  if( d_comm->rank() == 0 )
+    d_generator->generateWeightWindows( *flux_estimator );
+
+  if( d_comm->size() > 1 )
+    this->broadcastWeightWindows();
+
+  d_generator->updateWeightWindowMesh( *d_weight_window_mesh );
+
+  ++d_completed_iterations;
+}
+
+// Broadcast the weight windows from the root process
+void WeightWindowMeshIterationManager::broadcastWeightWindows()
+{
+  WeightWindowMeshGenerator::WeightWindowMap weight_window_map;
+
+  if( d_comm->rank() == 0 )
+    weight_window_map = d_generator->getWeightWindowMap();
+
+  try{
+    Utility::broadcast( *d_comm, weight_window_map, 0 );
+  }
+  EXCEPTION_CATCH_RETHROW( std::runtime_error,
+                           "Unable to broadcast the weight windows from the "
+                           "root process!" );
+
+  if( d_comm->rank() != 0 )
+    d_generator->setWeightWindowMap( weight_window_map );
+}
+
+// Return the number of completed iterations
+unsigned WeightWindowMeshIterationManager::getNumberOfCompletedIterations() const
+{
+  return d_completed_iterations;
+}
+
+// Return the weight window generator
+std::shared_ptr<const WeightWindowMeshGenerator>
+WeightWindowMeshIterationManager::getGenerator() const
+{
+  return d_generator;
+}
+
+// Return the weight window mesh with the latest windows
+std::shared_ptr<WeightWindowMesh>
+WeightWindowMeshIterationManager::getWeightWindowMesh() const
+{
+  return d_weight_window_mesh;
+}
+
+} // end MonteCarlo namespace
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshIterationManager.cpp
+//---------------------------------------------------------------------------//
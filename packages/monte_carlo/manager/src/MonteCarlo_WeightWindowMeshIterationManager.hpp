@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   MonteCarlo_WeightWindowMeshIterationManager.hpp
+//! \author Philip Britt
+//! \brief  Weight window mesh iteration manager class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef MONTE_CARLO_WEIGHT_WINDOW_MESH_ITERATION_MANAGER_HPP
+#define MONTE_CARLO_WEIGHT_WINDOW_MESH_ITERATION_MANAGER_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <string>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_WeightWindowMeshGenerator.hpp"
+#include "MonteCarlo_WeightWindowMesh.hpp"
+#include "Utility_Communicator.hpp"
+
+namespace MonteCarlo{
+
+/*! The weight window mesh iteration manager class
+ * \details This class drives the iterative generation of mesh weight windows
+ * (MAGIC method). Each iteration runs a forward calculation that only scores
+ * the mesh flux estimator of the generator, regenerates the windows from the
+ * estimated flux and loads them into the weight window mesh that is used by
+ * the next iteration. When more than one process is used the windows are
+ * generated by the root process and then broadcast. The final weight window
+ * mesh can be passed to the factory of the production calculation and the
+ * generator can be archived so that the window set can be reused.
+ */
+class WeightWindowMeshIterationManager
+{
+
+public:
+
+  //! Constructor
+  WeightWindowMeshIterationManager(
+                const std::shared_ptr<const FilledGeometryModel>& model,
+                const std::shared_ptr<ParticleSource>& source,
+                const std::shared_ptr<const SimulationProperties>& properties,
+                const std::shared_ptr<WeightWindowMeshGenerator>& generator,
+                const ParticleType particle_type,
+                const std::string& simulation_name = "weight_window_iteration",
+                const std::string& archive_type = "xml",
+                const unsigned threads = 1 );
+
+  //! Destructor
+  ~WeightWindowMeshIterationManager()
+  { /* ... */ }
+
+  //! Run the weight window iterations
+  void runIterations( const unsigned number_of_iterations );
+
+  //! Return the number of completed iterations
+  unsigned getNumberOfCompletedIterations() const;
+
+  //! Return the weight window generator
+  std::shared_ptr<const WeightWindowMeshGenerator> getGenerator() const;
+
+  //! Return the weight window mesh with the latest windows
+  std::shared_ptr<WeightWindowMesh> getWeightWindowMesh() const;
+
+private:
+
+  // Run a weight window iteration
+  void runIteration();
+
+  // Broadcast the weight windows from the root process
+  void broadcastWeightWindows();
+
+  // The filled geometry model
+  std::shared_ptr<const FilledGeometryModel> d_model;
+
+  // The particle source
+  std::shared_ptr<ParticleSource> d_source;
+
+  // The simulation properties
+  std::shared_ptr<const SimulationProperties> d_properties;
+
+  // The weight window generator
+  std::shared_ptr<WeightWindowMeshGenerator> d_generator;
+
+  // The particle type that the windows are generated for
+  ParticleType d_particle_type;
+
+  // The simulation name
+  std::string d_simulation_name;
+
+  // The archive type
+  std::string d_archive_type;
+
+  // The number of threads
+  unsigned d_threads;
+
+  // The weight window mesh with the latest windows
+  std::shared_ptr<WeightWindowMesh> d_weight_window_mesh;
+
+  // The number of completed iterations
+  unsigned d_completed_iterations;
+
+  // The communicator
+  std::shared_ptr<const Utility::Communicator> d_comm;
+};
+
+} // end MonteCarlo namespace
+
+#endif // end MONTE_CARLO_WEIGHT_WINDOW_MESH_ITERATION_MANAGER_HPP
+
+//---------------------------------------------------------------------------//
+// end MonteCarlo_WeightWindowMeshIterationManager.hpp
+//---------------------------------------------------------------------------//
@@ -15,6 +15,7 @@
 
 // FRENSIE Includes
 #include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_BatchedDistributedStandardParticleSimulationManager.hpp"
 #include "MonteCarlo_StandardParticleSource.hpp"
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
@@ -34,6 +35,38 @@ using boost::units::si::kelvin;
 using boost::units::cgs::cubic_centimeter;
 using Utility::Units::MeV;
 
+class TestBatchedDistributedStandardParticleSimulationManager : public MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>
+{
+public:
+
+  TestBatchedDistributedStandardParticleSimulationManager(
+      const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+      const std::shared_ptr<MonteCarlo::ParticleSource>& source,
+      const std::shared_ptr<MonteCarlo::EventHandler>& event_handler,
+      const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+    : MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>(
+                                  "test_sim",
+                                  "xml",
+                                  model,
+                                  source,
+                                  event_handler,
+                                  MonteCarlo::PopulationControl::getDefault(),
+                                  MonteCarlo::CollisionForcer::getDefault(),
+                                  properties,
+                                  0,
+                                  0,
+                                  true,
+                                  Utility::Communicator::getDefault() )
+  { /* ... */ }
+
+  ~TestBatchedDistributedStandardParticleSimulationManager()
+  { /* ... */ }
+
+  using MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::createTask;
+  using MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::calculateTaskSize;
+  using MonteCarlo::BatchedDistributedStandardParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::setProcessHistoryRate;
+};
+
 //---------------------------------------------------------------------------//
 // Testing Variables
 //---------------------------------------------------------------------------//
@@ -109,7 +142,9 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, get_history_details )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
   FRENSIE_CHECK_EQUAL( manager->getRendezvousBatchSize(),
                        (Utility::GlobalMPISession::size()-1)*5 );
-  FRENSIE_CHECK_EQUAL( manager->getBatchSize(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getBatchSize(),
+                       (Utility::GlobalMPISession::size()-1)*5/
+                       Utility::GlobalMPISession::size() );
 
   manager.reset();
 
@@ -163,7 +198,9 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, get_history_details )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
   FRENSIE_CHECK_EQUAL( manager->getRendezvousBatchSize(),
                        (Utility::GlobalMPISession::size()-1)*5 );
-  FRENSIE_CHECK_EQUAL( manager->getBatchSize(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getBatchSize(),
+                       (Utility::GlobalMPISession::size()-1)*5/
+                       Utility::GlobalMPISession::size() );
 
   manager.reset();
 
@@ -218,7 +255,9 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, get_history_details )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
   FRENSIE_CHECK_EQUAL( manager->getRendezvousBatchSize(),
                        (Utility::GlobalMPISession::size()-1)*10 );
-  FRENSIE_CHECK_EQUAL( manager->getBatchSize(), 10 );
+  FRENSIE_CHECK_EQUAL( manager->getBatchSize(),
+                       (Utility::GlobalMPISession::size()-1)*10/
+                       Utility::GlobalMPISession::size() );
 
   manager.reset();
 
@@ -274,11 +313,160 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, get_history_details )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 0 );
   FRENSIE_CHECK_EQUAL( manager->getRendezvousBatchSize(),
                        (Utility::GlobalMPISession::size()-1)*10 );
-  FRENSIE_CHECK_EQUAL( manager->getBatchSize(), 5 );
+  FRENSIE_CHECK_EQUAL( manager->getBatchSize(),
+                       (Utility::GlobalMPISession::size()-1)*10/
+                       (2*Utility::GlobalMPISession::size()) );
 
   manager.reset();
 }
 
+//---------------------------------------------------------------------------//
+// Check that the process task sizes can be calculated
+FRENSIE_UNIT_TEST( BatchedDistributedStandardParticleSimulationManager,
+                   calculateTaskSize )
+{
+  const int size = Utility::GlobalMPISession::size();
+  
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setNumberOfHistories( size*40 );
+  properties->setNumberOfBatchesPerProcessor( 2 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestBatchedDistributedStandardParticleSimulationManager
+    manager( model, source, event_handler, properties );
+
+  FRENSIE_REQUIRE_EQUAL( manager.getRendezvousBatchSize(), size*40 );
+  FRENSIE_REQUIRE_EQUAL( manager.getBatchSize(), 20 );
+
+  // Unmeasured history rates
+  for( int i = 0; i < size; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( manager.calculateTaskSize( i ), 20 );
+  }
+
+  // Measured history rates are scaled by the mean measured history rate
+  manager.setProcessHistoryRate( 0, 1.0 );
+  manager.setProcessHistoryRate( 1, 3.0 );
+
+  FRENSIE_CHECK_EQUAL( manager.calculateTaskSize( 0 ), 10 );
+  FRENSIE_CHECK_EQUAL( manager.calculateTaskSize( 1 ), 30 );
+
+  for( int i = 2; i < size; ++i )
+  {
+    FRENSIE_CHECK_EQUAL( manager.calculateTaskSize( i ), 20 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that process tasks can be created
+FRENSIE_UNIT_TEST( BatchedDistributedStandardParticleSimulationManager,
+                   createTask )
+{
+  const int size = Utility::GlobalMPISession::size();
+  
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setNumberOfHistories( size*40 );
+  properties->setNumberOfBatchesPerProcessor( 2 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestBatchedDistributedStandardParticleSimulationManager
+    manager( model, source, event_handler, properties );
+
+  // The root process tasks are halved
+  std::pair<uint64_t,uint64_t> task = manager.createTask( 0, 0 );
+
+  FRENSIE_CHECK_EQUAL( task.first, 0 );
+  FRENSIE_CHECK_EQUAL( task.second, 10 );
+
+  task = manager.createTask( 1, 0 );
+
+  FRENSIE_CHECK_EQUAL( task.first, 0 );
+  FRENSIE_CHECK_EQUAL( task.second, 20 );
+
+  // Rate scaled tasks
+  manager.setProcessHistoryRate( 0, 1.0 );
+  manager.setProcessHistoryRate( 1, 3.0 );
+
+  task = manager.createTask( 0, 0 );
+
+  FRENSIE_CHECK_EQUAL( task.first, 0 );
+  FRENSIE_CHECK_EQUAL( task.second, 5 );
+
+  task = manager.createTask( 1, 0 );
+
+  FRENSIE_CHECK_EQUAL( task.first, 0 );
+  FRENSIE_CHECK_EQUAL( task.second, 30 );
+
+  // The tasks are capped to an even share of the unassigned histories
+  task = manager.createTask( 1, size*40 - size*2 );
+
+  FRENSIE_CHECK_EQUAL( task.first, size*40 - size*2 );
+  FRENSIE_CHECK_EQUAL( task.second, size*40 - size*2 + 2 );
+
+  task = manager.createTask( 0, size*40 - size*2 );
+
+  FRENSIE_CHECK_EQUAL( task.first, size*40 - size*2 );
+  FRENSIE_CHECK_EQUAL( task.second, size*40 - size*2 + 2 );
+
+  // Every task has at least one history
+  task = manager.createTask( 1, size*40 - 1 );
+
+  FRENSIE_CHECK_EQUAL( task.first, size*40 - 1 );
+  FRENSIE_CHECK_EQUAL( task.second, size*40 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation manager can rename the simulation
 FRENSIE_UNIT_TEST( ParticleSimulationManager, setSimulationName )
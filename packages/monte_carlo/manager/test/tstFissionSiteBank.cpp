@@ -0,0 +1,281 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFissionSiteBank.cpp
+//! \author Alex Robinson
+//! \brief  Fission site bank and Shannon entropy mesh unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <cmath>
+
+// FRENSIE Includes
+#include "MonteCarlo_FissionSiteBank.hpp"
+#include "MonteCarlo_ShannonEntropyMesh.hpp"
+#include "MonteCarlo_NeutronState.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a fission site
+MonteCarlo::FissionSite createSite( const double x,
+                                    const double y,
+                                    const double z,
+                                    const double weight )
+{
+  MonteCarlo::FissionSite site;
+  site.parent_history = 0;
+  site.site_index = 0;
+  site.position[0] = x;
+  site.position[1] = y;
+  site.position[2] = z;
+  site.direction[0] = 0.0;
+  site.direction[1] = 0.0;
+  site.direction[2] = 1.0;
+  site.energy = 1.0;
+  site.weight = weight;
+
+  return site;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that sites can be added to the bank
+FRENSIE_UNIT_TEST( FissionSiteBank, addSite )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 0 );
+  FRENSIE_CHECK_EQUAL( bank.getTotalWeight(), 0.0 );
+
+  MonteCarlo::NeutronState neutron( 1ull );
+  neutron.setPosition( 1.0, 2.0, 3.0 );
+  neutron.setDirection( 0.0, 0.0, 1.0 );
+  neutron.setEnergy( 2.0 );
+  neutron.setWeight( 0.5 );
+
+  bank.addSite( neutron );
+  bank.addSite( neutron );
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 2 );
+  FRENSIE_CHECK_EQUAL( bank.getTotalWeight(), 1.0 );
+
+  bank.clear();
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sites can be extracted in a reproducible order
+FRENSIE_UNIT_TEST( FissionSiteBank, extractSortedSites )
+{
+  MonteCarlo::FissionSiteBank bank;
+
+  MonteCarlo::NeutronState neutron_a( 5ull );
+  neutron_a.setEnergy( 1.0 );
+
+  MonteCarlo::NeutronState neutron_b( 2ull );
+  neutron_b.setEnergy( 2.0 );
+
+  bank.addSite( neutron_a );
+  bank.addSite( neutron_a );
+  bank.addSite( neutron_b );
+
+  std::vector<MonteCarlo::FissionSite> sites;
+
+  bank.extractSortedSites( sites );
+
+  FRENSIE_REQUIRE_EQUAL( sites.size(), 3 );
+  FRENSIE_CHECK_EQUAL( sites[0].parent_history, 2 );
+  FRENSIE_CHECK_EQUAL( sites[0].site_index, 0 );
+  FRENSIE_CHECK_EQUAL( sites[0].energy, 2.0 );
+  FRENSIE_CHECK_EQUAL( sites[1].parent_history, 5 );
+  FRENSIE_CHECK_EQUAL( sites[1].site_index, 0 );
+  FRENSIE_CHECK_EQUAL( sites[2].parent_history, 5 );
+  FRENSIE_CHECK_EQUAL( sites[2].site_index, 1 );
+
+  FRENSIE_CHECK_EQUAL( bank.getNumberOfSites(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sites can be resampled
+FRENSIE_UNIT_TEST( FissionSiteBank, resampleSites )
+{
+  std::vector<MonteCarlo::FissionSite> sites( 2 );
+  sites[0] = createSite( -1.0, 0.0, 0.0, 1.0 );
+  sites[1] = createSite( 1.0, 0.0, 0.0, 3.0 );
+
+  std::vector<MonteCarlo::FissionSite> resampled_sites;
+
+  MonteCarlo::FissionSiteBank::resampleSites( sites, 4, 0.5, resampled_sites );
+
+  FRENSIE_REQUIRE_EQUAL( resampled_sites.size(), 4 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[0].position[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[1].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[2].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[3].position[0], 1.0 );
+
+  for( size_t i = 0; i < resampled_sites.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( resampled_sites[i].weight, 1.0 );
+  }
+
+  MonteCarlo::FissionSiteBank::resampleSites( sites, 0, 0.5, resampled_sites );
+
+  FRENSIE_CHECK( resampled_sites.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the comb offset determines which sites are resampled
+FRENSIE_UNIT_TEST( FissionSiteBank, resampleSites_comb_offset )
+{
+  std::vector<MonteCarlo::FissionSite> sites( 2 );
+  sites[0] = createSite( -1.0, 0.0, 0.0, 1.5 );
+  sites[1] = createSite( 1.0, 0.0, 0.0, 2.5 );
+
+  std::vector<MonteCarlo::FissionSite> resampled_sites;
+
+  // Comb teeth at 0.25, 1.25, 2.25, 3.25
+  MonteCarlo::FissionSiteBank::resampleSites( sites, 4, 0.25, resampled_sites );
+
+  FRENSIE_REQUIRE_EQUAL( resampled_sites.size(), 4 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[0].position[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[1].position[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[2].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[3].position[0], 1.0 );
+
+  // Comb teeth at 0.75, 1.75, 2.75, 3.75
+  MonteCarlo::FissionSiteBank::resampleSites( sites, 4, 0.75, resampled_sites );
+
+  FRENSIE_REQUIRE_EQUAL( resampled_sites.size(), 4 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[0].position[0], -1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[1].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[2].position[0], 1.0 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[3].position[0], 1.0 );
+
+  // The first site can always be reached
+  MonteCarlo::FissionSiteBank::resampleSites( sites, 1, 0.0, resampled_sites );
+
+  FRENSIE_REQUIRE_EQUAL( resampled_sites.size(), 1 );
+  FRENSIE_CHECK_EQUAL( resampled_sites[0].position[0], -1.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Shannon entropy of the fission source can be calculated
+FRENSIE_UNIT_TEST( ShannonEntropyMesh, calculateEntropy )
+{
+  std::vector<MonteCarlo::FissionSite> sites( 2 );
+  sites[0] = createSite( 0.0, 0.0, 0.0, 1.0 );
+  sites[1] = createSite( 1.0, 1.0, 1.0, 1.0 );
+
+  MonteCarlo::ShannonEntropyMesh mesh;
+
+  FRENSIE_CHECK( !mesh.isInitialized() );
+
+  mesh.initialize( sites, 2 );
+
+  FRENSIE_CHECK( mesh.isInitialized() );
+  FRENSIE_CHECK_EQUAL( mesh.getNumberOfBinsPerDimension(), 2 );
+
+  // Two equally populated bins
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh.calculateEntropy( sites ), 1.0, 1e-12 );
+
+  // All sites in a single bin
+  sites[1] = sites[0];
+
+  FRENSIE_CHECK_SMALL( mesh.calculateEntropy( sites ), 1e-12 );
+
+  // Sites outside of the mesh are placed in the closest bin
+  sites.push_back( createSite( 10.0, 10.0, 10.0, 1.0 ) );
+  sites.push_back( createSite( 10.0, 10.0, 10.0, 1.0 ) );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh.calculateEntropy( sites ), 1.0, 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Shannon entropy accounts for the site weights
+FRENSIE_UNIT_TEST( ShannonEntropyMesh, calculateEntropy_weighted )
+{
+  std::vector<MonteCarlo::FissionSite> sites( 2 );
+  sites[0] = createSite( 0.0, 0.0, 0.0, 1.0 );
+  sites[1] = createSite( 1.0, 0.0, 0.0, 3.0 );
+
+  MonteCarlo::ShannonEntropyMesh mesh;
+  mesh.initialize( sites, 2 );
+
+  // H = -(1/4)log2(1/4) - (3/4)log2(3/4)
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh.calculateEntropy( sites ),
+                                   0.8112781244591328,
+                                   1e-12 );
+
+  // Sites with no weight do not contribute
+  sites[1].weight = 0.0;
+
+  FRENSIE_CHECK_SMALL( mesh.calculateEntropy( sites ), 1e-12 );
+
+  sites[0].weight = 0.0;
+
+  FRENSIE_CHECK_EQUAL( mesh.calculateEntropy( sites ), 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the Shannon entropy can be calculated on a 3D mesh
+FRENSIE_UNIT_TEST( ShannonEntropyMesh, calculateEntropy_3d )
+{
+  std::vector<MonteCarlo::FissionSite> sites;
+
+  // One site in each corner of the unit cube
+  for( size_t i = 0; i < 8; ++i )
+  {
+    sites.push_back( createSite( (double)(i & 1),
+                                 (double)((i >> 1) & 1),
+                                 (double)((i >> 2) & 1),
+                                 1.0 ) );
+  }
+
+  MonteCarlo::ShannonEntropyMesh mesh;
+  mesh.initialize( sites, 2 );
+
+  // Eight equally populated bins
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh.calculateEntropy( sites ), 3.0, 1e-12 );
+
+  // Move the sites at z=1 to z=0 (four equally populated bins)
+  for( size_t i = 4; i < 8; ++i )
+    sites[i].position[2] = 0.0;
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mesh.calculateEntropy( sites ), 2.0, 1e-12 );
+
+  // Mesh with a single bin
+  mesh.initialize( sites, 1 );
+
+  FRENSIE_CHECK_SMALL( mesh.calculateEntropy( sites ), 1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the number of mesh bins can be chosen automatically
+FRENSIE_UNIT_TEST( ShannonEntropyMesh, initialize_automatic_bins )
+{
+  std::vector<MonteCarlo::FissionSite> sites;
+
+  for( size_t i = 0; i < 270; ++i )
+    sites.push_back( createSite( i/270.0, i/270.0, i/270.0, 1.0 ) );
+
+  MonteCarlo::ShannonEntropyMesh mesh;
+  mesh.initialize( sites, 0 );
+
+  // Approximately 20 sites per bin
+  FRENSIE_CHECK_EQUAL( mesh.getNumberOfBinsPerDimension(), 2 );
+
+  sites.resize( 10 );
+
+  mesh.initialize( sites, 0 );
+
+  FRENSIE_CHECK_EQUAL( mesh.getNumberOfBinsPerDimension(), 1 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFissionSiteBank.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,673 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstKEigenvalueParticleSimulationManager.cpp
+//! \author Alex Robinson
+//! \brief  The k-eigenvalue particle simulation manager unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+#include <memory>
+#include <cmath>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_ParticleSimulationManagerFactory.hpp"
+#include "MonteCarlo_KEigenvalueParticleSimulationManager.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+class TestKEigenvalueParticleSimulationManager : public MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>
+{
+public:
+
+  TestKEigenvalueParticleSimulationManager(
+      const std::shared_ptr<const MonteCarlo::FilledGeometryModel>& model,
+      const std::shared_ptr<MonteCarlo::ParticleSource>& source,
+      const std::shared_ptr<MonteCarlo::EventHandler>& event_handler,
+      const std::shared_ptr<const MonteCarlo::SimulationProperties>& properties )
+    : MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>(
+                                  "test_sim",
+                                  "xml",
+                                  model,
+                                  source,
+                                  event_handler,
+                                  MonteCarlo::PopulationControl::getDefault(),
+                                  MonteCarlo::CollisionForcer::getDefault(),
+                                  properties,
+                                  0,
+                                  0,
+                                  true,
+                                  Utility::Communicator::getDefault() )
+  { /* ... */ }
+
+  ~TestKEigenvalueParticleSimulationManager()
+  { /* ... */ }
+
+  using MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::registerParticleSubtrackEndingInCellEvent;
+  using MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::registerParticleCollisionEvent;
+  using MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::resetKEstimatorScores;
+  using MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE>::sumKEstimatorScores;
+};
+
+// An infinite medium model with a cell temperature
+class HotInfiniteMediumModel : public Geometry::InfiniteMediumModel
+{
+public:
+
+  HotInfiniteMediumModel( const Geometry::Model::EntityId cell,
+                          const Geometry::Model::MaterialId material_id,
+                          const Geometry::Model::Density density,
+                          const double temperature )
+    : Geometry::InfiniteMediumModel( cell, material_id, density ),
+      d_cell( cell ),
+      d_temperature( temperature )
+  { /* ... */ }
+
+  ~HotInfiniteMediumModel()
+  { /* ... */ }
+
+  void getCellTemperatures(
+           CellIdTemperatureMap& cell_id_temperature_map ) const override
+  {
+    cell_id_temperature_map[d_cell] = d_temperature;
+  }
+
+private:
+
+  Geometry::Model::EntityId d_cell;
+
+  double d_temperature;
+};
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const Geometry::Model> unfilled_model;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> particle_distribution;
+
+int threads;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create the simulation properties
+std::shared_ptr<MonteCarlo::SimulationProperties> createProperties()
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::NEUTRON_MODE );
+  properties->setNumberOfInactiveCycles( 5 );
+  properties->setNumberOfActiveCycles( 20 );
+  properties->setNumberOfHistoriesPerCycle( 1000 );
+  properties->setShannonEntropyMeshBinsPerDimension( 1 );
+
+  return properties;
+}
+
+// Create the source
+std::shared_ptr<MonteCarlo::ParticleSource> createSource()
+{
+  std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+    source_component( new MonteCarlo::StandardNeutronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+  return std::shared_ptr<MonteCarlo::ParticleSource>(
+                new MonteCarlo::StandardParticleSource( {source_component} ) );
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the collision, absorption and track-length estimators of k
+// can be scored
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, score_k_estimators )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createProperties();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestKEigenvalueParticleSimulationManager manager( model,
+                                                    createSource(),
+                                                    event_handler,
+                                                    properties );
+
+  FRENSIE_CHECK( manager.isTrackLengthKEstimatorOn() );
+
+  const MonteCarlo::FilledNeutronGeometryModel& neutron_model = *model;
+
+  const MonteCarlo::NeutronMaterial& material =
+    *neutron_model.getMaterial( 1 );
+
+  const double nu_fission_cross_section =
+    material.getMacroscopicFissionNeutronProductionCrossSection( 1.0 );
+
+  const double total_cross_section =
+    material.getMacroscopicTotalCrossSection( 1.0 );
+
+  const double absorption_cross_section =
+    material.getMacroscopicAbsorptionCrossSection( 1.0 ) +
+    material.getMacroscopicFissionCrossSection( 1.0 );
+
+  FRENSIE_REQUIRE( nu_fission_cross_section > 0.0 );
+
+  double source_weight, collision_score, absorption_score, track_length_score;
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_EQUAL( collision_score, 0.0 );
+  FRENSIE_CHECK_EQUAL( absorption_score, 0.0 );
+  FRENSIE_CHECK_EQUAL( track_length_score, 0.0 );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1.0 );
+  neutron.setWeight( 0.6 );
+  neutron.embedInModel( unfilled_model, 1 );
+
+  // A collision that removes part of the neutron weight
+  manager.registerParticleCollisionEvent( neutron, 1.0, 1.0 );
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( collision_score,
+                                   nu_fission_cross_section/
+                                   total_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( absorption_score,
+                                   0.4*nu_fission_cross_section/
+                                   absorption_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( track_length_score, 0.0 );
+
+  // A subtrack that ends in the cell
+  manager.registerParticleSubtrackEndingInCellEvent( neutron, 1, 2.0 );
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( track_length_score,
+                                   0.6*2.0*nu_fission_cross_section,
+                                   1e-12 );
+
+  // A collision that kills the neutron removes all of its weight
+  neutron.setAsGone();
+
+  manager.registerParticleCollisionEvent( neutron, 1.0, 0.5 );
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( collision_score,
+                                   1.5*nu_fission_cross_section/
+                                   total_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( absorption_score,
+                                   0.9*nu_fission_cross_section/
+                                   absorption_cross_section,
+                                   1e-12 );
+
+  // Other particle types are ignored
+  MonteCarlo::PhotonState photon( 0ull );
+  photon.setEnergy( 1.0 );
+  photon.embedInModel( unfilled_model, 1 );
+
+  manager.registerParticleCollisionEvent( photon, 1.0, 1.0 );
+  manager.registerParticleSubtrackEndingInCellEvent( photon, 1, 2.0 );
+
+  double photon_collision_score, photon_absorption_score,
+    photon_track_length_score;
+
+  manager.sumKEstimatorScores( source_weight,
+                               photon_collision_score,
+                               photon_absorption_score,
+                               photon_track_length_score );
+
+  FRENSIE_CHECK_EQUAL( photon_collision_score, collision_score );
+  FRENSIE_CHECK_EQUAL( photon_absorption_score, absorption_score );
+  FRENSIE_CHECK_EQUAL( photon_track_length_score, track_length_score );
+
+  manager.resetKEstimatorScores();
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_EQUAL( source_weight, 0.0 );
+  FRENSIE_CHECK_EQUAL( collision_score, 0.0 );
+  FRENSIE_CHECK_EQUAL( absorption_score, 0.0 );
+  FRENSIE_CHECK_EQUAL( track_length_score, 0.0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the collision and absorption estimators of k use the Doppler
+// broadened cross sections in cells that have a temperature
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager,
+                   score_k_estimators_hot_cell )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createProperties();
+
+  // 900 K
+  std::shared_ptr<const Geometry::Model> hot_unfilled_model(
+                 new HotInfiniteMediumModel( 1, 1, -19.1/cubic_centimeter,
+                                             7.755685e-8 ) );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        hot_unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestKEigenvalueParticleSimulationManager manager( model,
+                                                    createSource(),
+                                                    event_handler,
+                                                    properties );
+
+  const MonteCarlo::FilledNeutronGeometryModel& neutron_model = *model;
+
+  const MonteCarlo::NeutronMaterial& material =
+    *neutron_model.getMaterial( 1 );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 6.67e-6 );
+  neutron.setWeight( 0.6 );
+  neutron.embedInModel( hot_unfilled_model, 1 );
+
+  const std::shared_ptr<const MonteCarlo::DopplerBroadenedNeutronMaterial>&
+    broadened_material =
+    neutron_model.getBroadenedMaterialAtIndex( neutron.getCellIndex() );
+
+  FRENSIE_REQUIRE( broadened_material.get() != NULL );
+
+  // The first U238 resonance
+  const double energy = 6.67e-6;
+
+  const double nu_fission_cross_section =
+    material.getMacroscopicFissionNeutronProductionCrossSection( energy );
+
+  const double total_cross_section =
+    broadened_material->getMacroscopicTotalCrossSection( energy );
+
+  const double absorption_cross_section =
+    broadened_material->getMacroscopicAbsorptionCrossSection( energy ) +
+    material.getMacroscopicFissionCrossSection( energy );
+
+  FRENSIE_REQUIRE( nu_fission_cross_section > 0.0 );
+  FRENSIE_REQUIRE( total_cross_section !=
+                   material.getMacroscopicTotalCrossSection( energy ) );
+
+  // A collision that removes part of the neutron weight
+  manager.registerParticleCollisionEvent( neutron, energy, 1.0 );
+
+  double source_weight, collision_score, absorption_score, track_length_score;
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( collision_score,
+                                   nu_fission_cross_section/
+                                   total_cross_section,
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( absorption_score,
+                                   0.4*nu_fission_cross_section/
+                                   absorption_cross_section,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track-length estimator of k is turned off when delta
+// tracking is used
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager,
+                   score_k_estimators_delta_tracking )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createProperties();
+  properties->setTrackingMethod( MonteCarlo::DELTA_TRACKING );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestKEigenvalueParticleSimulationManager manager( model,
+                                                    createSource(),
+                                                    event_handler,
+                                                    properties );
+
+  FRENSIE_CHECK( !manager.isTrackLengthKEstimatorOn() );
+
+  MonteCarlo::NeutronState neutron( 0ull );
+  neutron.setEnergy( 1.0 );
+  neutron.setWeight( 0.6 );
+  neutron.embedInModel( unfilled_model, 1 );
+
+  manager.registerParticleSubtrackEndingInCellEvent( neutron, 1, 2.0 );
+  manager.registerParticleCollisionEvent( neutron, 1.0, 1.0 );
+
+  double source_weight, collision_score, absorption_score, track_length_score;
+
+  manager.sumKEstimatorScores( source_weight,
+                               collision_score,
+                               absorption_score,
+                               track_length_score );
+
+  FRENSIE_CHECK_GREATER( collision_score, 0.0 );
+  FRENSIE_CHECK_GREATER( absorption_score, 0.0 );
+  FRENSIE_CHECK_EQUAL( track_length_score, 0.0 );
+
+  // The track-length estimate is not reported
+  std::ostringstream oss;
+
+  manager.printSimulationSummary( oss );
+
+  FRENSIE_CHECK( oss.str().find( "collision" ) != std::string::npos );
+  FRENSIE_CHECK( oss.str().find( "track-length" ) == std::string::npos );
+  FRENSIE_CHECK( manager.getTrackLengthKEstimates().empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the active cycle statistics can be calculated
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager,
+                   calculateActiveCycleStatistics )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createProperties();
+  properties->setNumberOfInactiveCycles( 2 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  TestKEigenvalueParticleSimulationManager manager( model,
+                                                    createSource(),
+                                                    event_handler,
+                                                    properties );
+
+  double mean, std_dev_of_mean;
+
+  // Only inactive cycles
+  manager.calculateActiveCycleStatistics( {5.0, 6.0}, mean, std_dev_of_mean );
+
+  FRENSIE_CHECK_EQUAL( mean, 0.0 );
+  FRENSIE_CHECK_EQUAL( std_dev_of_mean, 0.0 );
+
+  // A single active cycle
+  manager.calculateActiveCycleStatistics( {5.0, 6.0, 1.0},
+                                          mean,
+                                          std_dev_of_mean );
+
+  FRENSIE_CHECK_EQUAL( mean, 1.0 );
+  FRENSIE_CHECK_EQUAL( std_dev_of_mean, 0.0 );
+
+  // The inactive cycles are ignored
+  manager.calculateActiveCycleStatistics( {5.0, 6.0, 1.0, 2.0, 3.0, 4.0},
+                                          mean,
+                                          std_dev_of_mean );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( mean, 2.5, 1e-15 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( std_dev_of_mean,
+                                   std::sqrt( 1.25/3.0 ),
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that k-inf of an infinite medium can be calculated
+/*! \details There is no analytic k-inf for a continuous energy material. In
+ * an infinite medium there is no leakage, so the generation, collision,
+ * absorption and track-length estimators all estimate
+ * k-inf = <nu*Sigma_f*phi>/<(Sigma_a+Sigma_f)*phi>, which must also be
+ * bounded by the largest value of nu*Sigma_f/(Sigma_a+Sigma_f).
+ */
+FRENSIE_UNIT_TEST( KEigenvalueParticleSimulationManager, runSimulation_k_inf )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties =
+    createProperties();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+  {
+    MonteCarlo::ParticleSimulationManagerFactory factory( model,
+                                                          createSource(),
+                                                          event_handler,
+                                                          properties,
+                                                          "test_sim",
+                                                          "xml",
+                                                          threads );
+
+    manager = factory.getManager();
+  }
+
+  std::shared_ptr<MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >
+    k_manager = std::dynamic_pointer_cast<MonteCarlo::KEigenvalueParticleSimulationManager<MonteCarlo::NEUTRON_MODE> >( manager );
+
+  FRENSIE_REQUIRE( k_manager.get() != NULL );
+
+  FRENSIE_REQUIRE_NO_THROW( k_manager->runSimulation() );
+
+  FRENSIE_CHECK_EQUAL( k_manager->getNumberOfCompletedCycles(), 25 );
+  FRENSIE_CHECK_EQUAL( k_manager->getNextHistory(), 25000 );
+
+  // All sites are in a single mesh bin
+  FRENSIE_REQUIRE_EQUAL( k_manager->getShannonEntropies().size(), 25 );
+
+  for( size_t i = 0; i < k_manager->getShannonEntropies().size(); ++i )
+  {
+    FRENSIE_CHECK_SMALL( k_manager->getShannonEntropies()[i], 1e-12 );
+  }
+
+  // Calculate the upper bound of k-inf
+  const MonteCarlo::FilledNeutronGeometryModel& neutron_model = *model;
+
+  const MonteCarlo::NeutronMaterial& material =
+    *neutron_model.getMaterial( 1 );
+
+  double max_k_inf = 0.0;
+
+  for( size_t i = 0; i <= 2000; ++i )
+  {
+    const double energy = 1e-11*std::pow( 20.0/1e-11, i/2000.0 );
+
+    const double absorption_cross_section =
+      material.getMacroscopicAbsorptionCrossSection( energy ) +
+      material.getMacroscopicFissionCrossSection( energy );
+
+    if( absorption_cross_section > 0.0 )
+    {
+      max_k_inf = std::max( max_k_inf,
+        material.getMacroscopicFissionNeutronProductionCrossSection( energy )/
+        absorption_cross_section );
+    }
+  }
+
+  double generation_k, generation_k_std_dev;
+  double collision_k, collision_k_std_dev;
+  double absorption_k, absorption_k_std_dev;
+  double track_length_k, track_length_k_std_dev;
+
+  k_manager->calculateActiveCycleStatistics(
+                                     k_manager->getGenerationKEstimates(),
+                                     generation_k,
+                                     generation_k_std_dev );
+  k_manager->calculateActiveCycleStatistics(
+                                     k_manager->getCollisionKEstimates(),
+                                     collision_k,
+                                     collision_k_std_dev );
+  k_manager->calculateActiveCycleStatistics(
+                                     k_manager->getAbsorptionKEstimates(),
+                                     absorption_k,
+                                     absorption_k_std_dev );
+  k_manager->calculateActiveCycleStatistics(
+                                     k_manager->getTrackLengthKEstimates(),
+                                     track_length_k,
+                                     track_length_k_std_dev );
+
+  FRENSIE_CHECK_GREATER( generation_k, 0.0 );
+  FRENSIE_CHECK_LESS( generation_k, max_k_inf );
+  FRENSIE_CHECK_GREATER( generation_k_std_dev, 0.0 );
+  FRENSIE_CHECK_LESS( generation_k_std_dev, 0.05*generation_k );
+
+  // The estimators must agree within five combined standard deviations
+  FRENSIE_CHECK_LESS( std::fabs( collision_k - generation_k ),
+                      5.0*std::sqrt( collision_k_std_dev*collision_k_std_dev +
+                                     generation_k_std_dev*generation_k_std_dev ) );
+  FRENSIE_CHECK_LESS( std::fabs( absorption_k - generation_k ),
+                      5.0*std::sqrt( absorption_k_std_dev*absorption_k_std_dev +
+                                     generation_k_std_dev*generation_k_std_dev ) );
+  FRENSIE_CHECK_LESS( std::fabs( track_length_k - generation_k ),
+                      5.0*std::sqrt( track_length_k_std_dev*track_length_k_std_dev +
+                                     generation_k_std_dev*generation_k_std_dev ) );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::NuclideProperties& u238_properties =
+      database.getNuclideProperties( 92238 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& u238_definition =
+      scattering_center_definition_database->createDefinition( "U238 @ 293.6K", 92238 );
+
+    u238_definition.setNuclearDataProperties(
+          u238_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    material_definition_database->addDefinition( "U238 @ 293.6K", 1,
+                                                 {"U238 @ 293.6K"}, {1.0} );
+  }
+
+  // A single cell infinite medium
+  unfilled_model.reset(
+            new Geometry::InfiniteMediumModel( 1, 1, -19.1/cubic_centimeter ) );
+
+  {
+    std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+      tmp_particle_distribution( new MonteCarlo::StandardParticleDistribution( "test dist" ) );
+
+    particle_distribution = tmp_particle_distribution;
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstKEigenvalueParticleSimulationManager.cpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #include <memory>
 #include <csignal>
 #include <functional>
+#include <cmath>
 
 // Boost Includes
 #include <boost/filesystem.hpp>
@@ -21,6 +22,9 @@
 #include "MonteCarlo_StandardParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardAdjointParticleSourceComponent.hpp"
 #include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_CellCollisionFluxEstimator.hpp"
+#include "MonteCarlo_CellTrackLengthFluxEstimator.hpp"
+#include "MonteCarlo_StandardCollisionForcer.hpp"
 #include "Data_ScatteringCenterPropertiesDatabase.hpp"
 #include "Geometry_InfiniteMediumModel.hpp"
 #include "Utility_UnitTestHarnessWithMain.hpp"
@@ -924,6 +928,325 @@ FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_wall )
   FRENSIE_CHECK_EQUAL( manager->getNumberOfRendezvous(), 2 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the delta tracking majorant bounds the model cross sections
+FRENSIE_UNIT_TEST( ParticleSimulationManager, delta_tracking_majorant )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setTrackingMethod( MonteCarlo::DELTA_TRACKING );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  FRENSIE_REQUIRE( model->hasMacroscopicMajorantCrossSection<MonteCarlo::PhotonState>() );
+
+  const double min_energy = properties->getMinPhotonEnergy();
+  const double max_energy = properties->getMaxPhotonEnergy();
+
+  for( size_t i = 0; i <= 100000; ++i )
+  {
+    const double energy =
+      std::min( min_energy*std::pow( max_energy/min_energy, i/100000.0 ),
+                max_energy );
+
+    const double total_cross_section =
+      model->getMacroscopicTotalForwardCrossSection<MonteCarlo::PhotonState>( 1, energy );
+
+    const double majorant_cross_section =
+      model->getMacroscopicMajorantCrossSection<MonteCarlo::PhotonState>( energy );
+
+    FRENSIE_CHECK( majorant_cross_section >= total_cross_section*(1.0-1e-12) );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that delta tracking reproduces the surface tracking results
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_delta_tracking )
+{
+  // Run a simulation and return the collision flux estimator mean and the
+  // variance of the mean
+  std::function<std::pair<double,double>(const MonteCarlo::TrackingMethodType)>
+    run_simulation = []( const MonteCarlo::TrackingMethodType tracking_method ){
+    const uint64_t number_of_histories = 2000;
+
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setNumberOfHistories( number_of_histories );
+    properties->setTrackingMethod( tracking_method );
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::shared_ptr<MonteCarlo::WeightMultipliedCellCollisionFluxEstimator>
+      estimator( new MonteCarlo::WeightMultipliedCellCollisionFluxEstimator(
+                                                      0, 1.0, {1}, {1.0} ) );
+    estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+    event_handler->addEstimator( estimator );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+    factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+
+    manager->runSimulation();
+
+    const double first_moment =
+      estimator->getTotalBinDataFirstMoments().front();
+    const double second_moment =
+      estimator->getTotalBinDataSecondMoments().front();
+
+    const double mean = first_moment/number_of_histories;
+
+    return std::make_pair( mean,
+                           (second_moment/number_of_histories - mean*mean)/
+                           (number_of_histories - 1) );
+  };
+
+  std::pair<double,double> surface_tracking_result =
+    run_simulation( MonteCarlo::STANDARD_TRACKING );
+
+  std::pair<double,double> delta_tracking_result =
+    run_simulation( MonteCarlo::DELTA_TRACKING );
+
+  FRENSIE_CHECK( surface_tracking_result.first > 0.0 );
+  FRENSIE_CHECK( delta_tracking_result.first > 0.0 );
+
+  // The results must agree to within four standard deviations
+  FRENSIE_CHECK_SMALL( delta_tracking_result.first -
+                       surface_tracking_result.first,
+                       4.0*std::sqrt( surface_tracking_result.second +
+                                      delta_tracking_result.second ) );
+}
+
+//---------------------------------------------------------------------------//
+// Check that delta tracking cannot be used with cell track-length estimators
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   delta_tracking_cell_track_length_estimator )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( 5 );
+  properties->setTrackingMethod( MonteCarlo::DELTA_TRACKING );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator>
+    estimator( new MonteCarlo::WeightMultipliedCellTrackLengthFluxEstimator(
+                                                      0, 1.0, {1}, {1.0} ) );
+  estimator->setParticleTypes( std::set<MonteCarlo::ParticleType>( {MonteCarlo::PHOTON} ) );
+
+  event_handler->addEstimator( estimator );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+  FRENSIE_CHECK_THROW( factory->getManager(), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that forced collisions cannot be used with condensed history electrons
+FRENSIE_UNIT_TEST( ParticleSimulationManager,
+                   condensed_history_forced_collisions )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::ELECTRON_MODE );
+  properties->setNumberOfHistories( 5 );
+  properties->setCondensedHistoryModeOn();
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardElectronSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+  std::shared_ptr<MonteCarlo::StandardCollisionForcer>
+    collision_forcer( new MonteCarlo::StandardCollisionForcer );
+
+  std::vector<MonteCarlo::StandardCollisionForcer::CellIdType> cells( {1} );
+
+  collision_forcer->setForcedCollisionCells( *model,
+                                             MonteCarlo::ELECTRON,
+                                             cells );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+  factory->setCollisionForcer( collision_forcer );
+
+  FRENSIE_CHECK_THROW( factory->getManager(), std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a simulation can be run with each history schedule
+FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_history_schedule )
+{
+  std::vector<MonteCarlo::HistoryScheduleType> schedules(
+                                    {MonteCarlo::STATIC_HISTORY_SCHEDULE,
+                                     MonteCarlo::DYNAMIC_HISTORY_SCHEDULE,
+                                     MonteCarlo::GUIDED_HISTORY_SCHEDULE,
+                                     MonteCarlo::QUEUE_HISTORY_SCHEDULE} );
+
+  for( size_t i = 0; i < schedules.size(); ++i )
+  {
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager;
+
+    {
+      std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+      properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+      properties->setNumberOfHistories( 10 );
+      properties->setHistorySchedule( schedules[i] );
+      properties->setHistoryScheduleChunkSize( 3 );
+
+      std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+      std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+      {
+        std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+          source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+        source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+      }
+
+      std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+      std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+      factory.reset(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_sim",
+                                                              "xml",
+                                                              threads ) );
+
+      manager = factory->getManager();
+    }
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    FRENSIE_CHECK_EQUAL( manager->getNextHistory(), 10 );
+    FRENSIE_CHECK_EQUAL( manager->getEventHandler().getNumberOfCommittedHistories(), 10 );
+    FRENSIE_CHECK_EQUAL( manager->getThreadBusyTimes().size(), (size_t)threads );
+    FRENSIE_CHECK_EQUAL( manager->getThreadIdleTimes().size(), (size_t)threads );
+  }
+}
+
 //---------------------------------------------------------------------------//
 // Check that a simulation can be run
 FRENSIE_UNIT_TEST( ParticleSimulationManager, runSimulation_wall_time )
@@ -1264,6 +1587,110 @@ FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager, restart_basic )
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// Check that a particle simulation can be restarted from an incremental
+// rendezvous archive that was written asynchronously
+FRENSIE_DATA_UNIT_TEST_DECL( ParticleSimulationManager,
+                             restart_asynchronous_rendezvous )
+{
+  FETCH_FROM_TABLE( std::string, archive_type );
+  FETCH_FROM_TABLE( uint32_t, source_id );
+
+  uint64_t next_history;
+  uint64_t rendezvous_number;
+
+  {
+    std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+    properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+    properties->setSimulationWallTime( 0.25 );
+    properties->setMaxRendezvousBatchSize( 10 );
+    properties->setAsynchronousRendezvousModeOn();
+
+    std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+    {
+      std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+        source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     source_id,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+      source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+    }
+
+    std::shared_ptr<MonteCarlo::EventHandler> event_handler(
+                                 new MonteCarlo::EventHandler( *properties ) );
+
+    std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory(
+            new MonteCarlo::ParticleSimulationManagerFactory( model,
+                                                              source,
+                                                              event_handler,
+                                                              properties,
+                                                              "test_async_sim",
+                                                              archive_type,
+                                                              threads ) );
+
+    std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+      factory->getManager();
+    manager->useMultipleRendezvousFiles();
+
+    FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+    next_history = manager->getNextHistory();
+    rendezvous_number = manager->getNumberOfRendezvous();
+  }
+
+  // The model is only stored in the static data archive
+  FRENSIE_REQUIRE( boost::filesystem::exists( "test_async_sim_static_data." + archive_type ) );
+  FRENSIE_REQUIRE( boost::filesystem::exists( "test_async_sim_rendezvous_0." + archive_type ) );
+  FRENSIE_REQUIRE( rendezvous_number > 1 );
+
+  std::string archive_name( "test_async_sim_rendezvous_" );
+  archive_name += Utility::toString( rendezvous_number - 1 );
+  archive_name += ".";
+  archive_name += archive_type;
+
+  // The temporary archive must have been renamed
+  FRENSIE_CHECK( !boost::filesystem::exists( "test_async_sim_rendezvous_" + Utility::toString( rendezvous_number - 1 ) + ".tmp." + archive_type ) );
+
+  std::unique_ptr<MonteCarlo::ParticleSimulationManagerFactory> factory;
+
+  FRENSIE_REQUIRE_NO_THROW( factory.reset( new MonteCarlo::ParticleSimulationManagerFactory( archive_name, (unsigned)threads ) ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSimulationManager> manager =
+    factory->getManager();
+
+  FRENSIE_CHECK_NO_THROW( manager->getModel() );
+
+  FRENSIE_REQUIRE_NO_THROW( manager->runSimulation() );
+
+  FRENSIE_CHECK( manager->getNextHistory() > next_history );
+  FRENSIE_CHECK( manager->getNumberOfRendezvous() > rendezvous_number );
+}
+
+FRENSIE_DATA_UNIT_TEST_INST( ParticleSimulationManager,
+                             restart_asynchronous_rendezvous )
+{
+  COLUMNS()         << "archive_type" << "source_id" ;
+  NEW_ROW( "xml" )  <<    "xml"       <<    0;
+  NEW_ROW( "txt" )  <<    "txt"       <<    1;
+  NEW_ROW( "bin" )  <<    "bin"       <<    2;
+#ifdef HAVE_FRENSIE_HDF5
+  NEW_ROW( "h5fa" ) <<    "h5fa"      <<    3;
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // Check that a particle simulation manager can be restarted
 FRENSIE_DATA_UNIT_TEST_DECL( ParticleSimulationManager, restart_add_histories )
@@ -0,0 +1,229 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstWeightWindowMeshIterationManager.cpp
+//! \author Philip Britt
+//! \brief  The weight window mesh iteration manager unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+
+// Boost Includes
+#include <boost/filesystem.hpp>
+
+// FRENSIE Includes
+#include "MonteCarlo_WeightWindowMeshIterationManager.hpp"
+#include "MonteCarlo_StandardParticleSource.hpp"
+#include "MonteCarlo_StandardParticleSourceComponent.hpp"
+#include "MonteCarlo_StandardParticleDistribution.hpp"
+#include "MonteCarlo_PhotonState.hpp"
+#include "Data_ScatteringCenterPropertiesDatabase.hpp"
+#include "Geometry_InfiniteMediumModel.hpp"
+#include "Utility_StructuredHexMesh.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+using boost::units::cgs::cubic_centimeter;
+using Utility::Units::MeV;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+std::string test_scattering_center_database_name;
+
+std::shared_ptr<MonteCarlo::ScatteringCenterDefinitionDatabase>
+scattering_center_definition_database;
+
+std::shared_ptr<MonteCarlo::MaterialDefinitionDatabase>
+material_definition_database;
+
+std::shared_ptr<const Geometry::Model> unfilled_model;
+
+std::shared_ptr<const MonteCarlo::ParticleDistribution> particle_distribution;
+
+int threads;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that weight windows can be generated iteratively
+FRENSIE_UNIT_TEST( WeightWindowMeshIterationManager, runIterations )
+{
+  std::shared_ptr<MonteCarlo::SimulationProperties> properties(
+                                        new MonteCarlo::SimulationProperties );
+  properties->setParticleMode( MonteCarlo::PHOTON_MODE );
+  properties->setNumberOfHistories( 1000 );
+
+  std::shared_ptr<const MonteCarlo::FilledGeometryModel> model(
+                               new MonteCarlo::FilledGeometryModel(
+                                        test_scattering_center_database_name,
+                                        scattering_center_definition_database,
+                                        material_definition_database,
+                                        properties,
+                                        unfilled_model,
+                                        false ) );
+
+  std::shared_ptr<MonteCarlo::ParticleSource> source;
+
+  {
+    std::shared_ptr<MonteCarlo::ParticleSourceComponent>
+      source_component( new MonteCarlo::StandardPhotonSourceComponent(
+                                                     0,
+                                                     1.0,
+                                                     unfilled_model,
+                                                     particle_distribution ) );
+
+    source.reset( new MonteCarlo::StandardParticleSource( {source_component} ) );
+  }
+
+  // The source is at the center of the middle mesh element
+  std::shared_ptr<const Utility::Mesh> mesh =
+    std::make_shared<Utility::StructuredHexMesh>(
+                                std::vector<double>( {-1.5, -0.5, 0.5, 1.5} ),
+                                std::vector<double>( {-1.5, -0.5, 0.5, 1.5} ),
+                                std::vector<double>( {-1.5, -0.5, 0.5, 1.5} ) );
+
+  std::shared_ptr<MonteCarlo::WeightWindowMeshGenerator> generator =
+    std::make_shared<MonteCarlo::WeightWindowMeshGenerator>(
+                                      mesh, std::vector<double>( {0.0, 20.0} ) );
+
+  MonteCarlo::WeightWindowMeshIterationManager
+    iteration_manager( model,
+                       source,
+                       properties,
+                       generator,
+                       MonteCarlo::PHOTON,
+                       "test_ww_iteration",
+                       "xml",
+                       threads );
+
+  FRENSIE_CHECK_EQUAL( iteration_manager.getNumberOfCompletedIterations(), 0 );
+  FRENSIE_CHECK_EQUAL( iteration_manager.getGenerator(), generator );
+  FRENSIE_CHECK( generator->getWeightWindowMap().empty() );
+  FRENSIE_CHECK_EQUAL( iteration_manager.getWeightWindowMesh()->getMesh(),
+                       mesh );
+
+  FRENSIE_REQUIRE_NO_THROW( iteration_manager.runIterations( 1 ) );
+
+  FRENSIE_CHECK_EQUAL( iteration_manager.getNumberOfCompletedIterations(), 1 );
+  FRENSIE_CHECK( !generator->getWeightWindowMap().empty() );
+
+  // The second iteration uses the windows from the first iteration
+  FRENSIE_REQUIRE_NO_THROW( iteration_manager.runIterations( 1 ) );
+
+  FRENSIE_CHECK_EQUAL( iteration_manager.getNumberOfCompletedIterations(), 2 );
+
+  // The source element has the maximum flux
+  MonteCarlo::PhotonState photon( 0 );
+  photon.setEnergy( 1.0 );
+  photon.setPosition( 0.0, 0.0, 0.0 );
+
+  const MonteCarlo::WeightWindow& source_element_window =
+    iteration_manager.getWeightWindowMesh()->getWeightWindow( photon );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( source_element_window.lower_weight,
+                                   generator->getReferenceLowerWeight(),
+                                   1e-12 );
+
+  // The other elements have a lower flux
+  photon.setPosition( 1.0, 1.0, 1.0 );
+
+  const MonteCarlo::WeightWindow& corner_element_window =
+    iteration_manager.getWeightWindowMesh()->getWeightWindow( photon );
+
+  FRENSIE_CHECK_GREATER( corner_element_window.lower_weight, 0.0 );
+  FRENSIE_CHECK_LESS( corner_element_window.lower_weight,
+                      generator->getReferenceLowerWeight() );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_COMMAND_LINE_OPTIONS()
+{
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "test_database",
+                                        test_scattering_center_database_name, "",
+                                        "Test scattering center database name "
+                                        "with path" );
+  ADD_STANDARD_OPTION_AND_ASSIGN_VALUE( "threads",
+                                        threads, 1,
+                                        "Number of threads to use" );
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  {
+    // Determine the database directory
+    boost::filesystem::path database_path =
+      test_scattering_center_database_name;
+
+    // Load the database
+    const Data::ScatteringCenterPropertiesDatabase database( database_path );
+
+    const Data::AtomProperties& h_properties =
+      database.getAtomProperties( 1001 );
+
+    const Data::NuclideProperties& h1_properties =
+      database.getNuclideProperties( 1001 );
+
+    // Set the sattering center definitions
+    scattering_center_definition_database.reset(
+                          new MonteCarlo::ScatteringCenterDefinitionDatabase );
+
+    MonteCarlo::ScatteringCenterDefinition& h_definition =
+      scattering_center_definition_database->createDefinition( "H1 @ 293.6K", 1001 );
+
+    h_definition.setPhotoatomicDataProperties(
+          h_properties.getSharedPhotoatomicDataProperties(
+                       Data::PhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointPhotoatomicDataProperties(
+          h_properties.getSharedAdjointPhotoatomicDataProperties(
+                Data::AdjointPhotoatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setElectroatomicDataProperties(
+          h_properties.getSharedElectroatomicDataProperties(
+                     Data::ElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setAdjointElectroatomicDataProperties(
+          h_properties.getSharedAdjointElectroatomicDataProperties(
+              Data::AdjointElectroatomicDataProperties::Native_EPR_FILE, 0 ) );
+
+    h_definition.setNuclearDataProperties(
+          h1_properties.getSharedNuclearDataProperties(
+                                         Data::NuclearDataProperties::ACE_FILE,
+                                         7,
+                                         2.53010E-08*MeV,
+                                         true ) );
+
+    material_definition_database.reset(
+                                  new MonteCarlo::MaterialDefinitionDatabase );
+
+    material_definition_database->addDefinition( "H1 @ 293.6K", 1,
+                                                 {"H1 @ 293.6K"}, {1.0} );
+  }
+
+  unfilled_model.reset(
+            new Geometry::InfiniteMediumModel( 1, 1, -1.0/cubic_centimeter ) );
+
+  {
+    std::shared_ptr<MonteCarlo::StandardParticleDistribution>
+      tmp_particle_distribution( new MonteCarlo::StandardParticleDistribution( "test dist" ) );
+
+    particle_distribution = tmp_particle_distribution;
+  }
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstWeightWindowMeshIterationManager.cpp
+//---------------------------------------------------------------------------//
@@ -19,6 +19,9 @@
 #include "Utility_HDF5IArchive.hpp"
 #endif // end HAVE_FRENSIE_HDF5
 
+#include "Utility_FlatOArchive.hpp"
+#include "Utility_FlatIArchive.hpp"
+
 // Boost Includes
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/archive/text_iarchive.hpp>
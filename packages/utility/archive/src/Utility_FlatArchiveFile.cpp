@@ -0,0 +1,265 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatArchiveFile.cpp
+//! \author Alex Robinson
+//! \brief  Flat (memory mapped) archive file class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatArchiveFile.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Initialize static member data
+const char FlatArchiveFile::s_identifier[8] =
+  {'F', 'R', 'N', 'S', 'F', 'L', 'A', 'T'};
+
+const uint32_t FlatArchiveFile::s_format_version = 1;
+
+const uint32_t FlatArchiveFile::s_byte_order_check = 0x01020304;
+
+const uint64_t FlatArchiveFile::s_data_alignment = 64;
+
+// Constructor
+FlatArchiveFile::FlatArchiveFile(
+                         const boost::filesystem::path& file_name_with_path )
+  : d_file_name( file_name_with_path ),
+    d_mapped_file(),
+    d_header( NULL ),
+    d_index( NULL ),
+    d_names( NULL )
+{
+  TEST_FOR_EXCEPTION( !boost::filesystem::exists( file_name_with_path ),
+                      std::runtime_error,
+                      "Cannot open the flat archive file "
+                      << file_name_with_path.string() <<
+                      " because the file does not exist!" );
+
+  try{
+    boost::interprocess::file_mapping
+      file( file_name_with_path.string().c_str(),
+            boost::interprocess::read_only );
+
+    d_mapped_file.reset( new boost::interprocess::mapped_region(
+                                           file,
+                                           boost::interprocess::read_only ) );
+  }
+  catch( const std::exception& exception )
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot map the flat archive file "
+                     << file_name_with_path.string() << ": "
+                     << exception.what() );
+  }
+
+  TEST_FOR_EXCEPTION( d_mapped_file->get_size() <
+                      sizeof(Details::FlatArchiveFileHeader),
+                      std::runtime_error,
+                      "File " << file_name_with_path.string() << " is not a "
+                      "flat archive file (the file is too small)!" );
+
+  d_header = static_cast<const Details::FlatArchiveFileHeader*>(
+                                              d_mapped_file->get_address() );
+
+  this->validateFile();
+
+  const char* file_start =
+    static_cast<const char*>( d_mapped_file->get_address() );
+
+  d_index = reinterpret_cast<const Details::FlatArchiveIndexEntry*>(
+                                            file_start + d_header->index_offset );
+
+  d_names = file_start + d_header->names_offset;
+}
+
+// Check if a file is a flat archive file
+bool FlatArchiveFile::isFlatArchiveFile(
+                         const boost::filesystem::path& file_name_with_path )
+{
+  std::ifstream file( file_name_with_path.string(), std::ifstream::binary );
+
+  char identifier[sizeof(s_identifier)];
+
+  if( !file.read( identifier, sizeof(identifier) ) )
+    return false;
+
+  return std::memcmp( identifier, s_identifier, sizeof(s_identifier) ) == 0;
+}
+
+// Validate the file header and index
+void FlatArchiveFile::validateFile() const
+{
+  const size_t file_size = d_mapped_file->get_size();
+
+  TEST_FOR_EXCEPTION( std::memcmp( d_header->identifier,
+                                   s_identifier,
+                                   sizeof(s_identifier) ) != 0,
+                      std::runtime_error,
+                      "File " << d_file_name.string() << " is not a flat "
+                      "archive file!" );
+
+  TEST_FOR_EXCEPTION( d_header->byte_order_check != s_byte_order_check,
+                      std::runtime_error,
+                      "Flat archive file " << d_file_name.string() <<
+                      " was written on a machine with a different byte "
+                      "order!" );
+
+  TEST_FOR_EXCEPTION( d_header->format_version != s_format_version,
+                      std::runtime_error,
+                      "Flat archive file " << d_file_name.string() <<
+                      " has an unsupported format version ("
+                      << d_header->format_version << ")!" );
+
+  TEST_FOR_EXCEPTION( d_header->file_size != file_size,
+                      std::runtime_error,
+                      "Flat archive file " << d_file_name.string() <<
+                      " is truncated (expected " << d_header->file_size <<
+                      " bytes but found " << file_size << " bytes)!" );
+
+  TEST_FOR_EXCEPTION( d_header->index_offset % sizeof(uint64_t) != 0 ||
+                      d_header->index_offset +
+                      d_header->number_of_entries*
+                      sizeof(Details::FlatArchiveIndexEntry) >
+                      d_header->names_offset ||
+                      d_header->names_offset > file_size,
+                      std::runtime_error,
+                      "Flat archive file " << d_file_name.string() <<
+                      " has a corrupt index!" );
+}
+
+// Return the file name
+const boost::filesystem::path& FlatArchiveFile::getFileName() const
+{
+  return d_file_name;
+}
+
+// Return the number of entries
+size_t FlatArchiveFile::getNumberOfEntries() const
+{
+  return d_header->number_of_entries;
+}
+
+// Return the name of an entry
+/*! \details The entries are sorted by name.
+ */
+std::string FlatArchiveFile::getEntryName( const size_t entry_index ) const
+{
+  // Make sure the entry index is valid
+  testPrecondition( entry_index < this->getNumberOfEntries() );
+
+  return std::string( d_names + d_index[entry_index].name_offset,
+                      d_index[entry_index].name_size );
+}
+
+// Check if an entry exists
+bool FlatArchiveFile::doesEntryExist( const std::string& entry_name ) const
+{
+  return this->findEntry( entry_name ) != NULL;
+}
+
+// Return the number of elements in an entry
+size_t FlatArchiveFile::getEntrySize( const std::string& entry_name ) const
+{
+  return this->getEntryIndexData( entry_name ).number_of_elements;
+}
+
+// Return the entry data as a string
+std::string FlatArchiveFile::getEntryString(
+                                         const std::string& entry_name ) const
+{
+  Utility::ArrayView<const char> entry_data =
+    this->getEntry<char>( entry_name );
+
+  return std::string( entry_data.begin(), entry_data.end() );
+}
+
+// Find an entry (NULL if the entry does not exist)
+/*! \details The index is sorted by name so a binary search is used. Only the
+ * index pages that are visited by the search will be read.
+ */
+const Details::FlatArchiveIndexEntry* FlatArchiveFile::findEntry(
+                                        const std::string& entry_name ) const
+{
+  size_t lower_index = 0;
+  size_t upper_index = d_header->number_of_entries;
+
+  while( lower_index < upper_index )
+  {
+    const size_t mid_index = lower_index + (upper_index - lower_index)/2;
+
+    const Details::FlatArchiveIndexEntry& entry = d_index[mid_index];
+
+    const int comparison =
+      entry_name.compare( 0, std::string::npos,
+                          d_names + entry.name_offset,
+                          entry.name_size );
+
+    if( comparison == 0 )
+      return &entry;
+    else if( comparison < 0 )
+      upper_index = mid_index;
+    else
+      lower_index = mid_index + 1;
+  }
+
+  return NULL;
+}
+
+// Return an entry (an exception will be thrown if it does not exist)
+const Details::FlatArchiveIndexEntry& FlatArchiveFile::getEntryIndexData(
+                                        const std::string& entry_name ) const
+{
+  const Details::FlatArchiveIndexEntry* entry = this->findEntry( entry_name );
+
+  TEST_FOR_EXCEPTION( entry == NULL,
+                      std::runtime_error,
+                      "Entry " << entry_name << " does not exist in flat "
+                      "archive file " << d_file_name.string() << "!" );
+
+  return *entry;
+}
+
+// Return the entry data address
+const void* FlatArchiveFile::getEntryData(
+                                 const Details::FlatArchiveIndexEntry& entry,
+                                 const uint32_t element_type,
+                                 const uint32_t element_size ) const
+{
+  TEST_FOR_EXCEPTION( entry.element_type != element_type ||
+                      entry.element_size != element_size,
+                      std::runtime_error,
+                      "Entry " << std::string( d_names + entry.name_offset,
+                                               entry.name_size ) <<
+                      " of flat archive file " << d_file_name.string() <<
+                      " does not store the requested element type!" );
+
+  TEST_FOR_EXCEPTION( entry.data_offset % s_data_alignment != 0 ||
+                      entry.data_offset +
+                      entry.number_of_elements*entry.element_size >
+                      d_header->index_offset,
+                      std::runtime_error,
+                      "Entry " << std::string( d_names + entry.name_offset,
+                                               entry.name_size ) <<
+                      " of flat archive file " << d_file_name.string() <<
+                      " is corrupt!" );
+
+  return static_cast<const char*>( d_mapped_file->get_address() ) +
+    entry.data_offset;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatArchiveFile.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,200 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatArchiveFile.hpp
+//! \author Alex Robinson
+//! \brief  Flat (memory mapped) archive file class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_ARCHIVE_FILE_HPP
+#define UTILITY_FLAT_ARCHIVE_FILE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <memory>
+#include <cstdint>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+//! The flat archive file header
+struct FlatArchiveFileHeader
+{
+  // The file identifier
+  char identifier[8];
+
+  // The file format version
+  uint32_t format_version;
+
+  // The byte order check value
+  uint32_t byte_order_check;
+
+  // The number of entries
+  uint64_t number_of_entries;
+
+  // The offset of the index (bytes)
+  uint64_t index_offset;
+
+  // The offset of the entry names (bytes)
+  uint64_t names_offset;
+
+  // The size of the file (bytes)
+  uint64_t file_size;
+};
+
+//! The flat archive file index entry
+struct FlatArchiveIndexEntry
+{
+  // The offset of the entry name (relative to the names offset)
+  uint64_t name_offset;
+
+  // The size of the entry name
+  uint64_t name_size;
+
+  // The offset of the entry data (bytes)
+  uint64_t data_offset;
+
+  // The number of elements in the entry
+  uint64_t number_of_elements;
+
+  // The entry element type
+  uint32_t element_type;
+
+  // The entry element size (bytes)
+  uint32_t element_size;
+};
+
+//! The flat archive element type traits
+template<typename T, typename Enabled = void>
+struct FlatArchiveElementTypeTraits;
+
+//! Check if a type can be stored as an array element in a flat archive
+template<typename T>
+struct IsFlatArchiveArrayElement;
+
+} // end Details namespace
+
+/*! The flat archive file
+ * \details A flat archive file stores named one dimensional arrays of
+ * arithmetic values (or characters) in a single binary file. The file
+ * starts with a small header, followed by the data of every entry (aligned
+ * to a 64 byte boundary), an index of the entries sorted by name and
+ * finally the entry names. Opening a file only maps it into memory - the
+ * arrays are returned as views of the mapped pages so only the pages that
+ * are accessed are ever read from disk. The file format is native endian.
+ * Files are written with the Utility::FlatOArchive and can be loaded into an
+ * object with the Utility::FlatIArchive.
+ * \ingroup archive
+ */
+class FlatArchiveFile
+{
+
+public:
+
+  //! Constructor
+  FlatArchiveFile( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~FlatArchiveFile()
+  { /* ... */ }
+
+  //! Check if a file is a flat archive file
+  static bool isFlatArchiveFile(
+                        const boost::filesystem::path& file_name_with_path );
+
+  //! Return the file name
+  const boost::filesystem::path& getFileName() const;
+
+  //! Return the number of entries
+  size_t getNumberOfEntries() const;
+
+  //! Return the name of an entry
+  std::string getEntryName( const size_t entry_index ) const;
+
+  //! Check if an entry exists
+  bool doesEntryExist( const std::string& entry_name ) const;
+
+  //! Return the number of elements in an entry
+  size_t getEntrySize( const std::string& entry_name ) const;
+
+  //! Return a view of the entry data (no data is copied)
+  template<typename T>
+  Utility::ArrayView<const T> getEntry( const std::string& entry_name ) const;
+
+  //! Return the value of a single value entry
+  template<typename T>
+  T getEntryValue( const std::string& entry_name ) const;
+
+  //! Return the entry data as a string
+  std::string getEntryString( const std::string& entry_name ) const;
+
+  //! The file identifier
+  static const char s_identifier[8];
+
+  //! The file format version
+  static const uint32_t s_format_version;
+
+  //! The byte order check value
+  static const uint32_t s_byte_order_check;
+
+  //! The entry data alignment (bytes)
+  static const uint64_t s_data_alignment;
+
+private:
+
+  // Validate the file header and index
+  void validateFile() const;
+
+  // Find an entry (NULL if the entry does not exist)
+  const Details::FlatArchiveIndexEntry* findEntry(
+                                      const std::string& entry_name ) const;
+
+  // Return an entry (an exception will be thrown if it does not exist)
+  const Details::FlatArchiveIndexEntry& getEntryIndexData(
+                                      const std::string& entry_name ) const;
+
+  // Return the entry data address
+  const void* getEntryData(
+                       const Details::FlatArchiveIndexEntry& entry,
+                       const uint32_t element_type,
+                       const uint32_t element_size ) const;
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The mapped file
+  std::unique_ptr<boost::interprocess::mapped_region> d_mapped_file;
+
+  // The file header
+  const Details::FlatArchiveFileHeader* d_header;
+
+  // The file index
+  const Details::FlatArchiveIndexEntry* d_index;
+
+  // The entry names
+  const char* d_names;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_FlatArchiveFile_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_FLAT_ARCHIVE_FILE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatArchiveFile.hpp
+//---------------------------------------------------------------------------//
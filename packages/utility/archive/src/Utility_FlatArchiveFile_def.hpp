@@ -0,0 +1,106 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatArchiveFile_def.hpp
+//! \author Alex Robinson
+//! \brief  Flat (memory mapped) archive file template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_ARCHIVE_FILE_DEF_HPP
+#define UTILITY_FLAT_ARCHIVE_FILE_DEF_HPP
+
+// Std Lib Includes
+#include <type_traits>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+
+//! Define the flat archive element type traits for a type
+#define __FLAT_ARCHIVE_ELEMENT_TYPE__( TYPE, CODE )     \
+  template<>                                            \
+  struct FlatArchiveElementTypeTraits<TYPE>             \
+  {                                                     \
+    static const uint32_t code = CODE;                  \
+    static const uint32_t size = sizeof(TYPE);          \
+  }
+
+namespace Utility{
+
+namespace Details{
+
+__FLAT_ARCHIVE_ELEMENT_TYPE__( char, 1 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( bool, 2 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( signed char, 3 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( unsigned char, 4 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( short, 5 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( unsigned short, 6 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( int, 7 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( unsigned, 8 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( long, 9 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( unsigned long, 10 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( long long, 11 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( unsigned long long, 12 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( float, 13 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( double, 14 );
+__FLAT_ARCHIVE_ELEMENT_TYPE__( long double, 15 );
+
+/*! Check if a type can be stored as an array element in a flat archive
+ *
+ * Arrays of bools cannot be stored directly since std::vector<bool> does not
+ * store its elements contiguously.
+ */
+template<typename T>
+struct IsFlatArchiveArrayElement : public std::integral_constant<bool,
+                                            std::is_arithmetic<T>::value &&
+                                            !std::is_same<T,bool>::value>
+{ /* ... */ };
+
+} // end Details namespace
+
+// Return a view of the entry data (no data is copied)
+/*! \details The view is only valid as long as this object exists. An
+ * exception will be thrown if the entry does not exist or if the entry
+ * element type does not match the requested type.
+ */
+template<typename T>
+Utility::ArrayView<const T> FlatArchiveFile::getEntry(
+                                        const std::string& entry_name ) const
+{
+  typedef Details::FlatArchiveElementTypeTraits<T> ElementTypeTraits;
+
+  const Details::FlatArchiveIndexEntry& entry =
+    this->getEntryIndexData( entry_name );
+
+  const T* entry_data = static_cast<const T*>(
+                         this->getEntryData( entry,
+                                             ElementTypeTraits::code,
+                                             ElementTypeTraits::size ) );
+
+  return Utility::ArrayView<const T>( entry_data, entry.number_of_elements );
+}
+
+// Return the value of a single value entry
+template<typename T>
+T FlatArchiveFile::getEntryValue( const std::string& entry_name ) const
+{
+  Utility::ArrayView<const T> entry_data = this->getEntry<T>( entry_name );
+
+  TEST_FOR_EXCEPTION( entry_data.size() != 1,
+                      std::runtime_error,
+                      "Entry " << entry_name << " of flat archive file "
+                      << d_file_name.string() << " does not store a single "
+                      "value (" << entry_data.size() << " values are "
+                      "stored)!" );
+
+  return entry_data.front();
+}
+
+} // end Utility namespace
+
+#undef __FLAT_ARCHIVE_ELEMENT_TYPE__
+
+#endif // end UTILITY_FLAT_ARCHIVE_FILE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatArchiveFile_def.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,43 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatIArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat input archive class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_FlatIArchive.hpp"
+
+namespace Utility{
+
+// Constructor
+FlatIArchive::FlatIArchive(
+                          const boost::filesystem::path& file_name_with_path )
+  : d_file( new FlatArchiveFile( file_name_with_path ) ),
+    d_prefix()
+{ /* ... */ }
+
+// Return the archive file
+const FlatArchiveFile& FlatIArchive::getFile() const
+{
+  return *d_file;
+}
+
+// Return the shared archive file (keeps the array views valid)
+std::shared_ptr<const FlatArchiveFile> FlatIArchive::getSharedFile() const
+{
+  return d_file;
+}
+
+// Load a string
+void FlatIArchive::loadValue( const std::string& name, std::string& value )
+{
+  value = d_file->getEntryString( name );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatIArchive.cpp
+//---------------------------------------------------------------------------//
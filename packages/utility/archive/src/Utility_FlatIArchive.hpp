@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatIArchive.hpp
+//! \author Alex Robinson
+//! \brief  Flat input archive class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_IARCHIVE_HPP
+#define UTILITY_FLAT_IARCHIVE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <utility>
+#include <memory>
+#include <type_traits>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/serialization/nvp.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatArchiveFile.hpp"
+#include "Utility_MappableArray.hpp"
+
+namespace Utility{
+
+/*! The flat input archive
+ * \details This archive loads an object that was saved with the
+ * Utility::FlatOArchive. The file is memory mapped. Array entries that are
+ * loaded into std::vector members are copied directly into the object
+ * (there is no element-by-element deserialization). Array entries that are
+ * loaded into Utility::ArrayView<const T> members are not copied at all -
+ * the view will point into the mapped pages. These views are only valid as
+ * long as the mapped file exists, which can be guaranteed by holding on to
+ * the file returned by Utility::FlatIArchive::getSharedFile. Array entries
+ * that are loaded into Utility::MappableArray members are also views of the
+ * mapped pages but they share ownership of the file. A view of any
+ * entry can also be requested with Utility::FlatIArchive::getArrayView
+ * (e.g. from inside of the load method of an object).
+ * \ingroup archive
+ */
+class FlatIArchive
+{
+
+public:
+
+  //! This archive is a loading archive
+  typedef boost::mpl::bool_<true> is_loading;
+
+  //! This archive is not a saving archive
+  typedef boost::mpl::bool_<false> is_saving;
+
+  //! Constructor
+  FlatIArchive( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~FlatIArchive()
+  { /* ... */ }
+
+  //! Load a name-value pair
+  template<typename T>
+  FlatIArchive& operator>>( const boost::serialization::nvp<T>& t );
+
+  //! Load a name-value pair
+  template<typename T>
+  FlatIArchive& operator&( const boost::serialization::nvp<T>& t );
+
+  //! Return a view of an array entry (no data is copied)
+  template<typename T>
+  Utility::ArrayView<const T> getArrayView( const std::string& name ) const;
+
+  //! Return the archive file
+  const FlatArchiveFile& getFile() const;
+
+  //! Return the shared archive file (keeps the array views valid)
+  std::shared_ptr<const FlatArchiveFile> getSharedFile() const;
+
+private:
+
+  // Load an arithmetic value
+  template<typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value>::type
+  loadValue( const std::string& name, T& value );
+
+  // Load a string
+  void loadValue( const std::string& name, std::string& value );
+
+  // Load a pair
+  template<typename T1, typename T2>
+  void loadValue( const std::string& name, std::pair<T1,T2>& value );
+
+  // Load a vector
+  template<typename T, typename Alloc>
+  void loadValue( const std::string& name, std::vector<T,Alloc>& value );
+
+  // Load a vector of pairs
+  template<typename T1, typename T2, typename Alloc>
+  void loadValue( const std::string& name,
+                  std::vector<std::pair<T1,T2>,Alloc>& value );
+
+  // Load an array view
+  template<typename T>
+  void loadValue( const std::string& name,
+                  Utility::ArrayView<const T>& value );
+
+  // Load a mappable array
+  template<typename T>
+  void loadValue( const std::string& name,
+                  Utility::MappableArray<T>& value );
+
+  // Load a set
+  template<typename T, typename Compare, typename Alloc>
+  void loadValue( const std::string& name,
+                  std::set<T,Compare,Alloc>& value );
+
+  // Load a map
+  template<typename Key, typename T, typename Compare, typename Alloc>
+  void loadValue( const std::string& name,
+                  std::map<Key,T,Compare,Alloc>& value );
+
+  // Load an object
+  template<typename T>
+  typename std::enable_if<!std::is_arithmetic<T>::value>::type
+  loadValue( const std::string& name, T& value );
+
+  // Load a vector of array elements
+  template<typename T, typename Alloc>
+  void loadVector( const std::string& name,
+                   std::vector<T,Alloc>& value,
+                   std::true_type );
+
+  // Load a vector of non-array elements
+  template<typename T, typename Alloc>
+  void loadVector( const std::string& name,
+                   std::vector<T,Alloc>& value,
+                   std::false_type );
+
+  // Load a vector of arithmetic pairs
+  template<typename T1, typename T2, typename Alloc>
+  void loadVectorOfPairs( const std::string& name,
+                          std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::true_type );
+
+  // Load a vector of non-arithmetic pairs
+  template<typename T1, typename T2, typename Alloc>
+  void loadVectorOfPairs( const std::string& name,
+                          std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::false_type );
+
+  // The archive file
+  std::shared_ptr<const FlatArchiveFile> d_file;
+
+  // The current entry name prefix
+  std::string d_prefix;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_FlatIArchive_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_FLAT_IARCHIVE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatIArchive.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,270 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatIArchive_def.hpp
+//! \author Alex Robinson
+//! \brief  Flat input archive template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_IARCHIVE_DEF_HPP
+#define UTILITY_FLAT_IARCHIVE_DEF_HPP
+
+// Boost Includes
+#include <boost/serialization/serialization.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/lexical_cast.hpp>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+// Load a name-value pair
+template<typename T>
+inline FlatIArchive& FlatIArchive::operator>>(
+                                   const boost::serialization::nvp<T>& t )
+{
+  this->loadValue( d_prefix + t.name(), t.value() );
+
+  return *this;
+}
+
+// Load a name-value pair
+template<typename T>
+inline FlatIArchive& FlatIArchive::operator&(
+                                   const boost::serialization::nvp<T>& t )
+{
+  return (*this) >> t;
+}
+
+// Return a view of an array entry (no data is copied)
+/*! \details The name is relative to the object that is currently being
+ * loaded (i.e. it is the name that was used in the name-value pair when the
+ * array was saved). The view is only valid as long as the archive file
+ * exists (see Utility::FlatIArchive::getSharedFile).
+ */
+template<typename T>
+inline Utility::ArrayView<const T> FlatIArchive::getArrayView(
+                                          const std::string& name ) const
+{
+  return d_file->getEntry<T>( d_prefix + name );
+}
+
+// Load an arithmetic value
+template<typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+FlatIArchive::loadValue( const std::string& name, T& value )
+{
+  value = d_file->getEntryValue<T>( name );
+}
+
+// Load a pair
+template<typename T1, typename T2>
+void FlatIArchive::loadValue( const std::string& name,
+                              std::pair<T1,T2>& value )
+{
+  this->loadValue( name + "/first", value.first );
+  this->loadValue( name + "/second", value.second );
+}
+
+// Load a vector
+template<typename T, typename Alloc>
+inline void FlatIArchive::loadValue( const std::string& name,
+                                     std::vector<T,Alloc>& value )
+{
+  this->loadVector( name,
+                    value,
+                    typename Details::IsFlatArchiveArrayElement<T>::type() );
+}
+
+// Load a vector of pairs
+template<typename T1, typename T2, typename Alloc>
+inline void FlatIArchive::loadValue(
+                               const std::string& name,
+                               std::vector<std::pair<T1,T2>,Alloc>& value )
+{
+  typedef std::integral_constant<bool,
+                     Details::IsFlatArchiveArrayElement<T1>::value &&
+                     Details::IsFlatArchiveArrayElement<T2>::value>
+    IsArithmeticPair;
+
+  this->loadVectorOfPairs( name, value, IsArithmeticPair() );
+}
+
+// Load an array view
+/*! \details The view will point into the mapped file (no data is copied).
+ */
+template<typename T>
+inline void FlatIArchive::loadValue( const std::string& name,
+                                     Utility::ArrayView<const T>& value )
+{
+  static_assert( Details::IsFlatArchiveArrayElement<T>::value,
+                 "Only views of arithmetic arrays can be loaded from a "
+                 "flat archive!" );
+
+  value = d_file->getEntry<T>( name );
+}
+
+// Load a mappable array
+/*! \details The array will view the mapped file (no data is copied) and it
+ * will keep the mapped file alive.
+ */
+template<typename T>
+inline void FlatIArchive::loadValue( const std::string& name,
+                                     Utility::MappableArray<T>& value )
+{
+  value = Utility::MappableArray<T>( d_file->getEntry<T>( name ), d_file );
+}
+
+// Load a set
+template<typename T, typename Compare, typename Alloc>
+void FlatIArchive::loadValue( const std::string& name,
+                              std::set<T,Compare,Alloc>& value )
+{
+  std::vector<T> elements;
+
+  this->loadValue( name, elements );
+
+  // The elements are sorted - each element will be inserted at the end
+  value.clear();
+
+  for( size_t i = 0; i < elements.size(); ++i )
+    value.emplace_hint( value.end(), std::move( elements[i] ) );
+}
+
+// Load a map
+template<typename Key, typename T, typename Compare, typename Alloc>
+void FlatIArchive::loadValue( const std::string& name,
+                              std::map<Key,T,Compare,Alloc>& value )
+{
+  std::vector<Key> keys;
+  std::vector<T> values;
+
+  this->loadValue( name + "/keys", keys );
+  this->loadValue( name + "/values", values );
+
+  TEST_FOR_EXCEPTION( keys.size() != values.size(),
+                      std::runtime_error,
+                      "Map " << name << " of flat archive "
+                      << d_file->getFileName().string() << " does not have "
+                      "the same number of keys and values!" );
+
+  // The keys are sorted - each element will be inserted at the end
+  value.clear();
+
+  for( size_t i = 0; i < keys.size(); ++i )
+  {
+    value.emplace_hint( value.end(),
+                        std::move( keys[i] ),
+                        std::move( values[i] ) );
+  }
+}
+
+// Load an object
+template<typename T>
+typename std::enable_if<!std::is_arithmetic<T>::value>::type
+FlatIArchive::loadValue( const std::string& name, T& value )
+{
+  unsigned version;
+
+  this->loadValue( name + "@version", version );
+
+  TEST_FOR_EXCEPTION( version > boost::serialization::version<T>::value,
+                      std::runtime_error,
+                      "Object " << name << " of flat archive "
+                      << d_file->getFileName().string() << " was saved with "
+                      "a newer class version (" << version << ") than the "
+                      "current class version ("
+                      << boost::serialization::version<T>::value << ")!" );
+
+  const std::string parent_prefix = d_prefix;
+
+  d_prefix = name + "/";
+
+  boost::serialization::serialize_adl( *this, value, version );
+
+  d_prefix = parent_prefix;
+}
+
+// Load a vector of array elements
+/*! \details The elements are copied directly from the mapped file.
+ */
+template<typename T, typename Alloc>
+inline void FlatIArchive::loadVector( const std::string& name,
+                                      std::vector<T,Alloc>& value,
+                                      std::true_type )
+{
+  Utility::ArrayView<const T> elements = d_file->getEntry<T>( name );
+
+  value.assign( elements.begin(), elements.end() );
+}
+
+// Load a vector of non-array elements
+template<typename T, typename Alloc>
+void FlatIArchive::loadVector( const std::string& name,
+                               std::vector<T,Alloc>& value,
+                               std::false_type )
+{
+  unsigned long long size;
+
+  this->loadValue( name + "/size", size );
+
+  value.clear();
+  value.reserve( size );
+
+  for( size_t i = 0; i < size; ++i )
+  {
+    T element;
+
+    this->loadValue( name + "/" + boost::lexical_cast<std::string>( i ),
+                     element );
+
+    value.push_back( std::move( element ) );
+  }
+}
+
+// Load a vector of arithmetic pairs
+template<typename T1, typename T2, typename Alloc>
+void FlatIArchive::loadVectorOfPairs(
+                                const std::string& name,
+                                std::vector<std::pair<T1,T2>,Alloc>& value,
+                                std::true_type )
+{
+  Utility::ArrayView<const T1> first_values =
+    d_file->getEntry<T1>( name + "/first" );
+
+  Utility::ArrayView<const T2> second_values =
+    d_file->getEntry<T2>( name + "/second" );
+
+  TEST_FOR_EXCEPTION( first_values.size() != second_values.size(),
+                      std::runtime_error,
+                      "Array " << name << " of flat archive "
+                      << d_file->getFileName().string() << " does not have "
+                      "the same number of first and second pair values!" );
+
+  value.resize( first_values.size() );
+
+  for( size_t i = 0; i < value.size(); ++i )
+  {
+    value[i].first = first_values[i];
+    value[i].second = second_values[i];
+  }
+}
+
+// Load a vector of non-arithmetic pairs
+template<typename T1, typename T2, typename Alloc>
+inline void FlatIArchive::loadVectorOfPairs(
+                                const std::string& name,
+                                std::vector<std::pair<T1,T2>,Alloc>& value,
+                                std::false_type )
+{
+  this->loadVector( name, value, std::false_type() );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_FLAT_IARCHIVE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatIArchive_def.hpp
+//---------------------------------------------------------------------------//
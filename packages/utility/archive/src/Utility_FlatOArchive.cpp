@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatOArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat output archive class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <fstream>
+#include <cstring>
+
+// Boost Includes
+#include <boost/filesystem/operations.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatOArchive.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+namespace Details{
+
+// Round an offset up to the requested alignment
+inline uint64_t alignFlatArchiveOffset( const uint64_t offset,
+                                        const uint64_t alignment )
+{
+  return ((offset + alignment - 1)/alignment)*alignment;
+}
+
+} // end Details namespace
+
+// Constructor
+FlatOArchive::FlatOArchive(
+                          const boost::filesystem::path& file_name_with_path )
+  : d_file_name( file_name_with_path ),
+    d_entries(),
+    d_prefix(),
+    d_file_written( false )
+{
+  // Verify that the parent directory exists
+  if( file_name_with_path.has_parent_path() )
+  {
+    TEST_FOR_EXCEPTION( !boost::filesystem::exists( file_name_with_path.parent_path() ),
+                        std::runtime_error,
+                        "Cannot create the flat archive "
+                        << file_name_with_path.string() <<
+                        " because the parent directory does not exist!" );
+  }
+}
+
+// Save a string
+void FlatOArchive::saveValue( const std::string& name,
+                              const std::string& value )
+{
+  this->addEntry( name, value.data(), value.size() );
+}
+
+// Add an entry
+void FlatOArchive::addEntry( const std::string& name,
+                             const void* data,
+                             const size_t number_of_elements,
+                             const uint32_t element_type,
+                             const uint32_t element_size )
+{
+  TEST_FOR_EXCEPTION( d_entries.find( name ) != d_entries.end(),
+                      std::runtime_error,
+                      "Entry " << name << " has already been saved to flat "
+                      "archive " << d_file_name.string() << "!" );
+
+  Entry& entry = d_entries[name];
+
+  entry.data.resize( number_of_elements*element_size );
+  entry.number_of_elements = number_of_elements;
+  entry.element_type = element_type;
+  entry.element_size = element_size;
+
+  if( number_of_elements > 0 )
+    std::memcpy( entry.data.data(), data, entry.data.size() );
+}
+
+// Write the archive file
+/*! \details The file will be written to a temporary file first, which is
+ * then renamed, so that an incomplete file is never left behind.
+ */
+void FlatOArchive::writeFile() const
+{
+  Details::FlatArchiveFileHeader header;
+  std::memset( &header, 0, sizeof(header) );
+
+  std::memcpy( header.identifier,
+               FlatArchiveFile::s_identifier,
+               sizeof(header.identifier) );
+
+  header.format_version = FlatArchiveFile::s_format_version;
+  header.byte_order_check = FlatArchiveFile::s_byte_order_check;
+  header.number_of_entries = d_entries.size();
+
+  // Construct the index
+  std::vector<Details::FlatArchiveIndexEntry> index( d_entries.size() );
+
+  uint64_t data_offset =
+    Details::alignFlatArchiveOffset( sizeof(header),
+                                     FlatArchiveFile::s_data_alignment );
+  uint64_t name_offset = 0;
+
+  std::map<std::string,Entry>::const_iterator entry_it = d_entries.begin();
+
+  for( size_t i = 0; i < index.size(); ++i, ++entry_it )
+  {
+    std::memset( &index[i], 0, sizeof(index[i]) );
+
+    index[i].name_offset = name_offset;
+    index[i].name_size = entry_it->first.size();
+    index[i].data_offset = data_offset;
+    index[i].number_of_elements = entry_it->second.number_of_elements;
+    index[i].element_type = entry_it->second.element_type;
+    index[i].element_size = entry_it->second.element_size;
+
+    name_offset += entry_it->first.size();
+
+    data_offset =
+      Details::alignFlatArchiveOffset( data_offset + entry_it->second.data.size(),
+                                       FlatArchiveFile::s_data_alignment );
+  }
+
+  header.index_offset = data_offset;
+  header.names_offset =
+    header.index_offset + index.size()*sizeof(Details::FlatArchiveIndexEntry);
+  header.file_size = header.names_offset + name_offset;
+
+  // Write the file
+  boost::filesystem::path tmp_file_name = d_file_name;
+  tmp_file_name += ".tmp";
+
+  {
+    std::ofstream file( tmp_file_name.string(),
+                        std::ofstream::binary | std::ofstream::trunc );
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Cannot create the flat archive "
+                        << d_file_name.string() << "!" );
+
+    const std::vector<char> padding( FlatArchiveFile::s_data_alignment, 0 );
+
+    file.write( reinterpret_cast<const char*>( &header ), sizeof(header) );
+
+    uint64_t file_offset = sizeof(header);
+
+    entry_it = d_entries.begin();
+
+    for( size_t i = 0; i < index.size(); ++i, ++entry_it )
+    {
+      file.write( padding.data(), index[i].data_offset - file_offset );
+
+      file.write( entry_it->second.data.data(),
+                  entry_it->second.data.size() );
+
+      file_offset = index[i].data_offset + entry_it->second.data.size();
+    }
+
+    file.write( padding.data(), header.index_offset - file_offset );
+
+    if( !index.empty() )
+    {
+      file.write( reinterpret_cast<const char*>( index.data() ),
+                  index.size()*sizeof(Details::FlatArchiveIndexEntry) );
+    }
+
+    for( entry_it = d_entries.begin(); entry_it != d_entries.end(); ++entry_it )
+      file.write( entry_it->first.data(), entry_it->first.size() );
+
+    file.close();
+
+    TEST_FOR_EXCEPTION( !file.good(),
+                        std::runtime_error,
+                        "Could not write the flat archive "
+                        << d_file_name.string() << "!" );
+  }
+
+  boost::filesystem::rename( tmp_file_name, d_file_name );
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatOArchive.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatOArchive.hpp
+//! \author Alex Robinson
+//! \brief  Flat output archive class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_OARCHIVE_HPP
+#define UTILITY_FLAT_OARCHIVE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <utility>
+#include <type_traits>
+
+// Boost Includes
+#include <boost/filesystem/path.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/serialization/nvp.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatArchiveFile.hpp"
+#include "Utility_MappableArray.hpp"
+
+namespace Utility{
+
+/*! The flat output archive
+ * \details This archive flattens an object that can be saved with the
+ * boost serialization library (using name-value pairs) into a
+ * Utility::FlatArchiveFile. Every arithmetic value, string or array of
+ * arithmetic values becomes a single named entry. The entry names are
+ * constructed from the name-value pair names:
+ * <ul>
+ *  <li>object members: "object_name/member_name"</li>
+ *  <li>object class version: "object_name@version"</li>
+ *  <li>arrays of arithmetic values (std::vector, Utility::ArrayView or
+ *      Utility::MappableArray):
+ *      "array_name"</li>
+ *  <li>arrays of non-arithmetic values: "array_name/size" and
+ *      "array_name/0", "array_name/1", ...</li>
+ *  <li>pairs: "pair_name/first" and "pair_name/second"</li>
+ *  <li>arrays of arithmetic pairs: "array_name/first" and
+ *      "array_name/second"</li>
+ *  <li>sets: stored as sorted arrays</li>
+ *  <li>maps: "map_name/keys" and "map_name/values" (stored as arrays)</li>
+ * </ul>
+ * The file is written once the first object that is saved to the archive
+ * has been flattened. Only a single object can be saved to an archive.
+ * Objects that are saved through pointers are not supported.
+ * \ingroup archive
+ */
+class FlatOArchive
+{
+
+public:
+
+  //! This archive is not a loading archive
+  typedef boost::mpl::bool_<false> is_loading;
+
+  //! This archive is a saving archive
+  typedef boost::mpl::bool_<true> is_saving;
+
+  //! Constructor
+  FlatOArchive( const boost::filesystem::path& file_name_with_path );
+
+  //! Destructor
+  ~FlatOArchive()
+  { /* ... */ }
+
+  //! Save a name-value pair
+  template<typename T>
+  FlatOArchive& operator<<( const boost::serialization::nvp<T>& t );
+
+  //! Save a name-value pair
+  template<typename T>
+  FlatOArchive& operator&( const boost::serialization::nvp<T>& t );
+
+private:
+
+  // Save an arithmetic value
+  template<typename T>
+  typename std::enable_if<std::is_arithmetic<T>::value>::type
+  saveValue( const std::string& name, const T& value );
+
+  // Save a string
+  void saveValue( const std::string& name, const std::string& value );
+
+  // Save a pair
+  template<typename T1, typename T2>
+  void saveValue( const std::string& name, const std::pair<T1,T2>& value );
+
+  // Save a vector
+  template<typename T, typename Alloc>
+  void saveValue( const std::string& name,
+                  const std::vector<T,Alloc>& value );
+
+  // Save a vector of pairs
+  template<typename T1, typename T2, typename Alloc>
+  void saveValue( const std::string& name,
+                  const std::vector<std::pair<T1,T2>,Alloc>& value );
+
+  // Save an array view
+  template<typename T>
+  void saveValue( const std::string& name,
+                  const Utility::ArrayView<T>& value );
+
+  // Save a mappable array
+  template<typename T>
+  void saveValue( const std::string& name,
+                  const Utility::MappableArray<T>& value );
+
+  // Save a set
+  template<typename T, typename Compare, typename Alloc>
+  void saveValue( const std::string& name,
+                  const std::set<T,Compare,Alloc>& value );
+
+  // Save a map
+  template<typename Key, typename T, typename Compare, typename Alloc>
+  void saveValue( const std::string& name,
+                  const std::map<Key,T,Compare,Alloc>& value );
+
+  // Save an object
+  template<typename T>
+  typename std::enable_if<!std::is_arithmetic<T>::value>::type
+  saveValue( const std::string& name, const T& value );
+
+  // Save a vector of array elements
+  template<typename T, typename Alloc>
+  void saveVector( const std::string& name,
+                   const std::vector<T,Alloc>& value,
+                   std::true_type );
+
+  // Save a vector of non-array elements
+  template<typename T, typename Alloc>
+  void saveVector( const std::string& name,
+                   const std::vector<T,Alloc>& value,
+                   std::false_type );
+
+  // Save a vector of arithmetic pairs
+  template<typename T1, typename T2, typename Alloc>
+  void saveVectorOfPairs( const std::string& name,
+                          const std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::true_type );
+
+  // Save a vector of non-arithmetic pairs
+  template<typename T1, typename T2, typename Alloc>
+  void saveVectorOfPairs( const std::string& name,
+                          const std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::false_type );
+
+  // Add an entry
+  template<typename T>
+  void addEntry( const std::string& name,
+                 const T* data,
+                 const size_t number_of_elements );
+
+  // Add an entry
+  void addEntry( const std::string& name,
+                 const void* data,
+                 const size_t number_of_elements,
+                 const uint32_t element_type,
+                 const uint32_t element_size );
+
+  // Write the archive file
+  void writeFile() const;
+
+  // The entry
+  struct Entry
+  {
+    // The entry data
+    std::vector<char> data;
+
+    // The number of elements
+    uint64_t number_of_elements;
+
+    // The element type
+    uint32_t element_type;
+
+    // The element size
+    uint32_t element_size;
+  };
+
+  // The file name
+  boost::filesystem::path d_file_name;
+
+  // The entries (sorted by name)
+  std::map<std::string,Entry> d_entries;
+
+  // The current entry name prefix
+  std::string d_prefix;
+
+  // Records if the file has been written
+  bool d_file_written;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_FlatOArchive_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_FLAT_OARCHIVE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatOArchive.hpp
+//---------------------------------------------------------------------------//
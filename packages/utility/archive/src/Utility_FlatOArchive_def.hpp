@@ -0,0 +1,262 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_FlatOArchive_def.hpp
+//! \author Alex Robinson
+//! \brief  Flat output archive template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_FLAT_OARCHIVE_DEF_HPP
+#define UTILITY_FLAT_OARCHIVE_DEF_HPP
+
+// Boost Includes
+#include <boost/serialization/serialization.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/lexical_cast.hpp>
+
+// FRENSIE Includes
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+// Save a name-value pair
+/*! \details The archive file will be written once the first (top level)
+ * name-value pair has been saved.
+ */
+template<typename T>
+FlatOArchive& FlatOArchive::operator<<(
+                                   const boost::serialization::nvp<T>& t )
+{
+  const bool top_level = d_prefix.empty();
+
+  TEST_FOR_EXCEPTION( top_level && d_file_written,
+                      std::runtime_error,
+                      "Only a single object can be saved to flat archive "
+                      << d_file_name.string() << "!" );
+
+  this->saveValue( d_prefix + t.name(), t.const_value() );
+
+  if( top_level )
+  {
+    this->writeFile();
+
+    d_file_written = true;
+  }
+
+  return *this;
+}
+
+// Save a name-value pair
+template<typename T>
+inline FlatOArchive& FlatOArchive::operator&(
+                                   const boost::serialization::nvp<T>& t )
+{
+  return (*this) << t;
+}
+
+// Save an arithmetic value
+template<typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+FlatOArchive::saveValue( const std::string& name, const T& value )
+{
+  this->addEntry( name, &value, 1 );
+}
+
+// Save a pair
+template<typename T1, typename T2>
+void FlatOArchive::saveValue( const std::string& name,
+                              const std::pair<T1,T2>& value )
+{
+  this->saveValue( name + "/first", value.first );
+  this->saveValue( name + "/second", value.second );
+}
+
+// Save a vector
+template<typename T, typename Alloc>
+inline void FlatOArchive::saveValue( const std::string& name,
+                                     const std::vector<T,Alloc>& value )
+{
+  this->saveVector( name,
+                    value,
+                    typename Details::IsFlatArchiveArrayElement<T>::type() );
+}
+
+// Save a vector of pairs
+template<typename T1, typename T2, typename Alloc>
+inline void FlatOArchive::saveValue(
+                     const std::string& name,
+                     const std::vector<std::pair<T1,T2>,Alloc>& value )
+{
+  typedef std::integral_constant<bool,
+                     Details::IsFlatArchiveArrayElement<T1>::value &&
+                     Details::IsFlatArchiveArrayElement<T2>::value>
+    IsArithmeticPair;
+
+  this->saveVectorOfPairs( name, value, IsArithmeticPair() );
+}
+
+// Save an array view
+template<typename T>
+inline void FlatOArchive::saveValue( const std::string& name,
+                                     const Utility::ArrayView<T>& value )
+{
+  typedef typename std::remove_const<T>::type ElementType;
+
+  static_assert( Details::IsFlatArchiveArrayElement<ElementType>::value,
+                 "Only views of arithmetic arrays can be saved to a flat "
+                 "archive!" );
+
+  this->addEntry( name,
+                  static_cast<const ElementType*>( value.data() ),
+                  value.size() );
+}
+
+// Save a mappable array
+template<typename T>
+inline void FlatOArchive::saveValue( const std::string& name,
+                                     const Utility::MappableArray<T>& value )
+{
+  this->saveValue( name, value.view() );
+}
+
+// Save a set
+/*! \details The set elements will be stored as a sorted array.
+ */
+template<typename T, typename Compare, typename Alloc>
+void FlatOArchive::saveValue( const std::string& name,
+                              const std::set<T,Compare,Alloc>& value )
+{
+  this->saveValue( name, std::vector<T>( value.begin(), value.end() ) );
+}
+
+// Save a map
+/*! \details The keys and values will be stored as separate (sorted) arrays
+ * so that a key can be searched for without reading the values.
+ */
+template<typename Key, typename T, typename Compare, typename Alloc>
+void FlatOArchive::saveValue( const std::string& name,
+                              const std::map<Key,T,Compare,Alloc>& value )
+{
+  std::vector<Key> keys;
+  keys.reserve( value.size() );
+
+  std::vector<T> values;
+  values.reserve( value.size() );
+
+  for( typename std::map<Key,T,Compare,Alloc>::const_iterator value_it =
+         value.begin();
+       value_it != value.end();
+       ++value_it )
+  {
+    keys.push_back( value_it->first );
+    values.push_back( value_it->second );
+  }
+
+  this->saveValue( name + "/keys", keys );
+  this->saveValue( name + "/values", values );
+}
+
+// Save an object
+/*! \details The object must be serializable with the boost serialization
+ * library. Its members will be stored with the object name as a prefix.
+ */
+template<typename T>
+typename std::enable_if<!std::is_arithmetic<T>::value>::type
+FlatOArchive::saveValue( const std::string& name, const T& value )
+{
+  const unsigned version = boost::serialization::version<T>::value;
+
+  this->saveValue( name + "@version", version );
+
+  const std::string parent_prefix = d_prefix;
+
+  d_prefix = name + "/";
+
+  boost::serialization::serialize_adl( *this,
+                                       const_cast<T&>( value ),
+                                       version );
+
+  d_prefix = parent_prefix;
+}
+
+// Save a vector of array elements
+template<typename T, typename Alloc>
+inline void FlatOArchive::saveVector( const std::string& name,
+                                      const std::vector<T,Alloc>& value,
+                                      std::true_type )
+{
+  this->addEntry( name, value.data(), value.size() );
+}
+
+// Save a vector of non-array elements
+template<typename T, typename Alloc>
+void FlatOArchive::saveVector( const std::string& name,
+                               const std::vector<T,Alloc>& value,
+                               std::false_type )
+{
+  const unsigned long long size = value.size();
+
+  this->saveValue( name + "/size", size );
+
+  for( size_t i = 0; i < value.size(); ++i )
+  {
+    this->saveValue( name + "/" + boost::lexical_cast<std::string>( i ),
+                     static_cast<const T&>( value[i] ) );
+  }
+}
+
+// Save a vector of arithmetic pairs
+/*! \details The first and second pair elements will be stored as separate
+ * arrays.
+ */
+template<typename T1, typename T2, typename Alloc>
+void FlatOArchive::saveVectorOfPairs(
+                          const std::string& name,
+                          const std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::true_type )
+{
+  std::vector<T1> first_values( value.size() );
+  std::vector<T2> second_values( value.size() );
+
+  for( size_t i = 0; i < value.size(); ++i )
+  {
+    first_values[i] = value[i].first;
+    second_values[i] = value[i].second;
+  }
+
+  this->saveValue( name + "/first", first_values );
+  this->saveValue( name + "/second", second_values );
+}
+
+// Save a vector of non-arithmetic pairs
+template<typename T1, typename T2, typename Alloc>
+inline void FlatOArchive::saveVectorOfPairs(
+                          const std::string& name,
+                          const std::vector<std::pair<T1,T2>,Alloc>& value,
+                          std::false_type )
+{
+  this->saveVector( name, value, std::false_type() );
+}
+
+// Add an entry
+template<typename T>
+inline void FlatOArchive::addEntry( const std::string& name,
+                                    const T* data,
+                                    const size_t number_of_elements )
+{
+  typedef Details::FlatArchiveElementTypeTraits<T> ElementTypeTraits;
+
+  this->addEntry( name,
+                  data,
+                  number_of_elements,
+                  ElementTypeTraits::code,
+                  ElementTypeTraits::size );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_FLAT_OARCHIVE_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_FlatOArchive_def.hpp
+//---------------------------------------------------------------------------//
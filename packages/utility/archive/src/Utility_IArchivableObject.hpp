@@ -49,11 +49,18 @@ public:
   //! Load the archived object
   void loadFromFile( const boost::filesystem::path& archive_name_with_path );
 
+  //! Load the archived object from a stream
+  void loadFromStream( std::istream& is, const std::string& extension );
+
 protected:
 
   //! Load the archived object (implementation)
   virtual void loadFromFileImpl( const boost::filesystem::path& archive_name_with_path );
 
+  //! Load the archived object from a stream (implementation)
+  virtual void loadFromStreamImpl( std::istream& is,
+                                   const std::string& extension );
+
   //! Reset the bpis pointer
   template<typename T>
   const boost::archive::detail::basic_pointer_iserializer* resetBpisPointer( const std::string& extension ) const;
@@ -21,7 +21,7 @@ namespace Utility{
 
 // Load the archived object
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .flat)
  */
 template<typename DerivedType>
 void IArchivableObject<DerivedType>::loadFromFile( const boost::filesystem::path& archive_name_with_path )
@@ -31,7 +31,7 @@ void IArchivableObject<DerivedType>::loadFromFile( const boost::filesystem::path
 
 // Load the archived object (implementation)
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .flat)
  */
 template<typename DerivedType>
 void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::path& archive_name_with_path )
@@ -77,6 +77,12 @@ void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::
 
     boost::archive::binary_iarchive archive( *iarchive_stream );
 
+    this->loadFromArchive( archive );
+  }
+  else if( extension == ".flat" )
+  {
+    Utility::FlatIArchive archive( archive_name_with_path );
+
     this->loadFromArchive( archive );
   }
 #ifdef HAVE_FRENSIE_HDF5
@@ -96,6 +102,56 @@ void IArchivableObject<DerivedType>::loadFromFileImpl( const boost::filesystem::
   }
 }
 
+// Load the archived object from a stream
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). HDF5 and flat archives can only be loaded from a
+ * file.
+ */
+template<typename DerivedType>
+void IArchivableObject<DerivedType>::loadFromStream(
+                                               std::istream& is,
+                                               const std::string& extension )
+{
+  this->loadFromStreamImpl( is, extension );
+}
+
+// Load the archived object from a stream (implementation)
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). HDF5 and flat archives can only be loaded from a
+ * file.
+ */
+template<typename DerivedType>
+void IArchivableObject<DerivedType>::loadFromStreamImpl(
+                                               std::istream& is,
+                                               const std::string& extension )
+{
+  if( extension == ".xml" )
+  {
+    boost::archive::xml_iarchive archive( is );
+
+    this->loadFromArchive( archive );
+  }
+  else if( extension == ".txt" )
+  {
+    boost::archive::text_iarchive archive( is );
+
+    this->loadFromArchive( archive );
+  }
+  else if( extension == ".bin" )
+  {
+    boost::archive::binary_iarchive archive( is );
+
+    this->loadFromArchive( archive );
+  }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot create the input archive stream because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
+  }
+}
+
 // Reset the bpis pointer
 template<typename DerivedType>
 template<typename T>
@@ -130,6 +186,11 @@ const boost::archive::detail::basic_pointer_iserializer* IArchivableObject<Deriv
       boost::serialization::singleton<boost::archive::detail::iserializer<boost::archive::binary_iarchive, T > >::get_mutable_instance().set_bpis( NULL );
     }
   }
+  else if( extension == ".flat" )
+  {
+    // The flat archive does not use the boost serializers
+    bpis = NULL;
+  }
 #ifdef HAVE_FRENSIE_HDF5
   else if( extension == ".h5fa" )
   {
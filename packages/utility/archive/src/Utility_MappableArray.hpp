@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MappableArray.hpp
+//! \author Alex Robinson
+//! \brief  Mappable array class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MAPPABLE_ARRAY_HPP
+#define UTILITY_MAPPABLE_ARRAY_HPP
+
+// Std Lib Includes
+#include <vector>
+#include <memory>
+#include <type_traits>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/level.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+
+namespace Utility{
+
+/*! The mappable array
+ * \details This array either owns its elements (e.g. when it is assigned a
+ * std::vector or loaded from a boost archive) or it is a view of the mapped
+ * pages of a Utility::FlatArchiveFile (when it is loaded from a
+ * Utility::FlatIArchive). A mapped array shares ownership of the mapped file
+ * so the elements stay valid for as long as the array (or any copy of it)
+ * exists. When saved to a boost archive the array is stored exactly like a
+ * std::vector, so classes can switch std::vector members to this type
+ * without changing their archive layout.
+ * \ingroup archive
+ */
+template<typename T>
+class MappableArray
+{
+  // Only arithmetic arrays can be mapped
+  static_assert( std::is_arithmetic<T>::value,
+                 "Only arrays of arithmetic values can be mapped!" );
+
+public:
+
+  //! The value type
+  typedef T value_type;
+
+  //! The size type
+  typedef size_t size_type;
+
+  //! The const iterator type
+  typedef const T* const_iterator;
+
+  //! Default constructor
+  MappableArray();
+
+  //! Vector constructor (the elements are copied)
+  MappableArray( const std::vector<T>& values );
+
+  //! Vector move constructor
+  MappableArray( std::vector<T>&& values );
+
+  //! Mapped constructor
+  MappableArray( const Utility::ArrayView<const T>& mapped_values,
+                 const std::shared_ptr<const void>& mapped_file );
+
+  //! Vector assignment operator
+  MappableArray<T>& operator=( const std::vector<T>& values );
+
+  //! Vector move assignment operator
+  MappableArray<T>& operator=( std::vector<T>&& values );
+
+  //! Destructor
+  ~MappableArray()
+  { /* ... */ }
+
+  //! Check if the elements are a view of a mapped file
+  bool isMapped() const;
+
+  //! Return a view of the elements
+  Utility::ArrayView<const T> view() const;
+
+  //! Return the number of elements
+  size_type size() const;
+
+  //! Check if there are no elements
+  bool empty() const;
+
+  //! Return an iterator to the first element
+  const_iterator begin() const;
+
+  //! Return an iterator to one past the last element
+  const_iterator end() const;
+
+  //! Return the first element
+  const T& front() const;
+
+  //! Return the last element
+  const T& back() const;
+
+  //! Return an element
+  const T& operator[]( const size_type index ) const;
+
+  //! Remove all elements (a mapped file will be released)
+  void clear();
+
+private:
+
+  // Save the array to an archive
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const;
+
+  // Load the array from an archive
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version );
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The owned elements
+  std::vector<T> d_values;
+
+  // The mapped elements
+  Utility::ArrayView<const T> d_mapped_values;
+
+  // The mapped file
+  std::shared_ptr<const void> d_mapped_file;
+};
+
+} // end Utility namespace
+
+namespace boost{
+
+namespace serialization{
+
+/*! \brief The mappable array is serialized like a std::vector of arithmetic
+ * values (no class info is stored)
+ * \ingroup archive
+ */
+template<typename T>
+struct implementation_level<Utility::MappableArray<T> >
+{
+  typedef mpl::integral_c_tag tag;
+  typedef mpl::int_<object_serializable> type;
+  BOOST_STATIC_CONSTANT( int, value = object_serializable );
+};
+
+} // end serialization namespace
+
+} // end boost namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_MappableArray_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_MAPPABLE_ARRAY_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MappableArray.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,212 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_MappableArray_def.hpp
+//! \author Alex Robinson
+//! \brief  Mappable array class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_MAPPABLE_ARRAY_DEF_HPP
+#define UTILITY_MAPPABLE_ARRAY_DEF_HPP
+
+// Boost Includes
+#include <boost/serialization/vector.hpp>
+#include <boost/serialization/serialization.hpp>
+
+// FRENSIE Includes
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Default constructor
+template<typename T>
+MappableArray<T>::MappableArray()
+  : d_values(),
+    d_mapped_values(),
+    d_mapped_file()
+{ /* ... */ }
+
+// Vector constructor (the elements are copied)
+template<typename T>
+MappableArray<T>::MappableArray( const std::vector<T>& values )
+  : d_values( values ),
+    d_mapped_values(),
+    d_mapped_file()
+{ /* ... */ }
+
+// Vector move constructor
+template<typename T>
+MappableArray<T>::MappableArray( std::vector<T>&& values )
+  : d_values( std::move( values ) ),
+    d_mapped_values(),
+    d_mapped_file()
+{ /* ... */ }
+
+// Mapped constructor
+/*! \details The mapped file must own the memory that is viewed by the
+ * mapped values.
+ */
+template<typename T>
+MappableArray<T>::MappableArray(
+                        const Utility::ArrayView<const T>& mapped_values,
+                        const std::shared_ptr<const void>& mapped_file )
+  : d_values(),
+    d_mapped_values( mapped_values ),
+    d_mapped_file( mapped_file )
+{
+  // Make sure that the mapped file is valid
+  testPrecondition( mapped_file.get() );
+}
+
+// Vector assignment operator
+template<typename T>
+MappableArray<T>& MappableArray<T>::operator=( const std::vector<T>& values )
+{
+  d_values = values;
+  d_mapped_values = Utility::ArrayView<const T>();
+  d_mapped_file.reset();
+
+  return *this;
+}
+
+// Vector move assignment operator
+template<typename T>
+MappableArray<T>& MappableArray<T>::operator=( std::vector<T>&& values )
+{
+  d_values = std::move( values );
+  d_mapped_values = Utility::ArrayView<const T>();
+  d_mapped_file.reset();
+
+  return *this;
+}
+
+// Check if the elements are a view of a mapped file
+template<typename T>
+inline bool MappableArray<T>::isMapped() const
+{
+  return d_mapped_file.get() != NULL;
+}
+
+// Return a view of the elements
+template<typename T>
+inline Utility::ArrayView<const T> MappableArray<T>::view() const
+{
+  if( this->isMapped() )
+    return d_mapped_values;
+  else
+    return Utility::ArrayView<const T>( d_values );
+}
+
+// Return the number of elements
+template<typename T>
+inline typename MappableArray<T>::size_type MappableArray<T>::size() const
+{
+  if( this->isMapped() )
+    return d_mapped_values.size();
+  else
+    return d_values.size();
+}
+
+// Check if there are no elements
+template<typename T>
+inline bool MappableArray<T>::empty() const
+{
+  return this->size() == 0;
+}
+
+// Return an iterator to the first element
+template<typename T>
+inline typename MappableArray<T>::const_iterator
+MappableArray<T>::begin() const
+{
+  if( this->isMapped() )
+    return d_mapped_values.begin();
+  else
+    return d_values.data();
+}
+
+// Return an iterator to one past the last element
+template<typename T>
+inline typename MappableArray<T>::const_iterator
+MappableArray<T>::end() const
+{
+  return this->begin() + this->size();
+}
+
+// Return the first element
+template<typename T>
+inline const T& MappableArray<T>::front() const
+{
+  // Make sure that there are elements
+  testPrecondition( !this->empty() );
+
+  return *this->begin();
+}
+
+// Return the last element
+template<typename T>
+inline const T& MappableArray<T>::back() const
+{
+  // Make sure that there are elements
+  testPrecondition( !this->empty() );
+
+  return *(this->end() - 1);
+}
+
+// Return an element
+template<typename T>
+inline const T& MappableArray<T>::operator[]( const size_type index ) const
+{
+  // Make sure that the index is valid
+  testPrecondition( index < this->size() );
+
+  return this->begin()[index];
+}
+
+// Remove all elements (a mapped file will be released)
+template<typename T>
+void MappableArray<T>::clear()
+{
+  d_values.clear();
+  d_mapped_values = Utility::ArrayView<const T>();
+  d_mapped_file.reset();
+}
+
+// Save the array to an archive
+/*! \details The elements are saved with the std::vector serialization
+ * method so that the archive layout is identical to that of a std::vector.
+ */
+template<typename T>
+template<typename Archive>
+void MappableArray<T>::save( Archive& ar, const unsigned version ) const
+{
+  if( this->isMapped() )
+  {
+    std::vector<T> values( d_mapped_values.begin(), d_mapped_values.end() );
+
+    boost::serialization::serialize_adl( ar, values, version );
+  }
+  else
+  {
+    boost::serialization::serialize_adl(
+                    ar, const_cast<std::vector<T>&>( d_values ), version );
+  }
+}
+
+// Load the array from an archive
+template<typename T>
+template<typename Archive>
+void MappableArray<T>::load( Archive& ar, const unsigned version )
+{
+  this->clear();
+
+  boost::serialization::serialize_adl( ar, d_values, version );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_MAPPABLE_ARRAY_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_MappableArray_def.hpp
+//---------------------------------------------------------------------------//
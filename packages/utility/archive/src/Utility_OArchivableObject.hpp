@@ -12,6 +12,7 @@
 // Std Lib Includes
 #include <iostream>
 #include <memory>
+#include <string>
 
 // Boost Includes
 #include <boost/filesystem/path.hpp>
@@ -50,12 +51,19 @@ public:
   void saveToFile( const boost::filesystem::path& archive_name_with_path,
                    const bool overwrite = false ) const;
 
+  //! Archive the object to a stream
+  void saveToStream( std::ostream& os, const std::string& extension ) const;
+
 protected:
 
   //! Archive the object (implementation)
   virtual void saveToFileImpl( const boost::filesystem::path& archive_name_with_path,
                                const bool overwrite ) const;
 
+  //! Archive the object to a stream (implementation)
+  virtual void saveToStreamImpl( std::ostream& os,
+                                 const std::string& extension ) const;
+
   //! Reset the bpos pointer
   template<typename T>
   const boost::archive::detail::basic_pointer_oserializer* resetBposPointer( const std::string& extension ) const;
@@ -25,7 +25,7 @@ namespace Utility{
 
 // Archive the object
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .flat)
  */
 template<typename DerivedType>
 void OArchivableObject<DerivedType>::saveToFile(
@@ -37,7 +37,7 @@ void OArchivableObject<DerivedType>::saveToFile(
 
 // Archive the object (implementation)
 /*! \details The file extension will be used to determine the archive type
- * (e.g. .xml, .txt, .bin, .h5fa)
+ * (e.g. .xml, .txt, .bin, .h5fa, .flat)
  */
 template<typename DerivedType>
 void OArchivableObject<DerivedType>::saveToFileImpl(
@@ -98,6 +98,12 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
 
     boost::archive::binary_oarchive archive( *oarchive_stream );
 
+    this->saveToArchive( archive );
+  }
+  else if( extension == ".flat" )
+  {
+    Utility::FlatOArchive archive( archive_name_with_path );
+
     this->saveToArchive( archive );
   }
 #ifdef HAVE_FRENSIE_HDF5
@@ -118,6 +124,56 @@ void OArchivableObject<DerivedType>::saveToFileImpl(
   }
 }
 
+// Archive the object to a stream
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). HDF5 and flat archives can only be written to a
+ * file.
+ */
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToStream(
+                                         std::ostream& os,
+                                         const std::string& extension ) const
+{
+  this->saveToStreamImpl( os, extension );
+}
+
+// Archive the object to a stream (implementation)
+/*! \details The extension will be used to determine the archive type
+ * (e.g. .xml, .txt, .bin). HDF5 and flat archives can only be written to a
+ * file.
+ */
+template<typename DerivedType>
+void OArchivableObject<DerivedType>::saveToStreamImpl(
+                                         std::ostream& os,
+                                         const std::string& extension ) const
+{
+  if( extension == ".xml" )
+  {
+    boost::archive::xml_oarchive archive( os );
+
+    this->saveToArchive( archive );
+  }
+  else if( extension == ".txt" )
+  {
+    boost::archive::text_oarchive archive( os );
+
+    this->saveToArchive( archive );
+  }
+  else if( extension == ".bin" )
+  {
+    boost::archive::binary_oarchive archive( os );
+
+    this->saveToArchive( archive );
+  }
+  else
+  {
+    THROW_EXCEPTION( std::runtime_error,
+                     "Cannot create the output archive stream because the "
+                     "extension type (" << extension << ") is not "
+                     "supported!" );
+  }
+}
+
 // Reset the bpos pointer
 template<typename DerivedType>
 template<typename T>
@@ -152,6 +208,11 @@ const boost::archive::detail::basic_pointer_oserializer* OArchivableObject<Deriv
       boost::serialization::singleton<boost::archive::detail::oserializer<boost::archive::binary_oarchive, T > >::get_mutable_instance().set_bpos( NULL );
     }
   }
+  else if( extension == ".flat" )
+  {
+    // The flat archive does not use the boost serializers
+    bpos = NULL;
+  }
 #ifdef HAVE_FRENSIE_HDF5
   else if( extension == ".h5fa" )
   {
@@ -0,0 +1,467 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstFlatArchive.cpp
+//! \author Alex Robinson
+//! \brief  Flat archive unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <sstream>
+
+// Boost Includes
+#include <boost/serialization/split_member.hpp>
+#include <boost/serialization/version.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/archive/xml_oarchive.hpp>
+#include <boost/archive/xml_iarchive.hpp>
+
+// FRENSIE Includes
+#include "Utility_FlatOArchive.hpp"
+#include "Utility_FlatIArchive.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_Set.hpp"
+#include "Utility_Map.hpp"
+#include "Utility_Tuple.hpp"
+#include "Utility_ArrayView.hpp"
+#include "Utility_MappableArray.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Classes
+//---------------------------------------------------------------------------//
+class TestMemberClass
+{
+public:
+
+  std::string d_name;
+  std::vector<std::vector<double> > d_table;
+
+private:
+
+  friend class boost::serialization::access;
+
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & boost::serialization::make_nvp( "name", d_name );
+    ar & boost::serialization::make_nvp( "table", d_table );
+  }
+};
+
+class TestClass
+{
+public:
+
+  unsigned d_atomic_number;
+  double d_atomic_weight;
+  bool d_flag;
+  std::string d_notes;
+  std::set<unsigned> d_subshells;
+  std::vector<double> d_energy_grid;
+  std::map<unsigned,double> d_occupancies;
+  std::map<unsigned,std::vector<double> > d_cross_sections;
+  std::map<unsigned,std::map<double,std::vector<double> > > d_distributions;
+  std::map<unsigned,std::vector<std::pair<unsigned,unsigned> > > d_vacancies;
+  TestMemberClass d_member;
+
+private:
+
+  friend class boost::serialization::access;
+
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    ar & boost::serialization::make_nvp( "atomic_number", d_atomic_number );
+    ar & boost::serialization::make_nvp( "atomic_weight", d_atomic_weight );
+    ar & boost::serialization::make_nvp( "flag", d_flag );
+    ar & boost::serialization::make_nvp( "notes", d_notes );
+    ar & boost::serialization::make_nvp( "subshells", d_subshells );
+    ar & boost::serialization::make_nvp( "energy_grid", d_energy_grid );
+    ar & boost::serialization::make_nvp( "occupancies", d_occupancies );
+    ar & boost::serialization::make_nvp( "cross_sections", d_cross_sections );
+    ar & boost::serialization::make_nvp( "distributions", d_distributions );
+    ar & boost::serialization::make_nvp( "vacancies", d_vacancies );
+    ar & boost::serialization::make_nvp( "member", d_member );
+  }
+
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version )
+  {
+    ar & boost::serialization::make_nvp( "atomic_number", d_atomic_number );
+    ar & boost::serialization::make_nvp( "atomic_weight", d_atomic_weight );
+    ar & boost::serialization::make_nvp( "flag", d_flag );
+    ar & boost::serialization::make_nvp( "notes", d_notes );
+    ar & boost::serialization::make_nvp( "subshells", d_subshells );
+    ar & boost::serialization::make_nvp( "energy_grid", d_energy_grid );
+    ar & boost::serialization::make_nvp( "occupancies", d_occupancies );
+    ar & boost::serialization::make_nvp( "cross_sections", d_cross_sections );
+    ar & boost::serialization::make_nvp( "distributions", d_distributions );
+    ar & boost::serialization::make_nvp( "vacancies", d_vacancies );
+    ar & boost::serialization::make_nvp( "member", d_member );
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+};
+
+BOOST_CLASS_VERSION( TestClass, 2 );
+
+class TestViewClass
+{
+public:
+
+  Utility::ArrayView<const double> d_energy_grid;
+  Utility::ArrayView<const double> d_cross_section;
+  std::vector<unsigned> d_reactions;
+
+private:
+
+  friend class boost::serialization::access;
+
+  template<typename Archive>
+  void save( Archive& ar, const unsigned version ) const
+  {
+    ar & boost::serialization::make_nvp( "energy_grid", d_energy_grid );
+    ar & boost::serialization::make_nvp( "cross_section", d_cross_section );
+    ar & boost::serialization::make_nvp( "reactions", d_reactions );
+  }
+
+  template<typename Archive>
+  void load( Archive& ar, const unsigned version )
+  {
+    ar & boost::serialization::make_nvp( "energy_grid", d_energy_grid );
+
+    d_cross_section = ar.template getArrayView<double>( "cross_section" );
+
+    ar & boost::serialization::make_nvp( "reactions", d_reactions );
+  }
+
+  BOOST_SERIALIZATION_SPLIT_MEMBER();
+};
+
+template<typename Array>
+class TestArrayClass
+{
+public:
+
+  Array d_energy_grid;
+  std::vector<unsigned> d_reactions;
+
+private:
+
+  friend class boost::serialization::access;
+
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & boost::serialization::make_nvp( "energy_grid", d_energy_grid );
+    ar & boost::serialization::make_nvp( "reactions", d_reactions );
+  }
+};
+
+typedef TestArrayClass<Utility::MappableArray<double> > TestMappableClass;
+typedef TestArrayClass<std::vector<double> > TestVectorClass;
+
+//---------------------------------------------------------------------------//
+// Testing Functions
+//---------------------------------------------------------------------------//
+// Create a test object
+TestClass createTestObject()
+{
+  TestClass object;
+
+  object.d_atomic_number = 82u;
+  object.d_atomic_weight = 207.2;
+  object.d_flag = true;
+  object.d_notes = "test notes";
+  object.d_subshells = {1u, 3u, 5u};
+  object.d_energy_grid = {1e-5, 1e-3, 1.0, 20.0};
+  object.d_occupancies = {{1u, 2.0}, {3u, 2.0}, {5u, 4.0}};
+  object.d_cross_sections[1u] = {1.0, 2.0, 3.0};
+  object.d_cross_sections[3u] = {4.0};
+  object.d_distributions[1u][1e-5] = {-1.0, 0.0, 1.0};
+  object.d_distributions[1u][20.0] = {-1.0, 1.0};
+  object.d_distributions[3u][1.0] = {0.5};
+  object.d_vacancies[1u] = {std::make_pair( 3u, 5u ), std::make_pair( 5u, 5u )};
+  object.d_vacancies[3u] = {};
+  object.d_member.d_name = "member";
+  object.d_member.d_table = {{1.0, 2.0}, {}, {3.0}};
+
+  return object;
+}
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that an object can be saved to and loaded from a flat archive
+FRENSIE_UNIT_TEST( FlatArchive, save_load )
+{
+  const std::string archive_name( "test_flat_archive.flat" );
+
+  const TestClass saved_object = createTestObject();
+
+  {
+    Utility::FlatOArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive << boost::serialization::make_nvp( "test_object", saved_object ) );
+
+    // Only a single object can be saved
+    FRENSIE_CHECK_THROW( archive << boost::serialization::make_nvp( "test_object", saved_object ),
+                         std::runtime_error );
+  }
+
+  TestClass loaded_object;
+
+  {
+    Utility::FlatIArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive >> boost::serialization::make_nvp( "test_object", loaded_object ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( loaded_object.d_atomic_number, 82u );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_atomic_weight, 207.2 );
+  FRENSIE_CHECK( loaded_object.d_flag );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_notes, "test notes" );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_subshells, saved_object.d_subshells );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_energy_grid,
+                       saved_object.d_energy_grid );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_occupancies,
+                       saved_object.d_occupancies );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_cross_sections,
+                       saved_object.d_cross_sections );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_distributions,
+                       saved_object.d_distributions );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_vacancies,
+                       saved_object.d_vacancies );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_member.d_name, "member" );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_member.d_table,
+                       saved_object.d_member.d_table );
+
+  // An object of the wrong type cannot be loaded
+  TestMemberClass member_object;
+
+  {
+    Utility::FlatIArchive archive( archive_name );
+
+    FRENSIE_CHECK_THROW( archive >> boost::serialization::make_nvp( "test_object", member_object ),
+                         std::runtime_error );
+  }
+
+  boost::filesystem::remove( archive_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that array views can be saved to and loaded from a flat archive
+FRENSIE_UNIT_TEST( FlatArchive, save_load_views )
+{
+  const std::string archive_name( "test_flat_archive_views.flat" );
+
+  const std::vector<double> energy_grid( {1e-5, 1e-3, 1.0, 20.0} );
+  const std::vector<double> cross_section( {4.0, 3.0, 2.0, 1.0} );
+
+  {
+    TestViewClass saved_object;
+    saved_object.d_energy_grid = Utility::arrayViewOfConst( energy_grid );
+    saved_object.d_cross_section = Utility::arrayViewOfConst( cross_section );
+    saved_object.d_reactions = {2u, 102u};
+
+    Utility::FlatOArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive << boost::serialization::make_nvp( "test_object", saved_object ) );
+  }
+
+  TestViewClass loaded_object;
+  std::shared_ptr<const Utility::FlatArchiveFile> archive_file;
+
+  {
+    Utility::FlatIArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive >> boost::serialization::make_nvp( "test_object", loaded_object ) );
+
+    archive_file = archive.getSharedFile();
+
+    // The views point into the mapped file
+    FRENSIE_CHECK_EQUAL( loaded_object.d_energy_grid.data(),
+                         archive.getFile().getEntry<double>( "test_object/energy_grid" ).data() );
+    FRENSIE_CHECK_EQUAL( loaded_object.d_cross_section.data(),
+                         archive.getFile().getEntry<double>( "test_object/cross_section" ).data() );
+  }
+
+  // The views remain valid as long as the shared file exists
+  FRENSIE_REQUIRE( archive_file.get() != NULL );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_energy_grid,
+                       Utility::arrayViewOfConst( energy_grid ) );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_cross_section,
+                       Utility::arrayViewOfConst( cross_section ) );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_reactions,
+                       std::vector<unsigned>( {2u, 102u} ) );
+
+  // The element type must match
+  Utility::ArrayView<const float> float_view;
+
+  {
+    Utility::FlatIArchive archive( archive_name );
+
+    FRENSIE_CHECK_THROW( archive >> boost::serialization::make_nvp( "test_object/energy_grid", float_view ),
+                         std::runtime_error );
+  }
+
+  archive_file.reset();
+
+  boost::filesystem::remove( archive_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that mappable arrays view the mapped file when loaded from a flat
+// archive
+FRENSIE_UNIT_TEST( FlatArchive, save_load_mappable_arrays )
+{
+  const std::string archive_name( "test_flat_archive_mappable.flat" );
+
+  const std::vector<double> energy_grid( {1e-5, 1e-3, 1.0, 20.0} );
+
+  {
+    TestMappableClass saved_object;
+    saved_object.d_energy_grid = energy_grid;
+    saved_object.d_reactions = {2u, 102u};
+
+    FRENSIE_CHECK( !saved_object.d_energy_grid.isMapped() );
+
+    Utility::FlatOArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive << boost::serialization::make_nvp( "test_object", saved_object ) );
+  }
+
+  TestMappableClass loaded_object;
+
+  {
+    Utility::FlatIArchive archive( archive_name );
+
+    FRENSIE_REQUIRE_NO_THROW( archive >> boost::serialization::make_nvp( "test_object", loaded_object ) );
+
+    // The array points into the mapped file
+    FRENSIE_CHECK( loaded_object.d_energy_grid.isMapped() );
+    FRENSIE_CHECK_EQUAL( loaded_object.d_energy_grid.begin(),
+                         archive.getFile().getEntry<double>( "test_object/energy_grid" ).data() );
+  }
+
+  // The array keeps the mapped file alive
+  TestMappableClass copied_object( loaded_object );
+
+  loaded_object.d_energy_grid.clear();
+
+  FRENSIE_CHECK( !loaded_object.d_energy_grid.isMapped() );
+  FRENSIE_CHECK( loaded_object.d_energy_grid.empty() );
+  FRENSIE_CHECK( copied_object.d_energy_grid.isMapped() );
+  FRENSIE_REQUIRE_EQUAL( copied_object.d_energy_grid.size(), 4 );
+  FRENSIE_CHECK_EQUAL( copied_object.d_energy_grid.front(), 1e-5 );
+  FRENSIE_CHECK_EQUAL( copied_object.d_energy_grid[2], 1.0 );
+  FRENSIE_CHECK_EQUAL( copied_object.d_energy_grid.back(), 20.0 );
+  FRENSIE_CHECK_EQUAL( copied_object.d_energy_grid.view(),
+                       Utility::arrayViewOfConst( energy_grid ) );
+
+  // A mapped array is saved to other archives like a std::vector
+  std::ostringstream oss;
+
+  {
+    boost::archive::xml_oarchive archive( oss );
+
+    archive << boost::serialization::make_nvp( "test_object", copied_object );
+  }
+
+  TestVectorClass vector_object;
+
+  {
+    std::istringstream iss( oss.str() );
+
+    boost::archive::xml_iarchive archive( iss );
+
+    FRENSIE_REQUIRE_NO_THROW( archive >> boost::serialization::make_nvp( "test_object", vector_object ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( vector_object.d_energy_grid, energy_grid );
+  FRENSIE_CHECK_EQUAL( vector_object.d_reactions,
+                       std::vector<unsigned>( {2u, 102u} ) );
+
+  // A std::vector can be loaded into a mappable array from other archives
+  {
+    std::istringstream iss( oss.str() );
+
+    boost::archive::xml_iarchive archive( iss );
+
+    FRENSIE_REQUIRE_NO_THROW( archive >> boost::serialization::make_nvp( "test_object", loaded_object ) );
+  }
+
+  FRENSIE_CHECK( !loaded_object.d_energy_grid.isMapped() );
+  FRENSIE_CHECK_EQUAL( loaded_object.d_energy_grid.view(),
+                       Utility::arrayViewOfConst( energy_grid ) );
+
+  copied_object.d_energy_grid.clear();
+
+  boost::filesystem::remove( archive_name );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the entries of a flat archive file can be viewed
+FRENSIE_UNIT_TEST( FlatArchiveFile, getEntry )
+{
+  const std::string archive_name( "test_flat_archive_file.flat" );
+
+  {
+    Utility::FlatOArchive archive( archive_name );
+
+    const TestClass saved_object = createTestObject();
+
+    archive << boost::serialization::make_nvp( "test_object", saved_object );
+  }
+
+  FRENSIE_CHECK( Utility::FlatArchiveFile::isFlatArchiveFile( archive_name ) );
+
+  Utility::FlatArchiveFile archive_file( archive_name );
+
+  FRENSIE_CHECK_EQUAL( archive_file.getFileName().string(), archive_name );
+  FRENSIE_CHECK( archive_file.doesEntryExist( "test_object/energy_grid" ) );
+  FRENSIE_CHECK( !archive_file.doesEntryExist( "test_object/energy" ) );
+
+  // The entries are sorted by name
+  for( size_t i = 1; i < archive_file.getNumberOfEntries(); ++i )
+  {
+    FRENSIE_CHECK_LESS( archive_file.getEntryName( i-1 ),
+                        archive_file.getEntryName( i ) );
+  }
+
+  FRENSIE_CHECK_EQUAL( archive_file.getEntryValue<unsigned>( "test_object@version" ), 2u );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntryValue<unsigned>( "test_object/atomic_number" ), 82u );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntryString( "test_object/notes" ),
+                       "test notes" );
+
+  Utility::ArrayView<const double> energy_grid =
+    archive_file.getEntry<double>( "test_object/energy_grid" );
+
+  FRENSIE_CHECK_EQUAL( energy_grid.size(), 4 );
+  FRENSIE_CHECK_EQUAL( energy_grid[0], 1e-5 );
+  FRENSIE_CHECK_EQUAL( energy_grid[3], 20.0 );
+  FRENSIE_CHECK_EQUAL( (uintptr_t)energy_grid.data() %
+                       Utility::FlatArchiveFile::s_data_alignment, 0 );
+
+  FRENSIE_CHECK_EQUAL( archive_file.getEntrySize( "test_object/subshells" ), 3 );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntry<unsigned>( "test_object/occupancies/keys" )[2], 5u );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntry<double>( "test_object/occupancies/values" )[2], 4.0 );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntry<double>( "test_object/cross_sections/values/0" )[2], 3.0 );
+  FRENSIE_CHECK_EQUAL( archive_file.getEntry<unsigned>( "test_object/vacancies/values/0/first" )[1], 5u );
+
+  // The element type must match
+  FRENSIE_CHECK_THROW( archive_file.getEntry<float>( "test_object/energy_grid" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( archive_file.getEntry<double>( "test_object/energy" ),
+                       std::runtime_error );
+  FRENSIE_CHECK_THROW( archive_file.getEntryValue<double>( "test_object/energy_grid" ),
+                       std::runtime_error );
+
+  boost::filesystem::remove( archive_name );
+}
+
+//---------------------------------------------------------------------------//
+// end tstFlatArchive.cpp
+//---------------------------------------------------------------------------//
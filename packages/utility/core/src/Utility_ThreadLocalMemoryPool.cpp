@@ -0,0 +1,236 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ThreadLocalMemoryPool.cpp
+//! \author Alex Robinson
+//! \brief  Thread-local small object memory pool definition
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <new>
+
+// FRENSIE Includes
+#include "Utility_ThreadLocalMemoryPool.hpp"
+
+namespace Utility{
+
+namespace{
+
+// The block alignment (all block sizes are rounded up to this value)
+const size_t s_block_alignment = 16;
+
+// The max block size that will be pooled
+const size_t s_max_pooled_block_size = 1024;
+
+// The number of size classes
+const size_t s_number_of_size_classes =
+  s_max_pooled_block_size/s_block_alignment;
+
+// The max number of blocks that a thread will cache per size class
+const size_t s_max_cached_blocks_per_size_class = 4096;
+
+// A cached block (the link is stored in the block memory itself)
+struct CachedBlock
+{
+  CachedBlock* next;
+};
+
+// Check if the thread cache has been destroyed
+thread_local bool t_thread_cache_destroyed = false;
+
+/*! The thread cache
+ *
+ * The cache stores a singly linked free list for each size class.
+ */
+class ThreadCache
+{
+
+public:
+
+  //! Constructor
+  ThreadCache()
+    : d_free_lists(),
+      d_number_of_cached_blocks()
+  {
+    for( size_t i = 0; i < s_number_of_size_classes; ++i )
+    {
+      d_free_lists[i] = nullptr;
+      d_number_of_cached_blocks[i] = 0;
+    }
+  }
+
+  //! Destructor
+  ~ThreadCache()
+  {
+    this->releaseCachedBlocks();
+
+    t_thread_cache_destroyed = true;
+  }
+
+  //! Pop a cached block (nullptr if none are cached)
+  void* pop( const size_t size_class )
+  {
+    CachedBlock* block = d_free_lists[size_class];
+
+    if( block )
+    {
+      d_free_lists[size_class] = block->next;
+      --d_number_of_cached_blocks[size_class];
+    }
+
+    return block;
+  }
+
+  //! Push a block (false if the cache for the size class is full)
+  bool push( void* raw_block, const size_t size_class )
+  {
+    if( d_number_of_cached_blocks[size_class] >=
+        s_max_cached_blocks_per_size_class )
+      return false;
+
+    CachedBlock* block = static_cast<CachedBlock*>( raw_block );
+
+    block->next = d_free_lists[size_class];
+    d_free_lists[size_class] = block;
+    ++d_number_of_cached_blocks[size_class];
+
+    return true;
+  }
+
+  //! Get the number of cached blocks
+  size_t getNumberOfCachedBlocks() const
+  {
+    size_t number_of_cached_blocks = 0;
+
+    for( size_t i = 0; i < s_number_of_size_classes; ++i )
+      number_of_cached_blocks += d_number_of_cached_blocks[i];
+
+    return number_of_cached_blocks;
+  }
+
+  //! Release all cached blocks to the global heap
+  void releaseCachedBlocks()
+  {
+    for( size_t i = 0; i < s_number_of_size_classes; ++i )
+    {
+      while( d_free_lists[i] )
+      {
+        CachedBlock* block = d_free_lists[i];
+        d_free_lists[i] = block->next;
+
+        ::operator delete( block );
+      }
+
+      d_number_of_cached_blocks[i] = 0;
+    }
+  }
+
+private:
+
+  // The free list for each size class
+  CachedBlock* d_free_lists[s_number_of_size_classes];
+
+  // The number of cached blocks in each size class
+  size_t d_number_of_cached_blocks[s_number_of_size_classes];
+};
+
+// Get the thread cache (nullptr if it has already been destroyed)
+inline ThreadCache* getThreadCache()
+{
+  if( t_thread_cache_destroyed )
+    return nullptr;
+
+  thread_local ThreadCache thread_cache;
+
+  return &thread_cache;
+}
+
+// Get the size class of a block
+inline size_t getSizeClass( const size_t size )
+{
+  if( size == 0 )
+    return 0;
+  else
+    return (size - 1)/s_block_alignment;
+}
+
+} // end local namespace
+
+// Allocate a block of memory
+/*! \details Blocks that belong to the same size class are interchangeable,
+ * which is why the size must also be passed to the deallocate method.
+ */
+void* ThreadLocalMemoryPool::allocate( const size_t size )
+{
+  if( size > s_max_pooled_block_size )
+    return ::operator new( size );
+
+  const size_t size_class = getSizeClass( size );
+
+  ThreadCache* thread_cache = getThreadCache();
+
+  if( thread_cache )
+  {
+    void* block = thread_cache->pop( size_class );
+
+    if( block )
+      return block;
+  }
+
+  return ::operator new( (size_class+1)*s_block_alignment );
+}
+
+// Deallocate a block of memory
+/*! \details The size must be the same as the size that was used to
+ * allocate the block.
+ */
+void ThreadLocalMemoryPool::deallocate( void* block, const size_t size ) noexcept
+{
+  if( !block )
+    return;
+
+  if( size <= s_max_pooled_block_size )
+  {
+    ThreadCache* thread_cache = getThreadCache();
+
+    if( thread_cache )
+    {
+      if( thread_cache->push( block, getSizeClass( size ) ) )
+        return;
+    }
+  }
+
+  ::operator delete( block );
+}
+
+// Get the max block size that will be pooled
+size_t ThreadLocalMemoryPool::getMaxPooledBlockSize()
+{
+  return s_max_pooled_block_size;
+}
+
+// Get the number of blocks cached by the calling thread
+size_t ThreadLocalMemoryPool::getNumberOfCachedBlocks()
+{
+  ThreadCache* thread_cache = getThreadCache();
+
+  if( thread_cache )
+    return thread_cache->getNumberOfCachedBlocks();
+  else
+    return 0;
+}
+
+// Release all blocks cached by the calling thread to the global heap
+void ThreadLocalMemoryPool::releaseCachedBlocks()
+{
+  ThreadCache* thread_cache = getThreadCache();
+
+  if( thread_cache )
+    thread_cache->releaseCachedBlocks();
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_ThreadLocalMemoryPool.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,100 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_ThreadLocalMemoryPool.hpp
+//! \author Alex Robinson
+//! \brief  Thread-local small object memory pool declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+#define UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+
+// Std Lib Includes
+#include <cstddef>
+
+namespace Utility{
+
+/*! The thread-local small object memory pool
+ *
+ * Small blocks are grouped into size classes. When a block is deallocated
+ * it is cached in a free list owned by the calling thread instead of being
+ * returned to the global heap. Later allocations of the same size class on
+ * that thread reuse the cached blocks, so short-lived objects that are
+ * created and destroyed at a high rate do not contend on the global heap.
+ * A block can be deallocated on a different thread from the one that
+ * allocated it. Blocks that are larger than the max pooled block size are
+ * passed straight through to the global heap. All blocks cached by a thread
+ * are released when the thread exits.
+ */
+class ThreadLocalMemoryPool
+{
+
+public:
+
+  //! Allocate a block of memory
+  static void* allocate( const size_t size );
+
+  //! Deallocate a block of memory
+  static void deallocate( void* block, const size_t size ) noexcept;
+
+  //! Get the max block size that will be pooled
+  static size_t getMaxPooledBlockSize();
+
+  //! Get the number of blocks cached by the calling thread
+  static size_t getNumberOfCachedBlocks();
+
+  //! Release all blocks cached by the calling thread to the global heap
+  static void releaseCachedBlocks();
+};
+
+/*! The thread-local memory pool allocator
+ *
+ * This allocator satisfies the standard allocator requirements so it can
+ * be used with standard containers and std::allocate_shared.
+ */
+template<typename T>
+class ThreadLocalMemoryPoolAllocator
+{
+
+public:
+
+  //! The value type
+  typedef T value_type;
+
+  //! Default constructor
+  ThreadLocalMemoryPoolAllocator() noexcept
+  { /* ... */ }
+
+  //! Copy constructor
+  template<typename U>
+  ThreadLocalMemoryPoolAllocator( const ThreadLocalMemoryPoolAllocator<U>& ) noexcept
+  { /* ... */ }
+
+  //! Allocate memory for n objects
+  T* allocate( const size_t n )
+  { return static_cast<T*>( ThreadLocalMemoryPool::allocate( n*sizeof(T) ) ); }
+
+  //! Deallocate memory for n objects
+  void deallocate( T* block, const size_t n ) noexcept
+  { ThreadLocalMemoryPool::deallocate( block, n*sizeof(T) ); }
+};
+
+//! Check if two thread-local memory pool allocators are equal (always true)
+template<typename T, typename U>
+inline bool operator==( const ThreadLocalMemoryPoolAllocator<T>&,
+                        const ThreadLocalMemoryPoolAllocator<U>& )
+{ return true; }
+
+//! Check if two thread-local memory pool allocators are not equal
+template<typename T, typename U>
+inline bool operator!=( const ThreadLocalMemoryPoolAllocator<T>&,
+                        const ThreadLocalMemoryPoolAllocator<U>& )
+{ return false; }
+
+} // end Utility namespace
+
+#endif // end UTILITY_THREAD_LOCAL_MEMORY_POOL_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_ThreadLocalMemoryPool.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,132 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstThreadLocalMemoryPool.cpp
+//! \author Alex Robinson
+//! \brief  Thread-local memory pool unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <thread>
+
+// Boost Includes
+#define BOOST_TEST_MAIN
+#include <boost/test/unit_test.hpp>
+
+// FRENSIE Includes
+#include "Utility_ThreadLocalMemoryPool.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that deallocated blocks are cached and reused
+BOOST_AUTO_TEST_CASE( allocate_deallocate )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+
+  void* block = Utility::ThreadLocalMemoryPool::allocate( 40 );
+
+  BOOST_REQUIRE( block != nullptr );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block, 40 );
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  // A block from the same size class should be reused
+  void* reused_block = Utility::ThreadLocalMemoryPool::allocate( 48 );
+
+  BOOST_CHECK_EQUAL( reused_block, block );
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( reused_block, 48 );
+
+  // A block from a different size class should not be reused
+  void* other_block = Utility::ThreadLocalMemoryPool::allocate( 100 );
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  Utility::ThreadLocalMemoryPool::deallocate( other_block, 100 );
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 2 );
+
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that large blocks are not cached
+BOOST_AUTO_TEST_CASE( allocate_deallocate_large )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  const size_t size =
+    Utility::ThreadLocalMemoryPool::getMaxPooledBlockSize() + 1;
+
+  void* block = Utility::ThreadLocalMemoryPool::allocate( size );
+
+  BOOST_REQUIRE( block != nullptr );
+
+  Utility::ThreadLocalMemoryPool::deallocate( block, size );
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that each thread has its own cache
+BOOST_AUTO_TEST_CASE( thread_caches )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  void* block = Utility::ThreadLocalMemoryPool::allocate( 64 );
+
+  size_t other_thread_cached_blocks = 1;
+
+  // Deallocating on another thread caches the block in the other thread
+  std::thread other_thread( [block, &other_thread_cached_blocks](){
+      Utility::ThreadLocalMemoryPool::deallocate( block, 64 );
+
+      other_thread_cached_blocks =
+        Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks();
+    } );
+
+  other_thread.join();
+
+  BOOST_CHECK_EQUAL( other_thread_cached_blocks, 1 );
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 0 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the allocator can be used with standard containers
+BOOST_AUTO_TEST_CASE( allocator )
+{
+  Utility::ThreadLocalMemoryPool::releaseCachedBlocks();
+
+  {
+    std::vector<double,Utility::ThreadLocalMemoryPoolAllocator<double> >
+      values( {1.0, 2.0, 3.0} );
+
+    BOOST_CHECK_EQUAL( values.size(), 3 );
+    BOOST_CHECK_EQUAL( values[2], 3.0 );
+  }
+
+  BOOST_CHECK_EQUAL( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks(), 1 );
+
+  {
+    std::shared_ptr<double> value =
+      std::allocate_shared<double>( Utility::ThreadLocalMemoryPoolAllocator<double>(), 2.0 );
+
+    BOOST_CHECK_EQUAL( *value, 2.0 );
+  }
+
+  BOOST_CHECK( Utility::ThreadLocalMemoryPool::getNumberOfCachedBlocks() >= 1 );
+}
+
+//---------------------------------------------------------------------------//
+// end tstThreadLocalMemoryPool.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,114 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_AliasTable.cpp
+//! \author Alex Robinson
+//! \brief  Alias table (Walker's alias method) class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // This must be included first
+#include "Utility_AliasTable.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Default constructor (empty table)
+AliasTable::AliasTable()
+{ /* ... */ }
+
+// Constructor (the weights do not need to be normalized)
+/*! \details The table is constructed using Vose's algorithm, which is
+ * numerically stable and requires O(N) operations.
+ */
+AliasTable::AliasTable( const Utility::ArrayView<const double>& weights )
+  : d_cutoffs( weights.size() ),
+    d_aliases( weights.size() )
+{
+  TEST_FOR_EXCEPTION( weights.size() == 0,
+                      std::runtime_error,
+                      "An alias table cannot be constructed from an empty "
+                      "set of weights!" );
+
+  double weight_sum = 0.0;
+
+  for( size_t i = 0; i < weights.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( weights[i] < 0.0,
+                        std::runtime_error,
+                        "An alias table cannot be constructed from a "
+                        "negative weight (" << weights[i] << ")!" );
+
+    weight_sum += weights[i];
+  }
+
+  TEST_FOR_EXCEPTION( !(weight_sum > 0.0),
+                      std::runtime_error,
+                      "An alias table cannot be constructed from a set of "
+                      "weights with a non-positive sum!" );
+
+  const size_t size = weights.size();
+
+  // Scale the weights so that the average scaled weight is one
+  std::vector<size_t> small_indices, large_indices;
+  small_indices.reserve( size );
+  large_indices.reserve( size );
+
+  for( size_t i = 0; i < size; ++i )
+  {
+    d_cutoffs[i] = weights[i]*size/weight_sum;
+    d_aliases[i] = i;
+
+    if( d_cutoffs[i] < 1.0 )
+      small_indices.push_back( i );
+    else
+      large_indices.push_back( i );
+  }
+
+  // Pair each under-full column with an over-full column
+  while( !small_indices.empty() && !large_indices.empty() )
+  {
+    const size_t small_index = small_indices.back();
+    small_indices.pop_back();
+
+    const size_t large_index = large_indices.back();
+
+    d_aliases[small_index] = large_index;
+
+    d_cutoffs[large_index] -= 1.0 - d_cutoffs[small_index];
+
+    if( d_cutoffs[large_index] < 1.0 )
+    {
+      large_indices.pop_back();
+      small_indices.push_back( large_index );
+    }
+  }
+
+  // Any remaining columns are full (up to round-off)
+  for( size_t i = 0; i < large_indices.size(); ++i )
+    d_cutoffs[large_indices[i]] = 1.0;
+
+  for( size_t i = 0; i < small_indices.size(); ++i )
+    d_cutoffs[small_indices[i]] = 1.0;
+}
+
+// Equality comparison operator
+bool AliasTable::operator==( const AliasTable& other ) const
+{
+  return d_cutoffs == other.d_cutoffs && d_aliases == other.d_aliases;
+}
+
+// Inequality comparison operator
+bool AliasTable::operator!=( const AliasTable& other ) const
+{
+  return !(*this == other);
+}
+
+} // end Utility namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( Utility::AliasTable );
+
+//---------------------------------------------------------------------------//
+// end Utility_AliasTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,161 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_AliasTable.hpp
+//! \author Alex Robinson
+//! \brief  Alias table (Walker's alias method) class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_ALIAS_TABLE_HPP
+#define UTILITY_ALIAS_TABLE_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Boost Includes
+#include <boost/serialization/version.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+/*! The alias table
+ *
+ * An alias table allows an index to be sampled from a discrete set of
+ * weights in constant time using Walker's alias method (as constructed by
+ * Vose). The table data is stored as a structure of arrays (the cutoffs and
+ * the aliases) so that a sample only touches two contiguous arrays.
+ * \ingroup univariate_distributions
+ */
+class AliasTable
+{
+
+public:
+
+  //! Default constructor (empty table)
+  AliasTable();
+
+  //! Constructor (the weights do not need to be normalized)
+  AliasTable( const Utility::ArrayView<const double>& weights );
+
+  //! Destructor
+  ~AliasTable()
+  { /* ... */ }
+
+  //! Return the number of entries in the table
+  size_t size() const;
+
+  //! Check if the table is empty
+  bool empty() const;
+
+  //! Sample an index from the table using a random number in [0,1]
+  size_t sampleIndex( const double random_number ) const;
+
+  //! Sample an index and return the residual random number in [0,1)
+  size_t sampleIndex( const double random_number,
+                      double& residual_random_number ) const;
+
+  //! Equality comparison operator
+  bool operator==( const AliasTable& other ) const;
+
+  //! Inequality comparison operator
+  bool operator!=( const AliasTable& other ) const;
+
+private:
+
+  // Serialize the table data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_cutoffs );
+    ar & BOOST_SERIALIZATION_NVP( d_aliases );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The probability of keeping each index (instead of its alias)
+  std::vector<double> d_cutoffs;
+
+  // The alias of each index
+  std::vector<unsigned long long> d_aliases;
+};
+
+// Return the number of entries in the table
+inline size_t AliasTable::size() const
+{
+  return d_cutoffs.size();
+}
+
+// Check if the table is empty
+inline bool AliasTable::empty() const
+{
+  return d_cutoffs.empty();
+}
+
+// Sample an index from the table using a random number in [0,1]
+inline size_t AliasTable::sampleIndex( const double random_number ) const
+{
+  double residual_random_number;
+
+  return this->sampleIndex( random_number, residual_random_number );
+}
+
+// Sample an index and return the residual random number in [0,1)
+/*! \details The integer part of random_number*size() selects a column of the
+ * table and the fractional part decides between the column index and its
+ * alias. The residual random number is the fractional part rescaled to
+ * [0,1) given the decision that was made. It is independent of the sampled
+ * index so it can be used to sample within the sampled bin.
+ */
+inline size_t AliasTable::sampleIndex( const double random_number,
+                                       double& residual_random_number ) const
+{
+  // Make sure the table is valid
+  testPrecondition( !this->empty() );
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const double scaled_random_number = random_number*d_cutoffs.size();
+
+  size_t index = (size_t)scaled_random_number;
+
+  if( index >= d_cutoffs.size() )
+    index = d_cutoffs.size() - 1;
+
+  const double column_random_number = scaled_random_number - index;
+  const double cutoff = d_cutoffs[index];
+
+  if( column_random_number < cutoff )
+  {
+    residual_random_number = column_random_number/cutoff;
+
+    return index;
+  }
+  else
+  {
+    residual_random_number = (column_random_number - cutoff)/(1.0 - cutoff);
+
+    if( residual_random_number >= 1.0 )
+      residual_random_number = 0.0;
+
+    return d_aliases[index];
+  }
+}
+
+} // end Utility namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( AliasTable, Utility, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( Utility, AliasTable );
+
+#endif // end UTILITY_ALIAS_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_AliasTable.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,88 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CDFGuideTable.cpp
+//! \author Alex Robinson
+//! \brief  CDF guide table class definition
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "FRENSIE_Archives.hpp" // This must be included first
+#include "Utility_CDFGuideTable.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Default constructor (empty table)
+CDFGuideTable::CDFGuideTable()
+  : d_cdf(),
+    d_guide(),
+    d_slots_per_cdf_unit( 0.0 )
+{ /* ... */ }
+
+// Constructor
+/*! \details If the number of slots is zero the number of slots will be set
+ * to the number of CDF values.
+ */
+CDFGuideTable::CDFGuideTable( const Utility::ArrayView<const double>& cdf,
+                              const size_t number_of_slots )
+  : d_cdf( cdf.begin(), cdf.end() ),
+    d_guide( number_of_slots == 0 ? cdf.size() : number_of_slots ),
+    d_slots_per_cdf_unit( 0.0 )
+{
+  TEST_FOR_EXCEPTION( cdf.size() == 0,
+                      std::runtime_error,
+                      "A cdf guide table cannot be constructed from an empty "
+                      "cdf!" );
+
+  for( size_t i = 1; i < d_cdf.size(); ++i )
+  {
+    TEST_FOR_EXCEPTION( d_cdf[i] < d_cdf[i-1],
+                        std::runtime_error,
+                        "A cdf guide table cannot be constructed from a "
+                        "decreasing cdf (cdf[" << i << "] = " << d_cdf[i] <<
+                        " < cdf[" << i-1 << "] = " << d_cdf[i-1] << ")!" );
+  }
+
+  const double cdf_range = d_cdf.back() - d_cdf.front();
+
+  if( cdf_range > 0.0 )
+    d_slots_per_cdf_unit = d_guide.size()/cdf_range;
+
+  // Store the lower bin index of the lower boundary of each slot
+  size_t index = 0;
+
+  for( size_t slot = 0; slot < d_guide.size(); ++slot )
+  {
+    const double slot_lower_boundary =
+      d_cdf.front() + slot*cdf_range/d_guide.size();
+
+    while( index < d_cdf.size() - 1 && d_cdf[index+1] <= slot_lower_boundary )
+      ++index;
+
+    d_guide[slot] = index;
+  }
+}
+
+// Equality comparison operator
+bool CDFGuideTable::operator==( const CDFGuideTable& other ) const
+{
+  return d_cdf == other.d_cdf &&
+    d_guide == other.d_guide &&
+    d_slots_per_cdf_unit == other.d_slots_per_cdf_unit;
+}
+
+// Inequality comparison operator
+bool CDFGuideTable::operator!=( const CDFGuideTable& other ) const
+{
+  return !(*this == other);
+}
+
+} // end Utility namespace
+
+EXPLICIT_CLASS_SERIALIZE_INST( Utility::CDFGuideTable );
+
+//---------------------------------------------------------------------------//
+// end Utility_CDFGuideTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_CDFGuideTable.hpp
+//! \author Alex Robinson
+//! \brief  CDF guide table class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_CDF_GUIDE_TABLE_HPP
+#define UTILITY_CDF_GUIDE_TABLE_HPP
+
+// Std Lib Includes
+#include <vector>
+
+// Boost Includes
+#include <boost/serialization/version.hpp>
+
+// FRENSIE Includes
+#include "Utility_ArrayView.hpp"
+#include "Utility_Vector.hpp"
+#include "Utility_ExplicitSerializationTemplateInstantiationMacros.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+/*! The CDF guide table
+ *
+ * A guide table divides the range of a (nondecreasing) CDF into equal width
+ * slots and stores the index of the CDF bin that contains the lower boundary
+ * of each slot. A search for the bin that contains a CDF value starts from
+ * the slot's stored bin and only needs to check the (usually very small)
+ * number of bins that overlap the slot, which makes the search constant time
+ * on average. The bin indices that are returned are identical to the indices
+ * returned by Utility::binaryLowerBoundIndex and
+ * Utility::binaryUpperBoundIndex. A contiguous copy of the CDF is stored with
+ * the table so that a search only touches two contiguous arrays.
+ * \ingroup univariate_distributions
+ */
+class CDFGuideTable
+{
+
+public:
+
+  //! Default constructor (empty table)
+  CDFGuideTable();
+
+  //! Constructor
+  CDFGuideTable( const Utility::ArrayView<const double>& cdf,
+                 const size_t number_of_slots = 0 );
+
+  //! Destructor
+  ~CDFGuideTable()
+  { /* ... */ }
+
+  //! Return the number of CDF values in the table
+  size_t size() const;
+
+  //! Return the number of slots in the table
+  size_t getNumberOfSlots() const;
+
+  //! Check if the table is empty
+  bool empty() const;
+
+  //! Find the index of the lower bin boundary where the value falls
+  size_t findLowerBinIndex( const double value ) const;
+
+  //! Find the index of the upper bin boundary where the value falls
+  size_t findUpperBinIndex( const double value ) const;
+
+  //! Equality comparison operator
+  bool operator==( const CDFGuideTable& other ) const;
+
+  //! Inequality comparison operator
+  bool operator!=( const CDFGuideTable& other ) const;
+
+private:
+
+  // Return the slot that the value falls in
+  size_t findSlot( const double value ) const;
+
+  // Serialize the table data
+  template<typename Archive>
+  void serialize( Archive& ar, const unsigned version )
+  {
+    ar & BOOST_SERIALIZATION_NVP( d_cdf );
+    ar & BOOST_SERIALIZATION_NVP( d_guide );
+    ar & BOOST_SERIALIZATION_NVP( d_slots_per_cdf_unit );
+  }
+
+  // Declare the boost serialization access object as a friend
+  friend class boost::serialization::access;
+
+  // The cdf values
+  std::vector<double> d_cdf;
+
+  // The lower bin index of the lower boundary of each slot
+  std::vector<unsigned long long> d_guide;
+
+  // The number of slots per unit of the cdf
+  double d_slots_per_cdf_unit;
+};
+
+// Return the number of CDF values in the table
+inline size_t CDFGuideTable::size() const
+{
+  return d_cdf.size();
+}
+
+// Return the number of slots in the table
+inline size_t CDFGuideTable::getNumberOfSlots() const
+{
+  return d_guide.size();
+}
+
+// Check if the table is empty
+inline bool CDFGuideTable::empty() const
+{
+  return d_cdf.empty();
+}
+
+// Return the slot that the value falls in
+inline size_t CDFGuideTable::findSlot( const double value ) const
+{
+  const double scaled_value = (value - d_cdf.front())*d_slots_per_cdf_unit;
+
+  if( !(scaled_value > 0.0) )
+    return 0;
+  else
+  {
+    const size_t slot = (size_t)scaled_value;
+
+    return slot < d_guide.size() ? slot : d_guide.size() - 1;
+  }
+}
+
+// Find the index of the lower bin boundary where the value falls
+/*! \details The returned index is the last index with a cdf value less than
+ * or equal to the value of interest (or zero if there is no such index),
+ * which is identical to the index returned by Utility::binaryLowerBoundIndex.
+ */
+inline size_t CDFGuideTable::findLowerBinIndex( const double value ) const
+{
+  // Make sure the table is valid
+  testPrecondition( !this->empty() );
+  // Make sure the value is valid
+  testPrecondition( value >= d_cdf.front() );
+  testPrecondition( value <= d_cdf.back() );
+
+  size_t index = d_guide[this->findSlot( value )];
+
+  // Correct for round-off in the slot calculation
+  while( index > 0 && d_cdf[index] > value )
+    --index;
+
+  const size_t last_index = d_cdf.size() - 1;
+
+  while( index < last_index && d_cdf[index+1] <= value )
+    ++index;
+
+  return index;
+}
+
+// Find the index of the upper bin boundary where the value falls
+/*! \details The returned index is identical to the index returned by
+ * Utility::binaryUpperBoundIndex.
+ */
+inline size_t CDFGuideTable::findUpperBinIndex( const double value ) const
+{
+  // Make sure the table is valid
+  testPrecondition( !this->empty() );
+  // Make sure the value is valid
+  testPrecondition( value <= d_cdf.back() );
+
+  if( value < d_cdf.front() )
+    return 0;
+
+  size_t index = this->findLowerBinIndex( value );
+
+  if( value > d_cdf[index] && index < d_cdf.size() - 1 )
+    ++index;
+
+  return index;
+}
+
+} // end Utility namespace
+
+BOOST_SERIALIZATION_CLASS_VERSION( CDFGuideTable, Utility, 0 );
+EXTERN_EXPLICIT_CLASS_SERIALIZE_INST( Utility, CDFGuideTable );
+
+#endif // end UTILITY_CDF_GUIDE_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_CDFGuideTable.hpp
+//---------------------------------------------------------------------------//
@@ -11,6 +11,8 @@
 
 // FRENSIE Includes
 #include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_AliasTable.hpp"
+#include "Utility_LazySamplingTable.hpp"
 #include "Utility_ArrayView.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
@@ -140,6 +142,15 @@ public:
 			    const IndepQuantity max_indep_var ) const override;
 
 
+  //! Enable constant time (alias table) sampling
+  void enableConstantTimeSampling();
+
+  //! Disable constant time (alias table) sampling
+  void disableConstantTimeSampling();
+
+  //! Check if constant time (alias table) sampling is enabled
+  bool isConstantTimeSamplingEnabled() const;
+
   //! Return the upper bound of the distribution independent variable
   IndepQuantity getUpperBoundOfIndepVar() const override;
 
@@ -189,6 +200,14 @@ private:
   IndepQuantity sampleImplementation( double random_number,
 				      size_t& sampled_bin_index ) const;
 
+  // Return a random sample using the alias table and record the bin index
+  IndepQuantity sampleConstantTimeImplementation(
+                                       const double random_number,
+                                       size_t& sampled_bin_index ) const;
+
+  // Construct the alias table
+  AliasTable constructAliasTable() const;
+
   // Initialize the distribution
   void initializeDistribution(
                     const Utility::ArrayView<const double>& independent_values,
@@ -258,6 +277,12 @@ private:
 
   // Bool to treat the distribution as continuous or not
   bool d_continuous;
+
+  // Bool to use constant time (alias table) sampling
+  bool d_constant_time_sampling;
+
+  // The alias table (constructed on the first constant time sample)
+  LazySamplingTable<AliasTable> d_alias_table;
 };
 
 /*! The discrete distribution (unit-agnostic)
@@ -267,7 +292,7 @@ typedef UnitAwareDiscreteDistribution<void,void> DiscreteDistribution;
   
 } // end Utility namespace
 
-BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareDiscreteDistribution, 0 );
+BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareDiscreteDistribution, 1 );
 BOOST_SERIALIZATION_DISTRIBUTION2_EXPORT_STANDARD_KEY( DiscreteDistribution );
 
 //---------------------------------------------------------------------------//
@@ -53,7 +53,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
                     const bool treat_as_continuous )
   : d_distribution( independent_values.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values,
@@ -88,7 +90,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
     const bool treat_as_continuous )
   : d_distribution( independent_quantities.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_quantities, dependent_values, true );
@@ -120,7 +124,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
     const bool treat_as_continuous )
   : d_distribution( independent_quantities.size() ),
     d_norm_constant(),
-    d_continuous( treat_as_continuous )
+    d_continuous( treat_as_continuous ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_quantities,
@@ -146,7 +152,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
 	  const UnitAwareDiscreteDistribution<InputIndepUnit,InputDepUnit>& dist_instance )
   : d_distribution(),
     d_norm_constant(),
-    d_continuous( dist_instance.d_continuous )
+    d_continuous( dist_instance.d_continuous ),
+    d_constant_time_sampling( dist_instance.d_constant_time_sampling ),
+    d_alias_table()
 {
   // Make sure that the distribution is valid
   testPrecondition( dist_instance.d_distribution.size() > 0 );
@@ -175,7 +183,9 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::UnitAwareDiscreteD
   const UnitAwareDiscreteDistribution<void,void>& unitless_dist_instance, int )
   : d_distribution(),
     d_norm_constant(),
-    d_continuous( unitless_dist_instance.d_continuous )
+    d_continuous( unitless_dist_instance.d_continuous ),
+    d_constant_time_sampling( unitless_dist_instance.d_constant_time_sampling ),
+    d_alias_table()
 {
   // Make sure that the distribution is valid
   testPrecondition( unitless_dist_instance.d_distribution.size() > 0 );
@@ -227,6 +237,8 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::operator=(
     d_distribution = dist_instance.d_distribution;
     d_norm_constant = dist_instance.d_norm_constant;
     d_continuous = dist_instance.d_continuous;
+    d_constant_time_sampling = dist_instance.d_constant_time_sampling;
+    d_alias_table.reset();
   }
 
   return *this;
@@ -325,11 +337,9 @@ template<typename IndependentUnit,typename DependentUnit>
 typename UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::IndepQuantity
 UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sample() const
 {
-  double random_number = RandomNumberGenerator::getRandomNumber<double>();
-
   size_t dummy_index;
 
-  return this->sampleImplementation( random_number, dummy_index );
+  return this->sampleAndRecordBinIndex( dummy_index );
 }
 
 // Return a random sample and record the number of trials
@@ -350,7 +360,13 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleAndRecordBin
 {
   double random_number = RandomNumberGenerator::getRandomNumber<double>();
 
-  return this->sampleImplementation( random_number, sampled_bin_index );
+  if( d_constant_time_sampling )
+  {
+    return this->sampleConstantTimeImplementation( random_number,
+                                                   sampled_bin_index );
+  }
+  else
+    return this->sampleImplementation( random_number, sampled_bin_index );
 }
 
 // Return a random sample and sampled index from the corresponding CDF
@@ -398,6 +414,73 @@ UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleImplementati
   return Utility::get<0>(d_distribution[sampled_bin_index]);
 }
 
+// Return a random sample using the alias table and record the bin index
+/*! \details The alias table does not preserve the monotonic relationship
+ * between the random number and the sample (unlike the inverse cdf method).
+ * The sampled values will have the same distribution as the values returned
+ * by the inverse cdf method.
+ */
+template<typename IndependentUnit,typename DependentUnit>
+inline typename UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::IndepQuantity
+UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::sampleConstantTimeImplementation(
+                                       const double random_number,
+                                       size_t& sampled_bin_index ) const
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const AliasTable& alias_table =
+    d_alias_table.get( [this](){return this->constructAliasTable();} );
+
+  sampled_bin_index = alias_table.sampleIndex( random_number );
+
+  return Utility::get<0>(d_distribution[sampled_bin_index]);
+}
+
+// Construct the alias table
+template<typename IndependentUnit,typename DependentUnit>
+AliasTable UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::constructAliasTable() const
+{
+  std::vector<double> weights( d_distribution.size() );
+
+  weights[0] = Utility::get<1>(d_distribution[0]);
+
+  for( size_t i = 1; i < d_distribution.size(); ++i )
+  {
+    weights[i] = Utility::get<1>(d_distribution[i]) -
+      Utility::get<1>(d_distribution[i-1]);
+  }
+
+  return AliasTable( Utility::arrayViewOfConst( weights ) );
+}
+
+// Enable constant time (alias table) sampling
+/*! \details When enabled, the sample, sampleAndRecordTrials and
+ * sampleAndRecordBinIndex methods will use an alias table, which will be
+ * constructed the first time that one of these methods is called. The
+ * methods that take a random number will always use the inverse cdf method.
+ */
+template<typename IndependentUnit,typename DependentUnit>
+void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::enableConstantTimeSampling()
+{
+  d_constant_time_sampling = true;
+}
+
+// Disable constant time (alias table) sampling
+template<typename IndependentUnit,typename DependentUnit>
+void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::disableConstantTimeSampling()
+{
+  d_constant_time_sampling = false;
+}
+
+// Check if constant time (alias table) sampling is enabled
+template<typename IndependentUnit,typename DependentUnit>
+bool UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::isConstantTimeSamplingEnabled() const
+{
+  return d_constant_time_sampling;
+}
+
 // Return a random sample from the distribution at the given CDF value in a subrange
 template<typename IndependentUnit,typename DependentUnit>
 inline typename UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::IndepQuantity
@@ -477,6 +560,7 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::save( Archive
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_continuous );
+  ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
 }
 
 // Load the distribution from an archive
@@ -491,6 +575,13 @@ void UnitAwareDiscreteDistribution<IndependentUnit,DependentUnit>::load( Archive
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_continuous );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
+  else
+    d_constant_time_sampling = false;
+
+  d_alias_table.reset();
 }
 
 // Equality comparison operator
@@ -11,6 +11,8 @@
 
 // FRENSIE Includes
 #include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_AliasTable.hpp"
+#include "Utility_LazySamplingTable.hpp"
 #include "Utility_ArrayView.hpp"
 #include "Utility_Vector.hpp"
 #include "Utility_Tuple.hpp"
@@ -143,6 +145,15 @@ public:
 			    const double random_number,
 			    const IndepQuantity max_indep_var ) const override;
 
+  //! Enable constant time (alias table) sampling
+  void enableConstantTimeSampling();
+
+  //! Disable constant time (alias table) sampling
+  void disableConstantTimeSampling();
+
+  //! Check if constant time (alias table) sampling is enabled
+  bool isConstantTimeSamplingEnabled() const;
+
   //! Return the upper bound of the distribution independent variable
   IndepQuantity getUpperBoundOfIndepVar() const override;
 
@@ -222,6 +233,14 @@ private:
   IndepQuantity sampleImplementation( double random_number,
 				      size_t& sampled_bin_index ) const;
 
+  // Return a random sample using the alias table and record the bin index
+  IndepQuantity sampleConstantTimeImplementation(
+                                       const double random_number,
+                                       size_t& sampled_bin_index ) const;
+
+  // Construct the alias table
+  AliasTable constructAliasTable() const;
+
   // Verify that the values are valid
   template<typename InputIndepQuantity, typename InputDepQuantity>
   static void verifyValidValues(
@@ -256,6 +275,12 @@ private:
 
   // The normalization constant
   DistNormQuantity d_norm_constant;
+
+  // Bool to use constant time (alias table) sampling
+  bool d_constant_time_sampling;
+
+  // The alias table (constructed on the first constant time sample)
+  LazySamplingTable<AliasTable> d_alias_table;
 };
 
 /*! The histogram distribution (unit-agnostic)
@@ -265,7 +290,7 @@ typedef UnitAwareHistogramDistribution<void,void> HistogramDistribution;
 
 } // end Utility namespace
 
-BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareHistogramDistribution, 0 );
+BOOST_SERIALIZATION_DISTRIBUTION2_VERSION( UnitAwareHistogramDistribution, 1 );
 BOOST_SERIALIZATION_DISTRIBUTION2_EXPORT_STANDARD_KEY( HistogramDistribution );
 
 //---------------------------------------------------------------------------//
@@ -52,7 +52,9 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::UnitAwareHistogra
                         const Utility::ArrayView<const double>& bin_values,
                         const bool interpret_dependent_values_as_cdf )
   : d_distribution( bin_boundaries.size() ),
-    d_norm_constant( DNQT::one() )
+    d_norm_constant( DNQT::one() ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( bin_boundaries,
@@ -87,7 +89,9 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::UnitAwareHistogra
             const Utility::ArrayView<const InputIndepQuantity>& bin_boundaries,
             const Utility::ArrayView<const double>& cdf_values )
   : d_distribution( bin_boundaries.size() ),
-    d_norm_constant( DNQT::one() )
+    d_norm_constant( DNQT::one() ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( bin_boundaries, cdf_values, true );
@@ -114,7 +118,9 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::UnitAwareHistogra
             const Utility::ArrayView<const InputIndepQuantity>& bin_boundaries,
             const Utility::ArrayView<const InputDepQuantity>& bin_values )
   : d_distribution( bin_boundaries.size() ),
-    d_norm_constant( DNQT::one() )
+    d_norm_constant( DNQT::one() ),
+    d_constant_time_sampling( false ),
+    d_alias_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( bin_boundaries, bin_values, false );
@@ -136,9 +142,10 @@ template<typename InputIndepUnit, typename InputDepUnit>
 UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::UnitAwareHistogramDistribution(
  const UnitAwareHistogramDistribution<InputIndepUnit,InputDepUnit>& dist_instance )
   : d_distribution(),
-    d_norm_constant()
+    d_norm_constant(),
+    d_constant_time_sampling( dist_instance.d_constant_time_sampling ),
+    d_alias_table()
 {
-
   typedef typename UnitAwareHistogramDistribution<InputIndepUnit,InputDepUnit>::IndepQuantity InputIndepQuantity;
 
   typedef typename UnitAwareHistogramDistribution<InputIndepUnit,InputDepUnit>::DepQuantity InputDepQuantity;
@@ -161,7 +168,9 @@ template<typename IndependentUnit, typename DependentUnit>
 UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::UnitAwareHistogramDistribution(
  const UnitAwareHistogramDistribution<void,void>& unitless_dist_instance, int )
   : d_distribution(),
-    d_norm_constant()
+    d_norm_constant(),
+    d_constant_time_sampling( unitless_dist_instance.d_constant_time_sampling ),
+    d_alias_table()
 {
   // Reconstruct the original input distribution
   std::vector<double> input_bin_boundaries, input_bin_values;
@@ -200,6 +209,8 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::operator=(
   {
     d_distribution = dist_instance.d_distribution;
     d_norm_constant = dist_instance.d_norm_constant;
+    d_constant_time_sampling = dist_instance.d_constant_time_sampling;
+    d_alias_table.reset();
   }
 
   return *this;
@@ -264,11 +275,9 @@ template<typename IndependentUnit, typename DependentUnit>
 typename UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::IndepQuantity
 UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::sample() const
 {
-  double random_number = RandomNumberGenerator::getRandomNumber<double>();
-
   size_t dummy_index;
 
-  return this->sampleImplementation( random_number, dummy_index );
+  return this->sampleAndRecordBinIndex( dummy_index );
 }
 
 // Return a random sample and record the number of trials
@@ -289,7 +298,13 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::sampleAndRecordBi
 {
   double random_number = RandomNumberGenerator::getRandomNumber<double>();
 
-  return this->sampleImplementation( random_number, sampled_bin_index );
+  if( d_constant_time_sampling )
+  {
+    return this->sampleConstantTimeImplementation( random_number,
+                                                   sampled_bin_index );
+  }
+  else
+    return this->sampleImplementation( random_number, sampled_bin_index );
 }
 
 // Return a random sample from the distribution at the given CDF value
@@ -348,6 +363,77 @@ UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::sampleImplementat
                   Utility::get<1>(*bin));
 }
 
+// Return a random sample using the alias table and record the bin index
+/*! \details The alias table is used to sample the bin and the residual
+ * random number from the alias table is used to sample a value uniformly in
+ * the bin. The sampled values will have the same distribution as the values
+ * returned by the inverse cdf method.
+ */
+template<typename IndependentUnit, typename DependentUnit>
+inline typename UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::IndepQuantity
+UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::sampleConstantTimeImplementation(
+                                       const double random_number,
+                                       size_t& sampled_bin_index ) const
+{
+  // Make sure the random number is valid
+  testPrecondition( random_number >= 0.0 );
+  testPrecondition( random_number <= 1.0 );
+
+  const AliasTable& alias_table =
+    d_alias_table.get( [this](){return this->constructAliasTable();} );
+
+  double residual_random_number;
+
+  sampled_bin_index =
+    alias_table.sampleIndex( random_number, residual_random_number );
+
+  const IndepQuantity& bin_min = Utility::get<0>(d_distribution[sampled_bin_index]);
+
+  return bin_min + residual_random_number*
+    (Utility::get<0>(d_distribution[sampled_bin_index+1]) - bin_min);
+}
+
+// Construct the alias table
+template<typename IndependentUnit, typename DependentUnit>
+AliasTable UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::constructAliasTable() const
+{
+  std::vector<double> weights( d_distribution.size() - 1 );
+
+  for( size_t i = 0; i < weights.size(); ++i )
+  {
+    weights[i] = Utility::getRawQuantity( Utility::get<2>(d_distribution[i+1]) -
+                                          Utility::get<2>(d_distribution[i]) );
+  }
+
+  return AliasTable( Utility::arrayViewOfConst( weights ) );
+}
+
+// Enable constant time (alias table) sampling
+/*! \details When enabled, the sample, sampleAndRecordTrials and
+ * sampleAndRecordBinIndex methods will use an alias table, which will be
+ * constructed the first time that one of these methods is called. The
+ * methods that take a random number will always use the inverse cdf method.
+ */
+template<typename IndependentUnit, typename DependentUnit>
+void UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::enableConstantTimeSampling()
+{
+  d_constant_time_sampling = true;
+}
+
+// Disable constant time (alias table) sampling
+template<typename IndependentUnit, typename DependentUnit>
+void UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::disableConstantTimeSampling()
+{
+  d_constant_time_sampling = false;
+}
+
+// Check if constant time (alias table) sampling is enabled
+template<typename IndependentUnit, typename DependentUnit>
+bool UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::isConstantTimeSamplingEnabled() const
+{
+  return d_constant_time_sampling;
+}
+
 // Return a sample from the distribution at the given CDF value in a subrange
 template<typename IndependentUnit, typename DependentUnit>
 inline typename UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::IndepQuantity
@@ -427,6 +513,7 @@ void UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::save( Archiv
   // Save the local member data
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
+  ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
 }
 
 // Load the distribution from an archive
@@ -440,6 +527,13 @@ void UnitAwareHistogramDistribution<IndependentUnit,DependentUnit>::load( Archiv
   // Load the local member data
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
+  else
+    d_constant_time_sampling = false;
+
+  d_alias_table.reset();
 }
 
 // Equality comparison operator
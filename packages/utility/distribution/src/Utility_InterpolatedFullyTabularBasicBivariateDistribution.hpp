@@ -226,16 +226,23 @@ private:
                         EvaluationMethod evaluateCDF ) const;
 
   //! Evaluate the distribution using the desired CDF evaluation method
-  template<typename EvaluationMethod>
+  template<typename EvaluationMethod, typename YBoundsFunctor>
   double evaluateCDFImpl(
-             const PrimaryIndepQuantity primary_indep_var_value,
-             const SecondaryIndepQuantity secondary_indep_var_value,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             min_secondary_indep_var_functor,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             max_secondary_indep_var_functor,
-             EvaluationMethod evaluateCDF,
-             unsigned max_number_of_iterations = 500 ) const;
+                   const PrimaryIndepQuantity primary_indep_var_value,
+                   const SecondaryIndepQuantity secondary_indep_var_value,
+                   const YBoundsFunctor& min_secondary_indep_var_functor,
+                   const YBoundsFunctor& max_secondary_indep_var_functor,
+                   EvaluationMethod evaluateCDF,
+                   unsigned max_number_of_iterations = 500 ) const;
+
+  //! Return a random sample from the secondary conditional PDF in the subrange
+  template<typename YBoundsFunctor>
+  SecondaryIndepQuantity sampleSecondaryConditionalWithRandomNumberInSubrangeImpl(
+                   const PrimaryIndepQuantity primary_indep_var_value,
+                   const double random_number,
+                   const YBoundsFunctor& min_secondary_indep_var_functor,
+                   const YBoundsFunctor& max_secondary_indep_var_functor,
+                   const SecondaryIndepQuantity max_secondary_indep_var_value ) const;
 
   // Save the distribution to an archive
   template<typename Archive>
@@ -37,35 +37,24 @@ struct TwoDGridPolicySamplingFunctorCreationUncorrelatedBaseHelper
 {
   //! Return the basic sampling functor
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createBasicSamplingFunctor()
+  static inline SecondarySamplingFunctor<BaseUnivariateDistributionType> createBasicSamplingFunctor()
   {
-    return std::bind<typename BaseUnivariateDistributionType::IndepQuantity>(
-                                       &BaseUnivariateDistributionType::sample,
-                                       std::placeholders::_1 );
+    return SecondarySamplingFunctor<BaseUnivariateDistributionType>();
   }
 
   //! Return the sampling functor with a trials counter
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createSamplingFunctorWithTrialsCounter(
-                                  Utility::DistributionTraits::Counter& trials,
-                                  std::function<void()>& trials_updater )
+  static inline SecondarySamplingFunctorWithTrialsCounter<BaseUnivariateDistributionType> createSamplingFunctorWithTrialsCounter(
+                                  Utility::DistributionTraits::Counter& trials )
   {
-    trials_updater = [](){};
-
-    return std::bind<typename BaseUnivariateDistributionType::IndepQuantity>(
-                        &BaseUnivariateDistributionType::sampleAndRecordTrials,
-                        std::placeholders::_1,
-                        std::ref( trials ) );
+    return SecondarySamplingFunctorWithTrialsCounter<BaseUnivariateDistributionType>( trials );
   }
 
   //! Return the sampling functor that records the sampled secondary bin index
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createSamplingFunctorWithSecondaryBinIndex( size_t& secondary_bin_index )
+  static inline SecondarySamplingFunctorWithBinIndex<BaseUnivariateDistributionType> createSamplingFunctorWithSecondaryBinIndex( size_t& secondary_bin_index )
   {
-    return std::bind<typename BaseUnivariateDistributionType::IndepQuantity>(
-                      &BaseUnivariateDistributionType::sampleAndRecordBinIndex,
-                      std::placeholders::_1,
-                      std::ref( secondary_bin_index ) );
+    return SecondarySamplingFunctorWithBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
   }
 };
 
@@ -76,39 +65,36 @@ struct TwoDGridPolicySamplingFunctorCreationCorrelatedBaseHelper
 {
   //! Return the basic sampling functor
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createBasicSamplingFunctor()
+  static inline SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType> createBasicSamplingFunctor()
   {
     // Generate a random number
     double random_number =
       Utility::RandomNumberGenerator::getRandomNumber<double>();
 
-    return std::bind<typename BaseUnivariateDistributionType::IndepQuantity>(
-                       &BaseUnivariateDistributionType::sampleWithRandomNumber,
-                       std::placeholders::_1,
-                       random_number );
+    return SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>( random_number );
   }
 
   //! Return the sampling functor with a trials counter
+  /*! \details We can only use a single random number with correlated
+   * sampling. The trials counter will be incremented once and then ignored.
+   */
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createSamplingFunctorWithTrialsCounter(
-                                  Utility::DistributionTraits::Counter& trials,
-                                  std::function<void()>& trials_updater )
+  static inline SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType> createSamplingFunctorWithTrialsCounter(
+                                  Utility::DistributionTraits::Counter& trials )
   {
     FRENSIE_LOG_TAGGED_WARNING( "InterpolatedFullyTabularBasicBivariateDistribution",
                                 "The sampling trial counter cannot be "
                                 "accurately updated with correlated "
                                 "sampling!" );
 
-    trials_updater = [&trials](){ ++trials; };
+    ++trials;
 
-    // We can only use a single random number with correlated sampling - the
-    // trials counter has to be ignored.
     return TwoDGridPolicySamplingFunctorCreationCorrelatedBaseHelper::createBasicSamplingFunctor<BaseUnivariateDistributionType>();
   }
 
   //! Return the sampling functor that records the sampled secondary bin index
   template<typename BaseUnivariateDistributionType>
-  static inline std::function<typename BaseUnivariateDistributionType::IndepQuantity(const BaseUnivariateDistributionType&)> createSamplingFunctorWithSecondaryBinIndex( size_t& secondary_bin_index )
+  static inline SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType> createSamplingFunctorWithSecondaryBinIndex( size_t& secondary_bin_index )
   {
     FRENSIE_LOG_TAGGED_WARNING( "InterpolatedFullyTabularBasicBivariateDistribution",
                                 "The secondary bin index cannot be determined "
@@ -334,24 +320,10 @@ double UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolic
                         const SecondaryIndepQuantity secondary_indep_var_value,
                         EvaluationMethod evaluateCDF ) const
 {
-  // Create the lower bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    min_secondary_indep_var_functor = std::bind<SecondaryIndepQuantity>(
-                        &ThisType::getLowerBoundOfSecondaryConditionalIndepVar,
-                        std::cref( *this ),
-                        std::placeholders::_1 );
-
-  // Create the upper bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    max_secondary_indep_var_functor = std::bind<SecondaryIndepQuantity>(
-                        &ThisType::getUpperBoundOfSecondaryConditionalIndepVar,
-                        std::cref( *this ),
-                        std::placeholders::_1 );
-
   return this->evaluateCDFImpl( primary_indep_var_value,
                                 secondary_indep_var_value,
-                                min_secondary_indep_var_functor,
-                                max_secondary_indep_var_functor,
+                                this->createLowerBoundFunctor(),
+                                this->createUpperBoundFunctor(),
                                 evaluateCDF );
 }
 
@@ -360,16 +332,14 @@ template<typename TwoDGridPolicy,
          typename PrimaryIndependentUnit,
          typename SecondaryIndependentUnit,
          typename DependentUnit>
-template<typename EvaluationMethod>
+template<typename EvaluationMethod, typename YBoundsFunctor>
 double UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::evaluateCDFImpl(
-             const PrimaryIndepQuantity primary_indep_var_value,
-             const SecondaryIndepQuantity secondary_indep_var_value,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             min_secondary_indep_var_functor,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             max_secondary_indep_var_functor,
-             EvaluationMethod evaluateCDF,
-             unsigned max_number_of_iterations ) const
+                   const PrimaryIndepQuantity primary_indep_var_value,
+                   const SecondaryIndepQuantity secondary_indep_var_value,
+                   const YBoundsFunctor& min_secondary_indep_var_functor,
+                   const YBoundsFunctor& max_secondary_indep_var_functor,
+                   EvaluationMethod evaluateCDF,
+                   unsigned max_number_of_iterations ) const
 {
   // Find the bin boundaries
   DistributionDataConstIterator lower_bin_boundary, upper_bin_boundary;
@@ -422,8 +392,7 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   -> SecondaryIndepQuantity
 {
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
+  auto sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -449,8 +418,7 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   -> SecondaryIndepQuantity
 {
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
+  auto sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createBasicSamplingFunctor<BaseUnivariateDistributionType>();
 
   return this->sampleImpl( primary_indep_var_value,
                            sampling_functor,
@@ -468,13 +436,8 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
                           DistributionTraits::Counter& trials ) const
   -> SecondaryIndepQuantity
 {
-  // Create the sampling functor and trials updater functor
-  std::function<void()> trials_updater;
-
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithTrialsCounter<BaseUnivariateDistributionType>( trials, trials_updater );
-
-  trials_updater();
+  // Create the sampling functor
+  auto sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithTrialsCounter<BaseUnivariateDistributionType>( trials );
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -494,8 +457,7 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   SecondaryIndepQuantity dummy_raw_sample;
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
+  auto sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
 
   return this->sampleDetailedImpl( primary_indep_var_value,
                                    sampling_functor,
@@ -516,9 +478,7 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   -> SecondaryIndepQuantity
 {
   // Create the sampling functor
-  // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
+  auto sampling_functor = Details::TwoDGridPolicySamplingFunctorCreationHelper<TwoDGridPolicy>::template createSamplingFunctorWithSecondaryBinIndex<BaseUnivariateDistributionType>( secondary_bin_index );
 
   return this->sampleDetailedImpl( primary_indep_var_value,
                                    sampling_functor,
@@ -541,11 +501,8 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   testPrecondition( random_number <= 1.0 );
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                       &BaseUnivariateDistributionType::sampleWithRandomNumber,
-                       std::placeholders::_1,
-                       random_number );
+  Details::SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>
+    sampling_functor( random_number );
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -569,11 +526,8 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   testPrecondition( random_number <= 1.0 );
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                       &BaseUnivariateDistributionType::sampleWithRandomNumber,
-                        std::placeholders::_1,
-                        random_number );
+  Details::SecondarySamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>
+    sampling_functor( random_number );
 
   return this->sampleImpl( primary_indep_var_value,
                            sampling_functor,
@@ -653,25 +607,11 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
   testPrecondition( max_secondary_indep_var_value >
                     this->getLowerBoundOfSecondaryConditionalIndepVar( primary_indep_var_value ) );
 
-  // Create the lower bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    lower_bound_functor = std::bind<SecondaryIndepQuantity>(
-                              &ThisType::getLowerBoundOfSecondaryConditionalIndepVar,
-                              std::cref( *this ),
-                              std::placeholders::_1 );
-
-  // Create the upper bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    upper_bound_functor = std::bind<SecondaryIndepQuantity>(
-                              &ThisType::getUpperBoundOfSecondaryConditionalIndepVar,
-                              std::cref( *this ),
-                              std::placeholders::_1 );
-
-  return this->sampleSecondaryConditionalWithRandomNumberInSubrange(
+  return this->sampleSecondaryConditionalWithRandomNumberInSubrangeImpl(
                                   primary_indep_var_value,
                                   random_number,
-                                  lower_bound_functor,
-                                  upper_bound_functor,
+                                  this->createLowerBoundFunctor(),
+                                  this->createUpperBoundFunctor(),
                                   max_secondary_indep_var_value );
 }
 
@@ -689,6 +629,28 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
     max_secondary_indep_var_functor,
     const SecondaryIndepQuantity max_secondary_indep_var_value ) const
   -> SecondaryIndepQuantity
+{
+  return this->sampleSecondaryConditionalWithRandomNumberInSubrangeImpl(
+                                  primary_indep_var_value,
+                                  random_number,
+                                  min_secondary_indep_var_functor,
+                                  max_secondary_indep_var_functor,
+                                  max_secondary_indep_var_value );
+}
+
+// Return a random sample from the secondary conditional PDF in the subrange
+template<typename TwoDGridPolicy,
+         typename PrimaryIndependentUnit,
+         typename SecondaryIndependentUnit,
+         typename DependentUnit>
+template<typename YBoundsFunctor>
+auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,PrimaryIndependentUnit,SecondaryIndependentUnit,DependentUnit>::sampleSecondaryConditionalWithRandomNumberInSubrangeImpl(
+                   const PrimaryIndepQuantity primary_indep_var_value,
+                   const double random_number,
+                   const YBoundsFunctor& min_secondary_indep_var_functor,
+                   const YBoundsFunctor& max_secondary_indep_var_functor,
+                   const SecondaryIndepQuantity max_secondary_indep_var_value ) const
+  -> SecondaryIndepQuantity
 {
   // Make sure the random number is valid
   testPrecondition( random_number >= 0.0 );
@@ -698,12 +660,8 @@ auto UnitAwareInterpolatedFullyTabularBasicBivariateDistribution<TwoDGridPolicy,
                     min_secondary_indep_var_functor( primary_indep_var_value ) );
 
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&, const SecondaryIndepQuantity)>
-  subrange_sample_functor = std::bind<SecondaryIndepQuantity>(
-            &BaseUnivariateDistributionType::sampleWithRandomNumberInSubrange,
-            std::placeholders::_1,
-            random_number,
-            std::placeholders::_2 );
+  Details::SecondarySubrangeSamplingFunctorWithRandomNumber<BaseUnivariateDistributionType>
+    subrange_sample_functor( random_number );
 
   // Find the bin boundaries
   DistributionDataConstIterator lower_bin_boundary, upper_bin_boundary;
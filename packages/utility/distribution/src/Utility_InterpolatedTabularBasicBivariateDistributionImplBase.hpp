@@ -15,6 +15,123 @@
 
 namespace Utility{
 
+namespace Details{
+
+/*! \brief The secondary distribution sampling functor
+ *
+ * This functor (and the other secondary distribution sampling functors) are
+ * used instead of std::function objects to avoid type erasure (and possible
+ * heap allocations) every time that a sample is made.
+ */
+template<typename BaseUnivariateDistributionType>
+struct SecondarySamplingFunctor
+{
+  //! Return a sample from the secondary distribution
+  inline typename BaseUnivariateDistributionType::IndepQuantity operator()(
+               const BaseUnivariateDistributionType& distribution ) const
+  { return distribution.sample(); }
+};
+
+//! The secondary distribution sampling functor that records the trials
+template<typename BaseUnivariateDistributionType>
+class SecondarySamplingFunctorWithTrialsCounter
+{
+
+public:
+
+  //! Constructor
+  explicit SecondarySamplingFunctorWithTrialsCounter(
+                                          DistributionTraits::Counter& trials )
+    : d_trials( &trials )
+  { /* ... */ }
+
+  //! Return a sample from the secondary distribution and record the trials
+  inline typename BaseUnivariateDistributionType::IndepQuantity operator()(
+               const BaseUnivariateDistributionType& distribution ) const
+  { return distribution.sampleAndRecordTrials( *d_trials ); }
+
+private:
+
+  // The trials counter
+  DistributionTraits::Counter* d_trials;
+};
+
+//! The secondary distribution sampling functor that records the bin index
+template<typename BaseUnivariateDistributionType>
+class SecondarySamplingFunctorWithBinIndex
+{
+
+public:
+
+  //! Constructor
+  explicit SecondarySamplingFunctorWithBinIndex( size_t& bin_index )
+    : d_bin_index( &bin_index )
+  { /* ... */ }
+
+  //! Return a sample from the secondary distribution and record the bin index
+  inline typename BaseUnivariateDistributionType::IndepQuantity operator()(
+               const BaseUnivariateDistributionType& distribution ) const
+  { return distribution.sampleAndRecordBinIndex( *d_bin_index ); }
+
+private:
+
+  // The sampled bin index
+  size_t* d_bin_index;
+};
+
+//! The secondary distribution sampling functor that uses a random number
+template<typename BaseUnivariateDistributionType>
+class SecondarySamplingFunctorWithRandomNumber
+{
+
+public:
+
+  //! Constructor
+  explicit SecondarySamplingFunctorWithRandomNumber( const double random_number )
+    : d_random_number( random_number )
+  { /* ... */ }
+
+  //! Return a sample from the secondary distribution at the random number
+  inline typename BaseUnivariateDistributionType::IndepQuantity operator()(
+               const BaseUnivariateDistributionType& distribution ) const
+  { return distribution.sampleWithRandomNumber( d_random_number ); }
+
+private:
+
+  // The random number
+  double d_random_number;
+};
+
+//! The secondary distribution subrange sampling functor that uses a random number
+template<typename BaseUnivariateDistributionType>
+class SecondarySubrangeSamplingFunctorWithRandomNumber
+{
+
+public:
+
+  //! Constructor
+  explicit SecondarySubrangeSamplingFunctorWithRandomNumber(
+                                                   const double random_number )
+    : d_random_number( random_number )
+  { /* ... */ }
+
+  //! Return a sample from the secondary distribution subrange at the random number
+  inline typename BaseUnivariateDistributionType::IndepQuantity operator()(
+     const BaseUnivariateDistributionType& distribution,
+     const typename BaseUnivariateDistributionType::IndepQuantity max_indep_var ) const
+  {
+    return distribution.sampleWithRandomNumberInSubrange( d_random_number,
+                                                          max_indep_var );
+  }
+
+private:
+
+  // The random number
+  double d_random_number;
+};
+
+} // end Details namespace
+
 /*! The interpolated tabular bivariate dist. base implementation class
  *
  * Distribution must be either the
@@ -131,10 +248,50 @@ public:
 
 protected:
 
+  /*! \brief The secondary conditional independent variable bounds functor
+   *
+   * The bounds method is called through the distribution pointer so that
+   * overridden bounds methods will still be used.
+   */
+  class SecondaryIndepVarBoundsFunctor
+  {
+
+  public:
+
+    //! The bounds method type
+    typedef SecondaryIndepQuantity (ThisType::*BoundsMethod)( const PrimaryIndepQuantity ) const;
+
+    //! Constructor
+    SecondaryIndepVarBoundsFunctor( const ThisType& distribution,
+                                    const BoundsMethod bounds_method )
+      : d_distribution( &distribution ),
+        d_bounds_method( bounds_method )
+    { /* ... */ }
+
+    //! Return the bound of the secondary conditional independent variable
+    inline SecondaryIndepQuantity operator()(
+                     const PrimaryIndepQuantity primary_indep_var_value ) const
+    { return (d_distribution->*d_bounds_method)( primary_indep_var_value ); }
+
+  private:
+
+    // The distribution
+    const ThisType* d_distribution;
+
+    // The bounds method
+    BoundsMethod d_bounds_method;
+  };
+
   //! Default constructor
   UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase()
   { /* ... */ }
 
+  //! Create the secondary conditional indep var lower bound functor
+  SecondaryIndepVarBoundsFunctor createLowerBoundFunctor() const;
+
+  //! Create the secondary conditional indep var upper bound functor
+  SecondaryIndepVarBoundsFunctor createUpperBoundFunctor() const;
+
   //! Set the distribution
   void setDistribution(
      const std::vector<PrimaryIndepQuantity>& primary_indep_grid,
@@ -155,14 +312,14 @@ protected:
                         EvaluationMethod evaluate ) const;
 
   //! Evaluate the distribution using the desired evaluation method
-  template<typename ReturnType, typename EvaluationMethod>
+  template<typename ReturnType,
+           typename EvaluationMethod,
+           typename YBoundsFunctor>
   ReturnType evaluateImpl(
              const PrimaryIndepQuantity primary_indep_var_value,
              const SecondaryIndepQuantity secondary_indep_var_value,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             min_secondary_indep_var_functor,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             max_secondary_indep_var_functor,
+             const YBoundsFunctor& min_secondary_indep_var_functor,
+             const YBoundsFunctor& max_secondary_indep_var_functor,
              EvaluationMethod evaluate ) const;
 
   //! Sample from the distribution using the desired sampling functor
@@ -174,16 +331,14 @@ protected:
                             size_t& primary_bin_index ) const;
 
   //! Sample from the distribution using the desired sampling functor
-  template<typename SampleFunctor>
+  template<typename SampleFunctor, typename YBoundsFunctor>
   SecondaryIndepQuantity sampleDetailedImpl(
-            const PrimaryIndepQuantity primary_indep_var_value,
-            SampleFunctor sample_functor,
-            SecondaryIndepQuantity& raw_sample,
-            size_t& primary_bin_index,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              min_secondary_indep_var_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              max_secondary_indep_var_functor ) const;
+                      const PrimaryIndepQuantity primary_indep_var_value,
+                      SampleFunctor sample_functor,
+                      SecondaryIndepQuantity& raw_sample,
+                      size_t& primary_bin_index,
+                      const YBoundsFunctor& min_secondary_indep_var_functor,
+                      const YBoundsFunctor& max_secondary_indep_var_functor ) const;
 
   //! Sample from the distribution using the desired sampling functor
   template<typename SampleFunctor>
@@ -192,14 +347,12 @@ protected:
                             SampleFunctor sample_functor ) const;
 
   //! Sample from the distribution using the desired sampling functor
-  template<typename SampleFunctor>
+  template<typename SampleFunctor, typename YBoundsFunctor>
   SecondaryIndepQuantity sampleImpl(
-            const PrimaryIndepQuantity primary_indep_var_value,
-            SampleFunctor sample_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              min_secondary_indep_var_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              max_secondary_indep_var_functor ) const;
+                      const PrimaryIndepQuantity primary_indep_var_value,
+                      SampleFunctor sample_functor,
+                      const YBoundsFunctor& min_secondary_indep_var_functor,
+                      const YBoundsFunctor& max_secondary_indep_var_functor ) const;
 
 private:
 
@@ -203,38 +203,24 @@ inline ReturnType UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase
                         const SecondaryIndepQuantity secondary_indep_var_value,
                         EvaluationMethod evaluate ) const
 {
-  // Create the lower bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    min_secondary_indep_var_functor = std::bind<SecondaryIndepQuantity>(
-                                &ThisType::getLowerBoundOfSecondaryConditionalIndepVar,
-                                std::cref( *this ),
-                                std::placeholders::_1 );
-
-  // Create the upper bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    max_secondary_indep_var_functor = std::bind<SecondaryIndepQuantity>(
-                                &ThisType::getUpperBoundOfSecondaryConditionalIndepVar,
-                                std::cref( *this ),
-                                std::placeholders::_1 );
-
   return this->evaluateImpl<ReturnType>( primary_indep_var_value,
                                          secondary_indep_var_value,
-                                         min_secondary_indep_var_functor,
-                                         max_secondary_indep_var_functor,
+                                         this->createLowerBoundFunctor(),
+                                         this->createUpperBoundFunctor(),
                                          evaluate );
 }
 
 // Evaluate the distribution using the desired evaluation method
 template<typename TwoDGridPolicy, typename Distribution>
-template<typename ReturnType, typename EvaluationMethod>
+template<typename ReturnType,
+         typename EvaluationMethod,
+         typename YBoundsFunctor>
 inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::evaluateImpl(
-             const PrimaryIndepQuantity primary_indep_var_value,
-             const SecondaryIndepQuantity secondary_indep_var_value,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             min_secondary_indep_var_functor,
-             const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-             max_secondary_indep_var_functor,
-             EvaluationMethod evaluate ) const
+                   const PrimaryIndepQuantity primary_indep_var_value,
+                   const SecondaryIndepQuantity secondary_indep_var_value,
+                   const YBoundsFunctor& min_secondary_indep_var_functor,
+                   const YBoundsFunctor& max_secondary_indep_var_functor,
+                   EvaluationMethod evaluate ) const
   -> ReturnType
 {
   // Find the bin boundaries
@@ -284,13 +270,8 @@ auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPoli
                      const PrimaryIndepQuantity primary_indep_var_value ) const
   -> SecondaryIndepQuantity
 {
-  // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                                       &BaseUnivariateDistributionType::sample,
-                                       std::placeholders::_1 );
-
-  return this->sampleImpl( primary_indep_var_value, sampling_functor );
+  return this->sampleImpl( primary_indep_var_value,
+                           Details::SecondarySamplingFunctor<BaseUnivariateDistributionType>() );
 }
 
 // Return a random sample and record the number of trials
@@ -308,11 +289,8 @@ auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPoli
   -> SecondaryIndepQuantity
 {
   // Create the sampling functor
-  std::function<SecondaryIndepQuantity(const BaseUnivariateDistributionType&)>
-    sampling_functor = std::bind<SecondaryIndepQuantity>(
-                        &BaseUnivariateDistributionType::sampleAndRecordTrials,
-                        std::placeholders::_1,
-                        std::ref( trials ) );
+  Details::SecondarySamplingFunctorWithTrialsCounter<BaseUnivariateDistributionType>
+    sampling_functor( trials );
 
   return this->sampleImpl( primary_indep_var_value, sampling_functor );
 }
@@ -327,40 +305,24 @@ inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDG
                             size_t& primary_bin_index ) const
   -> SecondaryIndepQuantity
 {
-  // Create the lower bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    lower_bound_functor = std::bind<SecondaryIndepQuantity>(
-                              &ThisType::getLowerBoundOfSecondaryConditionalIndepVar,
-                              std::cref( *this ),
-                              std::placeholders::_1 );
-
-  // Create the upper bound functor
-  std::function<SecondaryIndepQuantity(const PrimaryIndepQuantity)>
-    upper_bound_functor = std::bind<SecondaryIndepQuantity>(
-                              &ThisType::getUpperBoundOfSecondaryConditionalIndepVar,
-                              std::cref( *this ),
-                              std::placeholders::_1 );
-
   return this->sampleDetailedImpl( primary_indep_var_value,
                                    sample_functor,
                                    raw_sample,
                                    primary_bin_index,
-                                   lower_bound_functor,
-                                   upper_bound_functor );
+                                   this->createLowerBoundFunctor(),
+                                   this->createUpperBoundFunctor() );
 }
 
 // Sample from the distribution using the desired sampling functor
 template<typename TwoDGridPolicy, typename Distribution>
-template<typename SampleFunctor>
+template<typename SampleFunctor, typename YBoundsFunctor>
 inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::sampleDetailedImpl(
-            const PrimaryIndepQuantity primary_indep_var_value,
-            SampleFunctor sample_functor,
-            SecondaryIndepQuantity& raw_sample,
-            size_t& primary_bin_index,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-            min_secondary_indep_var_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-            max_secondary_indep_var_functor ) const
+                      const PrimaryIndepQuantity primary_indep_var_value,
+                      SampleFunctor sample_functor,
+                      SecondaryIndepQuantity& raw_sample,
+                      size_t& primary_bin_index,
+                      const YBoundsFunctor& min_secondary_indep_var_functor,
+                      const YBoundsFunctor& max_secondary_indep_var_functor ) const
   -> SecondaryIndepQuantity
 {
   // Find the bin boundaries
@@ -433,14 +395,12 @@ inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDG
 
 // Sample from the distribution using the desired sampling functor
 template<typename TwoDGridPolicy, typename Distribution>
-template<typename SampleFunctor>
+template<typename SampleFunctor, typename YBoundsFunctor>
 inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::sampleImpl(
-            const PrimaryIndepQuantity primary_indep_var_value,
-            SampleFunctor sample_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              min_secondary_indep_var_functor,
-            const std::function<SecondaryIndepQuantity(PrimaryIndepQuantity)>&
-              max_secondary_indep_var_functor ) const
+                      const PrimaryIndepQuantity primary_indep_var_value,
+                      SampleFunctor sample_functor,
+                      const YBoundsFunctor& min_secondary_indep_var_functor,
+                      const YBoundsFunctor& max_secondary_indep_var_functor ) const
   -> SecondaryIndepQuantity
 {
   SecondaryIndepQuantity dummy_raw_sample;
@@ -454,6 +414,26 @@ inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDG
                                    max_secondary_indep_var_functor );
 }
 
+// Create the secondary conditional indep var lower bound functor
+template<typename TwoDGridPolicy, typename Distribution>
+inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::createLowerBoundFunctor() const
+  -> SecondaryIndepVarBoundsFunctor
+{
+  return SecondaryIndepVarBoundsFunctor(
+                       *this,
+                       &ThisType::getLowerBoundOfSecondaryConditionalIndepVar );
+}
+
+// Create the secondary conditional indep var upper bound functor
+template<typename TwoDGridPolicy, typename Distribution>
+inline auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::createUpperBoundFunctor() const
+  -> SecondaryIndepVarBoundsFunctor
+{
+  return SecondaryIndepVarBoundsFunctor(
+                       *this,
+                       &ThisType::getUpperBoundOfSecondaryConditionalIndepVar );
+}
+
 // Return the upper bound of the conditional distribution
 template<typename TwoDGridPolicy, typename Distribution>
 auto UnitAwareInterpolatedTabularBasicBivariateDistributionImplBase<TwoDGridPolicy,Distribution>::getUpperBoundOfSecondaryConditionalIndepVar(
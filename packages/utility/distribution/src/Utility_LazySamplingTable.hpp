@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_LazySamplingTable.hpp
+//! \author Alex Robinson
+//! \brief  Lazily constructed sampling table holder class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_LAZY_SAMPLING_TABLE_HPP
+#define UTILITY_LAZY_SAMPLING_TABLE_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <atomic>
+
+namespace Utility{
+
+/*! The lazily constructed sampling table holder
+ *
+ * Distributions use this holder to store an auxiliary sampling table (e.g.
+ * an alias table or a cdf guide table) that is only constructed the first
+ * time that it is needed. Construction is thread safe: if multiple threads
+ * request the table at the same time, each may construct a table but only
+ * one table will be kept. Copying the holder does not copy the table since
+ * the table must be constructed from the data of the owning distribution.
+ * \ingroup univariate_distributions
+ */
+template<typename Table>
+class LazySamplingTable
+{
+
+public:
+
+  //! Default constructor
+  LazySamplingTable()
+    : d_table( NULL )
+  { /* ... */ }
+
+  //! Copy constructor (the table is not copied)
+  LazySamplingTable( const LazySamplingTable& )
+    : d_table( NULL )
+  { /* ... */ }
+
+  //! Assignment operator (the table is not copied)
+  LazySamplingTable& operator=( const LazySamplingTable& )
+  {
+    this->reset();
+
+    return *this;
+  }
+
+  //! Destructor
+  ~LazySamplingTable()
+  {
+    delete d_table.load();
+  }
+
+  //! Check if the table has been constructed
+  bool isConstructed() const
+  {
+    return d_table.load( std::memory_order_acquire ) != NULL;
+  }
+
+  //! Get the table (it will be constructed using the builder if necessary)
+  template<typename Builder>
+  const Table& get( const Builder& table_builder ) const
+  {
+    const Table* table = d_table.load( std::memory_order_acquire );
+
+    if( table == NULL )
+    {
+      const Table* new_table = new Table( table_builder() );
+
+      if( d_table.compare_exchange_strong( table, new_table,
+                                           std::memory_order_acq_rel ) )
+        table = new_table;
+      else
+        delete new_table;
+    }
+
+    return *table;
+  }
+
+  //! Destroy the table (not thread safe)
+  void reset()
+  {
+    delete d_table.exchange( NULL );
+  }
+
+private:
+
+  // The table
+  mutable std::atomic<const Table*> d_table;
+};
+
+} // end Utility namespace
+
+#endif // end UTILITY_LAZY_SAMPLING_TABLE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_LazySamplingTable.hpp
+//---------------------------------------------------------------------------//
@@ -64,7 +64,9 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
                     const bool interpret_dependent_values_as_cdf )
   : d_distribution( independent_values.size() ),
     d_norm_constant( DNQT::zero() ),
-    d_interpret_dependent_values_as_cdf( interpret_dependent_values_as_cdf )
+    d_interpret_dependent_values_as_cdf( interpret_dependent_values_as_cdf ),
+    d_constant_time_sampling( false ),
+    d_cdf_guide_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values, dependent_values );
@@ -105,7 +107,9 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
         const Utility::ArrayView<const double>& cdf_values )
   : d_distribution( independent_values.size() ),
     d_norm_constant( DNQT::zero() ),
-    d_interpret_dependent_values_as_cdf( true )
+    d_interpret_dependent_values_as_cdf( true ),
+    d_constant_time_sampling( false ),
+    d_cdf_guide_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values, cdf_values );
@@ -141,7 +145,9 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
         const Utility::ArrayView<const InputDepQuantity>& dependent_values )
   : d_distribution( independent_values.size() ),
     d_norm_constant( DNQT::zero() ),
-    d_interpret_dependent_values_as_cdf( false )
+    d_interpret_dependent_values_as_cdf( false ),
+    d_constant_time_sampling( false ),
+    d_cdf_guide_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values, dependent_values );
@@ -166,7 +172,9 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
  const UnitAwareTabularCDFDistribution<InterpolationPolicy,InputIndepUnit,InputDepUnit>& dist_instance )
   : d_distribution(),
     d_norm_constant(),
-    d_interpret_dependent_values_as_cdf( dist_instance.wasConstructedFromCDF() )
+    d_interpret_dependent_values_as_cdf( dist_instance.wasConstructedFromCDF() ),
+    d_constant_time_sampling( dist_instance.d_constant_time_sampling ),
+    d_cdf_guide_table()
 {
   typedef typename UnitAwareTabularCDFDistribution<InterpolationPolicy,InputIndepUnit,InputDepUnit>::IndepQuantity InputIndepQuantity;
 
@@ -209,7 +217,9 @@ template<typename InterpolationPolicy,
 UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::UnitAwareTabularCDFDistribution( const UnitAwareTabularCDFDistribution<InterpolationPolicy,void,void>& unitless_dist_instance, int )
   : d_distribution(),
     d_norm_constant(),
-    d_interpret_dependent_values_as_cdf( unitless_dist_instance.wasConstructedFromCDF() )
+    d_interpret_dependent_values_as_cdf( unitless_dist_instance.wasConstructedFromCDF() ),
+    d_constant_time_sampling( unitless_dist_instance.d_constant_time_sampling ),
+    d_cdf_guide_table()
 {
   // Make sure the distribution is valid
   testPrecondition( unitless_dist_instance.d_distribution.size() > 0 );
@@ -266,6 +276,8 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
     d_norm_constant = dist_instance.d_norm_constant;
     d_interpret_dependent_values_as_cdf =
       dist_instance.d_interpret_dependent_values_as_cdf;
+    d_constant_time_sampling = dist_instance.d_constant_time_sampling;
+    d_cdf_guide_table.reset();
   }
 
   return *this;
@@ -437,6 +449,75 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
   return this->sampleImplementation( scaled_random_number, dummy_index );
 }
 
+// Return the index of the bin that the scaled random number falls in
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+inline size_t UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::findSampledBinIndex(
+                      const UnnormCDFQuantity scaled_random_number ) const
+{
+  if( d_constant_time_sampling )
+  {
+    const CDFGuideTable& cdf_guide_table =
+      d_cdf_guide_table.get( [this](){return this->constructCDFGuideTable();} );
+
+    return cdf_guide_table.findLowerBinIndex(
+                             Utility::getRawQuantity( scaled_random_number ) );
+  }
+  else
+  {
+    return Search::binaryLowerBoundIndex<SECOND>( d_distribution.begin(),
+                                                   d_distribution.end(),
+                                                   scaled_random_number );
+  }
+}
+
+// Construct the cdf guide table
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+CDFGuideTable UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::constructCDFGuideTable() const
+{
+  std::vector<double> cdf( d_distribution.size() );
+
+  for( size_t i = 0; i < d_distribution.size(); ++i )
+    cdf[i] = Utility::getRawQuantity( Utility::get<1>(d_distribution[i]) );
+
+  return CDFGuideTable( Utility::arrayViewOfConst( cdf ) );
+}
+
+// Enable constant time (cdf guide table) sampling
+/*! \details When enabled, the bin that a random number falls in will be
+ * found using a cdf guide table, which will be constructed the first time
+ * that a sample is requested. The guide table search returns the same bin as
+ * the binary search so the samples will not be altered.
+ */
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+void UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::enableConstantTimeSampling()
+{
+  d_constant_time_sampling = true;
+}
+
+// Disable constant time (cdf guide table) sampling
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+void UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::disableConstantTimeSampling()
+{
+  d_constant_time_sampling = false;
+}
+
+// Check if constant time (cdf guide table) sampling is enabled
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+bool UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::isConstantTimeSamplingEnabled() const
+{
+  return d_constant_time_sampling;
+}
+
 // Return a random sample using the random number and record the bin index
 template<typename InterpolationPolicy,
          typename IndependentUnit,
@@ -455,9 +536,9 @@ UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,DependentUni
     Utility::get<1>(d_distribution.back());
 
   typename DistributionArray::const_iterator lower_bin_boundary =
-                Search::binaryLowerBound<SECOND>( d_distribution.begin(),
-                                                  d_distribution.end(),
-                                                  scaled_random_number );
+    d_distribution.begin();
+  std::advance( lower_bin_boundary,
+                this->findSampledBinIndex( scaled_random_number ) );
 
   // Calculate the sampled bin index
   sampled_bin_index = std::distance(d_distribution.begin(),lower_bin_boundary);
@@ -972,6 +1053,7 @@ void UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,Depende
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_interpret_dependent_values_as_cdf );
+  ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
 }
 
 // Load the distribution from an archive
@@ -988,6 +1070,13 @@ void UnitAwareTabularCDFDistribution<InterpolationPolicy,IndependentUnit,Depende
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
   ar & BOOST_SERIALIZATION_NVP( d_interpret_dependent_values_as_cdf );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
+  else
+    d_constant_time_sampling = false;
+
+  d_cdf_guide_table.reset();
 }
 
 } // end Utility namespace
@@ -11,6 +11,8 @@
 
 // FRENSIE Includes
 #include "Utility_TabularUnivariateDistribution.hpp"
+#include "Utility_CDFGuideTable.hpp"
+#include "Utility_LazySamplingTable.hpp"
 #include "Utility_InterpolationPolicy.hpp"
 #include "Utility_CosineInterpolationPolicy.hpp"
 #include "Utility_Tuple.hpp"
@@ -137,6 +139,15 @@ public:
 			    const double random_number,
 			    const IndepQuantity max_indep_var ) const override;
 
+  //! Enable constant time (cdf guide table) sampling
+  void enableConstantTimeSampling();
+
+  //! Disable constant time (cdf guide table) sampling
+  void disableConstantTimeSampling();
+
+  //! Check if constant time (cdf guide table) sampling is enabled
+  bool isConstantTimeSamplingEnabled() const;
+
   //! Return the upper bound of the distribution independent variable
   IndepQuantity getUpperBoundOfIndepVar() const override;
 
@@ -262,6 +273,13 @@ private:
   IndepQuantity sampleImplementation( double random_number,
 				      size_t& sampled_bin_index ) const;
 
+  // Return the index of the bin that the scaled random number falls in
+  size_t findSampledBinIndex(
+                      const UnnormCDFQuantity scaled_random_number ) const;
+
+  // Construct the cdf guide table
+  CDFGuideTable constructCDFGuideTable() const;
+
   // Verify that the values are valid
   template<typename InputIndepQuantity, typename InputDepQuantity>
   static void verifyValidValues(
@@ -298,6 +316,12 @@ private:
 
   // The normalization constant
   DistNormQuantity d_norm_constant;
+
+  // Bool to use constant time (cdf guide table) sampling
+  bool d_constant_time_sampling;
+
+  // The cdf guide table (constructed on the first constant time sample)
+  LazySamplingTable<CDFGuideTable> d_cdf_guide_table;
 };
 
 /*! The tabular distribution (unit-agnostic)
@@ -308,7 +332,7 @@ template<typename InterpolationPolicy> using TabularDistribution =
 
 } // end Utility namespace
 
-BOOST_SERIALIZATION_CLASS3_VERSION( UnitAwareTabularDistribution, Utility, 0 );
+BOOST_SERIALIZATION_CLASS3_VERSION( UnitAwareTabularDistribution, Utility, 1 );
 
 #define BOOST_SERIALIZATION_TABULAR_DISRIBUTION_EXPORT_STANDARD_KEY()   \
   BOOST_SERIALIZATION_CLASS3_EXPORT_STANDARD_KEY( UnitAwareTabularDistribution, Utility ) \
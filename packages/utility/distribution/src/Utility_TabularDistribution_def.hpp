@@ -49,7 +49,9 @@ UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>:
                     const Utility::ArrayView<const double>& independent_values,
                     const Utility::ArrayView<const double>& dependent_values )
   : d_distribution( independent_values.size() ),
-    d_norm_constant( DNQT::zero() )
+    d_norm_constant( DNQT::zero() ),
+    d_constant_time_sampling( false ),
+    d_cdf_guide_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values, dependent_values );
@@ -81,7 +83,9 @@ UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>:
         const Utility::ArrayView<const InputIndepQuantity>& independent_values,
         const Utility::ArrayView<const InputDepQuantity>& dependent_values )
   : d_distribution( independent_values.size() ),
-    d_norm_constant( DNQT::zero() )
+    d_norm_constant( DNQT::zero() ),
+    d_constant_time_sampling( false ),
+    d_cdf_guide_table()
 {
   // Verify that the values are valid
   this->verifyValidValues( independent_values, dependent_values );
@@ -105,7 +109,9 @@ template<typename InputIndepUnit, typename InputDepUnit>
 UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::UnitAwareTabularDistribution(
  const UnitAwareTabularDistribution<InterpolationPolicy,InputIndepUnit,InputDepUnit>& dist_instance )
   : d_distribution(),
-    d_norm_constant()
+    d_norm_constant(),
+    d_constant_time_sampling( dist_instance.d_constant_time_sampling ),
+    d_cdf_guide_table()
 {
   typedef typename UnitAwareTabularDistribution<InterpolationPolicy,InputIndepUnit,InputDepUnit>::IndepQuantity InputIndepQuantity;
 
@@ -130,7 +136,9 @@ template<typename InterpolationPolicy,
          typename DependentUnit>
 UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::UnitAwareTabularDistribution( const UnitAwareTabularDistribution<InterpolationPolicy,void,void>& unitless_dist_instance, int )
   : d_distribution(),
-    d_norm_constant()
+    d_norm_constant(),
+    d_constant_time_sampling( unitless_dist_instance.d_constant_time_sampling ),
+    d_cdf_guide_table()
 {
   // Reconstruct the original input distribution
   std::vector<double> input_indep_values, input_dep_values;
@@ -173,6 +181,8 @@ UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>:
   {
     d_distribution = dist_instance.d_distribution;
     d_norm_constant = dist_instance.d_norm_constant;
+    d_constant_time_sampling = dist_instance.d_constant_time_sampling;
+    d_cdf_guide_table.reset();
   }
 
   return *this;
@@ -354,6 +364,75 @@ UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>:
   return this->sampleImplementation( scaled_random_number, dummy_index );
 }
 
+// Return the index of the bin that the scaled random number falls in
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+inline size_t UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::findSampledBinIndex(
+                      const UnnormCDFQuantity scaled_random_number ) const
+{
+  if( d_constant_time_sampling )
+  {
+    const CDFGuideTable& cdf_guide_table =
+      d_cdf_guide_table.get( [this](){return this->constructCDFGuideTable();} );
+
+    return cdf_guide_table.findLowerBinIndex(
+                             Utility::getRawQuantity( scaled_random_number ) );
+  }
+  else
+  {
+    return Search::binaryLowerBoundIndex<1>( d_distribution.begin(),
+                                              d_distribution.end(),
+                                              scaled_random_number );
+  }
+}
+
+// Construct the cdf guide table
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+CDFGuideTable UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::constructCDFGuideTable() const
+{
+  std::vector<double> cdf( d_distribution.size() );
+
+  for( size_t i = 0; i < d_distribution.size(); ++i )
+    cdf[i] = Utility::getRawQuantity( Utility::get<1>(d_distribution[i]) );
+
+  return CDFGuideTable( Utility::arrayViewOfConst( cdf ) );
+}
+
+// Enable constant time (cdf guide table) sampling
+/*! \details When enabled, the bin that a random number falls in will be
+ * found using a cdf guide table, which will be constructed the first time
+ * that a sample is requested. The guide table search returns the same bin as
+ * the binary search so the samples will not be altered.
+ */
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+void UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::enableConstantTimeSampling()
+{
+  d_constant_time_sampling = true;
+}
+
+// Disable constant time (cdf guide table) sampling
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+void UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::disableConstantTimeSampling()
+{
+  d_constant_time_sampling = false;
+}
+
+// Check if constant time (cdf guide table) sampling is enabled
+template<typename InterpolationPolicy,
+         typename IndependentUnit,
+         typename DependentUnit>
+bool UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>::isConstantTimeSamplingEnabled() const
+{
+  return d_constant_time_sampling;
+}
+
 // Return a random sample using the random number and record the bin index
 template<typename InterpolationPolicy,
          typename IndependentUnit,
@@ -371,13 +450,10 @@ UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentUnit>:
   UnnormCDFQuantity scaled_random_number = random_number*
     Utility::get<1>(d_distribution.back());
 
-  typename DistributionArray::const_iterator start, end, lower_bin_boundary;
-  start = d_distribution.begin();
-  end = d_distribution.end();
-
-  lower_bin_boundary = Search::binaryLowerBound<1>( start,
-                                                    end,
-                                                    scaled_random_number);
+  typename DistributionArray::const_iterator lower_bin_boundary =
+    d_distribution.begin();
+  std::advance( lower_bin_boundary,
+                this->findSampledBinIndex( scaled_random_number ) );
 
   // Calculate the sampled bin index
   sampled_bin_index = std::distance(d_distribution.begin(),lower_bin_boundary);
@@ -491,6 +567,7 @@ void UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentU
   // Save the local member data
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
+  ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
 }
 
 // Load the distribution from an archive
@@ -506,6 +583,13 @@ void UnitAwareTabularDistribution<InterpolationPolicy,IndependentUnit,DependentU
   // Load the local member data
   ar & BOOST_SERIALIZATION_NVP( d_distribution );
   ar & BOOST_SERIALIZATION_NVP( d_norm_constant );
+
+  if( version > 0 )
+    ar & BOOST_SERIALIZATION_NVP( d_constant_time_sampling );
+  else
+    d_constant_time_sampling = false;
+
+  d_cdf_guide_table.reset();
 }
 
 // Method for testing if two objects are equivalent
@@ -21,6 +21,49 @@
 
 namespace Utility{
 
+namespace Details{
+
+/*! \brief The secondary distribution evaluation functor
+ *
+ * This functor is used instead of a bound std::function object to avoid
+ * type erasure (and possible heap allocations) every time that a unit-base
+ * evaluation between bin boundaries is done.
+ */
+template<typename BaseUnivariateDistributionType,
+         typename YIndepType,
+         typename ReturnType,
+         typename EvaluationMethod>
+class SecondaryEvaluationFunctor
+{
+
+public:
+
+  //! The result type
+  typedef ReturnType result_type;
+
+  //! Constructor
+  SecondaryEvaluationFunctor(
+                         const BaseUnivariateDistributionType& distribution,
+                         const EvaluationMethod& evaluate )
+    : d_distribution( &distribution ),
+      d_evaluate( evaluate )
+  { /* ... */ }
+
+  //! Evaluate the secondary distribution
+  inline ReturnType operator()( const YIndepType y_indep_value ) const
+  { return ((*d_distribution).*d_evaluate)( y_indep_value ); }
+
+private:
+
+  // The secondary distribution
+  const BaseUnivariateDistributionType* d_distribution;
+
+  // The evaluation method
+  EvaluationMethod d_evaluate;
+};
+
+} // end Details namespace
+
 // Calculate the Y independent lower bound between bin boundaries
 /*! \details The lower bound will be the minimum of the two boundary
  * lower bounds.
@@ -435,7 +478,7 @@ YIndepType Direct<_TwoDInterpPolicy>::sampleCosDetailed(
             YIndepType& raw_sample )
 {
 
-  std::function<YIndepType(const XIndepType)> dummy_functor =
+  auto dummy_functor =
     [](XIndepType x){return QuantityTraits<YIndepType>::zero();};
 
   return Direct<TwoDInterpPolicy>::sampleDetailed<XIndepType, YIndepType, YZIterator, SampleFunctor>(
@@ -678,17 +721,13 @@ ReturnType UnitBase<_TwoDInterpPolicy>::evaluatePDF(
   else
   {
     // Create the grid evaluation functors
-    std::function<ReturnType(const YIndepType)>
-      evaluate_grid_0_functor =
-      std::bind<ReturnType>( evaluate,
-                            std::cref( *lower_bin_boundary->second ),
-                            std::placeholders::_1 );
-
-    std::function<ReturnType(const YIndepType)>
-      evaluate_grid_1_functor =
-      std::bind<ReturnType>( evaluate,
-                            std::cref( *upper_bin_boundary->second ),
-                            std::placeholders::_1 );
+    typedef Details::SecondaryEvaluationFunctor<BaseUnivariateDistributionType,YIndepType,ReturnType,EvaluationMethod> EvaluationFunctor;
+
+    const EvaluationFunctor evaluate_grid_0_functor(
+                                  *lower_bin_boundary->second, evaluate );
+
+    const EvaluationFunctor evaluate_grid_1_functor(
+                                  *upper_bin_boundary->second, evaluate );
 
     return TwoDInterpPolicy::interpolateUnitBase(
                           lower_bin_boundary->first,
@@ -0,0 +1,198 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstAliasTable.cpp
+//! \author Alex Robinson
+//! \brief  Alias table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_AliasTable.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that an alias table can be constructed
+FRENSIE_UNIT_TEST( AliasTable, constructor )
+{
+  Utility::AliasTable alias_table;
+
+  FRENSIE_CHECK( alias_table.empty() );
+  FRENSIE_CHECK_EQUAL( alias_table.size(), 0 );
+
+  std::vector<double> weights( {1.0, 2.0, 1.0} );
+
+  FRENSIE_CHECK_NO_THROW( alias_table = Utility::AliasTable( Utility::arrayViewOfConst( weights ) ) );
+  FRENSIE_CHECK( !alias_table.empty() );
+  FRENSIE_CHECK_EQUAL( alias_table.size(), 3 );
+
+  weights.clear();
+
+  FRENSIE_CHECK_THROW( Utility::AliasTable( Utility::arrayViewOfConst( weights ) ),
+                       std::runtime_error );
+
+  weights = {1.0, -1.0, 1.0};
+
+  FRENSIE_CHECK_THROW( Utility::AliasTable( Utility::arrayViewOfConst( weights ) ),
+                       std::runtime_error );
+
+  weights = {0.0, 0.0};
+
+  FRENSIE_CHECK_THROW( Utility::AliasTable( Utility::arrayViewOfConst( weights ) ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an index can be sampled from the table
+FRENSIE_UNIT_TEST( AliasTable, sampleIndex )
+{
+  std::vector<double> weights( {1.0, 2.0, 1.0} );
+
+  Utility::AliasTable alias_table( Utility::arrayViewOfConst( weights ) );
+
+  double residual_random_number;
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.0, residual_random_number ), 0 );
+  FRENSIE_CHECK_EQUAL( residual_random_number, 0.0 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.2, residual_random_number ), 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( residual_random_number, 0.8, 1e-12 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.3, residual_random_number ), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( residual_random_number, 0.6, 1e-12 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.5, residual_random_number ), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( residual_random_number, 0.5, 1e-12 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.9, residual_random_number ), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( residual_random_number, 0.7/0.75, 1e-12 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 1.0, residual_random_number ), 1 );
+  FRENSIE_CHECK( residual_random_number >= 0.0 );
+  FRENSIE_CHECK( residual_random_number < 1.0 );
+
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.0 ), 0 );
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.5 ), 1 );
+  FRENSIE_CHECK_EQUAL( alias_table.sampleIndex( 0.9 ), 2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that zero weight indices are never sampled
+FRENSIE_UNIT_TEST( AliasTable, sampleIndex_zero_weights )
+{
+  std::vector<double> weights( {0.0, 1.0, 0.0, 3.0, 0.0} );
+
+  Utility::AliasTable alias_table( Utility::arrayViewOfConst( weights ) );
+
+  for( size_t i = 0; i <= 1000; ++i )
+  {
+    size_t index = alias_table.sampleIndex( i/1000.0 );
+
+    FRENSIE_CHECK( index == 1 || index == 3 );
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the sampled indices have the correct distribution
+FRENSIE_UNIT_TEST( AliasTable, sampleIndex_statistics )
+{
+  std::vector<double> weights( {1.0, 2.0, 3.0, 4.0, 0.5, 9.5} );
+
+  Utility::AliasTable alias_table( Utility::arrayViewOfConst( weights ) );
+
+  const size_t number_of_samples = 1000000;
+
+  std::vector<double> index_counts( weights.size(), 0.0 );
+  double residual_random_number_sum = 0.0;
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+  {
+    double residual_random_number;
+
+    size_t index = alias_table.sampleIndex(
+                        Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                        residual_random_number );
+
+    index_counts[index] += 1.0;
+    residual_random_number_sum += residual_random_number;
+  }
+
+  for( size_t i = 0; i < weights.size(); ++i )
+  {
+    FRENSIE_CHECK_FLOATING_EQUALITY( index_counts[i]/number_of_samples,
+                                     weights[i]/20.0,
+                                     2e-2 );
+  }
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( residual_random_number_sum/number_of_samples,
+                                   0.5,
+                                   1e-2 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an alias table can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( AliasTable, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_alias_table" );
+  std::ostringstream archive_ostream;
+
+  std::vector<double> weights( {1.0, 2.0, 3.0, 4.0} );
+
+  Utility::AliasTable original_alias_table( Utility::arrayViewOfConst( weights ) );
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << boost::serialization::make_nvp( "alias_table", original_alias_table ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived table
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  Utility::AliasTable alias_table;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> boost::serialization::make_nvp( "alias_table", alias_table ) );
+  FRENSIE_CHECK( alias_table == original_alias_table );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstAliasTable.cpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,176 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstCDFGuideTable.cpp
+//! \author Alex Robinson
+//! \brief  CDF guide table unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_CDFGuideTable.hpp"
+#include "Utility_SearchAlgorithms.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+#include "ArchiveTestHelpers.hpp"
+
+//---------------------------------------------------------------------------//
+// Testing Types
+//---------------------------------------------------------------------------//
+
+typedef TestArchiveHelper::TestArchives TestArchives;
+
+//---------------------------------------------------------------------------//
+// Testing Variables
+//---------------------------------------------------------------------------//
+
+// A cdf with repeated values (zero probability bins) and a nonzero start
+std::vector<double> cdf( {0.5, 0.5, 0.75, 1.0, 1.0, 1.0, 2.0, 2.0, 2.25, 2.5,
+                          4.0, 4.5, 4.5} );
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a cdf guide table can be constructed
+FRENSIE_UNIT_TEST( CDFGuideTable, constructor )
+{
+  Utility::CDFGuideTable guide_table;
+
+  FRENSIE_CHECK( guide_table.empty() );
+  FRENSIE_CHECK_EQUAL( guide_table.size(), 0 );
+
+  FRENSIE_CHECK_NO_THROW( guide_table = Utility::CDFGuideTable( Utility::arrayViewOfConst( cdf ) ) );
+  FRENSIE_CHECK( !guide_table.empty() );
+  FRENSIE_CHECK_EQUAL( guide_table.size(), cdf.size() );
+  FRENSIE_CHECK_EQUAL( guide_table.getNumberOfSlots(), cdf.size() );
+
+  FRENSIE_CHECK_NO_THROW( guide_table = Utility::CDFGuideTable( Utility::arrayViewOfConst( cdf ), 3 ) );
+  FRENSIE_CHECK_EQUAL( guide_table.size(), cdf.size() );
+  FRENSIE_CHECK_EQUAL( guide_table.getNumberOfSlots(), 3 );
+
+  std::vector<double> bad_cdf;
+
+  FRENSIE_CHECK_THROW( Utility::CDFGuideTable( Utility::arrayViewOfConst( bad_cdf ) ),
+                       std::runtime_error );
+
+  bad_cdf = {0.0, 0.5, 0.25, 1.0};
+
+  FRENSIE_CHECK_THROW( Utility::CDFGuideTable( Utility::arrayViewOfConst( bad_cdf ) ),
+                       std::runtime_error );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the lower bin index can be found
+FRENSIE_UNIT_TEST( CDFGuideTable, findLowerBinIndex )
+{
+  std::vector<size_t> numbers_of_slots( {1, 2, 3, 13, 100} );
+
+  for( size_t i = 0; i < numbers_of_slots.size(); ++i )
+  {
+    Utility::CDFGuideTable guide_table( Utility::arrayViewOfConst( cdf ),
+                                        numbers_of_slots[i] );
+
+    // Check the values in the table
+    for( size_t j = 0; j < cdf.size(); ++j )
+    {
+      FRENSIE_CHECK_EQUAL( guide_table.findLowerBinIndex( cdf[j] ),
+                           Utility::Search::binaryLowerBoundIndex( cdf.begin(), cdf.end(), cdf[j] ) );
+    }
+
+    // Check random values
+    for( size_t j = 0; j < 1000; ++j )
+    {
+      double value = cdf.front() + (cdf.back() - cdf.front())*
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+      FRENSIE_CHECK_EQUAL( guide_table.findLowerBinIndex( value ),
+                           Utility::Search::binaryLowerBoundIndex( cdf.begin(), cdf.end(), value ) );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that the upper bin index can be found
+FRENSIE_UNIT_TEST( CDFGuideTable, findUpperBinIndex )
+{
+  std::vector<size_t> numbers_of_slots( {1, 2, 3, 13, 100} );
+
+  for( size_t i = 0; i < numbers_of_slots.size(); ++i )
+  {
+    Utility::CDFGuideTable guide_table( Utility::arrayViewOfConst( cdf ),
+                                        numbers_of_slots[i] );
+
+    // Check the values in the table
+    for( size_t j = 0; j < cdf.size(); ++j )
+    {
+      FRENSIE_CHECK_EQUAL( guide_table.findUpperBinIndex( cdf[j] ),
+                           Utility::Search::binaryUpperBoundIndex( cdf.begin(), cdf.end(), cdf[j] ) );
+    }
+
+    // Check random values
+    for( size_t j = 0; j < 1000; ++j )
+    {
+      double value = cdf.back()*
+        Utility::RandomNumberGenerator::getRandomNumber<double>();
+
+      FRENSIE_CHECK_EQUAL( guide_table.findUpperBinIndex( value ),
+                           Utility::Search::binaryUpperBoundIndex( cdf.begin(), cdf.end(), value ) );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+// Check that a cdf guide table can be archived
+FRENSIE_UNIT_TEST_TEMPLATE_EXPAND( CDFGuideTable, archive, TestArchives )
+{
+  FETCH_TEMPLATE_PARAM( 0, RawOArchive );
+  FETCH_TEMPLATE_PARAM( 1, RawIArchive );
+
+  typedef typename std::remove_pointer<RawOArchive>::type OArchive;
+  typedef typename std::remove_pointer<RawIArchive>::type IArchive;
+
+  std::string archive_base_name( "test_cdf_guide_table" );
+  std::ostringstream archive_ostream;
+
+  Utility::CDFGuideTable original_guide_table( Utility::arrayViewOfConst( cdf ), 5 );
+
+  {
+    std::unique_ptr<OArchive> oarchive;
+
+    createOArchive( archive_base_name, archive_ostream, oarchive );
+
+    FRENSIE_REQUIRE_NO_THROW( (*oarchive) << boost::serialization::make_nvp( "guide_table", original_guide_table ) );
+  }
+
+  // Copy the archive ostream to an istream
+  std::istringstream archive_istream( archive_ostream.str() );
+
+  // Load the archived table
+  std::unique_ptr<IArchive> iarchive;
+
+  createIArchive( archive_istream, iarchive );
+
+  Utility::CDFGuideTable guide_table;
+
+  FRENSIE_REQUIRE_NO_THROW( (*iarchive) >> boost::serialization::make_nvp( "guide_table", guide_table ) );
+  FRENSIE_CHECK( guide_table == original_guide_table );
+}
+
+//---------------------------------------------------------------------------//
+// Custom setup
+//---------------------------------------------------------------------------//
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_BEGIN();
+
+FRENSIE_CUSTOM_UNIT_TEST_INIT()
+{
+  // Initialize the random number generator
+  Utility::RandomNumberGenerator::createStreams();
+}
+
+FRENSIE_CUSTOM_UNIT_TEST_SETUP_END();
+
+//---------------------------------------------------------------------------//
+// end tstCDFGuideTable.cpp
+//---------------------------------------------------------------------------//
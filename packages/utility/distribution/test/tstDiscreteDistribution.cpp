@@ -1363,6 +1363,67 @@ FRENSIE_UNIT_TEST( UnitAwareDiscreteDistribution,
   FRENSIE_CHECK_EQUAL( sample, 1.0*eV );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled using the alias table
+FRENSIE_UNIT_TEST( DiscreteDistribution, sample_constant_time )
+{
+  std::vector<double> independent_values( {-1.0, 0.0, 1.0} );
+  std::vector<double> dependent_values( {1.0, 2.0, 1.0} );
+
+  Utility::DiscreteDistribution alias_distribution( independent_values,
+                                                    dependent_values );
+
+  FRENSIE_CHECK( !alias_distribution.isConstantTimeSamplingEnabled() );
+
+  alias_distribution.enableConstantTimeSampling();
+
+  FRENSIE_CHECK( alias_distribution.isConstantTimeSamplingEnabled() );
+
+  std::vector<double> fake_stream( 5 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.2;
+  fake_stream[2] = 0.3;
+  fake_stream[3] = 0.5;
+  fake_stream[4] = 0.9;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  size_t bin_index;
+
+  double sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, -1.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 0u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, -1.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 0u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sample();
+  FRENSIE_CHECK_EQUAL( sample, 1.0 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The random number methods always use the inverse cdf method
+  FRENSIE_CHECK_EQUAL( alias_distribution.sampleWithRandomNumber( 0.3 ), 0.0 );
+
+  // Copies keep the sampling mode
+  Utility::DiscreteDistribution copy_distribution( alias_distribution );
+
+  FRENSIE_CHECK( copy_distribution.isConstantTimeSamplingEnabled() );
+
+  alias_distribution.disableConstantTimeSampling();
+
+  FRENSIE_CHECK( !alias_distribution.isConstantTimeSamplingEnabled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the upper bound of the distribution independent variable can be
 // returned
@@ -0,0 +1,146 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstDistributionSamplingBenchmark.cpp
+//! \author Alex Robinson
+//! \brief  Tabular distribution sampling rate micro-benchmark
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+
+// FRENSIE Includes
+#include "Utility_DiscreteDistribution.hpp"
+#include "Utility_HistogramDistribution.hpp"
+#include "Utility_TabularDistribution.hpp"
+#include "Utility_TabularCDFDistribution.hpp"
+#include "Utility_RandomNumberGenerator.hpp"
+#include "Utility_Timer.hpp"
+
+//---------------------------------------------------------------------------//
+// Benchmark Functions.
+//---------------------------------------------------------------------------//
+// Return the number of samples per second drawn from the distribution
+template<typename Distribution>
+double calculateSamplingRate( const Distribution& distribution,
+                              const size_t number_of_samples )
+{
+  std::shared_ptr<Utility::Timer> timer = Utility::createDefaultTimer();
+
+  double sample_sum = 0.0;
+
+  timer->start();
+
+  for( size_t i = 0; i < number_of_samples; ++i )
+    sample_sum += distribution.sample();
+
+  timer->stop();
+
+  // Prevent the sampling loop from being optimized away
+  if( std::isnan( sample_sum ) )
+    std::cerr << "Warning: a nan sample was drawn!" << std::endl;
+
+  return number_of_samples/timer->elapsed().count();
+}
+
+// Report the sampling rates of the distribution
+template<typename Distribution>
+void reportSamplingRates( const std::string& distribution_name,
+                          Distribution& distribution,
+                          const size_t number_of_samples )
+{
+  distribution.disableConstantTimeSampling();
+
+  const double search_rate =
+    calculateSamplingRate( distribution, number_of_samples );
+
+  // The first sample constructs the table - don't include it in the timing
+  distribution.enableConstantTimeSampling();
+  distribution.sample();
+
+  const double constant_time_rate =
+    calculateSamplingRate( distribution, number_of_samples );
+
+  std::cout << std::setw(24) << std::left << distribution_name
+            << std::setw(16) << std::right << std::scientific
+            << std::setprecision(4) << search_rate
+            << std::setw(16) << constant_time_rate
+            << std::setw(10) << std::fixed << std::setprecision(2)
+            << constant_time_rate/search_rate << std::endl;
+}
+
+//---------------------------------------------------------------------------//
+// Main Benchmark Program
+//---------------------------------------------------------------------------//
+int main( int argc, char** argv )
+{
+  size_t number_of_bins = 1000;
+  size_t number_of_samples = 10000000;
+
+  if( argc > 1 )
+    number_of_bins = std::strtoul( argv[1], NULL, 10 );
+
+  if( argc > 2 )
+    number_of_samples = std::strtoul( argv[2], NULL, 10 );
+
+  if( number_of_bins < 2 || number_of_samples == 0 )
+  {
+    std::cerr << "Usage: " << argv[0] << " [number_of_bins >= 2] "
+              << "[number_of_samples > 0]" << std::endl;
+
+    return 1;
+  }
+
+  Utility::RandomNumberGenerator::createStreams();
+
+  // Create a rapidly varying (and therefore nonuniform) tabular grid
+  std::vector<double> independent_values( number_of_bins+1 );
+  std::vector<double> dependent_values( number_of_bins+1 );
+
+  for( size_t i = 0; i <= number_of_bins; ++i )
+  {
+    independent_values[i] = 1e-3*std::pow( 1e6, i/(double)number_of_bins );
+    dependent_values[i] = 1.0 + 0.9*std::sin( 0.1*i ) +
+      std::exp( -(i - 0.3*number_of_bins)*(i - 0.3*number_of_bins)/100.0 );
+  }
+
+  std::vector<double> bin_values( dependent_values.begin(),
+                                  dependent_values.end() - 1 );
+
+  Utility::DiscreteDistribution
+    discrete_distribution( independent_values, dependent_values );
+
+  Utility::HistogramDistribution
+    histogram_distribution( independent_values, bin_values );
+
+  Utility::TabularDistribution<Utility::LinLin>
+    tabular_distribution( independent_values, dependent_values );
+
+  Utility::TabularCDFDistribution<Utility::LinLin>
+    tabular_cdf_distribution( independent_values, dependent_values );
+
+  std::cout << "Sampling rates (samples/s) using " << number_of_bins
+            << " bins and " << number_of_samples << " samples" << std::endl;
+
+  std::cout << std::setw(24) << std::left << "Distribution"
+            << std::setw(16) << std::right << "Binary Search"
+            << std::setw(16) << "Constant Time"
+            << std::setw(10) << "Speedup" << std::endl;
+
+  reportSamplingRates( "Discrete", discrete_distribution, number_of_samples );
+  reportSamplingRates( "Histogram", histogram_distribution, number_of_samples );
+  reportSamplingRates( "Tabular (Lin-Lin)", tabular_distribution, number_of_samples );
+  reportSamplingRates( "TabularCDF (Lin-Lin)", tabular_cdf_distribution, number_of_samples );
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+// end tstDistributionSamplingBenchmark.cpp
+//---------------------------------------------------------------------------//
@@ -1308,6 +1308,64 @@ FRENSIE_UNIT_TEST( UnitAwareHistogramDistribution,
   FRENSIE_CHECK_FLOATING_EQUALITY( sample, 1.0*MeV, 1e-14 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled using the alias table
+FRENSIE_UNIT_TEST( HistogramDistribution, sample_constant_time )
+{
+  std::vector<double> bin_boundaries( {0.0, 1.0, 3.0} );
+  std::vector<double> bin_values( {1.0, 1.0} );
+
+  Utility::HistogramDistribution alias_distribution( bin_boundaries,
+                                                     bin_values );
+
+  FRENSIE_CHECK( !alias_distribution.isConstantTimeSamplingEnabled() );
+
+  alias_distribution.enableConstantTimeSampling();
+
+  FRENSIE_CHECK( alias_distribution.isConstantTimeSamplingEnabled() );
+
+  std::vector<double> fake_stream( 4 );
+  fake_stream[0] = 0.0;
+  fake_stream[1] = 0.25;
+  fake_stream[2] = 0.4;
+  fake_stream[3] = 0.75;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  size_t bin_index;
+
+  double sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_EQUAL( sample, 0.0 );
+  FRENSIE_CHECK_EQUAL( bin_index, 0u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_FLOATING_EQUALITY( sample, 0.75, 1e-12 );
+  FRENSIE_CHECK_EQUAL( bin_index, 0u );
+
+  sample = alias_distribution.sampleAndRecordBinIndex( bin_index );
+  FRENSIE_CHECK_FLOATING_EQUALITY( sample, 1.8, 1e-12 );
+  FRENSIE_CHECK_EQUAL( bin_index, 1u );
+
+  sample = alias_distribution.sample();
+  FRENSIE_CHECK_FLOATING_EQUALITY( sample, 2.0, 1e-12 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  // The random number methods always use the inverse cdf method
+  FRENSIE_CHECK_FLOATING_EQUALITY( alias_distribution.sampleWithRandomNumber( 0.5 ),
+                                   1.5,
+                                   1e-12 );
+
+  // Copies keep the sampling mode
+  Utility::HistogramDistribution copy_distribution( alias_distribution );
+
+  FRENSIE_CHECK( copy_distribution.isConstantTimeSamplingEnabled() );
+
+  alias_distribution.disableConstantTimeSampling();
+
+  FRENSIE_CHECK( !alias_distribution.isConstantTimeSamplingEnabled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the upper bound of the distribution independent variable can be
 // returned
@@ -530,6 +530,62 @@ FRENSIE_UNIT_TEST_TEMPLATE( UnitAwareTabularDistribution,
   FRENSIE_CHECK_FLOATING_EQUALITY( sample, 1.0*MeV, 1e-12 );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the distribution can be sampled using the cdf guide table
+FRENSIE_UNIT_TEST_TEMPLATE( TabularDistribution,
+                            sample_constant_time,
+                            TestInterpPolicies )
+{
+  FETCH_TEMPLATE_PARAM( 0, InterpolationPolicy );
+
+  initialize<InterpolationPolicy>( tab_distribution );
+
+  std::shared_ptr<Utility::TabularUnivariateDistribution> guide_distribution;
+
+  initialize<InterpolationPolicy>( guide_distribution );
+
+  Utility::TabularDistribution<InterpolationPolicy>& raw_guide_distribution =
+    dynamic_cast<Utility::TabularDistribution<InterpolationPolicy>&>( *guide_distribution );
+
+  FRENSIE_CHECK( !raw_guide_distribution.isConstantTimeSamplingEnabled() );
+
+  raw_guide_distribution.enableConstantTimeSampling();
+
+  FRENSIE_CHECK( raw_guide_distribution.isConstantTimeSamplingEnabled() );
+
+  // The guide table must select the same bins as the binary search
+  std::vector<double> fake_stream( 1001 );
+
+  for( size_t i = 0; i < fake_stream.size() - 1; ++i )
+    fake_stream[i] = i/1000.0;
+
+  fake_stream.back() = 1.0 - 1e-15;
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  std::vector<double> samples( fake_stream.size() );
+  std::vector<size_t> bin_indices( fake_stream.size() );
+
+  for( size_t i = 0; i < fake_stream.size(); ++i )
+    samples[i] = tab_distribution->sampleAndRecordBinIndex( bin_indices[i] );
+
+  for( size_t i = 0; i < fake_stream.size(); ++i )
+  {
+    size_t bin_index;
+
+    double sample = guide_distribution->sampleAndRecordBinIndex( bin_index );
+
+    FRENSIE_CHECK_EQUAL( sample, samples[i] );
+    FRENSIE_CHECK_EQUAL( bin_index, bin_indices[i] );
+  }
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  raw_guide_distribution.disableConstantTimeSampling();
+
+  FRENSIE_CHECK( !raw_guide_distribution.isConstantTimeSamplingEnabled() );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the distribution can be sampled from a subrange
 FRENSIE_UNIT_TEST_TEMPLATE( TabularDistribution,
@@ -478,6 +478,62 @@ public:
 
 private:
 
+  /*! The y grid interpolation functor
+   *
+   * This functor is used instead of a bound std::function object to avoid
+   * type erasure (and possible heap allocations) every time that an
+   * interpolation between two grids is done.
+   */
+  template<size_t YIndepMember,
+	   size_t DepMember,
+	   typename YIterator,
+	   typename ZIterator,
+	   typename T>
+  class YGridInterpolationFunctor
+  {
+
+  public:
+
+    //! The result type
+    typedef T result_type;
+
+    //! Constructor
+    YGridInterpolationFunctor( YIterator start_indep_y_grid,
+                               YIterator end_indep_y_grid,
+                               ZIterator start_dep_grid,
+                               ZIterator end_dep_grid )
+      : d_start_indep_y_grid( start_indep_y_grid ),
+        d_end_indep_y_grid( end_indep_y_grid ),
+        d_start_dep_grid( start_dep_grid ),
+        d_end_dep_grid( end_dep_grid )
+    { /* ... */ }
+
+    //! Interpolate on the y grid
+    inline T operator()( const T indep_var_y ) const
+    {
+      return ThisType::interpolateOnYGrid<YIndepMember,DepMember>(
+                                                         indep_var_y,
+                                                         d_start_indep_y_grid,
+                                                         d_end_indep_y_grid,
+                                                         d_start_dep_grid,
+                                                         d_end_dep_grid );
+    }
+
+  private:
+
+    // The start of the y grid
+    YIterator d_start_indep_y_grid;
+
+    // The end of the y grid
+    YIterator d_end_indep_y_grid;
+
+    // The start of the dependent grid
+    ZIterator d_start_dep_grid;
+
+    // The end of the dependent grid
+    ZIterator d_end_dep_grid;
+  };
+
   // Calculate the "fuzzy" lower bound (lower bound with roundoff tolerance)
   template<typename T>
   static T calculateFuzzyLowerBound( const T lower_bound,
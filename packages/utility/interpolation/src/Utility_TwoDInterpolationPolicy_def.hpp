@@ -245,21 +245,17 @@ TwoDInterpolationPolicyImpl<ZYInterpPolicy,ZXInterpPolicy>::interpolate(
             std::distance( start_dep_grid_1, end_dep_grid_1 ) );
 
   // Create the grid interpolation functors
-  std::function<T(T)> interpolate_grid_0_functor =
-    std::bind<T>( &ThisType::interpolateOnYGrid<YIndepMember,DepMember,YIterator,ZIterator,T>,
-                       std::placeholders::_1,
-                       start_indep_y_grid_0,
-                       end_indep_y_grid_0,
-                       start_dep_grid_0,
-                       end_dep_grid_0 );
-
-  std::function<T(T)> interpolate_grid_1_functor =
-    std::bind<T>( &ThisType::interpolateOnYGrid<YIndepMember,DepMember,YIterator,ZIterator,T>,
-                       std::placeholders::_1,
-                       start_indep_y_grid_1,
-                       end_indep_y_grid_1,
-                       start_dep_grid_1,
-                       end_dep_grid_1 );
+  const YGridInterpolationFunctor<YIndepMember,DepMember,YIterator,ZIterator,T>
+    interpolate_grid_0_functor( start_indep_y_grid_0,
+                                  end_indep_y_grid_0,
+                                  start_dep_grid_0,
+                                  end_dep_grid_0 );
+
+  const YGridInterpolationFunctor<YIndepMember,DepMember,YIterator,ZIterator,T>
+    interpolate_grid_1_functor( start_indep_y_grid_1,
+                                  end_indep_y_grid_1,
+                                  start_dep_grid_1,
+                                  end_dep_grid_1 );
 
   return ThisType::interpolate( indep_var_x_0,
                                 indep_var_x_1,
@@ -763,21 +759,17 @@ inline T TwoDInterpolationPolicyImpl<ZYInterpPolicy,ZXInterpPolicy>::interpolate
   --true_end_indep_y_grid_1;
 
   // Create the grid interpolation functors
-  std::function<T(T)> interpolate_grid_0_functor =
-    std::bind<T>( &ThisType::interpolateOnYGrid<YIndepMember,DepMember,YIterator,ZIterator,T>,
-                  std::placeholders::_1,
-                  start_indep_y_grid_0,
-                  end_indep_y_grid_0,
-                  start_dep_grid_0,
-                  end_dep_grid_0 );
-
-  std::function<T(T)> interpolate_grid_1_functor =
-    std::bind<T>( &ThisType::interpolateOnYGrid<YIndepMember,DepMember,YIterator,ZIterator,T>,
-                  std::placeholders::_1,
-                  start_indep_y_grid_1,
-                  end_indep_y_grid_1,
-                  start_dep_grid_1,
-                  end_dep_grid_1 );
+  const YGridInterpolationFunctor<YIndepMember,DepMember,YIterator,ZIterator,T>
+    interpolate_grid_0_functor( start_indep_y_grid_0,
+                                  end_indep_y_grid_0,
+                                  start_dep_grid_0,
+                                  end_dep_grid_0 );
+
+  const YGridInterpolationFunctor<YIndepMember,DepMember,YIterator,ZIterator,T>
+    interpolate_grid_1_functor( start_indep_y_grid_1,
+                                  end_indep_y_grid_1,
+                                  start_dep_grid_1,
+                                  end_dep_grid_1 );
 
   return ThisType::interpolateUnitBase(
                                  indep_var_x_0,
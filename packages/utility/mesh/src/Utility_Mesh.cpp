@@ -21,6 +21,18 @@
 
 namespace Utility{
 
+// Determine the mesh element that contains a given point (element hint)
+/*! \details The element hint is usually the element that contained the
+ * point the last time that it was located (e.g. before a particle moved).
+ * Meshes that can take advantage of the hint should override this method.
+ * The default implementation ignores the hint.
+ */
+auto Mesh::whichElementIsPointIn( const double point[3],
+                                  const ElementHandle ) const -> ElementHandle
+{
+  return this->whichElementIsPointIn( point );
+}
+
 // Export the mesh to a file
 void Mesh::exportData( const std::string& output_file_name ) const
 {
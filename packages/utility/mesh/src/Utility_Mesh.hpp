@@ -85,6 +85,11 @@ public:
   //! Determine the mesh element that contains a given point
   virtual ElementHandle whichElementIsPointIn( const double point[3] ) const = 0;
 
+  //! Determine the mesh element that contains a given point (element hint)
+  virtual ElementHandle whichElementIsPointIn(
+                                const double point[3],
+                                const ElementHandle element_hint ) const;
+
   //! Determine the mesh elements that a line segment intersects
   virtual void computeTrackLengths(
               const double start_point[3],
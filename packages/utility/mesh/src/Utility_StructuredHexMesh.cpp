@@ -7,7 +7,8 @@
 //---------------------------------------------------------------------------//
 
 //std includes
-#include <math.h>
+#include <cmath>
+#include <utility>
 
 // FRENSIE Includes
 #include "FRENSIE_Archives.hpp" // This must be included first
@@ -70,6 +71,8 @@ StructuredHexMesh::StructuredHexMesh( const std::vector<double>& x_planes,
     }
   }
 
+  this->initializeTraversalData();
+
 #ifndef HAVE_FRENSIE_MOAB
   FRENSIE_LOG_TAGGED_WARNING( "StructuredHexMesh",
                               "Cannot export mesh data to vtk because moab "
@@ -165,33 +168,51 @@ auto StructuredHexMesh::whichElementIsPointIn( const double point[3] ) const ->
   // Make sure that the point is in the mesh
   testPrecondition( this->isPointInMesh(point) );
 
-  size_t x_index = Search::binaryLowerBoundIndex( d_x_planes.begin(),
-                                                  d_x_planes.end(),
-                                                  point[X_DIMENSION] );
+  const PlaneIndex x_index =
+    this->findLowerPlaneIndex( point[X_DIMENSION], X_DIMENSION );
 
-  // Take care of when the point is exactly on the last x plane. The search
-  // will return the last x plane if this is true which does not correspond to
-  // any of the hex elements. Instead, move it back one
-  if( x_index == d_x_planes.size() - 1)
-  {
-    x_index = d_x_planes.size() - 2;
-  }
+  const PlaneIndex y_index =
+    this->findLowerPlaneIndex( point[Y_DIMENSION], Y_DIMENSION );
 
-  size_t y_index = Search::binaryLowerBoundIndex( d_y_planes.begin(),
-                                                  d_y_planes.end(),
-                                                  point[Y_DIMENSION] );
-  if( y_index == d_y_planes.size() - 1)
-  {
-    y_index = d_y_planes.size() - 2;
-  }
+  const PlaneIndex z_index =
+    this->findLowerPlaneIndex( point[Z_DIMENSION], Z_DIMENSION );
 
-  size_t z_index = Search::binaryLowerBoundIndex( d_z_planes.begin(),
-                                                  d_z_planes.end(),
-                                                  point[Z_DIMENSION] );
-  if( z_index == d_z_planes.size() - 1)
-  {
-    z_index = d_z_planes.size() - 2;
-  }
+  return this->findIndex( x_index, y_index, z_index );
+}
+
+// Returns the index of the hex that contains a given point (hex hint)
+/*! \details The point will usually still be in the hint hex or in one of its
+ * neighbors, which can be checked without a search. If the hint is not a
+ * valid hex index a full search will be done.
+ */
+auto StructuredHexMesh::whichElementIsPointIn(
+                        const double point[3],
+                        const ElementHandle element_hint ) const -> ElementHandle
+{
+  // Make sure that the point is in the mesh
+  testPrecondition( this->isPointInMesh(point) );
+
+  if( element_hint >= d_hex_elements.size() )
+    return this->whichElementIsPointIn( point );
+
+  size_t hint_plane_indices[3];
+
+  this->getHexPlaneIndices( element_hint, hint_plane_indices );
+
+  const PlaneIndex x_index =
+    this->findLowerPlaneIndex( point[X_DIMENSION],
+                               X_DIMENSION,
+                               hint_plane_indices[X_DIMENSION] );
+
+  const PlaneIndex y_index =
+    this->findLowerPlaneIndex( point[Y_DIMENSION],
+                               Y_DIMENSION,
+                               hint_plane_indices[Y_DIMENSION] );
+
+  const PlaneIndex z_index =
+    this->findLowerPlaneIndex( point[Z_DIMENSION],
+                               Z_DIMENSION,
+                               hint_plane_indices[Z_DIMENSION] );
 
   return this->findIndex( x_index, y_index, z_index );
 }
@@ -204,63 +225,70 @@ void StructuredHexMesh::computeTrackLengths(
 {
   hex_element_track_lengths.clear();
 
-  if( !(start_point[X_DIMENSION] == end_point[X_DIMENSION] &&
-        start_point[Y_DIMENSION] == end_point[Y_DIMENSION] &&
-        start_point[Z_DIMENSION] == end_point[Z_DIMENSION]) )
+  const double track_length =
+    Utility::vectorMagnitude( end_point[X_DIMENSION] - start_point[X_DIMENSION],
+                              end_point[Y_DIMENSION] - start_point[Y_DIMENSION],
+                              end_point[Z_DIMENSION] - start_point[Z_DIMENSION] );
+
+  this->traverseElements( start_point, end_point,
+                          [&]( const ElementHandle hex_element,
+                               const double distance_to_hex,
+                               const double partial_track_length )
+                          {
+                            // Interpolate the hex entry point
+                            const double fraction =
+                              distance_to_hex/track_length;
+
+                            std::array<double,3> hex_entry_point;
+
+                            for( size_t i = 0; i < 3; ++i )
+                            {
+                              hex_entry_point[i] = start_point[i] +
+                                (end_point[i] - start_point[i])*fraction;
+                            }
+
+                            hex_element_track_lengths.push_back(
+                                   std::make_tuple( hex_element,
+                                                    hex_entry_point,
+                                                    partial_track_length ) );
+                          } );
+}
+
+// Accumulate the weighted partial track lengths of many line segments
+/*! \details The start and end point arrays store the coordinates of each
+ * line segment contiguously (i.e. x0 y0 z0 x1 y1 z1 ...). The weighted
+ * partial track lengths will be added to the hex element track length array,
+ * which must be indexed by the hex element handles (i.e. it must have a size
+ * of at least getNumberOfElements()). No intermediate containers are used,
+ * which makes this method suitable for tallying large batches of track
+ * segments into a flat (e.g. per-thread) buffer.
+ */
+void StructuredHexMesh::accumulateTrackLengths(
+                                     const double* start_points,
+                                     const double* end_points,
+                                     const double* weights,
+                                     const size_t number_of_segments,
+                                     double* hex_element_track_lengths ) const
+{
+  // Make sure that the arrays are valid
+  testPrecondition( number_of_segments == 0 || start_points );
+  testPrecondition( number_of_segments == 0 || end_points );
+  testPrecondition( number_of_segments == 0 || weights );
+  testPrecondition( hex_element_track_lengths );
+
+  for( size_t i = 0; i < number_of_segments; ++i )
   {
-    // Calculate track length and direction unit vector
-    double direction[3] {end_point[X_DIMENSION] - start_point[X_DIMENSION],
-                         end_point[Y_DIMENSION] - start_point[Y_DIMENSION],
-                         end_point[Z_DIMENSION] - start_point[Z_DIMENSION]};
-
-    double track_length =
-      Utility::normalizeVectorAndReturnMagnitude( direction );
-
-    double current_point[3] { start_point[X_DIMENSION],
-                              start_point[Y_DIMENSION],
-                              start_point[Z_DIMENSION] };
-
-    // Test if point starts in mesh. If not, figure out if it interacts with mesh
-    if( !this->isPointInMesh(current_point) )
-    {
-      // First member of pair is whether the mesh was intersected,
-      // second member of pair is the distance to the intersection
-      std::tuple<bool,Dimension,double> ray_intersection_tuple;
-
-      this->doesRayIntersectMesh( current_point,
-                                  direction,
-                                  track_length,
-                                  ray_intersection_tuple );
-
-      if( std::get<0>( ray_intersection_tuple ) )
-      {
-        this->pushPoint( current_point,
-                         direction,
-                         std::get<2>( ray_intersection_tuple ) );
-
-        PlaneIndex hex_plane_indices[3];
-        this->setHexPlaneIndices( std::get<1>( ray_intersection_tuple ),
-                                  current_point,
-                                  hex_plane_indices );
-
-        this->traceThroughMesh( current_point,
-                                direction,
-                                track_length - std::get<2>( ray_intersection_tuple ),
-                                hex_plane_indices,
-                                hex_element_track_lengths );
-      }
-    }
-    else
-    {
-      PlaneIndex hex_plane_indices[3];
-      this->setHexPlaneIndices( current_point, hex_plane_indices );
-
-      this->traceThroughMesh( current_point,
-                              direction,
-                              track_length,
-                              hex_plane_indices,
-                              hex_element_track_lengths );
-    }
+    const double weight = weights[i];
+
+    this->traverseElements( start_points + 3*i, end_points + 3*i,
+                            [hex_element_track_lengths,weight](
+                                         const ElementHandle hex_element,
+                                         const double,
+                                         const double partial_track_length )
+                            {
+                              hex_element_track_lengths[hex_element] +=
+                                weight*partial_track_length;
+                            } );
   }
 }
 
@@ -335,518 +363,189 @@ double StructuredHexMesh::getZPlaneLocation( PlaneIndex i)const
 
 // Begin private functions
 
-// Returns a pair where the first member is true if the ray intersects with the mesh and the second is the distance to the intersection point
-void
-StructuredHexMesh::doesRayIntersectMesh(
-                   const double point[3],
-                   const double direction[3],
-                   const double track_length,
-                   std::tuple<bool,Dimension,double>& intersection_data ) const
+// Initialize the data used to traverse the mesh
+/*! \details The planes of each dimension are checked for uniform spacing.
+ * If the spacing is uniform, the hex that contains a coordinate can be found
+ * directly instead of with a binary search.
+ */
+void StructuredHexMesh::initializeTraversalData()
 {
-  // This method should only be used when the point starts outside of mesh
-  testPrecondition( !(this->isPointInMesh(point)) );
-  // Make sure direction vector is a unit vector
-  testPrecondition( Utility::isUnitVector( direction ) );
+  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i )
+  {
+    const std::vector<double>& plane_set =
+      this->getPlaneSet( static_cast<Dimension>( i ) );
 
-  // Initialize the intersection data
-  Utility::get<0>( intersection_data ) = false;
-  Utility::get<1>( intersection_data ) = X_DIMENSION;
-  Utility::get<2>( intersection_data ) = 0.0;
+    const double plane_set_width = plane_set.back() - plane_set.front();
 
-  std::vector<std::pair<Dimension,double> > bounding_plane_distance_set;
+    const double plane_spacing = plane_set_width/(plane_set.size() - 1);
 
-  this->findBoundingInteractionPlaneDistances( point,
-                                               direction,
-                                               bounding_plane_distance_set );
+    bool uniform_plane_spacing = true;
 
-  // Check whether there are any possible bounding planes to intersect with
-  if( bounding_plane_distance_set.size() > 0 )
-  {
-    for( size_t i = 0; i < bounding_plane_distance_set.size(); ++i )
+    for( size_t j = 1; j < plane_set.size() - 1; ++j )
     {
-      // If the distance is greater than the track length, skip it
-      if( bounding_plane_distance_set[i].second >= track_length )
-        continue;
-
-      double new_point[3] { point[X_DIMENSION],
-                            point[Y_DIMENSION],
-                            point[Z_DIMENSION] };
-
-      // Push point up to plane intersection point
-      this->pushPoint( new_point,
-                       direction,
-                       bounding_plane_distance_set[i].second );
-
-      // Check if the point is on the mesh surface
-      if( this->isPointOnMeshSurface( new_point, bounding_plane_distance_set[i].first ) )
+      if( std::fabs( plane_set[j] - (plane_set.front() + j*plane_spacing) ) >
+          s_tol*plane_set_width )
       {
-        Utility::get<0>( intersection_data ) = true;
-
-        Utility::get<1>( intersection_data ) =
-          bounding_plane_distance_set[i].first;
-
-        Utility::get<2>( intersection_data ) =
-          bounding_plane_distance_set[i].second;
+        uniform_plane_spacing = false;
 
         break;
       }
     }
-  }
-}
-
-// Trace particle path through mesh until it dies or leaves mesh
-void StructuredHexMesh::traceThroughMesh(
-               double point[3],
-               const double direction[3],
-               const double track_length,
-               PlaneIndex hex_plane_indices[3],
-               ElementHandleTrackLengthArray& hex_element_track_lengths ) const
-{
-  std::vector<std::pair<Dimension,PlaneIndex> > interaction_planes;
-  this->findInteractionPlanes( point,
-                               direction,
-                               hex_plane_indices,
-                               interaction_planes );
 
-  double iteration_distance = 0;
-
-  size_t incrementer[3];
-  this->setIncrementer( incrementer, direction );
-
-  bool continue_tracing = true;
-
-  while(continue_tracing)
-  {
-    std::pair<Dimension, double> intersection_distance;
-    this->findIntersectionDistance( point,
-                                    direction,
-                                    interaction_planes,
-                                    intersection_distance );
-    double partial_track_length;
-
-    // Check if track length is exhausted
-    if( track_length <= iteration_distance + intersection_distance.second )
-    {
-      partial_track_length = track_length - iteration_distance;
-      continue_tracing = false;
-    }
+    if( uniform_plane_spacing )
+      d_inverse_uniform_plane_spacing[i] = 1.0/plane_spacing;
     else
-    {
-      partial_track_length = intersection_distance.second;
-    }
-
-    // Push back a new pair for the indices
-    hex_element_track_lengths.push_back(
-       std::make_tuple( this->findIndex( hex_plane_indices ),
-                        std::array<double,3>( {point[0], point[1], point[2]} ),
-                        partial_track_length ) );
-
-    // Check if the particle left the mesh
-    if( this->didParticleLeaveMesh( intersection_distance.first,
-                                    interaction_planes ) )
-    {
-      continue_tracing = false;
-    }
-
-    // If the track length was exhausted or the particle left the mesh, leave
-    // loop and return array.
-    if( continue_tracing )
-    {
-      // Otherwise, push point up to new location
-      this->pushPoint(point, direction, partial_track_length);
-
-      // Increase iteration_distance to new value
-      iteration_distance += partial_track_length;
-
-      // Increment indices and perform calculation again.
-      hex_plane_indices[intersection_distance.first] +=
-        incrementer[intersection_distance.first];
-
-      for( size_t i = 0; i < interaction_planes.size() ; ++i )
-      {
-        if(interaction_planes[i].first == intersection_distance.first)
-        {
-          interaction_planes[i].second +=
-            incrementer[interaction_planes[i].first];
-
-          break;
-        }
-      }
-    }
+      d_inverse_uniform_plane_spacing[i] = 0.0;
   }
-}
 
-// Find the interaction planes that a particle will interact with
-void StructuredHexMesh::findInteractionPlanes(
-      const double point[3],
-      const double direction[3],
-      const PlaneIndex hex_plane_indices[3],
-      std::vector<std::pair<Dimension,PlaneIndex> >& interaction_planes ) const
-{
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh( point ) );
-
-  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i)
-  {
-    if( direction[i] < 0 )
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] ) );
-    }
-    else if( direction[i] > 0)
-    {
-      interaction_planes.push_back( std::make_pair( static_cast<Dimension>(i), hex_plane_indices[i] + 1) );
-    }
-  }
+  d_hex_index_strides[X_DIMENSION] = 1;
+  d_hex_index_strides[Y_DIMENSION] = d_x_planes.size() - 1;
+  d_hex_index_strides[Z_DIMENSION] =
+    (d_x_planes.size() - 1)*(d_y_planes.size() - 1);
 }
 
-// Find the intersection distance along the path of the particle with the next hex
-void StructuredHexMesh::findIntersectionDistance(
-                           const double point[3],
-                           const double direction[3],
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes,
-                           std::pair<Dimension,double>&
-                           intersection_distance ) const
+// Get the plane set of a dimension
+const std::vector<double>& StructuredHexMesh::getPlaneSet(
+                                             const Dimension dimension ) const
 {
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh(point) );
-  // Make sure that the direction is valid
-  testPrecondition( Utility::isUnitVector( direction ) );
-
-  intersection_distance.second = std::numeric_limits<double>::infinity();
-
-  double possible_distance;
-
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
+  switch( dimension )
   {
-    if(interaction_planes[i].first == X_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_x_planes[ interaction_planes[i].second ],
-                                    point[X_DIMENSION],
-                                    direction[X_DIMENSION] );
-
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = X_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Y_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_y_planes[ interaction_planes[i].second ],
-                                    point[Y_DIMENSION],
-                                    direction[Y_DIMENSION] );
-
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Y_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
-    else if(interaction_planes[i].first == Z_DIMENSION)
-    {
-      possible_distance = this->findDistanceToInteractionPlane(
-                                    d_z_planes[ interaction_planes[i].second ],
-                                    point[Z_DIMENSION],
-                                    direction[Z_DIMENSION] );
-
-      if( possible_distance < intersection_distance.second )
-      {
-        intersection_distance.first = Z_DIMENSION;
-        intersection_distance.second = possible_distance;
-      }
-    }
+    case X_DIMENSION: return d_x_planes;
+    case Y_DIMENSION: return d_y_planes;
+    default: return d_z_planes;
   }
 }
 
-// Calculate distance to a plane from a ray along its direction
-double StructuredHexMesh::findDistanceToInteractionPlane(
-                                       const double interaction_plane_location,
-                                       const double position_component,
-                                       const double direction_component ) const
+// Find the index of the lower plane of the hex that contains a coordinate
+/*! \details Coordinates that lie outside of the plane set will be assigned
+ * to the first or last hex of the dimension. A coordinate that lies on the
+ * last plane will be assigned to the last hex of the dimension.
+ */
+auto StructuredHexMesh::findLowerPlaneIndex(
+                                        const double position_component,
+                                        const Dimension dimension ) const
+  -> PlaneIndex
 {
-  return (interaction_plane_location - position_component)/direction_component;
-}
+  const std::vector<double>& plane_set = this->getPlaneSet( dimension );
 
-// Form the incrementer so that the particle increments over the planes in the correct direction
-void StructuredHexMesh::setIncrementer( size_t incrementer[3],
-                                        const double direction[3] ) const
-{
-  for(size_t i = 0; i < 3; ++i)
-  {
-    if(direction[i] >= 0)
-    {
-      incrementer[i] = 1;
-    }
-    else
-    {
-      incrementer[i] = -1;
-    }
-  }
-}
+  const PlaneIndex last_hex_plane_index = plane_set.size() - 2;
 
-// Overloaded method to set the hex plane indices of a given particle
-void StructuredHexMesh::setHexPlaneIndices(
-                                        const double current_point[3],
-                                        PlaneIndex hex_plane_indices[3] ) const
-{
-  // Make sure that the point is in the mesh
-  testPrecondition( this->isPointInMesh(current_point) );
-
-  hex_plane_indices[X_DIMENSION] =
-    this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION );
-  hex_plane_indices[Y_DIMENSION] =
-    this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION );
-  hex_plane_indices[Z_DIMENSION] =
-    this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION );
-
-  testPostcondition( hex_plane_indices[X_DIMENSION] >= 0 && hex_plane_indices[X_DIMENSION] <= d_x_planes.size()-2);
-  testPostcondition( hex_plane_indices[Y_DIMENSION] >= 0 && hex_plane_indices[Y_DIMENSION] <= d_y_planes.size()-2);
-  testPostcondition( hex_plane_indices[Z_DIMENSION] >= 0 && hex_plane_indices[Z_DIMENSION] <= d_z_planes.size()-2);
-}
+  if( position_component <= plane_set.front() )
+    return 0;
+  else if( position_component >= plane_set.back() )
+    return last_hex_plane_index;
 
-// Set hex plane indices for a particle at its intersection point
-void StructuredHexMesh::setHexPlaneIndices(
-                                        const Dimension intersection_dimension,
-                                        const double current_point[3],
-                                        PlaneIndex hex_plane_indices[3] ) const
-{
-  // Check which dimension was intersected
-  if( intersection_dimension == X_DIMENSION )
-  {
-    /*
-      Check which bounding plane of that intersection was intersected. If not the
-      first plane, then it must have been the other.
-    */
+  PlaneIndex plane_index;
 
-    if( current_point[X_DIMENSION] <= d_x_planes.front() + s_tol &&
-        current_point[X_DIMENSION] >= d_x_planes.front() - s_tol )
-    {
-      hex_plane_indices[X_DIMENSION] = 0;
-    }
-    else
-    {
-      hex_plane_indices[X_DIMENSION] = d_x_planes.size() - 2;
-    }
-    hex_plane_indices[Y_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION);
-    hex_plane_indices[Z_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION);
-  }
-  else if( intersection_dimension == Y_DIMENSION )
+  if( d_inverse_uniform_plane_spacing[dimension] > 0.0 )
   {
-    if( current_point[Y_DIMENSION] <= d_y_planes.front() + s_tol &&
-        current_point[Y_DIMENSION] >= d_y_planes.front() - s_tol )
-    {
-      hex_plane_indices[Y_DIMENSION] = 0;
-    }
-    else
-    {
-      hex_plane_indices[Y_DIMENSION] = d_y_planes.size() - 2;
-    }
-    hex_plane_indices[X_DIMENSION] =
-      this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION);
-    hex_plane_indices[Z_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Z_DIMENSION], d_z_planes, Z_DIMENSION);
-
+    plane_index = static_cast<PlaneIndex>(
+                         (position_component - plane_set.front())*
+                         d_inverse_uniform_plane_spacing[dimension] );
+
+    if( plane_index > last_hex_plane_index )
+      plane_index = last_hex_plane_index;
+
+    // Correct for round-off in the calculated plane index
+    if( position_component < plane_set[plane_index] )
+      --plane_index;
+    else if( plane_index < last_hex_plane_index &&
+             position_component >= plane_set[plane_index+1] )
+      ++plane_index;
   }
-  else if( intersection_dimension == Z_DIMENSION )
+  else
   {
-    if( current_point[Z_DIMENSION] <= d_z_planes.front() + s_tol &&
-        current_point[Z_DIMENSION] >= d_z_planes.front() - s_tol )
-    {
-      hex_plane_indices[Z_DIMENSION] = 0;
-    }
-    else
-    {
-      hex_plane_indices[Z_DIMENSION] = d_z_planes.size() - 2;
-    }
-    hex_plane_indices[X_DIMENSION] =
-      this->setHexPlaneIndex( current_point[X_DIMENSION], d_x_planes, X_DIMENSION);
-    hex_plane_indices[Y_DIMENSION] =
-      this->setHexPlaneIndex( current_point[Y_DIMENSION], d_y_planes, Y_DIMENSION);
+    plane_index = Search::binaryLowerBoundIndex( plane_set.begin(),
+                                                 plane_set.end(),
+                                                 position_component );
   }
 
-  testPostcondition( hex_plane_indices[X_DIMENSION] >= 0 && hex_plane_indices[X_DIMENSION] <= d_x_planes.size()-2);
-  testPostcondition( hex_plane_indices[Y_DIMENSION] >= 0 && hex_plane_indices[Y_DIMENSION] <= d_y_planes.size()-2);
-  testPostcondition( hex_plane_indices[Z_DIMENSION] >= 0 && hex_plane_indices[Z_DIMENSION] <= d_z_planes.size()-2);
+  return plane_index;
 }
 
-// Set individual hex plane indices for particle.
-auto StructuredHexMesh::setHexPlaneIndex(
-                         const double position_component,
-                         const std::vector<double>& plane_set,
-                         const Dimension plane_dimension  ) const -> PlaneIndex
+// Find the index of the lower plane of the hex that contains a coordinate
+/*! \details The hint plane index and its neighbors are checked before
+ * a search is done.
+ */
+auto StructuredHexMesh::findLowerPlaneIndex(
+                                        const double position_component,
+                                        const Dimension dimension,
+                                        const PlaneIndex plane_index_hint ) const
+  -> PlaneIndex
 {
-  PlaneIndex hex_plane_index;
+  const std::vector<double>& plane_set = this->getPlaneSet( dimension );
+
+  const PlaneIndex last_hex_plane_index = plane_set.size() - 2;
+
+  // Make sure that the plane index hint is valid
+  testPrecondition( plane_index_hint <= last_hex_plane_index );
 
-  if( position_component == plane_set.back() )
+  if( position_component >= plane_set[plane_index_hint] )
   {
-    hex_plane_index = plane_set.size() - 2;
+    if( plane_index_hint == last_hex_plane_index ||
+        position_component < plane_set[plane_index_hint+1] )
+      return plane_index_hint;
+
+    if( plane_index_hint+1 == last_hex_plane_index ||
+        position_component < plane_set[plane_index_hint+2] )
+      return plane_index_hint+1;
   }
   else
   {
-    hex_plane_index = Search::binaryLowerBoundIndex( plane_set.begin(),
-                                                     plane_set.end(),
-                                                     position_component );
+    if( plane_index_hint == 0 )
+      return 0;
+
+    if( position_component >= plane_set[plane_index_hint-1] )
+      return plane_index_hint-1;
   }
 
-  return hex_plane_index;
+  return this->findLowerPlaneIndex( position_component, dimension );
 }
 
-// Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
-void StructuredHexMesh::findBoundingInteractionPlaneDistances(
-  const double point[3],
-  const double direction[3],
-  std::vector<std::pair<Dimension,double> >& bounding_intersection_data ) const
+// Find the distance along a ray to the point where it enters the mesh
+/*! \details If the ray starts inside of the mesh the entry distance will be
+ * 0.0. If the ray does not pass through the mesh before the track length is
+ * exhausted false will be returned.
+ */
+bool StructuredHexMesh::findDistanceToMeshEntry( const double point[3],
+                                                 const double direction[3],
+                                                 const double track_length,
+                                                 double& entry_distance ) const
 {
-  this->checkPlaneSet( d_x_planes,
-                       point[X_DIMENSION],
-                       direction[X_DIMENSION],
-                       bounding_intersection_data,
-                       X_DIMENSION );
-
-  this->checkPlaneSet( d_y_planes,
-                       point[Y_DIMENSION],
-                       direction[Y_DIMENSION],
-                       bounding_intersection_data,
-                       Y_DIMENSION );
-
-  this->checkPlaneSet( d_z_planes,
-                       point[Z_DIMENSION],
-                       direction[Z_DIMENSION],
-                       bounding_intersection_data,
-                       Z_DIMENSION );
-}
+  // Make sure direction vector is a unit vector
+  testPrecondition( Utility::isUnitVector( direction ) );
 
-// Checks an individual set of planes for interaction plane in that dimension
-void StructuredHexMesh::checkPlaneSet(
-                   const std::vector<double>& plane_set,
-                   const double position_component,
-                   const double direction_component,
-                   std::vector<std::pair<Dimension, double> >& boundary_planes,
-                   const Dimension plane_dimension ) const
-{
-  if( position_component < plane_set.front() && direction_component > 0 )
-  {
-    boundary_planes.push_back( std::make_pair(plane_dimension,
-                                              (plane_set.front() - position_component)/direction_component) );
-  }
-  else if( position_component > plane_set.back() && direction_component < 0 )
-  {
-    boundary_planes.push_back( std::make_pair( plane_dimension,
-                                               (plane_set.back() - position_component)/direction_component ) );
-  }
-}
+  entry_distance = 0.0;
 
-// Returns whether or not a particle actually hit the mesh surface
-bool StructuredHexMesh::isPointOnMeshSurface(
-                                  const double point[3],
-                                  const Dimension dimension_intersected ) const
-{
-  bool point_on_mesh = false;
+  double exit_distance = track_length;
 
-  if(dimension_intersected == X_DIMENSION)
-  {
-    if(this->checkWithinBoundingPlane( point[Y_DIMENSION], d_y_planes ) )
-    {
-      if(this->checkWithinBoundingPlane( point[Z_DIMENSION], d_z_planes ) )
-      {
-        point_on_mesh = true;
-      }
-    }
-  }
-  else if(dimension_intersected == Y_DIMENSION)
+  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i )
   {
-    if(this->checkWithinBoundingPlane( point[X_DIMENSION], d_x_planes ) )
+    const std::vector<double>& plane_set =
+      this->getPlaneSet( static_cast<Dimension>( i ) );
+
+    if( direction[i] == 0.0 )
     {
-      if(this->checkWithinBoundingPlane( point[Z_DIMENSION], d_z_planes ) )
-      {
-        point_on_mesh = true;
-      }
+      if( point[i] < plane_set.front() || point[i] > plane_set.back() )
+        return false;
     }
-  }
-  else if(dimension_intersected == Z_DIMENSION)
-  {
-    if(this->checkWithinBoundingPlane( point[X_DIMENSION], d_x_planes ) )
+    else
     {
-      if(this->checkWithinBoundingPlane( point[Y_DIMENSION], d_y_planes ) )
-      {
-        point_on_mesh = true;
-      }
-    }
-  }
-  return point_on_mesh;
-}
+      double near_plane_distance = (plane_set.front() - point[i])/direction[i];
+      double far_plane_distance = (plane_set.back() - point[i])/direction[i];
 
-// Function for checking each individual plane to see if it is within bounds
-bool StructuredHexMesh::checkWithinBoundingPlane(
-                                   const double position_component,
-                                   const std::vector<double>& plane_set ) const
-{
-  if( plane_set.front() <= position_component &&
-      position_component <= plane_set.back() )
-  {
-    return true;
-  }
-  else
-  {
-    return false;
-  }
-}
-
-// Pushes point along direction to new intersection point
-void StructuredHexMesh::pushPoint( double point[3],
-                                   const double direction[3],
-                                   const double push_distance ) const
-{
-  point[X_DIMENSION] += direction[X_DIMENSION]*push_distance;
-  point[Y_DIMENSION] += direction[Y_DIMENSION]*push_distance;
-  point[Z_DIMENSION] += direction[Z_DIMENSION]*push_distance;
-}
+      if( direction[i] < 0.0 )
+        std::swap( near_plane_distance, far_plane_distance );
 
-// Return whether or not a particle has exited the mesh
-bool StructuredHexMesh::didParticleLeaveMesh(
-                           Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const
-{
-  bool exit_mesh = false;
+      if( near_plane_distance > entry_distance )
+        entry_distance = near_plane_distance;
 
-  for( size_t i = 0; i < interaction_planes.size(); ++i )
-  {
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == X_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_x_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Y_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_y_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
-    }
-    if( intersection_dimension == interaction_planes[i].first &&
-        intersection_dimension == Z_DIMENSION )
-    {
-      if( interaction_planes[i].second == d_z_planes.size() - 1 ||
-          interaction_planes[i].second == 0 )
-      {
-        exit_mesh = true;
-      }
+      if( far_plane_distance < exit_distance )
+        exit_distance = far_plane_distance;
     }
   }
 
-  return exit_mesh;
+  return entry_distance < exit_distance;
 }
 
 // Calculate hex index from respective plane indices
@@ -118,12 +118,30 @@ public:
   //! Returns the index of the hex that contains a given point.
   ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
 
+  //! Returns the index of the hex that contains a given point (hex hint)
+  ElementHandle whichElementIsPointIn(
+                       const double point[3],
+                       const ElementHandle element_hint ) const final override;
+
   //! Returns an array of pairs of hex IDs and partial track lengths along a given line segment.
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
                             ElementHandleTrackLengthArray&
                             hex_element_track_lengths ) const final override;
 
+  //! Accumulate the weighted partial track lengths of many line segments
+  void accumulateTrackLengths( const double* start_points,
+                               const double* end_points,
+                               const double* weights,
+                               const size_t number_of_segments,
+                               double* hex_element_track_lengths ) const;
+
+  //! Visit the hex elements that a line segment passes through
+  template<typename ElementVisitor>
+  void traverseElements( const double start_point[3],
+                         const double end_point[3],
+                         ElementVisitor&& visitor ) const;
+
   //! Export the mesh to a file (type determined by suffix - e.g. mesh.vtk)
   void exportData( const std::string& output_file_name,
                    const TagNameSet& tag_root_names,
@@ -142,96 +160,26 @@ private:
                           Y_DIMENSION = 1,
                           Z_DIMENSION = 2 };
 
-  // Returns a pair where the first member is true if the ray intersects with the mesh and the second is the distance to the intersection point
-  void doesRayIntersectMesh(
-                  const double point[3],
-                  const double direction[3],
-                  const double track_length,
-                  std::tuple<bool,Dimension,double>& intersection_data ) const;
-
-  // Trace particle path through mesh until it dies or leaves mesh
-  void traceThroughMesh(
-              double point[3],
-              const double direction[3],
-              const double track_length,
-              PlaneIndex hex_plane_indices[3],
-              ElementHandleTrackLengthArray& hex_element_track_lengths ) const;
-
-  // Find the interaction planes that a particle will interact with
-  void findInteractionPlanes( const double point[3],
-                              const double direction[3],
-                              const PlaneIndex hex_plane_indices[3],
-                              std::vector<std::pair<Dimension,PlaneIndex> >&
-                              interaction_planes ) const;
-
-  // Find the intersection distance along the path of the particle with the next hex
-  void findIntersectionDistance(
-                    const double point[3],
-                    const double direction[3],
-                    const std::vector<std::pair<Dimension,PlaneIndex> >&
-                    interaction_planes,
-                    std::pair<Dimension,double>& intersection_distance ) const;
-
-  // Calculate distance to a plane from a ray along its direction
-  double findDistanceToInteractionPlane(
-                                      const double interaction_plane_location,
-                                      const double position_component,
-                                      const double direction_component ) const;
-
-  // Form the incrementer so that the particle increments over the planes in the correct direction
-  void setIncrementer( size_t incrementer[3],
-                       const double direction[3] ) const;
-
-  // set the plane indices that make up the hex element index
-  void setHexPlaneIndices( const double current_point[3],
-                           PlaneIndex hex_plane_indices[3] )const;
-
-  // overloaded function for setting member indices
-  void setHexPlaneIndices( const Dimension intersection_dimension,
-                           const double current_point[3],
-                           PlaneIndex hex_plane_indices[3] )const;
-
-  // Set individual hex plane indicies for particle.
-  PlaneIndex setHexPlaneIndex( const double position_component,
-                               const std::vector<double>& plane_set,
-                               const Dimension plane_dimension  ) const;
-
-  // Returns a set of distances to up to 3 planes that bound the mesh which the particle may interact with
-  void findBoundingInteractionPlaneDistances(
-                                    const double point[3],
-                                    const double direction[3],
-                                    std::vector<std::pair<Dimension, double> >&
-                                    bounding_intersection_data  ) const;
-
-  // Checks an individual set of planes for interaction plane in that dimension
-  void checkPlaneSet( const std::vector<double>& plane_set,
-                      const double position_component,
-                      const double direction_component,
-                      std::vector<std::pair<Dimension, double> >& boundary_planes,
-                      const Dimension plane_dimension ) const;
-
-  // Returns whether or not a particle actually hit the mesh surface
-  bool isPointOnMeshSurface( const double point[3],
-                             const Dimension dimension_intersected ) const;
-
-  // function for checking each individual plane to see if it is within bounds
-  bool checkWithinBoundingPlane( const double position_component,
-                                 const std::vector<double>& plane_set )const;
-
-  // determines if the particle has exited the mesh
-  bool didParticleLeaveMesh(
-                           const Dimension intersection_dimension,
-                           const std::vector<std::pair<Dimension,PlaneIndex> >&
-                           interaction_planes ) const;
-
-  // sets the incrementer for mesh iteration
-  void setIncrementer( const double direction[3],
-                       int incrementer[3] ) const;
-
-  // pushes point along direction to new intersection point
-  void pushPoint( double point[3],
-                  const double direction[3],
-                  const double push_distance ) const;
+  // Initialize the data used to traverse the mesh
+  void initializeTraversalData();
+
+  // Get the plane set of a dimension
+  const std::vector<double>& getPlaneSet( const Dimension dimension ) const;
+
+  // Find the index of the lower plane of the hex that contains a coordinate
+  PlaneIndex findLowerPlaneIndex( const double position_component,
+                                  const Dimension dimension ) const;
+
+  // Find the index of the lower plane of the hex that contains a coordinate
+  PlaneIndex findLowerPlaneIndex( const double position_component,
+                                  const Dimension dimension,
+                                  const PlaneIndex plane_index_hint ) const;
+
+  // Find the distance along a ray to the point where it enters the mesh
+  bool findDistanceToMeshEntry( const double point[3],
+                                const double direction[3],
+                                const double track_length,
+                                double& entry_distance ) const;
 
   // Save the data to an archive
   template<typename Archive>
@@ -256,6 +204,12 @@ private:
 
   // The hex elements (ids)
   std::vector<ElementHandle> d_hex_elements;
+
+  // The inverse plane spacing of each dimension (0.0 if not uniform)
+  double d_inverse_uniform_plane_spacing[3];
+
+  // The change in the hex index when moving across a plane of each dimension
+  size_t d_hex_index_strides[3];
 };
 
 // Save the data to an archive
@@ -284,6 +238,8 @@ void StructuredHexMesh::load( Archive& ar, const unsigned version )
   ar & BOOST_SERIALIZATION_NVP( d_y_planes );
   ar & BOOST_SERIALIZATION_NVP( d_z_planes );
   ar & BOOST_SERIALIZATION_NVP( d_hex_elements );
+
+  this->initializeTraversalData();
 }
 
 } // end Utility namespace
@@ -292,6 +248,14 @@ BOOST_SERIALIZATION_CLASS_VERSION( StructuredHexMesh, Utility, 0 );
 BOOST_SERIALIZATION_CLASS_EXPORT_STANDARD_KEY( StructuredHexMesh, Utility );
 EXTERN_EXPLICIT_CLASS_SAVE_LOAD_INST( Utility, StructuredHexMesh );
 
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_StructuredHexMesh_def.hpp"
+
+//---------------------------------------------------------------------------//
+
 #endif // end UTILITY_STRUCTURED_HEX_MESH_HPP
 
 //---------------------------------------------------------------------------//
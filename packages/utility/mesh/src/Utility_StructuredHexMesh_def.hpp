@@ -0,0 +1,160 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_StructuredHexMesh_def.hpp
+//! \author Philip Britt
+//! \brief  Hexahedral mesh class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_STRUCTURED_HEX_MESH_DEF_HPP
+#define UTILITY_STRUCTURED_HEX_MESH_DEF_HPP
+
+// Std Lib Includes
+#include <limits>
+
+// FRENSIE Includes
+#include "Utility_3DCartesianVectorHelpers.hpp"
+
+namespace Utility{
+
+// Visit the hex elements that a line segment passes through
+/*! \details The hex elements are traversed incrementally (Amanatides-Woo
+ * voxel traversal): after the hex containing the mesh entry point has been
+ * located, each plane crossing only requires a comparison of the distances
+ * to the next plane in each dimension and a single update of the hex index.
+ * The visitor will be called with the hex element handle, the distance from
+ * the start point to the point where the line segment enters the hex and the
+ * partial track length in the hex (signature:
+ * void( ElementHandle, double, double )). Hex elements with a partial track
+ * length of zero (e.g. when the line segment passes through an edge) will not
+ * be visited.
+ */
+template<typename ElementVisitor>
+void StructuredHexMesh::traverseElements( const double start_point[3],
+                                          const double end_point[3],
+                                          ElementVisitor&& visitor ) const
+{
+  if( start_point[X_DIMENSION] == end_point[X_DIMENSION] &&
+      start_point[Y_DIMENSION] == end_point[Y_DIMENSION] &&
+      start_point[Z_DIMENSION] == end_point[Z_DIMENSION] )
+    return;
+
+  // Calculate track length and direction unit vector
+  double direction[3] {end_point[X_DIMENSION] - start_point[X_DIMENSION],
+                       end_point[Y_DIMENSION] - start_point[Y_DIMENSION],
+                       end_point[Z_DIMENSION] - start_point[Z_DIMENSION]};
+
+  const double track_length =
+    Utility::normalizeVectorAndReturnMagnitude( direction );
+
+  double distance;
+
+  if( !this->findDistanceToMeshEntry( start_point,
+                                      direction,
+                                      track_length,
+                                      distance ) )
+    return;
+
+  const std::vector<double>* plane_sets[3] =
+    {&d_x_planes, &d_y_planes, &d_z_planes};
+
+  // Locate the hex that contains the entry point - this is the only
+  // search that is required
+  PlaneIndex hex_plane_indices[3];
+  int plane_index_increments[3];
+  double distances_to_next_plane[3];
+  ElementHandle hex_element = 0;
+
+  for( size_t i = X_DIMENSION; i <= Z_DIMENSION; ++i )
+  {
+    const std::vector<double>& plane_set = *plane_sets[i];
+
+    hex_plane_indices[i] =
+      this->findLowerPlaneIndex( start_point[i] + direction[i]*distance,
+                                 static_cast<Dimension>( i ) );
+
+    hex_element += hex_plane_indices[i]*d_hex_index_strides[i];
+
+    if( direction[i] > 0.0 )
+    {
+      plane_index_increments[i] = 1;
+
+      distances_to_next_plane[i] =
+        (plane_set[hex_plane_indices[i]+1] - start_point[i])/direction[i];
+    }
+    else if( direction[i] < 0.0 )
+    {
+      plane_index_increments[i] = -1;
+
+      distances_to_next_plane[i] =
+        (plane_set[hex_plane_indices[i]] - start_point[i])/direction[i];
+    }
+    else
+    {
+      plane_index_increments[i] = 0;
+
+      distances_to_next_plane[i] = std::numeric_limits<double>::infinity();
+    }
+  }
+
+  while( true )
+  {
+    // Find the dimension of the next plane that will be crossed
+    size_t dimension =
+      (distances_to_next_plane[Y_DIMENSION] <
+       distances_to_next_plane[X_DIMENSION] ? Y_DIMENSION : X_DIMENSION);
+
+    if( distances_to_next_plane[Z_DIMENSION] <
+        distances_to_next_plane[dimension] )
+      dimension = Z_DIMENSION;
+
+    const double next_distance =
+      (distances_to_next_plane[dimension] < track_length ?
+       distances_to_next_plane[dimension] : track_length);
+
+    if( next_distance > distance )
+      visitor( hex_element, distance, next_distance - distance );
+
+    // Check if the track length is exhausted
+    if( distances_to_next_plane[dimension] >= track_length )
+      break;
+
+    const std::vector<double>& plane_set = *plane_sets[dimension];
+
+    // Move into the neighboring hex - stop if the particle leaves the mesh
+    if( plane_index_increments[dimension] > 0 )
+    {
+      if( ++hex_plane_indices[dimension] == plane_set.size() - 1 )
+        break;
+
+      hex_element += d_hex_index_strides[dimension];
+
+      distances_to_next_plane[dimension] =
+        (plane_set[hex_plane_indices[dimension]+1] - start_point[dimension])/
+        direction[dimension];
+    }
+    else
+    {
+      if( hex_plane_indices[dimension] == 0 )
+        break;
+
+      --hex_plane_indices[dimension];
+
+      hex_element -= d_hex_index_strides[dimension];
+
+      distances_to_next_plane[dimension] =
+        (plane_set[hex_plane_indices[dimension]] - start_point[dimension])/
+        direction[dimension];
+    }
+
+    distance = next_distance;
+  }
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_STRUCTURED_HEX_MESH_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_StructuredHexMesh_def.hpp
+//---------------------------------------------------------------------------//
@@ -87,6 +87,8 @@ public:
   //! Returns the tet that contains a given point
   ElementHandle whichElementIsPointIn( const double point[3] ) const final override;
 
+  using Mesh::whichElementIsPointIn;
+
   //! Determine the mesh elements that a line segment intersects
   void computeTrackLengths( const double start_point[3],
                             const double end_point[3],
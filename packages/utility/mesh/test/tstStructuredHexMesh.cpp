@@ -11,6 +11,7 @@
 #include <iomanip>
 #include <memory>
 #include <utility>
+#include <limits>
 
 // FRENSIE Includes
 #include "Utility_StructuredHexMesh.hpp"
@@ -1113,6 +1114,291 @@ FRENSIE_UNIT_TEST( StructuredHexMesh,
                                    1e-10);
 }
 
+//---------------------------------------------------------------------------//
+// Check that the hex that contains a point can be found when the planes are
+// uniformly spaced
+FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn_uniform_planes )
+{
+  std::vector<double> x_planes( 11 ), y_planes( {0.0, 1.0} ),
+    z_planes( {0.0, 0.2, 1.0} );
+
+  for( size_t i = 0; i < x_planes.size(); ++i )
+    x_planes[i] = i*0.1;
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double point[3] = {0.0, 0.5, 0.5};
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 10 );
+
+  point[0] = 0.05;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 10 );
+
+  // Note: 3*0.1 > 0.3
+  point[0] = 0.3;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 12 );
+
+  point[0] = x_planes[3];
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 13 );
+
+  point[0] = 1.0;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 19 );
+
+  point[0] = 0.95;
+  point[2] = 0.1;
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point ), 9 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hex that contains a point can be found from a hex hint
+FRENSIE_UNIT_TEST( StructuredHexMesh, whichElementIsPointIn_hint )
+{
+  std::vector<double> x_planes( {0.0, 0.1, 0.5, 1.0, 1.5} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.2, 0.4, 0.6, 0.8, 1.0} );
+
+  std::shared_ptr<const Utility::Mesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  // Points on and between the planes
+  std::vector<double> x_coords( {0.0, 0.05, 0.1, 0.3, 0.5, 0.75, 1.0, 1.2, 1.5} ),
+    y_coords( {0.0, 0.25, 0.5, 0.75, 1.0} ),
+    z_coords( {0.0, 0.1, 0.2, 0.5, 0.6, 0.9, 1.0} );
+
+  bool all_elements_correct = true;
+
+  for( auto&& x : x_coords )
+  {
+    for( auto&& y : y_coords )
+    {
+      for( auto&& z : z_coords )
+      {
+        double point[3] = {x, y, z};
+
+        const Utility::Mesh::ElementHandle element =
+          hex_mesh->whichElementIsPointIn( point );
+
+        // Every hex (and an invalid hex) is used as the hint
+        for( Utility::Mesh::ElementHandle hint = 0;
+             hint <= hex_mesh->getNumberOfElements();
+             ++hint )
+        {
+          if( hex_mesh->whichElementIsPointIn( point, hint ) != element )
+            all_elements_correct = false;
+        }
+      }
+    }
+  }
+
+  FRENSIE_CHECK( all_elements_correct );
+
+  double point[3] = {0.75, 0.75, 0.5};
+
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point, 22 ), 22 );
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point, 0 ), 22 );
+  FRENSIE_CHECK_EQUAL( hex_mesh->whichElementIsPointIn( point, std::numeric_limits<Utility::Mesh::ElementHandle>::max() ), 22 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the track lengths can be computed when the planes are not
+// uniformly spaced
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_nonuniform_planes )
+{
+  std::vector<double> x_planes( {0.0, 0.1, 0.5, 1.0} ),
+    y_planes( {0.0, 1.0} ),
+    z_planes( {0.0, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double start_point[3] = {-0.5, 0.5, 0.5};
+  double end_point[3] = {2.0, 0.5, 0.5};
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray contribution;
+
+  hex_mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 3 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[0]), 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[0]),
+                                   (std::array<double,3>( {0.0, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
+                                   0.1,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[1]), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[1]),
+                                   (std::array<double,3>( {0.1, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[1]),
+                                   0.4,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[2]), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[2]),
+                                   (std::array<double,3>( {0.5, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[2]),
+                                   0.5,
+                                   1e-12 );
+
+  // Travel in the negative direction and stop inside of the mesh
+  start_point[0] = 0.75;
+  end_point[0] = 0.05;
+
+  hex_mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 3 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[0]), 2 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
+                                   0.25,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[1]), 1 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[1]),
+                                   0.4,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[2]), 0 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[2]),
+                                   (std::array<double,3>( {0.1, 0.5, 0.5} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[2]),
+                                   0.05,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that hex elements with a zero track length are not returned when
+// a ray passes through a hex edge
+FRENSIE_UNIT_TEST( StructuredHexMesh, computeTrackLengths_edge_crossing )
+{
+  std::vector<double> x_planes( {0.0, 0.5, 1.0} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double start_point[3] = {0.25, 0.25, 0.25};
+  double end_point[3] = {0.75, 0.75, 0.25};
+
+  Utility::StructuredHexMesh::ElementHandleTrackLengthArray contribution;
+
+  hex_mesh->computeTrackLengths( start_point, end_point, contribution );
+
+  FRENSIE_REQUIRE_EQUAL( contribution.size(), 2 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[0]), 0 );
+  FRENSIE_CHECK_EQUAL( Utility::get<1>(contribution[0]),
+                       (std::array<double,3>( {0.25, 0.25, 0.25} )) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[0]),
+                                   0.353553390593274,
+                                   1e-12 );
+  FRENSIE_CHECK_EQUAL( Utility::get<0>(contribution[1]), 3 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<1>(contribution[1]),
+                                   (std::array<double,3>( {0.5, 0.5, 0.25} )),
+                                   1e-12 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( Utility::get<2>(contribution[1]),
+                                   0.353553390593274,
+                                   1e-12 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the hex elements that a line segment passes through can be
+// visited
+FRENSIE_UNIT_TEST( StructuredHexMesh, traverseElements )
+{
+  std::vector<double> x_planes( {0.0, 0.5, 1.0} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  double start_point[3] = {-0.25, 0.25, 0.25};
+  double end_point[3] = {0.83, 0.73, 0.52};
+
+  std::vector<Utility::StructuredHexMesh::ElementHandle> hex_elements;
+  std::vector<double> distances_to_hex, partial_track_lengths;
+
+  hex_mesh->traverseElements( start_point, end_point,
+                              [&]( const Utility::StructuredHexMesh::ElementHandle hex_element,
+                                   const double distance_to_hex,
+                                   const double partial_track_length )
+                              {
+                                hex_elements.push_back( hex_element );
+                                distances_to_hex.push_back( distance_to_hex );
+                                partial_track_lengths.push_back( partial_track_length );
+                              } );
+
+  FRENSIE_CHECK_EQUAL( hex_elements,
+                       std::vector<Utility::StructuredHexMesh::ElementHandle>( {0, 2, 3, 7} ) );
+  FRENSIE_CHECK_FLOATING_EQUALITY( distances_to_hex,
+                                   std::vector<double>( {0.280627740988566,
+                                                         0.631412417224273,
+                                                         0.841883222965697,
+                                                         1.122510963954263} ),
+                                   1e-10 );
+  FRENSIE_CHECK_FLOATING_EQUALITY( partial_track_lengths,
+                                   std::vector<double>( {0.350784676235707,
+                                                         0.210470805741424,
+                                                         0.280627740988566,
+                                                         0.089800877116341} ),
+                                   1e-10 );
+
+  // A line segment that misses the mesh
+  hex_elements.clear();
+
+  start_point[0] = 1.1;
+  end_point[0] = 2.0;
+
+  hex_mesh->traverseElements( start_point, end_point,
+                              [&]( const Utility::StructuredHexMesh::ElementHandle hex_element,
+                                   const double,
+                                   const double )
+                              { hex_elements.push_back( hex_element ); } );
+
+  FRENSIE_CHECK( hex_elements.empty() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the weighted track lengths of many line segments can be
+// accumulated
+FRENSIE_UNIT_TEST( StructuredHexMesh, accumulateTrackLengths )
+{
+  std::vector<double> x_planes( {0.0, 0.5, 1.0} ),
+    y_planes( {0.0, 0.5, 1.0} ),
+    z_planes( {0.0, 0.5, 1.0} );
+
+  std::shared_ptr<Utility::StructuredHexMesh> hex_mesh(
+              new Utility::StructuredHexMesh( x_planes, y_planes, z_planes ) );
+
+  std::vector<double> start_points( {-0.5, 0.25, 0.25,
+                                     0.25, 0.75, 0.75,
+                                     2.0, 2.0, 2.0} );
+  std::vector<double> end_points( {1.5, 0.25, 0.25,
+                                   0.25, 0.75, 0.25,
+                                   3.0, 3.0, 3.0} );
+  std::vector<double> weights( {2.0, 0.5, 1.0} );
+
+  std::vector<double> hex_element_track_lengths( 8, 0.0 );
+  hex_element_track_lengths[0] = 1.0;
+
+  hex_mesh->accumulateTrackLengths( start_points.data(),
+                                    end_points.data(),
+                                    weights.data(),
+                                    weights.size(),
+                                    hex_element_track_lengths.data() );
+
+  FRENSIE_CHECK_FLOATING_EQUALITY( hex_element_track_lengths,
+                                   std::vector<double>( {2.0, 1.0, 0.125, 0.0,
+                                                         0.0, 0.0, 0.125, 0.0} ),
+                                   1e-12 );
+}
+
 //---------------------------------------------------------------------------//
 // Check that the mesh data can be exported
 FRENSIE_UNIT_TEST( StructuredHexMesh, exportData )
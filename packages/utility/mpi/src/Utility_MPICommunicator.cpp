@@ -6,9 +6,17 @@
 //!
 //---------------------------------------------------------------------------//
 
+// Std Lib Includes
+#include <algorithm>
+
+// Boost Includes
+#include <boost/serialization/string.hpp>
+#include <boost/serialization/vector.hpp>
+
 // FRENSIE Includes
 #include "Utility_MPICommunicator.hpp"
 #include "Utility_GlobalMPISession.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
 
 namespace Utility{
 
@@ -139,6 +147,51 @@ MPICommunicator::split( int MPI_ENABLED_PARAMETER(color),
 #endif // end HAVE_FRENSIE_MPI
 }
 
+// Split the communicator into multiple, disjoint communicators each
+// of which contains the processes that can share memory
+/*! \details With MPI-3 the processes that share a memory domain are found
+ * directly. Otherwise the processes are grouped by processor name.
+ */
+std::shared_ptr<const Communicator> MPICommunicator::splitByNode() const
+{
+#ifdef HAVE_FRENSIE_MPI
+#if MPI_VERSION >= 3
+  MPI_Comm raw_node_comm;
+
+  int return_value = MPI_Comm_split_type( d_comm,
+                                          MPI_COMM_TYPE_SHARED,
+                                          d_comm.rank(),
+                                          MPI_INFO_NULL,
+                                          &raw_node_comm );
+
+  TEST_FOR_EXCEPTION( return_value != MPI_SUCCESS,
+                      CommunicationError,
+                      "Could not split the communicator by node (error "
+                      "code " << return_value << ")!" );
+
+  boost::mpi::communicator node_comm( raw_node_comm,
+                                      boost::mpi::comm_take_ownership );
+#else // MPI_VERSION >= 3
+  // Processes with the same processor name are on the same node
+  std::string processor_name = boost::mpi::environment::processor_name();
+
+  std::vector<std::string> processor_names;
+
+  boost::mpi::all_gather( d_comm, processor_name, processor_names );
+
+  int color = std::find( processor_names.begin(),
+                         processor_names.end(),
+                         processor_name ) - processor_names.begin();
+
+  boost::mpi::communicator node_comm = d_comm.split( color, d_comm.rank() );
+#endif // end MPI_VERSION >= 3
+
+  return std::shared_ptr<const Communicator>( new MPICommunicator( node_comm ) );
+#else
+  return Communicator::getNull();
+#endif // end HAVE_FRENSIE_MPI
+}
+
 // Create a timer
 std::shared_ptr<Timer> MPICommunicator::createTimer() const
 {
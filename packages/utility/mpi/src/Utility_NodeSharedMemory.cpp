@@ -0,0 +1,167 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedMemory.cpp
+//! \author Alex Robinson
+//! \brief  The node shared memory class definition
+//!
+//---------------------------------------------------------------------------//
+
+// Boost Includes
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/filesystem/operations.hpp>
+#include <boost/serialization/string.hpp>
+
+// FRENSIE Includes
+#include "Utility_NodeSharedMemory.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+/*! \details The initialization function will only be called by the root
+ * process of the node communicator. The memory will be initialized before
+ * any process returns from the constructor.
+ */
+NodeSharedMemory::NodeSharedMemory(
+                             const Communicator& node_comm,
+                             const size_t size,
+                             const InitializationFunction& initialize_memory )
+  : d_shared_memory(),
+    d_local_memory(),
+    d_address( NULL ),
+    d_size( size )
+{
+  // Make sure the initialization function is valid
+  testPrecondition( initialize_memory );
+
+  if( node_comm.size() > 1 && size > 0 )
+    this->mapSharedMemory( node_comm, initialize_memory );
+  else
+  {
+    d_local_memory.resize( (size + sizeof(double) - 1)/sizeof(double) );
+
+    initialize_memory( d_local_memory.data() );
+
+    d_address = d_local_memory.data();
+  }
+}
+
+// Map the shared memory block
+/*! \details The shared memory object is removed once every process has
+ * mapped it so that no shared memory objects are left behind if a process
+ * exits abnormally.
+ */
+void NodeSharedMemory::mapSharedMemory(
+                             const Communicator& node_comm,
+                             const InitializationFunction& initialize_memory )
+{
+  std::string shared_memory_name;
+  std::string error_message;
+
+  // The root process creates and initializes the shared memory
+  if( node_comm.rank() == 0 )
+  {
+    shared_memory_name =
+      boost::filesystem::unique_path( "frensie-%%%%-%%%%-%%%%-%%%%" ).string();
+
+    try{
+      boost::interprocess::shared_memory_object
+        shared_memory( boost::interprocess::create_only,
+                       shared_memory_name.c_str(),
+                       boost::interprocess::read_write );
+
+      shared_memory.truncate( d_size );
+
+      d_shared_memory.reset( new boost::interprocess::mapped_region(
+                                         shared_memory,
+                                         boost::interprocess::read_write ) );
+
+      initialize_memory( d_shared_memory->get_address() );
+    }
+    catch( const std::exception& exception )
+    {
+      boost::interprocess::shared_memory_object::remove(
+                                                 shared_memory_name.c_str() );
+
+      d_shared_memory.reset();
+
+      error_message = exception.what();
+    }
+  }
+
+  Utility::broadcast( node_comm, error_message, 0 );
+
+  TEST_FOR_EXCEPTION( !error_message.empty(),
+                      CommunicationError,
+                      "The node shared memory could not be created: "
+                      << error_message );
+
+  Utility::broadcast( node_comm, shared_memory_name, 0 );
+
+  // The other processes map the shared memory
+  int mapped = 1;
+
+  if( node_comm.rank() != 0 )
+  {
+    try{
+      boost::interprocess::shared_memory_object
+        shared_memory( boost::interprocess::open_only,
+                       shared_memory_name.c_str(),
+                       boost::interprocess::read_only );
+
+      d_shared_memory.reset( new boost::interprocess::mapped_region(
+                                          shared_memory,
+                                          boost::interprocess::read_only ) );
+    }
+    catch( const std::exception& exception )
+    {
+      error_message = exception.what();
+
+      mapped = 0;
+    }
+  }
+
+  Utility::allReduce( node_comm, mapped, Utility::minimum<int>() );
+
+  // The memory will persist until every process unmaps it
+  if( node_comm.rank() == 0 )
+  {
+    boost::interprocess::shared_memory_object::remove(
+                                                 shared_memory_name.c_str() );
+  }
+
+  TEST_FOR_EXCEPTION( mapped == 0,
+                      CommunicationError,
+                      "The node shared memory could not be mapped by every "
+                      "process of the node"
+                      << (error_message.empty() ? "" : ": ")
+                      << error_message << "!" );
+
+  d_address = d_shared_memory->get_address();
+}
+
+// Return the memory address
+const void* NodeSharedMemory::getAddress() const
+{
+  return d_address;
+}
+
+// Return the memory size (bytes)
+size_t NodeSharedMemory::getSize() const
+{
+  return d_size;
+}
+
+// Check if the memory is shared with other processes
+bool NodeSharedMemory::isShared() const
+{
+  return d_shared_memory.get() != NULL;
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedMemory.cpp
+//---------------------------------------------------------------------------//
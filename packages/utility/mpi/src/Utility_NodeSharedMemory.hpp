@@ -0,0 +1,104 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedMemory.hpp
+//! \author Alex Robinson
+//! \brief  The node shared memory class declaration
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_NODE_SHARED_MEMORY_HPP
+#define UTILITY_NODE_SHARED_MEMORY_HPP
+
+// Std Lib Includes
+#include <memory>
+#include <functional>
+
+// Boost Includes
+#include <boost/interprocess/mapped_region.hpp>
+
+// FRENSIE Includes
+#include "Utility_Communicator.hpp"
+#include "Utility_Vector.hpp"
+
+namespace Utility{
+
+/*! The node shared memory class
+ * \details This class allocates a block of read-only memory once per node.
+ * The root process of the node communicator (see
+ * Utility::Communicator::splitByNode) allocates and initializes the memory
+ * and every other process of the node maps the same pages (POSIX shared
+ * memory is used). Large read-only data (e.g. nuclear data tables) can
+ * therefore be stored once per node instead of once per process. When the
+ * node communicator only contains a single process the memory will simply be
+ * allocated on the heap. The construction of this object is a collective
+ * operation on the node communicator. Destruction is not collective - the
+ * memory is released when the last process that maps it is done with it.
+ * \ingroup mpi
+ */
+class NodeSharedMemory
+{
+
+public:
+
+  //! The memory initialization function type
+  typedef std::function<void(void*)> InitializationFunction;
+
+  //! Constructor
+  NodeSharedMemory( const Communicator& node_comm,
+                    const size_t size,
+                    const InitializationFunction& initialize_memory );
+
+  //! Copy an array to node shared memory
+  template<typename T>
+  static std::shared_ptr<const NodeSharedMemory> copyArray(
+                                                 const Communicator& node_comm,
+                                                 const T* array,
+                                                 const size_t array_size );
+
+  //! Destructor
+  ~NodeSharedMemory()
+  { /* ... */ }
+
+  //! Return the memory address
+  const void* getAddress() const;
+
+  //! Return the memory size (bytes)
+  size_t getSize() const;
+
+  //! Check if the memory is shared with other processes
+  bool isShared() const;
+
+private:
+
+  // Map the shared memory block
+  void mapSharedMemory( const Communicator& node_comm,
+                        const InitializationFunction& initialize_memory );
+
+  // The shared memory
+  std::unique_ptr<boost::interprocess::mapped_region> d_shared_memory;
+
+  // The local memory (only used when the memory is not shared)
+  std::vector<double> d_local_memory;
+
+  // The memory address
+  const void* d_address;
+
+  // The memory size
+  size_t d_size;
+};
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// Template Includes
+//---------------------------------------------------------------------------//
+
+#include "Utility_NodeSharedMemory_def.hpp"
+
+//---------------------------------------------------------------------------//
+
+#endif // end UTILITY_NODE_SHARED_MEMORY_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedMemory.hpp
+//---------------------------------------------------------------------------//
@@ -0,0 +1,50 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_NodeSharedMemory_def.hpp
+//! \author Alex Robinson
+//! \brief  The node shared memory class template definitions
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_NODE_SHARED_MEMORY_DEF_HPP
+#define UTILITY_NODE_SHARED_MEMORY_DEF_HPP
+
+// Std Lib Includes
+#include <algorithm>
+#include <type_traits>
+
+namespace Utility{
+
+// Copy an array to node shared memory
+/*! \details Only the array of the root process of the node communicator
+ * will be copied (the other processes must still supply an array of the
+ * same size). This is a collective operation on the node communicator.
+ */
+template<typename T>
+std::shared_ptr<const NodeSharedMemory> NodeSharedMemory::copyArray(
+                                                 const Communicator& node_comm,
+                                                 const T* array,
+                                                 const size_t array_size )
+{
+  // Only trivially copyable types can be stored in shared memory
+  static_assert( std::is_trivially_copyable<T>::value,
+                 "Only trivially copyable types can be stored in node "
+                 "shared memory!" );
+
+  return std::make_shared<const NodeSharedMemory>(
+                               node_comm,
+                               array_size*sizeof(T),
+                               [array, array_size]( void* address ){
+                                 std::copy( array,
+                                            array+array_size,
+                                            static_cast<T*>( address ) );
+                               } );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_NODE_SHARED_MEMORY_DEF_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_NodeSharedMemory_def.hpp
+//---------------------------------------------------------------------------//
@@ -95,6 +95,13 @@ std::shared_ptr<const Communicator> SerialCommunicator::split( int color, int ke
   return s_serial_comm;
 }
 
+// Split the communicator into multiple, disjoint communicators each
+// of which contains the processes that can share memory
+std::shared_ptr<const Communicator> SerialCommunicator::splitByNode() const
+{
+  return s_serial_comm;
+}
+
 // Create a timer
 std::shared_ptr<Timer> SerialCommunicator::createTimer() const
 {
@@ -68,6 +68,11 @@ public:
    */
   std::shared_ptr<const Communicator> split( int color, int key ) const override;
 
+  /*! \brief Split the communicator into multiple, disjoint communicators each
+   * of which contains the processes that can share memory
+   */
+  std::shared_ptr<const Communicator> splitByNode() const override;
+
   //! Create a timer
   std::shared_ptr<Timer> createTimer() const override;
 
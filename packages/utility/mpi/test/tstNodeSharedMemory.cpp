@@ -0,0 +1,111 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstNodeSharedMemory.cpp
+//! \author Alex Robinson
+//! \brief  Node shared memory unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <algorithm>
+#include <vector>
+
+// FRENSIE Includes
+#include "Utility_NodeSharedMemory.hpp"
+#include "Utility_Communicator.hpp"
+#include "Utility_GlobalMPISession.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that a communicator can be split by node
+FRENSIE_UNIT_TEST( Communicator, splitByNode )
+{
+  std::shared_ptr<const Utility::Communicator> comm =
+    Utility::Communicator::getDefault();
+
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    comm->splitByNode();
+
+  FRENSIE_REQUIRE( node_comm.get() != NULL );
+  FRENSIE_REQUIRE( node_comm->isValid() );
+  FRENSIE_CHECK( node_comm->size() >= 1 );
+  FRENSIE_CHECK( node_comm->size() <= comm->size() );
+  FRENSIE_CHECK( node_comm->rank() >= 0 );
+  FRENSIE_CHECK( node_comm->rank() < node_comm->size() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that node shared memory can be created
+FRENSIE_UNIT_TEST( NodeSharedMemory, constructor )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  size_t number_of_calls = 0;
+
+  Utility::NodeSharedMemory memory(
+                          *node_comm,
+                          100*sizeof(double),
+                          [&number_of_calls]( void* address ){
+                            double* values = static_cast<double*>( address );
+
+                            for( size_t i = 0; i < 100; ++i )
+                              values[i] = i + 0.5;
+
+                            ++number_of_calls;
+                          } );
+
+  FRENSIE_CHECK_EQUAL( memory.getSize(), 100*sizeof(double) );
+  FRENSIE_CHECK_EQUAL( memory.isShared(), node_comm->size() > 1 );
+
+  // Only the root process initializes the memory
+  if( node_comm->rank() == 0 )
+  {
+    FRENSIE_CHECK_EQUAL( number_of_calls, 1 );
+  }
+  else
+  {
+    FRENSIE_CHECK_EQUAL( number_of_calls, 0 );
+  }
+
+  const double* values = static_cast<const double*>( memory.getAddress() );
+
+  FRENSIE_REQUIRE( values != NULL );
+  FRENSIE_CHECK_EQUAL( values[0], 0.5 );
+  FRENSIE_CHECK_EQUAL( values[50], 50.5 );
+  FRENSIE_CHECK_EQUAL( values[99], 99.5 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that an array can be copied to node shared memory
+FRENSIE_UNIT_TEST( NodeSharedMemory, copyArray )
+{
+  std::shared_ptr<const Utility::Communicator> node_comm =
+    Utility::Communicator::getDefault()->splitByNode();
+
+  std::vector<double> array( 1000 );
+
+  for( size_t i = 0; i < array.size(); ++i )
+    array[i] = i + 0.5;
+
+  std::shared_ptr<const Utility::NodeSharedMemory> memory =
+    Utility::NodeSharedMemory::copyArray( *node_comm,
+                                          array.data(),
+                                          array.size() );
+
+  FRENSIE_REQUIRE( memory.get() != NULL );
+  FRENSIE_CHECK_EQUAL( memory->getSize(), 1000*sizeof(double) );
+  FRENSIE_CHECK_EQUAL( memory->isShared(), node_comm->size() > 1 );
+
+  const double* values = static_cast<const double*>( memory->getAddress() );
+
+  FRENSIE_REQUIRE( values != NULL );
+  FRENSIE_CHECK( values != array.data() );
+  FRENSIE_CHECK( std::equal( array.begin(), array.end(), values ) );
+}
+
+//---------------------------------------------------------------------------//
+// end tstNodeSharedMemory.cpp
+//---------------------------------------------------------------------------//
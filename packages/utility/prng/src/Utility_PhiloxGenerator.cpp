@@ -0,0 +1,142 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Definition of a counter-based pseudo-random number generator
+//!         that can be used to create non-overlapping parallel random number
+//!         streams.
+//!
+//---------------------------------------------------------------------------//
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_DesignByContract.hpp"
+
+namespace Utility{
+
+// Constructor
+PhiloxGenerator::PhiloxGenerator( const uint32_t seed )
+{
+  d_counter[3] = seed;
+
+  this->changeHistory( 0ULL );
+}
+
+// Initialize the generator for the desired history
+/*! \details The particle number will be reset to 0.
+ */
+void PhiloxGenerator::changeHistory( const unsigned long long history_number )
+{
+  d_key[0] = (uint32_t)history_number;
+  d_key[1] = (uint32_t)(history_number >> 32);
+
+  this->changeParticle( 0u );
+}
+
+// Initialize the generator for the next history
+void PhiloxGenerator::nextHistory()
+{
+  this->changeHistory( this->getHistory() + 1ULL );
+}
+
+// Initialize the generator for the desired particle of the current history
+/*! \details Each particle of a history has its own stream. The stream
+ * of particle 0 is used by default.
+ */
+void PhiloxGenerator::changeParticle( const uint32_t particle_number )
+{
+  d_counter[2] = particle_number;
+
+  this->resetCounter();
+}
+
+// Reset the counter of the current history and particle
+void PhiloxGenerator::resetCounter()
+{
+  d_counter[0] = 0u;
+  d_counter[1] = 0u;
+
+  // The first block will be generated on the first request
+  d_block_index = PhiloxGenerator::block_words;
+}
+
+// Return the current history
+unsigned long long PhiloxGenerator::getHistory() const
+{
+  return ((unsigned long long)d_key[1] << 32) | d_key[0];
+}
+
+// Return the current particle
+uint32_t PhiloxGenerator::getParticle() const
+{
+  return d_counter[2];
+}
+
+// Return the number of random numbers drawn for the history and particle
+unsigned long long PhiloxGenerator::getDrawCounter() const
+{
+  const unsigned long long generated_blocks =
+    ((unsigned long long)d_counter[1] << 32) | d_counter[0];
+
+  return generated_blocks*PhiloxGenerator::block_words + d_block_index -
+    PhiloxGenerator::block_words;
+}
+
+// Return the seed
+uint32_t PhiloxGenerator::getSeed() const
+{
+  return d_counter[3];
+}
+
+// Fill the buffer with random numbers for the current history and particle
+/*! \details The random numbers that are returned are identical to the
+ * random numbers that would be returned by calling getRandomNumber
+ * number_of_random_numbers times. Full blocks are written directly to the
+ * buffer.
+ */
+void PhiloxGenerator::getRandomNumbers( double* random_numbers,
+                                        const size_t number_of_random_numbers )
+{
+  // Make sure the buffer is valid
+  testPrecondition( random_numbers != NULL || number_of_random_numbers == 0 );
+
+  size_t i = 0;
+
+  // Use the remaining random bits in the current block
+  while( i < number_of_random_numbers &&
+         d_block_index < PhiloxGenerator::block_words )
+  {
+    random_numbers[i] = this->getRandomNumber();
+
+    ++i;
+  }
+
+  // Write full blocks directly to the buffer
+  while( i + PhiloxGenerator::block_words <= number_of_random_numbers )
+  {
+    this->generateNextBlock();
+
+    random_numbers[i] =
+      PhiloxGenerator::convertToRandomNumber( d_block[0], d_block[1] );
+    random_numbers[i+1] =
+      PhiloxGenerator::convertToRandomNumber( d_block[2], d_block[3] );
+
+    d_block_index = PhiloxGenerator::block_words;
+
+    i += PhiloxGenerator::block_words;
+  }
+
+  // Fill the end of the buffer
+  while( i < number_of_random_numbers )
+  {
+    random_numbers[i] = this->getRandomNumber();
+
+    ++i;
+  }
+}
+
+} // end Utility namespace
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
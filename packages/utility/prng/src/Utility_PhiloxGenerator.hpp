@@ -0,0 +1,214 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_PhiloxGenerator.hpp
+//! \author Alex Robinson
+//! \brief  Declaration of a counter-based pseudo-random number generator
+//!         that can be used to create non-overlapping parallel random number
+//!         streams.
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_PHILOX_GENERATOR_HPP
+#define UTILITY_PHILOX_GENERATOR_HPP
+
+// Std Lib Includes
+#include <stdint.h>
+#include <cstddef>
+
+namespace Utility{
+
+//! The Philox4x32-10 counter-based pseudo-random number generator
+/*! \details A counter-based generator has no state other than a key and a
+ * counter - each block of random bits is the result of applying a keyed
+ * bijection to the counter (see Salmon et al., "Parallel Random Numbers: As
+ * Easy as 1, 2, 3", SC11). The history number is used as the 64-bit key.
+ * The 128-bit counter is made up of the 64-bit draw block counter, the
+ * 32-bit particle number and the 32-bit seed. Each block provides two random
+ * numbers, which means that every (history, particle) stream can supply
+ * 2^65 random numbers before it would wrap. Streams can therefore never
+ * overlap, regardless of how many random numbers a history requires. All
+ * methods are non-virtual so that the random number fast path can be
+ * inlined.
+ */
+class PhiloxGenerator
+{
+
+public:
+
+  //! Constructor
+  PhiloxGenerator( const uint32_t seed = PhiloxGenerator::default_seed );
+
+  //! Destructor
+  ~PhiloxGenerator()
+  { /* ... */ }
+
+  //! Return a random number for the current history and particle
+  double getRandomNumber();
+
+  //! Return a random integer in [0,2^64) for the current history and particle
+  unsigned long long getRandomInteger();
+
+  //! Fill the buffer with random numbers for the current history and particle
+  void getRandomNumbers( double* random_numbers,
+                         const size_t number_of_random_numbers );
+
+  //! Initialize the generator for the desired history
+  void changeHistory( const unsigned long long history_number );
+
+  //! Initialize the generator for the next history
+  void nextHistory();
+
+  //! Initialize the generator for the desired particle of the current history
+  void changeParticle( const uint32_t particle_number );
+
+  //! Return the current history
+  unsigned long long getHistory() const;
+
+  //! Return the current particle
+  uint32_t getParticle() const;
+
+  //! Return the number of random numbers drawn for the history and particle
+  unsigned long long getDrawCounter() const;
+
+  //! Return the seed
+  uint32_t getSeed() const;
+
+  //! Apply the Philox4x32-10 bijection to a counter
+  static void generateBlock( const uint32_t counter[4],
+                             const uint32_t key[2],
+                             uint32_t block[4] );
+
+private:
+
+  // Apply a single Philox4x32 round
+  static void applyRound( uint32_t counter[4], const uint32_t key[2] );
+
+  // Convert a pair of 32-bit words to a random number in [0,1)
+  static double convertToRandomNumber( const uint32_t low_word,
+                                       const uint32_t high_word );
+
+  // Generate the next block of random bits
+  void generateNextBlock();
+
+  // Reset the counter of the current history and particle
+  void resetCounter();
+
+  // The default seed
+  static const uint32_t default_seed = 0u;
+
+  // The number of 64-bit words in a block
+  static const unsigned block_words = 2u;
+
+  // The key (the history number)
+  uint32_t d_key[2];
+
+  // The counter (block lo, block hi, particle number, seed)
+  uint32_t d_counter[4];
+
+  // The current block of random bits
+  uint32_t d_block[4];
+
+  // The index of the next 64-bit word in the current block
+  unsigned d_block_index;
+};
+
+// Apply a single Philox4x32 round
+inline void PhiloxGenerator::applyRound( uint32_t counter[4],
+                                         const uint32_t key[2] )
+{
+  const uint64_t product_0 = (uint64_t)0xD2511F53u*counter[0];
+  const uint64_t product_1 = (uint64_t)0xCD9E8D57u*counter[2];
+
+  const uint32_t new_counter_0 =
+    (uint32_t)(product_1 >> 32) ^ counter[1] ^ key[0];
+  const uint32_t new_counter_2 =
+    (uint32_t)(product_0 >> 32) ^ counter[3] ^ key[1];
+
+  counter[0] = new_counter_0;
+  counter[1] = (uint32_t)product_1;
+  counter[2] = new_counter_2;
+  counter[3] = (uint32_t)product_0;
+}
+
+// Apply the Philox4x32-10 bijection to a counter
+inline void PhiloxGenerator::generateBlock( const uint32_t counter[4],
+                                            const uint32_t key[2],
+                                            uint32_t block[4] )
+{
+  uint32_t round_key[2] = {key[0], key[1]};
+
+  block[0] = counter[0];
+  block[1] = counter[1];
+  block[2] = counter[2];
+  block[3] = counter[3];
+
+  PhiloxGenerator::applyRound( block, round_key );
+
+  for( unsigned i = 1u; i < 10u; ++i )
+  {
+    // Bump the key (Weyl sequence)
+    round_key[0] += 0x9E3779B9u;
+    round_key[1] += 0xBB67AE85u;
+
+    PhiloxGenerator::applyRound( block, round_key );
+  }
+}
+
+// Convert a pair of 32-bit words to a random number in [0,1)
+/*! \details The 53 most significant bits are used (bits*2^-53).
+ */
+inline double PhiloxGenerator::convertToRandomNumber(
+                                                   const uint32_t low_word,
+                                                   const uint32_t high_word )
+{
+  return ((((uint64_t)high_word << 32) | low_word) >> 11)*
+    1.1102230246251565e-16;
+}
+
+// Generate the next block of random bits
+inline void PhiloxGenerator::generateNextBlock()
+{
+  PhiloxGenerator::generateBlock( d_counter, d_key, d_block );
+
+  // Increment the 64-bit block counter
+  if( ++d_counter[0] == 0u )
+    ++d_counter[1];
+
+  d_block_index = 0u;
+}
+
+// Return a random integer in [0,2^64) for the current history and particle
+inline unsigned long long PhiloxGenerator::getRandomInteger()
+{
+  if( d_block_index == PhiloxGenerator::block_words )
+    this->generateNextBlock();
+
+  const unsigned word_index = 2u*d_block_index;
+
+  ++d_block_index;
+
+  return ((unsigned long long)d_block[word_index+1] << 32) |
+    d_block[word_index];
+}
+
+// Return a random number for the current history and particle
+inline double PhiloxGenerator::getRandomNumber()
+{
+  if( d_block_index == PhiloxGenerator::block_words )
+    this->generateNextBlock();
+
+  const unsigned word_index = 2u*d_block_index;
+
+  ++d_block_index;
+
+  return PhiloxGenerator::convertToRandomNumber( d_block[word_index],
+                                                 d_block[word_index+1] );
+}
+
+} // end Utility namespace
+
+#endif // end UTILITY_PHILOX_GENERATOR_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_PhiloxGenerator.hpp
+//---------------------------------------------------------------------------//
@@ -13,14 +13,51 @@
 
 namespace Utility{
 
+// Initialize the generator type
+RandomNumberGeneratorType RandomNumberGenerator::generator_type =
+  LINEAR_CONGRUENTIAL_GENERATOR;
+
 // Initialize the stored generator pointer
 boost::ptr_vector<LinearCongruentialGenerator>
 RandomNumberGenerator::generator( 1 );
 
+// Initialize the counter-based generators
+std::vector<RandomNumberGenerator::CounterBasedGenerator>
+RandomNumberGenerator::counter_based_generator;
+
 // Constructor
 RandomNumberGenerator::RandomNumberGenerator()
 { /* ... */ }
 
+// Set the generator type (default: linear congruential generator)
+/*! \details This method can be called before or after the streams have been
+ * created. It should only be called from the master thread.
+ */
+void RandomNumberGenerator::setGeneratorType(
+                                         const RandomNumberGeneratorType type )
+{
+  generator_type = type;
+
+  RandomNumberGenerator::updateActiveGenerators();
+}
+
+// Return the generator type
+RandomNumberGeneratorType RandomNumberGenerator::getGeneratorType()
+{
+  return generator_type;
+}
+
+// Update the active flag of each counter-based generator
+void RandomNumberGenerator::updateActiveGenerators()
+{
+  for( size_t i = 0; i < counter_based_generator.size(); ++i )
+  {
+    counter_based_generator[i].active =
+      (generator_type == PHILOX_GENERATOR) &&
+      !counter_based_generator[i].fake_stream_set;
+  }
+}
+
 //! Check if the streams have been created
 bool RandomNumberGenerator::hasStreams()
 {
@@ -28,6 +65,9 @@ bool RandomNumberGenerator::hasStreams()
   if( generator.size() < OpenMPProperties::getRequestedNumberOfThreads() )
     return false;
 
+  if( counter_based_generator.size() < generator.size() )
+    return false;
+
   // Check that each stream has been initialized
   for( unsigned i = 0u; i < generator.size(); ++i )
   {
@@ -49,14 +89,25 @@ void RandomNumberGenerator::createStreams()
     #pragma omp master
     {
       generator.resize( OpenMPProperties::getRequestedNumberOfThreads() );
+
+      counter_based_generator.resize(
+                           OpenMPProperties::getRequestedNumberOfThreads() );
     }
 
     #pragma omp barrier
 
     generator.replace( OpenMPProperties::getThreadId(),
 		       new LinearCongruentialGenerator() );
+
+    CounterBasedGenerator& thread_counter_based_generator =
+      counter_based_generator[OpenMPProperties::getThreadId()];
+
+    thread_counter_based_generator.generator = PhiloxGenerator();
+    thread_counter_based_generator.fake_stream_set = false;
   }
 
+  RandomNumberGenerator::updateActiveGenerators();
+
   // Make sure the streams have been created
   testPostcondition( !generator.is_null( OpenMPProperties::getThreadId() ));
 }
@@ -71,6 +122,8 @@ void RandomNumberGenerator::initialize(
   testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
 
   generator[OpenMPProperties::getThreadId()].changeHistory(history_number);
+
+  counter_based_generator[OpenMPProperties::getThreadId()].generator.changeHistory( history_number );
 }
 
 // Initialize the generator for the next history
@@ -82,6 +135,51 @@ void RandomNumberGenerator::initializeNextHistory()
   testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
 
   generator[OpenMPProperties::getThreadId()].nextHistory();
+
+  counter_based_generator[OpenMPProperties::getThreadId()].generator.nextHistory();
+}
+
+// Initialize the generator for the desired particle of the current history
+/*! \details Only the counter-based generator has a separate stream for each
+ * particle of a history. The linear congruential generator will not be
+ * modified by this method.
+ */
+void RandomNumberGenerator::initializeParticle(
+                                               const unsigned particle_number )
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( OpenMPProperties::getThreadId() <
+                    counter_based_generator.size() );
+
+  counter_based_generator[OpenMPProperties::getThreadId()].generator.changeParticle( particle_number );
+}
+
+// Fill the buffer with random numbers in interval [0,1)
+/*! \details The random numbers will be identical to the random numbers that
+ * would be returned by calling getRandomNumber<double>
+ * number_of_random_numbers times.
+ */
+void RandomNumberGenerator::getRandomNumbers(
+                                      double* random_numbers,
+                                      const size_t number_of_random_numbers )
+{
+  // Make sure the generator has been set up correctly
+  testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
+  testPrecondition( OpenMPProperties::getThreadId() <
+                    counter_based_generator.size() );
+
+  const unsigned thread_id = OpenMPProperties::getThreadId();
+
+  if( counter_based_generator[thread_id].active )
+  {
+    counter_based_generator[thread_id].generator.getRandomNumbers(
+                                    random_numbers, number_of_random_numbers );
+  }
+  else
+  {
+    for( size_t i = 0; i < number_of_random_numbers; ++i )
+      random_numbers[i] = generator[thread_id].getRandomNumber();
+  }
 }
 
 // Set a fake stream for the generator
@@ -98,6 +196,12 @@ void RandomNumberGenerator::setFakeStream(
   {
     generator.replace( OpenMPProperties::getThreadId(),
 		       new FakeGenerator( fake_stream ) );
+
+    if( thread_id < counter_based_generator.size() )
+    {
+      counter_based_generator[thread_id].fake_stream_set = true;
+      counter_based_generator[thread_id].active = false;
+    }
   }
 
   // Make sure the generator has been created
@@ -116,6 +220,13 @@ void RandomNumberGenerator::unsetFakeStream( const unsigned thread_id )
   {
     generator.replace( OpenMPProperties::getThreadId(),
 		       new LinearCongruentialGenerator() );
+
+    if( thread_id < counter_based_generator.size() )
+    {
+      counter_based_generator[thread_id].fake_stream_set = false;
+      counter_based_generator[thread_id].active =
+        (generator_type == PHILOX_GENERATOR);
+    }
   }
 
   // Make sure that the generator has been created
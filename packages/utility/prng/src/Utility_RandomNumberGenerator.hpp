@@ -18,17 +18,33 @@
 
 // FRENSIE includes
 #include "Utility_LinearCongruentialGenerator.hpp"
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_RandomNumberGeneratorType.hpp"
 #include "Utility_OpenMPProperties.hpp"
 #include "Utility_DesignByContract.hpp"
 
 namespace Utility{
 
-//! Struct that is used to obtain random numbers
+/*! Struct that is used to obtain random numbers
+ * \details The linear congruential generator is used by default. Its
+ * history streams are separated by a fixed stride, which means that a
+ * history that requires more random numbers than the stride will overlap the
+ * stream of the next history. The counter-based Philox generator does not
+ * have this limitation and can also provide a separate stream for each
+ * particle of a history. The Philox generator is called directly (no virtual
+ * function call) unless a fake stream has been set.
+ */
 class RandomNumberGenerator
 {
 
 public:
 
+  //! Set the generator type (default: linear congruential generator)
+  static void setGeneratorType( const RandomNumberGeneratorType type );
+
+  //! Return the generator type
+  static RandomNumberGeneratorType getGeneratorType();
+
   //! Check if the streams have been created
   static bool hasStreams();
 
@@ -41,6 +57,9 @@ public:
   //! Initialize the generator for the next history
   static void initializeNextHistory();
 
+  //! Initialize the generator for the desired particle of the current history
+  static void initializeParticle( const unsigned particle_number );
+
   //! Set a fake stream for the generator
   static void setFakeStream( const std::vector<double>& fake_stream,
 			     const unsigned thread_id = 0u );
@@ -52,6 +71,10 @@ public:
   template<typename ScalarType>
   static ScalarType getRandomNumber();
 
+  //! Fill the buffer with random numbers in interval [0,1)
+  static void getRandomNumbers( double* random_numbers,
+                                const size_t number_of_random_numbers );
+
   //! Destructor
   ~RandomNumberGenerator()
   { /* ... */ }
@@ -61,33 +84,66 @@ private:
   // Constructor
   RandomNumberGenerator();
 
+  // The counter-based generator of a thread
+  struct CounterBasedGenerator
+  {
+    // The generator
+    PhiloxGenerator generator;
+
+    // Records if the counter-based generator is active
+    bool active;
+
+    // Records if a fake stream has been set
+    bool fake_stream_set;
+
+    // Pad the struct to two cache lines so that the generators of
+    // neighbouring threads can never share a cache line (std::vector does
+    // not guarantee cache line alignment of its elements)
+    char padding[128 - sizeof(PhiloxGenerator) - 2*sizeof(bool)];
+  };
+
+  // Update the active flag of each counter-based generator
+  static void updateActiveGenerators();
+
+  // The generator type
+  static RandomNumberGeneratorType generator_type;
+
   // Pointer to generator
   static boost::ptr_vector<LinearCongruentialGenerator> generator;
+
+  // The counter-based generators
+  static std::vector<CounterBasedGenerator> counter_based_generator;
 };
 
-// Return a random number in interval [0,1)
-template<typename ScalarType>
-inline ScalarType RandomNumberGenerator::getRandomNumber()
+// Return a random double in interval [0,1)
+template<>
+inline double RandomNumberGenerator::getRandomNumber<double>()
 {
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
+  testPrecondition( OpenMPProperties::getThreadId() <
+                    counter_based_generator.size() );
   // Make sure that the generator has been initialized
   testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
 
-  return static_cast<ScalarType>(
-	     generator[OpenMPProperties::getThreadId()].getRandomNumber() );
+  const unsigned thread_id = OpenMPProperties::getThreadId();
+
+  if( counter_based_generator[thread_id].active )
+    return counter_based_generator[thread_id].generator.getRandomNumber();
+  else
+    return generator[thread_id].getRandomNumber();
 }
 
-// Return a random double in interval [0,1)
-template<>
-inline double RandomNumberGenerator::getRandomNumber<double>()
+// Return a random number in interval [0,1)
+template<typename ScalarType>
+inline ScalarType RandomNumberGenerator::getRandomNumber()
 {
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
   // Make sure that the generator has been initialized
   testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
 
-  return generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  return static_cast<ScalarType>( getRandomNumber<double>() );
 }
 
 // Return a random long long unsigned integer in [0,2^64)
@@ -97,12 +153,21 @@ RandomNumberGenerator::getRandomNumber<unsigned long long>()
 {
   // Make sure the generator has been set up correctly
   testPrecondition( OpenMPProperties::getThreadId() < generator.size() );
+  testPrecondition( OpenMPProperties::getThreadId() <
+                    counter_based_generator.size() );
   // Make sure that the generator has been initialized
   testPrecondition( !generator.is_null( OpenMPProperties::getThreadId() ) );
 
-  generator[OpenMPProperties::getThreadId()].getRandomNumber();
+  const unsigned thread_id = OpenMPProperties::getThreadId();
+
+  if( counter_based_generator[thread_id].active )
+    return counter_based_generator[thread_id].generator.getRandomInteger();
+  else
+  {
+    generator[thread_id].getRandomNumber();
 
-  return generator[OpenMPProperties::getThreadId()].getGeneratorState();
+    return generator[thread_id].getGeneratorState();
+  }
 }
 
 } // end Utility namespace
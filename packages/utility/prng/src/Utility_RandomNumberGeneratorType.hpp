@@ -0,0 +1,103 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   Utility_RandomNumberGeneratorType.hpp
+//! \author Alex Robinson
+//! \brief  Random number generator type enum and helper function declarations
+//!
+//---------------------------------------------------------------------------//
+
+#ifndef UTILITY_RANDOM_NUMBER_GENERATOR_TYPE_HPP
+#define UTILITY_RANDOM_NUMBER_GENERATOR_TYPE_HPP
+
+// Std Lib Includes
+#include <string>
+#include <iostream>
+
+// FRENSIE Includes
+#include "Utility_ToStringTraits.hpp"
+#include "Utility_SerializationHelpers.hpp"
+#include "Utility_ExceptionTestMacros.hpp"
+
+namespace Utility{
+
+/*! The random number generator type enumeration
+ *
+ * When adding a new type the ToStringTraits methods and the serialization
+ * method must be updated.
+ */
+enum RandomNumberGeneratorType
+{
+  LINEAR_CONGRUENTIAL_GENERATOR = 0,
+  PHILOX_GENERATOR = 1
+};
+
+/*! \brief Specialization of Utility::ToStringTraits for
+ * Utility::RandomNumberGeneratorType
+ * \ingroup to_string_traits
+ */
+template<>
+struct ToStringTraits<RandomNumberGeneratorType>
+{
+  //! Convert a Utility::RandomNumberGeneratorType to a string
+  static std::string toString( const RandomNumberGeneratorType type );
+
+  //! Place the Utility::RandomNumberGeneratorType in a stream
+  static void toStream( std::ostream& os, const RandomNumberGeneratorType type );
+};
+
+} // end Utility namespace
+
+namespace std{
+
+//! Stream operator for printing RandomNumberGeneratorType enums
+inline std::ostream& operator<<( std::ostream& os,
+                                 const Utility::RandomNumberGeneratorType type )
+{
+  os << Utility::toString( type );
+  return os;
+}
+
+} // end std namespace
+
+namespace boost{
+
+namespace serialization{
+
+//! Serialize the Utility::RandomNumberGeneratorType enum
+template<typename Archive>
+void serialize( Archive& archive,
+                Utility::RandomNumberGeneratorType& type,
+                const unsigned version )
+{
+  if( Archive::is_saving::value )
+    archive & (int)type;
+  else
+  {
+    int raw_type;
+
+    archive & raw_type;
+
+    switch( raw_type )
+    {
+      BOOST_SERIALIZATION_ENUM_CASE( Utility::LINEAR_CONGRUENTIAL_GENERATOR, int, type );
+      BOOST_SERIALIZATION_ENUM_CASE( Utility::PHILOX_GENERATOR, int, type );
+
+      default:
+      {
+        THROW_EXCEPTION( std::logic_error,
+                         "Cannot convert the deserialized raw random number "
+                         "generator type to its corresponding enum value!" );
+      }
+    }
+  }
+}
+
+} // end serialization namespace
+
+} // end boost namespace
+
+#endif // end UTILITY_RANDOM_NUMBER_GENERATOR_TYPE_HPP
+
+//---------------------------------------------------------------------------//
+// end Utility_RandomNumberGeneratorType.hpp
+//---------------------------------------------------------------------------//
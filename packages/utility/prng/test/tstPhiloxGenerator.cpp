@@ -0,0 +1,177 @@
+//---------------------------------------------------------------------------//
+//!
+//! \file   tstPhiloxGenerator.cpp
+//! \author Alex Robinson
+//! \brief  Philox Generator class unit tests
+//!
+//---------------------------------------------------------------------------//
+
+// Std Lib Includes
+#include <iostream>
+#include <vector>
+#include <set>
+
+// FRENSIE Includes
+#include "Utility_PhiloxGenerator.hpp"
+#include "Utility_UnitTestHarnessWithMain.hpp"
+
+//---------------------------------------------------------------------------//
+// Tests.
+//---------------------------------------------------------------------------//
+// Check that the Philox4x32-10 bijection matches the known answers
+FRENSIE_UNIT_TEST( PhiloxGenerator, generateBlock )
+{
+  uint32_t counter[4] = {0u, 0u, 0u, 0u};
+  uint32_t key[2] = {0u, 0u};
+  uint32_t block[4];
+
+  Utility::PhiloxGenerator::generateBlock( counter, key, block );
+
+  FRENSIE_CHECK_EQUAL( block[0], 0x6627e8d5u );
+  FRENSIE_CHECK_EQUAL( block[1], 0xe169c58du );
+  FRENSIE_CHECK_EQUAL( block[2], 0xbc57ac4cu );
+  FRENSIE_CHECK_EQUAL( block[3], 0x9b00dbd8u );
+
+  counter[0] = 0xffffffffu;
+  counter[1] = 0xffffffffu;
+  counter[2] = 0xffffffffu;
+  counter[3] = 0xffffffffu;
+  key[0] = 0xffffffffu;
+  key[1] = 0xffffffffu;
+
+  Utility::PhiloxGenerator::generateBlock( counter, key, block );
+
+  FRENSIE_CHECK_EQUAL( block[0], 0x408f276du );
+  FRENSIE_CHECK_EQUAL( block[1], 0x41c83b0eu );
+  FRENSIE_CHECK_EQUAL( block[2], 0xa20bc7c6u );
+  FRENSIE_CHECK_EQUAL( block[3], 0x6d5451fdu );
+
+  counter[0] = 0x243f6a88u;
+  counter[1] = 0x85a308d3u;
+  counter[2] = 0x13198a2eu;
+  counter[3] = 0x03707344u;
+  key[0] = 0xa4093822u;
+  key[1] = 0x299f31d0u;
+
+  Utility::PhiloxGenerator::generateBlock( counter, key, block );
+
+  FRENSIE_CHECK_EQUAL( block[0], 0xd16cfe09u );
+  FRENSIE_CHECK_EQUAL( block[1], 0x94fdccebu );
+  FRENSIE_CHECK_EQUAL( block[2], 0x5001e420u );
+  FRENSIE_CHECK_EQUAL( block[3], 0x24126ea1u );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a random number in the interval [0,1) can be obtained
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumber )
+{
+  Utility::PhiloxGenerator generator;
+
+  FRENSIE_CHECK_EQUAL( generator.getDrawCounter(), 0ULL );
+
+  for( unsigned i = 0; i < 1000; ++i )
+  {
+    double random_number = generator.getRandomNumber();
+
+    FRENSIE_CHECK_GREATER_OR_EQUAL( random_number, 0.0 );
+    FRENSIE_CHECK_LESS( random_number, 1.0 );
+  }
+
+  FRENSIE_CHECK_EQUAL( generator.getDrawCounter(), 1000ULL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that a buffer of random numbers can be obtained
+FRENSIE_UNIT_TEST( PhiloxGenerator, getRandomNumbers )
+{
+  Utility::PhiloxGenerator generator, reference_generator;
+
+  // Start in the middle of a block
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(),
+                       reference_generator.getRandomNumber() );
+
+  std::vector<double> random_numbers( 11 );
+
+  generator.getRandomNumbers( random_numbers.data(), random_numbers.size() );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( random_numbers[i],
+                         reference_generator.getRandomNumber() );
+  }
+
+  FRENSIE_CHECK_EQUAL( generator.getDrawCounter(), 12ULL );
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(),
+                       reference_generator.getRandomNumber() );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized to a new history
+FRENSIE_UNIT_TEST( PhiloxGenerator, changeHistory )
+{
+  Utility::PhiloxGenerator generator;
+
+  double first_random_number = generator.getRandomNumber();
+
+  generator.changeHistory( 10ULL );
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 10ULL );
+  FRENSIE_CHECK_EQUAL( generator.getParticle(), 0u );
+  FRENSIE_CHECK_EQUAL( generator.getDrawCounter(), 0ULL );
+  FRENSIE_CHECK( generator.getRandomNumber() != first_random_number );
+
+  generator.nextHistory();
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 11ULL );
+
+  // Returning to a history must reproduce its stream
+  generator.changeHistory( 0ULL );
+
+  FRENSIE_CHECK_EQUAL( generator.getRandomNumber(), first_random_number );
+
+  // Histories beyond 2^32 must be supported
+  generator.changeHistory( 5000000000ULL );
+
+  FRENSIE_CHECK_EQUAL( generator.getHistory(), 5000000000ULL );
+}
+
+//---------------------------------------------------------------------------//
+// Check that the generator can be initialized to a new particle
+FRENSIE_UNIT_TEST( PhiloxGenerator, changeParticle )
+{
+  Utility::PhiloxGenerator generator;
+
+  generator.changeHistory( 3ULL );
+
+  std::set<unsigned long long> random_integers;
+
+  for( uint32_t i = 0; i < 10u; ++i )
+  {
+    generator.changeParticle( i );
+
+    FRENSIE_CHECK_EQUAL( generator.getParticle(), i );
+    FRENSIE_CHECK_EQUAL( generator.getHistory(), 3ULL );
+
+    for( unsigned j = 0; j < 10; ++j )
+      random_integers.insert( generator.getRandomInteger() );
+  }
+
+  // The particle streams must not overlap
+  FRENSIE_CHECK_EQUAL( random_integers.size(), 100 );
+}
+
+//---------------------------------------------------------------------------//
+// Check that different seeds produce different streams
+FRENSIE_UNIT_TEST( PhiloxGenerator, seed )
+{
+  Utility::PhiloxGenerator generator, seeded_generator( 7u );
+
+  FRENSIE_CHECK_EQUAL( generator.getSeed(), 0u );
+  FRENSIE_CHECK_EQUAL( seeded_generator.getSeed(), 7u );
+  FRENSIE_CHECK( generator.getRandomInteger() !=
+                 seeded_generator.getRandomInteger() );
+}
+
+//---------------------------------------------------------------------------//
+// end tstPhiloxGenerator.cpp
+//---------------------------------------------------------------------------//
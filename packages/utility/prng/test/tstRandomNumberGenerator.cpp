@@ -133,6 +133,56 @@ FRENSIE_UNIT_TEST( RandomNumberGenerator, initialize_history )
   FRENSIE_CHECK_EQUAL( all_random_numbers.size(), random_set.size() );
 }
 
+//---------------------------------------------------------------------------//
+// Check that the counter-based generator can be used
+FRENSIE_UNIT_TEST( RandomNumberGenerator, setGeneratorType )
+{
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+
+  Utility::RandomNumberGenerator::setGeneratorType( Utility::PHILOX_GENERATOR );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getGeneratorType(),
+                       Utility::PHILOX_GENERATOR );
+
+  Utility::RandomNumberGenerator::initialize( 5ULL );
+  Utility::RandomNumberGenerator::initializeParticle( 2u );
+
+  Utility::PhiloxGenerator reference_generator;
+  reference_generator.changeHistory( 5ULL );
+  reference_generator.changeParticle( 2u );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       reference_generator.getRandomNumber() );
+
+  std::vector<double> random_numbers( 5 );
+
+  Utility::RandomNumberGenerator::getRandomNumbers( random_numbers.data(),
+                                                    random_numbers.size() );
+
+  for( size_t i = 0; i < random_numbers.size(); ++i )
+  {
+    FRENSIE_CHECK_EQUAL( random_numbers[i],
+                         reference_generator.getRandomNumber() );
+  }
+
+  // A fake stream must override the counter-based generator
+  std::vector<double> fake_stream( 1, 0.5 );
+
+  Utility::RandomNumberGenerator::setFakeStream( fake_stream );
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       0.5 );
+
+  Utility::RandomNumberGenerator::unsetFakeStream();
+
+  FRENSIE_CHECK_EQUAL( Utility::RandomNumberGenerator::getRandomNumber<double>(),
+                       reference_generator.getRandomNumber() );
+
+  Utility::RandomNumberGenerator::setGeneratorType(
+                                     Utility::LINEAR_CONGRUENTIAL_GENERATOR );
+}
+
 //---------------------------------------------------------------------------//
 // Custom Setup
 //---------------------------------------------------------------------------//
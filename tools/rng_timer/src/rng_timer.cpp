@@ -8,15 +8,14 @@
 
 // Std Lib Includes
 #include <iostream>
+#include <string>
+#include <vector>
 #include <time.h>
 
 // Boost Scoped Pointer
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
 
-// Trilinos Includes
-#include <Teuchos_RCP.hpp>
-
 // FRENSIE Includes
 #include "Utility_RandomNumberGenerator.hpp"
 
@@ -24,10 +23,19 @@
 #define TIME() (clock()/((double)CLOCKS_PER_SEC))
 
 // Generator timing function
-void timeGenerator( const int trial_size, const int histories = 1 )
+void timeGenerator( const Utility::RandomNumberGeneratorType type,
+                    const int trial_size,
+                    const int histories = 1 )
 {
-  // Raw generator
-  Utility::LinearCongruentialGenerator generator;
+  Utility::RandomNumberGenerator::setGeneratorType( type );
+
+  // Raw generators
+  Utility::LinearCongruentialGenerator lcg_generator;
+  Utility::PhiloxGenerator philox_generator;
+
+  // Batch buffer
+  const int batch_size = 64;
+  std::vector<double> batch( batch_size );
 
   double time1 = TIME();
 
@@ -39,23 +47,50 @@ void timeGenerator( const int trial_size, const int histories = 1 )
     for( int j = 0; j < trial_size/histories; ++j )
       Utility::RandomNumberGenerator::getRandomNumber<double>();
   }
-  std::cout << std::endl;
 
   double time2 = TIME();
 
-  // Raw double generator timing
+  // Wrapped batch generator timing
   for( int i = 0; i < histories; ++i )
   {
-    for( int j = 0; j < trial_size/histories; ++j )
-      generator.getRandomNumber();
+    Utility::RandomNumberGenerator::initialize( i );
 
-    generator.nextHistory();
+    for( int j = 0; j < trial_size/histories; j += batch_size )
+    {
+      Utility::RandomNumberGenerator::getRandomNumbers( batch.data(),
+                                                        batch_size );
+    }
   }
 
   double time3 = TIME();
 
+  // Raw double generator timing
+  if( type == Utility::PHILOX_GENERATOR )
+  {
+    for( int i = 0; i < histories; ++i )
+    {
+      for( int j = 0; j < trial_size/histories; ++j )
+        philox_generator.getRandomNumber();
+
+      philox_generator.nextHistory();
+    }
+  }
+  else
+  {
+    for( int i = 0; i < histories; ++i )
+    {
+      for( int j = 0; j < trial_size/histories; ++j )
+        lcg_generator.getRandomNumber();
+
+      lcg_generator.nextHistory();
+    }
+  }
+
+  double time4 = TIME();
+
   // Check for valid time intervals
-  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 )
+  if( time2 - time1 < 1.0e-15 || time3 - time2 < 1.0e-15 ||
+      time4 - time3 < 1.0e-15 )
   {
     std::cerr << "Timing information not accurate enough for this generator."
 	      << std::endl;
@@ -64,12 +99,16 @@ void timeGenerator( const int trial_size, const int histories = 1 )
   {
     // Calculate the generation speed (Millions/sec)
     double mdbls_per_sec_wrapped = trial_size/(time2-time1)/1e6;
-    double mdbls_per_sec_raw = trial_size/(time3-time2)/1e6;
+    double mdbls_per_sec_batch = trial_size/(time3-time2)/1e6;
+    double mdbls_per_sec_raw = trial_size/(time4-time3)/1e6;
 
     // Print the last double generated
     std::cout << "Last random number generated: "
-	      << generator.getRandomNumber() << " "
-	      << Utility::RandomNumberGenerator::getRandomNumber<double>()
+	      << (type == Utility::PHILOX_GENERATOR ?
+                  philox_generator.getRandomNumber() :
+                  lcg_generator.getRandomNumber() ) << " "
+	      << Utility::RandomNumberGenerator::getRandomNumber<double>() << " "
+              << batch.back()
 	      << std::endl
 	      << "Random numbers per history: " << trial_size/histories
 	      << std::endl
@@ -78,12 +117,32 @@ void timeGenerator( const int trial_size, const int histories = 1 )
 	      << "  Wrapped Double generator:\tTime = " << time2-time1
 	      << " seconds " << "=> " << mdbls_per_sec_wrapped
 	      << std::endl
-	      << "  Raw Double generator:\t\tTime = " << time3-time2
+	      << "  Wrapped Batch generator:\tTime = " << time3-time2
+	      << " seconds " << "=> " << mdbls_per_sec_batch
+	      << std::endl
+	      << "  Raw Double generator:\t\tTime = " << time4-time3
 	      << " seconds " << "=> " << mdbls_per_sec_raw
 	      << std::endl << std::endl;
   }
 }
 
+// Time a generator type for several history sizes
+void timeGeneratorType( const Utility::RandomNumberGeneratorType type,
+                        const std::string& type_name,
+                        const int trial_size )
+{
+  std::cout << "Timing " << type_name << " for single history" << std::endl;
+  timeGenerator( type, trial_size );
+
+  std::cout << "Timing " << type_name << " for 10 histories" << std::endl;
+  timeGenerator( type, trial_size, 10 );
+
+  std::cout << "Timing " << type_name << " for 100 histories" << std::endl;
+  timeGenerator( type, trial_size, 100 );
+
+  std::cout << "Timing " << type_name << " for 1000 histories" << std::endl;
+  timeGenerator( type, trial_size, 1000 );
+}
 
 // Main itming function
 int main()
@@ -94,17 +153,13 @@ int main()
 
   int trial_size = 10000000;
 
-  std::cout << "Timing generator for single history" << std::endl;
-  timeGenerator( trial_size );
-
-  std::cout << "Timing generator for 10 histories" << std::endl;
-  timeGenerator( trial_size, 10 );
-
-  std::cout << "Timing generator for 100 histories" << std::endl;
-  timeGenerator( trial_size, 100 );
+  timeGeneratorType( Utility::LINEAR_CONGRUENTIAL_GENERATOR,
+                     "linear congruential generator",
+                     trial_size );
 
-  std::cout << "Timing generator for 1000 histories" << std::endl;
-  timeGenerator( trial_size, 1000 );
+  timeGeneratorType( Utility::PHILOX_GENERATOR,
+                     "Philox generator",
+                     trial_size );
 
   return 0;
 }